@@ -1,4 +1,13 @@
+#include "async_program_compiler.hpp"
+#include "async_readback.hpp"
 #include "buffer.hpp"
+#include "frame_capture.hpp"
+#include "framebuffer.hpp"
+#include "gpu_memory.hpp"
+#include "gpu_timer.hpp"
+#include "profiler.hpp"
+#include "program_binary_cache.hpp"
+#include "render_target.hpp"
 #include "shader.hpp"
 #include "texture.hpp"
 #include "vao.hpp"
\ No newline at end of file
@@ -1,6 +1,9 @@
 .PHONY: OpenGL_utils
 
-OPENGL_UTILS_OBJ:=$(patsubst %.cpp,$(OBJ)%.o,$(wildcard ./OpenGL_utils/*.cpp))
+# the headless context needs EGL, it is linked only into targets that render without a window (see renderer_bench)
+OPENGL_UTILS_HEADLESS_SRC:=./OpenGL_utils/headless_context.cpp
+OPENGL_UTILS_HEADLESS_OBJ:=$(patsubst %.cpp,$(OBJ)%.o,$(OPENGL_UTILS_HEADLESS_SRC))
+OPENGL_UTILS_OBJ:=$(patsubst %.cpp,$(OBJ)%.o,$(filter-out $(OPENGL_UTILS_HEADLESS_SRC),$(wildcard ./OpenGL_utils/*.cpp)))
 OPENGL_UTILS_LIB:=$(OUT)OpenGL_utils/libOpenGL_utils.a
 
 OpenGL_utils: $(OPENGL_UTILS_LIB)
@@ -0,0 +1,121 @@
+#include "async_program_compiler.hpp"
+#include "profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+
+namespace render
+{
+    AsyncProgramCompiler::AsyncProgramCompiler(GLuint maxThreads_) :
+        _parallel(GLEW_KHR_parallel_shader_compile)
+    {
+        if(_parallel)
+            glMaxShaderCompilerThreadsKHR(maxThreads_);
+    }
+
+    AsyncShaderProgram AsyncProgramCompiler::Compile(std::initializer_list<ShaderSource> sources_, bool retrievableBinary_)
+    {
+        PROFILE_SCOPE("AsyncProgramCompiler::Compile");
+        AsyncShaderProgram handle;
+        handle._state = std::make_shared<AsyncShaderProgram::State>();
+        AsyncShaderProgram::State &state = *handle._state;
+
+        state.name = glCreateProgram();
+        for(const ShaderSource &source : sources_)
+        {
+            GLuint shader = glCreateShader(source.type);
+            const GLchar* code = source.code.data();
+            GLint length = source.code.size();
+            glShaderSource(shader, 1, &code, &length);
+            glCompileShader(shader);
+            glAttachShader(state.name, shader);
+            state.shaders.push_back(shader);
+        }
+        if(retrievableBinary_)
+            glProgramParameteri(state.name, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+        glLinkProgram(state.name); // compile status is checked together with link status in Finalize
+
+        _pending.push_back(handle._state);
+        return handle;
+    }
+
+    void AsyncProgramCompiler::Finalize(AsyncShaderProgram::State &state_)
+    {
+        GLint linkStatus;
+        glGetProgramiv(state_.name, GL_LINK_STATUS, &linkStatus);
+        if(!linkStatus)
+        {
+            for(GLuint shader : state_.shaders)
+            {
+                GLint compileStatus, type, logLen;
+                glGetShaderiv(shader, GL_COMPILE_STATUS, &compileStatus);
+                if(compileStatus)
+                    continue;
+                glGetShaderiv(shader, GL_SHADER_TYPE, &type);
+                glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &logLen);
+                std::vector<char> log(logLen + 1, '\0');
+                glGetShaderInfoLog(shader, logLen + 1, 0, log.data());
+                std::fprintf(stderr, "%s shader compilation error: %s\n", ShaderTypeToStr(type), log.data());
+            }
+            GLint logLen;
+            glGetProgramiv(state_.name, GL_INFO_LOG_LENGTH, &logLen);
+            std::vector<char> log(logLen + 1, '\0');
+            glGetProgramInfoLog(state_.name, logLen + 1, 0, log.data());
+            std::fprintf(stderr, "Shader Linking Error: %s\n", log.data());
+        }
+        for(GLuint shader : state_.shaders)
+        {
+            glDetachShader(state_.name, shader);
+            glDeleteShader(shader);
+        }
+        state_.shaders.clear();
+
+        if(!linkStatus)
+        {
+            glDeleteProgram(state_.name);
+            state_.status = AsyncShaderProgram::FAILED;
+        }
+        else
+        {
+            state_.program._name = state_.name;
+            state_.program.instanceCount = new GLuint(1);
+            state_.status = AsyncShaderProgram::READY;
+        }
+        state_.name = 0;
+    }
+
+    size_t AsyncProgramCompiler::Poll()
+    {
+        auto done = [this](const std::shared_ptr<AsyncShaderProgram::State> &state)
+        {
+            if(_parallel)
+            {
+                GLint completed = GL_FALSE;
+                glGetProgramiv(state->name, GL_COMPLETION_STATUS_KHR, &completed);
+                if(!completed)
+                    return false;
+            }
+            Finalize(*state);
+            return true;
+        };
+        _pending.erase(std::remove_if(_pending.begin(), _pending.end(), done), _pending.end());
+        return _pending.size();
+    }
+
+    void AsyncProgramCompiler::Finish(const AsyncShaderProgram& program_)
+    {
+        if(!program_.pending())
+            return;
+        auto it = std::find(_pending.begin(), _pending.end(), program_._state);
+        if(it == _pending.end())
+            return;
+        Finalize(**it);
+        _pending.erase(it);
+    }
+
+    void AsyncProgramCompiler::FinishAll()
+    {
+        for(const std::shared_ptr<AsyncShaderProgram::State> &state : _pending)
+            Finalize(*state);
+        _pending.clear();
+    }
+}
\ No newline at end of file
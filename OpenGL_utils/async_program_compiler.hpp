@@ -0,0 +1,105 @@
+#pragma once
+#include <initializer_list>
+#include <memory>
+#include <vector>
+#include <GL/glew.h>
+
+#include "shader.hpp"
+
+namespace render
+{
+    // Future-like handle to a program compiled by AsyncProgramCompiler,
+    // empty ShaderProgram is returned by get() until the program is ready
+    class AsyncShaderProgram
+    {
+        friend class AsyncProgramCompiler;
+    public:
+        enum Status
+        {
+            PENDING,
+            READY,
+            FAILED
+        };
+    private:
+        struct State
+        {
+            Status status = PENDING;
+            GLuint name = 0;              // program name while PENDING
+            std::vector<GLuint> shaders;  // attached until link completes
+            ShaderProgram program;        // valid once READY
+            ~State()
+            {
+                for(GLuint shader : shaders)
+                    glDeleteShader(shader);
+                if(name)
+                    glDeleteProgram(name);
+            }
+        };
+        std::shared_ptr<State> _state;
+    public:
+        AsyncShaderProgram() {}
+        // already linked program, READY unless it is empty
+        AsyncShaderProgram(const ShaderProgram& program) :
+            _state(std::make_shared<State>())
+        {
+            _state->status = program ? READY : FAILED;
+            _state->program = program;
+        }
+        inline Status status() const
+        {
+            return _state ? _state->status : FAILED;
+        }
+        inline bool ready() const
+        {
+            return status() == READY;
+        }
+        inline bool pending() const
+        {
+            return status() == PENDING;
+        }
+        inline const ShaderProgram& get() const
+        {
+            static const ShaderProgram empty;
+            return ready() ? _state->program : empty;
+        }
+        // fallback is returned while pending or when compilation failed
+        inline const ShaderProgram& Or(const ShaderProgram& fallback) const
+        {
+            return ready() ? _state->program : fallback;
+        }
+    };
+
+    // Issues compiles and links without querying their status, so with KHR_parallel_shader_compile
+    // the driver compiles on its own threads while the render thread keeps going.
+    // Poll() once per frame finalizes programs whose GL_COMPLETION_STATUS_KHR is set,
+    // without the extension every program is finalized on the first Poll() (blocking on the driver).
+    class AsyncProgramCompiler
+    {
+    private:
+        std::vector<std::shared_ptr<AsyncShaderProgram::State>> _pending;
+        bool _parallel;
+
+        static void Finalize(AsyncShaderProgram::State &state);
+    public:
+        // maxThreads is passed to glMaxShaderCompilerThreadsKHR, 0xFFFFFFFF lets the driver decide
+        AsyncProgramCompiler(GLuint maxThreads = 0xFFFFFFFF);
+
+        AsyncShaderProgram Compile(std::initializer_list<ShaderSource> sources, bool retrievableBinary = false);
+        // finalizes finished programs, returns number of programs still pending
+        size_t Poll();
+        // blocks until program is ready or failed
+        void Finish(const AsyncShaderProgram& program);
+        // blocks until every pending program is ready or failed
+        void FinishAll();
+
+        inline size_t pending() const
+        {
+            return _pending.size();
+        }
+        // whether the driver compiles in the background
+        inline bool parallel() const
+        {
+            return _parallel;
+        }
+    };
+}
\ No newline at end of file
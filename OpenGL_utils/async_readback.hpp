@@ -0,0 +1,172 @@
+#pragma once
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+#include <GL/glew.h>
+
+#include "gpu_memory.hpp"
+#include "texture.hpp"
+
+namespace render
+{
+    // Reads framebuffers and textures back without stalling: each Read() copies into one slot of a ring
+    // of persistently mapped pixel pack buffers and fences the copy, Poll() hands out the slots whose
+    // fence signaled, in the order they were read, usually a frame or two later.
+    // With every slot in flight Read() fails instead of waiting, the caller skips or retries that frame.
+    // Rows arrive bottom up as GL stores them and tightly packed.
+    class AsyncReadback
+    {
+    public:
+        struct Result
+        {
+            uint64_t id;             // as passed to Read()
+            GLsizei width, height;
+            TexFormat format;
+            TexCompType type;
+            const void* pixels;      // valid during the Poll() callback only
+            size_t size;
+        };
+    private:
+        struct Slot
+        {
+            GLuint buffer = 0;
+            void* mapped = nullptr;
+            size_t capacity = 0;
+            GpuMemory::Handle memory = 0;
+            GLsync fence = nullptr;
+            Result result;
+        };
+        std::vector<Slot> _slots;
+        uint64_t _issued = 0, _delivered = 0; // ring index is count % slots
+
+        static size_t ComponentCount(TexFormat format)
+        {
+            switch(format)
+            {
+                case TexFormat::R:
+                    return 1;
+                case TexFormat::RG:
+                    return 2;
+                case TexFormat::RGB:
+                    return 3;
+                case TexFormat::RGBA:
+                    return 4;
+                default:
+                    return 0;
+            }
+        }
+        // next free slot with room for size bytes bound as pack buffer, null with every slot in flight
+        Slot* Begin(size_t size)
+        {
+            if(_issued - _delivered == _slots.size())
+                return nullptr;
+            Slot& slot = _slots[_issued % _slots.size()];
+            if(slot.capacity < size)
+            {
+                constexpr GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+                Release(slot);
+                glCreateBuffers(1, &slot.buffer);
+                glNamedBufferStorage(slot.buffer, size, nullptr, flags);
+                slot.mapped = glMapNamedBufferRange(slot.buffer, 0, size, flags);
+                if(!slot.mapped)
+                {
+                    std::fputs("Error: Failed to map readback buffer!\n", stderr);
+                    Release(slot);
+                    return nullptr;
+                }
+                slot.capacity = size;
+                slot.memory = GpuMemory::Track(GpuMemoryCategory::BUFFER, size);
+                GpuMemory::Label(slot.memory, GpuMemoryCategory::BUFFER, "Readback");
+            }
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            return &slot;
+        }
+        void End(Slot& slot, Result result)
+        {
+            glPixelStorei(GL_PACK_ALIGNMENT, 4);
+            glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+            slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            result.pixels = slot.mapped;
+            slot.result = result;
+            ++_issued;
+        }
+        static void Release(Slot& slot)
+        {
+            if(slot.fence)
+                glDeleteSync(slot.fence);
+            if(slot.buffer)
+            {
+                glUnmapNamedBuffer(slot.buffer);
+                glDeleteBuffers(1, &slot.buffer);
+            }
+            GpuMemory::Untrack(slot.memory);
+            slot = Slot();
+        }
+    public:
+        // slots bounds the readbacks in flight, 3 covers the usual driver queue depth
+        AsyncReadback(GLuint slots = 3) :
+            _slots(slots ? slots : 1)
+        {}
+        ~AsyncReadback()
+        {
+            for(Slot& slot : _slots)
+                Release(slot);
+        }
+        AsyncReadback(const AsyncReadback&) = delete;
+        AsyncReadback& operator=(const AsyncReadback&) = delete;
+
+        // copies a rectangle of the read buffer of framebuffer, 0 is the default framebuffer
+        bool Read(GLuint framebuffer, GLenum readBuffer, GLint x, GLint y, GLsizei width, GLsizei height,
+                  TexFormat format, TexCompType type, uint64_t id = 0)
+        {
+            size_t size = (size_t)width * height * ComponentCount(format) * TexCompTypeSize(type);
+            Slot* slot = Begin(size);
+            if(!slot)
+                return false;
+            GLint previous;
+            glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previous);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+            glReadBuffer(readBuffer);
+            glReadPixels(x, y, width, height, (GLenum)format, (GLenum)type, nullptr);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, previous);
+            End(*slot, Result{id, width, height, format, type, nullptr, size});
+            return true;
+        }
+        // copies a whole level of texture
+        bool Read(const Texture2D& texture, GLint level, TexFormat format, TexCompType type, uint64_t id = 0)
+        {
+            GLsizei width = std::max(texture->width >> level, 1), height = std::max(texture->height >> level, 1);
+            size_t size = (size_t)width * height * ComponentCount(format) * TexCompTypeSize(type);
+            Slot* slot = Begin(size);
+            if(!slot)
+                return false;
+            glGetTextureImage(texture, level, (GLenum)format, (GLenum)type, size, nullptr);
+            End(*slot, Result{id, width, height, format, type, nullptr, size});
+            return true;
+        }
+        // Calls callback(const Result&) for every finished readback in order, stops at the first unfinished one.
+        // With wait it blocks until all readbacks in flight are delivered, e.g. at shutdown.
+        template<typename Callback>
+        size_t Poll(Callback&& callback, bool wait = false)
+        {
+            size_t delivered = 0;
+            for(; _delivered < _issued; ++_delivered, ++delivered)
+            {
+                Slot& slot = _slots[_delivered % _slots.size()];
+                // the flush bit makes sure the fence gets submitted and can signal at all
+                GLenum status = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? ~GLuint64(0) : 0);
+                if(status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED)
+                    break;
+                glDeleteSync(slot.fence);
+                slot.fence = nullptr;
+                callback(slot.result);
+            }
+            return delivered;
+        }
+        inline size_t pending() const
+        {
+            return _issued - _delivered;
+        }
+    };
+}
\ No newline at end of file
@@ -20,13 +20,15 @@ namespace render
             _name = 0;
             exit(EXIT_FAILURE);
         }
+        _memory = GpuMemory::Track(GpuMemoryCategory::BUFFER, _size);
     }
     ConstSharedBuffer::__Buffer::__Buffer(__Buffer&& other) noexcept
-        : _data(other._data), _size(other._size), _name(other._name)
+        : _data(other._data), _size(other._size), _name(other._name), _memory(other._memory)
     {
         other._size = 0;
         other._name = 0;
         other._data = nullptr;
+        other._memory = 0;
     }
     ConstSharedBuffer::__Buffer& ConstSharedBuffer::__Buffer::operator=(ConstSharedBuffer::__Buffer&& other) noexcept
     {
@@ -37,12 +39,15 @@ namespace render
                 glUnmapNamedBuffer(_name);
                 glDeleteBuffers(1, &_name);
             }
+            GpuMemory::Untrack(_memory);
             _size = other._size;
             _name = other._name;
             _data = other._data;
+            _memory = other._memory;
             other._size = 0;
             other._name = 0;
             other._data = nullptr;
+            other._memory = 0;
         }
         return *this;
     }
@@ -53,6 +58,7 @@ namespace render
             glUnmapNamedBuffer(_name);
             glDeleteBuffers(1, &_name);
         }
+        GpuMemory::Untrack(_memory);
     }
 
     ConstSharedBuffer::ConstSharedBuffer(const ConstSharedBuffer &other)
@@ -102,4 +108,12 @@ namespace render
         }
         return *this;
     }
+    void ConstSharedBuffer::Label(GpuMemoryCategory category, const char* name) const
+    {
+        if(!buffer)
+            return;
+        GpuMemory::Label(buffer->memory(), category, name);
+        if(name)
+            glObjectLabel(GL_BUFFER, buffer->name(), -1, name);
+    }
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <GL/glew.h>
 #include <glm/glm.hpp>
 #include <cstdio>
+#include "gpu_memory.hpp"
 namespace render
 {
     template<typename T1, typename T2>
@@ -21,6 +22,7 @@ namespace render
             void* _data = nullptr;
             GLuint _size = 0;
             GLuint _name = 0;
+            GpuMemory::Handle _memory = 0;
             mutable GLuint _refCount = 0;
         public:
             __Buffer(const __Buffer&) = delete;
@@ -62,6 +64,10 @@ namespace render
             {
                 return _name;
             }
+            inline GpuMemory::Handle memory() const
+            {
+                return _memory;
+            }
         };
     protected:
         __Buffer *buffer = nullptr;
@@ -92,6 +98,8 @@ namespace render
         {
             return name();
         }
+        // files the buffer under category in GpuMemory and names it there and in GL debug output
+        void Label(GpuMemoryCategory category, const char* name = nullptr) const;
         ~ConstSharedBuffer()
         {
             if(buffer) buffer->Release();
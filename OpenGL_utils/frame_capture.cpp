@@ -0,0 +1,182 @@
+#include "frame_capture.hpp"
+#include <algorithm>
+#include <cstring>
+// the declarations came with texture.hpp, this includes the implementation only
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include "external/stb/stb_image_write.h"
+#pragma GCC diagnostic pop
+
+namespace render
+{
+    FrameCapture::FrameCapture(std::string path, Format format, uint32_t fps, uint32_t threadCount, size_t queueCapacity) :
+        _path(std::move(path)),
+        _format(format),
+        _fps(fps ? fps : 60),
+        _capacity(queueCapacity ? queueCapacity : 1)
+    {
+        if(_format == Y4M && !(_stream = std::fopen(_path.c_str(), "wb")))
+            std::fprintf(stderr, "Error: Failed to open %s for writing!\n", _path.c_str());
+        for(uint32_t i = 0; i < std::max(threadCount, 1u); i++)
+            _workers.emplace_back(&FrameCapture::WorkerLoop, this);
+    }
+    FrameCapture::~FrameCapture()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _quit = true;
+        }
+        _queued.notify_all();
+        for(std::thread& worker : _workers)
+            worker.join();
+        if(_stream)
+            std::fclose(_stream);
+    }
+
+    bool FrameCapture::Enqueue(uint64_t frame, GLsizei width, GLsizei height, uint32_t components, const void* pixels, bool flip, bool block)
+    {
+        if(components != 3 && components != 4)
+        {
+            std::fputs("Error: Frame capture needs RGB or RGBA pixels!\n", stderr);
+            return false;
+        }
+        {
+            std::unique_lock lock(_mutex);
+            if(block)
+                _dequeued.wait(lock, [&] { return _queue.size() < _capacity; });
+            else if(_queue.size() >= _capacity)
+            {
+                ++_dropped;
+                return false;
+            }
+        }
+        // the copy is made outside the lock, the queue may briefly hold capacity + producers jobs
+        Job job{0, frame, width, height, components, std::vector<uint8_t>((size_t)width * height * components)};
+        size_t rowSize = (size_t)width * components;
+        for(GLsizei y = 0; y < height; y++)
+            std::memcpy(job.pixels.data() + y * rowSize, (const uint8_t*)pixels + (flip ? height - 1 - y : y) * rowSize, rowSize);
+        {
+            std::lock_guard lock(_mutex);
+            job.sequence = _submitted++;
+            _queue.push_back(std::move(job));
+        }
+        _queued.notify_one();
+        return true;
+    }
+    bool FrameCapture::Submit(const AsyncReadback::Result& result, bool block)
+    {
+        if(result.type != TexCompType::UNSIGNED_BYTE || (result.format != TexFormat::RGB && result.format != TexFormat::RGBA))
+        {
+            std::fputs("Error: Frame capture needs UNSIGNED_BYTE RGB or RGBA readbacks!\n", stderr);
+            return false;
+        }
+        return Enqueue(result.id, result.width, result.height, result.format == TexFormat::RGB ? 3 : 4, result.pixels, true, block);
+    }
+    void FrameCapture::Flush()
+    {
+        std::unique_lock lock(_mutex);
+        _written.wait(lock, [&] { return _nextWrite == _submitted; });
+    }
+    uint64_t FrameCapture::encoded()
+    {
+        std::lock_guard lock(_mutex);
+        return _encoded;
+    }
+    uint64_t FrameCapture::dropped()
+    {
+        std::lock_guard lock(_mutex);
+        return _dropped;
+    }
+
+    void FrameCapture::WorkerLoop()
+    {
+        while(true)
+        {
+            Job job;
+            {
+                std::unique_lock lock(_mutex);
+                _queued.wait(lock, [&] { return _quit || !_queue.empty(); });
+                if(_queue.empty())
+                    return;
+                job = std::move(_queue.front());
+                _queue.pop_front();
+            }
+            _dequeued.notify_one();
+            bool encoded = _format == PNG ? EncodePng(job) : EncodeY4m(job);
+            {
+                std::unique_lock lock(_mutex);
+                // PNG frames finish in any order, _nextWrite only counts them there
+                if(_format == PNG)
+                    ++_nextWrite;
+                ++(encoded ? _encoded : _dropped);
+            }
+            _written.notify_all();
+        }
+    }
+    bool FrameCapture::EncodePng(const Job& job)
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%06llu.png", (unsigned long long)job.frame);
+        std::string path = _path + name;
+        if(!stbi_write_png(path.c_str(), job.width, job.height, job.components, job.pixels.data(), job.width * job.components))
+        {
+            std::fprintf(stderr, "Error: Failed to write %s!\n", path.c_str());
+            return false;
+        }
+        return true;
+    }
+    bool FrameCapture::EncodeY4m(const Job& job)
+    {
+        // BT.601 limited range, chroma averaged over 2x2 blocks, odd edges repeat the last pixel
+        GLsizei chromaWidth = (job.width + 1) / 2, chromaHeight = (job.height + 1) / 2;
+        std::vector<uint8_t> planes((size_t)job.width * job.height + 2 * (size_t)chromaWidth * chromaHeight);
+        uint8_t* luma = planes.data();
+        uint8_t* cb = luma + (size_t)job.width * job.height;
+        uint8_t* cr = cb + (size_t)chromaWidth * chromaHeight;
+        auto pixel = [&](GLsizei x, GLsizei y)
+        {
+            return job.pixels.data() + ((size_t)std::min(y, job.height - 1) * job.width + std::min(x, job.width - 1)) * job.components;
+        };
+        for(GLsizei y = 0; y < job.height; y++)
+            for(GLsizei x = 0; x < job.width; x++)
+            {
+                const uint8_t* p = pixel(x, y);
+                luma[(size_t)y * job.width + x] = (uint8_t)(((66 * p[0] + 129 * p[1] + 25 * p[2] + 128) >> 8) + 16);
+            }
+        for(GLsizei y = 0; y < chromaHeight; y++)
+            for(GLsizei x = 0; x < chromaWidth; x++)
+            {
+                int r = 0, g = 0, b = 0;
+                for(const uint8_t* p : {pixel(2 * x, 2 * y), pixel(2 * x + 1, 2 * y), pixel(2 * x, 2 * y + 1), pixel(2 * x + 1, 2 * y + 1)})
+                {
+                    r += p[0];
+                    g += p[1];
+                    b += p[2];
+                }
+                // sums of four, the shift by 10 averages and scales at once
+                cb[(size_t)y * chromaWidth + x] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 512) >> 10) + 128);
+                cr[(size_t)y * chromaWidth + x] = (uint8_t)(((112 * r - 94 * g - 18 * b + 512) >> 10) + 128);
+            }
+
+        std::unique_lock lock(_mutex);
+        _written.wait(lock, [&] { return _nextWrite == job.sequence; });
+        bool written = false;
+        if(_stream && _streamWidth == 0)
+        {
+            _streamWidth = job.width;
+            _streamHeight = job.height;
+            std::fprintf(_stream, "YUV4MPEG2 W%d H%d F%u:1 Ip A1:1 C420jpeg\n", job.width, job.height, _fps);
+        }
+        if(_stream && (job.width != _streamWidth || job.height != _streamHeight))
+            std::fprintf(stderr, "Error: Frame %llu does not match the %dx%d Y4M stream!\n",
+                (unsigned long long)job.frame, _streamWidth, _streamHeight);
+        else if(_stream)
+        {
+            std::fputs("FRAME\n", _stream);
+            written = std::fwrite(planes.data(), 1, planes.size(), _stream) == planes.size();
+        }
+        ++_nextWrite;
+        return written;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <GL/glew.h>
+
+#include "async_readback.hpp"
+
+namespace render
+{
+    // Encodes captured frames on worker threads into numbered PNG files or one raw YUV4MPEG2 (4:2:0) stream.
+    // Submit() copies the pixels into a queue of at most queueCapacity frames and blocks while it is full,
+    // so a renderer outpacing the encoders is slowed down instead of growing memory, TrySubmit() drops the
+    // frame instead. Y4M frames are written in submission order and need the size of the first one.
+    // Pixels are 8 bit RGB or RGBA, alpha is ignored by Y4M.
+    class FrameCapture
+    {
+    public:
+        enum Format
+        {
+            PNG,
+            Y4M
+        };
+    private:
+        struct Job
+        {
+            uint64_t sequence, frame;
+            GLsizei width, height;
+            uint32_t components;
+            std::vector<uint8_t> pixels; // top row first
+        };
+        const std::string _path;
+        const Format _format;
+        const uint32_t _fps;
+        const size_t _capacity;
+        std::mutex _mutex;
+        std::condition_variable _queued, _dequeued, _written;
+        std::deque<Job> _queue;
+        std::vector<std::thread> _workers;
+        uint64_t _submitted = 0, _nextWrite = 0, _encoded = 0, _dropped = 0;
+        bool _quit = false;
+        FILE* _stream = nullptr;
+        GLsizei _streamWidth = 0, _streamHeight = 0;
+
+        bool Enqueue(uint64_t frame, GLsizei width, GLsizei height, uint32_t components, const void* pixels, bool flip, bool block);
+        void WorkerLoop();
+        bool EncodePng(const Job& job);
+        // converts outside the lock, then waits for the frame's turn to be appended to the stream
+        bool EncodeY4m(const Job& job);
+    public:
+        // PNG frames go to path followed by the six digit frame number and .png, Y4M to the file at path
+        FrameCapture(std::string path, Format format, uint32_t fps = 60, uint32_t threadCount = 2, size_t queueCapacity = 8);
+        ~FrameCapture();
+        FrameCapture(const FrameCapture&) = delete;
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        // flip turns bottom up rows as read from GL into top down image rows
+        inline bool Submit(uint64_t frame, GLsizei width, GLsizei height, uint32_t components, const void* pixels, bool flip = true)
+        {
+            return Enqueue(frame, width, height, components, pixels, flip, true);
+        }
+        inline bool TrySubmit(uint64_t frame, GLsizei width, GLsizei height, uint32_t components, const void* pixels, bool flip = true)
+        {
+            return Enqueue(frame, width, height, components, pixels, flip, false);
+        }
+        // takes an AsyncReadback result of UNSIGNED_BYTE RGB or RGBA pixels, its id is the frame number
+        bool Submit(const AsyncReadback::Result& result, bool block = true);
+        // waits until every submitted frame is written
+        void Flush();
+
+        uint64_t encoded();
+        // frames TrySubmit() found no room for or that failed to encode
+        uint64_t dropped();
+    };
+}
\ No newline at end of file
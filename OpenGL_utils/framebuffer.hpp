@@ -0,0 +1,84 @@
+#pragma once
+#include <cstdio>
+#include <GL/glew.h>
+
+#include "texture.hpp"
+
+namespace render
+{
+    class Framebuffer
+    {
+    private:
+        GLuint _name;
+    public:
+        Framebuffer()
+        {
+            glCreateFramebuffers(1, &_name);
+        }
+        ~Framebuffer()
+        {
+            glDeleteFramebuffers(1, &_name);
+        }
+        Framebuffer(const Framebuffer&) = delete;
+        Framebuffer& operator=(const Framebuffer&) = delete;
+        Framebuffer(Framebuffer&& other) noexcept : _name(other._name)
+        {
+            other._name = 0;
+        }
+        Framebuffer& operator=(Framebuffer&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if(_name) glDeleteFramebuffers(1, &_name);
+                _name = other._name;
+                other._name = 0;
+            }
+            return *this;
+        }
+        inline GLuint name() const
+        {
+            return _name;
+        }
+        inline operator GLuint() const
+        {
+            return _name;
+        }
+        inline operator bool() const
+        {
+            return _name;
+        }
+        // attachment is e.g. GL_COLOR_ATTACHMENT0 or GL_DEPTH_ATTACHMENT
+        inline void AttachTexture(GLenum attachment, const Texture& texture, GLint level = 0)
+        {
+            glNamedFramebufferTexture(_name, attachment, texture, level);
+        }
+        // single layer of an array, cube map or 3D texture
+        inline void AttachTextureLayer(GLenum attachment, const Texture& texture, GLint layer, GLint level = 0)
+        {
+            glNamedFramebufferTextureLayer(_name, attachment, texture, level, layer);
+        }
+        // GL_NONE for depth only framebuffers
+        inline void DrawBuffer(GLenum buffer)
+        {
+            glNamedFramebufferDrawBuffer(_name, buffer);
+        }
+        bool Complete(GLenum target = GL_DRAW_FRAMEBUFFER) const
+        {
+            GLenum status = glCheckNamedFramebufferStatus(_name, target);
+            if(status != GL_FRAMEBUFFER_COMPLETE)
+            {
+                std::fprintf(stderr, "Error: Framebuffer %u incomplete, status 0x%x!\n", _name, status);
+                return false;
+            }
+            return true;
+        }
+        inline void Bind(GLenum target = GL_FRAMEBUFFER) const
+        {
+            glBindFramebuffer(target, _name);
+        }
+        static inline void BindDefault(GLenum target = GL_FRAMEBUFFER)
+        {
+            glBindFramebuffer(target, 0);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "gpu_memory.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+
+namespace render
+{
+    namespace
+    {
+        constexpr size_t CATEGORY_COUNT = (size_t)GpuMemoryCategory::COUNT;
+        struct State
+        {
+            std::mutex mutex;
+            std::vector<GpuMemory::Allocation> allocations; // indexed by handle - 1
+            std::vector<GpuMemory::Handle> freeHandles;
+            uint64_t used[CATEGORY_COUNT] = {};
+            uint64_t peak[CATEGORY_COUNT] = {};
+            uint64_t budget[CATEGORY_COUNT] = {};
+            bool reported[CATEGORY_COUNT] = {}; // over budget error printed, reset once back within
+        };
+        State& GetState()
+        {
+            static State state;
+            return state;
+        }
+        void Add(State& state, GpuMemoryCategory category, uint64_t bytes)
+        {
+            size_t i = (size_t)category;
+            state.used[i] += bytes;
+            state.peak[i] = std::max(state.peak[i], state.used[i]);
+        }
+        void Remove(State& state, GpuMemoryCategory category, uint64_t bytes)
+        {
+            state.used[(size_t)category] -= bytes;
+        }
+    }
+
+    const char* GpuMemoryCategoryName(GpuMemoryCategory category)
+    {
+        static const char* names[CATEGORY_COUNT] = {"BUFFER", "MESH", "INSTANCE", "UNIFORM", "STORAGE", "TEXTURE", "RENDER_TARGET"};
+        return (size_t)category < CATEGORY_COUNT ? names[(size_t)category] : "UNKNOWN";
+    }
+    GLsizei InternalFormatSize(GLenum internalFormat)
+    {
+        switch(internalFormat)
+        {
+            case GL_R8: case GL_R8UI: case GL_R8I: case GL_STENCIL_INDEX8:
+                return 1;
+            case GL_RG8: case GL_R16: case GL_R16F: case GL_R16UI: case GL_R16I: case GL_DEPTH_COMPONENT16:
+                return 2;
+            case GL_RGB8: case GL_SRGB8: case GL_RGBA8: case GL_SRGB8_ALPHA8: case GL_RG16: case GL_RG16F:
+            case GL_R32F: case GL_R32UI: case GL_R32I: case GL_RGB10_A2: case GL_R11F_G11F_B10F: case GL_RGB9_E5:
+            case GL_DEPTH_COMPONENT24: case GL_DEPTH_COMPONENT32: case GL_DEPTH_COMPONENT32F: case GL_DEPTH24_STENCIL8:
+                return 4;
+            case GL_RGB16: case GL_RGB16F: case GL_RGBA16: case GL_RGBA16F: case GL_RG32F: case GL_RG32UI: case GL_RG32I:
+            case GL_DEPTH32F_STENCIL8:
+                return 8;
+            case GL_RGB32F: case GL_RGB32UI: case GL_RGB32I: case GL_RGBA32F: case GL_RGBA32UI: case GL_RGBA32I:
+                return 16;
+        }
+        return 4;
+    }
+    uint64_t TextureStorageSize(GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei levels)
+    {
+        uint64_t texels = 0;
+        for(GLsizei level = 0; level < levels; level++)
+            texels += (uint64_t)std::max(width >> level, 1) * std::max(height >> level, 1);
+        return texels * std::max(depth, 1) * InternalFormatSize(internalFormat);
+    }
+
+    GpuMemory::Handle GpuMemory::Track(GpuMemoryCategory category, uint64_t bytes)
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        Handle handle;
+        if(!state.freeHandles.empty())
+        {
+            handle = state.freeHandles.back();
+            state.freeHandles.pop_back();
+        }
+        else
+        {
+            state.allocations.emplace_back();
+            handle = state.allocations.size();
+        }
+        state.allocations[handle - 1] = Allocation{category, bytes, {}};
+        Add(state, category, bytes);
+        return handle;
+    }
+    void GpuMemory::Untrack(Handle handle)
+    {
+        if(!handle)
+            return;
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        Allocation& allocation = state.allocations[handle - 1];
+        Remove(state, allocation.category, allocation.bytes);
+        allocation = Allocation();
+        state.freeHandles.push_back(handle);
+    }
+    void GpuMemory::Resize(Handle handle, uint64_t bytes)
+    {
+        if(!handle)
+            return;
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        Allocation& allocation = state.allocations[handle - 1];
+        Remove(state, allocation.category, allocation.bytes);
+        allocation.bytes = bytes;
+        Add(state, allocation.category, bytes);
+    }
+    void GpuMemory::Label(Handle handle, GpuMemoryCategory category, const char* name)
+    {
+        if(!handle)
+            return;
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        Allocation& allocation = state.allocations[handle - 1];
+        Remove(state, allocation.category, allocation.bytes);
+        allocation.category = category;
+        if(name)
+            allocation.name = name;
+        Add(state, category, allocation.bytes);
+    }
+
+    void GpuMemory::EndFrame()
+    {
+        ++_frame;
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        for(size_t i = 0; i < CATEGORY_COUNT; i++)
+        {
+            bool over = state.budget[i] && state.used[i] > state.budget[i];
+            if(over && !state.reported[i])
+                std::fprintf(stderr, "Error: GPU memory budget of %s exceeded, %.1f of %.1f MiB used!\n",
+                    GpuMemoryCategoryName((GpuMemoryCategory)i), state.used[i] / 1048576.0, state.budget[i] / 1048576.0);
+            state.reported[i] = over;
+        }
+    }
+    uint64_t GpuMemory::used(GpuMemoryCategory category)
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        return state.used[(size_t)category];
+    }
+    uint64_t GpuMemory::used()
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        uint64_t total = 0;
+        for(uint64_t bytes : state.used)
+            total += bytes;
+        return total;
+    }
+    uint64_t GpuMemory::peak(GpuMemoryCategory category)
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        return state.peak[(size_t)category];
+    }
+    void GpuMemory::SetBudget(GpuMemoryCategory category, uint64_t bytes)
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        state.budget[(size_t)category] = bytes;
+        state.reported[(size_t)category] = false;
+    }
+    uint64_t GpuMemory::budget(GpuMemoryCategory category)
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        return state.budget[(size_t)category];
+    }
+    uint64_t GpuMemory::overBudget(GpuMemoryCategory category)
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        size_t i = (size_t)category;
+        return state.budget[i] && state.used[i] > state.budget[i] ? state.used[i] - state.budget[i] : 0;
+    }
+
+    std::vector<GpuMemory::Allocation> GpuMemory::Allocations(GpuMemoryCategory category)
+    {
+        std::vector<Allocation> allocations;
+        {
+            State& state = GetState();
+            std::lock_guard lock(state.mutex);
+            for(const Allocation& allocation : state.allocations)
+                if(allocation.bytes && allocation.category == category)
+                    allocations.push_back(allocation);
+        }
+        std::sort(allocations.begin(), allocations.end(), [](const Allocation& a, const Allocation& b)
+        {
+            return a.bytes > b.bytes;
+        });
+        return allocations;
+    }
+    void GpuMemory::PrintReport(size_t largest)
+    {
+        std::printf("GPU memory: %.2f MiB\n", used() / 1048576.0);
+        for(size_t i = 0; i < CATEGORY_COUNT; i++)
+        {
+            GpuMemoryCategory category = (GpuMemoryCategory)i;
+            std::vector<Allocation> allocations = Allocations(category);
+            if(allocations.empty())
+                continue;
+            uint64_t limit = budget(category);
+            std::printf("    %-14s %9.2f MiB, peak %9.2f MiB", GpuMemoryCategoryName(category),
+                used(category) / 1048576.0, peak(category) / 1048576.0);
+            if(limit)
+                std::printf(", budget %9.2f MiB", limit / 1048576.0);
+            std::printf(", %zu allocations\n", allocations.size());
+            for(size_t j = 0; j < allocations.size() && j < largest; j++)
+                std::printf("        %-40s %9.2f MiB\n", allocations[j].name.empty() ? "(unnamed)" : allocations[j].name.c_str(),
+                    allocations[j].bytes / 1048576.0);
+        }
+    }
+}
\ No newline at end of file
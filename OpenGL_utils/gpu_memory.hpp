@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <GL/glew.h>
+
+namespace render
+{
+    enum class GpuMemoryCategory : uint32_t
+    {
+        BUFFER,         // buffers nobody labeled
+        MESH,           // vertex attributes and elements
+        INSTANCE,       // per instance data and indirect commands
+        UNIFORM,        // uniform and small storage blocks
+        STORAGE,        // large storage buffers, e.g. light clusters
+        TEXTURE,
+        RENDER_TARGET,  // attachments and depth pyramids
+        COUNT
+    };
+    const char* GpuMemoryCategoryName(GpuMemoryCategory category);
+    // bytes of one texel of a sized internal format, 3 component formats count as padded to 4
+    GLsizei InternalFormatSize(GLenum internalFormat);
+    // sum over levels, depth is layers or samples
+    uint64_t TextureStorageSize(GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei levels);
+
+    // Central accounting of the GPU memory of buffers and textures.
+    // Every buffer and texture is tracked on creation as BUFFER or TEXTURE,
+    // Label() on them moves the allocation to a category and names it for reports.
+    // Budgets are soft, EndFrame() prints an error when a category went over its budget,
+    // TEXTURE can be brought back under its budget by evicting mip levels, see TextureResidency.
+    // Sizes are estimates from formats and dimensions, drivers add alignment and padding.
+    class GpuMemory
+    {
+    public:
+        using Handle = uint32_t; // 0 is no allocation
+        struct Allocation
+        {
+            GpuMemoryCategory category = GpuMemoryCategory::BUFFER;
+            uint64_t bytes = 0;
+            std::string name;
+        };
+
+        static Handle Track(GpuMemoryCategory category, uint64_t bytes);
+        static void Untrack(Handle handle);
+        static void Resize(Handle handle, uint64_t bytes);
+        static void Label(Handle handle, GpuMemoryCategory category, const char* name);
+
+        static uint64_t used(GpuMemoryCategory category);
+        static uint64_t used(); // all categories
+        static uint64_t peak(GpuMemoryCategory category);
+        // 0 is no budget
+        static void SetBudget(GpuMemoryCategory category, uint64_t bytes);
+        static uint64_t budget(GpuMemoryCategory category);
+        // bytes above the budget, 0 when within or without budget
+        static uint64_t overBudget(GpuMemoryCategory category);
+
+        // frame counter used for last use stamps of textures
+        static inline uint64_t frame()
+        {
+            return _frame;
+        }
+        // call once per frame, advances frame() and reports categories that went over budget
+        static void EndFrame();
+
+        // live allocations of a category, largest first
+        static std::vector<Allocation> Allocations(GpuMemoryCategory category);
+        // per category totals and budgets, followed by the largest allocations of each
+        static void PrintReport(size_t largest = 5);
+    private:
+        static inline uint64_t _frame = 0;
+    };
+}
\ No newline at end of file
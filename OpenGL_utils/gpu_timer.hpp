@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+#include <GL/glew.h>
+
+namespace render
+{
+    // Measures GPU time between Begin() and End() with GL_TIME_ELAPSED queries.
+    // Results are read from a small ring a few frames later, so reading never stalls the pipeline,
+    // a Begin() while every query of the ring is still in flight skips that measurement.
+    // Only one timer can run at a time, GL_TIME_ELAPSED queries do not nest.
+    // Nestable timers measure with a pair of GL_TIMESTAMP queries instead, so they can enclose other timers.
+    class GpuTimer
+    {
+    public:
+        static constexpr GLuint RING_SIZE = 4;
+    private:
+        GLuint _queries[RING_SIZE * 2]; // begin and end timestamps of nestable timers
+        bool _nestable;
+        uint64_t _begun = 0, _ended = 0, _read = 0; // query counts, the ring index is count % RING_SIZE
+        bool _running = false;
+        double _lastMs = 0.0, _totalMs = 0.0;
+        uint64_t _samples = 0;
+    public:
+        GpuTimer(bool nestable = false) :
+            _nestable(nestable)
+        {
+            if(_nestable)
+                glCreateQueries(GL_TIMESTAMP, RING_SIZE * 2, _queries);
+            else
+                glCreateQueries(GL_TIME_ELAPSED, RING_SIZE, _queries);
+        }
+        ~GpuTimer()
+        {
+            glDeleteQueries(_nestable ? RING_SIZE * 2 : RING_SIZE, _queries);
+        }
+        GpuTimer(const GpuTimer&) = delete;
+        GpuTimer& operator=(const GpuTimer&) = delete;
+
+        void Begin()
+        {
+            Poll();
+            if(_begun - _read == RING_SIZE)
+                return;
+            if(_nestable)
+                glQueryCounter(_queries[_begun++ % RING_SIZE * 2], GL_TIMESTAMP);
+            else
+                glBeginQuery(GL_TIME_ELAPSED, _queries[_begun++ % RING_SIZE]);
+            _running = true;
+        }
+        void End()
+        {
+            if(!_running)
+                return;
+            if(_nestable)
+                glQueryCounter(_queries[(_begun - 1) % RING_SIZE * 2 + 1], GL_TIMESTAMP);
+            else
+                glEndQuery(GL_TIME_ELAPSED);
+            _running = false;
+            _ended++;
+        }
+        // reads every finished measurement, called by Begin()
+        void Poll()
+        {
+            while(_read < _ended)
+            {
+                GLuint query = _nestable ? _queries[_read % RING_SIZE * 2 + 1] : _queries[_read % RING_SIZE];
+                GLint available = GL_FALSE;
+                glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+                if(!available)
+                    return;
+                GLuint64 nanoseconds = 0;
+                glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+                if(_nestable) // the end timestamp is available, so the earlier begin is too
+                {
+                    GLuint64 begin = 0;
+                    glGetQueryObjectui64v(_queries[_read % RING_SIZE * 2], GL_QUERY_RESULT, &begin);
+                    nanoseconds -= begin;
+                }
+                _lastMs = nanoseconds * 1e-6;
+                _totalMs += _lastMs;
+                _samples++;
+                _read++;
+            }
+        }
+        // latest finished measurement
+        inline double milliseconds() const
+        {
+            return _lastMs;
+        }
+        // mean of the measurements since construction or Reset()
+        inline double averageMilliseconds() const
+        {
+            return _samples ? _totalMs / _samples : 0.0;
+        }
+        inline uint64_t samples() const
+        {
+            return _samples;
+        }
+        void Reset()
+        {
+            _totalMs = 0.0;
+            _samples = 0;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,187 @@
+#include "headless_context.hpp"
+#include <cstdio>
+#include <cstring>
+#include <GL/glew.h>
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#if defined(RENDER_HEADLESS_OSMESA)
+#include <GL/osmesa.h>
+#endif
+
+namespace render
+{
+    namespace
+    {
+        bool HasExtension(const char* extensions, const char* name)
+        {
+            if(!extensions)
+                return false;
+            size_t length = std::strlen(name);
+            for(const char* p = extensions; (p = std::strstr(p, name)); p += length)
+                if((p == extensions || p[-1] == ' ') && (p[length] == ' ' || p[length] == '\0'))
+                    return true;
+            return false;
+        }
+        EGLDisplay PlatformDisplay(const char** backend)
+        {
+            const char* clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+            auto getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+            if(getPlatformDisplay && HasExtension(clientExtensions, "EGL_MESA_platform_surfaceless"))
+            {
+                EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+                if(display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr))
+                {
+                    *backend = "EGL surfaceless";
+                    return display;
+                }
+            }
+            auto queryDevices = (PFNEGLQUERYDEVICESEXTPROC)eglGetProcAddress("eglQueryDevicesEXT");
+            if(getPlatformDisplay && queryDevices && HasExtension(clientExtensions, "EGL_EXT_platform_device"))
+            {
+                EGLDeviceEXT device;
+                EGLint deviceCount = 0;
+                if(queryDevices(1, &device, &deviceCount) && deviceCount > 0)
+                {
+                    EGLDisplay display = getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, device, nullptr);
+                    if(display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr))
+                    {
+                        *backend = "EGL device";
+                        return display;
+                    }
+                }
+            }
+            EGLDisplay display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+            if(display != EGL_NO_DISPLAY && eglInitialize(display, nullptr, nullptr))
+            {
+                *backend = "EGL default display";
+                return display;
+            }
+            return EGL_NO_DISPLAY;
+        }
+    }
+
+    bool HeadlessContext::CreateEGL(int major, int minor, bool debug)
+    {
+        EGLDisplay display = PlatformDisplay(&_backend);
+        if(display == EGL_NO_DISPLAY)
+            return false;
+        const char* extensions = eglQueryString(display, EGL_EXTENSIONS);
+        if(!HasExtension(extensions, "EGL_KHR_surfaceless_context") || !eglBindAPI(EGL_OPENGL_API))
+        {
+            eglTerminate(display);
+            return false;
+        }
+        EGLConfig config = EGL_NO_CONFIG_KHR;
+        if(!HasExtension(extensions, "EGL_KHR_no_config_context"))
+        {
+            const EGLint configAttribs[] = {EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_SURFACE_TYPE, 0, EGL_NONE};
+            EGLint configCount = 0;
+            if(!eglChooseConfig(display, configAttribs, &config, 1, &configCount) || configCount == 0)
+            {
+                eglTerminate(display);
+                return false;
+            }
+        }
+        const EGLint contextAttribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, major,
+            EGL_CONTEXT_MINOR_VERSION, minor,
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+            EGL_CONTEXT_OPENGL_DEBUG, debug ? EGL_TRUE : EGL_FALSE,
+            EGL_NONE
+        };
+        EGLContext context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttribs);
+        if(context == EGL_NO_CONTEXT)
+        {
+            eglTerminate(display);
+            return false;
+        }
+        _display = display;
+        _context = context;
+        return true;
+    }
+    bool HeadlessContext::CreateOSMesa(int major, int minor)
+    {
+#if defined(RENDER_HEADLESS_OSMESA)
+        const int attribs[] = {
+            OSMESA_FORMAT, OSMESA_RGBA,
+            OSMESA_DEPTH_BITS, 24,
+            OSMESA_PROFILE, OSMESA_CORE_PROFILE,
+            OSMESA_CONTEXT_MAJOR_VERSION, major,
+            OSMESA_CONTEXT_MINOR_VERSION, minor,
+            0
+        };
+        OSMesaContext context = OSMesaCreateContextAttribs(attribs, nullptr);
+        if(!context)
+            return false;
+        _context = context;
+        _osmesaBuffer.resize(4); // OSMesa needs a color buffer to make current, rendering goes to framebuffer objects
+        _backend = "OSMesa";
+        return true;
+#else
+        (void)major;
+        (void)minor;
+        return false;
+#endif
+    }
+
+    bool HeadlessContext::Create(int major, int minor, bool debug)
+    {
+        return CreateEGL(major, minor, debug) || CreateOSMesa(major, minor);
+    }
+
+    HeadlessContext::HeadlessContext(int major, int minor, bool debug)
+    {
+        if(!Create(major, minor, debug))
+        {
+            // Mesa llvmpipe only offers 4.6 with the version overrides, a 4.5 context at least runs the GL side
+            if(major == 4 && minor == 6 && Create(4, 5, debug))
+                std::fprintf(stderr, "Error: OpenGL 4.6 is not available, fell back to a 4.5 context where #version 460 shaders fail to compile! "
+                                     "On Mesa llvmpipe set MESA_GL_VERSION_OVERRIDE=4.6 MESA_GLSL_VERSION_OVERRIDE=460.\n");
+            else
+            {
+                std::fprintf(stderr, "Error: Failed to create a headless OpenGL %d.%d context!\n", major, minor);
+                _backend = "none";
+                return;
+            }
+        }
+        if(!MakeCurrent())
+        {
+            std::fprintf(stderr, "Error: Failed to make the %s context current!\n", _backend);
+            return;
+        }
+        glewExperimental = GL_TRUE;
+        GLenum glewInitCode = glewInit();
+#if defined(GLEW_ERROR_NO_GLX_DISPLAY)
+        // GLX builds of GLEW load the core functions, then fail on the missing X display
+        if(glewInitCode == GLEW_ERROR_NO_GLX_DISPLAY)
+            glewInitCode = GLEW_OK;
+#endif
+        if(glewInitCode != GLEW_OK)
+            std::fprintf(stderr, "Error: GLEW initialization failed: %s!\n", glewGetErrorString(glewInitCode));
+    }
+    HeadlessContext::~HeadlessContext()
+    {
+        if(!_context)
+            return;
+        if(_display)
+        {
+            eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+            eglDestroyContext(_display, _context);
+            eglTerminate(_display);
+        }
+#if defined(RENDER_HEADLESS_OSMESA)
+        else
+            OSMesaDestroyContext((OSMesaContext)_context);
+#endif
+    }
+    bool HeadlessContext::MakeCurrent() const
+    {
+        if(_display)
+            return eglMakeCurrent(_display, EGL_NO_SURFACE, EGL_NO_SURFACE, _context);
+#if defined(RENDER_HEADLESS_OSMESA)
+        if(_context)
+            return OSMesaMakeCurrent((OSMesaContext)_context, (void*)_osmesaBuffer.data(), GL_UNSIGNED_BYTE, 1, 1);
+#endif
+        return false;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+#include <vector>
+
+namespace render
+{
+    // Creates and makes current an OpenGL core context without a window or display server,
+    // for offscreen rendering on machines without a GPU (e.g. Mesa llvmpipe) and automated runs.
+    // Tries EGL surfaceless, then the first EGL device, then the default EGL display.
+    // Built with RENDER_HEADLESS_OSMESA, OSMesa is tried last (link -lOSMesa).
+    // There is no default framebuffer, render into a Framebuffer or RenderTarget.
+    // GLEW is initialized too, link -lEGL.
+    // The renderer's shaders need 4.6, which Mesa llvmpipe (22 and older) only offers with
+    // MESA_GL_VERSION_OVERRIDE=4.6 MESA_GLSL_VERSION_OVERRIDE=460 in the environment.
+    // Without them a 4.6 request falls back to a 4.5 context and reports an error.
+    // Not part of libOpenGL_utils, so window builds need no EGL, compile headless_context.cpp into the executable.
+    class HeadlessContext
+    {
+    private:
+        void* _display = nullptr;
+        void* _context = nullptr;
+        const char* _backend = "none";
+        std::vector<unsigned char> _osmesaBuffer;
+
+        bool CreateEGL(int major, int minor, bool debug);
+        bool CreateOSMesa(int major, int minor);
+        bool Create(int major, int minor, bool debug);
+    public:
+        HeadlessContext(int major = 4, int minor = 6, bool debug = false);
+        ~HeadlessContext();
+        HeadlessContext(const HeadlessContext&) = delete;
+        HeadlessContext& operator=(const HeadlessContext&) = delete;
+
+        bool MakeCurrent() const;
+        inline operator bool() const
+        {
+            return _context;
+        }
+        // e.g. "EGL surfaceless", for logs
+        inline const char* backend() const
+        {
+            return _backend;
+        }
+    };
+}
\ No newline at end of file
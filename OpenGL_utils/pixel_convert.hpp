@@ -0,0 +1,166 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#if defined(__x86_64__) || defined(__i386__)
+#define RENDER_PIXEL_CONVERT_X86
+#include <immintrin.h>
+#endif
+
+// CPU side pixel kernels shared by Image and offline tools, must not depend on GL
+namespace render
+{
+    template<typename T>
+    struct ChannelSource
+    {
+        const T* data = nullptr; // first component to read, nullptr = use fallback value
+        uint32_t stride = 1;     // distance between pixels in components
+    };
+
+    // Interleaves channel sources into dst, which has sourceCount components per pixel.
+    // Typical use is packing separate single channel maps into one texture,
+    // e.g. occlusion, roughness and metallic into an RGB ORM map.
+    template<typename T>
+    void InterleaveChannels(T* dst, const ChannelSource<T>* sources, uint32_t sourceCount, size_t pixelCount, T fallback)
+    {
+        for(uint32_t c = 0; c < sourceCount; c++)
+        {
+            const ChannelSource<T> src = sources[c];
+            T* out = dst + c;
+            if(!src.data)
+                for(size_t p = 0; p < pixelCount; p++, out += sourceCount)
+                    *out = fallback;
+            else
+                for(size_t p = 0; p < pixelCount; p++, out += sourceCount)
+                    *out = src.data[p * src.stride];
+        }
+    }
+
+    // IEEE 754 binary16 with round to nearest even, overflow gives infinity, NaN stays NaN
+    inline uint16_t FloatToHalf(float value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        uint16_t sign = (bits >> 16) & 0x8000;
+        bits &= 0x7FFFFFFF;
+        if(bits >= 0x47800000) // 65536 or more, infinity or NaN
+            return sign | (bits > 0x7F800000 ? 0x7E00 : 0x7C00);
+        if(bits < 0x38800000) // below the smallest normal half, adding 0.5 lets the FPU round the subnormal mantissa
+        {
+            float shifted;
+            std::memcpy(&shifted, &bits, sizeof(shifted));
+            shifted += 0.5f;
+            std::memcpy(&bits, &shifted, sizeof(bits));
+            return sign | (uint16_t)(bits - 0x3F000000);
+        }
+        uint32_t odd = (bits >> 13) & 1;
+        bits += 0xC8000FFF + odd; // exponent rebias from 127 to 15 and rounding, a carry correctly bumps the exponent
+        return sign | (uint16_t)(bits >> 13);
+    }
+    inline float HalfToFloat(uint16_t half)
+    {
+        uint32_t bits = (uint32_t)(half & 0x7FFF) << 13;
+        uint32_t exponent = bits & 0x0F800000;
+        bits += 0x38000000; // exponent rebias from 15 to 127
+        if(exponent == 0x0F800000) // infinity or NaN
+            bits += 0x38000000;
+        else if(!exponent) // subnormal, renormalized by subtracting 2^-14
+        {
+            bits += 0x00800000;
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            value -= 6.103515625e-05f;
+            std::memcpy(&bits, &value, sizeof(bits));
+        }
+        bits |= (uint32_t)(half & 0x8000) << 16;
+        float value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+#if defined(RENDER_PIXEL_CONVERT_X86)
+    // The vector kernels are compiled for their instruction set only and picked at runtime,
+    // so the default build runs on any x86 CPU. They handle whole vectors, the scalar loops the rest.
+    inline bool CpuHasF16C()
+    {
+        static const bool supported = __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+        return supported;
+    }
+    inline bool CpuHasSSSE3()
+    {
+        static const bool supported = __builtin_cpu_supports("ssse3");
+        return supported;
+    }
+    __attribute__((target("avx,f16c"))) inline size_t FloatToHalfF16C(uint16_t* dst, const float* src, size_t count)
+    {
+        size_t i = 0;
+        for(; i + 8 <= count; i += 8)
+            _mm_storeu_si128((__m128i*)(dst + i), _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+        return i;
+    }
+    __attribute__((target("avx,f16c"))) inline size_t HalfToFloatF16C(float* dst, const uint16_t* src, size_t count)
+    {
+        size_t i = 0;
+        for(; i + 8 <= count; i += 8)
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+        return i;
+    }
+    __attribute__((target("ssse3"))) inline size_t PadRGBToRGBASSSE3(uint8_t* dst, const uint8_t* src, size_t pixelCount, uint8_t alpha)
+    {
+        const __m128i shuffle = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+        const __m128i alphaMask = _mm_set1_epi32((int32_t)((uint32_t)alpha << 24));
+        // a load reads 16 bytes for 12 used ones, the last pixels are left to the scalar loop
+        size_t p = 0;
+        for(; p + 6 <= pixelCount; p += 4)
+        {
+            __m128i rgb = _mm_loadu_si128((const __m128i*)(src + p * 3));
+            _mm_storeu_si128((__m128i*)(dst + p * 4), _mm_or_si128(_mm_shuffle_epi8(rgb, shuffle), alphaMask));
+        }
+        return p;
+    }
+#endif
+    // 8 values per F16C instruction where the CPU has it, the scalar loop matches it bit for bit
+    inline void FloatToHalf(uint16_t* dst, const float* src, size_t count)
+    {
+        size_t i = 0;
+#if defined(RENDER_PIXEL_CONVERT_X86)
+        if(CpuHasF16C())
+            i = FloatToHalfF16C(dst, src, count);
+#endif
+        for(; i < count; i++)
+            dst[i] = FloatToHalf(src[i]);
+    }
+    inline void HalfToFloat(float* dst, const uint16_t* src, size_t count)
+    {
+        size_t i = 0;
+#if defined(RENDER_PIXEL_CONVERT_X86)
+        if(CpuHasF16C())
+            i = HalfToFloatF16C(dst, src, count);
+#endif
+        for(; i < count; i++)
+            dst[i] = HalfToFloat(src[i]);
+    }
+
+    // Expands RGB pixels to RGBA with constant alpha. Drivers convert 3 component uploads on the CPU,
+    // often one pixel at a time, and most GPUs store RGB formats padded to 4 components anyway.
+    template<typename T>
+    void PadRGBToRGBA(T* dst, const T* src, size_t pixelCount, T alpha)
+    {
+        for(size_t p = 0; p < pixelCount; p++, dst += 4, src += 3)
+        {
+            dst[0] = src[0];
+            dst[1] = src[1];
+            dst[2] = src[2];
+            dst[3] = alpha;
+        }
+    }
+    // 4 pixels per byte shuffle where the CPU has SSSE3
+    inline void PadRGBToRGBA(uint8_t* dst, const uint8_t* src, size_t pixelCount, uint8_t alpha)
+    {
+        size_t p = 0;
+#if defined(RENDER_PIXEL_CONVERT_X86)
+        if(CpuHasSSSE3())
+            p = PadRGBToRGBASSSE3(dst, src, pixelCount, alpha);
+#endif
+        PadRGBToRGBA<uint8_t>(dst + p * 4, src + p * 3, pixelCount - p, alpha);
+    }
+}
\ No newline at end of file
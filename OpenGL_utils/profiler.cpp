@@ -0,0 +1,340 @@
+#include "profiler.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <GL/glew.h>
+
+namespace render
+{
+    namespace
+    {
+        // Zone ring of one thread, holding its latest MAX_RETAINED_CPU_ZONES. Only the owning thread writes,
+        // chunks are allocated on demand during the first lap and kept until exit.
+        // Readers copy a zone and then check writing, like a seqlock, to drop copies the writer lapped meanwhile.
+        struct ThreadBuffer
+        {
+            static constexpr size_t CHUNK_SIZE = 4096, CAPACITY = Profiler::MAX_RETAINED_CPU_ZONES,
+                                    MAX_CHUNKS = CAPACITY / CHUNK_SIZE;
+            static_assert(CAPACITY % CHUNK_SIZE == 0);
+            uint32_t thread;
+            std::atomic<Profiler::Zone*> chunks[MAX_CHUNKS] = {};
+            std::atomic<size_t> count{0};   // zones ever written, zone i lives in slot i % CAPACITY
+            std::atomic<size_t> writing{0}; // one past the zone being written
+            size_t summaryCursor = 0; // first zone not yet in a frame summary, guarded by the state mutex
+
+            ThreadBuffer(uint32_t thread_) : thread(thread_) {}
+            ~ThreadBuffer()
+            {
+                for(std::atomic<Profiler::Zone*>& chunk : chunks)
+                    delete[] chunk.load(std::memory_order_relaxed);
+            }
+            // oldest zone still in the ring
+            static inline size_t First(size_t count)
+            {
+                return count > CAPACITY ? count - CAPACITY : 0;
+            }
+            // copies zone i below count, false if the writer may have overwritten it meanwhile
+            inline bool Read(size_t i, Profiler::Zone& zone) const
+            {
+                size_t slot = i % CAPACITY;
+                zone = chunks[slot / CHUNK_SIZE].load(std::memory_order_acquire)[slot % CHUNK_SIZE];
+                std::atomic_thread_fence(std::memory_order_acquire);
+                return writing.load(std::memory_order_relaxed) <= i + CAPACITY;
+            }
+        };
+        struct GpuFrame
+        {
+            struct Pending
+            {
+                const char* name;
+                uint32_t depth;
+            };
+            uint64_t frame = 0;
+            uint32_t count = 0;
+            Pending zones[Profiler::MAX_GPU_ZONES_PER_FRAME];
+            GLuint queries[Profiler::MAX_GPU_ZONES_PER_FRAME * 2]; // begin and end timestamp per zone
+        };
+        struct State
+        {
+            std::mutex mutex;
+            std::vector<std::unique_ptr<ThreadBuffer>> threads;
+            std::atomic<uint64_t> frame{0};
+            std::atomic<uint64_t> dropped{0};
+            uint64_t lastFrameEnd = Profiler::NowNanoseconds();
+            Profiler::FrameSummary cpuSummary, gpuSummary;
+
+            // GL thread only
+            bool queriesCreated = false;
+            GpuFrame gpuFrames[Profiler::FRAME_LATENCY];
+            uint32_t gpuDepth = 0;
+            // resolved, guarded by mutex, a ring of the latest MAX_RETAINED_GPU_ZONES once full
+            std::vector<Profiler::Zone> gpuZones;
+            size_t gpuZoneNext = 0; // oldest zone, overwritten next
+        };
+        State& GetState()
+        {
+            static State state;
+            return state;
+        }
+        thread_local ThreadBuffer* threadBuffer = nullptr;
+        thread_local uint32_t threadDepth = 0;
+
+        ThreadBuffer& GetThreadBuffer()
+        {
+            if(!threadBuffer)
+            {
+                State& state = GetState();
+                std::lock_guard lock(state.mutex);
+                state.threads.push_back(std::make_unique<ThreadBuffer>(state.threads.size()));
+                threadBuffer = state.threads.back().get();
+            }
+            return *threadBuffer;
+        }
+
+        // sums zones by name, sorted by descending time
+        struct Aggregator
+        {
+            std::unordered_map<std::string_view, size_t> index;
+            std::vector<Profiler::ZoneStats> zones;
+
+            void Add(const Profiler::Zone& zone)
+            {
+                auto [it, inserted] = index.try_emplace(zone.name, zones.size());
+                if(inserted)
+                    zones.push_back(Profiler::ZoneStats{zone.name});
+                Profiler::ZoneStats& stats = zones[it->second];
+                stats.calls++;
+                stats.milliseconds += (zone.endNs - zone.beginNs) * 1e-6;
+            }
+            std::vector<Profiler::ZoneStats> Sorted()
+            {
+                std::sort(zones.begin(), zones.end(), [](const Profiler::ZoneStats& a, const Profiler::ZoneStats& b)
+                {
+                    return a.milliseconds > b.milliseconds;
+                });
+                return std::move(zones);
+            }
+        };
+
+        // reads back a GPU frame if all its queries are done, false if it is still in flight
+        bool ResolveGpuFrame(State& state, GpuFrame& gpuFrame, int64_t gpuToCpu)
+        {
+            if(!gpuFrame.count)
+                return true;
+            GLint available = 0;
+            glGetQueryObjectiv(gpuFrame.queries[gpuFrame.count * 2 - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+            if(!available)
+                return false;
+            Aggregator aggregator;
+            std::lock_guard lock(state.mutex);
+            for(uint32_t i = 0; i < gpuFrame.count; i++)
+            {
+                GLuint64 begin = 0, end = 0;
+                glGetQueryObjectui64v(gpuFrame.queries[i * 2], GL_QUERY_RESULT, &begin);
+                glGetQueryObjectui64v(gpuFrame.queries[i * 2 + 1], GL_QUERY_RESULT, &end);
+                Profiler::Zone zone{gpuFrame.zones[i].name, begin + gpuToCpu, end + gpuToCpu, gpuFrame.frame,
+                                    Profiler::GPU_THREAD, gpuFrame.zones[i].depth};
+                if(state.gpuZones.size() < Profiler::MAX_RETAINED_GPU_ZONES)
+                    state.gpuZones.push_back(zone);
+                else
+                {
+                    state.gpuZones[state.gpuZoneNext] = zone;
+                    state.gpuZoneNext = (state.gpuZoneNext + 1) % Profiler::MAX_RETAINED_GPU_ZONES;
+                }
+                aggregator.Add(zone);
+            }
+            state.gpuSummary = Profiler::FrameSummary{gpuFrame.frame, 0.0, aggregator.Sorted()};
+            gpuFrame.count = 0;
+            return true;
+        }
+    }
+
+    uint64_t Profiler::BeginCpuZone()
+    {
+        ++threadDepth;
+        return NowNanoseconds();
+    }
+    void Profiler::EndCpuZone(const char* name, uint64_t begin)
+    {
+        uint64_t end = NowNanoseconds();
+        ThreadBuffer& buffer = GetThreadBuffer();
+        --threadDepth;
+        size_t i = buffer.count.load(std::memory_order_relaxed);
+        size_t slot = i % ThreadBuffer::CAPACITY;
+        Zone* zones = buffer.chunks[slot / ThreadBuffer::CHUNK_SIZE].load(std::memory_order_relaxed);
+        if(!zones)
+        {
+            zones = new Zone[ThreadBuffer::CHUNK_SIZE];
+            buffer.chunks[slot / ThreadBuffer::CHUNK_SIZE].store(zones, std::memory_order_release);
+        }
+        // published before the slot is touched, so readers notice a lapped zone
+        buffer.writing.store(i + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        zones[slot % ThreadBuffer::CHUNK_SIZE] = Zone{name, begin, end, GetState().frame.load(std::memory_order_relaxed), buffer.thread, threadDepth};
+        buffer.count.store(i + 1, std::memory_order_release);
+    }
+    int32_t Profiler::BeginGpuZone(const char* name)
+    {
+        State& state = GetState();
+        if(!state.queriesCreated)
+            return -1;
+        uint32_t slot = state.frame.load(std::memory_order_relaxed) % FRAME_LATENCY;
+        GpuFrame& gpuFrame = state.gpuFrames[slot];
+        if(gpuFrame.count >= MAX_GPU_ZONES_PER_FRAME)
+        {
+            state.dropped.fetch_add(1, std::memory_order_relaxed);
+            return -1;
+        }
+        uint32_t i = gpuFrame.count++;
+        gpuFrame.zones[i] = GpuFrame::Pending{name, state.gpuDepth++};
+        glQueryCounter(gpuFrame.queries[i * 2], GL_TIMESTAMP);
+        return slot * MAX_GPU_ZONES_PER_FRAME + i;
+    }
+    void Profiler::EndGpuZone(int32_t zone)
+    {
+        State& state = GetState();
+        GpuFrame& gpuFrame = state.gpuFrames[zone / MAX_GPU_ZONES_PER_FRAME];
+        glQueryCounter(gpuFrame.queries[(zone % MAX_GPU_ZONES_PER_FRAME) * 2 + 1], GL_TIMESTAMP);
+        state.gpuDepth--;
+    }
+
+    void Profiler::Enable(bool enable)
+    {
+        State& state = GetState();
+        if(enable && !state.queriesCreated)
+        {
+            for(GpuFrame& gpuFrame : state.gpuFrames)
+                glCreateQueries(GL_TIMESTAMP, MAX_GPU_ZONES_PER_FRAME * 2, gpuFrame.queries);
+            state.queriesCreated = true;
+        }
+        _enabled.store(enable, std::memory_order_relaxed);
+    }
+    void Profiler::EndFrame()
+    {
+        State& state = GetState();
+        uint64_t now = NowNanoseconds();
+        uint64_t frame = state.frame.load(std::memory_order_relaxed);
+        {
+            Aggregator aggregator;
+            std::lock_guard lock(state.mutex);
+            for(std::unique_ptr<ThreadBuffer>& buffer : state.threads)
+            {
+                size_t count = buffer->count.load(std::memory_order_acquire);
+                // zones the ring overwrote before any summary saw them are lost
+                size_t first = std::max(buffer->summaryCursor, ThreadBuffer::First(count));
+                uint64_t lost = first - buffer->summaryCursor;
+                Zone zone;
+                for(size_t i = first; i < count; i++)
+                {
+                    if(buffer->Read(i, zone))
+                        aggregator.Add(zone);
+                    else
+                        lost++;
+                }
+                if(lost)
+                    state.dropped.fetch_add(lost, std::memory_order_relaxed);
+                buffer->summaryCursor = count;
+            }
+            state.cpuSummary = FrameSummary{frame, (now - state.lastFrameEnd) * 1e-6, aggregator.Sorted()};
+            state.lastFrameEnd = now;
+        }
+        state.frame.store(++frame, std::memory_order_relaxed);
+        if(!state.queriesCreated)
+            return;
+
+        // timestamps are moved onto the CPU clock with an offset measured now
+        GLint64 gpuNow = 0;
+        glGetInteger64v(GL_TIMESTAMP, &gpuNow);
+        int64_t gpuToCpu = (int64_t)NowNanoseconds() - gpuNow;
+        // oldest frame first, the slot of the new frame is the oldest and has to be free now
+        for(uint32_t age = FRAME_LATENCY - 1; age > 0; age--)
+            if(!ResolveGpuFrame(state, state.gpuFrames[(frame + FRAME_LATENCY - age) % FRAME_LATENCY], gpuToCpu))
+                break;
+        // relabelled only after its previous frame was resolved
+        GpuFrame& current = state.gpuFrames[frame % FRAME_LATENCY];
+        if(current.count && !ResolveGpuFrame(state, current, gpuToCpu))
+        {
+            state.dropped.fetch_add(current.count, std::memory_order_relaxed);
+            current.count = 0;
+        }
+        current.frame = frame;
+        state.gpuDepth = 0;
+    }
+    const Profiler::FrameSummary& Profiler::cpuSummary()
+    {
+        return GetState().cpuSummary;
+    }
+    const Profiler::FrameSummary& Profiler::gpuSummary()
+    {
+        return GetState().gpuSummary;
+    }
+    void Profiler::PrintSummary()
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        std::printf("frame %llu: %.3f ms CPU\n", (unsigned long long)state.cpuSummary.frame, state.cpuSummary.milliseconds);
+        for(const ZoneStats& zone : state.cpuSummary.zones)
+            std::printf("    CPU %-40s %8.3f ms %6u calls\n", zone.name.c_str(), zone.milliseconds, zone.calls);
+        for(const ZoneStats& zone : state.gpuSummary.zones)
+            std::printf("    GPU %-40s %8.3f ms %6u calls (frame %llu)\n", zone.name.c_str(), zone.milliseconds, zone.calls,
+                (unsigned long long)state.gpuSummary.frame);
+    }
+    bool Profiler::ExportChromeTrace(const char* path)
+    {
+        FILE* file = std::fopen(path, "w");
+        if(!file)
+        {
+            std::fprintf(stderr, "Error: Failed to open %s for writing!\n", path);
+            return false;
+        }
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        std::fputs("{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n", file);
+        // names are string literals of the source, so they need no escaping
+        auto write = [&](const Zone& zone)
+        {
+            uint32_t tid = zone.thread == GPU_THREAD ? 0 : zone.thread + 1;
+            std::fprintf(file, "{\"name\": \"%s\", \"cat\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %u, "
+                               "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"frame\": %llu}},\n",
+                zone.name, zone.thread == GPU_THREAD ? "gpu" : "cpu", tid, zone.beginNs * 1e-3,
+                (zone.endNs - zone.beginNs) * 1e-3, (unsigned long long)zone.frame);
+        };
+        for(std::unique_ptr<ThreadBuffer>& buffer : state.threads)
+        {
+            size_t count = buffer->count.load(std::memory_order_acquire);
+            Zone zone;
+            for(size_t i = ThreadBuffer::First(count); i < count; i++)
+                if(buffer->Read(i, zone))
+                    write(zone);
+        }
+        for(size_t i = 0; i < state.gpuZones.size(); i++)
+            write(state.gpuZones[(state.gpuZoneNext + i) % state.gpuZones.size()]);
+        std::fputs("{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, \"args\": {\"name\": \"GPU\"}}", file);
+        for(std::unique_ptr<ThreadBuffer>& buffer : state.threads)
+            std::fprintf(file, ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": %u, \"args\": {\"name\": \"CPU thread %u\"}}",
+                buffer->thread + 1, buffer->thread);
+        std::fputs("\n]}\n", file);
+        return std::fclose(file) == 0;
+    }
+    void Profiler::Clear()
+    {
+        State& state = GetState();
+        std::lock_guard lock(state.mutex);
+        for(std::unique_ptr<ThreadBuffer>& buffer : state.threads)
+        {
+            buffer->count.store(0, std::memory_order_release);
+            buffer->writing.store(0, std::memory_order_relaxed);
+            buffer->summaryCursor = 0;
+        }
+        state.gpuZones.clear();
+        state.gpuZoneNext = 0;
+        state.dropped.store(0, std::memory_order_relaxed);
+    }
+    uint64_t Profiler::droppedZones()
+    {
+        return GetState().dropped.load(std::memory_order_relaxed);
+    }
+}
\ No newline at end of file
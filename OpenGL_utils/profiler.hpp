@@ -0,0 +1,133 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace render
+{
+    // Scoped CPU and GPU zone profiler, zones are recorded through the PROFILE_* macros below.
+    // CPU zones go into per thread rings, written without locks by their thread only.
+    // GPU zones are pairs of GL_TIMESTAMP queries taken from a ring FRAME_LATENCY frames deep,
+    // EndFrame() reads back the oldest frame only once all its queries are available,
+    // so reading never stalls, a frame whose queries are still pending when its slot is needed is dropped.
+    // Recording is off until Enable(true), then every zone costs two clock reads and a buffer append.
+    // Without RENDER_PROFILE the macros compile to nothing.
+    class Profiler
+    {
+    public:
+        static constexpr uint32_t FRAME_LATENCY = 4;
+        static constexpr uint32_t MAX_GPU_ZONES_PER_FRAME = 256;
+        static constexpr size_t MAX_RETAINED_CPU_ZONES = 1 << 20; // per thread, older CPU zones are overwritten
+        static constexpr size_t MAX_RETAINED_GPU_ZONES = 1 << 16; // older resolved GPU zones are overwritten
+        static constexpr uint32_t GPU_THREAD = ~0u; // Zone::thread of GPU zones
+
+        struct Zone
+        {
+            const char* name;   // string literal, never copied
+            uint64_t beginNs, endNs; // steady clock, GPU zones are shifted onto it
+            uint64_t frame;
+            uint32_t thread;    // registration order of the recording thread
+            uint32_t depth;     // nesting level within the thread or the GPU
+        };
+        struct ZoneStats
+        {
+            std::string name;
+            uint32_t calls = 0;
+            double milliseconds = 0.0; // inclusive, summed over calls
+        };
+        struct FrameSummary
+        {
+            uint64_t frame = 0;
+            double milliseconds = 0.0; // CPU time between EndFrame calls, zero for GPU summaries
+            std::vector<ZoneStats> zones; // sorted by descending time
+        };
+
+        class CpuScope
+        {
+        private:
+            const char* _name;
+            uint64_t _begin;
+        public:
+            inline CpuScope(const char* name) :
+                _name(enabled() ? name : nullptr),
+                _begin(_name ? BeginCpuZone() : 0)
+            {}
+            inline ~CpuScope()
+            {
+                if(_name)
+                    EndCpuZone(_name, _begin);
+            }
+            CpuScope(const CpuScope&) = delete;
+            CpuScope& operator=(const CpuScope&) = delete;
+        };
+        // GPU zones have to be recorded on the thread owning the GL context
+        class GpuScope
+        {
+        private:
+            int32_t _zone;
+        public:
+            inline GpuScope(const char* name) :
+                _zone(enabled() ? BeginGpuZone(name) : -1)
+            {}
+            inline ~GpuScope()
+            {
+                if(_zone >= 0)
+                    EndGpuZone(_zone);
+            }
+            GpuScope(const GpuScope&) = delete;
+            GpuScope& operator=(const GpuScope&) = delete;
+        };
+
+        static inline bool enabled()
+        {
+            return _enabled.load(std::memory_order_relaxed);
+        }
+        // needs a current GL context when GPU zones are recorded
+        static void Enable(bool enable);
+        // call once per frame on the GL thread, after the frame's last GPU zone
+        static void EndFrame();
+        // zones of the last ended frame
+        static const FrameSummary& cpuSummary();
+        // zones of the latest frame whose GPU queries were read back, FRAME_LATENCY - 1 frames behind or more
+        static const FrameSummary& gpuSummary();
+        static void PrintSummary();
+        // Writes every recorded zone as Chrome trace event JSON, which chrome://tracing and ui.perfetto.dev open.
+        // Only the latest MAX_RETAINED_CPU_ZONES of every thread and MAX_RETAINED_GPU_ZONES are kept.
+        static bool ExportChromeTrace(const char* path);
+        // forgets recorded zones, only call while no other thread records
+        static void Clear();
+        // zones overwritten before a frame summary saw them, or lost to full or late GPU frames
+        static uint64_t droppedZones();
+
+        static inline uint64_t NowNanoseconds()
+        {
+            using namespace std::chrono;
+            return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+        }
+    private:
+        static inline std::atomic<bool> _enabled{false};
+
+        static uint64_t BeginCpuZone();
+        static void EndCpuZone(const char* name, uint64_t begin);
+        static int32_t BeginGpuZone(const char* name);
+        static void EndGpuZone(int32_t zone);
+    };
+}
+
+#define PROFILE_CONCAT_INNER(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_INNER(a, b)
+#if defined(RENDER_PROFILE)
+// name has to be a string literal
+#define PROFILE_SCOPE(name) render::Profiler::CpuScope PROFILE_CONCAT(_profileScope, __LINE__)(name)
+#define PROFILE_GPU_SCOPE(name) render::Profiler::GpuScope PROFILE_CONCAT(_profileGpuScope, __LINE__)(name)
+// CPU and GPU zone of the same name
+#define PROFILE_SCOPE_CPU_GPU(name) PROFILE_SCOPE(name); PROFILE_GPU_SCOPE(name)
+#define PROFILE_FRAME() render::Profiler::EndFrame()
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#define PROFILE_GPU_SCOPE(name) ((void)0)
+#define PROFILE_SCOPE_CPU_GPU(name) ((void)0)
+#define PROFILE_FRAME() ((void)0)
+#endif
\ No newline at end of file
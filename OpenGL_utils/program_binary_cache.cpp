@@ -0,0 +1,171 @@
+#include "program_binary_cache.hpp"
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+namespace render
+{
+    namespace
+    {
+        constexpr uint32_t PROGRAM_BINARY_MAGIC = 0x42505247; // "GRPB"
+        struct ProgramBinaryHeader
+        {
+            uint32_t magic = PROGRAM_BINARY_MAGIC;
+            uint32_t format = 0;
+            uint64_t key = 0;
+            uint64_t length = 0;
+        };
+
+        // FNV-1a
+        uint64_t Hash(uint64_t hash, const void* data, size_t size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(data);
+            for(size_t i = 0; i < size; i++)
+            {
+                hash ^= bytes[i];
+                hash *= 0x100000001b3ull;
+            }
+            return hash;
+        }
+        std::string GLString(GLenum name)
+        {
+            const GLubyte* str = glGetString(name);
+            return str ? reinterpret_cast<const char*>(str) : "";
+        }
+    }
+
+    ProgramBinaryCache::ProgramBinaryCache(const char* dir_) :
+        _dir(dir_),
+        _driver(GLString(GL_VENDOR) + '\n' + GLString(GL_RENDERER) + '\n' + GLString(GL_VERSION))
+    {
+        GLint formatCount = 0;
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+        if(formatCount <= 0)
+        {
+            std::fputs("Driver supports no program binary formats, program binary cache disabled\n", stderr);
+            return;
+        }
+        std::error_code error;
+        std::filesystem::create_directories(_dir, error);
+        if(error)
+        {
+            std::fprintf(stderr, "Error: Creating program binary cache directory %s failed: %s\n", _dir.c_str(), error.message().c_str());
+            return;
+        }
+        _enabled = true;
+    }
+
+    uint64_t ProgramBinaryCache::Key(std::initializer_list<Source> sources_) const
+    {
+        uint64_t key = Hash(0xcbf29ce484222325ull, _driver.data(), _driver.size());
+        for(const Source &source : sources_)
+        {
+            key = Hash(key, &source.type, sizeof(source.type));
+            uint64_t length = source.code.size(); // separates sources, so moving text between stages changes the key
+            key = Hash(key, &length, sizeof(length));
+            key = Hash(key, source.code.data(), source.code.size());
+        }
+        return key;
+    }
+
+    std::filesystem::path ProgramBinaryCache::PathFor(uint64_t key_) const
+    {
+        char name[32];
+        std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key_);
+        return _dir / name;
+    }
+
+    ShaderProgram ProgramBinaryCache::Find(std::initializer_list<Source> sources_)
+    {
+        ShaderProgram program;
+        if(!_enabled)
+        {
+            ++_misses;
+            return program;
+        }
+        uint64_t key = Key(sources_);
+        std::filesystem::path path = PathFor(key);
+        std::ifstream file(path, std::ios::binary);
+        if(!file.is_open())
+        {
+            ++_misses;
+            return program;
+        }
+
+        ProgramBinaryHeader header;
+        std::vector<uint8_t> binary;
+        bool valid = file.read(reinterpret_cast<char*>(&header), sizeof(header)) &&
+                     header.magic == PROGRAM_BINARY_MAGIC && header.key == key && header.length;
+        if(valid)
+        {
+            binary.resize(header.length);
+            valid = (bool)file.read(reinterpret_cast<char*>(binary.data()), binary.size());
+        }
+        file.close();
+
+        if(valid)
+            program = ShaderProgram::FromBinary(header.format, binary.data(), binary.size());
+        if(!program)
+        {
+            ++_misses;
+            ++_rejected;
+            std::error_code error;
+            std::filesystem::remove(path, error);
+            return program;
+        }
+        ++_hits;
+        return program;
+    }
+
+    void ProgramBinaryCache::Store(std::initializer_list<Source> sources_, const ShaderProgram& program_) const
+    {
+        ProgramBinaryHeader header;
+        std::vector<uint8_t> binary;
+        GLenum format;
+        if(!_enabled || !program_.GetBinary(format, binary))
+            return;
+        header.format = format;
+        header.key = Key(sources_);
+        header.length = binary.size();
+
+        // written under temporary name and renamed, so other processes never read partial files
+        std::filesystem::path path = PathFor(header.key);
+        std::filesystem::path tmpPath = path;
+        tmpPath += ".tmp";
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if(!file.is_open() ||
+           !file.write(reinterpret_cast<const char*>(&header), sizeof(header)) ||
+           !file.write(reinterpret_cast<const char*>(binary.data()), binary.size()))
+        {
+            std::fprintf(stderr, "Error: Writing program binary %s failed!\n", tmpPath.c_str());
+            return;
+        }
+        file.close();
+        std::error_code error;
+        std::filesystem::rename(tmpPath, path, error);
+        if(error)
+            std::filesystem::remove(tmpPath, error);
+    }
+
+    ShaderProgram ProgramBinaryCache::Load(std::initializer_list<Source> sources_)
+    {
+        ShaderProgram program = Find(sources_);
+        if(program)
+            return program;
+
+        std::vector<Shader> shaders;
+        for(const Source &source : sources_)
+            shaders.push_back(Shader(source.type, std::string(source.code).c_str()));
+
+        program = ShaderProgram(shaders.data(), shaders.size(), _enabled);
+        if(program)
+            Store(sources_, program);
+        return program;
+    }
+
+    void ProgramBinaryCache::PrintStats() const
+    {
+        std::printf("Program binary cache %s: %u hits, %u misses (%u rejected binaries)\n",
+                    _dir.c_str(), _hits, _misses, _rejected);
+    }
+}
\ No newline at end of file
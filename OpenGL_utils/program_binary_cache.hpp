@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <initializer_list>
+#include <GL/glew.h>
+
+#include "shader.hpp"
+
+namespace render
+{
+    // Stores linked program binaries in a directory, one file per program.
+    // Files are keyed by a hash of the shader sources (defines included)
+    // and the GL vendor, renderer and version, so a driver update misses instead of loading stale binaries.
+    // Binaries the driver still rejects are removed and the program is compiled from source.
+    class ProgramBinaryCache
+    {
+    public:
+        using Source = ShaderSource;
+    private:
+        std::filesystem::path _dir;
+        std::string _driver;
+        bool _enabled = false;
+        unsigned int _hits = 0, _misses = 0, _rejected = 0;
+
+        uint64_t Key(std::initializer_list<Source> sources) const;
+        std::filesystem::path PathFor(uint64_t key) const;
+    public:
+        // needs current GL context, the directory is created when missing
+        ProgramBinaryCache(const char* dir);
+
+        // loads program from cache, or compiles and links it from sources and stores its binary
+        ShaderProgram Load(std::initializer_list<Source> sources);
+        // Find() and Store() split Load() for programs linked elsewhere (e.g. by AsyncProgramCompiler),
+        // link them with the retrievable binary hint when enabled()
+        ShaderProgram Find(std::initializer_list<Source> sources);
+        void Store(std::initializer_list<Source> sources, const ShaderProgram& program) const;
+
+        inline bool enabled() const
+        {
+            return _enabled;
+        }
+        inline unsigned int hits() const
+        {
+            return _hits;
+        }
+        inline unsigned int misses() const
+        {
+            return _misses;
+        }
+        // binaries found but rejected by the driver, counted in misses too
+        inline unsigned int rejected() const
+        {
+            return _rejected;
+        }
+        void PrintStats() const;
+    };
+}
\ No newline at end of file
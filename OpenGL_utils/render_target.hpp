@@ -0,0 +1,170 @@
+#pragma once
+#include <vector>
+#include <GL/glew.h>
+
+#include "framebuffer.hpp"
+#include "texture.hpp"
+
+namespace render
+{
+    // Offscreen color and depth target sized in pixels, built on Framebuffer and Texture2D.
+    // With samples > 1 rendering goes to multisampled storage and Resolve() blits it into
+    // the single sampled textures returned by color() and depth().
+    class RenderTarget
+    {
+    public:
+        struct Attachment
+        {
+            GLenum internalFormat;
+            GLsizei components;
+        };
+    private:
+        std::vector<Attachment> _colorFormats;
+        Attachment _depthFormat;
+        GLsizei _width = 0, _height = 0, _samples = 1;
+        Framebuffer _framebuffer, _resolveFramebuffer;
+        std::vector<Texture2D> _color;
+        Texture2D _depth;
+        std::vector<Texture2DMultisample> _multisampleColor;
+        Texture2DMultisample _multisampleDepth;
+
+        void Allocate()
+        {
+            _framebuffer = Framebuffer();
+            _resolveFramebuffer = Framebuffer();
+            _color.clear();
+            _multisampleColor.clear();
+            std::vector<GLenum> drawBuffers;
+            for(size_t i = 0; i < _colorFormats.size(); i++)
+            {
+                const Attachment& format = _colorFormats[i];
+                GLenum attachment = GL_COLOR_ATTACHMENT0 + i;
+                _color.emplace_back(1, format.internalFormat, format.components, _width, _height);
+                _color.back().Label(GpuMemoryCategory::RENDER_TARGET);
+                if(_samples > 1)
+                {
+                    _multisampleColor.emplace_back(format.internalFormat, format.components, _width, _height, _samples);
+                    _framebuffer.AttachTexture(attachment, _multisampleColor.back());
+                    _resolveFramebuffer.AttachTexture(attachment, _color.back());
+                }
+                else
+                    _framebuffer.AttachTexture(attachment, _color.back());
+                drawBuffers.push_back(attachment);
+            }
+            if(drawBuffers.empty())
+                _framebuffer.DrawBuffer(GL_NONE);
+            else
+                glNamedFramebufferDrawBuffers(_framebuffer, drawBuffers.size(), drawBuffers.data());
+
+            _depth = Texture2D();
+            _multisampleDepth = Texture2DMultisample();
+            if(_depthFormat.internalFormat != GL_NONE)
+            {
+                _depth = Texture2D(1, _depthFormat.internalFormat, _depthFormat.components, _width, _height);
+                _depth.Label(GpuMemoryCategory::RENDER_TARGET);
+                if(_samples > 1)
+                {
+                    _multisampleDepth = Texture2DMultisample(_depthFormat.internalFormat, _depthFormat.components, _width, _height, _samples);
+                    _framebuffer.AttachTexture(DepthAttachment(), _multisampleDepth);
+                    _resolveFramebuffer.AttachTexture(DepthAttachment(), _depth);
+                }
+                else
+                    _framebuffer.AttachTexture(DepthAttachment(), _depth);
+            }
+            _framebuffer.Complete();
+        }
+        GLenum DepthAttachment() const
+        {
+            GLenum format = _depthFormat.internalFormat;
+            return format == GL_DEPTH24_STENCIL8 || format == GL_DEPTH32F_STENCIL8 ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+        }
+    public:
+        // depthFormat GL_NONE creates no depth attachment, samples > 1 enables MSAA
+        RenderTarget(GLsizei width, GLsizei height, std::vector<Attachment> colorFormats = {{GL_RGBA8, 4}},
+                     Attachment depthFormat = {GL_DEPTH_COMPONENT32F, 1}, GLsizei samples = 1) :
+            _colorFormats(std::move(colorFormats)),
+            _depthFormat(depthFormat),
+            _width(width),
+            _height(height),
+            _samples(samples > 1 ? samples : 1)
+        {
+            Allocate();
+        }
+        RenderTarget(const RenderTarget&) = delete;
+        RenderTarget& operator=(const RenderTarget&) = delete;
+
+        // reallocates all attachments, their contents are lost
+        void Resize(GLsizei width, GLsizei height)
+        {
+            if(width == _width && height == _height)
+                return;
+            _width = width;
+            _height = height;
+            Allocate();
+        }
+        // binds for drawing and sets the viewport to the whole target
+        void Bind() const
+        {
+            _framebuffer.Bind(GL_DRAW_FRAMEBUFFER);
+            glViewport(0, 0, _width, _height);
+        }
+        void Clear(const float color[4] = nullptr, float depth = 1.f) const
+        {
+            static const float black[4] = {0.f, 0.f, 0.f, 0.f};
+            for(GLint i = 0; i < (GLint)_colorFormats.size(); i++)
+                glClearNamedFramebufferfv(_framebuffer, GL_COLOR, i, color ? color : black);
+            if(_depthFormat.internalFormat != GL_NONE)
+                glClearNamedFramebufferfv(_framebuffer, GL_DEPTH, 0, &depth);
+        }
+        // makes color() and depth() hold the last rendering, a no-op without MSAA
+        void Resolve() const
+        {
+            if(_samples == 1)
+                return;
+            for(GLint i = 0; i < (GLint)_colorFormats.size(); i++)
+            {
+                glNamedFramebufferReadBuffer(_framebuffer, GL_COLOR_ATTACHMENT0 + i);
+                glNamedFramebufferDrawBuffer(_resolveFramebuffer, GL_COLOR_ATTACHMENT0 + i);
+                glBlitNamedFramebuffer(_framebuffer, _resolveFramebuffer, 0, 0, _width, _height, 0, 0, _width, _height,
+                                       GL_COLOR_BUFFER_BIT, GL_NEAREST);
+            }
+            if(_depthFormat.internalFormat != GL_NONE) // depth is not averaged, one sample is picked
+                glBlitNamedFramebuffer(_framebuffer, _resolveFramebuffer, 0, 0, _width, _height, 0, 0, _width, _height,
+                                       GL_DEPTH_BUFFER_BIT, GL_NEAREST);
+            glNamedFramebufferReadBuffer(_framebuffer, GL_COLOR_ATTACHMENT0);
+        }
+        // resolves and scales the first color attachment into framebuffer, 0 is the window's default framebuffer
+        void BlitTo(GLsizei width, GLsizei height, GLuint framebuffer = 0, GLenum filter = GL_LINEAR) const
+        {
+            Resolve();
+            const Framebuffer& source = _samples > 1 ? _resolveFramebuffer : _framebuffer;
+            glNamedFramebufferReadBuffer(source, GL_COLOR_ATTACHMENT0);
+            glBlitNamedFramebuffer(source, framebuffer, 0, 0, _width, _height, 0, 0, width, height, GL_COLOR_BUFFER_BIT, filter);
+        }
+
+        inline const Texture2D& color(size_t attachment = 0) const
+        {
+            return _color[attachment];
+        }
+        inline const Texture2D& depth() const
+        {
+            return _depth;
+        }
+        inline const Framebuffer& framebuffer() const
+        {
+            return _framebuffer;
+        }
+        inline GLsizei width() const
+        {
+            return _width;
+        }
+        inline GLsizei height() const
+        {
+            return _height;
+        }
+        inline GLsizei samples() const
+        {
+            return _samples;
+        }
+    };
+}
\ No newline at end of file
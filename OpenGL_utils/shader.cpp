@@ -1,4 +1,5 @@
 #include "shader.hpp"
+#include "profiler.hpp"
 
 namespace render
 {
@@ -8,19 +9,28 @@ namespace render
         if(!f)
             return false;
 
-        fseek(f, 0, SEEK_END);
-        size_t size = ftell(f);
+        long size = -1;
+        if(!fseek(f, 0, SEEK_END))
+            size = ftell(f);
         rewind(f);
+        if(size < 0)
+        {
+            fclose(f);
+            return false;
+        }
 
         std::string text(size, '\0');
-        fread(text.data(), 1, size, f);
+        size_t read = fread(text.data(), 1, size, f);
         fclose(f);
+        if(read != (size_t)size)
+            return false;
 
         out = std::move(text);
 
         return true;
     }
     Shader::Shader(const Shader& other_) :
+	instanceCount(other_.instanceCount),
 	_name(other_._name),
 	_type(other_._type)
     {
@@ -30,6 +40,7 @@ namespace render
     Shader::Shader(GLenum type_, const char* const code_):
         _type(type_)
     {
+        PROFILE_SCOPE("Shader compile");
         GLint compileStatus, logLen;
         _name = glCreateShader(_type);
         glShaderSource(_name, 1, &code_, NULL);
@@ -88,13 +99,20 @@ namespace render
         return Shader(type_, code.c_str());
     }
 
-    ShaderProgram::ShaderProgram(std::initializer_list<Shader> shaders_)
+    ShaderProgram::ShaderProgram(std::initializer_list<Shader> shaders_, bool retrievableBinary_) :
+        ShaderProgram(shaders_.begin(), shaders_.size(), retrievableBinary_)
     {
+    }
+    ShaderProgram::ShaderProgram(const Shader* shaders_, size_t count_, bool retrievableBinary_)
+    {
+        PROFILE_SCOPE("ShaderProgram link");
         _name = glCreateProgram();
-        for(const Shader &shader : shaders_)
+        for(size_t i = 0; i < count_; i++)
         {
-            glAttachShader(_name, shader);
+            glAttachShader(_name, shaders_[i]);
         }
+        if(retrievableBinary_)
+            glProgramParameteri(_name, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
         glLinkProgram(_name);
 
         GLint linkStatus, logLen;
@@ -116,6 +134,7 @@ namespace render
     }
 
     ShaderProgram::ShaderProgram(const ShaderProgram& other_) : 
+        instanceCount(other_.instanceCount),
         _name(other_._name)
     {
         if(instanceCount)
@@ -157,4 +176,35 @@ namespace render
     {
         glUseProgram(_name);
     }
+
+    ShaderProgram ShaderProgram::FromBinary(GLenum format_, const void* binary_, GLsizei length_)
+    {
+        ShaderProgram program;
+        GLuint name = glCreateProgram();
+        glProgramBinary(name, format_, binary_, length_);
+
+        GLint linkStatus;
+        glGetProgramiv(name, GL_LINK_STATUS, &linkStatus);
+        if(!linkStatus)
+        {
+            glDeleteProgram(name);
+            return program;
+        }
+        program._name = name;
+        program.instanceCount = new GLuint(1);
+        return program;
+    }
+
+    bool ShaderProgram::GetBinary(GLenum &format_, std::vector<uint8_t> &binary_) const
+    {
+        GLint length = 0;
+        if(_name)
+            glGetProgramiv(_name, GL_PROGRAM_BINARY_LENGTH, &length);
+        if(length <= 0)
+            return false;
+        binary_.resize(length);
+        glGetProgramBinary(_name, length, &length, &format_, binary_.data());
+        binary_.resize(length);
+        return length > 0;
+    }
 }
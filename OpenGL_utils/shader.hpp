@@ -3,6 +3,9 @@
 #include <unordered_map>
 #include <GL/glew.h>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
 
 namespace render
 {
@@ -52,20 +55,33 @@ namespace render
 		}
 	};
 
+	struct ShaderSource
+	{
+		GLenum type;
+		std::string_view code;
+	};
+
 	class ShaderProgram
 	{
+		friend class AsyncProgramCompiler;
 	private:
 		unsigned int *instanceCount = nullptr;
 		GLuint _name = 0;
 	public:
 		ShaderProgram(){}
-		ShaderProgram(std::initializer_list<Shader> shaders);
+		// retrievableBinary hints the driver that GetBinary() will be called
+		ShaderProgram(std::initializer_list<Shader> shaders, bool retrievableBinary = false);
+		ShaderProgram(const Shader* shaders, size_t count, bool retrievableBinary = false);
 		ShaderProgram(const ShaderProgram& other);
 		ShaderProgram& operator=(const ShaderProgram& other);
 		~ShaderProgram();
 
 		void Use() const;
 
+		// returns empty program when the driver rejects the binary (e.g. after driver update)
+		static ShaderProgram FromBinary(GLenum format, const void* binary, GLsizei length);
+		bool GetBinary(GLenum &format, std::vector<uint8_t> &binary) const;
+
 		inline GLuint name() const
 		{
 			return _name;
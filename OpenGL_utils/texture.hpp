@@ -1,9 +1,14 @@
 #pragma once
 #include <type_traits>
+#include <algorithm>
 #include "external/stb/stb_image.h"
 #include "external/stb/stb_image_write.h"
 #include "GL/glew.h"
 #include <string>
+#include "buffer.hpp"
+#include "gpu_memory.hpp"
+#include "pixel_convert.hpp"
+#include "profiler.hpp"
 
 namespace render
 {
@@ -11,6 +16,7 @@ namespace render
     {
         UNSIGNED_BYTE = GL_UNSIGNED_BYTE,
         UNSIGNED_SHORT = GL_UNSIGNED_SHORT,
+        HALF_FLOAT = GL_HALF_FLOAT, // IEEE binary16 stored as GLhalf, see FloatToHalf
         FLOAT = GL_FLOAT
     };
     enum class TexFormat : GLenum
@@ -36,6 +42,8 @@ namespace render
                 return sizeof(GLubyte);
             case TexCompType::UNSIGNED_SHORT:
                 return sizeof(GLushort);
+            case TexCompType::HALF_FLOAT:
+                return sizeof(GLhalf);
             case TexCompType::FLOAT:
                 return sizeof(GLfloat);
         }
@@ -55,6 +63,7 @@ namespace render
                     width, height, depth, comp_num,
                     comp_type == TexCompType::UNSIGNED_BYTE ? "UNSIGNED_BYTE" : 
                     comp_type == TexCompType::UNSIGNED_SHORT ? "UNSIGNED_SHORT" : 
+                    comp_type == TexCompType::HALF_FLOAT ? "HALF_FLOAT" : 
                     comp_type == TexCompType::FLOAT ? "FLOAT" : "UNKNOWN");
             }
         };
@@ -70,6 +79,8 @@ namespace render
                         return new GLubyte[comp_n * w * h * d];
                     case TexCompType::UNSIGNED_SHORT:
                         return new GLushort[comp_n * w * h * d];
+                    case TexCompType::HALF_FLOAT:
+                        return new GLhalf[comp_n * w * h * d];
                     case TexCompType::FLOAT:
                         return new GLfloat[comp_n * w * h * d];
                 }
@@ -85,6 +96,9 @@ namespace render
                     case TexCompType::UNSIGNED_SHORT:
                         delete[] (GLushort*) pixels;
                         break;
+                    case TexCompType::HALF_FLOAT:
+                        delete[] (GLhalf*) pixels;
+                        break;
                     case TexCompType::FLOAT:
                         delete[] (GLfloat*) pixels;
                         break;
@@ -119,10 +133,11 @@ namespace render
                 (uint8_t*)_data->pixels);
             }
         }
-        Image(Image& other)
+        Image(const Image& other)
         {
             _data = other._data;
-            _data->Acquire();
+            if(_data)
+                _data->Acquire();
         }
         Image(Image&& other)
         {
@@ -131,10 +146,11 @@ namespace render
         }
         Image& operator=(Image& other)
         {
+            if(other._data)
+                other._data->Acquire();
             if(_data)
                 _data->Release();
             _data = other._data;
-            _data->Acquire();
             return *this;
         }
         Image& operator=(Image&& other)
@@ -153,14 +169,20 @@ namespace render
         {
             return _data;
         }
+        inline operator bool() const
+        {
+            return _data;
+        }
         void Store(uint64_t bytes, const void* data)
         {
             uint64_t storage = _data->width * _data->height * _data->comp_num * TexCompTypeSize(_data->comp_type);
             uint64_t copy_bytes = bytes > storage ? storage : bytes;
             std::copy((uint8_t*)data, (uint8_t*)data + copy_bytes, (uint8_t*)_data->pixels);
         }
+        // HALF_FLOAT is decoded as FLOAT and converted, e.g. for HDR environment maps at half the memory
         static Image FromFile(TexCompType comp_type, char const *filename, int desired_channels = 0)
         {
+            PROFILE_SCOPE("Image::FromFile");
             int w, h, comp_n;
             void *stb_image;
             switch(comp_type)
@@ -171,14 +193,123 @@ namespace render
                 case TexCompType::UNSIGNED_SHORT:
                     stb_image = (uint8_t*)stbi_load_16(filename, &w, &h, &comp_n, desired_channels);
                     break;
+                case TexCompType::HALF_FLOAT:
+                    return FromFile(TexCompType::FLOAT, filename, desired_channels).Convert(TexCompType::HALF_FLOAT);
                 case TexCompType::FLOAT:
                     stb_image = (uint8_t*)stbi_loadf(filename, &w, &h, &comp_n, desired_channels);
                     break;
             }
+            if(!stb_image)
+            {
+                std::fprintf(stderr, "Error: Failed to load image %s!\n", filename);
+                return Image();
+            }
+            if(desired_channels)
+                comp_n = desired_channels;
             Image image{comp_type, (uint32_t)w, (uint32_t)h, 1u, (uint32_t)comp_n, stb_image};
             stbi_image_free(stb_image);
             return image;
         }
+        // Converts between FLOAT and HALF_FLOAT, other component types are returned as is.
+        Image Convert(TexCompType comp_type) const
+        {
+            if(!_data || comp_type == _data->comp_type)
+                return *this;
+            size_t count = (size_t)_data->width * _data->height * _data->depth * _data->comp_num;
+            Image image{comp_type, _data->width, _data->height, _data->depth, _data->comp_num};
+            if(_data->comp_type == TexCompType::FLOAT && comp_type == TexCompType::HALF_FLOAT)
+                FloatToHalf((uint16_t*)image->pixels, (const float*)_data->pixels, count);
+            else if(_data->comp_type == TexCompType::HALF_FLOAT && comp_type == TexCompType::FLOAT)
+                HalfToFloat((float*)image->pixels, (const uint16_t*)_data->pixels, count);
+            else
+            {
+                std::fputs("Error: Only FLOAT and HALF_FLOAT images can be converted into each other!\n", stderr);
+                return *this;
+            }
+            return image;
+        }
+        // RGB images gain an opaque alpha channel, others are returned as is.
+        // RGBA uploads skip the per pixel conversion drivers do for RGB.
+        Image PadToRGBA() const
+        {
+            if(!_data || _data->comp_num != 3)
+                return *this;
+            size_t pixelCount = (size_t)_data->width * _data->height * _data->depth;
+            Image image{_data->comp_type, _data->width, _data->height, _data->depth, 4};
+            switch(_data->comp_type)
+            {
+                case TexCompType::UNSIGNED_BYTE:
+                    PadRGBToRGBA((uint8_t*)image->pixels, (const uint8_t*)_data->pixels, pixelCount, (uint8_t)0xFF);
+                    break;
+                case TexCompType::UNSIGNED_SHORT:
+                    PadRGBToRGBA<uint16_t>((uint16_t*)image->pixels, (const uint16_t*)_data->pixels, pixelCount, 0xFFFF);
+                    break;
+                case TexCompType::HALF_FLOAT:
+                    PadRGBToRGBA<uint16_t>((uint16_t*)image->pixels, (const uint16_t*)_data->pixels, pixelCount, 0x3C00);
+                    break;
+                case TexCompType::FLOAT:
+                    PadRGBToRGBA<float>((float*)image->pixels, (const float*)_data->pixels, pixelCount, 1.f);
+                    break;
+            }
+            return image;
+        }
+        // Channel i of the result is the first channel of channels[i], null or empty entries are filled
+        // with the maximum value (1.0 after normalization), which is neutral for multiplied maps.
+        // All provided images need the same size and component type.
+        // e.g. MergeChannels({&occlusion, &roughness, &metallic}) gives an ORM map
+        static Image MergeChannels(std::initializer_list<const Image*> channels)
+        {
+            const ImageData* ref = nullptr;
+            for(const Image* channel : channels)
+            {
+                if(!channel || !channel->_data)
+                    continue;
+                if(ref && (ref->width != (*channel)->width || ref->height != (*channel)->height ||
+                           ref->depth != (*channel)->depth || ref->comp_type != (*channel)->comp_type))
+                {
+                    std::fputs("Error: Merged images must have equal size and component type!\n", stderr);
+                    return Image();
+                }
+                ref = channel->_data;
+            }
+            if(!ref || channels.size() > 4)
+            {
+                std::fputs("Error: Merging channels requires 1 to 4 channels and at least one image!\n", stderr);
+                return Image();
+            }
+            Image image{ref->comp_type, ref->width, ref->height, ref->depth, (uint32_t)channels.size()};
+            size_t pixelCount = (size_t)ref->width * ref->height * ref->depth;
+            switch(ref->comp_type)
+            {
+                case TexCompType::UNSIGNED_BYTE:
+                    image.MergeChannels<GLubyte>(channels, pixelCount, 0xFF);
+                    break;
+                case TexCompType::UNSIGNED_SHORT:
+                    image.MergeChannels<GLushort>(channels, pixelCount, 0xFFFF);
+                    break;
+                case TexCompType::HALF_FLOAT:
+                    image.MergeChannels<GLhalf>(channels, pixelCount, 0x3C00); // 1.0
+                    break;
+                case TexCompType::FLOAT:
+                    image.MergeChannels<GLfloat>(channels, pixelCount, 1.f);
+                    break;
+            }
+            return image;
+        }
+    private:
+        template<typename T>
+        void MergeChannels(std::initializer_list<const Image*> channels, size_t pixelCount, T fallback)
+        {
+            ChannelSource<T> sources[4];
+            uint32_t i = 0;
+            for(const Image* channel : channels)
+            {
+                if(channel && channel->_data)
+                    sources[i] = {(const T*)channel->_data->pixels, channel->_data->comp_num};
+                ++i;
+            }
+            InterleaveChannels<T>((T*)_data->pixels, sources, i, pixelCount, fallback);
+        }
     };
     class Texture
     {
@@ -188,14 +319,18 @@ namespace render
         {
         public:
             // w, h, d, n, levels - width, height, depth, number of components, amount of mipmap levels
-            const GLuint name = 0;
+            // name and dimensions only change when the storage is replaced, see Texture::ReplaceStorage
+            GLuint name = 0;
             const GLenum target, internal_format;
-            const GLsizei width, height, depth, comp_num, levels;
+            GLsizei width, height, depth;
+            const GLsizei comp_num;
+            GLsizei levels;
         };
         struct TextureMetadataInterface : public TextureMetadata
         {
         private:
             mutable uint32_t _ref_count = 0;
+            static inline uint64_t _next_id = 0;
             static GLuint _createTexture(GLenum target)
             {
                 GLuint name;
@@ -203,6 +338,11 @@ namespace render
                 return name;
             }
         public:
+            const uint64_t id = ++_next_id; // unlike the name never reused and kept by ReplaceStorage
+            GpuMemory::Handle memory = 0;
+            mutable uint64_t last_used_frame = 0;
+            mutable uint32_t pin_count = 0;
+
             inline void Acquire()
             {
                 ++_ref_count;
@@ -218,15 +358,22 @@ namespace render
                                GLsizei comp_n, GLsizei w, GLsizei h = 1, GLsizei d = 1) : 
                 TextureMetadata({_createTexture(gl_target), 
                             gl_target, gl_in_format,
-                            w, h, d, comp_n, lvls})
-
+                            w, h, d, comp_n, lvls}),
+                memory(GpuMemory::Track(gl_target == GL_TEXTURE_2D_MULTISAMPLE ? GpuMemoryCategory::RENDER_TARGET : GpuMemoryCategory::TEXTURE,
+                                        storageSize())),
+                last_used_frame(GpuMemory::frame())
             {
                 
             }
+            inline uint64_t storageSize() const
+            {
+                return TextureStorageSize(internal_format, width, height, depth, levels);
+            }
 
             ~TextureMetadataInterface()
             {
                 glDeleteTextures(1, &name);
+                GpuMemory::Untrack(memory);
             }
         };
 
@@ -245,6 +392,26 @@ namespace render
         {
             _data->Acquire();
         }
+        // Swaps GL object and dimensions with other, which needs the same target and format.
+        // Every copy of this texture sees the new storage, other ends up with the old one.
+        // Sampling filters and wrap modes are carried over, bindless handles to the old object become invalid.
+        void ReplaceStorage(Texture& other)
+        {
+            static constexpr GLenum parameters[] = {GL_TEXTURE_MIN_FILTER, GL_TEXTURE_MAG_FILTER, GL_TEXTURE_WRAP_S, GL_TEXTURE_WRAP_T};
+            for(GLenum parameter : parameters)
+            {
+                GLint value;
+                glGetTextureParameteriv(_data->name, parameter, &value);
+                glTextureParameteri(other._data->name, parameter, value);
+            }
+            std::swap(_data->name, other._data->name);
+            std::swap(_data->width, other._data->width);
+            std::swap(_data->height, other._data->height);
+            std::swap(_data->depth, other._data->depth);
+            std::swap(_data->levels, other._data->levels);
+            GpuMemory::Resize(_data->memory, _data->storageSize());
+            GpuMemory::Resize(other._data->memory, other._data->storageSize());
+        }
     public:
         Texture() = default;
 
@@ -277,6 +444,11 @@ namespace render
             other._data = nullptr;
             return *this;
         }
+        ~Texture()
+        {
+            if(_data)
+                _data->Release();
+        }
         const TextureMetadata* operator->() const
         {
             static TextureMetadata uninit = {0,0,0,0,0,0,0,0};
@@ -294,14 +466,63 @@ namespace render
         {
             return _data;
         }
+        // identifies the texture and its copies for its whole lifetime, 0 for empty textures
+        inline uint64_t id() const
+        {
+            return _data ? _data->id : 0;
+        }
+        // stamps the current GpuMemory::frame() as last use, least recently used textures are evicted first
+        inline void Touch() const
+        {
+            if(_data)
+                _data->last_used_frame = GpuMemory::frame();
+        }
+        inline uint64_t lastUsedFrame() const
+        {
+            return _data ? _data->last_used_frame : 0;
+        }
+        // pinned textures keep their storage, e.g. while bindless handles to them are resident
+        inline void Pin() const
+        {
+            if(_data)
+                ++_data->pin_count;
+        }
+        inline void Unpin() const
+        {
+            if(_data && _data->pin_count)
+                --_data->pin_count;
+        }
+        inline bool pinned() const
+        {
+            return _data && _data->pin_count;
+        }
+        // files the texture under category in GpuMemory and names it there and in GL debug output
+        void Label(GpuMemoryCategory category, const char* name = nullptr) const
+        {
+            if(!_data)
+                return;
+            GpuMemory::Label(_data->memory, category, name);
+            if(name)
+                glObjectLabel(GL_TEXTURE, _data->name, -1, name);
+        }
     };
     class Texture2D : public Texture
     {
     public:
         // TODO - add constructor from Image
         Texture2D() = default;
-        Texture2D(Texture2D& other) : Texture(other) {}
+        Texture2D(const Texture2D& other) : Texture(other) {}
         Texture2D(Texture2D&& other) : Texture(std::move(other)) {}
+        Texture2D& operator=(const Texture2D& other)
+        {
+            Texture::operator=(other);
+            return *this;
+        }
+        Texture2D& operator=(Texture2D&& other)
+        {
+            Texture::operator=(std::move(other));
+            return *this;
+        }
         Texture2D(GLsizei lvls, GLenum gl_in_format,
                   GLsizei comp_n, GLsizei w, GLsizei h):
             Texture(GL_TEXTURE_2D, lvls, gl_in_format, comp_n, w, h)
@@ -312,33 +533,145 @@ namespace render
             Texture(GL_TEXTURE_2D, lvls, gl_in_format, image->comp_num, image->width, image->height)
         {
             glTextureStorage2D(data()->name, data()->levels, data()->internal_format, data()->width, data()->height);
-            glTextureSubImage2D(
-                data()->name, 0, 0, 0, data()->width, data()->width, 
-                (GLenum)compNumToFormat[data()->comp_num], (GLenum)image->comp_type, image->pixels);
+            Load(image, 0);
         }
         inline void Load(TexFormat format, TexCompType type, void* pixels, GLint level, GLint x, GLint y, GLsizei w, GLsizei h)
         {
+            PROFILE_SCOPE("Texture2D::Load");
             glTextureSubImage2D(data()->name, level, x, y, w, h, (GLenum)format, (GLenum)type, pixels);
         }
         inline void Load(TexFormat format, TexCompType type, void* pixels, GLint level)
         {
-            glTextureSubImage2D(data()->name, level, 0, 0, data()->width, data()->width, (GLenum)format, (GLenum)type, pixels);
+            PROFILE_SCOPE("Texture2D::Load");
+            glTextureSubImage2D(data()->name, level, 0, 0, data()->width, data()->height, (GLenum)format, (GLenum)type, pixels);
         }
+        // RGB images are uploaded padded to RGBA, see Image::PadToRGBA
         inline void Load(const Image image, GLint level, GLint x, GLint y)
         {
+            PROFILE_SCOPE("Texture2D::Load");
+            Image upload = image.PadToRGBA();
             glTextureSubImage2D(
-                data()->name, level, x, y, data()->width, data()->width, 
-                (GLenum)(GLenum)compNumToFormat[data()->comp_num], (GLenum)image->comp_type, image->pixels);
+                data()->name, level, x, y, data()->width, data()->height, 
+                (GLenum)compNumToFormat[upload->comp_num], (GLenum)upload->comp_type, upload->pixels);
         }
         inline void Load(const Image image, GLint level)
         {
-            glTextureSubImage2D(
-                data()->name, level, 0, 0, data()->width, data()->width, 
-                (GLenum)compNumToFormat[data()->comp_num], (GLenum)image->comp_type, image->pixels);
+            Load(image, level, 0, 0);
+        }
+        // uploads from a pixel unpack buffer, pixels start at offset bytes into the buffer
+        inline void Load(const ConstSharedBuffer& pixelBuffer, GLintptr offset, TexFormat format, TexCompType type, GLint level)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+            glTextureSubImage2D(data()->name, level, 0, 0, std::max(data()->width >> level, 1), std::max(data()->height >> level, 1),
+                                (GLenum)format, (GLenum)type, (const void*)offset);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
         }
+        // waits for the GPU to finish the texture, AsyncReadback reads without stalling
         inline void Fetch(TexFormat format, TexCompType type, GLint level, GLsizei bufSize, void* pixels)
         {
             glGetTextureImage(data()->name, level, (GLenum)format, (GLenum)type, bufSize, pixels);
         }
+        // takes over the storage of other, e.g. a full resolution reload of an evicted texture
+        inline void ReplaceStorage(Texture2D&& other)
+        {
+            Texture::ReplaceStorage(other);
+        }
+        // Replaces the storage with one lacking the count largest levels, the others are copied on the GPU.
+        // At least one level is kept, false when there was nothing to drop.
+        bool DropLevels(GLsizei count)
+        {
+            if(!data() || (count = std::min(count, data()->levels - 1)) <= 0)
+                return false;
+            Texture2D smaller(data()->levels - count, data()->internal_format, data()->comp_num,
+                              std::max(data()->width >> count, 1), std::max(data()->height >> count, 1));
+            for(GLint level = 0; level < smaller->levels; level++)
+                glCopyImageSubData(data()->name, GL_TEXTURE_2D, level + count, 0, 0, 0,
+                                   smaller, GL_TEXTURE_2D, level, 0, 0, 0,
+                                   std::max(smaller->width >> level, 1), std::max(smaller->height >> level, 1), 1);
+            Texture::ReplaceStorage(smaller);
+            return true;
+        }
+    };
+    class Texture2DArray : public Texture
+    {
+    public:
+        Texture2DArray() = default;
+        Texture2DArray(const Texture2DArray& other) : Texture(other) {}
+        Texture2DArray(Texture2DArray&& other) : Texture(std::move(other)) {}
+        Texture2DArray& operator=(const Texture2DArray& other)
+        {
+            Texture::operator=(other);
+            return *this;
+        }
+        Texture2DArray& operator=(Texture2DArray&& other)
+        {
+            Texture::operator=(std::move(other));
+            return *this;
+        }
+        Texture2DArray(GLsizei lvls, GLenum gl_in_format,
+                       GLsizei comp_n, GLsizei w, GLsizei h, GLsizei layers):
+            Texture(GL_TEXTURE_2D_ARRAY, lvls, gl_in_format, comp_n, w, h, layers)
+        {
+            glTextureStorage3D(data()->name, data()->levels, data()->internal_format, data()->width, data()->height, data()->depth);
+        }
+        inline GLsizei layers() const
+        {
+            return data() ? data()->depth : 0;
+        }
+        inline void Load(TexFormat format, TexCompType type, const void* pixels, GLint layer, GLint level)
+        {
+            PROFILE_SCOPE("Texture2DArray::Load");
+            glTextureSubImage3D(data()->name, level, 0, 0, layer,
+                                std::max(data()->width >> level, 1), std::max(data()->height >> level, 1), 1,
+                                (GLenum)format, (GLenum)type, pixels);
+        }
+        // RGB images are uploaded padded to RGBA, see Image::PadToRGBA
+        inline void Load(const Image image, GLint layer, GLint level)
+        {
+            Image upload = image.PadToRGBA();
+            Load(compNumToFormat[upload->comp_num], upload->comp_type, upload->pixels, layer, level);
+        }
+        // uploads from a pixel unpack buffer, pixels start at offset bytes into the buffer
+        inline void Load(const ConstSharedBuffer& pixelBuffer, GLintptr offset, TexFormat format, TexCompType type, GLint layer, GLint level)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixelBuffer);
+            Load(format, type, (const void*)offset, layer, level);
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        // GPU side copy of all levels of a 2D texture with matching size, format and level count into a layer
+        inline void CopyLayer(const Texture& src, GLint layer)
+        {
+            for(GLint level = 0; level < data()->levels; level++)
+                glCopyImageSubData(src, GL_TEXTURE_2D, level, 0, 0, 0,
+                                   data()->name, GL_TEXTURE_2D_ARRAY, level, 0, 0, layer,
+                                   std::max(data()->width >> level, 1), std::max(data()->height >> level, 1), 1);
+        }
+    };
+    // multisampled render target storage, the sample count is kept in depth
+    class Texture2DMultisample : public Texture
+    {
+    public:
+        Texture2DMultisample() = default;
+        Texture2DMultisample(const Texture2DMultisample& other) : Texture(other) {}
+        Texture2DMultisample(Texture2DMultisample&& other) : Texture(std::move(other)) {}
+        Texture2DMultisample& operator=(const Texture2DMultisample& other)
+        {
+            Texture::operator=(other);
+            return *this;
+        }
+        Texture2DMultisample& operator=(Texture2DMultisample&& other)
+        {
+            Texture::operator=(std::move(other));
+            return *this;
+        }
+        Texture2DMultisample(GLenum gl_in_format, GLsizei comp_n, GLsizei w, GLsizei h, GLsizei samples):
+            Texture(GL_TEXTURE_2D_MULTISAMPLE, 1, gl_in_format, comp_n, w, h, samples)
+        {
+            glTextureStorage2DMultisample(data()->name, data()->depth, data()->internal_format, data()->width, data()->height, GL_TRUE);
+        }
+        inline GLsizei samples() const
+        {
+            return data() ? data()->depth : 0;
+        }
     };
 }
\ No newline at end of file
@@ -0,0 +1,467 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "OpenGL_utils/external/stb/stb_image.h"
+#include "OpenGL_utils/pixel_convert.hpp"
+#include "renderer/headers/asset_archive_format.hpp"
+#include "renderer/headers/lz4.hpp"
+
+namespace fs = std::filesystem;
+using render::AssetArchiveEntry;
+using render::AssetArchiveHeader;
+using render::AssetCompType;
+using render::AssetType;
+
+struct CookedAsset
+{
+    AssetArchiveEntry entry;
+    std::vector<uint8_t> streams[render::ASSET_MAX_STREAMS];
+};
+
+void printUsage();
+bool cookManifest(const fs::path& manifestPath, std::vector<CookedAsset>& out);
+bool cookTexture(const fs::path& path, int channels, AssetCompType compType, CookedAsset& out);
+bool cookMesh(const fs::path& path, CookedAsset& out);
+bool cookORM(const fs::path (&paths)[3], CookedAsset& out);
+bool writeArchive(const fs::path& path, std::vector<CookedAsset>& assets);
+void enableLZ4(const char*);
+
+const char* const usage_msg = R"usage(
+Usage: %s [flags] <manifest file path> <out archive path>
+
+Manifest lines (paths are relative to the manifest, '#' starts a comment):
+    texture <name> <image path> [channels] [u8|u16|f16|f32]
+        -> f16 stores half floats, e.g. for HDR images at half the size of f32
+    mesh <name> <obj path>
+    orm <name> <occlusion path|-> <roughness path|-> <metallic path|->
+        -> packs single channel maps into one RGB texture, '-' channels are filled with 1.0
+
+Flags:
+    -lz4 -> Compress streams with LZ4, streams that do not shrink are stored raw.
+)usage";
+
+bool useLZ4 = false;
+const char* scriptName = nullptr;
+
+using FlagHandler_p = void(*)(const char*);
+
+const std::unordered_map<std::string, FlagHandler_p> flagMap{
+    std::pair<std::string, FlagHandler_p>("-lz4", enableLZ4)
+};
+
+int main(int argc, const char* argv[])
+{
+    // get data from args
+
+    scriptName = argv[0];
+
+    fs::path manifestPath, outFilePath;
+
+    for(int i = 1; i < argc; i++)
+    {
+        if(flagMap.contains(argv[i]))
+            flagMap.at(argv[i])(argv[i]);
+        else if(manifestPath.empty())
+            manifestPath = argv[i];
+        else if(outFilePath.empty())
+            outFilePath = argv[i];
+        else
+        {
+            std::fprintf(stderr, "Invalid argument provided: %s\n", argv[i]);
+            printUsage();
+            return EXIT_FAILURE;
+        }
+    }
+    if(manifestPath.empty())
+    {
+        std::fputs("No manifest file provided!\n", stderr);
+        printUsage();
+        return EXIT_FAILURE;
+    }
+    if(outFilePath.empty())
+    {
+        std::fputs("No output file provided!\n", stderr);
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    // cooking
+
+    std::vector<CookedAsset> assets;
+    if(!cookManifest(manifestPath, assets))
+        return EXIT_FAILURE;
+
+    if(!writeArchive(outFilePath, assets))
+    {
+        fs::remove(outFilePath);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+void printUsage()
+{
+    std::printf(usage_msg, scriptName);
+}
+void enableLZ4(const char*)
+{
+    useLZ4 = true;
+}
+bool cookManifest(const fs::path& manifestPath, std::vector<CookedAsset>& out)
+{
+    std::ifstream manifest(manifestPath);
+    if(!manifest.is_open())
+    {
+        std::fprintf(stderr, "Could not open manifest: \"%s\"\n", manifestPath.c_str());
+        return false;
+    }
+    fs::path baseDir = manifestPath.parent_path();
+
+    std::string line;
+    uint lineCount = 0;
+    while(std::getline(manifest, line))
+    {
+        ++lineCount;
+        line = line.substr(0, line.find('#'));
+        std::istringstream words(line);
+        std::string kind, name, file;
+        if(!(words >> kind))
+            continue; // empty line
+        if(!(words >> name >> file))
+        {
+            std::fprintf(stderr, "Malformed manifest line %s:%u\n", manifestPath.c_str(), lineCount);
+            return false;
+        }
+        if(name.size() >= render::ASSET_NAME_MAX)
+        {
+            std::fprintf(stderr, "Asset name too long: \"%s\" at %s:%u\n", name.c_str(), manifestPath.c_str(), lineCount);
+            return false;
+        }
+        for(const CookedAsset& asset : out)
+            if(name == asset.entry.name)
+            {
+                std::fprintf(stderr, "Duplicate asset name: \"%s\" at %s:%u\n", name.c_str(), manifestPath.c_str(), lineCount);
+                return false;
+            }
+
+        CookedAsset& asset = out.emplace_back();
+        std::strncpy(asset.entry.name, name.c_str(), render::ASSET_NAME_MAX - 1);
+        bool status;
+        if(kind == "texture")
+        {
+            int channels = 0;
+            std::string type = "u8";
+            words >> channels >> type;
+            AssetCompType compType;
+            if(type == "u8") compType = AssetCompType::UNSIGNED_BYTE;
+            else if(type == "u16") compType = AssetCompType::UNSIGNED_SHORT;
+            else if(type == "f16") compType = AssetCompType::HALF_FLOAT;
+            else if(type == "f32") compType = AssetCompType::FLOAT;
+            else
+            {
+                std::fprintf(stderr, "Unknown component type \"%s\" at %s:%u\n", type.c_str(), manifestPath.c_str(), lineCount);
+                return false;
+            }
+            status = cookTexture(baseDir / file, channels, compType, asset);
+        }
+        else if(kind == "mesh")
+            status = cookMesh(baseDir / file, asset);
+        else if(kind == "orm")
+        {
+            std::string roughness, metallic;
+            if(!(words >> roughness >> metallic))
+            {
+                std::fprintf(stderr, "ORM texture requires 3 paths at %s:%u\n", manifestPath.c_str(), lineCount);
+                return false;
+            }
+            fs::path paths[3];
+            const std::string* files[3] = {&file, &roughness, &metallic};
+            for(int i = 0; i < 3; i++)
+                if(*files[i] != "-")
+                    paths[i] = baseDir / *files[i];
+            status = cookORM(paths, asset);
+        }
+        else
+        {
+            std::fprintf(stderr, "Unknown asset kind \"%s\" at %s:%u\n", kind.c_str(), manifestPath.c_str(), lineCount);
+            return false;
+        }
+        if(!status)
+        {
+            std::fprintf(stderr, "Required at %s:%u\n", manifestPath.c_str(), lineCount);
+            return false;
+        }
+    }
+    return true;
+}
+bool cookTexture(const fs::path& path, int channels, AssetCompType compType, CookedAsset& out)
+{
+    int w, h, comp_n;
+    void* pixels = nullptr;
+    size_t compSize = 0;
+    switch(compType)
+    {
+        case AssetCompType::UNSIGNED_BYTE:
+            pixels = stbi_load(path.c_str(), &w, &h, &comp_n, channels);
+            compSize = sizeof(stbi_uc);
+            break;
+        case AssetCompType::UNSIGNED_SHORT:
+            pixels = stbi_load_16(path.c_str(), &w, &h, &comp_n, channels);
+            compSize = sizeof(stbi_us);
+            break;
+        case AssetCompType::HALF_FLOAT:
+        case AssetCompType::FLOAT:
+            pixels = stbi_loadf(path.c_str(), &w, &h, &comp_n, channels);
+            compSize = sizeof(float);
+            break;
+    }
+    if(!pixels)
+    {
+        std::fprintf(stderr, "Failed to load image \"%s\": %s\n", path.c_str(), stbi_failure_reason());
+        return false;
+    }
+    if(channels)
+        comp_n = channels;
+
+    out.entry.type = AssetType::TEXTURE_2D;
+    out.entry.texture = {(uint32_t)w, (uint32_t)h, (uint32_t)comp_n, compType};
+    std::vector<uint8_t>& stream = out.streams[render::PIXEL_STREAM];
+    size_t count = (size_t)w * h * comp_n;
+    if(compType == AssetCompType::HALF_FLOAT)
+    {
+        stream.resize(count * sizeof(uint16_t));
+        render::FloatToHalf((uint16_t*)stream.data(), (const float*)pixels, count);
+    }
+    else
+        stream.assign((uint8_t*)pixels, (uint8_t*)pixels + count * compSize);
+    stbi_image_free(pixels);
+    return true;
+}
+bool cookORM(const fs::path (&paths)[3], CookedAsset& out)
+{
+    stbi_uc* maps[3] = {};
+    int w = 0, h = 0;
+    bool status = true;
+    for(int i = 0; i < 3 && status; i++)
+    {
+        if(paths[i].empty())
+            continue;
+        int mw, mh, comp_n;
+        maps[i] = stbi_load(paths[i].c_str(), &mw, &mh, &comp_n, 1);
+        if(!maps[i])
+        {
+            std::fprintf(stderr, "Failed to load image \"%s\": %s\n", paths[i].c_str(), stbi_failure_reason());
+            status = false;
+        }
+        else if(w && (mw != w || mh != h))
+        {
+            std::fprintf(stderr, "ORM channel \"%s\" differs in size from previous channels\n", paths[i].c_str());
+            status = false;
+        }
+        w = mw;
+        h = mh;
+    }
+    if(status && !w)
+    {
+        std::fputs("ORM texture needs at least one channel\n", stderr);
+        status = false;
+    }
+    if(status)
+    {
+        render::ChannelSource<stbi_uc> sources[3];
+        for(int i = 0; i < 3; i++)
+            sources[i].data = maps[i];
+        out.entry.type = AssetType::TEXTURE_2D;
+        out.entry.texture = {(uint32_t)w, (uint32_t)h, 3u, AssetCompType::UNSIGNED_BYTE};
+        std::vector<uint8_t>& stream = out.streams[render::PIXEL_STREAM];
+        stream.resize((size_t)w * h * 3);
+        render::InterleaveChannels<stbi_uc>(stream.data(), sources, 3, (size_t)w * h, 0xFF);
+    }
+    for(stbi_uc* map : maps)
+        stbi_image_free(map);
+    return status;
+}
+template<typename T>
+void assignStream(std::vector<uint8_t>& stream, const std::vector<T>& data)
+{
+    stream.assign((const uint8_t*)data.data(), (const uint8_t*)(data.data() + data.size()));
+}
+bool cookMesh(const fs::path& path, CookedAsset& out)
+{
+    // Wavefront OBJ subset: v, vt, vn and polygonal f, polygons are triangulated as fans
+    std::ifstream file(path);
+    if(!file.is_open())
+    {
+        std::fprintf(stderr, "Could not open a file: \"%s\"\n", path.c_str());
+        return false;
+    }
+    struct Float3 { float x, y, z; };
+    struct Float2 { float x, y; };
+    std::vector<Float3> objPositions, objNormals;
+    std::vector<Float2> objUVs;
+    std::vector<Float3> positions, normals;
+    std::vector<Float2> UVs;
+    std::vector<uint32_t> elements;
+    std::unordered_map<std::string, uint32_t> vertexMap; // "v/vt/vn" -> index
+
+    auto resolve = [](long idx, size_t count) -> long
+    {
+        return idx < 0 ? (long)count + idx : idx - 1;
+    };
+
+    std::string line;
+    uint lineCount = 0;
+    while(std::getline(file, line))
+    {
+        ++lineCount;
+        std::istringstream words(line);
+        std::string kind;
+        words >> kind;
+        if(kind == "v")
+        {
+            Float3 &p = objPositions.emplace_back();
+            words >> p.x >> p.y >> p.z;
+        }
+        else if(kind == "vt")
+        {
+            Float2 &uv = objUVs.emplace_back();
+            words >> uv.x >> uv.y;
+        }
+        else if(kind == "vn")
+        {
+            Float3 &n = objNormals.emplace_back();
+            words >> n.x >> n.y >> n.z;
+        }
+        else if(kind == "f")
+        {
+            std::vector<uint32_t> polygon;
+            std::string vertex;
+            while(words >> vertex)
+            {
+                auto [it, inserted] = vertexMap.try_emplace(vertex, (uint32_t)positions.size());
+                polygon.push_back(it->second);
+                if(!inserted)
+                    continue;
+
+                long v = 0, vt = 0, vn = 0;
+                std::sscanf(vertex.c_str(), "%ld", &v);
+                size_t slash = vertex.find('/');
+                if(slash != std::string::npos)
+                {
+                    std::sscanf(vertex.c_str() + slash + 1, "%ld", &vt);
+                    size_t slash2 = vertex.find('/', slash + 1);
+                    if(slash2 != std::string::npos)
+                        std::sscanf(vertex.c_str() + slash2 + 1, "%ld", &vn);
+                }
+                long vi = resolve(v, objPositions.size());
+                long vti = vt ? resolve(vt, objUVs.size()) : -1;
+                long vni = vn ? resolve(vn, objNormals.size()) : -1;
+                if(vi < 0 || vi >= (long)objPositions.size() ||
+                   vti >= (long)objUVs.size() || vni >= (long)objNormals.size() || (vt && vti < 0) || (vn && vni < 0))
+                {
+                    std::fprintf(stderr, "Invalid face index at %s:%u\n", path.c_str(), lineCount);
+                    return false;
+                }
+                positions.push_back(objPositions[vi]);
+                UVs.push_back(vti >= 0 ? objUVs[vti] : Float2{0.f, 0.f});
+                normals.push_back(vni >= 0 ? objNormals[vni] : Float3{0.f, 0.f, 0.f});
+            }
+            for(size_t i = 2; i < polygon.size(); i++)
+            {
+                elements.push_back(polygon[0]);
+                elements.push_back(polygon[i - 1]);
+                elements.push_back(polygon[i]);
+            }
+        }
+    }
+    if(positions.empty())
+    {
+        std::fprintf(stderr, "Mesh has no faces: \"%s\"\n", path.c_str());
+        return false;
+    }
+
+    out.entry.type = AssetType::MESH;
+    out.entry.mesh = {(uint32_t)positions.size(), (uint32_t)elements.size()};
+    assignStream(out.streams[render::POSITION_STREAM], positions);
+    if(!objUVs.empty())
+        assignStream(out.streams[render::UV_STREAM], UVs);
+    if(!objNormals.empty())
+        assignStream(out.streams[render::NORMAL_STREAM], normals);
+    assignStream(out.streams[render::ELEMENT_STREAM], elements);
+    return true;
+}
+bool writeArchive(const fs::path& path, std::vector<CookedAsset>& assets)
+{
+    // compress and lay out streams, every asset starts at an aligned boundary
+
+    AssetArchiveHeader header;
+    header.entryCount = (uint32_t)assets.size();
+    uint64_t offset = header.tocOffset + assets.size() * sizeof(AssetArchiveEntry);
+    uint64_t rawTotal = 0;
+    for(CookedAsset& asset : assets)
+    {
+        offset = render::AlignUp(offset, render::ASSET_ARCHIVE_ALIGNMENT);
+        for(uint32_t s = 0; s < render::ASSET_MAX_STREAMS; s++)
+        {
+            std::vector<uint8_t>& data = asset.streams[s];
+            if(data.empty())
+                continue;
+            render::AssetArchiveStream& stream = asset.entry.streams[s];
+            stream.rawSize = data.size();
+            rawTotal += data.size();
+            if(useLZ4)
+            {
+                std::vector<uint8_t> compressed(render::lz4::CompressBound(data.size()));
+                size_t size = render::lz4::CompressBlock(data.data(), data.size(), compressed.data(), compressed.size());
+                if(size && size < data.size())
+                {
+                    compressed.resize(size);
+                    data = std::move(compressed);
+                }
+            }
+            offset = render::AlignUp(offset, render::ASSET_ARCHIVE_STREAM_ALIGNMENT);
+            stream.offset = offset;
+            stream.storedSize = data.size();
+            offset += data.size();
+        }
+    }
+
+    // writing
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if(!out.is_open())
+    {
+        std::fprintf(stderr, "Failed opening output file: %s\n", path.c_str());
+        return false;
+    }
+    out.write((const char*)&header, sizeof(header));
+    for(const CookedAsset& asset : assets)
+        out.write((const char*)&asset.entry, sizeof(asset.entry));
+
+    const std::vector<char> padding(render::ASSET_ARCHIVE_ALIGNMENT, '\0');
+    for(const CookedAsset& asset : assets)
+        for(uint32_t s = 0; s < render::ASSET_MAX_STREAMS; s++)
+        {
+            const std::vector<uint8_t>& data = asset.streams[s];
+            if(data.empty())
+                continue;
+            out.write(padding.data(), asset.entry.streams[s].offset - (uint64_t)out.tellp());
+            out.write((const char*)data.data(), data.size());
+        }
+    out.close();
+    if(!out)
+    {
+        std::fprintf(stderr, "Failed writing output file: %s\n", path.c_str());
+        return false;
+    }
+    std::printf("Cooked %zu assets into %s (%lu bytes of data, %lu bytes archive)\n",
+                assets.size(), path.c_str(), rawTotal, offset);
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+.PHONY: asset_cook
+
+ASSET_COOK_OBJ:=$(patsubst %.cpp,$(OBJ)%.o,$(wildcard ./asset_cook/*.cpp))
+ASSET_COOK_EXEC:=$(OUT)asset_cook/asset_cook
+
+asset_cook: $(ASSET_COOK_EXEC)
+
+$(ASSET_COOK_EXEC): $(ASSET_COOK_OBJ) ./asset_cook/asset_cook.mk
+	@mkdir -p $(OUT)asset_cook/
+	@echo "Linking $(ASSET_COOK_EXEC)..."
+	g++ -o $@ $(ASSET_COOK_OBJ)
+
+-include $(wildcard $(DEP)asset_cook/*.d)
\ No newline at end of file
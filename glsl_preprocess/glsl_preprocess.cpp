@@ -2,34 +2,102 @@
 #include <filesystem>
 #include <vector>
 #include <cstdlib>
-#include <unordered_set>
 #include <unordered_map>
 #include <string>
+#include <string_view>
 #include <cstring>
-#include <regex>
+#include <cctype>
+#include <algorithm>
 #include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <atomic>
+
+#include "renderer/headers/lz4.hpp"
 
 namespace fs = std::filesystem;
 
+struct Job
+{
+    fs::path source, output;
+    std::string defines; // "#define" lines, -D flags on the command line followed by the job's own
+};
+struct SourceFile
+{
+    fs::path path; // canonical, identifies the file in include chains
+    std::string text;
+};
+enum class Directive
+{
+    NONE,
+    INCLUDE,
+    VERSION
+};
+
 void printUsage();
-bool textFromFile(const char* const path, std::string& out);
-bool preprocessGLSL(fs::path path, std::ofstream& out, std::unordered_set<fs::path> pastIncludes = {}, fs::path prevPath = {});
+bool textFromFile(const fs::path& path, std::string& out);
+bool readBatchFile(const char* path, std::vector<Job>& jobs);
+bool runJob(const Job& job, std::string& out);
+bool writeArchive(const fs::path& path, const std::vector<Job>& jobs, const std::vector<std::string>& outputs);
+bool preprocessGLSL(const SourceFile& file, const fs::path& displayPath, const std::string& defines, std::string& out, std::vector<const SourceFile*>& includeChain);
+std::shared_ptr<const SourceFile> loadSource(const fs::path& path);
+std::shared_ptr<const SourceFile> findInclude(const fs::path& includingFile, const std::string& name);
+Directive scanDirective(std::string_view line, std::string_view& argument);
+bool writeIfChanged(const fs::path& path, const std::string& text, bool& changed);
 void addIncludeDir(const char* dir);
+void addDefine(const char* define);
+void setBatchFile(const char* path);
+void setThreadCount(const char* count);
+void setArchiveFile(const char* path);
+void enableCompression(const char* unused);
+void appendDefine(std::string& defines, std::string_view define);
 
 const char* const usage_msg = R"usage(
-Usage: %s <source file path> <out file path>
+Usage: %s [flags] <source file path> <out file path>
+       %s [flags] -batch <batch file path>
 
 Flags:
     -I <dir> -> Add a directory to the list of directories to be searched for included files.
+    -D <name>[=<value>] -> Define a macro right after the #version directive of the source file.
+    -batch <file> -> Preprocess every job listed in file, one job per line:
+                     <source file path> <out file path> [-D <name>[=<value>]]...
+                     empty lines and lines starting with # are ignored.
+    -j <count> -> Number of files processed in parallel, defaults to the number of hardware threads.
+    -archive <file> -> Also write a C++ translation unit defining render::builtin_shader_archive
+                       (renderer/headers/shader_archive.hpp) with every output, named by its file name.
+    -lz4 -> LZ4 compress shaders in the archive when it makes them smaller.
+
+Output files are only written when their content changes.
 )usage";
 
 std::vector<fs::path> includeDirs;
+std::string defines; // "#define" lines for -D flags
+const char* batchFilePath = nullptr;
+const char* archiveFilePath = nullptr;
+bool compressArchive = false;
+unsigned int threadCount = 0;
 const char* scriptName = nullptr;
 
+// Files and include lookups are cached for the whole run, so every header is read
+// and resolved once no matter how many sources include it
+std::mutex sourceCacheMutex;
+std::unordered_map<std::string, std::shared_ptr<const SourceFile>> sourceCache;  // canonical path -> file
+std::unordered_map<std::string, std::shared_ptr<const SourceFile>> includeCache; // including dir + '\n' + name -> file
+
 using FlagHandler_p = void(*)(const char*);
 
 const std::unordered_map<std::string, FlagHandler_p> flagMap{
-    std::pair<std::string, FlagHandler_p>("-I", addIncludeDir)
+    std::pair<std::string, FlagHandler_p>("-I", addIncludeDir),
+    std::pair<std::string, FlagHandler_p>("-D", addDefine),
+    std::pair<std::string, FlagHandler_p>("-batch", setBatchFile),
+    std::pair<std::string, FlagHandler_p>("-j", setThreadCount),
+    std::pair<std::string, FlagHandler_p>("-archive", setArchiveFile)
+};
+// flags without a value
+const std::unordered_map<std::string, FlagHandler_p> switchMap{
+    std::pair<std::string, FlagHandler_p>("-lz4", enableCompression)
 };
 
 int main(int argc, const char* argv[])
@@ -37,12 +105,14 @@ int main(int argc, const char* argv[])
     // get data from args
 
     scriptName = argv[0];
-    
+
     fs::path sourceFilePath, outFilePath;
 
     for(int i = 1; i < argc; i++)
     {
-        if(flagMap.contains(argv[i]))
+        if(switchMap.contains(argv[i]))
+            switchMap.at(argv[i])(nullptr);
+        else if(flagMap.contains(argv[i]))
             if(i+1 < argc)
             {
                 flagMap.at(argv[i])(argv[i+1]);
@@ -50,8 +120,8 @@ int main(int argc, const char* argv[])
             }
             else
             {
-                std::fputs("Directory not provided for -I flag!\n", stderr);
-                std::printf(usage_msg, argv[0]);
+                std::fprintf(stderr, "Value not provided for %s flag!\n", argv[i]);
+                printUsage();
                 return EXIT_FAILURE;
             }
         else if(sourceFilePath.empty())
@@ -65,152 +135,456 @@ int main(int argc, const char* argv[])
         else
         {
             std::fprintf(stderr, "Invalid argument provided: %s\n", argv[i]);
-            std::puts(usage_msg);
+            printUsage();
             return EXIT_FAILURE;
         }
     }
-    if(sourceFilePath.empty())
-    {
-        std::fputs("No source file directory provided!\n", stderr);
-        printUsage();
-        return EXIT_FAILURE;
-    }
-    if(outFilePath.empty())
-    {
-        std::fputs("No output file directory provided!\n", stderr);
-        printUsage();
-        return EXIT_FAILURE;
-    }
-    if(sourceFilePath == outFilePath)
-    {
-        std::fputs("Output file cannot be the same as source file\n", stderr);
-        return EXIT_FAILURE;
-    }
 
-    // opening output file
-    
-    if(!outFilePath.parent_path().empty())
+    std::vector<Job> jobs;
+    if(batchFilePath)
     {
-        std::puts(outFilePath.parent_path().c_str());
-        //fs::create_directories(outFilePath.parent_path());
+        if(!sourceFilePath.empty())
+        {
+            std::fputs("Source and output files cannot be provided together with -batch!\n", stderr);
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        if(!readBatchFile(batchFilePath, jobs))
+            return EXIT_FAILURE;
     }
-    
-    std::ofstream outFile(outFilePath);
-    if(!outFile.is_open())
+    else
     {
-        std::fprintf(stderr, "Failed opening output file: %s\n", outFilePath.c_str());
-        return EXIT_FAILURE;
+        if(sourceFilePath.empty())
+        {
+            std::fputs("No source file directory provided!\n", stderr);
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        if(outFilePath.empty())
+        {
+            std::fputs("No output file directory provided!\n", stderr);
+            printUsage();
+            return EXIT_FAILURE;
+        }
+        jobs.push_back(Job{sourceFilePath, outFilePath, defines});
     }
 
     // processing
 
-    bool preprocessStatus = preprocessGLSL(sourceFilePath, outFile);
-    
-    outFile.close();
+    unsigned int workerCount = threadCount ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+    workerCount = std::min<size_t>(workerCount, jobs.size());
 
-    if(!preprocessStatus)
+    std::vector<std::string> outputs(jobs.size());
+    std::atomic<size_t> nextJob = 0;
+    std::atomic<bool> failed = false;
+    auto worker = [&]()
     {
-        fs::remove(outFilePath);
-        return EXIT_FAILURE;
-    }
+        for(size_t i = nextJob++; i < jobs.size(); i = nextJob++)
+            if(!runJob(jobs[i], outputs[i]))
+                failed = true;
+    };
+    std::vector<std::thread> workers;
+    for(unsigned int i = 1; i < workerCount; i++)
+        workers.emplace_back(worker);
+    worker();
+    for(std::thread &thread : workers)
+        thread.join();
 
-    return EXIT_SUCCESS;    
+    if(failed)
+        return EXIT_FAILURE;
+    if(archiveFilePath && !writeArchive(archiveFilePath, jobs, outputs))
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
 }
 void printUsage()
 {
-    std::printf(usage_msg, scriptName);
+    std::printf(usage_msg, scriptName, scriptName);
 }
-bool preprocessGLSL(fs::path path, std::ofstream& out, std::unordered_set<fs::path> pastIncludes, fs::path prevPath)
+bool readBatchFile(const char* path, std::vector<Job>& jobs)
 {
-    fs::path filePath = path;
+    std::string text;
+    if(!textFromFile(path, text))
+    {
+        std::fprintf(stderr, "Could not open a batch file: \"%s\"\n", path);
+        return false;
+    }
+    uint lineCount = 0;
+    size_t lineStart = 0;
+    while(lineStart < text.size())
+    {
+        size_t lineEnd = text.find('\n', lineStart);
+        if(lineEnd == std::string::npos)
+            lineEnd = text.size();
+        std::string_view line(text.data() + lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+        ++lineCount;
 
-    // locating correct file
+        std::vector<std::string_view> tokens;
+        for(size_t i = 0; i < line.size();)
+        {
+            while(i < line.size() && std::isspace((unsigned char)line[i]))
+                ++i;
+            size_t tokenStart = i;
+            while(i < line.size() && !std::isspace((unsigned char)line[i]))
+                ++i;
+            if(i > tokenStart)
+                tokens.push_back(line.substr(tokenStart, i - tokenStart));
+        }
+        if(tokens.empty() || tokens[0][0] == '#')
+            continue;
 
-    fs::path foundFilePath;
+        Job job{tokens.size() > 0 ? fs::path(tokens[0]) : fs::path(), tokens.size() > 1 ? fs::path(tokens[1]) : fs::path(), defines};
+        bool valid = tokens.size() >= 2;
+        for(size_t i = 2; valid && i < tokens.size(); i += 2)
+        {
+            valid = tokens[i] == "-D" && i + 1 < tokens.size();
+            if(valid)
+                appendDefine(job.defines, tokens[i + 1]);
+        }
+        if(!valid)
+        {
+            std::fprintf(stderr, "Invalid job at %s:%u, expected: <source file path> <out file path> [-D <name>[=<value>]]...\n", path, lineCount);
+            return false;
+        }
+        jobs.push_back(std::move(job));
+    }
+    return true;
+}
+bool runJob(const Job& job, std::string& out)
+{
+    if(job.source == job.output)
+    {
+        std::fprintf(stderr, "Output file cannot be the same as source file: %s\n", job.source.c_str());
+        return false;
+    }
+    if(!fs::exists(job.source))
+    {
+        std::fprintf(stderr, "File \"%s\" does not exist\n", job.source.c_str());
+        return false;
+    }
+    if(fs::is_directory(job.source))
+    {
+        std::fprintf(stderr, "File \"%s\" is a directory\n", job.source.c_str());
+        return false;
+    }
+    std::shared_ptr<const SourceFile> source = loadSource(job.source);
+    if(!source)
+    {
+        std::fprintf(stderr, "Could not open a file: \"%s\"\n", job.source.c_str());
+        return false;
+    }
 
-    if(prevPath.empty()) // if this is the original file we want to preprocess, we skip some checks and don't look for it in include dirs
+    out.reserve(source->text.size() * 2);
+    std::vector<const SourceFile*> includeChain;
+    if(!preprocessGLSL(*source, job.source, job.defines, out, includeChain))
     {
-        if(!fs::exists(filePath))
+        std::error_code error;
+        fs::remove(job.output, error); // don't leave stale output behind
+        return false;
+    }
+
+    bool changed = false;
+    if(!writeIfChanged(job.output, out, changed))
+    {
+        std::fprintf(stderr, "Failed writing output file: %s\n", job.output.c_str());
+        return false;
+    }
+    if(changed)
+        std::printf("Preprocessed %s\n", job.output.c_str());
+    return true;
+}
+// Appends file to out with includes expanded. defines are written right after #version,
+// or before the first line when the file has none; they are empty for included files.
+bool preprocessGLSL(const SourceFile& file, const fs::path& displayPath, const std::string& defines, std::string& out, std::vector<const SourceFile*>& includeChain)
+{
+    for(const SourceFile* included : includeChain)
+        if(included->path == file.path)
         {
-            std::fprintf(stderr, "File \"%s\" does not exist\n", path.c_str());
+            std::fprintf(stderr, "Cyclic include detected: %s!\n", displayPath.c_str());
             return false;
         }
-        if(fs::is_directory(filePath))
+    includeChain.push_back(&file);
+
+    bool writeDefines = !defines.empty();
+    if(writeDefines)
+    {
+        std::string_view argument;
+        bool hasVersion = false;
+        for(size_t lineStart = 0; lineStart < file.text.size() && !hasVersion;)
+        {
+            size_t lineEnd = std::min(file.text.find('\n', lineStart), file.text.size());
+            hasVersion = scanDirective(std::string_view(file.text).substr(lineStart, lineEnd - lineStart), argument) == Directive::VERSION;
+            lineStart = lineEnd + 1;
+        }
+        if(!hasVersion)
         {
-            std::fprintf(stderr, "File \"%s\" is a directory\n", path.c_str());
-            return false;
+            out += defines;
+            writeDefines = false;
         }
-        foundFilePath = filePath;
     }
-    else
+
+    const std::string& text = file.text;
+    uint lineCount = 1;
+    for(size_t lineStart = 0; lineStart < text.size(); ++lineCount)
     {
-        std::vector dirsToCheck = {prevPath.parent_path()};
-        dirsToCheck.insert(dirsToCheck.end(), includeDirs.begin(), includeDirs.end());
-        dirsToCheck.push_back("./");
-        for(fs::path dir : dirsToCheck)
+        size_t lineEnd = text.find('\n', lineStart);
+        if(lineEnd == std::string::npos)
+            lineEnd = text.size();
+        std::string_view line(text.data() + lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+
+        std::string_view argument;
+        Directive directive = scanDirective(line, argument);
+        if(directive == Directive::INCLUDE)
         {
-            fs::path checkPath = dir / filePath;
-            if(fs::exists(checkPath) && !fs::is_directory(checkPath))
+            std::string includeName(argument);
+            std::shared_ptr<const SourceFile> included = findInclude(file.path, includeName);
+            if(!included)
+            {
+                std::fprintf(stderr, "File to include not found: \"%s\"\n", includeName.c_str());
+                std::fprintf(stderr, "Required at %s:%u\n", displayPath.c_str(), lineCount);
+                return false;
+            }
+            if(!preprocessGLSL(*included, includeName, {}, out, includeChain))
             {
-                foundFilePath = checkPath;
-                break;
+                std::fprintf(stderr, "Required at %s:%u\n", displayPath.c_str(), lineCount);
+                return false;
             }
+            continue;
         }
-        if(foundFilePath.empty())
+        out.append(line);
+        out += '\n';
+        if(writeDefines && directive == Directive::VERSION)
         {
-            std::fprintf(stderr, "File to include not found: \"%s\"\n", path.c_str());
-            return false;
+            out += defines;
+            writeDefines = false;
         }
-        if(pastIncludes.contains(fs::canonical(foundFilePath)))
+    }
+    includeChain.pop_back();
+    return true;
+}
+// Recognizes `#include "<argument>"` and `#version`, whitespace is allowed around '#'
+Directive scanDirective(std::string_view line, std::string_view& argument)
+{
+    size_t i = 0;
+    auto skipSpace = [&]()
+    {
+        while(i < line.size() && (line[i] == ' ' || line[i] == '\t' || line[i] == '\r'))
+            ++i;
+    };
+    skipSpace();
+    if(i >= line.size() || line[i] != '#')
+        return Directive::NONE;
+    ++i;
+    skipSpace();
+    std::string_view rest = line.substr(i);
+    auto keyword = [&](std::string_view word)
+    {
+        return rest.starts_with(word) && (rest.size() == word.size() || (!std::isalnum((unsigned char)rest[word.size()]) && rest[word.size()] != '_'));
+    };
+    if(keyword("version"))
+        return Directive::VERSION;
+    if(!keyword("include"))
+        return Directive::NONE;
+    i += std::strlen("include");
+    skipSpace();
+    if(i >= line.size() || line[i] != '"')
+        return Directive::NONE;
+    size_t nameEnd = line.find('"', i + 1);
+    if(nameEnd == std::string_view::npos || nameEnd == i + 1)
+        return Directive::NONE;
+    argument = line.substr(i + 1, nameEnd - i - 1);
+    return Directive::INCLUDE;
+}
+std::shared_ptr<const SourceFile> loadSource(const fs::path& path)
+{
+    std::error_code error;
+    fs::path canonicalPath = fs::canonical(path, error);
+    if(error)
+        return nullptr;
+    {
+        std::lock_guard lock(sourceCacheMutex);
+        auto it = sourceCache.find(canonicalPath.string());
+        if(it != sourceCache.end())
+            return it->second;
+    }
+    auto file = std::make_shared<SourceFile>();
+    file->path = canonicalPath;
+    if(!textFromFile(canonicalPath, file->text))
+        return nullptr;
+    std::lock_guard lock(sourceCacheMutex);
+    return sourceCache.emplace(canonicalPath.string(), file).first->second; // another thread may have been faster
+}
+// Searches the directory of the including file, then -I directories, then the working directory
+std::shared_ptr<const SourceFile> findInclude(const fs::path& includingFile, const std::string& name)
+{
+    fs::path includingDir = includingFile.parent_path();
+    std::string key = includingDir.string() + '\n' + name;
+    {
+        std::lock_guard lock(sourceCacheMutex);
+        auto it = includeCache.find(key);
+        if(it != includeCache.end())
+            return it->second;
+    }
+    std::vector<fs::path> dirsToCheck = {includingDir};
+    dirsToCheck.insert(dirsToCheck.end(), includeDirs.begin(), includeDirs.end());
+    dirsToCheck.push_back("./");
+    std::shared_ptr<const SourceFile> found;
+    for(const fs::path &dir : dirsToCheck)
+    {
+        fs::path checkPath = dir / name;
+        std::error_code error;
+        if(fs::is_regular_file(checkPath, error))
         {
-            std::fprintf(stderr, "Cyclic include detected: %s!\n", path.c_str());
-            return false;
+            found = loadSource(checkPath);
+            break;
         }
     }
-
-    pastIncludes.insert(fs::canonical(foundFilePath));
-
-    // opening a file
-
-    std::ifstream file(foundFilePath);
-    if (!file.is_open()) 
+    if(found)
     {
-        std::fprintf(stderr, "Could not open a file: \"%s\"\n", path.c_str());
-        return false;
+        std::lock_guard lock(sourceCacheMutex);
+        includeCache.emplace(key, found);
     }
-    // processing a file
-
-    std::regex include_formula(R"regex(^\s*#include\s+"(.+?)")regex");
-
-    std::string line;
+    return found;
+}
+bool writeArchive(const fs::path& path, const std::vector<Job>& jobs, const std::vector<std::string>& outputs)
+{
+    std::vector<size_t> order(jobs.size());
+    for(size_t i = 0; i < order.size(); i++)
+        order[i] = i;
+    auto name = [&](size_t i)
+    {
+        return jobs[i].output.filename().string();
+    };
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return name(a) < name(b); }); // ShaderArchive::Find is a binary search
+    for(size_t i = 1; i < order.size(); i++)
+        if(name(order[i - 1]) == name(order[i]))
+        {
+            std::fprintf(stderr, "Archive cannot contain two shaders named %s\n", name(order[i]).c_str());
+            return false;
+        }
 
-    uint lineCount = 1;
-    while (std::getline(file, line)) {
-        std::smatch match;
-        if (std::regex_search(line, match, include_formula)) 
+    std::string text = "// Generated by glsl_preprocess, do not edit\n"
+                       "#include \"renderer/headers/shader_archive.hpp\"\n\n"
+                       "namespace render\n{\n    namespace\n    {\n";
+    std::string entries;
+    std::vector<uint8_t> compressed;
+    char buffer[64];
+    for(size_t n = 0; n < order.size(); n++)
+    {
+        const std::string& source = outputs[order[n]];
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(source.data());
+        size_t storedSize = source.size();
+        if(compressArchive)
         {
-            fs::path includePath = match[1].str();
-            if(!preprocessGLSL(includePath, out, pastIncludes, foundFilePath))
+            compressed.resize(render::lz4::CompressBound(source.size()));
+            size_t compressedSize = render::lz4::CompressBlock(data, source.size(), compressed.data(), compressed.size());
+            if(compressedSize && compressedSize < source.size())
             {
-                std::fprintf(stderr, "Required at %s:%u\n", path.c_str(), lineCount);
-                return false;
+                data = compressed.data();
+                storedSize = compressedSize;
             }
-        } 
-        else 
+        }
+        std::snprintf(buffer, sizeof(buffer), "        constexpr uint8_t shader_%zu[] = {", n);
+        text += buffer;
+        for(size_t i = 0; i < storedSize; i++)
         {
-            out << line << "\n";
+            std::snprintf(buffer, sizeof(buffer), i % 16 ? " 0x%02x," : "\n            0x%02x,", data[i]);
+            text += buffer;
         }
-        ++lineCount;
+        text += storedSize ? "\n        };\n" : " 0 };\n";
+        std::snprintf(buffer, sizeof(buffer), ", shader_%zu, %zu, %zu },\n", n, storedSize, source.size());
+        entries += "        { \"" + name(order[n]) + "\"" + buffer;
+    }
+    text += "    }\n    constexpr ShaderArchiveEntry builtin_shader_entries[] = {\n" + entries + "    };\n";
+    std::snprintf(buffer, sizeof(buffer), "%zu", order.size());
+    text += "    extern const ShaderArchive builtin_shader_archive{builtin_shader_entries, " + std::string(buffer) + "};\n}";
+
+    bool changed = false;
+    if(!writeIfChanged(path, text, changed))
+    {
+        std::fprintf(stderr, "Failed writing archive file: %s\n", path.c_str());
+        return false;
+    }
+    if(changed)
+        std::printf("Archived %zu shaders in %s\n", order.size(), path.c_str());
+    return true;
+}
+bool writeIfChanged(const fs::path& path, const std::string& text, bool& changed)
+{
+    std::string current;
+    changed = !textFromFile(path, current) || current != text;
+    if(!changed)
+        return true;
+
+    if(!path.parent_path().empty())
+    {
+        std::error_code error;
+        fs::create_directories(path.parent_path(), error);
     }
-    if(!file.eof())
+    // written under a temporary name and renamed, so readers never see partial files
+    fs::path tmpPath = path;
+    tmpPath += ".tmp";
+    std::ofstream outFile(tmpPath, std::ios::binary | std::ios::trunc);
+    if(!outFile.is_open() || !outFile.write(text.data(), text.size()))
+        return false;
+    outFile.close();
+    std::error_code error;
+    fs::rename(tmpPath, path, error);
+    if(error)
     {
-        std::fprintf(stderr, "Failed to read entire file: \"%s\"\n", path.c_str());
+        fs::remove(tmpPath, error);
         return false;
     }
-    file.close();
     return true;
 }
 void addIncludeDir(const char* dir)
 {
     includeDirs.push_back(dir);
+}
+void addDefine(const char* define)
+{
+    appendDefine(defines, define);
+}
+void appendDefine(std::string& defines, std::string_view define)
+{
+    std::string_view name = define, value;
+    size_t assign = name.find('=');
+    if(assign != std::string_view::npos)
+    {
+        value = name.substr(assign + 1);
+        name = name.substr(0, assign);
+    }
+    defines += "#define ";
+    defines += name;
+    if(!value.empty())
+    {
+        defines += ' ';
+        defines += value;
+    }
+    defines += '\n';
+}
+void setBatchFile(const char* path)
+{
+    batchFilePath = path;
+}
+void setArchiveFile(const char* path)
+{
+    archiveFilePath = path;
+}
+void enableCompression(const char*)
+{
+    compressArchive = true;
+}
+void setThreadCount(const char* count)
+{
+    threadCount = std::strtoul(count, nullptr, 10);
+}
+bool textFromFile(const fs::path& path, std::string& out)
+{
+    std::ifstream file(path, std::ios::binary);
+    if(!file.is_open())
+        return false;
+    out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
 }
\ No newline at end of file
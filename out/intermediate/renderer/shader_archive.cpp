@@ -0,0 +1,3607 @@
+// Generated by glsl_preprocess, do not edit
+#include "renderer/headers/shader_archive.hpp"
+
+namespace render
+{
+    namespace
+    {
+        constexpr uint8_t shader_0[] = {
+            0xf1, 0x19, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x23,
+            0x69, 0x66, 0x64, 0x65, 0x66, 0x20, 0x42, 0x52, 0x44, 0x46, 0x5f, 0x42, 0x49, 0x4e, 0x44, 0x4c,
+            0x45, 0x53, 0x53, 0x0a, 0x23, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x24, 0x00, 0xf0, 0x2a, 0x47, 0x4c,
+            0x5f, 0x41, 0x52, 0x42, 0x5f, 0x62, 0x69, 0x6e, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x65,
+            0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3a, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x0a,
+            0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73,
+            0x74, 0x64, 0x31, 0x34, 0x30, 0x2c, 0x20, 0x32, 0x00, 0xf2, 0x0b, 0x69, 0x6e, 0x67, 0x20, 0x3d,
+            0x20, 0x30, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e,
+            0x65, 0x72, 0x61, 0x6c, 0x55, 0x10, 0x00, 0xf0, 0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+            0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x69, 0x6e, 0x98, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65,
+            0x77, 0x3b, 0x17, 0x00, 0x0b, 0x0f, 0x00, 0xa2, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69,
+            0x6f, 0x6e, 0x24, 0x00, 0xc6, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c,
+            0x75, 0x16, 0x00, 0xf3, 0x39, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62,
+            0x69, 0x61, 0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61,
+            0x6e, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69,
+            0x7a, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74,
+            0x69, 0x6d, 0x65, 0x20, 0x62, 0x79, 0x20, 0x53, 0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xf0,
+            0x05, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x64, 0x65,
+            0x66, 0x69, 0x6e, 0x65, 0x73, 0x51, 0x00, 0xf1, 0x20, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f,
+            0x4d, 0x41, 0x53, 0x4b, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69,
+            0x76, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74,
+            0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x21, 0x00, 0x70, 0x6d, 0x65, 0x73, 0x68, 0x20,
+            0x62, 0x65, 0x1b, 0x01, 0x50, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x82, 0x01, 0x10, 0x6e, 0x83, 0x01,
+            0x07, 0x4d, 0x00, 0x22, 0x0a, 0x23, 0x65, 0x00, 0x08, 0x14, 0x00, 0x34, 0x20, 0x30, 0x75, 0x6b,
+            0x01, 0x0b, 0x1e, 0x00, 0xf8, 0x01, 0x45, 0x4e, 0x41, 0x42, 0x4c, 0x45, 0x44, 0x28, 0x69, 0x64,
+            0x78, 0x29, 0x20, 0x28, 0x28, 0x28, 0x35, 0x00, 0x31, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26,
+            0x20, 0x31, 0x75, 0x29, 0x20, 0x3d, 0x3d, 0x07, 0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e,
+            0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7,
+            0x01, 0x18, 0x3b, 0x18, 0x00, 0x53, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20,
+            0x2b, 0x28, 0x00, 0x09, 0x24, 0x00, 0x27, 0x55, 0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23,
+            0x00, 0x67, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00,
+            0x77, 0x54, 0x41, 0x4e, 0x47, 0x45, 0x4e, 0x54, 0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00,
+            0xf7, 0x03, 0x49, 0x4e, 0x53, 0x54, 0x41, 0x4e, 0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53,
+            0x46, 0x4f, 0x52, 0x4d, 0x34, 0x00, 0x07, 0x46, 0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e,
+            0x56, 0x45, 0x52, 0x53, 0x3d, 0x00, 0x3f, 0x34, 0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00,
+            0x03, 0x65, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00,
+            0x02, 0x09, 0x47, 0x00, 0x38, 0x4e, 0x45, 0x58, 0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00,
+            0x30, 0x3b, 0x0a, 0x0a, 0x5e, 0x02, 0x90, 0x77, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65,
+            0x7d, 0x01, 0x25, 0x2c, 0x20, 0xf5, 0x00, 0x2d, 0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e,
+            0x64, 0x20, 0x43, 0x00, 0xf3, 0x00, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e,
+            0x61, 0x62, 0x6c, 0x65, 0x64, 0xd6, 0x01, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31,
+            0x02, 0x24, 0x20, 0x3d, 0x60, 0x02, 0x03, 0x11, 0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44,
+            0x58, 0x29, 0xb4, 0x00, 0x01, 0x36, 0x00, 0x24, 0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02,
+            0xd0, 0x01, 0x0a, 0x30, 0x00, 0x03, 0xbf, 0x01, 0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d,
+            0x68, 0x00, 0x04, 0xc3, 0x01, 0x0f, 0x39, 0x00, 0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x0f,
+            0x72, 0x04, 0x07, 0x17, 0x31, 0x72, 0x04, 0x5b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x70, 0x04, 0xd0,
+            0x76, 0x65, 0x63, 0x33, 0x20, 0x61, 0x6d, 0x62, 0x69, 0x65, 0x6e, 0x74, 0x4c, 0x20, 0x00, 0x03,
+            0x4c, 0x04, 0x00, 0x11, 0x03, 0x52, 0x5f, 0x70, 0x61, 0x64, 0x31, 0x10, 0x00, 0x01, 0x27, 0x00,
+            0x01, 0x40, 0x00, 0x52, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x15, 0x00, 0x02, 0x5b, 0x04, 0x00, 0x26,
+            0x00, 0x12, 0x32, 0x11, 0x00, 0x01, 0x26, 0x00, 0x00, 0xa6, 0x04, 0x11, 0x5f, 0x2b, 0x00, 0x38,
+            0x44, 0x69, 0x72, 0xa0, 0x04, 0x06, 0x2f, 0x00, 0x12, 0x33, 0x2f, 0x00, 0x00, 0xb1, 0x04, 0xf1,
+            0x0e, 0x33, 0x20, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x3b,
+            0x20, 0x2f, 0x2f, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x78, 0x2c, 0x20, 0x79, 0xcc, 0x01,
+            0xf4, 0x0a, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x73, 0x2c, 0x20,
+            0x7a, 0x20, 0x69, 0x73, 0x20, 0x30, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x3a, 0x00, 0x31, 0x65, 0x64,
+            0x20, 0x6f, 0x00, 0x02, 0xcd, 0x04, 0x31, 0x6f, 0x66, 0x66, 0x32, 0x05, 0x02, 0x6e, 0x00, 0x04,
+            0x5d, 0x00, 0x01, 0x3f, 0x00, 0x62, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x7c, 0x00, 0x0f, 0x1f,
+            0x00, 0x01, 0x02, 0x21, 0x05, 0x00, 0x86, 0x05, 0x01, 0x10, 0x04, 0xf1, 0x05, 0x73, 0x68, 0x61,
+            0x64, 0x6f, 0x77, 0x5f, 0x63, 0x61, 0x73, 0x63, 0x61, 0x64, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e,
+            0x74, 0xa1, 0x00, 0x03, 0x7f, 0x00, 0x02, 0x20, 0x00, 0x06, 0x76, 0x00, 0x21, 0x7d, 0x3b, 0xac,
+            0x02, 0x14, 0x64, 0xf6, 0x00, 0x22, 0x61, 0x6c, 0x98, 0x00, 0x04, 0x29, 0x00, 0x72, 0x2c, 0x20,
+            0x73, 0x65, 0x65, 0x20, 0x43, 0x4f, 0x00, 0x10, 0x64, 0x56, 0x05, 0x63, 0x6f, 0x77, 0x4d, 0x61,
+            0x70, 0x73, 0x96, 0x02, 0x01, 0x74, 0x00, 0xff, 0x09, 0x4d, 0x41, 0x58, 0x5f, 0x53, 0x48, 0x41,
+            0x44, 0x4f, 0x57, 0x5f, 0x43, 0x41, 0x53, 0x43, 0x41, 0x44, 0x45, 0x53, 0x20, 0x3d, 0x20, 0x34,
+            0x3b, 0xe1, 0x01, 0x07, 0x17, 0x32, 0xe1, 0x01, 0x02, 0x69, 0x00, 0x0b, 0xe2, 0x01, 0x01, 0x52,
+            0x06, 0x02, 0x1a, 0x00, 0x50, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x48, 0x01, 0x1f, 0x5b, 0x68, 0x00,
+            0x00, 0x11, 0x5d, 0xdc, 0x00, 0x00, 0xbe, 0x01, 0x93, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20,
+            0x74, 0x6f, 0xba, 0x00, 0x54, 0x20, 0x6d, 0x61, 0x70, 0x20, 0xee, 0x06, 0x01, 0x1c, 0x00, 0x01,
+            0x62, 0x01, 0x43, 0x76, 0x65, 0x63, 0x34, 0x22, 0x00, 0x05, 0x25, 0x01, 0x61, 0x73, 0x70, 0x6c,
+            0x69, 0x74, 0x73, 0x4a, 0x00, 0x32, 0x66, 0x61, 0x72, 0x4e, 0x00, 0x02, 0xc1, 0x01, 0x83, 0x6f,
+            0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x4f, 0x01, 0x00, 0x88, 0x06, 0x00, 0xda, 0x03, 0x03,
+            0xa1, 0x01, 0x50, 0x65, 0x64, 0x20, 0x70, 0x6f, 0x74, 0x02, 0x00, 0xbe, 0x03, 0x42, 0x73, 0x70,
+            0x6f, 0x74, 0x3b, 0x01, 0x04, 0x34, 0x01, 0x02, 0x23, 0x02, 0x21, 0x65, 0x64, 0xa2, 0x02, 0xb1,
+            0x69, 0x6e, 0x67, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x10, 0x00, 0x43, 0x44, 0x61,
+            0x74, 0x61, 0x3e, 0x07, 0x06, 0x81, 0x02, 0x4c, 0x70, 0x6f, 0x73, 0x69, 0x05, 0x07, 0x43, 0x72,
+            0x61, 0x6e, 0x67, 0xff, 0x01, 0x01, 0x29, 0x00, 0x1c, 0x63, 0xcb, 0x02, 0x00, 0x79, 0x00, 0xa1,
+            0x5f, 0x63, 0x6f, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x65, 0x72, 0xc6, 0x00, 0xc3, 0x62, 0x65, 0x6c,
+            0x6f, 0x77, 0x20, 0x2d, 0x31, 0x20, 0x66, 0x6f, 0x72, 0xa3, 0x00, 0x02, 0x6d, 0x02, 0x04, 0x03,
+            0x01, 0x11, 0x33, 0xe5, 0x00, 0x15, 0x5f, 0xf6, 0x01, 0x08, 0x5f, 0x02, 0x05, 0x50, 0x00, 0x51,
+            0x69, 0x6e, 0x6e, 0x65, 0x72, 0x7c, 0x07, 0x06, 0x1b, 0x08, 0x29, 0x34, 0x33, 0x1b, 0x08, 0xf3,
+            0x05, 0x31, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66,
+            0x66, 0x65, 0x72, 0x20, 0x5f, 0x1d, 0x01, 0x01, 0xe6, 0x00, 0x04, 0x21, 0x08, 0x01, 0x0d, 0x00,
+            0x00, 0xf3, 0x00, 0x03, 0x22, 0x01, 0x2f, 0x5b, 0x5d, 0x58, 0x00, 0x0b, 0x1f, 0x32, 0x58, 0x00,
+            0x07, 0x04, 0x53, 0x00, 0x00, 0x88, 0x03, 0x14, 0x32, 0x4e, 0x03, 0x22, 0x73, 0x5b, 0x09, 0x02,
+            0xb4, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x1b, 0x00, 0x02, 0xd6,
+            0x03, 0x40, 0x5f, 0x69, 0x6e, 0x64, 0x44, 0x02, 0x12, 0x2c, 0x81, 0x00, 0x11, 0x20, 0x18, 0x03,
+            0x00, 0xcf, 0x01, 0x0f, 0xdb, 0x00, 0x06, 0x1f, 0x33, 0x83, 0x00, 0x07, 0x01, 0xce, 0x00, 0x12,
+            0x49, 0x51, 0x00, 0x03, 0xc4, 0x01, 0x01, 0x08, 0x03, 0x03, 0xfa, 0x00, 0x0a, 0x72, 0x00, 0x03,
+            0xeb, 0x00, 0x08, 0x30, 0x03, 0xad, 0x41, 0x4c, 0x42, 0x45, 0x44, 0x4f, 0x5f, 0x4d, 0x41, 0x50,
+            0xb7, 0x07, 0x93, 0x52, 0x4f, 0x55, 0x47, 0x48, 0x4e, 0x45, 0x53, 0x53, 0x1e, 0x00, 0x07, 0x2b,
+            0x00, 0x34, 0x2b, 0x20, 0x31, 0xd6, 0x05, 0x01, 0x6e, 0x00, 0x83, 0x4d, 0x45, 0x54, 0x41, 0x4c,
+            0x4c, 0x49, 0x43, 0x2a, 0x00, 0x0a, 0x3a, 0x00, 0x0c, 0x2d, 0x00, 0x03, 0xb3, 0x05, 0x02, 0x73,
+            0x00, 0x09, 0x3a, 0x00, 0x0c, 0x2a, 0x00, 0x40, 0x41, 0x4d, 0x42, 0x49, 0xce, 0x07, 0x93, 0x4f,
+            0x43, 0x43, 0x4c, 0x55, 0x53, 0x49, 0x4f, 0x4e, 0x60, 0x00, 0x07, 0x42, 0x00, 0x0c, 0x33, 0x00,
+            0x00, 0xc9, 0x07, 0x02, 0x5a, 0x00, 0x0f, 0x3d, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x24, 0x05,
+            0x20, 0x4f, 0x63, 0x22, 0x01, 0xf8, 0x17, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x52, 0x6f, 0x75, 0x67,
+            0x68, 0x6e, 0x65, 0x73, 0x73, 0x2c, 0x20, 0x4d, 0x65, 0x74, 0x61, 0x6c, 0x6c, 0x69, 0x63, 0x20,
+            0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x52, 0x47, 0x42, 0x30, 0x01, 0x01,
+            0x74, 0x07, 0x02, 0x61, 0x00, 0x04, 0x6b, 0x00, 0x00, 0x53, 0x00, 0x04, 0x5f, 0x04, 0x06, 0xaa,
+            0x0a, 0x04, 0x29, 0x00, 0x06, 0x5e, 0x04, 0xe2, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32,
+            0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0xbf, 0x04, 0x04, 0xff, 0x03, 0x31, 0x6d, 0x61, 0x70, 0x2e,
+            0x03, 0x80, 0x46, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x1e, 0x00, 0x20, 0x65, 0x72, 0x4a,
+            0x0b, 0x23, 0x3a, 0x3a, 0xcf, 0x04, 0x94, 0x4d, 0x41, 0x50, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x0a,
+            0xbc, 0x03, 0x80, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0xcc, 0x02, 0x03, 0xfb, 0x01,
+            0x01, 0x52, 0x04, 0x01, 0x96, 0x03, 0x48, 0x5f, 0x6d, 0x6f, 0x64, 0x4a, 0x03, 0x14, 0x72, 0xe5,
+            0x00, 0x0c, 0x19, 0x00, 0x13, 0x6d, 0xf3, 0x00, 0x0c, 0x18, 0x00, 0x03, 0xd3, 0x06, 0x24, 0x5f,
+            0x6f, 0x29, 0x01, 0x0c, 0x21, 0x00, 0x66, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x16, 0x00, 0x01,
+            0x09, 0x02, 0x02, 0xb3, 0x0a, 0x04, 0xda, 0x0b, 0x14, 0x5f, 0xb1, 0x0a, 0x01, 0xdc, 0x00, 0x62,
+            0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0xdb, 0x0a, 0x12, 0x76, 0x3f, 0x0b, 0x31, 0x20, 0x6f, 0x6e,
+            0xc9, 0x0a, 0x81, 0x43, 0x50, 0x55, 0x20, 0x73, 0x69, 0x64, 0x65, 0x14, 0x04, 0x01, 0x49, 0x00,
+            0x00, 0x15, 0x07, 0x40, 0x5b, 0x33, 0x5d, 0x3b, 0x4d, 0x06, 0x20, 0x20, 0x20, 0xb2, 0x01, 0x0f,
+            0x1b, 0x01, 0x01, 0x04, 0x03, 0x01, 0x03, 0xb2, 0x05, 0x00, 0x0a, 0x01, 0x30, 0x3a, 0x3a, 0x5f,
+            0x3c, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x10, 0x05, 0xc0, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x61, 0x79,
+            0x65, 0x72, 0x73, 0x5b, 0x38, 0x4f, 0x00, 0xf7, 0x02, 0x2f, 0x2f, 0x20, 0x54, 0x45, 0x58, 0x54,
+            0x55, 0x52, 0x45, 0x5f, 0x41, 0x52, 0x52, 0x41, 0x59, 0x53, 0x8c, 0x00, 0x21, 0x6c, 0x79, 0x37,
+            0x00, 0x02, 0xcf, 0x03, 0x00, 0x39, 0x00, 0x21, 0x68, 0x61, 0xab, 0x0c, 0x01, 0x3a, 0x00, 0x34,
+            0x2f, 0x2f, 0x20, 0xd5, 0x0c, 0x09, 0x33, 0x00, 0x42, 0x2c, 0x20, 0x30, 0x20, 0x28, 0x00, 0x01,
+            0xe3, 0x04, 0x60, 0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0xf2, 0x05, 0x10, 0x73, 0xd4, 0x03, 0xd0,
+            0x2f, 0x2f, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x65, 0x67, 0x69, 0xa7, 0x07, 0x01,
+            0x1c, 0x00, 0x02, 0xb9, 0x01, 0x90, 0x2c, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x64, 0x25,
+            0x0c, 0x00, 0xf1, 0x0b, 0xc0, 0x70, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
+            0x65, 0xc9, 0x0c, 0x01, 0xdf, 0x01, 0x02, 0x25, 0x00, 0x04, 0x61, 0x02, 0x0e, 0xf8, 0x04, 0x1f,
+            0x30, 0x1d, 0x04, 0x00, 0x13, 0x6d, 0x1b, 0x02, 0x04, 0xa1, 0x04, 0x04, 0x28, 0x01, 0x00, 0x21,
+            0x01, 0x05, 0x59, 0x00, 0x00, 0xa9, 0x04, 0x03, 0xa3, 0x00, 0xf2, 0x09, 0x56, 0x49, 0x53, 0x49,
+            0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x5f, 0x52, 0x45, 0x53, 0x4f, 0x4c, 0x56, 0x45, 0x20, 0x62,
+            0x75, 0x69, 0x6c, 0x64, 0xad, 0x01, 0x01, 0x12, 0x0d, 0x70, 0x76, 0x65, 0x20, 0x70, 0x61, 0x73,
+            0x73, 0x7b, 0x0c, 0xb1, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x42, 0x68,
+            0x05, 0x04, 0xce, 0x0c, 0xf0, 0x04, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x76, 0x65, 0x72,
+            0x74, 0x65, 0x78, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0xef, 0x01, 0x11, 0x6f, 0x98, 0x05, 0x10,
+            0x2c, 0xad, 0x06, 0x00, 0xe5, 0x00, 0x21, 0x69, 0x6e, 0x17, 0x00, 0x02, 0x18, 0x06, 0x00, 0x3e,
+            0x0d, 0x21, 0x72, 0x65, 0x44, 0x0c, 0x00, 0x90, 0x06, 0x71, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f,
+            0x6d, 0x14, 0x02, 0x15, 0x76, 0x66, 0x00, 0x04, 0xcf, 0x05, 0x00, 0xdb, 0x06, 0x00, 0x42, 0x00,
+            0x02, 0xf7, 0x0c, 0x01, 0x7b, 0x00, 0x11, 0x73, 0x30, 0x01, 0x30, 0x65, 0x61, 0x64, 0xfb, 0x0c,
+            0x00, 0xfa, 0x0c, 0x0e, 0xca, 0x00, 0x00, 0x78, 0x00, 0x16, 0x52, 0x63, 0x00, 0x02, 0xd3, 0x00,
+            0x13, 0x66, 0x68, 0x03, 0x01, 0x80, 0x03, 0x01, 0x76, 0x01, 0x01, 0x95, 0x00, 0x33, 0x6f, 0x66,
+            0x20, 0x56, 0x0e, 0x10, 0x2e, 0xc6, 0x00, 0x51, 0x2e, 0x67, 0x6c, 0x73, 0x6c, 0xd6, 0x01, 0x00,
+            0x77, 0x00, 0x0f, 0x07, 0x01, 0x0d, 0x10, 0x2e, 0x6a, 0x00, 0xf2, 0x04, 0x54, 0x68, 0x65, 0x20,
+            0x70, 0x69, 0x78, 0x65, 0x6c, 0x27, 0x73, 0x20, 0x49, 0x44, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x72,
+            0x00, 0x05, 0xd8, 0x01, 0x01, 0xc6, 0x00, 0x00, 0x3d, 0x0e, 0x21, 0x67, 0x6c, 0x08, 0x0e, 0x31,
+            0x6f, 0x73, 0x65, 0x33, 0x01, 0x00, 0x13, 0x06, 0x01, 0x4e, 0x0e, 0x58, 0x66, 0x65, 0x74, 0x63,
+            0x68, 0x0a, 0x01, 0x08, 0xf0, 0x00, 0x02, 0x47, 0x01, 0x40, 0x72, 0x61, 0x6e, 0x73, 0x05, 0x0f,
+            0x00, 0x70, 0x0e, 0x10, 0x6e, 0xa7, 0x04, 0xf0, 0x04, 0x74, 0x65, 0x72, 0x70, 0x6f, 0x6c, 0x61,
+            0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x65, 0x72, 0x95, 0x0e, 0x01, 0x40,
+            0x0e, 0x30, 0x63, 0x6f, 0x72, 0x47, 0x0a, 0x80, 0x20, 0x62, 0x61, 0x72, 0x79, 0x63, 0x65, 0x6e,
+            0xc1, 0x08, 0x90, 0x73, 0x2e, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x21, 0x00, 0x02, 0x81,
+            0x09, 0x20, 0x64, 0x69, 0x33, 0x07, 0x32, 0x65, 0x6e, 0x63, 0x8f, 0x0e, 0x21, 0x74, 0x6f, 0x85,
+            0x01, 0x08, 0x34, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x08, 0x01, 0x00, 0xe6, 0x0a, 0x01, 0x5a, 0x0a,
+            0x20, 0x75, 0x70, 0xb2, 0x02, 0x94, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0xce,
+            0x03, 0x47, 0x73, 0x61, 0x6d, 0x65, 0xe3, 0x00, 0x91, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x64, 0x46,
+            0x64, 0x78, 0x34, 0x00, 0x40, 0x64, 0x46, 0x64, 0x79, 0x4a, 0x00, 0x61, 0x61, 0x20, 0x71, 0x75,
+            0x61, 0x64, 0x34, 0x01, 0x10, 0x4f, 0xb3, 0x07, 0x01, 0x35, 0x01, 0x01, 0x5f, 0x02, 0x01, 0x64,
+            0x00, 0x00, 0x85, 0x0f, 0x82, 0x76, 0x65, 0x64, 0x20, 0x64, 0x72, 0x61, 0x77, 0x79, 0x02, 0x00,
+            0x17, 0x00, 0x83, 0x47, 0x4c, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x13, 0x09, 0x80, 0x74, 0x65,
+            0x73, 0x74, 0x20, 0x61, 0x67, 0x61, 0x5c, 0x01, 0x01, 0xaf, 0x00, 0x84, 0x63, 0x6c, 0x61, 0x73,
+            0x73, 0x69, 0x66, 0x69, 0x39, 0x00, 0x01, 0x27, 0x00, 0x14, 0x2e, 0x3c, 0x03, 0x64, 0x65, 0x61,
+            0x72, 0x6c, 0x79, 0x5f, 0xfb, 0x01, 0x10, 0x5f, 0x3e, 0x00, 0x74, 0x73, 0x29, 0x20, 0x69, 0x6e,
+            0x3b, 0x0a, 0x22, 0x00, 0x06, 0xbf, 0x05, 0x16, 0x38, 0xb8, 0x05, 0x15, 0x75, 0xb9, 0x05, 0x07,
+            0x94, 0x02, 0x32, 0x5f, 0x69, 0x64, 0xa6, 0x09, 0x0c, 0x0d, 0x03, 0x42, 0x3a, 0x3a, 0x49, 0x44,
+            0xa8, 0x05, 0x03, 0xcf, 0x07, 0x40, 0x6c, 0x6f, 0x63, 0x61, 0x49, 0x09, 0x0a, 0x4c, 0x0c, 0x01,
+            0xe5, 0x04, 0x00, 0xdd, 0x00, 0x55, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x9f, 0x0a, 0x07, 0x2d, 0x00,
+            0x07, 0x98, 0x0a, 0x01, 0x2d, 0x00, 0x04, 0x51, 0x01, 0x03, 0x48, 0x0b, 0x04, 0xb3, 0x00, 0x07,
+            0x32, 0x00, 0x16, 0x33, 0xb4, 0x00, 0x01, 0x6c, 0x0d, 0x03, 0x5e, 0x04, 0x02, 0x56, 0x0b, 0x13,
+            0x49, 0x58, 0x04, 0x00, 0x03, 0x04, 0x11, 0x2c, 0x2d, 0x01, 0x02, 0x4b, 0x04, 0x13, 0x20, 0x0a,
+            0x0a, 0xe0, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x75, 0x70,
+            0xbc, 0x0a, 0x00, 0x71, 0x01, 0xf4, 0x01, 0x70, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x31, 0x34,
+            0x34, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x7c, 0x06, 0x06, 0xf6, 0x00, 0x04, 0x58, 0x00, 0x03,
+            0x82, 0x06, 0x01, 0x2d, 0x0b, 0x52, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x7e, 0x06, 0x01, 0x10, 0x00,
+            0x04, 0x8f, 0x11, 0x07, 0x18, 0x00, 0x01, 0xd3, 0x00, 0x04, 0xa7, 0x04, 0x01, 0x81, 0x09, 0x23,
+            0x2f, 0x2f, 0xe8, 0x03, 0x0f, 0x05, 0x02, 0x03, 0x12, 0x2c, 0x73, 0x0a, 0x10, 0x61, 0x3c, 0x07,
+            0x02, 0xb2, 0x02, 0x10, 0x74, 0x88, 0x02, 0x24, 0x6c, 0x79, 0xac, 0x07, 0x01, 0x91, 0x0c, 0x14,
+            0x73, 0x17, 0x01, 0x02, 0xdd, 0x00, 0x08, 0x3b, 0x12, 0x1f, 0x38, 0x28, 0x05, 0x00, 0x06, 0xd0,
+            0x01, 0x04, 0xc7, 0x00, 0x04, 0x32, 0x05, 0x0e, 0xe1, 0x00, 0x09, 0xfd, 0x01, 0x03, 0x4d, 0x01,
+            0x04, 0x43, 0x05, 0x03, 0xeb, 0x01, 0x0e, 0x75, 0x00, 0x1f, 0x39, 0x75, 0x00, 0x0a, 0x13, 0x50,
+            0x64, 0x0b, 0x04, 0x75, 0x00, 0x01, 0xc3, 0x00, 0x08, 0x68, 0x00, 0x04, 0x85, 0x0b, 0x0f, 0x68,
+            0x00, 0x0e, 0x1f, 0x31, 0x06, 0x06, 0x01, 0x06, 0xde, 0x00, 0x30, 0x45, 0x6c, 0x65, 0x56, 0x08,
+            0x04, 0x68, 0x00, 0x01, 0x7d, 0x01, 0x06, 0x1e, 0x00, 0x23, 0x5f, 0x65, 0x1f, 0x00, 0x03, 0x20,
+            0x0a, 0x0f, 0xce, 0x00, 0x06, 0x1f, 0x31, 0x64, 0x0b, 0x01, 0x06, 0x48, 0x00, 0x01, 0xda, 0x0e,
+            0x04, 0x64, 0x00, 0x01, 0xdd, 0x0c, 0x06, 0x1c, 0x00, 0x11, 0x5f, 0x96, 0x08, 0x0f, 0xc8, 0x00,
+            0x0f, 0x0f, 0x6e, 0x0b, 0x01, 0x06, 0x46, 0x00, 0x27, 0x55, 0x56, 0x5f, 0x00, 0x18, 0x32, 0x2a,
+            0x01, 0x2f, 0x75, 0x76, 0x5c, 0x00, 0x0f, 0x0f, 0x47, 0x0b, 0x01, 0x06, 0x5c, 0x00, 0x11, 0x4e,
+            0xd0, 0x08, 0x04, 0x60, 0x00, 0x0d, 0x8b, 0x01, 0x02, 0xef, 0x08, 0x0f, 0x65, 0x00, 0x0f, 0x1f,
+            0x34, 0xf2, 0x01, 0x0a, 0x10, 0x54, 0x42, 0x0d, 0x2f, 0x6e, 0x74, 0x66, 0x00, 0x06, 0x13, 0x74,
+            0x20, 0x00, 0x03, 0x8a, 0x01, 0x11, 0x0a, 0xaa, 0x01, 0x00, 0xb2, 0x04, 0x00, 0x7a, 0x0e, 0x01,
+            0x0f, 0x08, 0x2f, 0x3b, 0x0a, 0xcd, 0x07, 0x02, 0x31, 0x3b, 0x0a, 0x0a, 0x72, 0x01, 0x01, 0x2c,
+            0x00, 0x00, 0x36, 0x0e, 0x57, 0x5f, 0x70, 0x6f, 0x73, 0x3b, 0x14, 0x00, 0x0b, 0x0f, 0x00, 0x01,
+            0x8f, 0x01, 0x01, 0x20, 0x00, 0x12, 0x32, 0x34, 0x00, 0x21, 0x75, 0x76, 0x0e, 0x00, 0x12, 0x33,
+            0x0e, 0x00, 0x01, 0x42, 0x00, 0x02, 0xf3, 0x00, 0x0d, 0x17, 0x00, 0x03, 0xa4, 0x00, 0x0d, 0x18,
+            0x00, 0x2f, 0x62, 0x69, 0x1a, 0x00, 0x05, 0x77, 0x70, 0x6f, 0x73, 0x5f, 0x64, 0x78, 0x2c, 0x5b,
+            0x00, 0x01, 0x12, 0x00, 0x11, 0x79, 0x43, 0x00, 0x05, 0x80, 0x00, 0x06, 0x23, 0x00, 0x52, 0x75,
+            0x76, 0x5f, 0x64, 0x79, 0xd2, 0x00, 0x30, 0x33, 0x20, 0x46, 0x0f, 0x07, 0x51, 0x56, 0x65, 0x63,
+            0x33, 0x28, 0x0d, 0x01, 0x00, 0x98, 0x07, 0x32, 0x65, 0x78, 0x2c, 0x72, 0x14, 0x02, 0x1b, 0x15,
+            0x13, 0x29, 0x7c, 0x04, 0x01, 0x20, 0x00, 0x31, 0x69, 0x20, 0x3d, 0x4f, 0x07, 0x72, 0x65, 0x78,
+            0x20, 0x2a, 0x20, 0x33, 0x75, 0x86, 0x04, 0x32, 0x69, 0x66, 0x28, 0x2b, 0x00, 0x00, 0xb7, 0x14,
+            0x03, 0x3e, 0x0c, 0x00, 0xf9, 0x11, 0x01, 0xef, 0x09, 0x00, 0x63, 0x0a, 0x61, 0x72, 0x65, 0x74,
+            0x75, 0x72, 0x6e, 0x63, 0x04, 0x16, 0x28, 0x13, 0x02, 0x03, 0x02, 0x01, 0x58, 0x73, 0x5b, 0x69,
+            0x5d, 0x2c, 0x6d, 0x02, 0x05, 0x17, 0x00, 0x5f, 0x20, 0x2b, 0x20, 0x31, 0x75, 0x1c, 0x00, 0x07,
+            0x4f, 0x32, 0x75, 0x5d, 0x29, 0x81, 0x00, 0x00, 0x08, 0x7b, 0x12, 0x0f, 0x82, 0x00, 0x0d, 0x03,
+            0x53, 0x01, 0x0d, 0x83, 0x00, 0x06, 0x18, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x09, 0x1d, 0x00, 0x06,
+            0x85, 0x00, 0x0f, 0xe5, 0x00, 0x04, 0x06, 0x65, 0x04, 0x0b, 0xe7, 0x00, 0x07, 0x19, 0x00, 0x0f,
+            0x65, 0x00, 0x00, 0x0a, 0x1e, 0x00, 0x02, 0x66, 0x00, 0x11, 0x7d, 0xc1, 0x11, 0x0f, 0x7d, 0x08,
+            0x0d, 0x00, 0xff, 0x07, 0x00, 0x5d, 0x06, 0x04, 0xd2, 0x06, 0x00, 0x34, 0x17, 0x74, 0x61, 0x6e,
+            0x20, 0x4e, 0x44, 0x43, 0x20, 0x55, 0x00, 0x00, 0xb9, 0x02, 0x37, 0x33, 0x20, 0x42, 0xb2, 0x08,
+            0xc1, 0x28, 0x6d, 0x61, 0x74, 0x33, 0x78, 0x34, 0x20, 0x63, 0x6c, 0x69, 0x70, 0x0c, 0x06, 0x54,
+            0x32, 0x20, 0x6e, 0x64, 0x63, 0xfb, 0x01, 0x01, 0x1c, 0x06, 0x04, 0x67, 0x06, 0x10, 0x77, 0x6b,
+            0x07, 0x42, 0x2e, 0x66, 0x20, 0x2f, 0xd0, 0x01, 0x00, 0x32, 0x00, 0x61, 0x5b, 0x30, 0x5d, 0x2e,
+            0x77, 0x2c, 0x3d, 0x00, 0x26, 0x5b, 0x31, 0x0b, 0x00, 0x43, 0x32, 0x5d, 0x2e, 0x77, 0xa2, 0x01,
+            0x01, 0xfc, 0x17, 0x42, 0x70, 0x30, 0x20, 0x3d, 0x25, 0x00, 0x75, 0x30, 0x5d, 0x2e, 0x78, 0x79,
+            0x20, 0x2a, 0x4a, 0x18, 0x32, 0x77, 0x2e, 0x78, 0xca, 0x01, 0x01, 0x28, 0x00, 0x24, 0x65, 0x31,
+            0x28, 0x00, 0x1d, 0x31, 0x28, 0x00, 0x68, 0x79, 0x20, 0x2d, 0x20, 0x70, 0x30, 0x2d, 0x00, 0x14,
+            0x32, 0x2d, 0x00, 0x1d, 0x32, 0x2d, 0x00, 0x1c, 0x7a, 0x2d, 0x00, 0x30, 0x64, 0x20, 0x3d, 0xd8,
+            0x00, 0x07, 0x17, 0x00, 0x02, 0x8a, 0x04, 0x04, 0xdc, 0x00, 0x45, 0x61, 0x72, 0x65, 0x61, 0xdf,
+            0x00, 0x40, 0x28, 0x65, 0x31, 0x2e, 0xe7, 0x02, 0x21, 0x65, 0x32, 0x76, 0x00, 0x30, 0x65, 0x31,
+            0x2e, 0xb3, 0x00, 0x43, 0x65, 0x32, 0x2e, 0x78, 0xd5, 0x00, 0x02, 0x3c, 0x00, 0x10, 0x62, 0xae,
+            0x00, 0x28, 0x28, 0x64, 0x2b, 0x00, 0x16, 0x64, 0x2a, 0x00, 0x07, 0xe5, 0x00, 0x00, 0x5d, 0x00,
+            0x02, 0xb9, 0x00, 0x03, 0x39, 0x00, 0x00, 0xba, 0x00, 0x04, 0x65, 0x00, 0x00, 0x33, 0x00, 0x05,
+            0x64, 0x00, 0x1f, 0x64, 0x39, 0x00, 0x05, 0x01, 0x89, 0x01, 0x10, 0x77, 0x12, 0x0a, 0x21, 0x74,
+            0x73, 0x8a, 0x03, 0xb0, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x66, 0x20, 0x2d, 0x20, 0x62, 0x31, 0x05,
+            0x00, 0x98, 0x32, 0x2c, 0x20, 0x62, 0x31, 0x2c, 0x20, 0x62, 0x32, 0x3f, 0x00, 0x03, 0xa4, 0x19,
+            0x03, 0xa0, 0x02, 0x04, 0x3e, 0x00, 0x33, 0x2f, 0x20, 0x28, 0x0b, 0x00, 0x54, 0x2e, 0x78, 0x20,
+            0x2b, 0x20, 0x0c, 0x00, 0x17, 0x79, 0x0c, 0x00, 0xb8, 0x7a, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a,
+            0x76, 0x6f, 0x69, 0x64, 0xe4, 0x0b, 0x04, 0x2b, 0x0e, 0x14, 0x28, 0x1f, 0x02, 0x01, 0x1a, 0x04,
+            0x00, 0x2a, 0x09, 0x30, 0x6c, 0x5f, 0x69, 0x62, 0x01, 0x51, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x59,
+            0x04, 0x08, 0xee, 0x03, 0x60, 0x69, 0x64, 0x73, 0x2c, 0x20, 0x69, 0xe1, 0x01, 0x40, 0x28, 0x67,
+            0x6c, 0x5f, 0x45, 0x00, 0xf1, 0x02, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x78, 0x79, 0x29, 0x2c,
+            0x20, 0x30, 0x29, 0x2e, 0x72, 0x20, 0x2d, 0x90, 0x0a, 0x03, 0xb3, 0x09, 0x00, 0x38, 0x04, 0x01,
+            0x59, 0x00, 0x00, 0x7f, 0x0a, 0x01, 0xb3, 0x0d, 0x16, 0x3d, 0x64, 0x00, 0x15, 0x2f, 0x01, 0x0b,
+            0x04, 0xb0, 0x09, 0x05, 0x2f, 0x00, 0x05, 0xf7, 0x02, 0x07, 0x2f, 0x00, 0x11, 0x2d, 0xc8, 0x0c,
+            0x01, 0x45, 0x00, 0x1f, 0x2a, 0x3a, 0x00, 0x02, 0x0f, 0x90, 0x08, 0x00, 0x30, 0x64, 0x61, 0x74,
+            0x0b, 0x02, 0x08, 0xc1, 0x00, 0x05, 0x97, 0x08, 0x04, 0x93, 0x00, 0x13, 0x5d, 0xcf, 0x01, 0x08,
+            0x42, 0x06, 0x21, 0x20, 0x3d, 0x3b, 0x00, 0x16, 0x2e, 0x7e, 0x09, 0x00, 0x9b, 0x00, 0x04, 0x0e,
+            0x00, 0x27, 0x20, 0x3d, 0x21, 0x0e, 0x01, 0x1a, 0x06, 0x04, 0x1a, 0x00, 0x31, 0x5d, 0x3b, 0x0a,
+            0xae, 0x04, 0x00, 0x1f, 0x0f, 0x11, 0x33, 0x64, 0x05, 0x01, 0xb3, 0x0c, 0x12, 0x3d, 0x11, 0x00,
+            0x15, 0x28, 0xd7, 0x00, 0x00, 0x77, 0x05, 0x33, 0x29, 0x20, 0x2b, 0x17, 0x00, 0xa3, 0x30, 0x75,
+            0x2c, 0x20, 0x31, 0x75, 0x2c, 0x20, 0x32, 0x75, 0x94, 0x02, 0x33, 0x69, 0x66, 0x28, 0x99, 0x0a,
+            0x11, 0x29, 0x4f, 0x00, 0x00, 0x7d, 0x00, 0x00, 0xd5, 0x05, 0x09, 0x4d, 0x00, 0x07, 0xd5, 0x00,
+            0x05, 0x9d, 0x08, 0x04, 0x25, 0x00, 0x2a, 0x2e, 0x78, 0x72, 0x05, 0x0e, 0x21, 0x00, 0x1f, 0x79,
+            0x21, 0x00, 0x0d, 0x10, 0x7a, 0x98, 0x05, 0x01, 0x7e, 0x00, 0x01, 0xa0, 0x0a, 0x00, 0xee, 0x06,
+            0x10, 0x4d, 0xb4, 0x0a, 0x00, 0xb2, 0x02, 0x53, 0x69, 0x65, 0x77, 0x20, 0x2a, 0x22, 0x01, 0x00,
+            0x14, 0x00, 0x02, 0x42, 0x01, 0x03, 0x7e, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x5a, 0x07, 0x01, 0x1b,
+            0x15, 0x12, 0x73, 0x51, 0x04, 0x02, 0x21, 0x00, 0x40, 0x66, 0x6f, 0x72, 0x28, 0x70, 0x10, 0x00,
+            0x80, 0x06, 0xd2, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x33, 0x3b, 0x20, 0x69, 0x2b, 0x2b,
+            0xe6, 0x00, 0x02, 0x9d, 0x1c, 0x01, 0xec, 0x00, 0x44, 0x69, 0x65, 0x77, 0x5f, 0xe8, 0x04, 0x00,
+            0xd8, 0x05, 0x03, 0x75, 0x00, 0x02, 0x81, 0x00, 0x10, 0x2a, 0xb4, 0x04, 0x21, 0x34, 0x28, 0x9c,
+            0x02, 0x01, 0xf5, 0x06, 0x04, 0xf6, 0x00, 0x01, 0x84, 0x06, 0x03, 0x62, 0x1b, 0x63, 0x29, 0x2c,
+            0x20, 0x31, 0x2e, 0x66, 0x50, 0x01, 0x00, 0x54, 0x00, 0x01, 0xe3, 0x04, 0x47, 0x69, 0x5d, 0x20,
+            0x3d, 0xd4, 0x1c, 0x22, 0x20, 0x2a, 0x59, 0x15, 0x08, 0x6b, 0x00, 0x02, 0xab, 0x00, 0x11, 0x7d,
+            0xfa, 0x00, 0x00, 0xe8, 0x02, 0x02, 0xab, 0x0e, 0x44, 0x20, 0x3d, 0x20, 0x32, 0x2f, 0x05, 0x21,
+            0x32, 0x28, 0xe7, 0x0e, 0x01, 0x00, 0x1d, 0x03, 0x61, 0x00, 0x01, 0x29, 0x00, 0x6b, 0x6e, 0x64,
+            0x63, 0x20, 0x3d, 0x20, 0x17, 0x03, 0x23, 0x20, 0x2a, 0x41, 0x00, 0x10, 0x2d, 0x90, 0x00, 0x02,
+            0x5d, 0x00, 0x01, 0x01, 0x04, 0x3a, 0x62, 0x20, 0x3d, 0xbd, 0x05, 0x00, 0xa1, 0x00, 0x10, 0x2c,
+            0xd9, 0x04, 0x06, 0x54, 0x00, 0x6f, 0x33, 0x20, 0x62, 0x5f, 0x64, 0x78, 0x29, 0x00, 0x06, 0x20,
+            0x20, 0x2b, 0x0a, 0x01, 0x21, 0x32, 0x28, 0x18, 0x0e, 0x90, 0x2e, 0x78, 0x2c, 0x20, 0x30, 0x2e,
+            0x66, 0x29, 0x29, 0x43, 0x04, 0x08, 0x68, 0x00, 0x3f, 0x5f, 0x64, 0x79, 0x42, 0x00, 0x0e, 0x42,
+            0x30, 0x2e, 0x66, 0x2c, 0xa8, 0x00, 0x24, 0x2e, 0x79, 0x42, 0x00, 0x01, 0x02, 0x01, 0x01, 0xde,
+            0x02, 0x04, 0xd2, 0x01, 0x03, 0x86, 0x01, 0x06, 0x9a, 0x01, 0x24, 0x20, 0x2a, 0x6b, 0x00, 0x01,
+            0x28, 0x00, 0x20, 0x70, 0x6f, 0xd0, 0x04, 0x09, 0x5f, 0x01, 0x01, 0x18, 0x00, 0x04, 0x40, 0x00,
+            0x07, 0x2b, 0x00, 0x04, 0x13, 0x00, 0x02, 0xdf, 0x00, 0x00, 0x11, 0x01, 0x14, 0x28, 0x13, 0x00,
+            0x02, 0x38, 0x02, 0x00, 0x5b, 0x00, 0x25, 0x5f, 0x64, 0xa5, 0x05, 0x00, 0x9d, 0x03, 0x04, 0x21,
+            0x00, 0x02, 0xd1, 0x00, 0x0f, 0x34, 0x00, 0x06, 0x23, 0x79, 0x29, 0x85, 0x03, 0x01, 0x7c, 0x00,
+            0x01, 0xc5, 0x09, 0x00, 0xb9, 0x00, 0x30, 0x65, 0x63, 0x34, 0x66, 0x05, 0x03, 0x5d, 0x01, 0x23,
+            0x69, 0x66, 0x7e, 0x1b, 0x03, 0xfd, 0x1a, 0x02, 0x82, 0x02, 0x00, 0x28, 0x02, 0x09, 0x36, 0x00,
+            0x02, 0xd3, 0x02, 0x08, 0x01, 0x05, 0x01, 0x50, 0x00, 0x24, 0x73, 0x5b, 0x73, 0x02, 0x0c, 0x69,
+            0x03, 0x0c, 0x1f, 0x00, 0x0b, 0x67, 0x03, 0x0c, 0x1f, 0x00, 0x20, 0x7a, 0x5d, 0xe4, 0x05, 0x08,
+            0x44, 0x01, 0x22, 0x75, 0x76, 0xad, 0x00, 0x20, 0x32, 0x28, 0xcd, 0x01, 0x07, 0x32, 0x01, 0x00,
+            0xf1, 0x09, 0x00, 0x0b, 0x02, 0x01, 0xa0, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x78,
+            0x02, 0x07, 0x29, 0x00, 0x36, 0x69, 0x66, 0x28, 0x3d, 0x1c, 0x02, 0xd3, 0x00, 0x06, 0x55, 0x03,
+            0x01, 0xcc, 0x00, 0x40, 0x32, 0x20, 0x75, 0x76, 0xa5, 0x01, 0x02, 0x0d, 0x00, 0x08, 0xd9, 0x00,
+            0x00, 0x1e, 0x0c, 0x0f, 0xd6, 0x00, 0x05, 0x09, 0x1c, 0x00, 0x0b, 0xd3, 0x00, 0x09, 0x1c, 0x00,
+            0x01, 0x35, 0x04, 0x00, 0x46, 0x01, 0x00, 0x04, 0x00, 0x03, 0xaa, 0x00, 0x01, 0xfe, 0x04, 0x01,
+            0xd0, 0x01, 0x02, 0xce, 0x00, 0x07, 0x1b, 0x00, 0x02, 0xfe, 0x01, 0x00, 0x92, 0x00, 0x11, 0x2a,
+            0xea, 0x02, 0x0f, 0x21, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x05, 0x21, 0x00, 0x12, 0x79, 0x21, 0x00,
+            0x02, 0x9d, 0x03, 0x33, 0x69, 0x66, 0x28, 0xa7, 0x0a, 0x09, 0xc4, 0x01, 0x0a, 0xf1, 0x00, 0x12,
+            0x20, 0x88, 0x0a, 0x00, 0xd9, 0x05, 0x20, 0x72, 0x69, 0x3f, 0x01, 0x00, 0xf9, 0x00, 0x11, 0x28,
+            0x1d, 0x12, 0x51, 0x70, 0x6f, 0x73, 0x65, 0x28, 0xe6, 0x05, 0x04, 0x39, 0x08, 0x01, 0x7c, 0x0f,
+            0x07, 0xb3, 0x07, 0x00, 0x71, 0x02, 0x13, 0x29, 0x31, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x3c, 0x00,
+            0x03, 0x51, 0x00, 0x34, 0x73, 0x2c, 0x20, 0x42, 0x0a, 0x00, 0x41, 0x0f, 0x04, 0x0c, 0x00, 0x02,
+            0xa0, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0xec, 0x04, 0x0c, 0x00, 0x23, 0x00, 0x06, 0xaa, 0x00, 0x00,
+            0x0e, 0x00, 0x02, 0xa9, 0x00, 0x03, 0xed, 0x04, 0x02, 0x0d, 0x00, 0x04, 0xb6, 0x00, 0x17, 0x2a,
+            0xe1, 0x0b, 0x04, 0xa3, 0x01, 0x01, 0xec, 0x04, 0x03, 0x00, 0x01, 0x00, 0xa7, 0x0b, 0x06, 0x7a,
+            0x00, 0x00, 0x4d, 0x00, 0x34, 0x69, 0x66, 0x28, 0x42, 0x0b, 0x09, 0x1d, 0x01, 0x00, 0x1c, 0x00,
+            0x00, 0x04, 0x00, 0x0a, 0x7b, 0x00, 0x00, 0x12, 0x00, 0x04, 0xc2, 0x00, 0x02, 0x23, 0x05, 0x00,
+            0xea, 0x00, 0x01, 0x91, 0x03, 0x01, 0x72, 0x05, 0x00, 0xa4, 0x02, 0x0f, 0x6e, 0x05, 0x04, 0x04,
+            0x66, 0x00, 0x0e, 0x83, 0x00, 0x00, 0x55, 0x00, 0x05, 0xef, 0x0c, 0x03, 0xd7, 0x00, 0x62, 0x63,
+            0x72, 0x6f, 0x73, 0x73, 0x28, 0xdd, 0x00, 0x00, 0x13, 0x00, 0x06, 0x45, 0x01, 0x20, 0x5b, 0x69,
+            0x6f, 0x06, 0x00, 0x34, 0x00, 0x04, 0x04, 0x00, 0x02, 0xe5, 0x01, 0x00, 0x0e, 0x00, 0x06, 0x0a,
+            0x00, 0x01, 0x52, 0x02, 0x00, 0x96, 0x01, 0x03, 0x76, 0x0c, 0x00, 0x09, 0x0a, 0x02, 0x93, 0x0e,
+            0x0a, 0x5f, 0x02, 0x0f, 0xff, 0x00, 0x09, 0x0a, 0xfb, 0x00, 0x06, 0x52, 0x00, 0x03, 0x01, 0x01,
+            0x25, 0x20, 0x3d, 0xd9, 0x01, 0x0a, 0x54, 0x00, 0x00, 0x8a, 0x00, 0x06, 0x2e, 0x00, 0x05, 0xda,
+            0x00, 0x20, 0x20, 0x3d, 0x73, 0x22, 0x03, 0x93, 0x0e, 0x0a, 0x32, 0x00, 0x02, 0xb8, 0x00, 0xd0,
+            0x7d, 0x0a, 0x7d, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x66, 0x6c, 0x61, 0xec, 0x1a, 0x02,
+            0x97, 0x0d, 0x01, 0x4b, 0x00, 0x04, 0x37, 0x08, 0x0f, 0xb1, 0x0e, 0x04, 0x0f, 0x68, 0x08, 0x0b,
+            0x20, 0x69, 0x6e, 0xfe, 0x05, 0x1a, 0x34, 0x32, 0x0e, 0x1a, 0x3b, 0x17, 0x00, 0x01, 0xd2, 0x0e,
+            0x09, 0x12, 0x00, 0x01, 0x82, 0x04, 0x04, 0x26, 0x00, 0x05, 0x58, 0x0e, 0x04, 0x11, 0x00, 0x0f,
+            0xdb, 0x0e, 0x01, 0x02, 0x3f, 0x00, 0x08, 0x1a, 0x00, 0x03, 0x2b, 0x01, 0x0f, 0x35, 0x00, 0x01,
+            0x05, 0x18, 0x01, 0x14, 0x3b, 0x3e, 0x23, 0x01, 0xf2, 0x15, 0x03, 0x4e, 0x18, 0x01, 0xba, 0x23,
+            0x12, 0x69, 0xed, 0x15, 0x02, 0x07, 0x19, 0x05, 0xf3, 0x1d, 0x04, 0x07, 0x19, 0x04, 0xf9, 0x0c,
+            0x04, 0x1b, 0x01, 0x02, 0x2d, 0x00, 0x04, 0x80, 0x18, 0x31, 0x69, 0x73, 0x20, 0x3b, 0x18, 0x00,
+            0xc1, 0x15, 0x01, 0xe7, 0x15, 0x40, 0x6d, 0x61, 0x70, 0x73, 0x47, 0x17, 0x00, 0x1a, 0x19, 0x00,
+            0x3b, 0x00, 0x21, 0x69, 0x74, 0x20, 0x16, 0x10, 0x6e, 0x51, 0x18, 0x12, 0x20, 0x95, 0x14, 0x30,
+            0x64, 0x2e, 0x20, 0x02, 0x1f, 0x00, 0x3e, 0x0a, 0x34, 0x69, 0x64, 0x65, 0x22, 0x00, 0x91, 0x73,
+            0x74, 0x69, 0x6c, 0x6c, 0x20, 0x63, 0x68, 0x65, 0xc5, 0x1a, 0x08, 0x21, 0x15, 0x04, 0x7a, 0x00,
+            0x01, 0x60, 0x00, 0x02, 0x84, 0x24, 0x50, 0x69, 0x73, 0x20, 0x77, 0x68, 0xe2, 0x24, 0x10, 0x65,
+            0xce, 0x24, 0x00, 0x41, 0x08, 0x42, 0x67, 0x72, 0x61, 0x6d, 0x47, 0x16, 0x30, 0x61, 0x6c, 0x6c,
+            0x02, 0x02, 0x20, 0x73, 0x20, 0xca, 0x1c, 0x00, 0xae, 0x14, 0x45, 0x20, 0x61, 0x6e, 0x79, 0x20,
+            0x0a, 0x10, 0x2e, 0x75, 0x17, 0x01, 0x70, 0x24, 0x04, 0x52, 0x19, 0x00, 0x04, 0x01, 0x05, 0x71,
+            0x24, 0x08, 0x15, 0x00, 0x0f, 0x72, 0x24, 0x00, 0x00, 0xd0, 0x1a, 0x03, 0xc0, 0x03, 0x41, 0x28,
+            0x6d, 0x61, 0x70, 0x6f, 0x24, 0x19, 0x28, 0x34, 0x00, 0x16, 0x26, 0x6a, 0x00, 0x02, 0x51, 0x01,
+            0x0d, 0x58, 0x1a, 0x40, 0x29, 0x20, 0x3e, 0x3e, 0x6b, 0x19, 0x0c, 0x95, 0x24, 0x26, 0x2f, 0x2f,
+            0x96, 0x16, 0x00, 0x1e, 0x25, 0x01, 0x45, 0x08, 0x0c, 0x58, 0x14, 0x41, 0x20, 0x6d, 0x61, 0x79,
+            0x87, 0x18, 0x20, 0x6e, 0x67, 0xef, 0x14, 0x55, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x7c, 0x0b, 0x00,
+            0x39, 0x1f, 0x10, 0x6f, 0x50, 0x01, 0x00, 0xf5, 0x18, 0xf0, 0x03, 0x65, 0x73, 0x20, 0x69, 0x74,
+            0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x75, 0x76, 0x20, 0x67, 0x72, 0x61, 0x64, 0xee, 0x21, 0x11,
+            0x73, 0x45, 0x01, 0x01, 0x13, 0x21, 0x01, 0xc2, 0x19, 0x24, 0x32, 0x5e, 0x25, 0x26, 0x00, 0x4f,
+            0x00, 0x51, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x68, 0x15, 0x00, 0x16, 0x21, 0x00, 0xbf, 0x01, 0x00,
+            0xf3, 0x0e, 0xc0, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3e,
+            0x01, 0x0f, 0xb3, 0x18, 0x04, 0x04, 0x96, 0x25, 0xa2, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x5f,
+            0x32, 0x44, 0x28, 0xef, 0x01, 0x40, 0x72, 0x2c, 0x20, 0x63, 0x93, 0x0c, 0x14, 0x29, 0x5b, 0x02,
+            0x4b, 0x47, 0x72, 0x61, 0x64, 0x1c, 0x00, 0x03, 0x67, 0x11, 0x00, 0x46, 0x07, 0x01, 0x1c, 0x0e,
+            0x44, 0x78, 0x70, 0x32, 0x28, 0x99, 0x00, 0x17, 0x29, 0x1d, 0x00, 0x01, 0x2b, 0x0e, 0x09, 0x1d,
+            0x00, 0x13, 0x29, 0xcc, 0x03, 0x0f, 0x7e, 0x00, 0x16, 0x0d, 0x7a, 0x00, 0x05, 0x68, 0x00, 0x04,
+            0x21, 0x03, 0x0f, 0x13, 0x28, 0x03, 0x03, 0x92, 0x26, 0x03, 0xde, 0x00, 0x30, 0x4d, 0x41, 0x50,
+            0x01, 0x02, 0x54, 0x2c, 0x20, 0x75, 0x76, 0x29, 0x14, 0x00, 0x06, 0xf2, 0x00, 0x20, 0x32, 0x44,
+            0xfa, 0x0f, 0x01, 0xfb, 0x12, 0x18, 0x2e, 0x93, 0x1b, 0x51, 0x6d, 0x61, 0x70, 0x5d, 0x29, 0x34,
+            0x00, 0x00, 0xb6, 0x00, 0x23, 0x69, 0x66, 0x4c, 0x27, 0x20, 0x64, 0x28, 0x35, 0x1d, 0x14, 0x5f,
+            0x48, 0x02, 0x01, 0xe3, 0x1b, 0x14, 0x29, 0x15, 0x16, 0x06, 0xdf, 0x17, 0x07, 0x48, 0x28, 0x03,
+            0x5a, 0x01, 0x03, 0x97, 0x1d, 0x00, 0x4e, 0x02, 0x13, 0x5f, 0x13, 0x00, 0x24, 0x73, 0x5b, 0xc5,
+            0x1d, 0x02, 0xd2, 0x1f, 0x04, 0xc2, 0x21, 0x20, 0x75, 0x6e, 0x0e, 0x02, 0x10, 0x30, 0xe6, 0x01,
+            0x04, 0x21, 0x00, 0x25, 0x2d, 0x31, 0xf7, 0x02, 0x03, 0xc2, 0x00, 0x0f, 0xd6, 0x00, 0x04, 0x00,
+            0xc3, 0x00, 0x05, 0x5f, 0x00, 0x00, 0xc4, 0x00, 0x01, 0xcc, 0x10, 0x56, 0x33, 0x28, 0x75, 0x76,
+            0x2c, 0xee, 0x02, 0x00, 0x25, 0x00, 0x03, 0xb4, 0x1c, 0x00, 0x23, 0x00, 0x05, 0x99, 0x01, 0x03,
+            0x99, 0x15, 0x0f, 0xc7, 0x00, 0x0b, 0x0f, 0xc2, 0x00, 0x60, 0x20, 0x75, 0x76, 0xa2, 0x00, 0x02,
+            0xbb, 0x29, 0x04, 0x3d, 0x02, 0x06, 0x2e, 0x20, 0x05, 0xf1, 0x25, 0x08, 0xf2, 0x03, 0x06, 0x1f,
+            0x00, 0x15, 0x29, 0x3a, 0x01, 0x09, 0x37, 0x20, 0x0f, 0x36, 0x00, 0x02, 0x09, 0x22, 0x00, 0x06,
+            0x39, 0x00, 0x08, 0x45, 0x20, 0x0f, 0x38, 0x00, 0x02, 0x08, 0x21, 0x00, 0x06, 0x37, 0x00, 0x03,
+            0x62, 0x08, 0x07, 0x97, 0x00, 0x17, 0x20, 0x0c, 0x00, 0x04, 0x81, 0x09, 0x09, 0x33, 0x00, 0x0f,
+            0x55, 0x20, 0x02, 0x0f, 0x73, 0x00, 0x02, 0x0f, 0x2a, 0x00, 0x02, 0x06, 0x49, 0x00, 0x03, 0x3d,
+            0x20, 0x0f, 0x3b, 0x00, 0x02, 0x03, 0x1c, 0x00, 0x72, 0x29, 0x0a, 0x0a, 0x0a, 0x6f, 0x75, 0x74,
+            0x09, 0x07, 0x32, 0x6f, 0x75, 0x74, 0x43, 0x17, 0x11, 0x3b, 0x63, 0x13, 0x12, 0x31, 0xc1, 0x25,
+            0x30, 0x6c, 0x69, 0x74, 0x7f, 0x1e, 0x01, 0xcd, 0x25, 0x51, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0xd0,
+            0x1c, 0x42, 0x6f, 0x77, 0x65, 0x64, 0xe9, 0x03, 0x01, 0xf5, 0x17, 0x00, 0x3f, 0x1b, 0x11, 0x74,
+            0x8a, 0x04, 0x44, 0x6c, 0x61, 0x73, 0x74, 0x40, 0x24, 0x01, 0x4b, 0x06, 0x42, 0x6c, 0x69, 0x74,
+            0x0a, 0xeb, 0x11, 0x05, 0x6b, 0x26, 0x20, 0x61, 0x6c, 0x7c, 0x20, 0x30, 0x6f, 0x77, 0x28, 0x84,
+            0x0c, 0x05, 0x42, 0x0e, 0x04, 0x49, 0x11, 0x02, 0x2d, 0x00, 0x01, 0x57, 0x1b, 0x41, 0x20, 0x3d,
+            0x20, 0x2d, 0xaf, 0x08, 0x52, 0x70, 0x6f, 0x73, 0x2e, 0x7a, 0xa3, 0x09, 0x01, 0x0f, 0x11, 0x03,
+            0xa1, 0x24, 0x00, 0x50, 0x22, 0x03, 0x7f, 0x15, 0x64, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x18,
+            0x00, 0x13, 0x3c, 0xa5, 0x00, 0x05, 0xf4, 0x24, 0x01, 0x01, 0x23, 0x33, 0x20, 0x26, 0x26, 0xd6,
+            0x1b, 0x1c, 0x3e, 0x20, 0x00, 0x02, 0x14, 0x25, 0x13, 0x5b, 0x40, 0x00, 0x12, 0x5d, 0xfc, 0x0b,
+            0x00, 0xb3, 0x08, 0x03, 0x12, 0x00, 0x22, 0x2b, 0x2b, 0x7e, 0x00, 0x25, 0x69, 0x66, 0x64, 0x00,
+            0x2c, 0x3e, 0x3d, 0x45, 0x00, 0x01, 0x65, 0x00, 0x06, 0x3b, 0x00, 0x03, 0x6c, 0x12, 0x32, 0x31,
+            0x2e, 0x66, 0x3c, 0x00, 0x01, 0xee, 0x00, 0x03, 0xe5, 0x25, 0x02, 0xeb, 0x0d, 0x13, 0x28, 0x0e,
+            0x00, 0x05, 0xf3, 0x25, 0x03, 0x6e, 0x00, 0x10, 0x5d, 0x59, 0x0f, 0x00, 0x71, 0x0d, 0x04, 0xfd,
+            0x00, 0x02, 0x8d, 0x0f, 0x43, 0x29, 0x2e, 0x78, 0x79, 0x06, 0x01, 0x03, 0x5c, 0x00, 0x03, 0x2f,
+            0x04, 0x06, 0x48, 0x00, 0x02, 0xb8, 0x14, 0x14, 0x34, 0x11, 0x00, 0x00, 0x38, 0x01, 0x34, 0x78,
+            0x79, 0x2c, 0x91, 0x01, 0x14, 0x2c, 0xb2, 0x00, 0x00, 0x18, 0x00, 0x10, 0x7a, 0x9b, 0x0b, 0x02,
+            0x4e, 0x15, 0xf1, 0x01, 0x74, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x20, 0x70, 0x68,
+            0x6f, 0x6e, 0x67, 0x2d, 0x4f, 0x1d, 0x01, 0x43, 0x25, 0x62, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x4c,
+            0x55, 0x25, 0x40, 0x73, 0x20, 0x74, 0x6f, 0x5a, 0x06, 0x02, 0x53, 0x08, 0x01, 0x1f, 0x00, 0x02,
+            0x17, 0x13, 0x22, 0x41, 0x64, 0xf5, 0x25, 0x02, 0xd0, 0x01, 0x12, 0x4c, 0x6f, 0x04, 0x10, 0x20,
+            0xc3, 0x06, 0x00, 0x6e, 0x12, 0x03, 0x0f, 0x00, 0x13, 0x4e, 0x08, 0x00, 0x23, 0x56, 0x2c, 0xe2,
+            0x01, 0x05, 0x2f, 0x22, 0x04, 0x11, 0x00, 0x04, 0x27, 0x22, 0x00, 0xb4, 0x20, 0x03, 0x95, 0x02,
+            0x11, 0x33, 0x34, 0x1e, 0x39, 0x75, 0x73, 0x65, 0x14, 0x00, 0x00, 0x77, 0x1e, 0x4b, 0x75, 0x6c,
+            0x61, 0x72, 0x32, 0x02, 0x11, 0x46, 0x04, 0x15, 0xc0, 0x61, 0x6d, 0x70, 0x28, 0x64, 0x6f, 0x74,
+            0x28, 0x4e, 0x2c, 0x20, 0x4c, 0x54, 0x13, 0x00, 0x9a, 0x0f, 0x06, 0xca, 0x10, 0x03, 0x4f, 0x00,
+            0x85, 0x20, 0x2b, 0x3d, 0x20, 0x64, 0x46, 0x20, 0x2a, 0xa5, 0x00, 0x00, 0x0b, 0x00, 0x04, 0xbf,
+            0x22, 0x07, 0xae, 0x01, 0xa5, 0x68, 0x61, 0x6c, 0x66, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2b,
+            0x0b, 0x93, 0x69, 0x7a, 0x65, 0x28, 0x56, 0x20, 0x2b, 0x20, 0x4c, 0xd9, 0x0c, 0x02, 0xcd, 0x00,
+            0x10, 0x73, 0x7d, 0x00, 0x49, 0x70, 0x6f, 0x77, 0x28, 0x81, 0x00, 0x06, 0x3f, 0x00, 0x08, 0x8a,
+            0x00, 0x95, 0x2c, 0x20, 0x32, 0x35, 0x36, 0x2e, 0x66, 0x20, 0x2a, 0xf2, 0x00, 0x03, 0x4b, 0x00,
+            0x04, 0xd8, 0x00, 0x00, 0x9e, 0x00, 0x1b, 0x73, 0x9e, 0x00, 0x40, 0x28, 0x31, 0x2e, 0x30, 0xe3,
+            0x14, 0x05, 0x36, 0x01, 0x07, 0x97, 0x14, 0x41, 0x6d, 0x61, 0x69, 0x6e, 0x88, 0x14, 0x03, 0x0b,
+            0x07, 0x0f, 0xa1, 0x20, 0x00, 0x00, 0xcb, 0x02, 0x0f, 0xbe, 0x14, 0x02, 0x07, 0xed, 0x00, 0x04,
+            0x6d, 0x02, 0x02, 0x56, 0x0e, 0x01, 0x61, 0x0b, 0x07, 0x13, 0x00, 0x0f, 0x29, 0x00, 0x02, 0x00,
+            0x5e, 0x0e, 0x0b, 0x29, 0x00, 0x03, 0x64, 0x0e, 0x00, 0x5a, 0x0f, 0x12, 0x20, 0x21, 0x08, 0x12,
+            0x3d, 0x63, 0x0b, 0x01, 0x0d, 0x00, 0x05, 0x46, 0x00, 0x00, 0x49, 0x0f, 0x02, 0x89, 0x10, 0x01,
+            0x40, 0x00, 0x00, 0x1d, 0x00, 0x10, 0x79, 0xf4, 0x0a, 0x00, 0xe9, 0x0b, 0x00, 0xad, 0x00, 0x01,
+            0x2d, 0x03, 0x07, 0x7f, 0x00, 0x00, 0x52, 0x14, 0x31, 0x46, 0x64, 0x78, 0x63, 0x02, 0x11, 0x28,
+            0x33, 0x00, 0x04, 0x1d, 0x00, 0x00, 0xc7, 0x02, 0x0f, 0x32, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00,
+            0x09, 0x20, 0x0f, 0x32, 0x00, 0x0b, 0x02, 0x87, 0x00, 0x00, 0xd9, 0x0e, 0x00, 0x3e, 0x20, 0x02,
+            0x59, 0x00, 0x23, 0x75, 0x76, 0x90, 0x01, 0x05, 0xc4, 0x00, 0x05, 0x4c, 0x00, 0x01, 0x79, 0x00,
+            0x01, 0x20, 0x00, 0x03, 0x47, 0x30, 0x03, 0x79, 0x00, 0x21, 0x34, 0x20, 0x18, 0x0c, 0x04, 0xeb,
+            0x00, 0x01, 0x0d, 0x00, 0x05, 0xeb, 0x00, 0x03, 0x7e, 0x28, 0x02, 0xb7, 0x0d, 0x00, 0xe5, 0x19,
+            0x06, 0x03, 0x0c, 0x03, 0x0e, 0x00, 0x05, 0xf6, 0x0b, 0x73, 0x2c, 0x20, 0x66, 0x69, 0x6e, 0x61,
+            0x6c, 0x9f, 0x0d, 0x03, 0x88, 0x11, 0x0f, 0xa9, 0x0f, 0x0e, 0x01, 0x0a, 0x01, 0x02, 0x5f, 0x00,
+            0x09, 0xa7, 0x02, 0x01, 0xae, 0x00, 0x07, 0x1d, 0x00, 0x03, 0xd7, 0x00, 0x02, 0x58, 0x0d, 0x01,
+            0x53, 0x0d, 0x00, 0xbf, 0x00, 0x00, 0x04, 0x00, 0x07, 0x25, 0x00, 0x09, 0x42, 0x00, 0x02, 0x71,
+            0x0e, 0x01, 0x1e, 0x00, 0x01, 0x4f, 0x1b, 0x13, 0x78, 0xb1, 0x00, 0x01, 0x0d, 0x00, 0x10, 0x79,
+            0x7a, 0x01, 0x01, 0xe6, 0x12, 0x0e, 0x30, 0x0e, 0x00, 0x6b, 0x05, 0x03, 0xfc, 0x06, 0x03, 0x81,
+            0x0b, 0x02, 0x18, 0x05, 0x06, 0x3e, 0x0e, 0x01, 0x55, 0x00, 0x03, 0x07, 0x01, 0x09, 0x74, 0x00,
+            0x06, 0xb6, 0x00, 0x03, 0x1e, 0x00, 0x03, 0xb7, 0x00, 0x05, 0xa8, 0x00, 0x05, 0x2e, 0x01, 0x0f,
+            0x37, 0x00, 0x04, 0x05, 0x20, 0x00, 0x03, 0x39, 0x00, 0x0b, 0xf0, 0x00, 0x0f, 0x83, 0x00, 0x10,
+            0x0c, 0xf7, 0x00, 0x13, 0x79, 0xf7, 0x00, 0x02, 0x64, 0x01, 0x00, 0xcf, 0x0f, 0x00, 0xb0, 0x02,
+            0x11, 0x78, 0x34, 0x18, 0x07, 0x2c, 0x00, 0x02, 0x1f, 0x00, 0x03, 0x2c, 0x00, 0x01, 0x23, 0x01,
+            0x01, 0xc2, 0x18, 0x00, 0x2c, 0x00, 0x24, 0x79, 0x2e, 0x8b, 0x13, 0x0f, 0xc7, 0x00, 0x02, 0x0f,
+            0x45, 0x00, 0x05, 0x0a, 0x02, 0x01, 0x02, 0xc9, 0x00, 0x00, 0x5c, 0x10, 0x42, 0x20, 0x54, 0x42,
+            0x4e, 0xde, 0x0e, 0x02, 0x67, 0x10, 0x0f, 0x50, 0x02, 0x07, 0x01, 0x67, 0x01, 0x02, 0x99, 0x00,
+            0x03, 0x0f, 0x01, 0x06, 0x4f, 0x02, 0x07, 0x8a, 0x08, 0x0d, 0x9e, 0x01, 0x00, 0x73, 0x2e, 0x02,
+            0x37, 0x00, 0x10, 0x5f, 0x2b, 0x0a, 0x02, 0x50, 0x0a, 0x24, 0x20, 0x3d, 0x3d, 0x0b, 0x00, 0x7b,
+            0x0a, 0x03, 0xe0, 0x01, 0x32, 0x4d, 0x41, 0x50, 0x0a, 0x08, 0x37, 0x5f, 0x75, 0x76, 0xa2, 0x06,
+            0x00, 0xe8, 0x00, 0x0f, 0x41, 0x00, 0x01, 0x0e, 0x14, 0x00, 0x11, 0x2a, 0x1b, 0x16, 0x07, 0xe0,
+            0x15, 0x00, 0x3b, 0x00, 0x08, 0x08, 0x03, 0x09, 0xe8, 0x01, 0x02, 0x40, 0x00, 0x00, 0x86, 0x05,
+            0x00, 0x04, 0x01, 0x13, 0x2a, 0x50, 0x12, 0x07, 0xa5, 0x00, 0x00, 0x9f, 0x01, 0x04, 0x84, 0x0e,
+            0x12, 0x2e, 0x2e, 0x00, 0x00, 0x42, 0x28, 0x00, 0xed, 0x15, 0x00, 0x17, 0x17, 0x02, 0x12, 0x00,
+            0x32, 0x20, 0x2a, 0x20, 0xaa, 0x05, 0x02, 0x39, 0x1a, 0x0f, 0x30, 0x00, 0x00, 0x01, 0x0e, 0x16,
+            0x03, 0x78, 0x07, 0x02, 0xcb, 0x03, 0x02, 0x7f, 0x01, 0x09, 0x38, 0x03, 0x0b, 0xa6, 0x00, 0x07,
+            0x6d, 0x01, 0x06, 0xbc, 0x03, 0x0f, 0x52, 0x14, 0x07, 0x27, 0x69, 0x66, 0xa4, 0x0a, 0x04, 0xa7,
+            0x09, 0x02, 0x8a, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x00, 0x01, 0x4a, 0x04, 0x29, 0x20, 0x2a,
+            0x78, 0x01, 0x06, 0x34, 0x00, 0x06, 0x78, 0x01, 0x08, 0xa2, 0x00, 0x05, 0x34, 0x00, 0x05, 0xd6,
+            0x00, 0x01, 0x12, 0x00, 0x00, 0x05, 0x01, 0x02, 0x27, 0x00, 0x02, 0xb3, 0x06, 0x05, 0x4a, 0x06,
+            0x02, 0x49, 0x02, 0x02, 0xff, 0x0c, 0x05, 0x15, 0x00, 0x0c, 0x2e, 0x00, 0x04, 0xab, 0x06, 0x08,
+            0x2d, 0x00, 0x04, 0x14, 0x00, 0x0c, 0x2c, 0x00, 0x03, 0xab, 0x30, 0x06, 0xd8, 0x29, 0x08, 0x35,
+            0x00, 0x0d, 0x1d, 0x00, 0x06, 0x3e, 0x00, 0x24, 0x69, 0x66, 0x98, 0x0a, 0x05, 0x0d, 0x01, 0x00,
+            0x96, 0x29, 0x03, 0x29, 0x2b, 0x00, 0xe1, 0x2e, 0x63, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0xef,
+            0x26, 0xd3, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x4d,
+            0x10, 0x63, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0xe1, 0x26, 0x01, 0x9c, 0x04, 0x07, 0xef, 0x03,
+            0x00, 0xd4, 0x02, 0x00, 0xd7, 0x35, 0x09, 0x4e, 0x01, 0x03, 0x72, 0x00, 0x06, 0x4b, 0x01, 0x33,
+            0x2e, 0x72, 0x67, 0x51, 0x16, 0x00, 0x81, 0x01, 0x0d, 0xaf, 0x00, 0x00, 0x8d, 0x01, 0x43, 0x6f,
+            0x72, 0x6d, 0x2e, 0x60, 0x31, 0x00, 0x24, 0x00, 0x05, 0x35, 0x01, 0x04, 0x1c, 0x00, 0x12, 0x67,
+            0x68, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x24, 0x01, 0x04, 0x1b, 0x00, 0x03, 0x5b, 0x00, 0x0b, 0x4c,
+            0x02, 0x06, 0xa5, 0x00, 0x2a, 0x69, 0x66, 0x82, 0x0c, 0x05, 0x0a, 0x01, 0x01, 0xcd, 0x00, 0x00,
+            0x52, 0x00, 0x06, 0x2c, 0x00, 0x00, 0x0e, 0x00, 0x09, 0x7c, 0x00, 0x07, 0x18, 0x0e, 0x09, 0x45,
+            0x00, 0x08, 0xdd, 0x00, 0x06, 0x9b, 0x00, 0x02, 0x84, 0x00, 0x00, 0x45, 0x00, 0x29, 0x69, 0x66,
+            0xbf, 0x0c, 0x0f, 0x74, 0x00, 0x0d, 0x08, 0xd4, 0x00, 0x07, 0x73, 0x00, 0x08, 0x43, 0x00, 0x0f,
+            0x72, 0x00, 0x10, 0x0f, 0xbe, 0x0c, 0x02, 0x0f, 0x7b, 0x00, 0x0d, 0x0f, 0x8f, 0x01, 0x02, 0x07,
+            0x84, 0x00, 0x0f, 0x55, 0x00, 0x02, 0x0f, 0x8d, 0x00, 0x09, 0x12, 0x7d, 0x71, 0x1c, 0x01, 0x6f,
+            0x08, 0x10, 0x56, 0x70, 0x0c, 0x02, 0x20, 0x04, 0x00, 0x60, 0x04, 0x00, 0x14, 0x00, 0x02, 0x12,
+            0x08, 0x01, 0xd8, 0x03, 0x30, 0x70, 0x6f, 0x73, 0xf1, 0x06, 0x00, 0x30, 0x01, 0x00, 0x1a, 0x00,
+            0x32, 0x20, 0x64, 0x4c, 0x6a, 0x18, 0x17, 0x33, 0x41, 0x18, 0x01, 0x19, 0x00, 0x1f, 0x73, 0x19,
+            0x00, 0x00, 0x02, 0x73, 0x03, 0x02, 0xef, 0x0b, 0x1f, 0x20, 0x39, 0x0c, 0x03, 0x8f, 0x20, 0x21,
+            0x3d, 0x20, 0x30, 0x75, 0x20, 0x3f, 0x28, 0x0d, 0x04, 0x0c, 0x8a, 0x00, 0x26, 0x20, 0x3a, 0x11,
+            0x1b, 0x06, 0x81, 0x0b, 0x00, 0xe2, 0x04, 0x01, 0x9a, 0x0b, 0x05, 0x45, 0x00, 0x03, 0x03, 0x30,
+            0x01, 0x39, 0x25, 0x23, 0x20, 0x2a, 0x01, 0x0c, 0x0a, 0x68, 0x08, 0x40, 0x2c, 0x20, 0x56, 0x2c,
+            0x98, 0x27, 0x04, 0xa3, 0x2e, 0x04, 0xe0, 0x01, 0x74, 0x2c, 0x20, 0x64, 0x4c, 0x2c, 0x20, 0x73,
+            0xea, 0x0a, 0x00, 0xfc, 0x0c, 0x02, 0xe5, 0x31, 0x01, 0x08, 0x34, 0x22, 0x2e, 0x7a, 0xb2, 0x00,
+            0x02, 0xb1, 0x04, 0x06, 0x96, 0x02, 0x01, 0x04, 0x01, 0x04, 0x32, 0x01, 0x04, 0x23, 0x01, 0x06,
+            0xd5, 0x07, 0x00, 0x47, 0x01, 0x06, 0x84, 0x02, 0x01, 0xce, 0x0d, 0x01, 0xf9, 0x33, 0x00, 0xe7,
+            0x18, 0xc7, 0x69, 0x6e, 0x74, 0x28, 0x6d, 0x61, 0x78, 0x28, 0x6c, 0x6f, 0x67, 0x28, 0xf9, 0x0d,
+            0x00, 0xd2, 0x05, 0x00, 0x4b, 0x2f, 0x00, 0x82, 0x34, 0x01, 0x2c, 0x00, 0x02, 0x25, 0x34, 0x25,
+            0x20, 0x2b, 0xf5, 0x30, 0x02, 0x16, 0x00, 0x00, 0x06, 0x13, 0x01, 0xb7, 0x05, 0x04, 0xa8, 0x01,
+            0x00, 0xac, 0x01, 0x01, 0x3a, 0x1e, 0x50, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x86, 0x04, 0x31, 0x69,
+            0x6e, 0x28, 0x11, 0x00, 0x01, 0x06, 0x00, 0x0e, 0x84, 0x1f, 0x01, 0x17, 0x06, 0x06, 0xeb, 0x34,
+            0x00, 0xa0, 0x21, 0x17, 0x2f, 0xae, 0x39, 0x12, 0x2c, 0xe3, 0x34, 0x10, 0x29, 0x95, 0x1d, 0x06,
+            0x26, 0x00, 0x20, 0x20, 0x2d, 0xa7, 0x38, 0x07, 0xd4, 0x00, 0x01, 0x38, 0x0a, 0x03, 0xb1, 0x00,
+            0x01, 0x94, 0x0c, 0x01, 0x2c, 0x00, 0x20, 0x73, 0x5b, 0x85, 0x00, 0x02, 0x34, 0x08, 0x08, 0x47,
+            0x01, 0x00, 0x42, 0x13, 0x11, 0x28, 0x1b, 0x00, 0x00, 0x77, 0x20, 0x03, 0x37, 0x00, 0x02, 0x62,
+            0x01, 0x00, 0x40, 0x13, 0x01, 0x1a, 0x00, 0x23, 0x7a, 0x29, 0x66, 0x1f, 0x00, 0xd2, 0x00, 0x00,
+            0x1b, 0x19, 0x01, 0x38, 0x01, 0x00, 0x08, 0x1e, 0x03, 0x30, 0x00, 0x22, 0x2e, 0x78, 0x10, 0x1e,
+            0x05, 0x0f, 0x00, 0x06, 0x1d, 0x01, 0x27, 0x2e, 0x79, 0x24, 0x1e, 0x00, 0x40, 0x00, 0x06, 0xab,
+            0x01, 0x00, 0x0e, 0x00, 0x01, 0xde, 0x31, 0x00, 0xb2, 0x29, 0x03, 0x2b, 0x32, 0x12, 0x3d, 0x08,
+            0x00, 0x23, 0x73, 0x5b, 0x4b, 0x00, 0x0b, 0xdf, 0x31, 0x27, 0x69, 0x5d, 0x8a, 0x00, 0x00, 0x40,
+            0x00, 0x01, 0xef, 0x01, 0x00, 0xf2, 0x02, 0x01, 0x77, 0x02, 0x14, 0x2e, 0xf9, 0x01, 0x01, 0x86,
+            0x1c, 0x25, 0x20, 0x2d, 0xde, 0x0f, 0x06, 0x1f, 0x01, 0x00, 0x35, 0x00, 0x02, 0x0f, 0x03, 0x40,
+            0x64, 0x69, 0x73, 0x74, 0xff, 0x21, 0x00, 0xaf, 0x0d, 0x10, 0x4c, 0xaf, 0x0d, 0x0f, 0x25, 0x00,
+            0x01, 0x01, 0x11, 0x34, 0x00, 0x26, 0x00, 0x02, 0x60, 0x00, 0x01, 0x0f, 0x00, 0x22, 0x20, 0x2a,
+            0xa5, 0x00, 0x02, 0x0e, 0x00, 0x0a, 0x36, 0x00, 0x32, 0x69, 0x66, 0x28, 0x58, 0x00, 0x31, 0x3e,
+            0x3d, 0x20, 0x1f, 0x00, 0x12, 0x32, 0xa1, 0x02, 0x00, 0x77, 0x00, 0x04, 0x04, 0x00, 0x73, 0x63,
+            0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x68, 0x34, 0x04, 0x16, 0x00, 0x10, 0x4c, 0xa4, 0x05, 0x03,
+            0xcc, 0x1a, 0x42, 0x73, 0x71, 0x72, 0x74, 0x48, 0x00, 0x03, 0x36, 0x09, 0x04, 0x25, 0x00, 0x24,
+            0x2f, 0x2f, 0xb0, 0x23, 0x40, 0x20, 0x73, 0x71, 0x75, 0x5c, 0x2e, 0xb1, 0x66, 0x61, 0x6c, 0x6c,
+            0x6f, 0x66, 0x66, 0x20, 0x77, 0x69, 0x6e, 0x17, 0x11, 0x00, 0xb4, 0x13, 0x11, 0x72, 0x47, 0x35,
+            0x40, 0x7a, 0x65, 0x72, 0x6f, 0x79, 0x24, 0x00, 0x96, 0x15, 0x01, 0xbe, 0x00, 0x22, 0x27, 0x73,
+            0x93, 0x00, 0x05, 0xcc, 0x05, 0x00, 0x56, 0x00, 0x02, 0x0c, 0x01, 0x02, 0x3e, 0x00, 0x01, 0x2e,
+            0x02, 0x00, 0x41, 0x0e, 0x02, 0x97, 0x08, 0x02, 0x82, 0x00, 0x00, 0x2b, 0x20, 0x00, 0x2a, 0x01,
+            0x52, 0x29, 0x20, 0x2f, 0x20, 0x28, 0xd3, 0x00, 0x00, 0xaf, 0x0e, 0x00, 0x34, 0x19, 0x18, 0x32,
+            0x58, 0x0e, 0x0a, 0x08, 0x01, 0x02, 0x57, 0x00, 0x64, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x75, 0x1d,
+            0x2c, 0x03, 0x65, 0x00, 0x13, 0x2a, 0xac, 0x00, 0x00, 0x50, 0x00, 0x02, 0x2c, 0x01, 0x10, 0x2b,
+            0x4c, 0x04, 0x0b, 0xea, 0x00, 0x31, 0x69, 0x66, 0x28, 0xb5, 0x00, 0x15, 0x2e, 0x22, 0x35, 0x01,
+            0x72, 0x35, 0x50, 0x20, 0x3e, 0x3d, 0x20, 0x2d, 0x51, 0x0f, 0x09, 0xc5, 0x00, 0x00, 0xc9, 0x00,
+            0x08, 0x6c, 0x00, 0xdf, 0x2a, 0x3d, 0x20, 0x73, 0x6d, 0x6f, 0x6f, 0x74, 0x68, 0x73, 0x74, 0x65,
+            0x70, 0x48, 0x00, 0x02, 0x03, 0x98, 0x04, 0x06, 0x5e, 0x00, 0x01, 0x80, 0x35, 0x11, 0x2c, 0x0d,
+            0x02, 0x24, 0x2d, 0x4c, 0x1e, 0x00, 0x01, 0x4f, 0x02, 0x05, 0xb8, 0x35, 0x08, 0xd8, 0x03, 0x00,
+            0x72, 0x00, 0x05, 0xf8, 0x04, 0x05, 0x30, 0x00, 0x01, 0xea, 0x08, 0x20, 0x20, 0x2a, 0xd1, 0x3c,
+            0x04, 0xf8, 0x00, 0x0f, 0xec, 0x04, 0x22, 0x00, 0x5e, 0x00, 0x02, 0x20, 0x07, 0x02, 0x06, 0x00,
+            0x01, 0xe6, 0x02, 0x10, 0x61, 0xe7, 0x02, 0x03, 0x82, 0x06, 0x01, 0x37, 0x03, 0x00, 0x69, 0x00,
+            0x0c, 0xec, 0x08, 0x02, 0x86, 0x01, 0x05, 0x4c, 0x13, 0x02, 0x01, 0x05, 0x90, 0x34, 0x28, 0x73,
+            0x4c, 0x20, 0x2b, 0x20, 0x28, 0x64, 0x06, 0x00, 0x20, 0x61, 0x4c, 0xd1, 0x04, 0x00, 0x52, 0x00,
+            0x11, 0x28, 0xaf, 0x00, 0x00, 0x4f, 0x04, 0xb0, 0x6f, 0x6c, 0x6f, 0x72, 0x2e, 0x61, 0x29, 0x3b,
+            0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_1[] = {
+            0xf2, 0x1f, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x23,
+            0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x42, 0x52, 0x44, 0x46, 0x5f, 0x54, 0x45, 0x58, 0x54,
+            0x55, 0x52, 0x45, 0x5f, 0x41, 0x52, 0x52, 0x41, 0x59, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66,
+            0x1a, 0x00, 0xf1, 0x00, 0x42, 0x49, 0x4e, 0x44, 0x4c, 0x45, 0x53, 0x53, 0x0a, 0x23, 0x65, 0x78,
+            0x74, 0x65, 0x6e, 0x3f, 0x00, 0xf0, 0x2a, 0x47, 0x4c, 0x5f, 0x41, 0x52, 0x42, 0x5f, 0x62, 0x69,
+            0x6e, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3a,
+            0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a,
+            0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x31, 0x34, 0x30, 0x2c, 0x20,
+            0x32, 0x00, 0xf2, 0x0b, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x75, 0x6e, 0x69,
+            0x66, 0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x55, 0x10, 0x00,
+            0xf0, 0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x69,
+            0x6e, 0xb3, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, 0x17, 0x00, 0x0b, 0x0f, 0x00,
+            0xa2, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x24, 0x00, 0xc6, 0x75, 0x76,
+            0x65, 0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x16, 0x00, 0xf3, 0x39, 0x66, 0x6c,
+            0x6f, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x3b, 0x0a, 0x7d, 0x3b,
+            0x0a, 0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65,
+            0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20,
+            0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62, 0x79, 0x20,
+            0x53, 0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xd2, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2c, 0x20,
+            0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x4c, 0x01, 0x10, 0x73, 0x51, 0x00, 0xf1, 0x20, 0x41, 0x54,
+            0x54, 0x52, 0x49, 0x42, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+            0x65, 0x20, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x21, 0x00, 0x70,
+            0x6d, 0x65, 0x73, 0x68, 0x20, 0x62, 0x65, 0x1b, 0x01, 0x50, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x82,
+            0x01, 0x10, 0x6e, 0x83, 0x01, 0x07, 0x4d, 0x00, 0x05, 0xb1, 0x01, 0x07, 0x14, 0x00, 0x34, 0x20,
+            0x30, 0x75, 0x6b, 0x01, 0x04, 0xcf, 0x01, 0x03, 0x1e, 0x00, 0xf3, 0x01, 0x45, 0x4e, 0x41, 0x42,
+            0x4c, 0x45, 0x44, 0x28, 0x69, 0x64, 0x78, 0x29, 0x20, 0x28, 0x28, 0x28, 0x17, 0x00, 0x01, 0x96,
+            0x00, 0x31, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x3d, 0x3d,
+            0x07, 0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74,
+            0x20, 0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7, 0x01, 0x18, 0x3b, 0x18, 0x00, 0x53, 0x43,
+            0x4f, 0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20, 0x2b, 0x28, 0x00, 0x09, 0x24, 0x00, 0x27,
+            0x55, 0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23, 0x00, 0x67, 0x4e, 0x4f, 0x52, 0x4d, 0x41,
+            0x4c, 0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00, 0x77, 0x54, 0x41, 0x4e, 0x47, 0x45, 0x4e,
+            0x54, 0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00, 0xf7, 0x03, 0x49, 0x4e, 0x53, 0x54, 0x41,
+            0x4e, 0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46, 0x4f, 0x52, 0x4d, 0x34, 0x00, 0x07,
+            0x46, 0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x3d, 0x00, 0x3f,
+            0x34, 0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00, 0x03, 0x65, 0x4d, 0x41, 0x54, 0x45, 0x52,
+            0x49, 0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00, 0x02, 0x09, 0x47, 0x00, 0x38, 0x4e, 0x45,
+            0x58, 0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00, 0x30, 0x3b, 0x0a, 0x0a, 0x5e, 0x02, 0x90,
+            0x77, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x7d, 0x01, 0x25, 0x2c, 0x20, 0xf5, 0x00,
+            0x2d, 0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x00, 0xf3, 0x00, 0x20,
+            0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0xd6, 0x01,
+            0x43, 0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31, 0x02, 0x33, 0x20, 0x3d, 0x20, 0x2b, 0x02,
+            0x03, 0x11, 0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44, 0x58, 0x29, 0xb4, 0x00, 0x01, 0x36,
+            0x00, 0x24, 0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02, 0xd0, 0x01, 0x0a, 0x30, 0x00, 0x03,
+            0xbf, 0x01, 0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d, 0x68, 0x00, 0x04, 0xc3, 0x01, 0x0f,
+            0x39, 0x00, 0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x0f, 0x72, 0x04, 0x07, 0x17, 0x31, 0x72,
+            0x04, 0x5b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x70, 0x04, 0xd0, 0x76, 0x65, 0x63, 0x33, 0x20, 0x61,
+            0x6d, 0x62, 0x69, 0x65, 0x6e, 0x74, 0x4c, 0x20, 0x00, 0x03, 0x4c, 0x04, 0x00, 0x11, 0x03, 0x52,
+            0x5f, 0x70, 0x61, 0x64, 0x31, 0x10, 0x00, 0x01, 0x27, 0x00, 0x01, 0x40, 0x00, 0x52, 0x43, 0x6f,
+            0x6c, 0x6f, 0x72, 0x15, 0x00, 0x02, 0x5b, 0x04, 0x00, 0x26, 0x00, 0x12, 0x32, 0x11, 0x00, 0x01,
+            0x26, 0x00, 0x00, 0xa6, 0x04, 0x11, 0x5f, 0x2b, 0x00, 0x38, 0x44, 0x69, 0x72, 0xa0, 0x04, 0x06,
+            0x2f, 0x00, 0x12, 0x33, 0x2f, 0x00, 0x00, 0xb1, 0x04, 0xf1, 0x0e, 0x33, 0x20, 0x63, 0x6c, 0x75,
+            0x73, 0x74, 0x65, 0x72, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x69,
+            0x6c, 0x65, 0x73, 0x20, 0x78, 0x2c, 0x20, 0x79, 0xcc, 0x01, 0xf4, 0x0a, 0x64, 0x65, 0x70, 0x74,
+            0x68, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x73, 0x2c, 0x20, 0x7a, 0x20, 0x69, 0x73, 0x20, 0x30,
+            0x20, 0x77, 0x68, 0x65, 0x6e, 0x3a, 0x00, 0x31, 0x65, 0x64, 0x20, 0x6f, 0x00, 0x02, 0xcd, 0x04,
+            0x31, 0x6f, 0x66, 0x66, 0x32, 0x05, 0x02, 0x6e, 0x00, 0x04, 0x5d, 0x00, 0x01, 0x3f, 0x00, 0x62,
+            0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x7c, 0x00, 0x0f, 0x1f, 0x00, 0x01, 0x02, 0x21, 0x05, 0x00,
+            0x86, 0x05, 0x01, 0x10, 0x04, 0xf1, 0x05, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x5f, 0x63, 0x61,
+            0x73, 0x63, 0x61, 0x64, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0xa1, 0x00, 0x03, 0x7f, 0x00,
+            0x02, 0x20, 0x00, 0x06, 0x76, 0x00, 0x21, 0x7d, 0x3b, 0xac, 0x02, 0x14, 0x64, 0xf6, 0x00, 0x22,
+            0x61, 0x6c, 0x98, 0x00, 0x04, 0x29, 0x00, 0x72, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20, 0x43, 0x4f,
+            0x00, 0x10, 0x64, 0x56, 0x05, 0x63, 0x6f, 0x77, 0x4d, 0x61, 0x70, 0x73, 0x96, 0x02, 0x01, 0x74,
+            0x00, 0xff, 0x09, 0x4d, 0x41, 0x58, 0x5f, 0x53, 0x48, 0x41, 0x44, 0x4f, 0x57, 0x5f, 0x43, 0x41,
+            0x53, 0x43, 0x41, 0x44, 0x45, 0x53, 0x20, 0x3d, 0x20, 0x34, 0x3b, 0xe1, 0x01, 0x07, 0x17, 0x32,
+            0xe1, 0x01, 0x02, 0x69, 0x00, 0x0b, 0xe2, 0x01, 0x01, 0x52, 0x06, 0x02, 0x1a, 0x00, 0x50, 0x5f,
+            0x6d, 0x61, 0x74, 0x72, 0x48, 0x01, 0x1f, 0x5b, 0x68, 0x00, 0x00, 0x11, 0x5d, 0xdc, 0x00, 0x00,
+            0xbe, 0x01, 0x93, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x74, 0x6f, 0xba, 0x00, 0x54, 0x20,
+            0x6d, 0x61, 0x70, 0x20, 0xee, 0x06, 0x01, 0x1c, 0x00, 0x01, 0x62, 0x01, 0x43, 0x76, 0x65, 0x63,
+            0x34, 0x22, 0x00, 0x05, 0x25, 0x01, 0x61, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x4a, 0x00, 0x32,
+            0x66, 0x61, 0x72, 0x4e, 0x00, 0x02, 0xc1, 0x01, 0x83, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68,
+            0x20, 0x4f, 0x01, 0x00, 0x88, 0x06, 0x00, 0xda, 0x03, 0x03, 0xa1, 0x01, 0x50, 0x65, 0x64, 0x20,
+            0x70, 0x6f, 0x74, 0x02, 0x00, 0xbe, 0x03, 0x42, 0x73, 0x70, 0x6f, 0x74, 0x3b, 0x01, 0x04, 0x34,
+            0x01, 0x02, 0x23, 0x02, 0x21, 0x65, 0x64, 0xa2, 0x02, 0xb1, 0x69, 0x6e, 0x67, 0x0a, 0x73, 0x74,
+            0x72, 0x75, 0x63, 0x74, 0x20, 0x10, 0x00, 0x43, 0x44, 0x61, 0x74, 0x61, 0x3e, 0x07, 0x06, 0x81,
+            0x02, 0x4c, 0x70, 0x6f, 0x73, 0x69, 0x05, 0x07, 0x43, 0x72, 0x61, 0x6e, 0x67, 0xff, 0x01, 0x01,
+            0x29, 0x00, 0x1c, 0x63, 0xcb, 0x02, 0x00, 0x79, 0x00, 0xa1, 0x5f, 0x63, 0x6f, 0x73, 0x5f, 0x6f,
+            0x75, 0x74, 0x65, 0x72, 0xc6, 0x00, 0xc3, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x2d, 0x31, 0x20,
+            0x66, 0x6f, 0x72, 0xa3, 0x00, 0x02, 0x6d, 0x02, 0x04, 0x03, 0x01, 0x11, 0x33, 0xe5, 0x00, 0x15,
+            0x5f, 0xf6, 0x01, 0x08, 0x5f, 0x02, 0x05, 0x50, 0x00, 0x51, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x7c,
+            0x07, 0x06, 0x1b, 0x08, 0x29, 0x34, 0x33, 0x1b, 0x08, 0xf3, 0x05, 0x31, 0x29, 0x20, 0x72, 0x65,
+            0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x5f, 0x1d,
+            0x01, 0x01, 0xe6, 0x00, 0x04, 0x21, 0x08, 0x01, 0x0d, 0x00, 0x00, 0xf3, 0x00, 0x03, 0x22, 0x01,
+            0x2f, 0x5b, 0x5d, 0x58, 0x00, 0x0b, 0x1f, 0x32, 0x58, 0x00, 0x07, 0x04, 0x53, 0x00, 0x00, 0x88,
+            0x03, 0x14, 0x32, 0x4e, 0x03, 0x22, 0x73, 0x5b, 0x09, 0x02, 0xb4, 0x6f, 0x66, 0x66, 0x73, 0x65,
+            0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x1b, 0x00, 0x02, 0xd6, 0x03, 0x40, 0x5f, 0x69, 0x6e, 0x64,
+            0x44, 0x02, 0x12, 0x2c, 0x81, 0x00, 0x11, 0x20, 0x18, 0x03, 0x00, 0xcf, 0x01, 0x0f, 0xdb, 0x00,
+            0x06, 0x1f, 0x33, 0x83, 0x00, 0x07, 0x01, 0xce, 0x00, 0x12, 0x49, 0x51, 0x00, 0x03, 0xc4, 0x01,
+            0x01, 0x08, 0x03, 0x03, 0xfa, 0x00, 0x0a, 0x72, 0x00, 0x03, 0xeb, 0x00, 0x08, 0x30, 0x03, 0xad,
+            0x41, 0x4c, 0x42, 0x45, 0x44, 0x4f, 0x5f, 0x4d, 0x41, 0x50, 0xb7, 0x07, 0x93, 0x52, 0x4f, 0x55,
+            0x47, 0x48, 0x4e, 0x45, 0x53, 0x53, 0x1e, 0x00, 0x07, 0x2b, 0x00, 0x34, 0x2b, 0x20, 0x31, 0xd6,
+            0x05, 0x01, 0x6e, 0x00, 0x83, 0x4d, 0x45, 0x54, 0x41, 0x4c, 0x4c, 0x49, 0x43, 0x2a, 0x00, 0x0a,
+            0x3a, 0x00, 0x0c, 0x2d, 0x00, 0x03, 0xb3, 0x05, 0x02, 0x73, 0x00, 0x09, 0x3a, 0x00, 0x0c, 0x2a,
+            0x00, 0x40, 0x41, 0x4d, 0x42, 0x49, 0xce, 0x07, 0x93, 0x4f, 0x43, 0x43, 0x4c, 0x55, 0x53, 0x49,
+            0x4f, 0x4e, 0x60, 0x00, 0x07, 0x42, 0x00, 0x0c, 0x33, 0x00, 0x00, 0xc9, 0x07, 0x02, 0x5a, 0x00,
+            0x0f, 0x3d, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x24, 0x05, 0x20, 0x4f, 0x63, 0x22, 0x01, 0xf8,
+            0x17, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x52, 0x6f, 0x75, 0x67, 0x68, 0x6e, 0x65, 0x73, 0x73, 0x2c,
+            0x20, 0x4d, 0x65, 0x74, 0x61, 0x6c, 0x6c, 0x69, 0x63, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x64,
+            0x20, 0x69, 0x6e, 0x20, 0x52, 0x47, 0x42, 0x30, 0x01, 0x01, 0x74, 0x07, 0x02, 0x61, 0x00, 0x04,
+            0x6b, 0x00, 0x00, 0x53, 0x00, 0x04, 0x5f, 0x04, 0x06, 0xaa, 0x0a, 0x04, 0x29, 0x00, 0x06, 0x5e,
+            0x04, 0xe2, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x41, 0x72, 0x72, 0x61, 0x79,
+            0xbf, 0x04, 0x04, 0xff, 0x03, 0x31, 0x6d, 0x61, 0x70, 0x2e, 0x03, 0x80, 0x46, 0x72, 0x61, 0x67,
+            0x6d, 0x65, 0x6e, 0x74, 0x1e, 0x00, 0x20, 0x65, 0x72, 0x64, 0x0b, 0x23, 0x3a, 0x3a, 0xcf, 0x04,
+            0x94, 0x4d, 0x41, 0x50, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x0a, 0xbc, 0x03, 0x80, 0x4d, 0x61, 0x74,
+            0x65, 0x72, 0x69, 0x61, 0x6c, 0xcc, 0x02, 0x03, 0xfb, 0x01, 0x01, 0x52, 0x04, 0x01, 0x96, 0x03,
+            0x48, 0x5f, 0x6d, 0x6f, 0x64, 0x4a, 0x03, 0x14, 0x72, 0xe5, 0x00, 0x0c, 0x19, 0x00, 0x13, 0x6d,
+            0xf3, 0x00, 0x0c, 0x18, 0x00, 0x03, 0xd3, 0x06, 0x24, 0x5f, 0x6f, 0x29, 0x01, 0x0c, 0x21, 0x00,
+            0x66, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x16, 0x00, 0x01, 0x09, 0x02, 0x02, 0xb3, 0x0a, 0x04,
+            0xda, 0x0b, 0x14, 0x5f, 0xb1, 0x0a, 0x01, 0xdc, 0x00, 0x62, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+            0xdb, 0x0a, 0x12, 0x76, 0x3f, 0x0b, 0x31, 0x20, 0x6f, 0x6e, 0xc9, 0x0a, 0x81, 0x43, 0x50, 0x55,
+            0x20, 0x73, 0x69, 0x64, 0x65, 0x14, 0x04, 0x01, 0x49, 0x00, 0x00, 0x15, 0x07, 0x40, 0x5b, 0x33,
+            0x5d, 0x3b, 0x4d, 0x06, 0x20, 0x20, 0x20, 0xb2, 0x01, 0x0f, 0x1b, 0x01, 0x01, 0x04, 0x03, 0x01,
+            0x03, 0xb2, 0x05, 0x00, 0x0a, 0x01, 0x30, 0x3a, 0x3a, 0x5f, 0x3c, 0x00, 0x01, 0x4a, 0x00, 0x00,
+            0x10, 0x05, 0xc0, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x5b, 0x38, 0x4f,
+            0x00, 0x39, 0x2f, 0x2f, 0x20, 0xb6, 0x0c, 0x17, 0x53, 0x8c, 0x00, 0x21, 0x6c, 0x79, 0x37, 0x00,
+            0x02, 0xcf, 0x03, 0x00, 0x39, 0x00, 0x21, 0x68, 0x61, 0xab, 0x0c, 0x01, 0x3a, 0x00, 0x34, 0x2f,
+            0x2f, 0x20, 0xd5, 0x0c, 0x09, 0x33, 0x00, 0x42, 0x2c, 0x20, 0x30, 0x20, 0x28, 0x00, 0x01, 0xe3,
+            0x04, 0x60, 0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0xf2, 0x05, 0x10, 0x73, 0xd4, 0x03, 0xd0, 0x2f,
+            0x2f, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x65, 0x67, 0x69, 0xa7, 0x07, 0x01, 0x1c,
+            0x00, 0x02, 0xb9, 0x01, 0x90, 0x2c, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x64, 0x25, 0x0c,
+            0x00, 0xf1, 0x0b, 0xc0, 0x70, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65,
+            0xc9, 0x0c, 0x01, 0xdf, 0x01, 0x02, 0x25, 0x00, 0x04, 0x61, 0x02, 0x0e, 0xf8, 0x04, 0x1f, 0x30,
+            0x1d, 0x04, 0x00, 0x13, 0x6d, 0x1b, 0x02, 0x04, 0xa1, 0x04, 0x04, 0x28, 0x01, 0x00, 0x21, 0x01,
+            0x05, 0x59, 0x00, 0x00, 0xa9, 0x04, 0x03, 0xa3, 0x00, 0xf2, 0x09, 0x56, 0x49, 0x53, 0x49, 0x42,
+            0x49, 0x4c, 0x49, 0x54, 0x59, 0x5f, 0x52, 0x45, 0x53, 0x4f, 0x4c, 0x56, 0x45, 0x20, 0x62, 0x75,
+            0x69, 0x6c, 0x64, 0xad, 0x01, 0x01, 0x12, 0x0d, 0x70, 0x76, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73,
+            0x7b, 0x0c, 0xb1, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x42, 0x68, 0x05,
+            0x04, 0xce, 0x0c, 0xf0, 0x04, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x76, 0x65, 0x72, 0x74,
+            0x65, 0x78, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0xef, 0x01, 0x11, 0x6f, 0x98, 0x05, 0x10, 0x2c,
+            0xad, 0x06, 0x00, 0xe5, 0x00, 0x21, 0x69, 0x6e, 0x17, 0x00, 0x02, 0x18, 0x06, 0x00, 0x3e, 0x0d,
+            0x21, 0x72, 0x65, 0x44, 0x0c, 0x00, 0x90, 0x06, 0x71, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d,
+            0x14, 0x02, 0x15, 0x76, 0x66, 0x00, 0x04, 0xcf, 0x05, 0x00, 0xdb, 0x06, 0x00, 0x42, 0x00, 0x02,
+            0xf7, 0x0c, 0x01, 0x7b, 0x00, 0x11, 0x73, 0x30, 0x01, 0x30, 0x65, 0x61, 0x64, 0xfb, 0x0c, 0x00,
+            0xfa, 0x0c, 0x0e, 0xca, 0x00, 0x00, 0x78, 0x00, 0x16, 0x52, 0x63, 0x00, 0x02, 0xd3, 0x00, 0x13,
+            0x66, 0x68, 0x03, 0x01, 0x80, 0x03, 0x01, 0x76, 0x01, 0x01, 0x95, 0x00, 0x33, 0x6f, 0x66, 0x20,
+            0x56, 0x0e, 0x10, 0x2e, 0xc6, 0x00, 0x51, 0x2e, 0x67, 0x6c, 0x73, 0x6c, 0xd6, 0x01, 0x00, 0x77,
+            0x00, 0x0f, 0x07, 0x01, 0x0d, 0x10, 0x2e, 0x6a, 0x00, 0xf2, 0x04, 0x54, 0x68, 0x65, 0x20, 0x70,
+            0x69, 0x78, 0x65, 0x6c, 0x27, 0x73, 0x20, 0x49, 0x44, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x72, 0x00,
+            0x05, 0xd8, 0x01, 0x01, 0xc6, 0x00, 0x00, 0x3d, 0x0e, 0x21, 0x67, 0x6c, 0x08, 0x0e, 0x31, 0x6f,
+            0x73, 0x65, 0x33, 0x01, 0x00, 0x13, 0x06, 0x01, 0x4e, 0x0e, 0x58, 0x66, 0x65, 0x74, 0x63, 0x68,
+            0x0a, 0x01, 0x08, 0xf0, 0x00, 0x02, 0x47, 0x01, 0x40, 0x72, 0x61, 0x6e, 0x73, 0x05, 0x0f, 0x00,
+            0x70, 0x0e, 0x10, 0x6e, 0xa7, 0x04, 0xf0, 0x04, 0x74, 0x65, 0x72, 0x70, 0x6f, 0x6c, 0x61, 0x74,
+            0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x65, 0x72, 0x95, 0x0e, 0x01, 0x40, 0x0e,
+            0x30, 0x63, 0x6f, 0x72, 0x47, 0x0a, 0x80, 0x20, 0x62, 0x61, 0x72, 0x79, 0x63, 0x65, 0x6e, 0xc1,
+            0x08, 0x90, 0x73, 0x2e, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x21, 0x00, 0x02, 0x81, 0x09,
+            0x20, 0x64, 0x69, 0x33, 0x07, 0x32, 0x65, 0x6e, 0x63, 0x8f, 0x0e, 0x21, 0x74, 0x6f, 0x85, 0x01,
+            0x08, 0x34, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x08, 0x01, 0x00, 0xe6, 0x0a, 0x01, 0x5a, 0x0a, 0x20,
+            0x75, 0x70, 0xb2, 0x02, 0x94, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0xce, 0x03,
+            0x47, 0x73, 0x61, 0x6d, 0x65, 0xe3, 0x00, 0x91, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x64, 0x46, 0x64,
+            0x78, 0x34, 0x00, 0x40, 0x64, 0x46, 0x64, 0x79, 0x4a, 0x00, 0x61, 0x61, 0x20, 0x71, 0x75, 0x61,
+            0x64, 0x34, 0x01, 0x10, 0x4f, 0xb3, 0x07, 0x01, 0x35, 0x01, 0x01, 0x5f, 0x02, 0x01, 0x64, 0x00,
+            0x00, 0x85, 0x0f, 0x82, 0x76, 0x65, 0x64, 0x20, 0x64, 0x72, 0x61, 0x77, 0x79, 0x02, 0x00, 0x17,
+            0x00, 0x83, 0x47, 0x4c, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x13, 0x09, 0x80, 0x74, 0x65, 0x73,
+            0x74, 0x20, 0x61, 0x67, 0x61, 0x5c, 0x01, 0x01, 0xaf, 0x00, 0x84, 0x63, 0x6c, 0x61, 0x73, 0x73,
+            0x69, 0x66, 0x69, 0x39, 0x00, 0x01, 0x27, 0x00, 0x14, 0x2e, 0x3c, 0x03, 0x64, 0x65, 0x61, 0x72,
+            0x6c, 0x79, 0x5f, 0xfb, 0x01, 0x10, 0x5f, 0x3e, 0x00, 0x74, 0x73, 0x29, 0x20, 0x69, 0x6e, 0x3b,
+            0x0a, 0x22, 0x00, 0x06, 0xbf, 0x05, 0x16, 0x38, 0xb8, 0x05, 0x15, 0x75, 0xb9, 0x05, 0x07, 0x94,
+            0x02, 0x32, 0x5f, 0x69, 0x64, 0xa6, 0x09, 0x0c, 0x0d, 0x03, 0x42, 0x3a, 0x3a, 0x49, 0x44, 0xa8,
+            0x05, 0x03, 0xcf, 0x07, 0x40, 0x6c, 0x6f, 0x63, 0x61, 0x49, 0x09, 0x0a, 0x4c, 0x0c, 0x01, 0xe5,
+            0x04, 0x00, 0xdd, 0x00, 0x55, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x9f, 0x0a, 0x07, 0x2d, 0x00, 0x07,
+            0x98, 0x0a, 0x01, 0x2d, 0x00, 0x04, 0x51, 0x01, 0x03, 0x48, 0x0b, 0x04, 0xb3, 0x00, 0x07, 0x32,
+            0x00, 0x16, 0x33, 0xb4, 0x00, 0x01, 0x6c, 0x0d, 0x03, 0x5e, 0x04, 0x02, 0x56, 0x0b, 0x13, 0x49,
+            0x58, 0x04, 0x00, 0x03, 0x04, 0x11, 0x2c, 0x2d, 0x01, 0x02, 0x4b, 0x04, 0x13, 0x20, 0x0a, 0x0a,
+            0xe0, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x75, 0x70, 0xbc,
+            0x0a, 0x00, 0x71, 0x01, 0xf4, 0x01, 0x70, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x31, 0x34, 0x34,
+            0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x7c, 0x06, 0x06, 0xf6, 0x00, 0x04, 0x58, 0x00, 0x03, 0x82,
+            0x06, 0x01, 0x2d, 0x0b, 0x52, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x7e, 0x06, 0x01, 0x10, 0x00, 0x04,
+            0x8f, 0x11, 0x07, 0x18, 0x00, 0x01, 0xd3, 0x00, 0x04, 0xa7, 0x04, 0x01, 0x81, 0x09, 0x23, 0x2f,
+            0x2f, 0xe8, 0x03, 0x0f, 0x05, 0x02, 0x03, 0x12, 0x2c, 0x73, 0x0a, 0x10, 0x61, 0x3c, 0x07, 0x02,
+            0xb2, 0x02, 0x10, 0x74, 0x88, 0x02, 0x24, 0x6c, 0x79, 0xac, 0x07, 0x01, 0x91, 0x0c, 0x14, 0x73,
+            0x17, 0x01, 0x02, 0xdd, 0x00, 0x08, 0x3b, 0x12, 0x1f, 0x38, 0x28, 0x05, 0x00, 0x06, 0xd0, 0x01,
+            0x04, 0xc7, 0x00, 0x04, 0x32, 0x05, 0x0e, 0xe1, 0x00, 0x09, 0xfd, 0x01, 0x03, 0x4d, 0x01, 0x04,
+            0x43, 0x05, 0x03, 0xeb, 0x01, 0x0e, 0x75, 0x00, 0x1f, 0x39, 0x75, 0x00, 0x0a, 0x13, 0x50, 0x64,
+            0x0b, 0x04, 0x75, 0x00, 0x01, 0xc3, 0x00, 0x08, 0x68, 0x00, 0x04, 0x85, 0x0b, 0x0f, 0x68, 0x00,
+            0x0e, 0x1f, 0x31, 0x06, 0x06, 0x01, 0x06, 0xde, 0x00, 0x30, 0x45, 0x6c, 0x65, 0x56, 0x08, 0x04,
+            0x68, 0x00, 0x01, 0x7d, 0x01, 0x06, 0x1e, 0x00, 0x23, 0x5f, 0x65, 0x1f, 0x00, 0x03, 0x20, 0x0a,
+            0x0f, 0xce, 0x00, 0x06, 0x1f, 0x31, 0x64, 0x0b, 0x01, 0x06, 0x48, 0x00, 0x01, 0xda, 0x0e, 0x04,
+            0x64, 0x00, 0x01, 0xdd, 0x0c, 0x06, 0x1c, 0x00, 0x11, 0x5f, 0x96, 0x08, 0x0f, 0xc8, 0x00, 0x0f,
+            0x0f, 0x6e, 0x0b, 0x01, 0x06, 0x46, 0x00, 0x27, 0x55, 0x56, 0x5f, 0x00, 0x18, 0x32, 0x2a, 0x01,
+            0x2f, 0x75, 0x76, 0x5c, 0x00, 0x0f, 0x0f, 0x47, 0x0b, 0x01, 0x06, 0x5c, 0x00, 0x11, 0x4e, 0xd0,
+            0x08, 0x04, 0x60, 0x00, 0x0d, 0x8b, 0x01, 0x02, 0xef, 0x08, 0x0f, 0x65, 0x00, 0x0f, 0x1f, 0x34,
+            0xf2, 0x01, 0x0a, 0x10, 0x54, 0x42, 0x0d, 0x2f, 0x6e, 0x74, 0x66, 0x00, 0x06, 0x13, 0x74, 0x20,
+            0x00, 0x03, 0x8a, 0x01, 0x11, 0x0a, 0xaa, 0x01, 0x00, 0xb2, 0x04, 0x00, 0x7a, 0x0e, 0x01, 0x0f,
+            0x08, 0x2f, 0x3b, 0x0a, 0xcd, 0x07, 0x02, 0x31, 0x3b, 0x0a, 0x0a, 0x72, 0x01, 0x01, 0x2c, 0x00,
+            0x00, 0x36, 0x0e, 0x57, 0x5f, 0x70, 0x6f, 0x73, 0x3b, 0x14, 0x00, 0x0b, 0x0f, 0x00, 0x01, 0x8f,
+            0x01, 0x01, 0x20, 0x00, 0x12, 0x32, 0x34, 0x00, 0x21, 0x75, 0x76, 0x0e, 0x00, 0x12, 0x33, 0x0e,
+            0x00, 0x01, 0x42, 0x00, 0x02, 0xf3, 0x00, 0x0d, 0x17, 0x00, 0x03, 0xa4, 0x00, 0x0d, 0x18, 0x00,
+            0x2f, 0x62, 0x69, 0x1a, 0x00, 0x05, 0x77, 0x70, 0x6f, 0x73, 0x5f, 0x64, 0x78, 0x2c, 0x5b, 0x00,
+            0x01, 0x12, 0x00, 0x11, 0x79, 0x43, 0x00, 0x05, 0x80, 0x00, 0x06, 0x23, 0x00, 0x52, 0x75, 0x76,
+            0x5f, 0x64, 0x79, 0xd2, 0x00, 0x30, 0x33, 0x20, 0x46, 0x0f, 0x07, 0x51, 0x56, 0x65, 0x63, 0x33,
+            0x28, 0x0d, 0x01, 0x00, 0x98, 0x07, 0x32, 0x65, 0x78, 0x2c, 0x72, 0x14, 0x02, 0x1b, 0x15, 0x13,
+            0x29, 0x7c, 0x04, 0x01, 0x20, 0x00, 0x31, 0x69, 0x20, 0x3d, 0x4f, 0x07, 0x72, 0x65, 0x78, 0x20,
+            0x2a, 0x20, 0x33, 0x75, 0x86, 0x04, 0x32, 0x69, 0x66, 0x28, 0x2b, 0x00, 0x00, 0xb7, 0x14, 0x03,
+            0x3e, 0x0c, 0x00, 0xf9, 0x11, 0x01, 0xef, 0x09, 0x00, 0x63, 0x0a, 0x61, 0x72, 0x65, 0x74, 0x75,
+            0x72, 0x6e, 0x63, 0x04, 0x16, 0x28, 0x13, 0x02, 0x03, 0x02, 0x01, 0x58, 0x73, 0x5b, 0x69, 0x5d,
+            0x2c, 0x6d, 0x02, 0x05, 0x17, 0x00, 0x5f, 0x20, 0x2b, 0x20, 0x31, 0x75, 0x1c, 0x00, 0x07, 0x4f,
+            0x32, 0x75, 0x5d, 0x29, 0x81, 0x00, 0x00, 0x08, 0x7b, 0x12, 0x0f, 0x82, 0x00, 0x0d, 0x03, 0x53,
+            0x01, 0x0d, 0x83, 0x00, 0x06, 0x18, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x09, 0x1d, 0x00, 0x06, 0x85,
+            0x00, 0x0f, 0xe5, 0x00, 0x04, 0x06, 0x65, 0x04, 0x0b, 0xe7, 0x00, 0x07, 0x19, 0x00, 0x0f, 0x65,
+            0x00, 0x00, 0x0a, 0x1e, 0x00, 0x02, 0x66, 0x00, 0x11, 0x7d, 0xc1, 0x11, 0x0f, 0x7d, 0x08, 0x0d,
+            0x00, 0xff, 0x07, 0x00, 0x5d, 0x06, 0x04, 0xd2, 0x06, 0x00, 0x34, 0x17, 0x74, 0x61, 0x6e, 0x20,
+            0x4e, 0x44, 0x43, 0x20, 0x55, 0x00, 0x00, 0xb9, 0x02, 0x37, 0x33, 0x20, 0x42, 0xb2, 0x08, 0xc1,
+            0x28, 0x6d, 0x61, 0x74, 0x33, 0x78, 0x34, 0x20, 0x63, 0x6c, 0x69, 0x70, 0x0c, 0x06, 0x54, 0x32,
+            0x20, 0x6e, 0x64, 0x63, 0xfb, 0x01, 0x01, 0x1c, 0x06, 0x04, 0x67, 0x06, 0x10, 0x77, 0x6b, 0x07,
+            0x42, 0x2e, 0x66, 0x20, 0x2f, 0xd0, 0x01, 0x00, 0x32, 0x00, 0x61, 0x5b, 0x30, 0x5d, 0x2e, 0x77,
+            0x2c, 0x3d, 0x00, 0x26, 0x5b, 0x31, 0x0b, 0x00, 0x43, 0x32, 0x5d, 0x2e, 0x77, 0xa2, 0x01, 0x01,
+            0xfc, 0x17, 0x42, 0x70, 0x30, 0x20, 0x3d, 0x25, 0x00, 0x75, 0x30, 0x5d, 0x2e, 0x78, 0x79, 0x20,
+            0x2a, 0x4a, 0x18, 0x32, 0x77, 0x2e, 0x78, 0xca, 0x01, 0x01, 0x28, 0x00, 0x24, 0x65, 0x31, 0x28,
+            0x00, 0x1d, 0x31, 0x28, 0x00, 0x68, 0x79, 0x20, 0x2d, 0x20, 0x70, 0x30, 0x2d, 0x00, 0x14, 0x32,
+            0x2d, 0x00, 0x1d, 0x32, 0x2d, 0x00, 0x1c, 0x7a, 0x2d, 0x00, 0x30, 0x64, 0x20, 0x3d, 0xd8, 0x00,
+            0x07, 0x17, 0x00, 0x02, 0x8a, 0x04, 0x04, 0xdc, 0x00, 0x45, 0x61, 0x72, 0x65, 0x61, 0xdf, 0x00,
+            0x40, 0x28, 0x65, 0x31, 0x2e, 0xe7, 0x02, 0x21, 0x65, 0x32, 0x76, 0x00, 0x30, 0x65, 0x31, 0x2e,
+            0xb3, 0x00, 0x43, 0x65, 0x32, 0x2e, 0x78, 0xd5, 0x00, 0x02, 0x3c, 0x00, 0x10, 0x62, 0xae, 0x00,
+            0x28, 0x28, 0x64, 0x2b, 0x00, 0x16, 0x64, 0x2a, 0x00, 0x07, 0xe5, 0x00, 0x00, 0x5d, 0x00, 0x02,
+            0xb9, 0x00, 0x03, 0x39, 0x00, 0x00, 0xba, 0x00, 0x04, 0x65, 0x00, 0x00, 0x33, 0x00, 0x05, 0x64,
+            0x00, 0x1f, 0x64, 0x39, 0x00, 0x05, 0x01, 0x89, 0x01, 0x10, 0x77, 0x12, 0x0a, 0x21, 0x74, 0x73,
+            0x8a, 0x03, 0xb0, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x66, 0x20, 0x2d, 0x20, 0x62, 0x31, 0x05, 0x00,
+            0x98, 0x32, 0x2c, 0x20, 0x62, 0x31, 0x2c, 0x20, 0x62, 0x32, 0x3f, 0x00, 0x03, 0xa4, 0x19, 0x03,
+            0xa0, 0x02, 0x04, 0x3e, 0x00, 0x33, 0x2f, 0x20, 0x28, 0x0b, 0x00, 0x54, 0x2e, 0x78, 0x20, 0x2b,
+            0x20, 0x0c, 0x00, 0x17, 0x79, 0x0c, 0x00, 0xb8, 0x7a, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x76,
+            0x6f, 0x69, 0x64, 0xe4, 0x0b, 0x04, 0x2b, 0x0e, 0x14, 0x28, 0x1f, 0x02, 0x01, 0x1a, 0x04, 0x00,
+            0x2a, 0x09, 0x30, 0x6c, 0x5f, 0x69, 0x62, 0x01, 0x51, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x59, 0x04,
+            0x08, 0xee, 0x03, 0x60, 0x69, 0x64, 0x73, 0x2c, 0x20, 0x69, 0xe1, 0x01, 0x40, 0x28, 0x67, 0x6c,
+            0x5f, 0x45, 0x00, 0xf1, 0x02, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20,
+            0x30, 0x29, 0x2e, 0x72, 0x20, 0x2d, 0x90, 0x0a, 0x03, 0xb3, 0x09, 0x00, 0x38, 0x04, 0x01, 0x59,
+            0x00, 0x00, 0x7f, 0x0a, 0x01, 0xb3, 0x0d, 0x16, 0x3d, 0x64, 0x00, 0x15, 0x2f, 0x01, 0x0b, 0x04,
+            0xb0, 0x09, 0x05, 0x2f, 0x00, 0x05, 0xf7, 0x02, 0x07, 0x2f, 0x00, 0x11, 0x2d, 0xc8, 0x0c, 0x01,
+            0x45, 0x00, 0x1f, 0x2a, 0x3a, 0x00, 0x02, 0x0f, 0x90, 0x08, 0x00, 0x30, 0x64, 0x61, 0x74, 0x0b,
+            0x02, 0x08, 0xc1, 0x00, 0x05, 0x97, 0x08, 0x04, 0x93, 0x00, 0x13, 0x5d, 0xcf, 0x01, 0x08, 0x42,
+            0x06, 0x21, 0x20, 0x3d, 0x3b, 0x00, 0x16, 0x2e, 0x7e, 0x09, 0x00, 0x9b, 0x00, 0x04, 0x0e, 0x00,
+            0x27, 0x20, 0x3d, 0x21, 0x0e, 0x01, 0x1a, 0x06, 0x04, 0x1a, 0x00, 0x31, 0x5d, 0x3b, 0x0a, 0xae,
+            0x04, 0x00, 0x1f, 0x0f, 0x11, 0x33, 0x64, 0x05, 0x01, 0xb3, 0x0c, 0x12, 0x3d, 0x11, 0x00, 0x15,
+            0x28, 0xd7, 0x00, 0x00, 0x77, 0x05, 0x33, 0x29, 0x20, 0x2b, 0x17, 0x00, 0xa3, 0x30, 0x75, 0x2c,
+            0x20, 0x31, 0x75, 0x2c, 0x20, 0x32, 0x75, 0x94, 0x02, 0x33, 0x69, 0x66, 0x28, 0x99, 0x0a, 0x11,
+            0x29, 0x4f, 0x00, 0x00, 0x7d, 0x00, 0x00, 0xd5, 0x05, 0x09, 0x4d, 0x00, 0x07, 0xd5, 0x00, 0x05,
+            0x9d, 0x08, 0x04, 0x25, 0x00, 0x2a, 0x2e, 0x78, 0x72, 0x05, 0x0e, 0x21, 0x00, 0x1f, 0x79, 0x21,
+            0x00, 0x0d, 0x10, 0x7a, 0x98, 0x05, 0x01, 0x7e, 0x00, 0x01, 0xa0, 0x0a, 0x00, 0xee, 0x06, 0x10,
+            0x4d, 0xb4, 0x0a, 0x00, 0xb2, 0x02, 0x53, 0x69, 0x65, 0x77, 0x20, 0x2a, 0x22, 0x01, 0x00, 0x14,
+            0x00, 0x02, 0x42, 0x01, 0x03, 0x7e, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x5a, 0x07, 0x01, 0x1b, 0x15,
+            0x12, 0x73, 0x51, 0x04, 0x02, 0x21, 0x00, 0x40, 0x66, 0x6f, 0x72, 0x28, 0x70, 0x10, 0x00, 0x80,
+            0x06, 0xd2, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x33, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0xe6,
+            0x00, 0x02, 0x9d, 0x1c, 0x01, 0xec, 0x00, 0x44, 0x69, 0x65, 0x77, 0x5f, 0xe8, 0x04, 0x00, 0xd8,
+            0x05, 0x03, 0x75, 0x00, 0x02, 0x81, 0x00, 0x10, 0x2a, 0xb4, 0x04, 0x21, 0x34, 0x28, 0x9c, 0x02,
+            0x01, 0xf5, 0x06, 0x04, 0xf6, 0x00, 0x01, 0x84, 0x06, 0x03, 0x62, 0x1b, 0x63, 0x29, 0x2c, 0x20,
+            0x31, 0x2e, 0x66, 0x50, 0x01, 0x00, 0x54, 0x00, 0x01, 0xe3, 0x04, 0x47, 0x69, 0x5d, 0x20, 0x3d,
+            0xd4, 0x1c, 0x22, 0x20, 0x2a, 0x59, 0x15, 0x08, 0x6b, 0x00, 0x02, 0xab, 0x00, 0x11, 0x7d, 0xfa,
+            0x00, 0x00, 0xe8, 0x02, 0x02, 0xab, 0x0e, 0x44, 0x20, 0x3d, 0x20, 0x32, 0x2f, 0x05, 0x21, 0x32,
+            0x28, 0xe7, 0x0e, 0x01, 0x00, 0x1d, 0x03, 0x61, 0x00, 0x01, 0x29, 0x00, 0x6b, 0x6e, 0x64, 0x63,
+            0x20, 0x3d, 0x20, 0x17, 0x03, 0x23, 0x20, 0x2a, 0x41, 0x00, 0x10, 0x2d, 0x90, 0x00, 0x02, 0x5d,
+            0x00, 0x01, 0x01, 0x04, 0x3a, 0x62, 0x20, 0x3d, 0xbd, 0x05, 0x00, 0xa1, 0x00, 0x10, 0x2c, 0xd9,
+            0x04, 0x06, 0x54, 0x00, 0x6f, 0x33, 0x20, 0x62, 0x5f, 0x64, 0x78, 0x29, 0x00, 0x06, 0x20, 0x20,
+            0x2b, 0x0a, 0x01, 0x21, 0x32, 0x28, 0x18, 0x0e, 0x90, 0x2e, 0x78, 0x2c, 0x20, 0x30, 0x2e, 0x66,
+            0x29, 0x29, 0x43, 0x04, 0x08, 0x68, 0x00, 0x3f, 0x5f, 0x64, 0x79, 0x42, 0x00, 0x0e, 0x42, 0x30,
+            0x2e, 0x66, 0x2c, 0xa8, 0x00, 0x24, 0x2e, 0x79, 0x42, 0x00, 0x01, 0x02, 0x01, 0x01, 0xde, 0x02,
+            0x04, 0xd2, 0x01, 0x03, 0x86, 0x01, 0x06, 0x9a, 0x01, 0x24, 0x20, 0x2a, 0x6b, 0x00, 0x01, 0x28,
+            0x00, 0x20, 0x70, 0x6f, 0xd0, 0x04, 0x09, 0x5f, 0x01, 0x01, 0x18, 0x00, 0x04, 0x40, 0x00, 0x07,
+            0x2b, 0x00, 0x04, 0x13, 0x00, 0x02, 0xdf, 0x00, 0x00, 0x11, 0x01, 0x14, 0x28, 0x13, 0x00, 0x02,
+            0x38, 0x02, 0x00, 0x5b, 0x00, 0x25, 0x5f, 0x64, 0xa5, 0x05, 0x00, 0x9d, 0x03, 0x04, 0x21, 0x00,
+            0x02, 0xd1, 0x00, 0x0f, 0x34, 0x00, 0x06, 0x23, 0x79, 0x29, 0x85, 0x03, 0x01, 0x7c, 0x00, 0x01,
+            0xc5, 0x09, 0x00, 0xb9, 0x00, 0x30, 0x65, 0x63, 0x34, 0x66, 0x05, 0x03, 0x5d, 0x01, 0x23, 0x69,
+            0x66, 0x7e, 0x1b, 0x03, 0xfd, 0x1a, 0x02, 0x82, 0x02, 0x00, 0x28, 0x02, 0x09, 0x36, 0x00, 0x02,
+            0xd3, 0x02, 0x08, 0x01, 0x05, 0x01, 0x50, 0x00, 0x24, 0x73, 0x5b, 0x73, 0x02, 0x0c, 0x69, 0x03,
+            0x0c, 0x1f, 0x00, 0x0b, 0x67, 0x03, 0x0c, 0x1f, 0x00, 0x20, 0x7a, 0x5d, 0xe4, 0x05, 0x08, 0x44,
+            0x01, 0x22, 0x75, 0x76, 0xad, 0x00, 0x20, 0x32, 0x28, 0xcd, 0x01, 0x07, 0x32, 0x01, 0x00, 0xf1,
+            0x09, 0x00, 0x0b, 0x02, 0x01, 0xa0, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x78, 0x02,
+            0x07, 0x29, 0x00, 0x36, 0x69, 0x66, 0x28, 0x3d, 0x1c, 0x02, 0xd3, 0x00, 0x06, 0x55, 0x03, 0x01,
+            0xcc, 0x00, 0x40, 0x32, 0x20, 0x75, 0x76, 0xa5, 0x01, 0x02, 0x0d, 0x00, 0x08, 0xd9, 0x00, 0x00,
+            0x1e, 0x0c, 0x0f, 0xd6, 0x00, 0x05, 0x09, 0x1c, 0x00, 0x0b, 0xd3, 0x00, 0x09, 0x1c, 0x00, 0x01,
+            0x35, 0x04, 0x00, 0x46, 0x01, 0x00, 0x04, 0x00, 0x03, 0xaa, 0x00, 0x01, 0xfe, 0x04, 0x01, 0xd0,
+            0x01, 0x02, 0xce, 0x00, 0x07, 0x1b, 0x00, 0x02, 0xfe, 0x01, 0x00, 0x92, 0x00, 0x11, 0x2a, 0xea,
+            0x02, 0x0f, 0x21, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x05, 0x21, 0x00, 0x12, 0x79, 0x21, 0x00, 0x02,
+            0x9d, 0x03, 0x33, 0x69, 0x66, 0x28, 0xa7, 0x0a, 0x09, 0xc4, 0x01, 0x0a, 0xf1, 0x00, 0x12, 0x20,
+            0x88, 0x0a, 0x00, 0xd9, 0x05, 0x20, 0x72, 0x69, 0x3f, 0x01, 0x00, 0xf9, 0x00, 0x11, 0x28, 0x1d,
+            0x12, 0x51, 0x70, 0x6f, 0x73, 0x65, 0x28, 0xe6, 0x05, 0x04, 0x39, 0x08, 0x01, 0x7c, 0x0f, 0x07,
+            0xb3, 0x07, 0x00, 0x71, 0x02, 0x13, 0x29, 0x31, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x3c, 0x00, 0x03,
+            0x51, 0x00, 0x34, 0x73, 0x2c, 0x20, 0x42, 0x0a, 0x00, 0x41, 0x0f, 0x04, 0x0c, 0x00, 0x02, 0xa0,
+            0x00, 0x00, 0x2c, 0x00, 0x0f, 0xec, 0x04, 0x0c, 0x00, 0x23, 0x00, 0x06, 0xaa, 0x00, 0x00, 0x0e,
+            0x00, 0x02, 0xa9, 0x00, 0x03, 0xed, 0x04, 0x02, 0x0d, 0x00, 0x04, 0xb6, 0x00, 0x17, 0x2a, 0xe1,
+            0x0b, 0x04, 0xa3, 0x01, 0x01, 0xec, 0x04, 0x03, 0x00, 0x01, 0x00, 0xa7, 0x0b, 0x06, 0x7a, 0x00,
+            0x00, 0x4d, 0x00, 0x34, 0x69, 0x66, 0x28, 0x42, 0x0b, 0x09, 0x1d, 0x01, 0x00, 0x1c, 0x00, 0x00,
+            0x04, 0x00, 0x0a, 0x7b, 0x00, 0x00, 0x12, 0x00, 0x04, 0xc2, 0x00, 0x02, 0x23, 0x05, 0x00, 0xea,
+            0x00, 0x01, 0x91, 0x03, 0x01, 0x72, 0x05, 0x00, 0xa4, 0x02, 0x0f, 0x6e, 0x05, 0x04, 0x04, 0x66,
+            0x00, 0x0e, 0x83, 0x00, 0x00, 0x55, 0x00, 0x05, 0xef, 0x0c, 0x03, 0xd7, 0x00, 0x62, 0x63, 0x72,
+            0x6f, 0x73, 0x73, 0x28, 0xdd, 0x00, 0x00, 0x13, 0x00, 0x06, 0x45, 0x01, 0x20, 0x5b, 0x69, 0x6f,
+            0x06, 0x00, 0x34, 0x00, 0x04, 0x04, 0x00, 0x02, 0xe5, 0x01, 0x00, 0x0e, 0x00, 0x06, 0x0a, 0x00,
+            0x01, 0x52, 0x02, 0x00, 0x96, 0x01, 0x03, 0x76, 0x0c, 0x00, 0x09, 0x0a, 0x02, 0x93, 0x0e, 0x0a,
+            0x5f, 0x02, 0x0f, 0xff, 0x00, 0x09, 0x0a, 0xfb, 0x00, 0x06, 0x52, 0x00, 0x03, 0x01, 0x01, 0x25,
+            0x20, 0x3d, 0xd9, 0x01, 0x0a, 0x54, 0x00, 0x00, 0x8a, 0x00, 0x06, 0x2e, 0x00, 0x05, 0xda, 0x00,
+            0x20, 0x20, 0x3d, 0x73, 0x22, 0x03, 0x93, 0x0e, 0x0a, 0x32, 0x00, 0x02, 0xb8, 0x00, 0xd0, 0x7d,
+            0x0a, 0x7d, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x66, 0x6c, 0x61, 0xec, 0x1a, 0x02, 0x97,
+            0x0d, 0x01, 0x4b, 0x00, 0x04, 0x37, 0x08, 0x0f, 0xb1, 0x0e, 0x04, 0x0f, 0x68, 0x08, 0x0b, 0x20,
+            0x69, 0x6e, 0xfe, 0x05, 0x1a, 0x34, 0x32, 0x0e, 0x1a, 0x3b, 0x17, 0x00, 0x01, 0xd2, 0x0e, 0x09,
+            0x12, 0x00, 0x01, 0x82, 0x04, 0x04, 0x26, 0x00, 0x05, 0x58, 0x0e, 0x04, 0x11, 0x00, 0x0f, 0xdb,
+            0x0e, 0x01, 0x02, 0x3f, 0x00, 0x08, 0x1a, 0x00, 0x03, 0x2b, 0x01, 0x0f, 0x35, 0x00, 0x01, 0x05,
+            0x18, 0x01, 0x14, 0x3b, 0x3e, 0x23, 0x01, 0xf2, 0x15, 0x03, 0x04, 0x25, 0x01, 0x24, 0x23, 0x12,
+            0x69, 0xed, 0x15, 0x02, 0x07, 0x19, 0x05, 0xf3, 0x1d, 0x04, 0x07, 0x19, 0x04, 0xf9, 0x0c, 0x04,
+            0x1b, 0x01, 0x02, 0x2d, 0x00, 0x04, 0x80, 0x18, 0x31, 0x69, 0x73, 0x20, 0x3b, 0x18, 0x00, 0xc1,
+            0x15, 0x01, 0xe7, 0x15, 0x40, 0x6d, 0x61, 0x70, 0x73, 0x47, 0x17, 0x00, 0x1a, 0x19, 0x00, 0x3b,
+            0x00, 0x21, 0x69, 0x74, 0x20, 0x16, 0x10, 0x6e, 0x51, 0x18, 0x12, 0x20, 0x95, 0x14, 0x30, 0x64,
+            0x2e, 0x20, 0x02, 0x1f, 0x00, 0x3e, 0x0a, 0x34, 0x69, 0x64, 0x65, 0x22, 0x00, 0x91, 0x73, 0x74,
+            0x69, 0x6c, 0x6c, 0x20, 0x63, 0x68, 0x65, 0xc5, 0x1a, 0x08, 0x21, 0x15, 0x04, 0x7a, 0x00, 0x01,
+            0x60, 0x00, 0x02, 0x84, 0x24, 0x50, 0x69, 0x73, 0x20, 0x77, 0x68, 0xe2, 0x24, 0x10, 0x65, 0xce,
+            0x24, 0x00, 0x41, 0x08, 0x42, 0x67, 0x72, 0x61, 0x6d, 0x47, 0x16, 0x30, 0x61, 0x6c, 0x6c, 0x02,
+            0x02, 0x20, 0x73, 0x20, 0xca, 0x1c, 0x00, 0xae, 0x14, 0x45, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x0a,
+            0x10, 0x2e, 0x75, 0x17, 0x01, 0x70, 0x24, 0x04, 0x52, 0x19, 0x00, 0x04, 0x01, 0x05, 0x71, 0x24,
+            0x08, 0x15, 0x00, 0x0f, 0x72, 0x24, 0x00, 0x00, 0xd0, 0x1a, 0x03, 0xc0, 0x03, 0x41, 0x28, 0x6d,
+            0x61, 0x70, 0x6f, 0x24, 0x19, 0x28, 0x34, 0x00, 0x16, 0x26, 0x6a, 0x00, 0x02, 0x51, 0x01, 0x0d,
+            0x58, 0x1a, 0x40, 0x29, 0x20, 0x3e, 0x3e, 0x6b, 0x19, 0x0c, 0x95, 0x24, 0x26, 0x2f, 0x2f, 0x96,
+            0x16, 0x00, 0x1e, 0x25, 0x01, 0x45, 0x08, 0x0c, 0x58, 0x14, 0x41, 0x20, 0x6d, 0x61, 0x79, 0x87,
+            0x18, 0x20, 0x6e, 0x67, 0xef, 0x14, 0x55, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x7c, 0x0b, 0x00, 0x39,
+            0x1f, 0x10, 0x6f, 0x50, 0x01, 0x00, 0xf5, 0x18, 0xf0, 0x03, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73,
+            0x20, 0x6f, 0x77, 0x6e, 0x20, 0x75, 0x76, 0x20, 0x67, 0x72, 0x61, 0x64, 0xee, 0x21, 0x11, 0x73,
+            0x45, 0x01, 0x01, 0x13, 0x21, 0x01, 0xc2, 0x19, 0x24, 0x32, 0x5e, 0x25, 0x26, 0x00, 0x4f, 0x00,
+            0x51, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x68, 0x15, 0x00, 0x16, 0x21, 0x00, 0xbf, 0x01, 0x00, 0xf3,
+            0x0e, 0xc0, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3e, 0x01,
+            0x0f, 0xb3, 0x18, 0x04, 0x04, 0x96, 0x25, 0xa2, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x32,
+            0x44, 0x28, 0xef, 0x01, 0x40, 0x72, 0x2c, 0x20, 0x63, 0x93, 0x0c, 0x14, 0x29, 0x5b, 0x02, 0x4b,
+            0x47, 0x72, 0x61, 0x64, 0x1c, 0x00, 0x03, 0x67, 0x11, 0x00, 0x46, 0x07, 0x01, 0x1c, 0x0e, 0x44,
+            0x78, 0x70, 0x32, 0x28, 0x99, 0x00, 0x17, 0x29, 0x1d, 0x00, 0x01, 0x2b, 0x0e, 0x09, 0x1d, 0x00,
+            0x13, 0x29, 0xcc, 0x03, 0x0f, 0x7e, 0x00, 0x16, 0x0d, 0x7a, 0x00, 0x05, 0x68, 0x00, 0x04, 0x21,
+            0x03, 0x0f, 0x13, 0x28, 0x03, 0x02, 0xf7, 0x26, 0x04, 0xde, 0x00, 0x30, 0x4d, 0x41, 0x50, 0x01,
+            0x02, 0x54, 0x2c, 0x20, 0x75, 0x76, 0x29, 0x14, 0x00, 0x06, 0xf2, 0x00, 0x20, 0x32, 0x44, 0xfa,
+            0x0f, 0x01, 0xfb, 0x12, 0x18, 0x2e, 0x93, 0x1b, 0x51, 0x6d, 0x61, 0x70, 0x5d, 0x29, 0x34, 0x00,
+            0x00, 0xb6, 0x00, 0x23, 0x69, 0x66, 0x4c, 0x27, 0x20, 0x64, 0x28, 0x35, 0x1d, 0x0a, 0x99, 0x28,
+            0x14, 0x29, 0x15, 0x16, 0x06, 0xdf, 0x17, 0x07, 0x48, 0x28, 0x03, 0x5a, 0x01, 0x03, 0x97, 0x1d,
+            0x00, 0x4e, 0x02, 0x13, 0x5f, 0x13, 0x00, 0x24, 0x73, 0x5b, 0xc5, 0x1d, 0x02, 0xd2, 0x1f, 0x04,
+            0xc2, 0x21, 0x20, 0x75, 0x6e, 0x0e, 0x02, 0x10, 0x30, 0xe6, 0x01, 0x04, 0x21, 0x00, 0x25, 0x2d,
+            0x31, 0xf7, 0x02, 0x0f, 0xd6, 0x00, 0x0b, 0x00, 0xc3, 0x00, 0x05, 0x5f, 0x00, 0x00, 0xc4, 0x00,
+            0x01, 0xcc, 0x10, 0x56, 0x33, 0x28, 0x75, 0x76, 0x2c, 0xee, 0x02, 0x00, 0x25, 0x00, 0x03, 0xb4,
+            0x1c, 0x00, 0x23, 0x00, 0x05, 0x99, 0x01, 0x03, 0x99, 0x15, 0x0f, 0xc7, 0x00, 0x0b, 0x0f, 0xc2,
+            0x00, 0x60, 0x20, 0x75, 0x76, 0xa2, 0x00, 0x02, 0xbb, 0x29, 0x04, 0x3d, 0x02, 0x06, 0x2e, 0x20,
+            0x05, 0xf1, 0x25, 0x08, 0xf2, 0x03, 0x06, 0x1f, 0x00, 0x15, 0x29, 0x3a, 0x01, 0x09, 0x37, 0x20,
+            0x0f, 0x36, 0x00, 0x02, 0x09, 0x22, 0x00, 0x06, 0x39, 0x00, 0x08, 0x45, 0x20, 0x0f, 0x38, 0x00,
+            0x02, 0x08, 0x21, 0x00, 0x06, 0x37, 0x00, 0x03, 0x62, 0x08, 0x07, 0x97, 0x00, 0x17, 0x20, 0x0c,
+            0x00, 0x04, 0x81, 0x09, 0x09, 0x33, 0x00, 0x0f, 0x55, 0x20, 0x02, 0x0f, 0x73, 0x00, 0x02, 0x0f,
+            0x2a, 0x00, 0x02, 0x06, 0x49, 0x00, 0x03, 0x3d, 0x20, 0x0f, 0x3b, 0x00, 0x02, 0x03, 0x1c, 0x00,
+            0x72, 0x29, 0x0a, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x09, 0x07, 0x32, 0x6f, 0x75, 0x74, 0x43, 0x17,
+            0x11, 0x3b, 0x63, 0x13, 0x12, 0x31, 0xc1, 0x25, 0x30, 0x6c, 0x69, 0x74, 0x7f, 0x1e, 0x01, 0xcd,
+            0x25, 0x51, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0xd0, 0x1c, 0x42, 0x6f, 0x77, 0x65, 0x64, 0xe9, 0x03,
+            0x01, 0xf5, 0x17, 0x00, 0x3f, 0x1b, 0x11, 0x74, 0x8a, 0x04, 0x44, 0x6c, 0x61, 0x73, 0x74, 0x40,
+            0x24, 0x01, 0x4b, 0x06, 0x42, 0x6c, 0x69, 0x74, 0x0a, 0xeb, 0x11, 0x05, 0x6b, 0x26, 0x20, 0x61,
+            0x6c, 0x7c, 0x20, 0x30, 0x6f, 0x77, 0x28, 0x84, 0x0c, 0x05, 0x42, 0x0e, 0x04, 0x49, 0x11, 0x02,
+            0x2d, 0x00, 0x01, 0x57, 0x1b, 0x41, 0x20, 0x3d, 0x20, 0x2d, 0xaf, 0x08, 0x52, 0x70, 0x6f, 0x73,
+            0x2e, 0x7a, 0xa3, 0x09, 0x01, 0x0f, 0x11, 0x03, 0xa1, 0x24, 0x00, 0x50, 0x22, 0x03, 0x7f, 0x15,
+            0x64, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x18, 0x00, 0x13, 0x3c, 0xa5, 0x00, 0x05, 0xf4, 0x24,
+            0x01, 0x01, 0x23, 0x33, 0x20, 0x26, 0x26, 0xd6, 0x1b, 0x1c, 0x3e, 0x20, 0x00, 0x02, 0x14, 0x25,
+            0x13, 0x5b, 0x40, 0x00, 0x12, 0x5d, 0xfc, 0x0b, 0x00, 0xb3, 0x08, 0x03, 0x12, 0x00, 0x22, 0x2b,
+            0x2b, 0x7e, 0x00, 0x25, 0x69, 0x66, 0x64, 0x00, 0x2c, 0x3e, 0x3d, 0x45, 0x00, 0x01, 0x65, 0x00,
+            0x06, 0x3b, 0x00, 0x03, 0x6c, 0x12, 0x32, 0x31, 0x2e, 0x66, 0x3c, 0x00, 0x01, 0xee, 0x00, 0x03,
+            0xe5, 0x25, 0x02, 0xeb, 0x0d, 0x13, 0x28, 0x0e, 0x00, 0x05, 0xf3, 0x25, 0x03, 0x6e, 0x00, 0x10,
+            0x5d, 0x59, 0x0f, 0x00, 0x71, 0x0d, 0x04, 0xfd, 0x00, 0x02, 0x8d, 0x0f, 0x43, 0x29, 0x2e, 0x78,
+            0x79, 0x06, 0x01, 0x03, 0x5c, 0x00, 0x03, 0x2f, 0x04, 0x06, 0x48, 0x00, 0x02, 0xb8, 0x14, 0x14,
+            0x34, 0x11, 0x00, 0x00, 0x38, 0x01, 0x34, 0x78, 0x79, 0x2c, 0x91, 0x01, 0x14, 0x2c, 0xb2, 0x00,
+            0x00, 0x18, 0x00, 0x10, 0x7a, 0x9b, 0x0b, 0x02, 0x4e, 0x15, 0xf1, 0x01, 0x74, 0x65, 0x6d, 0x70,
+            0x6f, 0x72, 0x61, 0x72, 0x79, 0x20, 0x70, 0x68, 0x6f, 0x6e, 0x67, 0x2d, 0x4f, 0x1d, 0x01, 0x43,
+            0x25, 0x62, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x4c, 0x55, 0x25, 0x40, 0x73, 0x20, 0x74, 0x6f, 0x5a,
+            0x06, 0x02, 0x53, 0x08, 0x01, 0x1f, 0x00, 0x02, 0x17, 0x13, 0x22, 0x41, 0x64, 0xf5, 0x25, 0x02,
+            0xd0, 0x01, 0x12, 0x4c, 0x6f, 0x04, 0x10, 0x20, 0xc3, 0x06, 0x00, 0x6e, 0x12, 0x03, 0x0f, 0x00,
+            0x13, 0x4e, 0x08, 0x00, 0x23, 0x56, 0x2c, 0xe2, 0x01, 0x05, 0x2f, 0x22, 0x04, 0x11, 0x00, 0x04,
+            0x27, 0x22, 0x00, 0xb4, 0x20, 0x03, 0x95, 0x02, 0x11, 0x33, 0x34, 0x1e, 0x39, 0x75, 0x73, 0x65,
+            0x14, 0x00, 0x00, 0x77, 0x1e, 0x4b, 0x75, 0x6c, 0x61, 0x72, 0x32, 0x02, 0x11, 0x46, 0x04, 0x15,
+            0xc0, 0x61, 0x6d, 0x70, 0x28, 0x64, 0x6f, 0x74, 0x28, 0x4e, 0x2c, 0x20, 0x4c, 0x54, 0x13, 0x00,
+            0x9a, 0x0f, 0x06, 0xca, 0x10, 0x03, 0x4f, 0x00, 0x85, 0x20, 0x2b, 0x3d, 0x20, 0x64, 0x46, 0x20,
+            0x2a, 0xa5, 0x00, 0x00, 0x0b, 0x00, 0x04, 0xbf, 0x22, 0x07, 0xae, 0x01, 0xa5, 0x68, 0x61, 0x6c,
+            0x66, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2b, 0x0b, 0x93, 0x69, 0x7a, 0x65, 0x28, 0x56, 0x20,
+            0x2b, 0x20, 0x4c, 0xd9, 0x0c, 0x02, 0xcd, 0x00, 0x10, 0x73, 0x7d, 0x00, 0x49, 0x70, 0x6f, 0x77,
+            0x28, 0x81, 0x00, 0x06, 0x3f, 0x00, 0x08, 0x8a, 0x00, 0x95, 0x2c, 0x20, 0x32, 0x35, 0x36, 0x2e,
+            0x66, 0x20, 0x2a, 0xf2, 0x00, 0x03, 0x4b, 0x00, 0x04, 0xd8, 0x00, 0x00, 0x9e, 0x00, 0x1b, 0x73,
+            0x9e, 0x00, 0x40, 0x28, 0x31, 0x2e, 0x30, 0xe3, 0x14, 0x05, 0x36, 0x01, 0x07, 0x97, 0x14, 0x41,
+            0x6d, 0x61, 0x69, 0x6e, 0x88, 0x14, 0x03, 0x0b, 0x07, 0x0f, 0xa1, 0x20, 0x00, 0x00, 0xcb, 0x02,
+            0x0f, 0xbe, 0x14, 0x02, 0x07, 0xed, 0x00, 0x04, 0x6d, 0x02, 0x02, 0x56, 0x0e, 0x01, 0x61, 0x0b,
+            0x07, 0x13, 0x00, 0x0f, 0x29, 0x00, 0x02, 0x00, 0x5e, 0x0e, 0x0b, 0x29, 0x00, 0x03, 0x64, 0x0e,
+            0x00, 0x5a, 0x0f, 0x12, 0x20, 0x21, 0x08, 0x12, 0x3d, 0x63, 0x0b, 0x01, 0x0d, 0x00, 0x05, 0x46,
+            0x00, 0x00, 0x49, 0x0f, 0x02, 0x89, 0x10, 0x01, 0x40, 0x00, 0x00, 0x1d, 0x00, 0x10, 0x79, 0xf4,
+            0x0a, 0x00, 0xe9, 0x0b, 0x00, 0xad, 0x00, 0x01, 0x2d, 0x03, 0x07, 0x7f, 0x00, 0x00, 0x52, 0x14,
+            0x31, 0x46, 0x64, 0x78, 0x63, 0x02, 0x11, 0x28, 0x33, 0x00, 0x04, 0x1d, 0x00, 0x00, 0xc7, 0x02,
+            0x0f, 0x32, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x09, 0x20, 0x0f, 0x32, 0x00, 0x0b, 0x02, 0x87,
+            0x00, 0x00, 0xd9, 0x0e, 0x00, 0x3e, 0x20, 0x02, 0x59, 0x00, 0x23, 0x75, 0x76, 0x90, 0x01, 0x05,
+            0xc4, 0x00, 0x05, 0x4c, 0x00, 0x01, 0x79, 0x00, 0x01, 0x20, 0x00, 0x03, 0x47, 0x30, 0x03, 0x79,
+            0x00, 0x21, 0x34, 0x20, 0x18, 0x0c, 0x04, 0xeb, 0x00, 0x01, 0x0d, 0x00, 0x05, 0xeb, 0x00, 0x03,
+            0x7e, 0x28, 0x02, 0xb7, 0x0d, 0x00, 0xe5, 0x19, 0x06, 0x03, 0x0c, 0x03, 0x0e, 0x00, 0x05, 0xf6,
+            0x0b, 0x73, 0x2c, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x9f, 0x0d, 0x03, 0x88, 0x11, 0x0f, 0xa9,
+            0x0f, 0x0e, 0x01, 0x0a, 0x01, 0x02, 0x5f, 0x00, 0x09, 0xa7, 0x02, 0x01, 0xae, 0x00, 0x07, 0x1d,
+            0x00, 0x03, 0xd7, 0x00, 0x02, 0x58, 0x0d, 0x01, 0x53, 0x0d, 0x00, 0xbf, 0x00, 0x00, 0x04, 0x00,
+            0x07, 0x25, 0x00, 0x09, 0x42, 0x00, 0x02, 0x71, 0x0e, 0x01, 0x1e, 0x00, 0x01, 0x4f, 0x1b, 0x13,
+            0x78, 0xb1, 0x00, 0x01, 0x0d, 0x00, 0x10, 0x79, 0x7a, 0x01, 0x01, 0xe6, 0x12, 0x0e, 0x30, 0x0e,
+            0x00, 0x6b, 0x05, 0x03, 0xfc, 0x06, 0x03, 0x81, 0x0b, 0x02, 0x18, 0x05, 0x06, 0x3e, 0x0e, 0x01,
+            0x55, 0x00, 0x03, 0x07, 0x01, 0x09, 0x74, 0x00, 0x06, 0xb6, 0x00, 0x03, 0x1e, 0x00, 0x03, 0xb7,
+            0x00, 0x05, 0xa8, 0x00, 0x05, 0x2e, 0x01, 0x0f, 0x37, 0x00, 0x04, 0x05, 0x20, 0x00, 0x03, 0x39,
+            0x00, 0x0b, 0xf0, 0x00, 0x0f, 0x83, 0x00, 0x10, 0x0c, 0xf7, 0x00, 0x13, 0x79, 0xf7, 0x00, 0x02,
+            0x64, 0x01, 0x00, 0xcf, 0x0f, 0x00, 0xb0, 0x02, 0x11, 0x78, 0x34, 0x18, 0x07, 0x2c, 0x00, 0x02,
+            0x1f, 0x00, 0x03, 0x2c, 0x00, 0x01, 0x23, 0x01, 0x01, 0xc2, 0x18, 0x00, 0x2c, 0x00, 0x24, 0x79,
+            0x2e, 0x8b, 0x13, 0x0f, 0xc7, 0x00, 0x02, 0x0f, 0x45, 0x00, 0x05, 0x0a, 0x02, 0x01, 0x02, 0xc9,
+            0x00, 0x00, 0x5c, 0x10, 0x42, 0x20, 0x54, 0x42, 0x4e, 0xde, 0x0e, 0x02, 0x67, 0x10, 0x0f, 0x50,
+            0x02, 0x07, 0x01, 0x67, 0x01, 0x02, 0x99, 0x00, 0x03, 0x0f, 0x01, 0x06, 0x4f, 0x02, 0x07, 0x8a,
+            0x08, 0x0d, 0x9e, 0x01, 0x00, 0x73, 0x2e, 0x02, 0x37, 0x00, 0x10, 0x5f, 0x2b, 0x0a, 0x02, 0x50,
+            0x0a, 0x24, 0x20, 0x3d, 0x3d, 0x0b, 0x00, 0x51, 0x0b, 0x03, 0xe0, 0x01, 0x32, 0x4d, 0x41, 0x50,
+            0x0a, 0x08, 0x37, 0x5f, 0x75, 0x76, 0xa2, 0x06, 0x00, 0xe8, 0x00, 0x0f, 0x41, 0x00, 0x01, 0x0e,
+            0x14, 0x00, 0x11, 0x2a, 0x1b, 0x16, 0x07, 0xe0, 0x15, 0x00, 0x3b, 0x00, 0x08, 0x08, 0x03, 0x09,
+            0xe8, 0x01, 0x02, 0x40, 0x00, 0x00, 0x86, 0x05, 0x00, 0x04, 0x01, 0x13, 0x2a, 0x50, 0x12, 0x07,
+            0xa5, 0x00, 0x00, 0x9f, 0x01, 0x04, 0x84, 0x0e, 0x12, 0x2e, 0x2e, 0x00, 0x00, 0x42, 0x28, 0x00,
+            0xed, 0x15, 0x00, 0x17, 0x17, 0x02, 0x12, 0x00, 0x32, 0x20, 0x2a, 0x20, 0xaa, 0x05, 0x02, 0x39,
+            0x1a, 0x0f, 0x30, 0x00, 0x00, 0x01, 0x0e, 0x16, 0x03, 0x78, 0x07, 0x02, 0xcb, 0x03, 0x02, 0x7f,
+            0x01, 0x09, 0x38, 0x03, 0x0b, 0xa6, 0x00, 0x07, 0x6d, 0x01, 0x06, 0xbc, 0x03, 0x0f, 0x52, 0x14,
+            0x07, 0x27, 0x69, 0x66, 0xa4, 0x0a, 0x04, 0xa7, 0x09, 0x02, 0x8a, 0x01, 0x00, 0x03, 0x01, 0x00,
+            0x04, 0x00, 0x01, 0x4a, 0x04, 0x29, 0x20, 0x2a, 0x78, 0x01, 0x06, 0x34, 0x00, 0x06, 0x78, 0x01,
+            0x08, 0xa2, 0x00, 0x05, 0x34, 0x00, 0x05, 0xd6, 0x00, 0x01, 0x12, 0x00, 0x00, 0x05, 0x01, 0x02,
+            0x27, 0x00, 0x02, 0xb3, 0x06, 0x05, 0x4a, 0x06, 0x02, 0x49, 0x02, 0x02, 0xff, 0x0c, 0x05, 0x15,
+            0x00, 0x0c, 0x2e, 0x00, 0x04, 0xab, 0x06, 0x08, 0x2d, 0x00, 0x04, 0x14, 0x00, 0x0c, 0x2c, 0x00,
+            0x03, 0xab, 0x30, 0x06, 0xd8, 0x29, 0x08, 0x35, 0x00, 0x0d, 0x1d, 0x00, 0x06, 0x3e, 0x00, 0x24,
+            0x69, 0x66, 0x98, 0x0a, 0x05, 0x0d, 0x01, 0x00, 0x96, 0x29, 0x03, 0x29, 0x2b, 0x00, 0xe1, 0x2e,
+            0x63, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0xef, 0x26, 0xd3, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61,
+            0x74, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x4d, 0x10, 0x63, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c,
+            0xe1, 0x26, 0x01, 0x9c, 0x04, 0x07, 0xef, 0x03, 0x00, 0xd4, 0x02, 0x00, 0xd7, 0x35, 0x09, 0x4e,
+            0x01, 0x03, 0x72, 0x00, 0x06, 0x4b, 0x01, 0x33, 0x2e, 0x72, 0x67, 0x51, 0x16, 0x00, 0x81, 0x01,
+            0x0d, 0xaf, 0x00, 0x00, 0x8d, 0x01, 0x43, 0x6f, 0x72, 0x6d, 0x2e, 0x60, 0x31, 0x00, 0x24, 0x00,
+            0x05, 0x35, 0x01, 0x04, 0x1c, 0x00, 0x12, 0x67, 0x68, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x24, 0x01,
+            0x04, 0x1b, 0x00, 0x03, 0x5b, 0x00, 0x0b, 0x4c, 0x02, 0x06, 0xa5, 0x00, 0x2a, 0x69, 0x66, 0x82,
+            0x0c, 0x05, 0x0a, 0x01, 0x01, 0xcd, 0x00, 0x00, 0x52, 0x00, 0x06, 0x2c, 0x00, 0x00, 0x0e, 0x00,
+            0x09, 0x7c, 0x00, 0x07, 0x18, 0x0e, 0x09, 0x45, 0x00, 0x08, 0xdd, 0x00, 0x06, 0x9b, 0x00, 0x02,
+            0x84, 0x00, 0x00, 0x45, 0x00, 0x29, 0x69, 0x66, 0xbf, 0x0c, 0x0f, 0x74, 0x00, 0x0d, 0x08, 0xd4,
+            0x00, 0x07, 0x73, 0x00, 0x08, 0x43, 0x00, 0x0f, 0x72, 0x00, 0x10, 0x0f, 0xbe, 0x0c, 0x02, 0x0f,
+            0x7b, 0x00, 0x0d, 0x0f, 0x8f, 0x01, 0x02, 0x07, 0x84, 0x00, 0x0f, 0x55, 0x00, 0x02, 0x0f, 0x8d,
+            0x00, 0x09, 0x12, 0x7d, 0x71, 0x1c, 0x01, 0x6f, 0x08, 0x10, 0x56, 0x70, 0x0c, 0x02, 0x20, 0x04,
+            0x00, 0x60, 0x04, 0x00, 0x14, 0x00, 0x02, 0x12, 0x08, 0x01, 0xd8, 0x03, 0x30, 0x70, 0x6f, 0x73,
+            0xf1, 0x06, 0x00, 0x30, 0x01, 0x00, 0x1a, 0x00, 0x32, 0x20, 0x64, 0x4c, 0x6a, 0x18, 0x17, 0x33,
+            0x41, 0x18, 0x01, 0x19, 0x00, 0x1f, 0x73, 0x19, 0x00, 0x00, 0x02, 0x73, 0x03, 0x02, 0xef, 0x0b,
+            0x1f, 0x20, 0x39, 0x0c, 0x03, 0x8f, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x20, 0x3f, 0x28, 0x0d,
+            0x04, 0x0c, 0x8a, 0x00, 0x26, 0x20, 0x3a, 0x11, 0x1b, 0x06, 0x81, 0x0b, 0x00, 0xe2, 0x04, 0x01,
+            0x9a, 0x0b, 0x05, 0x45, 0x00, 0x03, 0x03, 0x30, 0x01, 0x39, 0x25, 0x23, 0x20, 0x2a, 0x01, 0x0c,
+            0x0a, 0x68, 0x08, 0x40, 0x2c, 0x20, 0x56, 0x2c, 0x98, 0x27, 0x04, 0xa3, 0x2e, 0x04, 0xe0, 0x01,
+            0x74, 0x2c, 0x20, 0x64, 0x4c, 0x2c, 0x20, 0x73, 0xea, 0x0a, 0x00, 0xfc, 0x0c, 0x02, 0xe5, 0x31,
+            0x01, 0x08, 0x34, 0x22, 0x2e, 0x7a, 0xb2, 0x00, 0x02, 0xb1, 0x04, 0x06, 0x96, 0x02, 0x01, 0x04,
+            0x01, 0x04, 0x32, 0x01, 0x04, 0x23, 0x01, 0x06, 0xd5, 0x07, 0x00, 0x47, 0x01, 0x06, 0x84, 0x02,
+            0x01, 0xce, 0x0d, 0x01, 0xf9, 0x33, 0x00, 0xe7, 0x18, 0xc7, 0x69, 0x6e, 0x74, 0x28, 0x6d, 0x61,
+            0x78, 0x28, 0x6c, 0x6f, 0x67, 0x28, 0xf9, 0x0d, 0x00, 0xd2, 0x05, 0x00, 0x4b, 0x2f, 0x00, 0x82,
+            0x34, 0x01, 0x2c, 0x00, 0x02, 0x25, 0x34, 0x25, 0x20, 0x2b, 0xf5, 0x30, 0x02, 0x16, 0x00, 0x00,
+            0x06, 0x13, 0x01, 0xb7, 0x05, 0x04, 0xa8, 0x01, 0x00, 0xac, 0x01, 0x01, 0x3a, 0x1e, 0x50, 0x20,
+            0x63, 0x65, 0x6c, 0x6c, 0x86, 0x04, 0x31, 0x69, 0x6e, 0x28, 0x11, 0x00, 0x01, 0x06, 0x00, 0x0e,
+            0x84, 0x1f, 0x01, 0x17, 0x06, 0x06, 0xeb, 0x34, 0x00, 0xa0, 0x21, 0x17, 0x2f, 0xae, 0x39, 0x12,
+            0x2c, 0xe3, 0x34, 0x10, 0x29, 0x95, 0x1d, 0x06, 0x26, 0x00, 0x20, 0x20, 0x2d, 0xa7, 0x38, 0x07,
+            0xd4, 0x00, 0x01, 0x38, 0x0a, 0x03, 0xb1, 0x00, 0x01, 0x94, 0x0c, 0x01, 0x2c, 0x00, 0x20, 0x73,
+            0x5b, 0x85, 0x00, 0x02, 0x34, 0x08, 0x08, 0x47, 0x01, 0x00, 0x42, 0x13, 0x11, 0x28, 0x1b, 0x00,
+            0x00, 0x77, 0x20, 0x03, 0x37, 0x00, 0x02, 0x62, 0x01, 0x00, 0x40, 0x13, 0x01, 0x1a, 0x00, 0x23,
+            0x7a, 0x29, 0x66, 0x1f, 0x00, 0xd2, 0x00, 0x00, 0x1b, 0x19, 0x01, 0x38, 0x01, 0x00, 0x08, 0x1e,
+            0x03, 0x30, 0x00, 0x22, 0x2e, 0x78, 0x10, 0x1e, 0x05, 0x0f, 0x00, 0x06, 0x1d, 0x01, 0x27, 0x2e,
+            0x79, 0x24, 0x1e, 0x00, 0x40, 0x00, 0x06, 0xab, 0x01, 0x00, 0x0e, 0x00, 0x01, 0xde, 0x31, 0x00,
+            0xb2, 0x29, 0x03, 0x2b, 0x32, 0x12, 0x3d, 0x08, 0x00, 0x23, 0x73, 0x5b, 0x4b, 0x00, 0x0b, 0xdf,
+            0x31, 0x27, 0x69, 0x5d, 0x8a, 0x00, 0x00, 0x40, 0x00, 0x01, 0xef, 0x01, 0x00, 0xf2, 0x02, 0x01,
+            0x77, 0x02, 0x14, 0x2e, 0xf9, 0x01, 0x01, 0x86, 0x1c, 0x25, 0x20, 0x2d, 0xde, 0x0f, 0x06, 0x1f,
+            0x01, 0x00, 0x35, 0x00, 0x02, 0x0f, 0x03, 0x40, 0x64, 0x69, 0x73, 0x74, 0xff, 0x21, 0x00, 0xaf,
+            0x0d, 0x10, 0x4c, 0xaf, 0x0d, 0x0f, 0x25, 0x00, 0x01, 0x01, 0x11, 0x34, 0x00, 0x26, 0x00, 0x02,
+            0x60, 0x00, 0x01, 0x0f, 0x00, 0x22, 0x20, 0x2a, 0xa5, 0x00, 0x02, 0x0e, 0x00, 0x0a, 0x36, 0x00,
+            0x32, 0x69, 0x66, 0x28, 0x58, 0x00, 0x31, 0x3e, 0x3d, 0x20, 0x1f, 0x00, 0x12, 0x32, 0xa1, 0x02,
+            0x00, 0x77, 0x00, 0x04, 0x04, 0x00, 0x73, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x68, 0x34,
+            0x04, 0x16, 0x00, 0x10, 0x4c, 0xa4, 0x05, 0x03, 0xcc, 0x1a, 0x42, 0x73, 0x71, 0x72, 0x74, 0x48,
+            0x00, 0x03, 0x36, 0x09, 0x04, 0x25, 0x00, 0x24, 0x2f, 0x2f, 0xb0, 0x23, 0x40, 0x20, 0x73, 0x71,
+            0x75, 0x5c, 0x2e, 0xb1, 0x66, 0x61, 0x6c, 0x6c, 0x6f, 0x66, 0x66, 0x20, 0x77, 0x69, 0x6e, 0x17,
+            0x11, 0x00, 0xb4, 0x13, 0x11, 0x72, 0x47, 0x35, 0x40, 0x7a, 0x65, 0x72, 0x6f, 0x79, 0x24, 0x00,
+            0x96, 0x15, 0x01, 0xbe, 0x00, 0x22, 0x27, 0x73, 0x93, 0x00, 0x05, 0xcc, 0x05, 0x00, 0x56, 0x00,
+            0x02, 0x0c, 0x01, 0x02, 0x3e, 0x00, 0x01, 0x2e, 0x02, 0x00, 0x41, 0x0e, 0x02, 0x97, 0x08, 0x02,
+            0x82, 0x00, 0x00, 0x2b, 0x20, 0x00, 0x2a, 0x01, 0x52, 0x29, 0x20, 0x2f, 0x20, 0x28, 0xd3, 0x00,
+            0x00, 0xaf, 0x0e, 0x00, 0x34, 0x19, 0x18, 0x32, 0x58, 0x0e, 0x0a, 0x08, 0x01, 0x02, 0x57, 0x00,
+            0x64, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x75, 0x1d, 0x2c, 0x03, 0x65, 0x00, 0x13, 0x2a, 0xac, 0x00,
+            0x00, 0x50, 0x00, 0x02, 0x2c, 0x01, 0x10, 0x2b, 0x4c, 0x04, 0x0b, 0xea, 0x00, 0x31, 0x69, 0x66,
+            0x28, 0xb5, 0x00, 0x15, 0x2e, 0x22, 0x35, 0x01, 0x72, 0x35, 0x50, 0x20, 0x3e, 0x3d, 0x20, 0x2d,
+            0x51, 0x0f, 0x09, 0xc5, 0x00, 0x00, 0xc9, 0x00, 0x08, 0x6c, 0x00, 0xdf, 0x2a, 0x3d, 0x20, 0x73,
+            0x6d, 0x6f, 0x6f, 0x74, 0x68, 0x73, 0x74, 0x65, 0x70, 0x48, 0x00, 0x02, 0x03, 0x98, 0x04, 0x06,
+            0x5e, 0x00, 0x01, 0x80, 0x35, 0x11, 0x2c, 0x0d, 0x02, 0x24, 0x2d, 0x4c, 0x1e, 0x00, 0x01, 0x4f,
+            0x02, 0x05, 0xb8, 0x35, 0x08, 0xd8, 0x03, 0x00, 0x72, 0x00, 0x05, 0xf8, 0x04, 0x05, 0x30, 0x00,
+            0x01, 0xea, 0x08, 0x20, 0x20, 0x2a, 0xd1, 0x3c, 0x04, 0xf8, 0x00, 0x0f, 0xec, 0x04, 0x22, 0x00,
+            0x5e, 0x00, 0x02, 0x20, 0x07, 0x02, 0x06, 0x00, 0x01, 0xe6, 0x02, 0x10, 0x61, 0xe7, 0x02, 0x03,
+            0x82, 0x06, 0x01, 0x37, 0x03, 0x00, 0x69, 0x00, 0x0c, 0xec, 0x08, 0x02, 0x86, 0x01, 0x05, 0x4c,
+            0x13, 0x02, 0x01, 0x05, 0x90, 0x34, 0x28, 0x73, 0x4c, 0x20, 0x2b, 0x20, 0x28, 0x64, 0x06, 0x00,
+            0x20, 0x61, 0x4c, 0xd1, 0x04, 0x00, 0x52, 0x00, 0x11, 0x28, 0xaf, 0x00, 0x00, 0x4f, 0x04, 0xb0,
+            0x6f, 0x6c, 0x6f, 0x72, 0x2e, 0x61, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_2[] = {
+            0xfc, 0x1a, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x23,
+            0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x42, 0x52, 0x44, 0x46, 0x5f, 0x42, 0x49, 0x4e, 0x44,
+            0x4c, 0x45, 0x53, 0x53, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x15, 0x00, 0x51, 0x65, 0x78,
+            0x74, 0x65, 0x6e, 0x3a, 0x00, 0xf0, 0x2a, 0x47, 0x4c, 0x5f, 0x41, 0x52, 0x42, 0x5f, 0x62, 0x69,
+            0x6e, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x3a,
+            0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a,
+            0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x31, 0x34, 0x30, 0x2c, 0x20,
+            0x32, 0x00, 0xf2, 0x0b, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x75, 0x6e, 0x69,
+            0x66, 0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x55, 0x10, 0x00,
+            0xf0, 0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x69,
+            0x6e, 0xae, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, 0x17, 0x00, 0x0b, 0x0f, 0x00,
+            0xa2, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x24, 0x00, 0xc6, 0x75, 0x76,
+            0x65, 0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x16, 0x00, 0xf3, 0x39, 0x66, 0x6c,
+            0x6f, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x3b, 0x0a, 0x7d, 0x3b,
+            0x0a, 0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65,
+            0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20,
+            0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62, 0x79, 0x20,
+            0x53, 0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xd2, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2c, 0x20,
+            0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x47, 0x01, 0x10, 0x73, 0x51, 0x00, 0xf1, 0x20, 0x41, 0x54,
+            0x54, 0x52, 0x49, 0x42, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+            0x65, 0x20, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x21, 0x00, 0x70,
+            0x6d, 0x65, 0x73, 0x68, 0x20, 0x62, 0x65, 0x1b, 0x01, 0x50, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x82,
+            0x01, 0x10, 0x6e, 0x83, 0x01, 0x07, 0x4d, 0x00, 0x05, 0xac, 0x01, 0x07, 0x14, 0x00, 0x34, 0x20,
+            0x30, 0x75, 0x6b, 0x01, 0x04, 0xca, 0x01, 0x03, 0x1e, 0x00, 0xf3, 0x01, 0x45, 0x4e, 0x41, 0x42,
+            0x4c, 0x45, 0x44, 0x28, 0x69, 0x64, 0x78, 0x29, 0x20, 0x28, 0x28, 0x28, 0x17, 0x00, 0x01, 0x96,
+            0x00, 0x31, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x3d, 0x3d,
+            0x07, 0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74,
+            0x20, 0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7, 0x01, 0x18, 0x3b, 0x18, 0x00, 0x53, 0x43,
+            0x4f, 0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20, 0x2b, 0x28, 0x00, 0x09, 0x24, 0x00, 0x27,
+            0x55, 0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23, 0x00, 0x67, 0x4e, 0x4f, 0x52, 0x4d, 0x41,
+            0x4c, 0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00, 0x77, 0x54, 0x41, 0x4e, 0x47, 0x45, 0x4e,
+            0x54, 0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00, 0xf7, 0x03, 0x49, 0x4e, 0x53, 0x54, 0x41,
+            0x4e, 0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46, 0x4f, 0x52, 0x4d, 0x34, 0x00, 0x07,
+            0x46, 0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x3d, 0x00, 0x3f,
+            0x34, 0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00, 0x03, 0x65, 0x4d, 0x41, 0x54, 0x45, 0x52,
+            0x49, 0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00, 0x02, 0x09, 0x47, 0x00, 0x38, 0x4e, 0x45,
+            0x58, 0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00, 0x30, 0x3b, 0x0a, 0x0a, 0x5e, 0x02, 0x90,
+            0x77, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x7d, 0x01, 0x25, 0x2c, 0x20, 0xf5, 0x00,
+            0x2d, 0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x00, 0xf3, 0x00, 0x20,
+            0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0xd6, 0x01,
+            0x43, 0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31, 0x02, 0x33, 0x20, 0x3d, 0x20, 0x2b, 0x02,
+            0x03, 0x11, 0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44, 0x58, 0x29, 0xb4, 0x00, 0x01, 0x36,
+            0x00, 0x24, 0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02, 0xd0, 0x01, 0x0a, 0x30, 0x00, 0x03,
+            0xbf, 0x01, 0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d, 0x68, 0x00, 0x04, 0xc3, 0x01, 0x0f,
+            0x39, 0x00, 0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x0f, 0x72, 0x04, 0x07, 0x17, 0x31, 0x72,
+            0x04, 0x5b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x70, 0x04, 0xd0, 0x76, 0x65, 0x63, 0x33, 0x20, 0x61,
+            0x6d, 0x62, 0x69, 0x65, 0x6e, 0x74, 0x4c, 0x20, 0x00, 0x03, 0x4c, 0x04, 0x00, 0x11, 0x03, 0x52,
+            0x5f, 0x70, 0x61, 0x64, 0x31, 0x10, 0x00, 0x01, 0x27, 0x00, 0x01, 0x40, 0x00, 0x52, 0x43, 0x6f,
+            0x6c, 0x6f, 0x72, 0x15, 0x00, 0x02, 0x5b, 0x04, 0x00, 0x26, 0x00, 0x12, 0x32, 0x11, 0x00, 0x01,
+            0x26, 0x00, 0x00, 0xa6, 0x04, 0x11, 0x5f, 0x2b, 0x00, 0x38, 0x44, 0x69, 0x72, 0xa0, 0x04, 0x06,
+            0x2f, 0x00, 0x12, 0x33, 0x2f, 0x00, 0x00, 0xb1, 0x04, 0xf1, 0x0e, 0x33, 0x20, 0x63, 0x6c, 0x75,
+            0x73, 0x74, 0x65, 0x72, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x74, 0x69,
+            0x6c, 0x65, 0x73, 0x20, 0x78, 0x2c, 0x20, 0x79, 0xcc, 0x01, 0xf4, 0x0a, 0x64, 0x65, 0x70, 0x74,
+            0x68, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x73, 0x2c, 0x20, 0x7a, 0x20, 0x69, 0x73, 0x20, 0x30,
+            0x20, 0x77, 0x68, 0x65, 0x6e, 0x3a, 0x00, 0x31, 0x65, 0x64, 0x20, 0x6f, 0x00, 0x02, 0xcd, 0x04,
+            0x31, 0x6f, 0x66, 0x66, 0x32, 0x05, 0x02, 0x6e, 0x00, 0x04, 0x5d, 0x00, 0x01, 0x3f, 0x00, 0x62,
+            0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x7c, 0x00, 0x0f, 0x1f, 0x00, 0x01, 0x02, 0x21, 0x05, 0x00,
+            0x86, 0x05, 0x01, 0x10, 0x04, 0xf1, 0x05, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x5f, 0x63, 0x61,
+            0x73, 0x63, 0x61, 0x64, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0xa1, 0x00, 0x03, 0x7f, 0x00,
+            0x02, 0x20, 0x00, 0x06, 0x76, 0x00, 0x21, 0x7d, 0x3b, 0xac, 0x02, 0x14, 0x64, 0xf6, 0x00, 0x22,
+            0x61, 0x6c, 0x98, 0x00, 0x04, 0x29, 0x00, 0x72, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20, 0x43, 0x4f,
+            0x00, 0x10, 0x64, 0x56, 0x05, 0x63, 0x6f, 0x77, 0x4d, 0x61, 0x70, 0x73, 0x96, 0x02, 0x01, 0x74,
+            0x00, 0xff, 0x09, 0x4d, 0x41, 0x58, 0x5f, 0x53, 0x48, 0x41, 0x44, 0x4f, 0x57, 0x5f, 0x43, 0x41,
+            0x53, 0x43, 0x41, 0x44, 0x45, 0x53, 0x20, 0x3d, 0x20, 0x34, 0x3b, 0xe1, 0x01, 0x07, 0x17, 0x32,
+            0xe1, 0x01, 0x02, 0x69, 0x00, 0x0b, 0xe2, 0x01, 0x01, 0x52, 0x06, 0x02, 0x1a, 0x00, 0x50, 0x5f,
+            0x6d, 0x61, 0x74, 0x72, 0x48, 0x01, 0x1f, 0x5b, 0x68, 0x00, 0x00, 0x11, 0x5d, 0xdc, 0x00, 0x00,
+            0xbe, 0x01, 0x93, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x74, 0x6f, 0xba, 0x00, 0x54, 0x20,
+            0x6d, 0x61, 0x70, 0x20, 0xee, 0x06, 0x01, 0x1c, 0x00, 0x01, 0x62, 0x01, 0x43, 0x76, 0x65, 0x63,
+            0x34, 0x22, 0x00, 0x05, 0x25, 0x01, 0x61, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x4a, 0x00, 0x32,
+            0x66, 0x61, 0x72, 0x4e, 0x00, 0x02, 0xc1, 0x01, 0x83, 0x6f, 0x66, 0x20, 0x65, 0x61, 0x63, 0x68,
+            0x20, 0x4f, 0x01, 0x00, 0x88, 0x06, 0x00, 0xda, 0x03, 0x03, 0xa1, 0x01, 0x50, 0x65, 0x64, 0x20,
+            0x70, 0x6f, 0x74, 0x02, 0x00, 0xbe, 0x03, 0x42, 0x73, 0x70, 0x6f, 0x74, 0x3b, 0x01, 0x04, 0x34,
+            0x01, 0x02, 0x23, 0x02, 0x21, 0x65, 0x64, 0xa2, 0x02, 0xb1, 0x69, 0x6e, 0x67, 0x0a, 0x73, 0x74,
+            0x72, 0x75, 0x63, 0x74, 0x20, 0x10, 0x00, 0x43, 0x44, 0x61, 0x74, 0x61, 0x3e, 0x07, 0x06, 0x81,
+            0x02, 0x4c, 0x70, 0x6f, 0x73, 0x69, 0x05, 0x07, 0x43, 0x72, 0x61, 0x6e, 0x67, 0xff, 0x01, 0x01,
+            0x29, 0x00, 0x1c, 0x63, 0xcb, 0x02, 0x00, 0x79, 0x00, 0xa1, 0x5f, 0x63, 0x6f, 0x73, 0x5f, 0x6f,
+            0x75, 0x74, 0x65, 0x72, 0xc6, 0x00, 0xc3, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x2d, 0x31, 0x20,
+            0x66, 0x6f, 0x72, 0xa3, 0x00, 0x02, 0x6d, 0x02, 0x04, 0x03, 0x01, 0x11, 0x33, 0xe5, 0x00, 0x15,
+            0x5f, 0xf6, 0x01, 0x08, 0x5f, 0x02, 0x05, 0x50, 0x00, 0x51, 0x69, 0x6e, 0x6e, 0x65, 0x72, 0x7c,
+            0x07, 0x06, 0x1b, 0x08, 0x29, 0x34, 0x33, 0x1b, 0x08, 0xf3, 0x05, 0x31, 0x29, 0x20, 0x72, 0x65,
+            0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x5f, 0x1d,
+            0x01, 0x01, 0xe6, 0x00, 0x04, 0x21, 0x08, 0x01, 0x0d, 0x00, 0x00, 0xf3, 0x00, 0x03, 0x22, 0x01,
+            0x2f, 0x5b, 0x5d, 0x58, 0x00, 0x0b, 0x1f, 0x32, 0x58, 0x00, 0x07, 0x04, 0x53, 0x00, 0x00, 0x88,
+            0x03, 0x14, 0x32, 0x4e, 0x03, 0x22, 0x73, 0x5b, 0x09, 0x02, 0xb4, 0x6f, 0x66, 0x66, 0x73, 0x65,
+            0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x1b, 0x00, 0x02, 0xd6, 0x03, 0x40, 0x5f, 0x69, 0x6e, 0x64,
+            0x44, 0x02, 0x12, 0x2c, 0x81, 0x00, 0x11, 0x20, 0x18, 0x03, 0x00, 0xcf, 0x01, 0x0f, 0xdb, 0x00,
+            0x06, 0x1f, 0x33, 0x83, 0x00, 0x07, 0x01, 0xce, 0x00, 0x12, 0x49, 0x51, 0x00, 0x03, 0xc4, 0x01,
+            0x01, 0x08, 0x03, 0x03, 0xfa, 0x00, 0x0a, 0x72, 0x00, 0x03, 0xeb, 0x00, 0x08, 0x30, 0x03, 0xad,
+            0x41, 0x4c, 0x42, 0x45, 0x44, 0x4f, 0x5f, 0x4d, 0x41, 0x50, 0xb7, 0x07, 0x93, 0x52, 0x4f, 0x55,
+            0x47, 0x48, 0x4e, 0x45, 0x53, 0x53, 0x1e, 0x00, 0x07, 0x2b, 0x00, 0x34, 0x2b, 0x20, 0x31, 0xd6,
+            0x05, 0x01, 0x6e, 0x00, 0x83, 0x4d, 0x45, 0x54, 0x41, 0x4c, 0x4c, 0x49, 0x43, 0x2a, 0x00, 0x0a,
+            0x3a, 0x00, 0x0c, 0x2d, 0x00, 0x03, 0xb3, 0x05, 0x02, 0x73, 0x00, 0x09, 0x3a, 0x00, 0x0c, 0x2a,
+            0x00, 0x40, 0x41, 0x4d, 0x42, 0x49, 0xce, 0x07, 0x93, 0x4f, 0x43, 0x43, 0x4c, 0x55, 0x53, 0x49,
+            0x4f, 0x4e, 0x60, 0x00, 0x07, 0x42, 0x00, 0x0c, 0x33, 0x00, 0x00, 0xc9, 0x07, 0x02, 0x5a, 0x00,
+            0x0f, 0x3d, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x24, 0x05, 0x20, 0x4f, 0x63, 0x22, 0x01, 0xf8,
+            0x17, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x52, 0x6f, 0x75, 0x67, 0x68, 0x6e, 0x65, 0x73, 0x73, 0x2c,
+            0x20, 0x4d, 0x65, 0x74, 0x61, 0x6c, 0x6c, 0x69, 0x63, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x65, 0x64,
+            0x20, 0x69, 0x6e, 0x20, 0x52, 0x47, 0x42, 0x30, 0x01, 0x01, 0x74, 0x07, 0x02, 0x61, 0x00, 0x04,
+            0x6b, 0x00, 0x00, 0x53, 0x00, 0x04, 0x5f, 0x04, 0x06, 0xaa, 0x0a, 0x04, 0x29, 0x00, 0x06, 0x5e,
+            0x04, 0xe2, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x41, 0x72, 0x72, 0x61, 0x79,
+            0xbf, 0x04, 0x04, 0xff, 0x03, 0x31, 0x6d, 0x61, 0x70, 0x2e, 0x03, 0x80, 0x46, 0x72, 0x61, 0x67,
+            0x6d, 0x65, 0x6e, 0x74, 0x1e, 0x00, 0x20, 0x65, 0x72, 0x5f, 0x0b, 0x23, 0x3a, 0x3a, 0xcf, 0x04,
+            0x94, 0x4d, 0x41, 0x50, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x0a, 0xbc, 0x03, 0x80, 0x4d, 0x61, 0x74,
+            0x65, 0x72, 0x69, 0x61, 0x6c, 0xcc, 0x02, 0x03, 0xfb, 0x01, 0x01, 0x52, 0x04, 0x01, 0x96, 0x03,
+            0x48, 0x5f, 0x6d, 0x6f, 0x64, 0x4a, 0x03, 0x14, 0x72, 0xe5, 0x00, 0x0c, 0x19, 0x00, 0x13, 0x6d,
+            0xf3, 0x00, 0x0c, 0x18, 0x00, 0x03, 0xd3, 0x06, 0x24, 0x5f, 0x6f, 0x29, 0x01, 0x0c, 0x21, 0x00,
+            0x66, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x16, 0x00, 0x01, 0x09, 0x02, 0x02, 0xb3, 0x0a, 0x04,
+            0xda, 0x0b, 0x14, 0x5f, 0xb1, 0x0a, 0x01, 0xdc, 0x00, 0x62, 0x73, 0x65, 0x6c, 0x65, 0x63, 0x74,
+            0xdb, 0x0a, 0x12, 0x76, 0x3f, 0x0b, 0x31, 0x20, 0x6f, 0x6e, 0xc9, 0x0a, 0x81, 0x43, 0x50, 0x55,
+            0x20, 0x73, 0x69, 0x64, 0x65, 0x14, 0x04, 0x01, 0x49, 0x00, 0x00, 0x15, 0x07, 0x40, 0x5b, 0x33,
+            0x5d, 0x3b, 0x4d, 0x06, 0x20, 0x20, 0x20, 0xb2, 0x01, 0x0f, 0x1b, 0x01, 0x01, 0x04, 0x03, 0x01,
+            0x03, 0xb2, 0x05, 0x00, 0x0a, 0x01, 0x30, 0x3a, 0x3a, 0x5f, 0x3c, 0x00, 0x01, 0x4a, 0x00, 0x00,
+            0x10, 0x05, 0xc0, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x5b, 0x38, 0x4f,
+            0x00, 0xf7, 0x02, 0x2f, 0x2f, 0x20, 0x54, 0x45, 0x58, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x41, 0x52,
+            0x52, 0x41, 0x59, 0x53, 0x8c, 0x00, 0x21, 0x6c, 0x79, 0x37, 0x00, 0x02, 0xcf, 0x03, 0x00, 0x39,
+            0x00, 0x21, 0x68, 0x61, 0xab, 0x0c, 0x01, 0x3a, 0x00, 0x34, 0x2f, 0x2f, 0x20, 0xea, 0x0c, 0x09,
+            0x33, 0x00, 0x42, 0x2c, 0x20, 0x30, 0x20, 0x28, 0x00, 0x01, 0xe3, 0x04, 0x60, 0x75, 0x6e, 0x75,
+            0x73, 0x65, 0x64, 0xf2, 0x05, 0x10, 0x73, 0xd4, 0x03, 0xd0, 0x2f, 0x2f, 0x20, 0x65, 0x76, 0x65,
+            0x72, 0x79, 0x20, 0x72, 0x65, 0x67, 0x69, 0xa7, 0x07, 0x01, 0x1c, 0x00, 0x02, 0xb9, 0x01, 0x90,
+            0x2c, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x64, 0x25, 0x0c, 0x00, 0xf1, 0x0b, 0xc0, 0x70,
+            0x65, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0xc9, 0x0c, 0x01, 0xdf, 0x01,
+            0x02, 0x25, 0x00, 0x04, 0x61, 0x02, 0x0e, 0xf8, 0x04, 0x1f, 0x30, 0x1d, 0x04, 0x00, 0x13, 0x6d,
+            0x1b, 0x02, 0x04, 0xa1, 0x04, 0x04, 0x28, 0x01, 0x00, 0x21, 0x01, 0x05, 0x59, 0x00, 0x00, 0xa9,
+            0x04, 0x03, 0xa3, 0x00, 0xf2, 0x09, 0x56, 0x49, 0x53, 0x49, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59,
+            0x5f, 0x52, 0x45, 0x53, 0x4f, 0x4c, 0x56, 0x45, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0xad, 0x01,
+            0x01, 0x12, 0x0d, 0x70, 0x76, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x7b, 0x0c, 0xb1, 0x56, 0x69,
+            0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x42, 0x68, 0x05, 0x04, 0xce, 0x0c, 0xf0, 0x04,
+            0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 0x20, 0x6f, 0x75,
+            0x74, 0x70, 0x75, 0xef, 0x01, 0x11, 0x6f, 0x98, 0x05, 0x10, 0x2c, 0xad, 0x06, 0x00, 0xe5, 0x00,
+            0x21, 0x69, 0x6e, 0x17, 0x00, 0x02, 0x18, 0x06, 0x00, 0x3e, 0x0d, 0x21, 0x72, 0x65, 0x44, 0x0c,
+            0x00, 0x90, 0x06, 0x71, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x14, 0x02, 0x15, 0x76, 0x66,
+            0x00, 0x04, 0xcf, 0x05, 0x00, 0xdb, 0x06, 0x00, 0x42, 0x00, 0x02, 0xf7, 0x0c, 0x01, 0x7b, 0x00,
+            0x11, 0x73, 0x30, 0x01, 0x30, 0x65, 0x61, 0x64, 0xfb, 0x0c, 0x00, 0xfa, 0x0c, 0x0e, 0xca, 0x00,
+            0x00, 0x78, 0x00, 0x16, 0x52, 0x63, 0x00, 0x02, 0xd3, 0x00, 0x13, 0x66, 0x68, 0x03, 0x01, 0x80,
+            0x03, 0x01, 0x76, 0x01, 0x01, 0x95, 0x00, 0x33, 0x6f, 0x66, 0x20, 0x56, 0x0e, 0x10, 0x2e, 0xc6,
+            0x00, 0x51, 0x2e, 0x67, 0x6c, 0x73, 0x6c, 0xd6, 0x01, 0x00, 0x77, 0x00, 0x0f, 0x07, 0x01, 0x0d,
+            0x10, 0x2e, 0x6a, 0x00, 0xf2, 0x04, 0x54, 0x68, 0x65, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x27,
+            0x73, 0x20, 0x49, 0x44, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x72, 0x00, 0x05, 0xd8, 0x01, 0x01, 0xc6,
+            0x00, 0x00, 0x3d, 0x0e, 0x21, 0x67, 0x6c, 0x08, 0x0e, 0x31, 0x6f, 0x73, 0x65, 0x33, 0x01, 0x00,
+            0x13, 0x06, 0x01, 0x4e, 0x0e, 0x58, 0x66, 0x65, 0x74, 0x63, 0x68, 0x0a, 0x01, 0x08, 0xf0, 0x00,
+            0x02, 0x47, 0x01, 0x40, 0x72, 0x61, 0x6e, 0x73, 0x05, 0x0f, 0x00, 0x70, 0x0e, 0x10, 0x6e, 0xa7,
+            0x04, 0xf0, 0x04, 0x74, 0x65, 0x72, 0x70, 0x6f, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69,
+            0x74, 0x68, 0x20, 0x70, 0x65, 0x72, 0x95, 0x0e, 0x01, 0x40, 0x0e, 0x30, 0x63, 0x6f, 0x72, 0x47,
+            0x0a, 0x80, 0x20, 0x62, 0x61, 0x72, 0x79, 0x63, 0x65, 0x6e, 0xc1, 0x08, 0x90, 0x73, 0x2e, 0x20,
+            0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x21, 0x00, 0x02, 0x81, 0x09, 0x20, 0x64, 0x69, 0x33, 0x07,
+            0x32, 0x65, 0x6e, 0x63, 0x8f, 0x0e, 0x21, 0x74, 0x6f, 0x85, 0x01, 0x08, 0x34, 0x00, 0x00, 0xfb,
+            0x01, 0x01, 0x08, 0x01, 0x00, 0xe6, 0x0a, 0x01, 0x5a, 0x0a, 0x20, 0x75, 0x70, 0xb2, 0x02, 0x94,
+            0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0xce, 0x03, 0x47, 0x73, 0x61, 0x6d, 0x65,
+            0xe3, 0x00, 0x91, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x64, 0x46, 0x64, 0x78, 0x34, 0x00, 0x40, 0x64,
+            0x46, 0x64, 0x79, 0x4a, 0x00, 0x61, 0x61, 0x20, 0x71, 0x75, 0x61, 0x64, 0x34, 0x01, 0x10, 0x4f,
+            0xb3, 0x07, 0x01, 0x35, 0x01, 0x01, 0x5f, 0x02, 0x01, 0x64, 0x00, 0x00, 0x85, 0x0f, 0x82, 0x76,
+            0x65, 0x64, 0x20, 0x64, 0x72, 0x61, 0x77, 0x79, 0x02, 0x00, 0x17, 0x00, 0x83, 0x47, 0x4c, 0x5f,
+            0x45, 0x51, 0x55, 0x41, 0x4c, 0x13, 0x09, 0x80, 0x74, 0x65, 0x73, 0x74, 0x20, 0x61, 0x67, 0x61,
+            0x5c, 0x01, 0x01, 0xaf, 0x00, 0x84, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x39, 0x00,
+            0x01, 0x27, 0x00, 0x14, 0x2e, 0x3c, 0x03, 0x64, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x5f, 0xfb, 0x01,
+            0x10, 0x5f, 0x3e, 0x00, 0x74, 0x73, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x22, 0x00, 0x06, 0xbf,
+            0x05, 0x16, 0x38, 0xb8, 0x05, 0x15, 0x75, 0xb9, 0x05, 0x07, 0x94, 0x02, 0x32, 0x5f, 0x69, 0x64,
+            0xa6, 0x09, 0x0c, 0x0d, 0x03, 0x42, 0x3a, 0x3a, 0x49, 0x44, 0xa8, 0x05, 0x03, 0xcf, 0x07, 0x40,
+            0x6c, 0x6f, 0x63, 0x61, 0x49, 0x09, 0x0a, 0x4c, 0x0c, 0x01, 0xe5, 0x04, 0x00, 0xdd, 0x00, 0x55,
+            0x5f, 0x62, 0x61, 0x73, 0x65, 0x9f, 0x0a, 0x07, 0x2d, 0x00, 0x07, 0x98, 0x0a, 0x01, 0x2d, 0x00,
+            0x04, 0x51, 0x01, 0x03, 0x48, 0x0b, 0x04, 0xb3, 0x00, 0x07, 0x32, 0x00, 0x16, 0x33, 0xb4, 0x00,
+            0x01, 0x6c, 0x0d, 0x03, 0x5e, 0x04, 0x02, 0x56, 0x0b, 0x13, 0x49, 0x58, 0x04, 0x00, 0x03, 0x04,
+            0x11, 0x2c, 0x2d, 0x01, 0x02, 0x4b, 0x04, 0x13, 0x20, 0x0a, 0x0a, 0xe0, 0x73, 0x69, 0x7a, 0x65,
+            0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x75, 0x70, 0xbc, 0x0a, 0x00, 0x71, 0x01, 0xf4,
+            0x01, 0x70, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x31, 0x34, 0x34, 0x20, 0x62, 0x79, 0x74, 0x65,
+            0x73, 0x7c, 0x06, 0x06, 0xf6, 0x00, 0x04, 0x58, 0x00, 0x03, 0x82, 0x06, 0x01, 0x2d, 0x0b, 0x52,
+            0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x7e, 0x06, 0x01, 0x10, 0x00, 0x04, 0x8f, 0x11, 0x07, 0x18, 0x00,
+            0x01, 0xd3, 0x00, 0x04, 0xa7, 0x04, 0x01, 0x81, 0x09, 0x23, 0x2f, 0x2f, 0xe8, 0x03, 0x0f, 0x05,
+            0x02, 0x03, 0x12, 0x2c, 0x73, 0x0a, 0x10, 0x61, 0x3c, 0x07, 0x02, 0xb2, 0x02, 0x10, 0x74, 0x88,
+            0x02, 0x24, 0x6c, 0x79, 0xac, 0x07, 0x01, 0x91, 0x0c, 0x14, 0x73, 0x17, 0x01, 0x02, 0xdd, 0x00,
+            0x08, 0x3b, 0x12, 0x1f, 0x38, 0x28, 0x05, 0x00, 0x06, 0xd0, 0x01, 0x04, 0xc7, 0x00, 0x04, 0x32,
+            0x05, 0x0e, 0xe1, 0x00, 0x09, 0xfd, 0x01, 0x03, 0x4d, 0x01, 0x04, 0x43, 0x05, 0x03, 0xeb, 0x01,
+            0x0e, 0x75, 0x00, 0x1f, 0x39, 0x75, 0x00, 0x0a, 0x13, 0x50, 0x64, 0x0b, 0x04, 0x75, 0x00, 0x01,
+            0xc3, 0x00, 0x08, 0x68, 0x00, 0x04, 0x85, 0x0b, 0x0f, 0x68, 0x00, 0x0e, 0x1f, 0x31, 0x06, 0x06,
+            0x01, 0x06, 0xde, 0x00, 0x30, 0x45, 0x6c, 0x65, 0x56, 0x08, 0x04, 0x68, 0x00, 0x01, 0x7d, 0x01,
+            0x06, 0x1e, 0x00, 0x23, 0x5f, 0x65, 0x1f, 0x00, 0x03, 0x20, 0x0a, 0x0f, 0xce, 0x00, 0x06, 0x1f,
+            0x31, 0x64, 0x0b, 0x01, 0x06, 0x48, 0x00, 0x01, 0xda, 0x0e, 0x04, 0x64, 0x00, 0x01, 0xdd, 0x0c,
+            0x06, 0x1c, 0x00, 0x11, 0x5f, 0x96, 0x08, 0x0f, 0xc8, 0x00, 0x0f, 0x0f, 0x6e, 0x0b, 0x01, 0x06,
+            0x46, 0x00, 0x27, 0x55, 0x56, 0x5f, 0x00, 0x18, 0x32, 0x2a, 0x01, 0x2f, 0x75, 0x76, 0x5c, 0x00,
+            0x0f, 0x0f, 0x47, 0x0b, 0x01, 0x06, 0x5c, 0x00, 0x11, 0x4e, 0xd0, 0x08, 0x04, 0x60, 0x00, 0x0d,
+            0x8b, 0x01, 0x02, 0xef, 0x08, 0x0f, 0x65, 0x00, 0x0f, 0x1f, 0x34, 0xf2, 0x01, 0x0a, 0x10, 0x54,
+            0x42, 0x0d, 0x2f, 0x6e, 0x74, 0x66, 0x00, 0x06, 0x13, 0x74, 0x20, 0x00, 0x03, 0x8a, 0x01, 0x11,
+            0x0a, 0xaa, 0x01, 0x00, 0xb2, 0x04, 0x00, 0x7a, 0x0e, 0x01, 0x0f, 0x08, 0x2f, 0x3b, 0x0a, 0xcd,
+            0x07, 0x02, 0x31, 0x3b, 0x0a, 0x0a, 0x72, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x36, 0x0e, 0x57, 0x5f,
+            0x70, 0x6f, 0x73, 0x3b, 0x14, 0x00, 0x0b, 0x0f, 0x00, 0x01, 0x8f, 0x01, 0x01, 0x20, 0x00, 0x12,
+            0x32, 0x34, 0x00, 0x21, 0x75, 0x76, 0x0e, 0x00, 0x12, 0x33, 0x0e, 0x00, 0x01, 0x42, 0x00, 0x02,
+            0xf3, 0x00, 0x0d, 0x17, 0x00, 0x03, 0xa4, 0x00, 0x0d, 0x18, 0x00, 0x2f, 0x62, 0x69, 0x1a, 0x00,
+            0x05, 0x77, 0x70, 0x6f, 0x73, 0x5f, 0x64, 0x78, 0x2c, 0x5b, 0x00, 0x01, 0x12, 0x00, 0x11, 0x79,
+            0x43, 0x00, 0x05, 0x80, 0x00, 0x06, 0x23, 0x00, 0x52, 0x75, 0x76, 0x5f, 0x64, 0x79, 0xd2, 0x00,
+            0x30, 0x33, 0x20, 0x46, 0x0f, 0x07, 0x51, 0x56, 0x65, 0x63, 0x33, 0x28, 0x0d, 0x01, 0x00, 0x98,
+            0x07, 0x32, 0x65, 0x78, 0x2c, 0x72, 0x14, 0x02, 0x1b, 0x15, 0x13, 0x29, 0x7c, 0x04, 0x01, 0x20,
+            0x00, 0x31, 0x69, 0x20, 0x3d, 0x4f, 0x07, 0x72, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x33, 0x75, 0x86,
+            0x04, 0x32, 0x69, 0x66, 0x28, 0x2b, 0x00, 0x00, 0xb7, 0x14, 0x03, 0x3e, 0x0c, 0x00, 0xf9, 0x11,
+            0x01, 0xef, 0x09, 0x00, 0x63, 0x0a, 0x61, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x63, 0x04, 0x16,
+            0x28, 0x13, 0x02, 0x03, 0x02, 0x01, 0x58, 0x73, 0x5b, 0x69, 0x5d, 0x2c, 0x6d, 0x02, 0x05, 0x17,
+            0x00, 0x5f, 0x20, 0x2b, 0x20, 0x31, 0x75, 0x1c, 0x00, 0x07, 0x4f, 0x32, 0x75, 0x5d, 0x29, 0x81,
+            0x00, 0x00, 0x08, 0x7b, 0x12, 0x0f, 0x82, 0x00, 0x0d, 0x03, 0x53, 0x01, 0x0d, 0x83, 0x00, 0x06,
+            0x18, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x09, 0x1d, 0x00, 0x06, 0x85, 0x00, 0x0f, 0xe5, 0x00, 0x04,
+            0x06, 0x65, 0x04, 0x0b, 0xe7, 0x00, 0x07, 0x19, 0x00, 0x0f, 0x65, 0x00, 0x00, 0x0a, 0x1e, 0x00,
+            0x02, 0x66, 0x00, 0x11, 0x7d, 0xc1, 0x11, 0x0f, 0x7d, 0x08, 0x0d, 0x00, 0xff, 0x07, 0x00, 0x5d,
+            0x06, 0x04, 0xd2, 0x06, 0x00, 0x34, 0x17, 0x74, 0x61, 0x6e, 0x20, 0x4e, 0x44, 0x43, 0x20, 0x55,
+            0x00, 0x00, 0xb9, 0x02, 0x37, 0x33, 0x20, 0x42, 0xb2, 0x08, 0xc1, 0x28, 0x6d, 0x61, 0x74, 0x33,
+            0x78, 0x34, 0x20, 0x63, 0x6c, 0x69, 0x70, 0x0c, 0x06, 0x54, 0x32, 0x20, 0x6e, 0x64, 0x63, 0xfb,
+            0x01, 0x01, 0x1c, 0x06, 0x04, 0x67, 0x06, 0x10, 0x77, 0x6b, 0x07, 0x42, 0x2e, 0x66, 0x20, 0x2f,
+            0xd0, 0x01, 0x00, 0x32, 0x00, 0x61, 0x5b, 0x30, 0x5d, 0x2e, 0x77, 0x2c, 0x3d, 0x00, 0x26, 0x5b,
+            0x31, 0x0b, 0x00, 0x43, 0x32, 0x5d, 0x2e, 0x77, 0xa2, 0x01, 0x01, 0xfc, 0x17, 0x42, 0x70, 0x30,
+            0x20, 0x3d, 0x25, 0x00, 0x75, 0x30, 0x5d, 0x2e, 0x78, 0x79, 0x20, 0x2a, 0x4a, 0x18, 0x32, 0x77,
+            0x2e, 0x78, 0xca, 0x01, 0x01, 0x28, 0x00, 0x24, 0x65, 0x31, 0x28, 0x00, 0x1d, 0x31, 0x28, 0x00,
+            0x68, 0x79, 0x20, 0x2d, 0x20, 0x70, 0x30, 0x2d, 0x00, 0x14, 0x32, 0x2d, 0x00, 0x1d, 0x32, 0x2d,
+            0x00, 0x1c, 0x7a, 0x2d, 0x00, 0x30, 0x64, 0x20, 0x3d, 0xd8, 0x00, 0x07, 0x17, 0x00, 0x02, 0x8a,
+            0x04, 0x04, 0xdc, 0x00, 0x45, 0x61, 0x72, 0x65, 0x61, 0xdf, 0x00, 0x40, 0x28, 0x65, 0x31, 0x2e,
+            0xe7, 0x02, 0x21, 0x65, 0x32, 0x76, 0x00, 0x30, 0x65, 0x31, 0x2e, 0xb3, 0x00, 0x43, 0x65, 0x32,
+            0x2e, 0x78, 0xd5, 0x00, 0x02, 0x3c, 0x00, 0x10, 0x62, 0xae, 0x00, 0x28, 0x28, 0x64, 0x2b, 0x00,
+            0x16, 0x64, 0x2a, 0x00, 0x07, 0xe5, 0x00, 0x00, 0x5d, 0x00, 0x02, 0xb9, 0x00, 0x03, 0x39, 0x00,
+            0x00, 0xba, 0x00, 0x04, 0x65, 0x00, 0x00, 0x33, 0x00, 0x05, 0x64, 0x00, 0x1f, 0x64, 0x39, 0x00,
+            0x05, 0x01, 0x89, 0x01, 0x10, 0x77, 0x12, 0x0a, 0x21, 0x74, 0x73, 0x8a, 0x03, 0xb0, 0x63, 0x33,
+            0x28, 0x31, 0x2e, 0x66, 0x20, 0x2d, 0x20, 0x62, 0x31, 0x05, 0x00, 0x98, 0x32, 0x2c, 0x20, 0x62,
+            0x31, 0x2c, 0x20, 0x62, 0x32, 0x3f, 0x00, 0x03, 0xa4, 0x19, 0x03, 0xa0, 0x02, 0x04, 0x3e, 0x00,
+            0x33, 0x2f, 0x20, 0x28, 0x0b, 0x00, 0x54, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x0c, 0x00, 0x17, 0x79,
+            0x0c, 0x00, 0xb8, 0x7a, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0xe4, 0x0b,
+            0x04, 0x2b, 0x0e, 0x14, 0x28, 0x1f, 0x02, 0x01, 0x1a, 0x04, 0x00, 0x2a, 0x09, 0x30, 0x6c, 0x5f,
+            0x69, 0x62, 0x01, 0x51, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x59, 0x04, 0x08, 0xee, 0x03, 0x60, 0x69,
+            0x64, 0x73, 0x2c, 0x20, 0x69, 0xe1, 0x01, 0x40, 0x28, 0x67, 0x6c, 0x5f, 0x45, 0x00, 0xf1, 0x02,
+            0x43, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x20,
+            0x2d, 0x90, 0x0a, 0x03, 0xb3, 0x09, 0x00, 0x38, 0x04, 0x01, 0x59, 0x00, 0x00, 0x7f, 0x0a, 0x01,
+            0xb3, 0x0d, 0x16, 0x3d, 0x64, 0x00, 0x15, 0x2f, 0x01, 0x0b, 0x04, 0xb0, 0x09, 0x05, 0x2f, 0x00,
+            0x05, 0xf7, 0x02, 0x07, 0x2f, 0x00, 0x11, 0x2d, 0xc8, 0x0c, 0x01, 0x45, 0x00, 0x1f, 0x2a, 0x3a,
+            0x00, 0x02, 0x0f, 0x90, 0x08, 0x00, 0x30, 0x64, 0x61, 0x74, 0x0b, 0x02, 0x08, 0xc1, 0x00, 0x05,
+            0x97, 0x08, 0x04, 0x93, 0x00, 0x13, 0x5d, 0xcf, 0x01, 0x08, 0x42, 0x06, 0x21, 0x20, 0x3d, 0x3b,
+            0x00, 0x16, 0x2e, 0x7e, 0x09, 0x00, 0x9b, 0x00, 0x04, 0x0e, 0x00, 0x27, 0x20, 0x3d, 0x21, 0x0e,
+            0x01, 0x1a, 0x06, 0x04, 0x1a, 0x00, 0x31, 0x5d, 0x3b, 0x0a, 0xae, 0x04, 0x00, 0x1f, 0x0f, 0x11,
+            0x33, 0x64, 0x05, 0x01, 0xb3, 0x0c, 0x12, 0x3d, 0x11, 0x00, 0x15, 0x28, 0xd7, 0x00, 0x00, 0x77,
+            0x05, 0x33, 0x29, 0x20, 0x2b, 0x17, 0x00, 0xa3, 0x30, 0x75, 0x2c, 0x20, 0x31, 0x75, 0x2c, 0x20,
+            0x32, 0x75, 0x94, 0x02, 0x33, 0x69, 0x66, 0x28, 0x99, 0x0a, 0x11, 0x29, 0x4f, 0x00, 0x00, 0x7d,
+            0x00, 0x00, 0xd5, 0x05, 0x09, 0x4d, 0x00, 0x07, 0xd5, 0x00, 0x05, 0x9d, 0x08, 0x04, 0x25, 0x00,
+            0x2a, 0x2e, 0x78, 0x72, 0x05, 0x0e, 0x21, 0x00, 0x1f, 0x79, 0x21, 0x00, 0x0d, 0x10, 0x7a, 0x98,
+            0x05, 0x01, 0x7e, 0x00, 0x01, 0xa0, 0x0a, 0x00, 0xee, 0x06, 0x10, 0x4d, 0xb4, 0x0a, 0x00, 0xb2,
+            0x02, 0x53, 0x69, 0x65, 0x77, 0x20, 0x2a, 0x22, 0x01, 0x00, 0x14, 0x00, 0x02, 0x42, 0x01, 0x03,
+            0x7e, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x5a, 0x07, 0x01, 0x1b, 0x15, 0x12, 0x73, 0x51, 0x04, 0x02,
+            0x21, 0x00, 0x40, 0x66, 0x6f, 0x72, 0x28, 0x70, 0x10, 0x00, 0x80, 0x06, 0xd2, 0x30, 0x3b, 0x20,
+            0x69, 0x20, 0x3c, 0x20, 0x33, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0xe6, 0x00, 0x02, 0x9d, 0x1c, 0x01,
+            0xec, 0x00, 0x44, 0x69, 0x65, 0x77, 0x5f, 0xe8, 0x04, 0x00, 0xd8, 0x05, 0x03, 0x75, 0x00, 0x02,
+            0x81, 0x00, 0x10, 0x2a, 0xb4, 0x04, 0x21, 0x34, 0x28, 0x9c, 0x02, 0x01, 0xf5, 0x06, 0x04, 0xf6,
+            0x00, 0x01, 0x84, 0x06, 0x03, 0x62, 0x1b, 0x63, 0x29, 0x2c, 0x20, 0x31, 0x2e, 0x66, 0x50, 0x01,
+            0x00, 0x54, 0x00, 0x01, 0xe3, 0x04, 0x47, 0x69, 0x5d, 0x20, 0x3d, 0xd4, 0x1c, 0x22, 0x20, 0x2a,
+            0x59, 0x15, 0x08, 0x6b, 0x00, 0x02, 0xab, 0x00, 0x11, 0x7d, 0xfa, 0x00, 0x00, 0xe8, 0x02, 0x02,
+            0xab, 0x0e, 0x44, 0x20, 0x3d, 0x20, 0x32, 0x2f, 0x05, 0x21, 0x32, 0x28, 0xe7, 0x0e, 0x01, 0x00,
+            0x1d, 0x03, 0x61, 0x00, 0x01, 0x29, 0x00, 0x6b, 0x6e, 0x64, 0x63, 0x20, 0x3d, 0x20, 0x17, 0x03,
+            0x23, 0x20, 0x2a, 0x41, 0x00, 0x10, 0x2d, 0x90, 0x00, 0x02, 0x5d, 0x00, 0x01, 0x01, 0x04, 0x3a,
+            0x62, 0x20, 0x3d, 0xbd, 0x05, 0x00, 0xa1, 0x00, 0x10, 0x2c, 0xd9, 0x04, 0x06, 0x54, 0x00, 0x6f,
+            0x33, 0x20, 0x62, 0x5f, 0x64, 0x78, 0x29, 0x00, 0x06, 0x20, 0x20, 0x2b, 0x0a, 0x01, 0x21, 0x32,
+            0x28, 0x18, 0x0e, 0x90, 0x2e, 0x78, 0x2c, 0x20, 0x30, 0x2e, 0x66, 0x29, 0x29, 0x43, 0x04, 0x08,
+            0x68, 0x00, 0x3f, 0x5f, 0x64, 0x79, 0x42, 0x00, 0x0e, 0x42, 0x30, 0x2e, 0x66, 0x2c, 0xa8, 0x00,
+            0x24, 0x2e, 0x79, 0x42, 0x00, 0x01, 0x02, 0x01, 0x01, 0xde, 0x02, 0x04, 0xd2, 0x01, 0x03, 0x86,
+            0x01, 0x06, 0x9a, 0x01, 0x24, 0x20, 0x2a, 0x6b, 0x00, 0x01, 0x28, 0x00, 0x20, 0x70, 0x6f, 0xd0,
+            0x04, 0x09, 0x5f, 0x01, 0x01, 0x18, 0x00, 0x04, 0x40, 0x00, 0x07, 0x2b, 0x00, 0x04, 0x13, 0x00,
+            0x02, 0xdf, 0x00, 0x00, 0x11, 0x01, 0x14, 0x28, 0x13, 0x00, 0x02, 0x38, 0x02, 0x00, 0x5b, 0x00,
+            0x25, 0x5f, 0x64, 0xa5, 0x05, 0x00, 0x9d, 0x03, 0x04, 0x21, 0x00, 0x02, 0xd1, 0x00, 0x0f, 0x34,
+            0x00, 0x06, 0x23, 0x79, 0x29, 0x85, 0x03, 0x01, 0x7c, 0x00, 0x01, 0xc5, 0x09, 0x00, 0xb9, 0x00,
+            0x30, 0x65, 0x63, 0x34, 0x66, 0x05, 0x03, 0x5d, 0x01, 0x23, 0x69, 0x66, 0x7e, 0x1b, 0x03, 0xfd,
+            0x1a, 0x02, 0x82, 0x02, 0x00, 0x28, 0x02, 0x09, 0x36, 0x00, 0x02, 0xd3, 0x02, 0x08, 0x01, 0x05,
+            0x01, 0x50, 0x00, 0x24, 0x73, 0x5b, 0x73, 0x02, 0x0c, 0x69, 0x03, 0x0c, 0x1f, 0x00, 0x0b, 0x67,
+            0x03, 0x0c, 0x1f, 0x00, 0x20, 0x7a, 0x5d, 0xe4, 0x05, 0x08, 0x44, 0x01, 0x22, 0x75, 0x76, 0xad,
+            0x00, 0x20, 0x32, 0x28, 0xcd, 0x01, 0x07, 0x32, 0x01, 0x00, 0xf1, 0x09, 0x00, 0x0b, 0x02, 0x01,
+            0xa0, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x78, 0x02, 0x07, 0x29, 0x00, 0x36, 0x69,
+            0x66, 0x28, 0x3d, 0x1c, 0x02, 0xd3, 0x00, 0x06, 0x55, 0x03, 0x01, 0xcc, 0x00, 0x40, 0x32, 0x20,
+            0x75, 0x76, 0xa5, 0x01, 0x02, 0x0d, 0x00, 0x08, 0xd9, 0x00, 0x00, 0x1e, 0x0c, 0x0f, 0xd6, 0x00,
+            0x05, 0x09, 0x1c, 0x00, 0x0b, 0xd3, 0x00, 0x09, 0x1c, 0x00, 0x01, 0x35, 0x04, 0x00, 0x46, 0x01,
+            0x00, 0x04, 0x00, 0x03, 0xaa, 0x00, 0x01, 0xfe, 0x04, 0x01, 0xd0, 0x01, 0x02, 0xce, 0x00, 0x07,
+            0x1b, 0x00, 0x02, 0xfe, 0x01, 0x00, 0x92, 0x00, 0x11, 0x2a, 0xea, 0x02, 0x0f, 0x21, 0x00, 0x00,
+            0x00, 0xe6, 0x00, 0x05, 0x21, 0x00, 0x12, 0x79, 0x21, 0x00, 0x02, 0x9d, 0x03, 0x33, 0x69, 0x66,
+            0x28, 0xa7, 0x0a, 0x09, 0xc4, 0x01, 0x0a, 0xf1, 0x00, 0x12, 0x20, 0x88, 0x0a, 0x00, 0xd9, 0x05,
+            0x20, 0x72, 0x69, 0x3f, 0x01, 0x00, 0xf9, 0x00, 0x11, 0x28, 0x1d, 0x12, 0x51, 0x70, 0x6f, 0x73,
+            0x65, 0x28, 0xe6, 0x05, 0x04, 0x39, 0x08, 0x01, 0x7c, 0x0f, 0x07, 0xb3, 0x07, 0x00, 0x71, 0x02,
+            0x13, 0x29, 0x31, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x3c, 0x00, 0x03, 0x51, 0x00, 0x34, 0x73, 0x2c,
+            0x20, 0x42, 0x0a, 0x00, 0x41, 0x0f, 0x04, 0x0c, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x2c, 0x00, 0x0f,
+            0xec, 0x04, 0x0c, 0x00, 0x23, 0x00, 0x06, 0xaa, 0x00, 0x00, 0x0e, 0x00, 0x02, 0xa9, 0x00, 0x03,
+            0xed, 0x04, 0x02, 0x0d, 0x00, 0x04, 0xb6, 0x00, 0x17, 0x2a, 0xe1, 0x0b, 0x04, 0xa3, 0x01, 0x01,
+            0xec, 0x04, 0x03, 0x00, 0x01, 0x00, 0xa7, 0x0b, 0x06, 0x7a, 0x00, 0x00, 0x4d, 0x00, 0x34, 0x69,
+            0x66, 0x28, 0x42, 0x0b, 0x09, 0x1d, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x7b, 0x00,
+            0x00, 0x12, 0x00, 0x04, 0xc2, 0x00, 0x02, 0x23, 0x05, 0x00, 0xea, 0x00, 0x01, 0x91, 0x03, 0x01,
+            0x72, 0x05, 0x00, 0xa4, 0x02, 0x0f, 0x6e, 0x05, 0x04, 0x04, 0x66, 0x00, 0x0e, 0x83, 0x00, 0x00,
+            0x55, 0x00, 0x05, 0xef, 0x0c, 0x03, 0xd7, 0x00, 0x62, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0xdd,
+            0x00, 0x00, 0x13, 0x00, 0x06, 0x45, 0x01, 0x20, 0x5b, 0x69, 0x6f, 0x06, 0x00, 0x34, 0x00, 0x04,
+            0x04, 0x00, 0x02, 0xe5, 0x01, 0x00, 0x0e, 0x00, 0x06, 0x0a, 0x00, 0x01, 0x52, 0x02, 0x00, 0x96,
+            0x01, 0x03, 0x76, 0x0c, 0x00, 0x09, 0x0a, 0x02, 0x93, 0x0e, 0x0a, 0x5f, 0x02, 0x0f, 0xff, 0x00,
+            0x09, 0x0a, 0xfb, 0x00, 0x06, 0x52, 0x00, 0x03, 0x01, 0x01, 0x25, 0x20, 0x3d, 0xd9, 0x01, 0x0a,
+            0x54, 0x00, 0x00, 0x8a, 0x00, 0x06, 0x2e, 0x00, 0x05, 0xda, 0x00, 0x20, 0x20, 0x3d, 0x73, 0x22,
+            0x03, 0x93, 0x0e, 0x0a, 0x32, 0x00, 0x02, 0xb8, 0x00, 0xd0, 0x7d, 0x0a, 0x7d, 0x0a, 0x23, 0x65,
+            0x6c, 0x73, 0x65, 0x0a, 0x66, 0x6c, 0x61, 0xec, 0x1a, 0x02, 0x97, 0x0d, 0x01, 0x4b, 0x00, 0x04,
+            0x37, 0x08, 0x0f, 0xb1, 0x0e, 0x04, 0x0f, 0x68, 0x08, 0x0b, 0x20, 0x69, 0x6e, 0xfe, 0x05, 0x1a,
+            0x34, 0x32, 0x0e, 0x1a, 0x3b, 0x17, 0x00, 0x01, 0xd2, 0x0e, 0x09, 0x12, 0x00, 0x01, 0x82, 0x04,
+            0x04, 0x26, 0x00, 0x05, 0x58, 0x0e, 0x04, 0x11, 0x00, 0x0f, 0xdb, 0x0e, 0x01, 0x02, 0x3f, 0x00,
+            0x08, 0x1a, 0x00, 0x03, 0x2b, 0x01, 0x0f, 0x35, 0x00, 0x01, 0x05, 0x18, 0x01, 0x14, 0x3b, 0x3e,
+            0x23, 0x01, 0xf2, 0x15, 0x03, 0x4e, 0x18, 0x01, 0x24, 0x23, 0x12, 0x69, 0xed, 0x15, 0x02, 0x07,
+            0x19, 0x05, 0xf3, 0x1d, 0x04, 0x07, 0x19, 0x04, 0xf9, 0x0c, 0x04, 0x1b, 0x01, 0x02, 0x2d, 0x00,
+            0x04, 0x80, 0x18, 0x31, 0x69, 0x73, 0x20, 0x3b, 0x18, 0x00, 0xc1, 0x15, 0x01, 0xe7, 0x15, 0x40,
+            0x6d, 0x61, 0x70, 0x73, 0x47, 0x17, 0x00, 0x1a, 0x19, 0x00, 0x3b, 0x00, 0x21, 0x69, 0x74, 0x20,
+            0x16, 0x10, 0x6e, 0x51, 0x18, 0x12, 0x20, 0x95, 0x14, 0x30, 0x64, 0x2e, 0x20, 0x02, 0x1f, 0x00,
+            0x3e, 0x0a, 0x34, 0x69, 0x64, 0x65, 0x22, 0x00, 0x91, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x63,
+            0x68, 0x65, 0xc5, 0x1a, 0x08, 0x21, 0x15, 0x04, 0x7a, 0x00, 0x01, 0x60, 0x00, 0x02, 0x84, 0x24,
+            0x50, 0x69, 0x73, 0x20, 0x77, 0x68, 0xe2, 0x24, 0x10, 0x65, 0xce, 0x24, 0x00, 0x41, 0x08, 0x42,
+            0x67, 0x72, 0x61, 0x6d, 0x47, 0x16, 0x30, 0x61, 0x6c, 0x6c, 0x02, 0x02, 0x20, 0x73, 0x20, 0xca,
+            0x1c, 0x00, 0xae, 0x14, 0x45, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x0a, 0x10, 0x2e, 0x75, 0x17, 0x01,
+            0x70, 0x24, 0x04, 0x52, 0x19, 0x00, 0x04, 0x01, 0x05, 0x71, 0x24, 0x08, 0x15, 0x00, 0x0f, 0x72,
+            0x24, 0x00, 0x00, 0xd0, 0x1a, 0x03, 0xc0, 0x03, 0x41, 0x28, 0x6d, 0x61, 0x70, 0x6f, 0x24, 0x19,
+            0x28, 0x34, 0x00, 0x16, 0x26, 0x6a, 0x00, 0x02, 0x51, 0x01, 0x0d, 0x58, 0x1a, 0x40, 0x29, 0x20,
+            0x3e, 0x3e, 0x6b, 0x19, 0x0c, 0x95, 0x24, 0x26, 0x2f, 0x2f, 0x96, 0x16, 0x00, 0x1e, 0x25, 0x01,
+            0x45, 0x08, 0x0c, 0x58, 0x14, 0x41, 0x20, 0x6d, 0x61, 0x79, 0x87, 0x18, 0x20, 0x6e, 0x67, 0xef,
+            0x14, 0x55, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x7c, 0x0b, 0x00, 0x39, 0x1f, 0x10, 0x6f, 0x50, 0x01,
+            0x00, 0xf5, 0x18, 0xf0, 0x03, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20,
+            0x75, 0x76, 0x20, 0x67, 0x72, 0x61, 0x64, 0xee, 0x21, 0x11, 0x73, 0x45, 0x01, 0x01, 0x13, 0x21,
+            0x01, 0xc2, 0x19, 0x24, 0x32, 0x5e, 0x25, 0x26, 0x00, 0x4f, 0x00, 0x51, 0x6d, 0x61, 0x74, 0x63,
+            0x68, 0x68, 0x15, 0x00, 0x16, 0x21, 0x00, 0xbf, 0x01, 0x00, 0xf3, 0x0e, 0xc0, 0x66, 0x6f, 0x72,
+            0x77, 0x61, 0x72, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3e, 0x01, 0x0f, 0xb3, 0x18, 0x04, 0x04,
+            0x96, 0x25, 0xa2, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x32, 0x44, 0x28, 0xef, 0x01, 0x40,
+            0x72, 0x2c, 0x20, 0x63, 0x93, 0x0c, 0x14, 0x29, 0x5b, 0x02, 0x4b, 0x47, 0x72, 0x61, 0x64, 0x1c,
+            0x00, 0x03, 0x67, 0x11, 0x00, 0x46, 0x07, 0x01, 0x1c, 0x0e, 0x44, 0x78, 0x70, 0x32, 0x28, 0x99,
+            0x00, 0x17, 0x29, 0x1d, 0x00, 0x01, 0x2b, 0x0e, 0x09, 0x1d, 0x00, 0x13, 0x29, 0xcc, 0x03, 0x0f,
+            0x7e, 0x00, 0x16, 0x0d, 0x7a, 0x00, 0x05, 0x68, 0x00, 0x04, 0x21, 0x03, 0x0f, 0x13, 0x28, 0x03,
+            0x02, 0xf7, 0x26, 0x04, 0xde, 0x00, 0x30, 0x4d, 0x41, 0x50, 0x01, 0x02, 0x54, 0x2c, 0x20, 0x75,
+            0x76, 0x29, 0x14, 0x00, 0x06, 0xf2, 0x00, 0x20, 0x32, 0x44, 0xfa, 0x0f, 0x01, 0xfb, 0x12, 0x18,
+            0x2e, 0x93, 0x1b, 0x51, 0x6d, 0x61, 0x70, 0x5d, 0x29, 0x34, 0x00, 0x00, 0xb6, 0x00, 0x23, 0x69,
+            0x66, 0x4c, 0x27, 0x20, 0x64, 0x28, 0x35, 0x1d, 0x14, 0x5f, 0x48, 0x02, 0x01, 0xe3, 0x1b, 0x14,
+            0x29, 0x15, 0x16, 0x06, 0xdf, 0x17, 0x07, 0x48, 0x28, 0x03, 0x5a, 0x01, 0x03, 0x97, 0x1d, 0x00,
+            0x4e, 0x02, 0x13, 0x5f, 0x13, 0x00, 0x24, 0x73, 0x5b, 0xc5, 0x1d, 0x02, 0xd2, 0x1f, 0x04, 0xc2,
+            0x21, 0x20, 0x75, 0x6e, 0x0e, 0x02, 0x10, 0x30, 0xe6, 0x01, 0x04, 0x21, 0x00, 0x25, 0x2d, 0x31,
+            0xf7, 0x02, 0x0f, 0xd6, 0x00, 0x0b, 0x00, 0xc3, 0x00, 0x05, 0x5f, 0x00, 0x00, 0xc4, 0x00, 0x01,
+            0xcc, 0x10, 0x56, 0x33, 0x28, 0x75, 0x76, 0x2c, 0xee, 0x02, 0x00, 0x25, 0x00, 0x03, 0xb4, 0x1c,
+            0x00, 0x23, 0x00, 0x05, 0x99, 0x01, 0x03, 0x99, 0x15, 0x0f, 0xc7, 0x00, 0x0b, 0x0f, 0xc2, 0x00,
+            0x60, 0x20, 0x75, 0x76, 0xa2, 0x00, 0x02, 0xbb, 0x29, 0x04, 0x3d, 0x02, 0x06, 0x2e, 0x20, 0x05,
+            0xf1, 0x25, 0x08, 0xf2, 0x03, 0x06, 0x1f, 0x00, 0x15, 0x29, 0x3a, 0x01, 0x09, 0x37, 0x20, 0x0f,
+            0x36, 0x00, 0x02, 0x09, 0x22, 0x00, 0x06, 0x39, 0x00, 0x08, 0x45, 0x20, 0x0f, 0x38, 0x00, 0x02,
+            0x08, 0x21, 0x00, 0x06, 0x37, 0x00, 0x03, 0x62, 0x08, 0x07, 0x97, 0x00, 0x17, 0x20, 0x0c, 0x00,
+            0x04, 0x81, 0x09, 0x09, 0x33, 0x00, 0x0f, 0x55, 0x20, 0x02, 0x0f, 0x73, 0x00, 0x02, 0x0f, 0x2a,
+            0x00, 0x02, 0x06, 0x49, 0x00, 0x03, 0x3d, 0x20, 0x0f, 0x3b, 0x00, 0x02, 0x03, 0x1c, 0x00, 0x72,
+            0x29, 0x0a, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x09, 0x07, 0x32, 0x6f, 0x75, 0x74, 0x43, 0x17, 0x11,
+            0x3b, 0x63, 0x13, 0x12, 0x31, 0xc1, 0x25, 0x30, 0x6c, 0x69, 0x74, 0x7f, 0x1e, 0x01, 0xcd, 0x25,
+            0x51, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0xd0, 0x1c, 0x42, 0x6f, 0x77, 0x65, 0x64, 0xe9, 0x03, 0x01,
+            0xf5, 0x17, 0x00, 0x3f, 0x1b, 0x11, 0x74, 0x8a, 0x04, 0x44, 0x6c, 0x61, 0x73, 0x74, 0x40, 0x24,
+            0x01, 0x4b, 0x06, 0x42, 0x6c, 0x69, 0x74, 0x0a, 0xeb, 0x11, 0x05, 0x6b, 0x26, 0x20, 0x61, 0x6c,
+            0x7c, 0x20, 0x30, 0x6f, 0x77, 0x28, 0x84, 0x0c, 0x05, 0x42, 0x0e, 0x04, 0x49, 0x11, 0x02, 0x2d,
+            0x00, 0x01, 0x57, 0x1b, 0x41, 0x20, 0x3d, 0x20, 0x2d, 0xaf, 0x08, 0x52, 0x70, 0x6f, 0x73, 0x2e,
+            0x7a, 0xa3, 0x09, 0x01, 0x0f, 0x11, 0x03, 0xa1, 0x24, 0x00, 0x50, 0x22, 0x03, 0x7f, 0x15, 0x64,
+            0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x18, 0x00, 0x13, 0x3c, 0xa5, 0x00, 0x05, 0xf4, 0x24, 0x01,
+            0x01, 0x23, 0x33, 0x20, 0x26, 0x26, 0xd6, 0x1b, 0x1c, 0x3e, 0x20, 0x00, 0x02, 0x14, 0x25, 0x13,
+            0x5b, 0x40, 0x00, 0x12, 0x5d, 0xfc, 0x0b, 0x00, 0xb3, 0x08, 0x03, 0x12, 0x00, 0x22, 0x2b, 0x2b,
+            0x7e, 0x00, 0x25, 0x69, 0x66, 0x64, 0x00, 0x2c, 0x3e, 0x3d, 0x45, 0x00, 0x01, 0x65, 0x00, 0x06,
+            0x3b, 0x00, 0x03, 0x6c, 0x12, 0x32, 0x31, 0x2e, 0x66, 0x3c, 0x00, 0x01, 0xee, 0x00, 0x03, 0xe5,
+            0x25, 0x02, 0xeb, 0x0d, 0x13, 0x28, 0x0e, 0x00, 0x05, 0xf3, 0x25, 0x03, 0x6e, 0x00, 0x10, 0x5d,
+            0x59, 0x0f, 0x00, 0x71, 0x0d, 0x04, 0xfd, 0x00, 0x02, 0x8d, 0x0f, 0x43, 0x29, 0x2e, 0x78, 0x79,
+            0x06, 0x01, 0x03, 0x5c, 0x00, 0x03, 0x2f, 0x04, 0x06, 0x48, 0x00, 0x02, 0xb8, 0x14, 0x14, 0x34,
+            0x11, 0x00, 0x00, 0x38, 0x01, 0x34, 0x78, 0x79, 0x2c, 0x91, 0x01, 0x14, 0x2c, 0xb2, 0x00, 0x00,
+            0x18, 0x00, 0x10, 0x7a, 0x9b, 0x0b, 0x02, 0x4e, 0x15, 0xf1, 0x01, 0x74, 0x65, 0x6d, 0x70, 0x6f,
+            0x72, 0x61, 0x72, 0x79, 0x20, 0x70, 0x68, 0x6f, 0x6e, 0x67, 0x2d, 0x4f, 0x1d, 0x01, 0x43, 0x25,
+            0x62, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x4c, 0x55, 0x25, 0x40, 0x73, 0x20, 0x74, 0x6f, 0x5a, 0x06,
+            0x02, 0x53, 0x08, 0x01, 0x1f, 0x00, 0x02, 0x17, 0x13, 0x22, 0x41, 0x64, 0xf5, 0x25, 0x02, 0xd0,
+            0x01, 0x12, 0x4c, 0x6f, 0x04, 0x10, 0x20, 0xc3, 0x06, 0x00, 0x6e, 0x12, 0x03, 0x0f, 0x00, 0x13,
+            0x4e, 0x08, 0x00, 0x23, 0x56, 0x2c, 0xe2, 0x01, 0x05, 0x2f, 0x22, 0x04, 0x11, 0x00, 0x04, 0x27,
+            0x22, 0x00, 0xb4, 0x20, 0x03, 0x95, 0x02, 0x11, 0x33, 0x34, 0x1e, 0x39, 0x75, 0x73, 0x65, 0x14,
+            0x00, 0x00, 0x77, 0x1e, 0x4b, 0x75, 0x6c, 0x61, 0x72, 0x32, 0x02, 0x11, 0x46, 0x04, 0x15, 0xc0,
+            0x61, 0x6d, 0x70, 0x28, 0x64, 0x6f, 0x74, 0x28, 0x4e, 0x2c, 0x20, 0x4c, 0x54, 0x13, 0x00, 0x9a,
+            0x0f, 0x06, 0xca, 0x10, 0x03, 0x4f, 0x00, 0x85, 0x20, 0x2b, 0x3d, 0x20, 0x64, 0x46, 0x20, 0x2a,
+            0xa5, 0x00, 0x00, 0x0b, 0x00, 0x04, 0xbf, 0x22, 0x07, 0xae, 0x01, 0xa5, 0x68, 0x61, 0x6c, 0x66,
+            0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2b, 0x0b, 0x93, 0x69, 0x7a, 0x65, 0x28, 0x56, 0x20, 0x2b,
+            0x20, 0x4c, 0xd9, 0x0c, 0x02, 0xcd, 0x00, 0x10, 0x73, 0x7d, 0x00, 0x49, 0x70, 0x6f, 0x77, 0x28,
+            0x81, 0x00, 0x06, 0x3f, 0x00, 0x08, 0x8a, 0x00, 0x95, 0x2c, 0x20, 0x32, 0x35, 0x36, 0x2e, 0x66,
+            0x20, 0x2a, 0xf2, 0x00, 0x03, 0x4b, 0x00, 0x04, 0xd8, 0x00, 0x00, 0x9e, 0x00, 0x1b, 0x73, 0x9e,
+            0x00, 0x40, 0x28, 0x31, 0x2e, 0x30, 0xe3, 0x14, 0x05, 0x36, 0x01, 0x07, 0x97, 0x14, 0x41, 0x6d,
+            0x61, 0x69, 0x6e, 0x88, 0x14, 0x03, 0x0b, 0x07, 0x0f, 0xa1, 0x20, 0x00, 0x00, 0xcb, 0x02, 0x0f,
+            0xbe, 0x14, 0x02, 0x07, 0xed, 0x00, 0x04, 0x6d, 0x02, 0x02, 0x56, 0x0e, 0x01, 0x61, 0x0b, 0x07,
+            0x13, 0x00, 0x0f, 0x29, 0x00, 0x02, 0x00, 0x5e, 0x0e, 0x0b, 0x29, 0x00, 0x03, 0x64, 0x0e, 0x00,
+            0x5a, 0x0f, 0x12, 0x20, 0x21, 0x08, 0x12, 0x3d, 0x63, 0x0b, 0x01, 0x0d, 0x00, 0x05, 0x46, 0x00,
+            0x00, 0x49, 0x0f, 0x02, 0x89, 0x10, 0x01, 0x40, 0x00, 0x00, 0x1d, 0x00, 0x10, 0x79, 0xf4, 0x0a,
+            0x00, 0xe9, 0x0b, 0x00, 0xad, 0x00, 0x01, 0x2d, 0x03, 0x07, 0x7f, 0x00, 0x00, 0x52, 0x14, 0x31,
+            0x46, 0x64, 0x78, 0x63, 0x02, 0x11, 0x28, 0x33, 0x00, 0x04, 0x1d, 0x00, 0x00, 0xc7, 0x02, 0x0f,
+            0x32, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x09, 0x20, 0x0f, 0x32, 0x00, 0x0b, 0x02, 0x87, 0x00,
+            0x00, 0xd9, 0x0e, 0x00, 0x3e, 0x20, 0x02, 0x59, 0x00, 0x23, 0x75, 0x76, 0x90, 0x01, 0x05, 0xc4,
+            0x00, 0x05, 0x4c, 0x00, 0x01, 0x79, 0x00, 0x01, 0x20, 0x00, 0x03, 0x47, 0x30, 0x03, 0x79, 0x00,
+            0x21, 0x34, 0x20, 0x18, 0x0c, 0x04, 0xeb, 0x00, 0x01, 0x0d, 0x00, 0x05, 0xeb, 0x00, 0x03, 0x7e,
+            0x28, 0x02, 0xb7, 0x0d, 0x00, 0xe5, 0x19, 0x06, 0x03, 0x0c, 0x03, 0x0e, 0x00, 0x05, 0xf6, 0x0b,
+            0x73, 0x2c, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x9f, 0x0d, 0x03, 0x88, 0x11, 0x0f, 0xa9, 0x0f,
+            0x0e, 0x01, 0x0a, 0x01, 0x02, 0x5f, 0x00, 0x09, 0xa7, 0x02, 0x01, 0xae, 0x00, 0x07, 0x1d, 0x00,
+            0x03, 0xd7, 0x00, 0x02, 0x58, 0x0d, 0x01, 0x53, 0x0d, 0x00, 0xbf, 0x00, 0x00, 0x04, 0x00, 0x07,
+            0x25, 0x00, 0x09, 0x42, 0x00, 0x02, 0x71, 0x0e, 0x01, 0x1e, 0x00, 0x01, 0x4f, 0x1b, 0x13, 0x78,
+            0xb1, 0x00, 0x01, 0x0d, 0x00, 0x10, 0x79, 0x7a, 0x01, 0x01, 0xe6, 0x12, 0x0e, 0x30, 0x0e, 0x00,
+            0x6b, 0x05, 0x03, 0xfc, 0x06, 0x03, 0x81, 0x0b, 0x02, 0x18, 0x05, 0x06, 0x3e, 0x0e, 0x01, 0x55,
+            0x00, 0x03, 0x07, 0x01, 0x09, 0x74, 0x00, 0x06, 0xb6, 0x00, 0x03, 0x1e, 0x00, 0x03, 0xb7, 0x00,
+            0x05, 0xa8, 0x00, 0x05, 0x2e, 0x01, 0x0f, 0x37, 0x00, 0x04, 0x05, 0x20, 0x00, 0x03, 0x39, 0x00,
+            0x0b, 0xf0, 0x00, 0x0f, 0x83, 0x00, 0x10, 0x0c, 0xf7, 0x00, 0x13, 0x79, 0xf7, 0x00, 0x02, 0x64,
+            0x01, 0x00, 0xcf, 0x0f, 0x00, 0xb0, 0x02, 0x11, 0x78, 0x34, 0x18, 0x07, 0x2c, 0x00, 0x02, 0x1f,
+            0x00, 0x03, 0x2c, 0x00, 0x01, 0x23, 0x01, 0x01, 0xc2, 0x18, 0x00, 0x2c, 0x00, 0x24, 0x79, 0x2e,
+            0x8b, 0x13, 0x0f, 0xc7, 0x00, 0x02, 0x0f, 0x45, 0x00, 0x05, 0x0a, 0x02, 0x01, 0x02, 0xc9, 0x00,
+            0x00, 0x5c, 0x10, 0x42, 0x20, 0x54, 0x42, 0x4e, 0xde, 0x0e, 0x02, 0x67, 0x10, 0x0f, 0x50, 0x02,
+            0x07, 0x01, 0x67, 0x01, 0x02, 0x99, 0x00, 0x03, 0x0f, 0x01, 0x06, 0x4f, 0x02, 0x07, 0x8a, 0x08,
+            0x0d, 0x9e, 0x01, 0x00, 0x73, 0x2e, 0x02, 0x37, 0x00, 0x10, 0x5f, 0x2b, 0x0a, 0x02, 0x50, 0x0a,
+            0x24, 0x20, 0x3d, 0x3d, 0x0b, 0x00, 0x51, 0x0b, 0x03, 0xe0, 0x01, 0x32, 0x4d, 0x41, 0x50, 0x0a,
+            0x08, 0x37, 0x5f, 0x75, 0x76, 0xa2, 0x06, 0x00, 0xe8, 0x00, 0x0f, 0x41, 0x00, 0x01, 0x0e, 0x14,
+            0x00, 0x11, 0x2a, 0x1b, 0x16, 0x07, 0xe0, 0x15, 0x00, 0x3b, 0x00, 0x08, 0x08, 0x03, 0x09, 0xe8,
+            0x01, 0x02, 0x40, 0x00, 0x00, 0x86, 0x05, 0x00, 0x04, 0x01, 0x13, 0x2a, 0x50, 0x12, 0x07, 0xa5,
+            0x00, 0x00, 0x9f, 0x01, 0x04, 0x84, 0x0e, 0x12, 0x2e, 0x2e, 0x00, 0x00, 0x42, 0x28, 0x00, 0xed,
+            0x15, 0x00, 0x17, 0x17, 0x02, 0x12, 0x00, 0x32, 0x20, 0x2a, 0x20, 0xaa, 0x05, 0x02, 0x39, 0x1a,
+            0x0f, 0x30, 0x00, 0x00, 0x01, 0x0e, 0x16, 0x03, 0x78, 0x07, 0x02, 0xcb, 0x03, 0x02, 0x7f, 0x01,
+            0x09, 0x38, 0x03, 0x0b, 0xa6, 0x00, 0x07, 0x6d, 0x01, 0x06, 0xbc, 0x03, 0x0f, 0x52, 0x14, 0x07,
+            0x27, 0x69, 0x66, 0xa4, 0x0a, 0x04, 0xa7, 0x09, 0x02, 0x8a, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04,
+            0x00, 0x01, 0x4a, 0x04, 0x29, 0x20, 0x2a, 0x78, 0x01, 0x06, 0x34, 0x00, 0x06, 0x78, 0x01, 0x08,
+            0xa2, 0x00, 0x05, 0x34, 0x00, 0x05, 0xd6, 0x00, 0x01, 0x12, 0x00, 0x00, 0x05, 0x01, 0x02, 0x27,
+            0x00, 0x02, 0xb3, 0x06, 0x05, 0x4a, 0x06, 0x02, 0x49, 0x02, 0x02, 0xff, 0x0c, 0x05, 0x15, 0x00,
+            0x0c, 0x2e, 0x00, 0x04, 0xab, 0x06, 0x08, 0x2d, 0x00, 0x04, 0x14, 0x00, 0x0c, 0x2c, 0x00, 0x03,
+            0xab, 0x30, 0x06, 0xd8, 0x29, 0x08, 0x35, 0x00, 0x0d, 0x1d, 0x00, 0x06, 0x3e, 0x00, 0x24, 0x69,
+            0x66, 0x98, 0x0a, 0x05, 0x0d, 0x01, 0x00, 0x96, 0x29, 0x03, 0x29, 0x2b, 0x00, 0xe1, 0x2e, 0x63,
+            0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0xef, 0x26, 0xd3, 0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74,
+            0x65, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x4d, 0x10, 0x63, 0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0xe1,
+            0x26, 0x01, 0x9c, 0x04, 0x07, 0xef, 0x03, 0x00, 0xd4, 0x02, 0x00, 0xd7, 0x35, 0x09, 0x4e, 0x01,
+            0x03, 0x72, 0x00, 0x06, 0x4b, 0x01, 0x33, 0x2e, 0x72, 0x67, 0x51, 0x16, 0x00, 0x81, 0x01, 0x0d,
+            0xaf, 0x00, 0x00, 0x8d, 0x01, 0x43, 0x6f, 0x72, 0x6d, 0x2e, 0x60, 0x31, 0x00, 0x24, 0x00, 0x05,
+            0x35, 0x01, 0x04, 0x1c, 0x00, 0x12, 0x67, 0x68, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x24, 0x01, 0x04,
+            0x1b, 0x00, 0x03, 0x5b, 0x00, 0x0b, 0x4c, 0x02, 0x06, 0xa5, 0x00, 0x2a, 0x69, 0x66, 0x82, 0x0c,
+            0x05, 0x0a, 0x01, 0x01, 0xcd, 0x00, 0x00, 0x52, 0x00, 0x06, 0x2c, 0x00, 0x00, 0x0e, 0x00, 0x09,
+            0x7c, 0x00, 0x07, 0x18, 0x0e, 0x09, 0x45, 0x00, 0x08, 0xdd, 0x00, 0x06, 0x9b, 0x00, 0x02, 0x84,
+            0x00, 0x00, 0x45, 0x00, 0x29, 0x69, 0x66, 0xbf, 0x0c, 0x0f, 0x74, 0x00, 0x0d, 0x08, 0xd4, 0x00,
+            0x07, 0x73, 0x00, 0x08, 0x43, 0x00, 0x0f, 0x72, 0x00, 0x10, 0x0f, 0xbe, 0x0c, 0x02, 0x0f, 0x7b,
+            0x00, 0x0d, 0x0f, 0x8f, 0x01, 0x02, 0x07, 0x84, 0x00, 0x0f, 0x55, 0x00, 0x02, 0x0f, 0x8d, 0x00,
+            0x09, 0x12, 0x7d, 0x71, 0x1c, 0x01, 0x6f, 0x08, 0x10, 0x56, 0x70, 0x0c, 0x02, 0x20, 0x04, 0x00,
+            0x60, 0x04, 0x00, 0x14, 0x00, 0x02, 0x12, 0x08, 0x01, 0xd8, 0x03, 0x30, 0x70, 0x6f, 0x73, 0xf1,
+            0x06, 0x00, 0x30, 0x01, 0x00, 0x1a, 0x00, 0x32, 0x20, 0x64, 0x4c, 0x6a, 0x18, 0x17, 0x33, 0x41,
+            0x18, 0x01, 0x19, 0x00, 0x1f, 0x73, 0x19, 0x00, 0x00, 0x02, 0x73, 0x03, 0x02, 0xef, 0x0b, 0x1f,
+            0x20, 0x39, 0x0c, 0x03, 0x8f, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x20, 0x3f, 0x28, 0x0d, 0x04,
+            0x0c, 0x8a, 0x00, 0x26, 0x20, 0x3a, 0x11, 0x1b, 0x06, 0x81, 0x0b, 0x00, 0xe2, 0x04, 0x01, 0x9a,
+            0x0b, 0x05, 0x45, 0x00, 0x03, 0x03, 0x30, 0x01, 0x39, 0x25, 0x23, 0x20, 0x2a, 0x01, 0x0c, 0x0a,
+            0x68, 0x08, 0x40, 0x2c, 0x20, 0x56, 0x2c, 0x98, 0x27, 0x04, 0xa3, 0x2e, 0x04, 0xe0, 0x01, 0x74,
+            0x2c, 0x20, 0x64, 0x4c, 0x2c, 0x20, 0x73, 0xea, 0x0a, 0x00, 0xfc, 0x0c, 0x02, 0xe5, 0x31, 0x01,
+            0x08, 0x34, 0x22, 0x2e, 0x7a, 0xb2, 0x00, 0x02, 0xb1, 0x04, 0x06, 0x96, 0x02, 0x01, 0x04, 0x01,
+            0x04, 0x32, 0x01, 0x04, 0x23, 0x01, 0x06, 0xd5, 0x07, 0x00, 0x47, 0x01, 0x06, 0x84, 0x02, 0x01,
+            0xce, 0x0d, 0x01, 0xf9, 0x33, 0x00, 0xe7, 0x18, 0xc7, 0x69, 0x6e, 0x74, 0x28, 0x6d, 0x61, 0x78,
+            0x28, 0x6c, 0x6f, 0x67, 0x28, 0xf9, 0x0d, 0x00, 0xd2, 0x05, 0x00, 0x4b, 0x2f, 0x00, 0x82, 0x34,
+            0x01, 0x2c, 0x00, 0x02, 0x25, 0x34, 0x25, 0x20, 0x2b, 0xf5, 0x30, 0x02, 0x16, 0x00, 0x00, 0x06,
+            0x13, 0x01, 0xb7, 0x05, 0x04, 0xa8, 0x01, 0x00, 0xac, 0x01, 0x01, 0x3a, 0x1e, 0x50, 0x20, 0x63,
+            0x65, 0x6c, 0x6c, 0x86, 0x04, 0x31, 0x69, 0x6e, 0x28, 0x11, 0x00, 0x01, 0x06, 0x00, 0x0e, 0x84,
+            0x1f, 0x01, 0x17, 0x06, 0x06, 0xeb, 0x34, 0x00, 0xa0, 0x21, 0x17, 0x2f, 0xae, 0x39, 0x12, 0x2c,
+            0xe3, 0x34, 0x10, 0x29, 0x95, 0x1d, 0x06, 0x26, 0x00, 0x20, 0x20, 0x2d, 0xa7, 0x38, 0x07, 0xd4,
+            0x00, 0x01, 0x38, 0x0a, 0x03, 0xb1, 0x00, 0x01, 0x94, 0x0c, 0x01, 0x2c, 0x00, 0x20, 0x73, 0x5b,
+            0x85, 0x00, 0x02, 0x34, 0x08, 0x08, 0x47, 0x01, 0x00, 0x42, 0x13, 0x11, 0x28, 0x1b, 0x00, 0x00,
+            0x77, 0x20, 0x03, 0x37, 0x00, 0x02, 0x62, 0x01, 0x00, 0x40, 0x13, 0x01, 0x1a, 0x00, 0x23, 0x7a,
+            0x29, 0x66, 0x1f, 0x00, 0xd2, 0x00, 0x00, 0x1b, 0x19, 0x01, 0x38, 0x01, 0x00, 0x08, 0x1e, 0x03,
+            0x30, 0x00, 0x22, 0x2e, 0x78, 0x10, 0x1e, 0x05, 0x0f, 0x00, 0x06, 0x1d, 0x01, 0x27, 0x2e, 0x79,
+            0x24, 0x1e, 0x00, 0x40, 0x00, 0x06, 0xab, 0x01, 0x00, 0x0e, 0x00, 0x01, 0xde, 0x31, 0x00, 0xb2,
+            0x29, 0x03, 0x2b, 0x32, 0x12, 0x3d, 0x08, 0x00, 0x23, 0x73, 0x5b, 0x4b, 0x00, 0x0b, 0xdf, 0x31,
+            0x27, 0x69, 0x5d, 0x8a, 0x00, 0x00, 0x40, 0x00, 0x01, 0xef, 0x01, 0x00, 0xf2, 0x02, 0x01, 0x77,
+            0x02, 0x14, 0x2e, 0xf9, 0x01, 0x01, 0x86, 0x1c, 0x25, 0x20, 0x2d, 0xde, 0x0f, 0x06, 0x1f, 0x01,
+            0x00, 0x35, 0x00, 0x02, 0x0f, 0x03, 0x40, 0x64, 0x69, 0x73, 0x74, 0xff, 0x21, 0x00, 0xaf, 0x0d,
+            0x10, 0x4c, 0xaf, 0x0d, 0x0f, 0x25, 0x00, 0x01, 0x01, 0x11, 0x34, 0x00, 0x26, 0x00, 0x02, 0x60,
+            0x00, 0x01, 0x0f, 0x00, 0x22, 0x20, 0x2a, 0xa5, 0x00, 0x02, 0x0e, 0x00, 0x0a, 0x36, 0x00, 0x32,
+            0x69, 0x66, 0x28, 0x58, 0x00, 0x31, 0x3e, 0x3d, 0x20, 0x1f, 0x00, 0x12, 0x32, 0xa1, 0x02, 0x00,
+            0x77, 0x00, 0x04, 0x04, 0x00, 0x73, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x68, 0x34, 0x04,
+            0x16, 0x00, 0x10, 0x4c, 0xa4, 0x05, 0x03, 0xcc, 0x1a, 0x42, 0x73, 0x71, 0x72, 0x74, 0x48, 0x00,
+            0x03, 0x36, 0x09, 0x04, 0x25, 0x00, 0x24, 0x2f, 0x2f, 0xb0, 0x23, 0x40, 0x20, 0x73, 0x71, 0x75,
+            0x5c, 0x2e, 0xb1, 0x66, 0x61, 0x6c, 0x6c, 0x6f, 0x66, 0x66, 0x20, 0x77, 0x69, 0x6e, 0x17, 0x11,
+            0x00, 0xb4, 0x13, 0x11, 0x72, 0x47, 0x35, 0x40, 0x7a, 0x65, 0x72, 0x6f, 0x79, 0x24, 0x00, 0x96,
+            0x15, 0x01, 0xbe, 0x00, 0x22, 0x27, 0x73, 0x93, 0x00, 0x05, 0xcc, 0x05, 0x00, 0x56, 0x00, 0x02,
+            0x0c, 0x01, 0x02, 0x3e, 0x00, 0x01, 0x2e, 0x02, 0x00, 0x41, 0x0e, 0x02, 0x97, 0x08, 0x02, 0x82,
+            0x00, 0x00, 0x2b, 0x20, 0x00, 0x2a, 0x01, 0x52, 0x29, 0x20, 0x2f, 0x20, 0x28, 0xd3, 0x00, 0x00,
+            0xaf, 0x0e, 0x00, 0x34, 0x19, 0x18, 0x32, 0x58, 0x0e, 0x0a, 0x08, 0x01, 0x02, 0x57, 0x00, 0x64,
+            0x61, 0x74, 0x74, 0x65, 0x6e, 0x75, 0x1d, 0x2c, 0x03, 0x65, 0x00, 0x13, 0x2a, 0xac, 0x00, 0x00,
+            0x50, 0x00, 0x02, 0x2c, 0x01, 0x10, 0x2b, 0x4c, 0x04, 0x0b, 0xea, 0x00, 0x31, 0x69, 0x66, 0x28,
+            0xb5, 0x00, 0x15, 0x2e, 0x22, 0x35, 0x01, 0x72, 0x35, 0x50, 0x20, 0x3e, 0x3d, 0x20, 0x2d, 0x51,
+            0x0f, 0x09, 0xc5, 0x00, 0x00, 0xc9, 0x00, 0x08, 0x6c, 0x00, 0xdf, 0x2a, 0x3d, 0x20, 0x73, 0x6d,
+            0x6f, 0x6f, 0x74, 0x68, 0x73, 0x74, 0x65, 0x70, 0x48, 0x00, 0x02, 0x03, 0x98, 0x04, 0x06, 0x5e,
+            0x00, 0x01, 0x80, 0x35, 0x11, 0x2c, 0x0d, 0x02, 0x24, 0x2d, 0x4c, 0x1e, 0x00, 0x01, 0x4f, 0x02,
+            0x05, 0xb8, 0x35, 0x08, 0xd8, 0x03, 0x00, 0x72, 0x00, 0x05, 0xf8, 0x04, 0x05, 0x30, 0x00, 0x01,
+            0xea, 0x08, 0x20, 0x20, 0x2a, 0xd1, 0x3c, 0x04, 0xf8, 0x00, 0x0f, 0xec, 0x04, 0x22, 0x00, 0x5e,
+            0x00, 0x02, 0x20, 0x07, 0x02, 0x06, 0x00, 0x01, 0xe6, 0x02, 0x10, 0x61, 0xe7, 0x02, 0x03, 0x82,
+            0x06, 0x01, 0x37, 0x03, 0x00, 0x69, 0x00, 0x0c, 0xec, 0x08, 0x02, 0x86, 0x01, 0x05, 0x4c, 0x13,
+            0x02, 0x01, 0x05, 0x90, 0x34, 0x28, 0x73, 0x4c, 0x20, 0x2b, 0x20, 0x28, 0x64, 0x06, 0x00, 0x20,
+            0x61, 0x4c, 0xd1, 0x04, 0x00, 0x52, 0x00, 0x11, 0x28, 0xaf, 0x00, 0x00, 0x4f, 0x04, 0xb0, 0x6f,
+            0x6c, 0x6f, 0x72, 0x2e, 0x61, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_3[] = {
+            0xf1, 0x34, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x23,
+            0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x56, 0x49, 0x53, 0x49, 0x42, 0x49, 0x4c, 0x49, 0x54,
+            0x59, 0x5f, 0x52, 0x45, 0x53, 0x4f, 0x4c, 0x56, 0x45, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65, 0x66,
+            0x20, 0x42, 0x52, 0x44, 0x46, 0x5f, 0x42, 0x49, 0x4e, 0x44, 0x4c, 0x45, 0x53, 0x53, 0x0a, 0x23,
+            0x65, 0x78, 0x74, 0x65, 0x6e, 0x3f, 0x00, 0xf0, 0x2a, 0x47, 0x4c, 0x5f, 0x41, 0x52, 0x42, 0x5f,
+            0x62, 0x69, 0x6e, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65,
+            0x20, 0x3a, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69,
+            0x66, 0x0a, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x31, 0x34, 0x30,
+            0x2c, 0x20, 0x32, 0x00, 0xf2, 0x0b, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x75,
+            0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x55,
+            0x10, 0x00, 0xf0, 0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x74, 0x34,
+            0x20, 0x69, 0x6e, 0xb3, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, 0x17, 0x00, 0x0b,
+            0x0f, 0x00, 0xa2, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x24, 0x00, 0xc6,
+            0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x16, 0x00, 0xf3, 0x39,
+            0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x3b, 0x0a,
+            0x7d, 0x3b, 0x0a, 0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x61,
+            0x72, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x61,
+            0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62,
+            0x79, 0x20, 0x53, 0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xd2, 0x43, 0x61, 0x63, 0x68, 0x65,
+            0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x4c, 0x01, 0x10, 0x73, 0x51, 0x00, 0xf1, 0x20,
+            0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x61, 0x73, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+            0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x21,
+            0x00, 0x70, 0x6d, 0x65, 0x73, 0x68, 0x20, 0x62, 0x65, 0x1b, 0x01, 0x50, 0x64, 0x72, 0x61, 0x77,
+            0x6e, 0x82, 0x01, 0x10, 0x6e, 0x83, 0x01, 0x07, 0x4d, 0x00, 0x05, 0xb1, 0x01, 0x07, 0x14, 0x00,
+            0x34, 0x20, 0x30, 0x75, 0x6b, 0x01, 0x04, 0xcf, 0x01, 0x03, 0x1e, 0x00, 0xf3, 0x01, 0x45, 0x4e,
+            0x41, 0x42, 0x4c, 0x45, 0x44, 0x28, 0x69, 0x64, 0x78, 0x29, 0x20, 0x28, 0x28, 0x28, 0x17, 0x00,
+            0x01, 0x96, 0x00, 0x31, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20,
+            0x3d, 0x3d, 0x07, 0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69,
+            0x6e, 0x74, 0x20, 0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7, 0x01, 0x18, 0x3b, 0x18, 0x00,
+            0x53, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20, 0x2b, 0x28, 0x00, 0x09, 0x24,
+            0x00, 0x27, 0x55, 0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23, 0x00, 0x67, 0x4e, 0x4f, 0x52,
+            0x4d, 0x41, 0x4c, 0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00, 0x77, 0x54, 0x41, 0x4e, 0x47,
+            0x45, 0x4e, 0x54, 0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00, 0xf7, 0x03, 0x49, 0x4e, 0x53,
+            0x54, 0x41, 0x4e, 0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46, 0x4f, 0x52, 0x4d, 0x34,
+            0x00, 0x07, 0x46, 0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x3d,
+            0x00, 0x3f, 0x34, 0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00, 0x03, 0x65, 0x4d, 0x41, 0x54,
+            0x45, 0x52, 0x49, 0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00, 0x02, 0x09, 0x47, 0x00, 0x38,
+            0x4e, 0x45, 0x58, 0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00, 0x30, 0x3b, 0x0a, 0x0a, 0x5e,
+            0x02, 0x90, 0x77, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x7d, 0x01, 0x25, 0x2c, 0x20,
+            0xf5, 0x00, 0x2d, 0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x00, 0xf3,
+            0x00, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64,
+            0xd6, 0x01, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31, 0x02, 0x33, 0x20, 0x3d, 0x20,
+            0x2b, 0x02, 0x03, 0x11, 0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44, 0x58, 0x29, 0xb4, 0x00,
+            0x01, 0x36, 0x00, 0x24, 0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02, 0xd0, 0x01, 0x0a, 0x30,
+            0x00, 0x03, 0xbf, 0x01, 0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d, 0x68, 0x00, 0x04, 0xc3,
+            0x01, 0x0f, 0x39, 0x00, 0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x0f, 0x72, 0x04, 0x07, 0x17,
+            0x31, 0x72, 0x04, 0x5b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x70, 0x04, 0xd0, 0x76, 0x65, 0x63, 0x33,
+            0x20, 0x61, 0x6d, 0x62, 0x69, 0x65, 0x6e, 0x74, 0x4c, 0x20, 0x00, 0x03, 0x4c, 0x04, 0x00, 0x11,
+            0x03, 0x52, 0x5f, 0x70, 0x61, 0x64, 0x31, 0x10, 0x00, 0x01, 0x27, 0x00, 0x01, 0x40, 0x00, 0x52,
+            0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x15, 0x00, 0x02, 0x5b, 0x04, 0x00, 0x26, 0x00, 0x12, 0x32, 0x11,
+            0x00, 0x01, 0x26, 0x00, 0x00, 0xa6, 0x04, 0x11, 0x5f, 0x2b, 0x00, 0x38, 0x44, 0x69, 0x72, 0xa0,
+            0x04, 0x06, 0x2f, 0x00, 0x12, 0x33, 0x2f, 0x00, 0x00, 0xb1, 0x04, 0xf1, 0x0e, 0x33, 0x20, 0x63,
+            0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x3b, 0x20, 0x2f, 0x2f, 0x20,
+            0x74, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x78, 0x2c, 0x20, 0x79, 0xcc, 0x01, 0xf4, 0x0a, 0x64, 0x65,
+            0x70, 0x74, 0x68, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x73, 0x2c, 0x20, 0x7a, 0x20, 0x69, 0x73,
+            0x20, 0x30, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x3a, 0x00, 0x31, 0x65, 0x64, 0x20, 0x6f, 0x00, 0x02,
+            0xcd, 0x04, 0x31, 0x6f, 0x66, 0x66, 0x32, 0x05, 0x02, 0x6e, 0x00, 0x04, 0x5d, 0x00, 0x01, 0x3f,
+            0x00, 0x62, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x7c, 0x00, 0x0f, 0x1f, 0x00, 0x01, 0x02, 0x21,
+            0x05, 0x00, 0x86, 0x05, 0x01, 0x10, 0x04, 0xf1, 0x05, 0x73, 0x68, 0x61, 0x64, 0x6f, 0x77, 0x5f,
+            0x63, 0x61, 0x73, 0x63, 0x61, 0x64, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0xa1, 0x00, 0x03,
+            0x7f, 0x00, 0x02, 0x20, 0x00, 0x06, 0x76, 0x00, 0x21, 0x7d, 0x3b, 0xac, 0x02, 0x14, 0x64, 0xf6,
+            0x00, 0x22, 0x61, 0x6c, 0x98, 0x00, 0x04, 0x29, 0x00, 0x72, 0x2c, 0x20, 0x73, 0x65, 0x65, 0x20,
+            0x43, 0x4f, 0x00, 0x10, 0x64, 0x56, 0x05, 0x63, 0x6f, 0x77, 0x4d, 0x61, 0x70, 0x73, 0x96, 0x02,
+            0x01, 0x74, 0x00, 0xff, 0x09, 0x4d, 0x41, 0x58, 0x5f, 0x53, 0x48, 0x41, 0x44, 0x4f, 0x57, 0x5f,
+            0x43, 0x41, 0x53, 0x43, 0x41, 0x44, 0x45, 0x53, 0x20, 0x3d, 0x20, 0x34, 0x3b, 0xe1, 0x01, 0x07,
+            0x17, 0x32, 0xe1, 0x01, 0x02, 0x69, 0x00, 0x0b, 0xe2, 0x01, 0x01, 0x52, 0x06, 0x02, 0x1a, 0x00,
+            0x50, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x48, 0x01, 0x1f, 0x5b, 0x68, 0x00, 0x00, 0x11, 0x5d, 0xdc,
+            0x00, 0x00, 0xbe, 0x01, 0x93, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x74, 0x6f, 0xba, 0x00,
+            0x54, 0x20, 0x6d, 0x61, 0x70, 0x20, 0xee, 0x06, 0x01, 0x1c, 0x00, 0x01, 0x62, 0x01, 0x43, 0x76,
+            0x65, 0x63, 0x34, 0x22, 0x00, 0x05, 0x25, 0x01, 0x61, 0x73, 0x70, 0x6c, 0x69, 0x74, 0x73, 0x4a,
+            0x00, 0x32, 0x66, 0x61, 0x72, 0x4e, 0x00, 0x02, 0xc1, 0x01, 0x83, 0x6f, 0x66, 0x20, 0x65, 0x61,
+            0x63, 0x68, 0x20, 0x4f, 0x01, 0x00, 0x88, 0x06, 0x00, 0xda, 0x03, 0x03, 0xa1, 0x01, 0x50, 0x65,
+            0x64, 0x20, 0x70, 0x6f, 0x74, 0x02, 0x00, 0xbe, 0x03, 0x42, 0x73, 0x70, 0x6f, 0x74, 0x3b, 0x01,
+            0x04, 0x34, 0x01, 0x02, 0x23, 0x02, 0x21, 0x65, 0x64, 0xa2, 0x02, 0xb1, 0x69, 0x6e, 0x67, 0x0a,
+            0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x10, 0x00, 0x43, 0x44, 0x61, 0x74, 0x61, 0x3e, 0x07,
+            0x06, 0x81, 0x02, 0x4c, 0x70, 0x6f, 0x73, 0x69, 0x05, 0x07, 0x43, 0x72, 0x61, 0x6e, 0x67, 0xff,
+            0x01, 0x01, 0x29, 0x00, 0x1c, 0x63, 0xcb, 0x02, 0x00, 0x79, 0x00, 0xa1, 0x5f, 0x63, 0x6f, 0x73,
+            0x5f, 0x6f, 0x75, 0x74, 0x65, 0x72, 0xc6, 0x00, 0xc3, 0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x2d,
+            0x31, 0x20, 0x66, 0x6f, 0x72, 0xa3, 0x00, 0x02, 0x6d, 0x02, 0x04, 0x03, 0x01, 0x11, 0x33, 0xe5,
+            0x00, 0x15, 0x5f, 0xf6, 0x01, 0x08, 0x5f, 0x02, 0x05, 0x50, 0x00, 0x51, 0x69, 0x6e, 0x6e, 0x65,
+            0x72, 0x7c, 0x07, 0x06, 0x1b, 0x08, 0x29, 0x34, 0x33, 0x1b, 0x08, 0xf3, 0x05, 0x31, 0x29, 0x20,
+            0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+            0x5f, 0x1d, 0x01, 0x01, 0xe6, 0x00, 0x04, 0x21, 0x08, 0x01, 0x0d, 0x00, 0x00, 0xf3, 0x00, 0x03,
+            0x22, 0x01, 0x2f, 0x5b, 0x5d, 0x58, 0x00, 0x0b, 0x1f, 0x32, 0x58, 0x00, 0x07, 0x04, 0x53, 0x00,
+            0x00, 0x88, 0x03, 0x14, 0x32, 0x4e, 0x03, 0x22, 0x73, 0x5b, 0x09, 0x02, 0xb4, 0x6f, 0x66, 0x66,
+            0x73, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x1b, 0x00, 0x02, 0xd6, 0x03, 0x40, 0x5f, 0x69,
+            0x6e, 0x64, 0x44, 0x02, 0x12, 0x2c, 0x81, 0x00, 0x11, 0x20, 0x18, 0x03, 0x00, 0xcf, 0x01, 0x0f,
+            0xdb, 0x00, 0x06, 0x1f, 0x33, 0x83, 0x00, 0x07, 0x01, 0xce, 0x00, 0x12, 0x49, 0x51, 0x00, 0x03,
+            0xc4, 0x01, 0x01, 0x08, 0x03, 0x03, 0xfa, 0x00, 0x0a, 0x72, 0x00, 0x03, 0xeb, 0x00, 0x08, 0x30,
+            0x03, 0xad, 0x41, 0x4c, 0x42, 0x45, 0x44, 0x4f, 0x5f, 0x4d, 0x41, 0x50, 0xb7, 0x07, 0x93, 0x52,
+            0x4f, 0x55, 0x47, 0x48, 0x4e, 0x45, 0x53, 0x53, 0x1e, 0x00, 0x07, 0x2b, 0x00, 0x34, 0x2b, 0x20,
+            0x31, 0xd6, 0x05, 0x01, 0x6e, 0x00, 0x83, 0x4d, 0x45, 0x54, 0x41, 0x4c, 0x4c, 0x49, 0x43, 0x2a,
+            0x00, 0x0a, 0x3a, 0x00, 0x0c, 0x2d, 0x00, 0x03, 0xb3, 0x05, 0x02, 0x73, 0x00, 0x09, 0x3a, 0x00,
+            0x0c, 0x2a, 0x00, 0x40, 0x41, 0x4d, 0x42, 0x49, 0xce, 0x07, 0x93, 0x4f, 0x43, 0x43, 0x4c, 0x55,
+            0x53, 0x49, 0x4f, 0x4e, 0x60, 0x00, 0x07, 0x42, 0x00, 0x0c, 0x33, 0x00, 0x00, 0xc9, 0x07, 0x02,
+            0x5a, 0x00, 0x0f, 0x3d, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x24, 0x05, 0x20, 0x4f, 0x63, 0x22,
+            0x01, 0xf8, 0x17, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x52, 0x6f, 0x75, 0x67, 0x68, 0x6e, 0x65, 0x73,
+            0x73, 0x2c, 0x20, 0x4d, 0x65, 0x74, 0x61, 0x6c, 0x6c, 0x69, 0x63, 0x20, 0x70, 0x61, 0x63, 0x6b,
+            0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x52, 0x47, 0x42, 0x30, 0x01, 0x01, 0x74, 0x07, 0x02, 0x61,
+            0x00, 0x04, 0x6b, 0x00, 0x00, 0x53, 0x00, 0x04, 0x5f, 0x04, 0x06, 0xaa, 0x0a, 0x04, 0x29, 0x00,
+            0x06, 0x5e, 0x04, 0xe2, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x41, 0x72, 0x72,
+            0x61, 0x79, 0xbf, 0x04, 0x04, 0xff, 0x03, 0x31, 0x6d, 0x61, 0x70, 0x2e, 0x03, 0x80, 0x46, 0x72,
+            0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x1e, 0x00, 0x20, 0x65, 0x72, 0x4a, 0x0b, 0x23, 0x3a, 0x3a,
+            0xcf, 0x04, 0x94, 0x4d, 0x41, 0x50, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x0a, 0xbc, 0x03, 0x80, 0x4d,
+            0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0xcc, 0x02, 0x03, 0xfb, 0x01, 0x01, 0x52, 0x04, 0x01,
+            0x96, 0x03, 0x48, 0x5f, 0x6d, 0x6f, 0x64, 0x4a, 0x03, 0x14, 0x72, 0xe5, 0x00, 0x0c, 0x19, 0x00,
+            0x13, 0x6d, 0xf3, 0x00, 0x0c, 0x18, 0x00, 0x03, 0xd3, 0x06, 0x24, 0x5f, 0x6f, 0x29, 0x01, 0x0c,
+            0x21, 0x00, 0x66, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x16, 0x00, 0x01, 0x09, 0x02, 0x02, 0xb3,
+            0x0a, 0x04, 0xda, 0x0b, 0x14, 0x5f, 0xb1, 0x0a, 0x01, 0xdc, 0x00, 0x62, 0x73, 0x65, 0x6c, 0x65,
+            0x63, 0x74, 0xdb, 0x0a, 0x12, 0x76, 0x3f, 0x0b, 0x31, 0x20, 0x6f, 0x6e, 0xc9, 0x0a, 0x81, 0x43,
+            0x50, 0x55, 0x20, 0x73, 0x69, 0x64, 0x65, 0x14, 0x04, 0x01, 0x49, 0x00, 0x00, 0x15, 0x07, 0x40,
+            0x5b, 0x33, 0x5d, 0x3b, 0x4d, 0x06, 0x20, 0x20, 0x20, 0xb2, 0x01, 0x0f, 0x1b, 0x01, 0x01, 0x04,
+            0x03, 0x01, 0x03, 0xb2, 0x05, 0x00, 0x0a, 0x01, 0x30, 0x3a, 0x3a, 0x5f, 0x3c, 0x00, 0x01, 0x4a,
+            0x00, 0x00, 0x10, 0x05, 0xc0, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x5b,
+            0x38, 0x4f, 0x00, 0xf7, 0x02, 0x2f, 0x2f, 0x20, 0x54, 0x45, 0x58, 0x54, 0x55, 0x52, 0x45, 0x5f,
+            0x41, 0x52, 0x52, 0x41, 0x59, 0x53, 0x8c, 0x00, 0x21, 0x6c, 0x79, 0x37, 0x00, 0x02, 0xcf, 0x03,
+            0x00, 0x39, 0x00, 0x21, 0x68, 0x61, 0xab, 0x0c, 0x01, 0x3a, 0x00, 0x34, 0x2f, 0x2f, 0x20, 0xd5,
+            0x0c, 0x09, 0x33, 0x00, 0x42, 0x2c, 0x20, 0x30, 0x20, 0x28, 0x00, 0x01, 0xe3, 0x04, 0x60, 0x75,
+            0x6e, 0x75, 0x73, 0x65, 0x64, 0xf2, 0x05, 0x10, 0x73, 0xd4, 0x03, 0xd0, 0x2f, 0x2f, 0x20, 0x65,
+            0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x65, 0x67, 0x69, 0xa7, 0x07, 0x01, 0x1c, 0x00, 0x02, 0xb9,
+            0x01, 0x90, 0x2c, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x64, 0x25, 0x0c, 0x00, 0xf1, 0x0b,
+            0xc0, 0x70, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0xc9, 0x0c, 0x01,
+            0xdf, 0x01, 0x02, 0x25, 0x00, 0x04, 0x61, 0x02, 0x0e, 0xf8, 0x04, 0x1f, 0x30, 0x1d, 0x04, 0x00,
+            0x13, 0x6d, 0x1b, 0x02, 0x04, 0xa1, 0x04, 0x04, 0x28, 0x01, 0x00, 0x21, 0x01, 0x05, 0x59, 0x00,
+            0x00, 0xa9, 0x04, 0x03, 0xa3, 0x00, 0x0e, 0xcd, 0x0d, 0x62, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64,
+            0xad, 0x01, 0x01, 0x12, 0x0d, 0x70, 0x76, 0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x7b, 0x0c, 0xb1,
+            0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x42, 0x68, 0x05, 0x04, 0xce, 0x0c,
+            0xf0, 0x04, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 0x20,
+            0x6f, 0x75, 0x74, 0x70, 0x75, 0xef, 0x01, 0x11, 0x6f, 0x98, 0x05, 0x10, 0x2c, 0xad, 0x06, 0x00,
+            0xe5, 0x00, 0x21, 0x69, 0x6e, 0x17, 0x00, 0x02, 0x18, 0x06, 0x00, 0x3e, 0x0d, 0x21, 0x72, 0x65,
+            0x44, 0x0c, 0x00, 0x90, 0x06, 0x71, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x14, 0x02, 0x15,
+            0x76, 0x66, 0x00, 0x04, 0xcf, 0x05, 0x00, 0xdb, 0x06, 0x00, 0x42, 0x00, 0x02, 0xf7, 0x0c, 0x01,
+            0x7b, 0x00, 0x11, 0x73, 0x30, 0x01, 0x30, 0x65, 0x61, 0x64, 0xfb, 0x0c, 0x00, 0xfa, 0x0c, 0x0e,
+            0xca, 0x00, 0x00, 0x78, 0x00, 0x16, 0x52, 0x63, 0x00, 0x02, 0xd3, 0x00, 0x13, 0x66, 0x68, 0x03,
+            0x01, 0x80, 0x03, 0x01, 0x76, 0x01, 0x01, 0x95, 0x00, 0x33, 0x6f, 0x66, 0x20, 0x56, 0x0e, 0x10,
+            0x2e, 0xc6, 0x00, 0x51, 0x2e, 0x67, 0x6c, 0x73, 0x6c, 0xd6, 0x01, 0x00, 0x77, 0x00, 0x0f, 0x07,
+            0x01, 0x0d, 0x10, 0x2e, 0x6a, 0x00, 0xf2, 0x04, 0x54, 0x68, 0x65, 0x20, 0x70, 0x69, 0x78, 0x65,
+            0x6c, 0x27, 0x73, 0x20, 0x49, 0x44, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x72, 0x00, 0x05, 0xd8, 0x01,
+            0x01, 0xc6, 0x00, 0x00, 0x3d, 0x0e, 0x21, 0x67, 0x6c, 0x08, 0x0e, 0x31, 0x6f, 0x73, 0x65, 0x33,
+            0x01, 0x00, 0x13, 0x06, 0x01, 0x4e, 0x0e, 0x58, 0x66, 0x65, 0x74, 0x63, 0x68, 0x0a, 0x01, 0x08,
+            0xf0, 0x00, 0x02, 0x47, 0x01, 0x40, 0x72, 0x61, 0x6e, 0x73, 0x05, 0x0f, 0x00, 0x70, 0x0e, 0x10,
+            0x6e, 0xa7, 0x04, 0xf0, 0x04, 0x74, 0x65, 0x72, 0x70, 0x6f, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20,
+            0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x65, 0x72, 0x95, 0x0e, 0x01, 0x40, 0x0e, 0x30, 0x63, 0x6f,
+            0x72, 0x47, 0x0a, 0x80, 0x20, 0x62, 0x61, 0x72, 0x79, 0x63, 0x65, 0x6e, 0xc1, 0x08, 0x90, 0x73,
+            0x2e, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x21, 0x00, 0x02, 0x81, 0x09, 0x20, 0x64, 0x69,
+            0x33, 0x07, 0x32, 0x65, 0x6e, 0x63, 0x8f, 0x0e, 0x21, 0x74, 0x6f, 0x85, 0x01, 0x08, 0x34, 0x00,
+            0x00, 0xfb, 0x01, 0x01, 0x08, 0x01, 0x00, 0xe6, 0x0a, 0x01, 0x5a, 0x0a, 0x20, 0x75, 0x70, 0xb2,
+            0x02, 0x94, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0xce, 0x03, 0x47, 0x73, 0x61,
+            0x6d, 0x65, 0xe3, 0x00, 0x91, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x64, 0x46, 0x64, 0x78, 0x34, 0x00,
+            0x40, 0x64, 0x46, 0x64, 0x79, 0x4a, 0x00, 0x61, 0x61, 0x20, 0x71, 0x75, 0x61, 0x64, 0x34, 0x01,
+            0x10, 0x4f, 0xb3, 0x07, 0x01, 0x35, 0x01, 0x01, 0x5f, 0x02, 0x01, 0x64, 0x00, 0x00, 0x85, 0x0f,
+            0x82, 0x76, 0x65, 0x64, 0x20, 0x64, 0x72, 0x61, 0x77, 0x79, 0x02, 0x00, 0x17, 0x00, 0x83, 0x47,
+            0x4c, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x13, 0x09, 0x80, 0x74, 0x65, 0x73, 0x74, 0x20, 0x61,
+            0x67, 0x61, 0x5c, 0x01, 0x01, 0xaf, 0x00, 0x84, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69,
+            0x39, 0x00, 0x01, 0x27, 0x00, 0x14, 0x2e, 0x3c, 0x03, 0x64, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x5f,
+            0xfb, 0x01, 0x10, 0x5f, 0x3e, 0x00, 0x74, 0x73, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x22, 0x00,
+            0x06, 0xbf, 0x05, 0x16, 0x38, 0xb8, 0x05, 0x15, 0x75, 0xb9, 0x05, 0x07, 0x94, 0x02, 0x32, 0x5f,
+            0x69, 0x64, 0xa6, 0x09, 0x0c, 0x0d, 0x03, 0x42, 0x3a, 0x3a, 0x49, 0x44, 0xa8, 0x05, 0x03, 0xcf,
+            0x07, 0x40, 0x6c, 0x6f, 0x63, 0x61, 0x49, 0x09, 0x0a, 0x4c, 0x0c, 0x01, 0xe5, 0x04, 0x00, 0xdd,
+            0x00, 0x55, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x9f, 0x0a, 0x07, 0x2d, 0x00, 0x07, 0x98, 0x0a, 0x01,
+            0x2d, 0x00, 0x04, 0x51, 0x01, 0x03, 0x48, 0x0b, 0x04, 0xb3, 0x00, 0x07, 0x32, 0x00, 0x16, 0x33,
+            0xb4, 0x00, 0x01, 0x6c, 0x0d, 0x03, 0x5e, 0x04, 0x02, 0x56, 0x0b, 0x13, 0x49, 0x58, 0x04, 0x00,
+            0x03, 0x04, 0x11, 0x2c, 0x2d, 0x01, 0x02, 0x4b, 0x04, 0x13, 0x20, 0x0a, 0x0a, 0xe0, 0x73, 0x69,
+            0x7a, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x75, 0x70, 0xbc, 0x0a, 0x00, 0x71,
+            0x01, 0xf4, 0x01, 0x70, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x31, 0x34, 0x34, 0x20, 0x62, 0x79,
+            0x74, 0x65, 0x73, 0x7c, 0x06, 0x06, 0xf6, 0x00, 0x04, 0x58, 0x00, 0x03, 0x82, 0x06, 0x01, 0x2d,
+            0x0b, 0x52, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x7e, 0x06, 0x01, 0x10, 0x00, 0x04, 0x8f, 0x11, 0x07,
+            0x18, 0x00, 0x01, 0xd3, 0x00, 0x04, 0xa7, 0x04, 0x01, 0x81, 0x09, 0x23, 0x2f, 0x2f, 0xe8, 0x03,
+            0x0f, 0x05, 0x02, 0x03, 0x12, 0x2c, 0x73, 0x0a, 0x10, 0x61, 0x3c, 0x07, 0x02, 0xb2, 0x02, 0x10,
+            0x74, 0x88, 0x02, 0x24, 0x6c, 0x79, 0xac, 0x07, 0x01, 0x91, 0x0c, 0x14, 0x73, 0x17, 0x01, 0x02,
+            0xdd, 0x00, 0x08, 0x3b, 0x12, 0x1f, 0x38, 0x28, 0x05, 0x00, 0x06, 0xd0, 0x01, 0x04, 0xc7, 0x00,
+            0x04, 0x32, 0x05, 0x0e, 0xe1, 0x00, 0x09, 0xfd, 0x01, 0x03, 0x4d, 0x01, 0x04, 0x43, 0x05, 0x03,
+            0xeb, 0x01, 0x0e, 0x75, 0x00, 0x1f, 0x39, 0x75, 0x00, 0x0a, 0x13, 0x50, 0x64, 0x0b, 0x04, 0x75,
+            0x00, 0x01, 0xc3, 0x00, 0x08, 0x68, 0x00, 0x04, 0x85, 0x0b, 0x0f, 0x68, 0x00, 0x0e, 0x1f, 0x31,
+            0x06, 0x06, 0x01, 0x06, 0xde, 0x00, 0x30, 0x45, 0x6c, 0x65, 0x56, 0x08, 0x04, 0x68, 0x00, 0x01,
+            0x7d, 0x01, 0x06, 0x1e, 0x00, 0x23, 0x5f, 0x65, 0x1f, 0x00, 0x03, 0x20, 0x0a, 0x0f, 0xce, 0x00,
+            0x06, 0x1f, 0x31, 0x64, 0x0b, 0x01, 0x06, 0x48, 0x00, 0x01, 0xda, 0x0e, 0x04, 0x64, 0x00, 0x01,
+            0xdd, 0x0c, 0x06, 0x1c, 0x00, 0x11, 0x5f, 0x96, 0x08, 0x0f, 0xc8, 0x00, 0x0f, 0x0f, 0x6e, 0x0b,
+            0x01, 0x06, 0x46, 0x00, 0x27, 0x55, 0x56, 0x5f, 0x00, 0x18, 0x32, 0x2a, 0x01, 0x2f, 0x75, 0x76,
+            0x5c, 0x00, 0x0f, 0x0f, 0x47, 0x0b, 0x01, 0x06, 0x5c, 0x00, 0x11, 0x4e, 0xd0, 0x08, 0x04, 0x60,
+            0x00, 0x0d, 0x8b, 0x01, 0x02, 0xef, 0x08, 0x0f, 0x65, 0x00, 0x0f, 0x1f, 0x34, 0xf2, 0x01, 0x0a,
+            0x10, 0x54, 0x42, 0x0d, 0x2f, 0x6e, 0x74, 0x66, 0x00, 0x06, 0x13, 0x74, 0x20, 0x00, 0x03, 0x8a,
+            0x01, 0x11, 0x0a, 0xaa, 0x01, 0x00, 0xb2, 0x04, 0x00, 0x7a, 0x0e, 0x01, 0x0f, 0x08, 0x2f, 0x3b,
+            0x0a, 0xcd, 0x07, 0x02, 0x31, 0x3b, 0x0a, 0x0a, 0x72, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x36, 0x0e,
+            0x57, 0x5f, 0x70, 0x6f, 0x73, 0x3b, 0x14, 0x00, 0x0b, 0x0f, 0x00, 0x01, 0x8f, 0x01, 0x01, 0x20,
+            0x00, 0x12, 0x32, 0x34, 0x00, 0x21, 0x75, 0x76, 0x0e, 0x00, 0x12, 0x33, 0x0e, 0x00, 0x01, 0x42,
+            0x00, 0x02, 0xf3, 0x00, 0x0d, 0x17, 0x00, 0x03, 0xa4, 0x00, 0x0d, 0x18, 0x00, 0x2f, 0x62, 0x69,
+            0x1a, 0x00, 0x05, 0x77, 0x70, 0x6f, 0x73, 0x5f, 0x64, 0x78, 0x2c, 0x5b, 0x00, 0x01, 0x12, 0x00,
+            0x11, 0x79, 0x43, 0x00, 0x05, 0x80, 0x00, 0x06, 0x23, 0x00, 0x52, 0x75, 0x76, 0x5f, 0x64, 0x79,
+            0xd2, 0x00, 0x30, 0x33, 0x20, 0x46, 0x0f, 0x07, 0x51, 0x56, 0x65, 0x63, 0x33, 0x28, 0x0d, 0x01,
+            0x00, 0x98, 0x07, 0x32, 0x65, 0x78, 0x2c, 0x72, 0x14, 0x02, 0x1b, 0x15, 0x13, 0x29, 0x7c, 0x04,
+            0x01, 0x20, 0x00, 0x31, 0x69, 0x20, 0x3d, 0x4f, 0x07, 0x72, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x33,
+            0x75, 0x86, 0x04, 0x32, 0x69, 0x66, 0x28, 0x2b, 0x00, 0x00, 0xb7, 0x14, 0x03, 0x3e, 0x0c, 0x00,
+            0xf9, 0x11, 0x01, 0xef, 0x09, 0x00, 0x63, 0x0a, 0x61, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x63,
+            0x04, 0x16, 0x28, 0x13, 0x02, 0x03, 0x02, 0x01, 0x58, 0x73, 0x5b, 0x69, 0x5d, 0x2c, 0x6d, 0x02,
+            0x05, 0x17, 0x00, 0x5f, 0x20, 0x2b, 0x20, 0x31, 0x75, 0x1c, 0x00, 0x07, 0x4f, 0x32, 0x75, 0x5d,
+            0x29, 0x81, 0x00, 0x00, 0x08, 0x7b, 0x12, 0x0f, 0x82, 0x00, 0x0d, 0x03, 0x53, 0x01, 0x0d, 0x83,
+            0x00, 0x06, 0x18, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x09, 0x1d, 0x00, 0x06, 0x85, 0x00, 0x0f, 0xe5,
+            0x00, 0x04, 0x06, 0x65, 0x04, 0x0b, 0xe7, 0x00, 0x07, 0x19, 0x00, 0x0f, 0x65, 0x00, 0x00, 0x0a,
+            0x1e, 0x00, 0x02, 0x66, 0x00, 0x11, 0x7d, 0xc1, 0x11, 0x0f, 0x7d, 0x08, 0x0d, 0x00, 0xff, 0x07,
+            0x00, 0x5d, 0x06, 0x04, 0xd2, 0x06, 0x00, 0x34, 0x17, 0x74, 0x61, 0x6e, 0x20, 0x4e, 0x44, 0x43,
+            0x20, 0x55, 0x00, 0x00, 0xb9, 0x02, 0x37, 0x33, 0x20, 0x42, 0xb2, 0x08, 0xc1, 0x28, 0x6d, 0x61,
+            0x74, 0x33, 0x78, 0x34, 0x20, 0x63, 0x6c, 0x69, 0x70, 0x0c, 0x06, 0x54, 0x32, 0x20, 0x6e, 0x64,
+            0x63, 0xfb, 0x01, 0x01, 0x1c, 0x06, 0x04, 0x67, 0x06, 0x10, 0x77, 0x6b, 0x07, 0x42, 0x2e, 0x66,
+            0x20, 0x2f, 0xd0, 0x01, 0x00, 0x32, 0x00, 0x61, 0x5b, 0x30, 0x5d, 0x2e, 0x77, 0x2c, 0x3d, 0x00,
+            0x26, 0x5b, 0x31, 0x0b, 0x00, 0x43, 0x32, 0x5d, 0x2e, 0x77, 0xa2, 0x01, 0x01, 0xfc, 0x17, 0x42,
+            0x70, 0x30, 0x20, 0x3d, 0x25, 0x00, 0x75, 0x30, 0x5d, 0x2e, 0x78, 0x79, 0x20, 0x2a, 0x4a, 0x18,
+            0x32, 0x77, 0x2e, 0x78, 0xca, 0x01, 0x01, 0x28, 0x00, 0x24, 0x65, 0x31, 0x28, 0x00, 0x1d, 0x31,
+            0x28, 0x00, 0x68, 0x79, 0x20, 0x2d, 0x20, 0x70, 0x30, 0x2d, 0x00, 0x14, 0x32, 0x2d, 0x00, 0x1d,
+            0x32, 0x2d, 0x00, 0x1c, 0x7a, 0x2d, 0x00, 0x30, 0x64, 0x20, 0x3d, 0xd8, 0x00, 0x07, 0x17, 0x00,
+            0x02, 0x8a, 0x04, 0x04, 0xdc, 0x00, 0x45, 0x61, 0x72, 0x65, 0x61, 0xdf, 0x00, 0x40, 0x28, 0x65,
+            0x31, 0x2e, 0xe7, 0x02, 0x21, 0x65, 0x32, 0x76, 0x00, 0x30, 0x65, 0x31, 0x2e, 0xb3, 0x00, 0x43,
+            0x65, 0x32, 0x2e, 0x78, 0xd5, 0x00, 0x02, 0x3c, 0x00, 0x10, 0x62, 0xae, 0x00, 0x28, 0x28, 0x64,
+            0x2b, 0x00, 0x16, 0x64, 0x2a, 0x00, 0x07, 0xe5, 0x00, 0x00, 0x5d, 0x00, 0x02, 0xb9, 0x00, 0x03,
+            0x39, 0x00, 0x00, 0xba, 0x00, 0x04, 0x65, 0x00, 0x00, 0x33, 0x00, 0x05, 0x64, 0x00, 0x1f, 0x64,
+            0x39, 0x00, 0x05, 0x01, 0x89, 0x01, 0x10, 0x77, 0x12, 0x0a, 0x21, 0x74, 0x73, 0x8a, 0x03, 0xb0,
+            0x63, 0x33, 0x28, 0x31, 0x2e, 0x66, 0x20, 0x2d, 0x20, 0x62, 0x31, 0x05, 0x00, 0x98, 0x32, 0x2c,
+            0x20, 0x62, 0x31, 0x2c, 0x20, 0x62, 0x32, 0x3f, 0x00, 0x03, 0xa4, 0x19, 0x03, 0xa0, 0x02, 0x04,
+            0x3e, 0x00, 0x33, 0x2f, 0x20, 0x28, 0x0b, 0x00, 0x54, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x0c, 0x00,
+            0x17, 0x79, 0x0c, 0x00, 0xb8, 0x7a, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+            0xe4, 0x0b, 0x04, 0x2b, 0x0e, 0x14, 0x28, 0x1f, 0x02, 0x01, 0x1a, 0x04, 0x00, 0x2a, 0x09, 0x30,
+            0x6c, 0x5f, 0x69, 0x62, 0x01, 0x51, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x59, 0x04, 0x08, 0xee, 0x03,
+            0x60, 0x69, 0x64, 0x73, 0x2c, 0x20, 0x69, 0xe1, 0x01, 0x40, 0x28, 0x67, 0x6c, 0x5f, 0x45, 0x00,
+            0xf1, 0x02, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e,
+            0x72, 0x20, 0x2d, 0x90, 0x0a, 0x03, 0xb3, 0x09, 0x00, 0x38, 0x04, 0x01, 0x59, 0x00, 0x00, 0x7f,
+            0x0a, 0x01, 0xb3, 0x0d, 0x16, 0x3d, 0x64, 0x00, 0x15, 0x2f, 0x01, 0x0b, 0x04, 0xb0, 0x09, 0x05,
+            0x2f, 0x00, 0x05, 0xf7, 0x02, 0x07, 0x2f, 0x00, 0x11, 0x2d, 0xc8, 0x0c, 0x01, 0x45, 0x00, 0x1f,
+            0x2a, 0x3a, 0x00, 0x02, 0x0f, 0x90, 0x08, 0x00, 0x30, 0x64, 0x61, 0x74, 0x0b, 0x02, 0x08, 0xc1,
+            0x00, 0x05, 0x97, 0x08, 0x04, 0x93, 0x00, 0x13, 0x5d, 0xcf, 0x01, 0x08, 0x42, 0x06, 0x21, 0x20,
+            0x3d, 0x3b, 0x00, 0x16, 0x2e, 0x7e, 0x09, 0x00, 0x9b, 0x00, 0x04, 0x0e, 0x00, 0x27, 0x20, 0x3d,
+            0x21, 0x0e, 0x01, 0x1a, 0x06, 0x04, 0x1a, 0x00, 0x31, 0x5d, 0x3b, 0x0a, 0xae, 0x04, 0x00, 0x1f,
+            0x0f, 0x11, 0x33, 0x64, 0x05, 0x01, 0xb3, 0x0c, 0x12, 0x3d, 0x11, 0x00, 0x15, 0x28, 0xd7, 0x00,
+            0x00, 0x77, 0x05, 0x33, 0x29, 0x20, 0x2b, 0x17, 0x00, 0xa3, 0x30, 0x75, 0x2c, 0x20, 0x31, 0x75,
+            0x2c, 0x20, 0x32, 0x75, 0x94, 0x02, 0x33, 0x69, 0x66, 0x28, 0x99, 0x0a, 0x11, 0x29, 0x4f, 0x00,
+            0x00, 0x7d, 0x00, 0x00, 0xd5, 0x05, 0x09, 0x4d, 0x00, 0x07, 0xd5, 0x00, 0x05, 0x9d, 0x08, 0x04,
+            0x25, 0x00, 0x2a, 0x2e, 0x78, 0x72, 0x05, 0x0e, 0x21, 0x00, 0x1f, 0x79, 0x21, 0x00, 0x0d, 0x10,
+            0x7a, 0x98, 0x05, 0x01, 0x7e, 0x00, 0x01, 0xa0, 0x0a, 0x00, 0xee, 0x06, 0x10, 0x4d, 0xb4, 0x0a,
+            0x00, 0xb2, 0x02, 0x53, 0x69, 0x65, 0x77, 0x20, 0x2a, 0x22, 0x01, 0x00, 0x14, 0x00, 0x02, 0x42,
+            0x01, 0x03, 0x7e, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x5a, 0x07, 0x01, 0x1b, 0x15, 0x12, 0x73, 0x51,
+            0x04, 0x02, 0x21, 0x00, 0x40, 0x66, 0x6f, 0x72, 0x28, 0x70, 0x10, 0x00, 0x80, 0x06, 0xd2, 0x30,
+            0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x33, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0xe6, 0x00, 0x02, 0x9d,
+            0x1c, 0x01, 0xec, 0x00, 0x44, 0x69, 0x65, 0x77, 0x5f, 0xe8, 0x04, 0x00, 0xd8, 0x05, 0x03, 0x75,
+            0x00, 0x02, 0x81, 0x00, 0x10, 0x2a, 0xb4, 0x04, 0x21, 0x34, 0x28, 0x9c, 0x02, 0x01, 0xf5, 0x06,
+            0x04, 0xf6, 0x00, 0x01, 0x84, 0x06, 0x03, 0x62, 0x1b, 0x63, 0x29, 0x2c, 0x20, 0x31, 0x2e, 0x66,
+            0x50, 0x01, 0x00, 0x54, 0x00, 0x01, 0xe3, 0x04, 0x47, 0x69, 0x5d, 0x20, 0x3d, 0xd4, 0x1c, 0x22,
+            0x20, 0x2a, 0x59, 0x15, 0x08, 0x6b, 0x00, 0x02, 0xab, 0x00, 0x11, 0x7d, 0xfa, 0x00, 0x00, 0xe8,
+            0x02, 0x02, 0xab, 0x0e, 0x44, 0x20, 0x3d, 0x20, 0x32, 0x2f, 0x05, 0x21, 0x32, 0x28, 0xe7, 0x0e,
+            0x01, 0x00, 0x1d, 0x03, 0x61, 0x00, 0x01, 0x29, 0x00, 0x6b, 0x6e, 0x64, 0x63, 0x20, 0x3d, 0x20,
+            0x17, 0x03, 0x23, 0x20, 0x2a, 0x41, 0x00, 0x10, 0x2d, 0x90, 0x00, 0x02, 0x5d, 0x00, 0x01, 0x01,
+            0x04, 0x3a, 0x62, 0x20, 0x3d, 0xbd, 0x05, 0x00, 0xa1, 0x00, 0x10, 0x2c, 0xd9, 0x04, 0x06, 0x54,
+            0x00, 0x6f, 0x33, 0x20, 0x62, 0x5f, 0x64, 0x78, 0x29, 0x00, 0x06, 0x20, 0x20, 0x2b, 0x0a, 0x01,
+            0x21, 0x32, 0x28, 0x18, 0x0e, 0x90, 0x2e, 0x78, 0x2c, 0x20, 0x30, 0x2e, 0x66, 0x29, 0x29, 0x43,
+            0x04, 0x08, 0x68, 0x00, 0x3f, 0x5f, 0x64, 0x79, 0x42, 0x00, 0x0e, 0x42, 0x30, 0x2e, 0x66, 0x2c,
+            0xa8, 0x00, 0x24, 0x2e, 0x79, 0x42, 0x00, 0x01, 0x02, 0x01, 0x01, 0xde, 0x02, 0x04, 0xd2, 0x01,
+            0x03, 0x86, 0x01, 0x06, 0x9a, 0x01, 0x24, 0x20, 0x2a, 0x6b, 0x00, 0x01, 0x28, 0x00, 0x20, 0x70,
+            0x6f, 0xd0, 0x04, 0x09, 0x5f, 0x01, 0x01, 0x18, 0x00, 0x04, 0x40, 0x00, 0x07, 0x2b, 0x00, 0x04,
+            0x13, 0x00, 0x02, 0xdf, 0x00, 0x00, 0x11, 0x01, 0x14, 0x28, 0x13, 0x00, 0x02, 0x38, 0x02, 0x00,
+            0x5b, 0x00, 0x25, 0x5f, 0x64, 0xa5, 0x05, 0x00, 0x9d, 0x03, 0x04, 0x21, 0x00, 0x02, 0xd1, 0x00,
+            0x0f, 0x34, 0x00, 0x06, 0x23, 0x79, 0x29, 0x85, 0x03, 0x01, 0x7c, 0x00, 0x01, 0xc5, 0x09, 0x00,
+            0xb9, 0x00, 0x30, 0x65, 0x63, 0x34, 0x66, 0x05, 0x03, 0x5d, 0x01, 0x23, 0x69, 0x66, 0x7e, 0x1b,
+            0x03, 0xfd, 0x1a, 0x02, 0x82, 0x02, 0x00, 0x28, 0x02, 0x09, 0x36, 0x00, 0x02, 0xd3, 0x02, 0x08,
+            0x01, 0x05, 0x01, 0x50, 0x00, 0x24, 0x73, 0x5b, 0x73, 0x02, 0x0c, 0x69, 0x03, 0x0c, 0x1f, 0x00,
+            0x0b, 0x67, 0x03, 0x0c, 0x1f, 0x00, 0x20, 0x7a, 0x5d, 0xe4, 0x05, 0x08, 0x44, 0x01, 0x22, 0x75,
+            0x76, 0xad, 0x00, 0x20, 0x32, 0x28, 0xcd, 0x01, 0x07, 0x32, 0x01, 0x00, 0xf1, 0x09, 0x00, 0x0b,
+            0x02, 0x01, 0xa0, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x78, 0x02, 0x07, 0x29, 0x00,
+            0x36, 0x69, 0x66, 0x28, 0x3d, 0x1c, 0x02, 0xd3, 0x00, 0x06, 0x55, 0x03, 0x01, 0xcc, 0x00, 0x40,
+            0x32, 0x20, 0x75, 0x76, 0xa5, 0x01, 0x02, 0x0d, 0x00, 0x08, 0xd9, 0x00, 0x00, 0x1e, 0x0c, 0x0f,
+            0xd6, 0x00, 0x05, 0x09, 0x1c, 0x00, 0x0b, 0xd3, 0x00, 0x09, 0x1c, 0x00, 0x01, 0x35, 0x04, 0x00,
+            0x46, 0x01, 0x00, 0x04, 0x00, 0x03, 0xaa, 0x00, 0x01, 0xfe, 0x04, 0x01, 0xd0, 0x01, 0x02, 0xce,
+            0x00, 0x07, 0x1b, 0x00, 0x02, 0xfe, 0x01, 0x00, 0x92, 0x00, 0x11, 0x2a, 0xea, 0x02, 0x0f, 0x21,
+            0x00, 0x00, 0x00, 0xe6, 0x00, 0x05, 0x21, 0x00, 0x12, 0x79, 0x21, 0x00, 0x02, 0x9d, 0x03, 0x33,
+            0x69, 0x66, 0x28, 0xa7, 0x0a, 0x09, 0xc4, 0x01, 0x0a, 0xf1, 0x00, 0x12, 0x20, 0x88, 0x0a, 0x00,
+            0xd9, 0x05, 0x20, 0x72, 0x69, 0x3f, 0x01, 0x00, 0xf9, 0x00, 0x11, 0x28, 0x1d, 0x12, 0x51, 0x70,
+            0x6f, 0x73, 0x65, 0x28, 0xe6, 0x05, 0x04, 0x39, 0x08, 0x01, 0x7c, 0x0f, 0x07, 0xb3, 0x07, 0x00,
+            0x71, 0x02, 0x13, 0x29, 0x31, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x3c, 0x00, 0x03, 0x51, 0x00, 0x34,
+            0x73, 0x2c, 0x20, 0x42, 0x0a, 0x00, 0x41, 0x0f, 0x04, 0x0c, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x2c,
+            0x00, 0x0f, 0xec, 0x04, 0x0c, 0x00, 0x23, 0x00, 0x06, 0xaa, 0x00, 0x00, 0x0e, 0x00, 0x02, 0xa9,
+            0x00, 0x03, 0xed, 0x04, 0x02, 0x0d, 0x00, 0x04, 0xb6, 0x00, 0x17, 0x2a, 0xe1, 0x0b, 0x04, 0xa3,
+            0x01, 0x01, 0xec, 0x04, 0x03, 0x00, 0x01, 0x00, 0xa7, 0x0b, 0x06, 0x7a, 0x00, 0x00, 0x4d, 0x00,
+            0x34, 0x69, 0x66, 0x28, 0x42, 0x0b, 0x09, 0x1d, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00, 0x0a,
+            0x7b, 0x00, 0x00, 0x12, 0x00, 0x04, 0xc2, 0x00, 0x02, 0x23, 0x05, 0x00, 0xea, 0x00, 0x01, 0x91,
+            0x03, 0x01, 0x72, 0x05, 0x00, 0xa4, 0x02, 0x0f, 0x6e, 0x05, 0x04, 0x04, 0x66, 0x00, 0x0e, 0x83,
+            0x00, 0x00, 0x55, 0x00, 0x05, 0xef, 0x0c, 0x03, 0xd7, 0x00, 0x62, 0x63, 0x72, 0x6f, 0x73, 0x73,
+            0x28, 0xdd, 0x00, 0x00, 0x13, 0x00, 0x06, 0x45, 0x01, 0x20, 0x5b, 0x69, 0x6f, 0x06, 0x00, 0x34,
+            0x00, 0x04, 0x04, 0x00, 0x02, 0xe5, 0x01, 0x00, 0x0e, 0x00, 0x06, 0x0a, 0x00, 0x01, 0x52, 0x02,
+            0x00, 0x96, 0x01, 0x03, 0x76, 0x0c, 0x00, 0x09, 0x0a, 0x02, 0x93, 0x0e, 0x0a, 0x5f, 0x02, 0x0f,
+            0xff, 0x00, 0x09, 0x0a, 0xfb, 0x00, 0x06, 0x52, 0x00, 0x03, 0x01, 0x01, 0x25, 0x20, 0x3d, 0xd9,
+            0x01, 0x0a, 0x54, 0x00, 0x00, 0x8a, 0x00, 0x06, 0x2e, 0x00, 0x05, 0xda, 0x00, 0x20, 0x20, 0x3d,
+            0x73, 0x22, 0x03, 0x93, 0x0e, 0x0a, 0x32, 0x00, 0x02, 0xb8, 0x00, 0xd0, 0x7d, 0x0a, 0x7d, 0x0a,
+            0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x66, 0x6c, 0x61, 0xec, 0x1a, 0x02, 0x97, 0x0d, 0x01, 0x4b,
+            0x00, 0x04, 0x37, 0x08, 0x0f, 0xb1, 0x0e, 0x04, 0x0f, 0x68, 0x08, 0x0b, 0x20, 0x69, 0x6e, 0xfe,
+            0x05, 0x1a, 0x34, 0x32, 0x0e, 0x1a, 0x3b, 0x17, 0x00, 0x01, 0xd2, 0x0e, 0x09, 0x12, 0x00, 0x01,
+            0x82, 0x04, 0x04, 0x26, 0x00, 0x05, 0x58, 0x0e, 0x04, 0x11, 0x00, 0x0f, 0xdb, 0x0e, 0x01, 0x02,
+            0x3f, 0x00, 0x08, 0x1a, 0x00, 0x03, 0x2b, 0x01, 0x0f, 0x35, 0x00, 0x01, 0x05, 0x18, 0x01, 0x14,
+            0x3b, 0x3e, 0x23, 0x01, 0xf2, 0x15, 0x03, 0x4e, 0x18, 0x01, 0x24, 0x23, 0x12, 0x69, 0xed, 0x15,
+            0x02, 0x07, 0x19, 0x05, 0xf3, 0x1d, 0x04, 0x07, 0x19, 0x04, 0xf9, 0x0c, 0x04, 0x1b, 0x01, 0x02,
+            0x2d, 0x00, 0x04, 0x80, 0x18, 0x31, 0x69, 0x73, 0x20, 0x3b, 0x18, 0x00, 0xc1, 0x15, 0x01, 0xe7,
+            0x15, 0x40, 0x6d, 0x61, 0x70, 0x73, 0x47, 0x17, 0x00, 0x1a, 0x19, 0x00, 0x3b, 0x00, 0x21, 0x69,
+            0x74, 0x20, 0x16, 0x10, 0x6e, 0x51, 0x18, 0x12, 0x20, 0x95, 0x14, 0x30, 0x64, 0x2e, 0x20, 0x02,
+            0x1f, 0x00, 0x3e, 0x0a, 0x34, 0x69, 0x64, 0x65, 0x22, 0x00, 0x91, 0x73, 0x74, 0x69, 0x6c, 0x6c,
+            0x20, 0x63, 0x68, 0x65, 0xc5, 0x1a, 0x08, 0x21, 0x15, 0x04, 0x7a, 0x00, 0x01, 0x60, 0x00, 0x02,
+            0x84, 0x24, 0x50, 0x69, 0x73, 0x20, 0x77, 0x68, 0xe2, 0x24, 0x10, 0x65, 0xce, 0x24, 0x00, 0x41,
+            0x08, 0x42, 0x67, 0x72, 0x61, 0x6d, 0x47, 0x16, 0x30, 0x61, 0x6c, 0x6c, 0x02, 0x02, 0x20, 0x73,
+            0x20, 0xca, 0x1c, 0x00, 0xae, 0x14, 0x45, 0x20, 0x61, 0x6e, 0x79, 0x20, 0x0a, 0x10, 0x2e, 0x75,
+            0x17, 0x01, 0x70, 0x24, 0x04, 0x52, 0x19, 0x00, 0x04, 0x01, 0x05, 0x71, 0x24, 0x08, 0x15, 0x00,
+            0x0f, 0x72, 0x24, 0x00, 0x00, 0xd0, 0x1a, 0x03, 0xc0, 0x03, 0x41, 0x28, 0x6d, 0x61, 0x70, 0x6f,
+            0x24, 0x19, 0x28, 0x34, 0x00, 0x16, 0x26, 0x6a, 0x00, 0x02, 0x51, 0x01, 0x0d, 0x58, 0x1a, 0x40,
+            0x29, 0x20, 0x3e, 0x3e, 0x6b, 0x19, 0x0c, 0x95, 0x24, 0x26, 0x2f, 0x2f, 0x96, 0x16, 0x00, 0x1e,
+            0x25, 0x01, 0x45, 0x08, 0x0c, 0x58, 0x14, 0x41, 0x20, 0x6d, 0x61, 0x79, 0x87, 0x18, 0x20, 0x6e,
+            0x67, 0xef, 0x14, 0x55, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x7c, 0x0b, 0x00, 0x39, 0x1f, 0x10, 0x6f,
+            0x50, 0x01, 0x00, 0xf5, 0x18, 0xf0, 0x03, 0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77,
+            0x6e, 0x20, 0x75, 0x76, 0x20, 0x67, 0x72, 0x61, 0x64, 0xee, 0x21, 0x11, 0x73, 0x45, 0x01, 0x01,
+            0x13, 0x21, 0x01, 0xc2, 0x19, 0x24, 0x32, 0x5e, 0x25, 0x26, 0x00, 0x4f, 0x00, 0x51, 0x6d, 0x61,
+            0x74, 0x63, 0x68, 0x68, 0x15, 0x00, 0x16, 0x21, 0x00, 0xbf, 0x01, 0x00, 0xf3, 0x0e, 0xc0, 0x66,
+            0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3e, 0x01, 0x0f, 0xb3, 0x18,
+            0x04, 0x04, 0x96, 0x25, 0xa2, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x32, 0x44, 0x28, 0xef,
+            0x01, 0x40, 0x72, 0x2c, 0x20, 0x63, 0x93, 0x0c, 0x14, 0x29, 0x5b, 0x02, 0x4b, 0x47, 0x72, 0x61,
+            0x64, 0x1c, 0x00, 0x03, 0x67, 0x11, 0x00, 0x46, 0x07, 0x01, 0x1c, 0x0e, 0x44, 0x78, 0x70, 0x32,
+            0x28, 0x99, 0x00, 0x17, 0x29, 0x1d, 0x00, 0x01, 0x2b, 0x0e, 0x09, 0x1d, 0x00, 0x13, 0x29, 0xcc,
+            0x03, 0x0f, 0x7e, 0x00, 0x16, 0x0d, 0x7a, 0x00, 0x05, 0x68, 0x00, 0x04, 0x21, 0x03, 0x0f, 0x13,
+            0x28, 0x03, 0x02, 0xf7, 0x26, 0x04, 0xde, 0x00, 0x30, 0x4d, 0x41, 0x50, 0x01, 0x02, 0x54, 0x2c,
+            0x20, 0x75, 0x76, 0x29, 0x14, 0x00, 0x06, 0xf2, 0x00, 0x20, 0x32, 0x44, 0xfa, 0x0f, 0x01, 0xfb,
+            0x12, 0x18, 0x2e, 0x93, 0x1b, 0x51, 0x6d, 0x61, 0x70, 0x5d, 0x29, 0x34, 0x00, 0x00, 0xb6, 0x00,
+            0x23, 0x69, 0x66, 0x4c, 0x27, 0x20, 0x64, 0x28, 0x35, 0x1d, 0x14, 0x5f, 0x48, 0x02, 0x01, 0xe3,
+            0x1b, 0x14, 0x29, 0x15, 0x16, 0x06, 0xdf, 0x17, 0x07, 0x48, 0x28, 0x03, 0x5a, 0x01, 0x03, 0x97,
+            0x1d, 0x00, 0x4e, 0x02, 0x13, 0x5f, 0x13, 0x00, 0x24, 0x73, 0x5b, 0xc5, 0x1d, 0x02, 0xd2, 0x1f,
+            0x04, 0xc2, 0x21, 0x20, 0x75, 0x6e, 0x0e, 0x02, 0x10, 0x30, 0xe6, 0x01, 0x04, 0x21, 0x00, 0x25,
+            0x2d, 0x31, 0xf7, 0x02, 0x0f, 0xd6, 0x00, 0x0b, 0x00, 0xc3, 0x00, 0x05, 0x5f, 0x00, 0x00, 0xc4,
+            0x00, 0x01, 0xcc, 0x10, 0x56, 0x33, 0x28, 0x75, 0x76, 0x2c, 0xee, 0x02, 0x00, 0x25, 0x00, 0x03,
+            0xb4, 0x1c, 0x00, 0x23, 0x00, 0x05, 0x99, 0x01, 0x03, 0x99, 0x15, 0x0f, 0xc7, 0x00, 0x0b, 0x0f,
+            0xc2, 0x00, 0x60, 0x20, 0x75, 0x76, 0xa2, 0x00, 0x02, 0xbb, 0x29, 0x04, 0x3d, 0x02, 0x06, 0x2e,
+            0x20, 0x05, 0xf1, 0x25, 0x08, 0xf2, 0x03, 0x06, 0x1f, 0x00, 0x15, 0x29, 0x3a, 0x01, 0x09, 0x37,
+            0x20, 0x0f, 0x36, 0x00, 0x02, 0x09, 0x22, 0x00, 0x06, 0x39, 0x00, 0x08, 0x45, 0x20, 0x0f, 0x38,
+            0x00, 0x02, 0x08, 0x21, 0x00, 0x06, 0x37, 0x00, 0x03, 0x62, 0x08, 0x07, 0x97, 0x00, 0x17, 0x20,
+            0x0c, 0x00, 0x04, 0x81, 0x09, 0x09, 0x33, 0x00, 0x0f, 0x55, 0x20, 0x02, 0x0f, 0x73, 0x00, 0x02,
+            0x0f, 0x2a, 0x00, 0x02, 0x06, 0x49, 0x00, 0x03, 0x3d, 0x20, 0x0f, 0x3b, 0x00, 0x02, 0x03, 0x1c,
+            0x00, 0x72, 0x29, 0x0a, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x09, 0x07, 0x32, 0x6f, 0x75, 0x74, 0x43,
+            0x17, 0x11, 0x3b, 0x63, 0x13, 0x12, 0x31, 0xc1, 0x25, 0x30, 0x6c, 0x69, 0x74, 0x7f, 0x1e, 0x01,
+            0xcd, 0x25, 0x51, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0xd0, 0x1c, 0x42, 0x6f, 0x77, 0x65, 0x64, 0xe9,
+            0x03, 0x01, 0xf5, 0x17, 0x00, 0x3f, 0x1b, 0x11, 0x74, 0x8a, 0x04, 0x44, 0x6c, 0x61, 0x73, 0x74,
+            0x40, 0x24, 0x01, 0x4b, 0x06, 0x42, 0x6c, 0x69, 0x74, 0x0a, 0xeb, 0x11, 0x05, 0x6b, 0x26, 0x20,
+            0x61, 0x6c, 0x7c, 0x20, 0x30, 0x6f, 0x77, 0x28, 0x84, 0x0c, 0x05, 0x42, 0x0e, 0x04, 0x49, 0x11,
+            0x02, 0x2d, 0x00, 0x01, 0x57, 0x1b, 0x41, 0x20, 0x3d, 0x20, 0x2d, 0xaf, 0x08, 0x52, 0x70, 0x6f,
+            0x73, 0x2e, 0x7a, 0xa3, 0x09, 0x01, 0x0f, 0x11, 0x03, 0xa1, 0x24, 0x00, 0x50, 0x22, 0x03, 0x7f,
+            0x15, 0x64, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x18, 0x00, 0x13, 0x3c, 0xa5, 0x00, 0x05, 0xf4,
+            0x24, 0x01, 0x01, 0x23, 0x33, 0x20, 0x26, 0x26, 0xd6, 0x1b, 0x1c, 0x3e, 0x20, 0x00, 0x02, 0x14,
+            0x25, 0x13, 0x5b, 0x40, 0x00, 0x12, 0x5d, 0xfc, 0x0b, 0x00, 0xb3, 0x08, 0x03, 0x12, 0x00, 0x22,
+            0x2b, 0x2b, 0x7e, 0x00, 0x25, 0x69, 0x66, 0x64, 0x00, 0x2c, 0x3e, 0x3d, 0x45, 0x00, 0x01, 0x65,
+            0x00, 0x06, 0x3b, 0x00, 0x03, 0x6c, 0x12, 0x32, 0x31, 0x2e, 0x66, 0x3c, 0x00, 0x01, 0xee, 0x00,
+            0x03, 0xe5, 0x25, 0x02, 0xeb, 0x0d, 0x13, 0x28, 0x0e, 0x00, 0x05, 0xf3, 0x25, 0x03, 0x6e, 0x00,
+            0x10, 0x5d, 0x59, 0x0f, 0x00, 0x71, 0x0d, 0x04, 0xfd, 0x00, 0x02, 0x8d, 0x0f, 0x43, 0x29, 0x2e,
+            0x78, 0x79, 0x06, 0x01, 0x03, 0x5c, 0x00, 0x03, 0x2f, 0x04, 0x06, 0x48, 0x00, 0x02, 0xb8, 0x14,
+            0x14, 0x34, 0x11, 0x00, 0x00, 0x38, 0x01, 0x34, 0x78, 0x79, 0x2c, 0x91, 0x01, 0x14, 0x2c, 0xb2,
+            0x00, 0x00, 0x18, 0x00, 0x10, 0x7a, 0x9b, 0x0b, 0x02, 0x4e, 0x15, 0xf1, 0x01, 0x74, 0x65, 0x6d,
+            0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x20, 0x70, 0x68, 0x6f, 0x6e, 0x67, 0x2d, 0x4f, 0x1d, 0x01,
+            0x43, 0x25, 0x62, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x4c, 0x55, 0x25, 0x40, 0x73, 0x20, 0x74, 0x6f,
+            0x5a, 0x06, 0x02, 0x53, 0x08, 0x01, 0x1f, 0x00, 0x02, 0x17, 0x13, 0x22, 0x41, 0x64, 0xf5, 0x25,
+            0x02, 0xd0, 0x01, 0x12, 0x4c, 0x6f, 0x04, 0x10, 0x20, 0xc3, 0x06, 0x00, 0x6e, 0x12, 0x03, 0x0f,
+            0x00, 0x13, 0x4e, 0x08, 0x00, 0x23, 0x56, 0x2c, 0xe2, 0x01, 0x05, 0x2f, 0x22, 0x04, 0x11, 0x00,
+            0x04, 0x27, 0x22, 0x00, 0xb4, 0x20, 0x03, 0x95, 0x02, 0x11, 0x33, 0x34, 0x1e, 0x39, 0x75, 0x73,
+            0x65, 0x14, 0x00, 0x00, 0x77, 0x1e, 0x4b, 0x75, 0x6c, 0x61, 0x72, 0x32, 0x02, 0x11, 0x46, 0x04,
+            0x15, 0xc0, 0x61, 0x6d, 0x70, 0x28, 0x64, 0x6f, 0x74, 0x28, 0x4e, 0x2c, 0x20, 0x4c, 0x54, 0x13,
+            0x00, 0x9a, 0x0f, 0x06, 0xca, 0x10, 0x03, 0x4f, 0x00, 0x85, 0x20, 0x2b, 0x3d, 0x20, 0x64, 0x46,
+            0x20, 0x2a, 0xa5, 0x00, 0x00, 0x0b, 0x00, 0x04, 0xbf, 0x22, 0x07, 0xae, 0x01, 0xa5, 0x68, 0x61,
+            0x6c, 0x66, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2b, 0x0b, 0x93, 0x69, 0x7a, 0x65, 0x28, 0x56,
+            0x20, 0x2b, 0x20, 0x4c, 0xd9, 0x0c, 0x02, 0xcd, 0x00, 0x10, 0x73, 0x7d, 0x00, 0x49, 0x70, 0x6f,
+            0x77, 0x28, 0x81, 0x00, 0x06, 0x3f, 0x00, 0x08, 0x8a, 0x00, 0x95, 0x2c, 0x20, 0x32, 0x35, 0x36,
+            0x2e, 0x66, 0x20, 0x2a, 0xf2, 0x00, 0x03, 0x4b, 0x00, 0x04, 0xd8, 0x00, 0x00, 0x9e, 0x00, 0x1b,
+            0x73, 0x9e, 0x00, 0x40, 0x28, 0x31, 0x2e, 0x30, 0xe3, 0x14, 0x05, 0x36, 0x01, 0x07, 0x97, 0x14,
+            0x41, 0x6d, 0x61, 0x69, 0x6e, 0x88, 0x14, 0x03, 0x0b, 0x07, 0x0f, 0xa1, 0x20, 0x00, 0x00, 0xcb,
+            0x02, 0x0f, 0xbe, 0x14, 0x02, 0x07, 0xed, 0x00, 0x04, 0x6d, 0x02, 0x02, 0x56, 0x0e, 0x01, 0x61,
+            0x0b, 0x07, 0x13, 0x00, 0x0f, 0x29, 0x00, 0x02, 0x00, 0x5e, 0x0e, 0x0b, 0x29, 0x00, 0x03, 0x64,
+            0x0e, 0x00, 0x5a, 0x0f, 0x12, 0x20, 0x21, 0x08, 0x12, 0x3d, 0x63, 0x0b, 0x01, 0x0d, 0x00, 0x05,
+            0x46, 0x00, 0x00, 0x49, 0x0f, 0x02, 0x89, 0x10, 0x01, 0x40, 0x00, 0x00, 0x1d, 0x00, 0x10, 0x79,
+            0xf4, 0x0a, 0x00, 0xe9, 0x0b, 0x00, 0xad, 0x00, 0x01, 0x2d, 0x03, 0x07, 0x7f, 0x00, 0x00, 0x52,
+            0x14, 0x31, 0x46, 0x64, 0x78, 0x63, 0x02, 0x11, 0x28, 0x33, 0x00, 0x04, 0x1d, 0x00, 0x00, 0xc7,
+            0x02, 0x0f, 0x32, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x09, 0x20, 0x0f, 0x32, 0x00, 0x0b, 0x02,
+            0x87, 0x00, 0x00, 0xd9, 0x0e, 0x00, 0x3e, 0x20, 0x02, 0x59, 0x00, 0x23, 0x75, 0x76, 0x90, 0x01,
+            0x05, 0xc4, 0x00, 0x05, 0x4c, 0x00, 0x01, 0x79, 0x00, 0x01, 0x20, 0x00, 0x03, 0x47, 0x30, 0x03,
+            0x79, 0x00, 0x21, 0x34, 0x20, 0x18, 0x0c, 0x04, 0xeb, 0x00, 0x01, 0x0d, 0x00, 0x05, 0xeb, 0x00,
+            0x03, 0x7e, 0x28, 0x02, 0xb7, 0x0d, 0x00, 0xe5, 0x19, 0x06, 0x03, 0x0c, 0x03, 0x0e, 0x00, 0x05,
+            0xf6, 0x0b, 0x73, 0x2c, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x9f, 0x0d, 0x03, 0x88, 0x11, 0x0f,
+            0xa9, 0x0f, 0x0e, 0x01, 0x0a, 0x01, 0x02, 0x5f, 0x00, 0x09, 0xa7, 0x02, 0x01, 0xae, 0x00, 0x07,
+            0x1d, 0x00, 0x03, 0xd7, 0x00, 0x02, 0x58, 0x0d, 0x01, 0x53, 0x0d, 0x00, 0xbf, 0x00, 0x00, 0x04,
+            0x00, 0x07, 0x25, 0x00, 0x09, 0x42, 0x00, 0x02, 0x71, 0x0e, 0x01, 0x1e, 0x00, 0x01, 0x4f, 0x1b,
+            0x13, 0x78, 0xb1, 0x00, 0x01, 0x0d, 0x00, 0x10, 0x79, 0x7a, 0x01, 0x01, 0xe6, 0x12, 0x0e, 0x30,
+            0x0e, 0x00, 0x6b, 0x05, 0x03, 0xfc, 0x06, 0x03, 0x81, 0x0b, 0x02, 0x18, 0x05, 0x06, 0x3e, 0x0e,
+            0x01, 0x55, 0x00, 0x03, 0x07, 0x01, 0x09, 0x74, 0x00, 0x06, 0xb6, 0x00, 0x03, 0x1e, 0x00, 0x03,
+            0xb7, 0x00, 0x05, 0xa8, 0x00, 0x05, 0x2e, 0x01, 0x0f, 0x37, 0x00, 0x04, 0x05, 0x20, 0x00, 0x03,
+            0x39, 0x00, 0x0b, 0xf0, 0x00, 0x0f, 0x83, 0x00, 0x10, 0x0c, 0xf7, 0x00, 0x13, 0x79, 0xf7, 0x00,
+            0x02, 0x64, 0x01, 0x00, 0xcf, 0x0f, 0x00, 0xb0, 0x02, 0x11, 0x78, 0x34, 0x18, 0x07, 0x2c, 0x00,
+            0x02, 0x1f, 0x00, 0x03, 0x2c, 0x00, 0x01, 0x23, 0x01, 0x01, 0xc2, 0x18, 0x00, 0x2c, 0x00, 0x24,
+            0x79, 0x2e, 0x8b, 0x13, 0x0f, 0xc7, 0x00, 0x02, 0x0f, 0x45, 0x00, 0x05, 0x0a, 0x02, 0x01, 0x02,
+            0xc9, 0x00, 0x00, 0x5c, 0x10, 0x42, 0x20, 0x54, 0x42, 0x4e, 0xde, 0x0e, 0x02, 0x67, 0x10, 0x0f,
+            0x50, 0x02, 0x07, 0x01, 0x67, 0x01, 0x02, 0x99, 0x00, 0x03, 0x0f, 0x01, 0x06, 0x4f, 0x02, 0x07,
+            0x8a, 0x08, 0x0d, 0x9e, 0x01, 0x00, 0x73, 0x2e, 0x02, 0x37, 0x00, 0x10, 0x5f, 0x2b, 0x0a, 0x02,
+            0x50, 0x0a, 0x24, 0x20, 0x3d, 0x3d, 0x0b, 0x00, 0x51, 0x0b, 0x03, 0xe0, 0x01, 0x32, 0x4d, 0x41,
+            0x50, 0x0a, 0x08, 0x37, 0x5f, 0x75, 0x76, 0xa2, 0x06, 0x00, 0xe8, 0x00, 0x0f, 0x41, 0x00, 0x01,
+            0x0e, 0x14, 0x00, 0x11, 0x2a, 0x1b, 0x16, 0x07, 0xe0, 0x15, 0x00, 0x3b, 0x00, 0x08, 0x08, 0x03,
+            0x09, 0xe8, 0x01, 0x02, 0x40, 0x00, 0x00, 0x86, 0x05, 0x00, 0x04, 0x01, 0x13, 0x2a, 0x50, 0x12,
+            0x07, 0xa5, 0x00, 0x00, 0x9f, 0x01, 0x04, 0x84, 0x0e, 0x12, 0x2e, 0x2e, 0x00, 0x00, 0x42, 0x28,
+            0x00, 0xed, 0x15, 0x00, 0x17, 0x17, 0x02, 0x12, 0x00, 0x32, 0x20, 0x2a, 0x20, 0xaa, 0x05, 0x02,
+            0x39, 0x1a, 0x0f, 0x30, 0x00, 0x00, 0x01, 0x0e, 0x16, 0x03, 0x78, 0x07, 0x02, 0xcb, 0x03, 0x02,
+            0x7f, 0x01, 0x09, 0x38, 0x03, 0x0b, 0xa6, 0x00, 0x07, 0x6d, 0x01, 0x06, 0xbc, 0x03, 0x0f, 0x52,
+            0x14, 0x07, 0x27, 0x69, 0x66, 0xa4, 0x0a, 0x04, 0xa7, 0x09, 0x02, 0x8a, 0x01, 0x00, 0x03, 0x01,
+            0x00, 0x04, 0x00, 0x01, 0x4a, 0x04, 0x29, 0x20, 0x2a, 0x78, 0x01, 0x06, 0x34, 0x00, 0x06, 0x78,
+            0x01, 0x08, 0xa2, 0x00, 0x05, 0x34, 0x00, 0x05, 0xd6, 0x00, 0x01, 0x12, 0x00, 0x00, 0x05, 0x01,
+            0x02, 0x27, 0x00, 0x02, 0xb3, 0x06, 0x05, 0x4a, 0x06, 0x02, 0x49, 0x02, 0x02, 0xff, 0x0c, 0x05,
+            0x15, 0x00, 0x0c, 0x2e, 0x00, 0x04, 0xab, 0x06, 0x08, 0x2d, 0x00, 0x04, 0x14, 0x00, 0x0c, 0x2c,
+            0x00, 0x03, 0xab, 0x30, 0x06, 0xd8, 0x29, 0x08, 0x35, 0x00, 0x0d, 0x1d, 0x00, 0x06, 0x3e, 0x00,
+            0x24, 0x69, 0x66, 0x98, 0x0a, 0x05, 0x0d, 0x01, 0x00, 0x96, 0x29, 0x03, 0x29, 0x2b, 0x00, 0xe1,
+            0x2e, 0x63, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0xef, 0x26, 0xd3, 0x73, 0x65, 0x70, 0x61, 0x72,
+            0x61, 0x74, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x4d, 0x10, 0x63, 0x20, 0x73, 0x69, 0x6e, 0x67,
+            0x6c, 0xe1, 0x26, 0x01, 0x9c, 0x04, 0x07, 0xef, 0x03, 0x00, 0xd4, 0x02, 0x00, 0xd7, 0x35, 0x09,
+            0x4e, 0x01, 0x03, 0x72, 0x00, 0x06, 0x4b, 0x01, 0x33, 0x2e, 0x72, 0x67, 0x51, 0x16, 0x00, 0x81,
+            0x01, 0x0d, 0xaf, 0x00, 0x00, 0x8d, 0x01, 0x43, 0x6f, 0x72, 0x6d, 0x2e, 0x60, 0x31, 0x00, 0x24,
+            0x00, 0x05, 0x35, 0x01, 0x04, 0x1c, 0x00, 0x12, 0x67, 0x68, 0x01, 0x00, 0x1c, 0x00, 0x04, 0x24,
+            0x01, 0x04, 0x1b, 0x00, 0x03, 0x5b, 0x00, 0x0b, 0x4c, 0x02, 0x06, 0xa5, 0x00, 0x2a, 0x69, 0x66,
+            0x82, 0x0c, 0x05, 0x0a, 0x01, 0x01, 0xcd, 0x00, 0x00, 0x52, 0x00, 0x06, 0x2c, 0x00, 0x00, 0x0e,
+            0x00, 0x09, 0x7c, 0x00, 0x07, 0x18, 0x0e, 0x09, 0x45, 0x00, 0x08, 0xdd, 0x00, 0x06, 0x9b, 0x00,
+            0x02, 0x84, 0x00, 0x00, 0x45, 0x00, 0x29, 0x69, 0x66, 0xbf, 0x0c, 0x0f, 0x74, 0x00, 0x0d, 0x08,
+            0xd4, 0x00, 0x07, 0x73, 0x00, 0x08, 0x43, 0x00, 0x0f, 0x72, 0x00, 0x10, 0x0f, 0xbe, 0x0c, 0x02,
+            0x0f, 0x7b, 0x00, 0x0d, 0x0f, 0x8f, 0x01, 0x02, 0x07, 0x84, 0x00, 0x0f, 0x55, 0x00, 0x02, 0x0f,
+            0x8d, 0x00, 0x09, 0x12, 0x7d, 0x71, 0x1c, 0x01, 0x6f, 0x08, 0x10, 0x56, 0x70, 0x0c, 0x02, 0x20,
+            0x04, 0x00, 0x60, 0x04, 0x00, 0x14, 0x00, 0x02, 0x12, 0x08, 0x01, 0xd8, 0x03, 0x30, 0x70, 0x6f,
+            0x73, 0xf1, 0x06, 0x00, 0x30, 0x01, 0x00, 0x1a, 0x00, 0x32, 0x20, 0x64, 0x4c, 0x6a, 0x18, 0x17,
+            0x33, 0x41, 0x18, 0x01, 0x19, 0x00, 0x1f, 0x73, 0x19, 0x00, 0x00, 0x02, 0x73, 0x03, 0x02, 0xef,
+            0x0b, 0x1f, 0x20, 0x39, 0x0c, 0x03, 0x8f, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x20, 0x3f, 0x28,
+            0x0d, 0x04, 0x0c, 0x8a, 0x00, 0x26, 0x20, 0x3a, 0x11, 0x1b, 0x06, 0x81, 0x0b, 0x00, 0xe2, 0x04,
+            0x01, 0x9a, 0x0b, 0x05, 0x45, 0x00, 0x03, 0x03, 0x30, 0x01, 0x39, 0x25, 0x23, 0x20, 0x2a, 0x01,
+            0x0c, 0x0a, 0x68, 0x08, 0x40, 0x2c, 0x20, 0x56, 0x2c, 0x98, 0x27, 0x04, 0xa3, 0x2e, 0x04, 0xe0,
+            0x01, 0x74, 0x2c, 0x20, 0x64, 0x4c, 0x2c, 0x20, 0x73, 0xea, 0x0a, 0x00, 0xfc, 0x0c, 0x02, 0xe5,
+            0x31, 0x01, 0x08, 0x34, 0x22, 0x2e, 0x7a, 0xb2, 0x00, 0x02, 0xb1, 0x04, 0x06, 0x96, 0x02, 0x01,
+            0x04, 0x01, 0x04, 0x32, 0x01, 0x04, 0x23, 0x01, 0x06, 0xd5, 0x07, 0x00, 0x47, 0x01, 0x06, 0x84,
+            0x02, 0x01, 0xce, 0x0d, 0x01, 0xf9, 0x33, 0x00, 0xe7, 0x18, 0xc7, 0x69, 0x6e, 0x74, 0x28, 0x6d,
+            0x61, 0x78, 0x28, 0x6c, 0x6f, 0x67, 0x28, 0xf9, 0x0d, 0x00, 0xd2, 0x05, 0x00, 0x4b, 0x2f, 0x00,
+            0x82, 0x34, 0x01, 0x2c, 0x00, 0x02, 0x25, 0x34, 0x25, 0x20, 0x2b, 0xf5, 0x30, 0x02, 0x16, 0x00,
+            0x00, 0x06, 0x13, 0x01, 0xb7, 0x05, 0x04, 0xa8, 0x01, 0x00, 0xac, 0x01, 0x01, 0x3a, 0x1e, 0x50,
+            0x20, 0x63, 0x65, 0x6c, 0x6c, 0x86, 0x04, 0x31, 0x69, 0x6e, 0x28, 0x11, 0x00, 0x01, 0x06, 0x00,
+            0x0e, 0x84, 0x1f, 0x01, 0x17, 0x06, 0x06, 0xeb, 0x34, 0x00, 0xa0, 0x21, 0x17, 0x2f, 0xae, 0x39,
+            0x12, 0x2c, 0xe3, 0x34, 0x10, 0x29, 0x95, 0x1d, 0x06, 0x26, 0x00, 0x20, 0x20, 0x2d, 0xa7, 0x38,
+            0x07, 0xd4, 0x00, 0x01, 0x38, 0x0a, 0x03, 0xb1, 0x00, 0x01, 0x94, 0x0c, 0x01, 0x2c, 0x00, 0x20,
+            0x73, 0x5b, 0x85, 0x00, 0x02, 0x34, 0x08, 0x08, 0x47, 0x01, 0x00, 0x42, 0x13, 0x11, 0x28, 0x1b,
+            0x00, 0x00, 0x77, 0x20, 0x03, 0x37, 0x00, 0x02, 0x62, 0x01, 0x00, 0x40, 0x13, 0x01, 0x1a, 0x00,
+            0x23, 0x7a, 0x29, 0x66, 0x1f, 0x00, 0xd2, 0x00, 0x00, 0x1b, 0x19, 0x01, 0x38, 0x01, 0x00, 0x08,
+            0x1e, 0x03, 0x30, 0x00, 0x22, 0x2e, 0x78, 0x10, 0x1e, 0x05, 0x0f, 0x00, 0x06, 0x1d, 0x01, 0x27,
+            0x2e, 0x79, 0x24, 0x1e, 0x00, 0x40, 0x00, 0x06, 0xab, 0x01, 0x00, 0x0e, 0x00, 0x01, 0xde, 0x31,
+            0x00, 0xb2, 0x29, 0x03, 0x2b, 0x32, 0x12, 0x3d, 0x08, 0x00, 0x23, 0x73, 0x5b, 0x4b, 0x00, 0x0b,
+            0xdf, 0x31, 0x27, 0x69, 0x5d, 0x8a, 0x00, 0x00, 0x40, 0x00, 0x01, 0xef, 0x01, 0x00, 0xf2, 0x02,
+            0x01, 0x77, 0x02, 0x14, 0x2e, 0xf9, 0x01, 0x01, 0x86, 0x1c, 0x25, 0x20, 0x2d, 0xde, 0x0f, 0x06,
+            0x1f, 0x01, 0x00, 0x35, 0x00, 0x02, 0x0f, 0x03, 0x40, 0x64, 0x69, 0x73, 0x74, 0xff, 0x21, 0x00,
+            0xaf, 0x0d, 0x10, 0x4c, 0xaf, 0x0d, 0x0f, 0x25, 0x00, 0x01, 0x01, 0x11, 0x34, 0x00, 0x26, 0x00,
+            0x02, 0x60, 0x00, 0x01, 0x0f, 0x00, 0x22, 0x20, 0x2a, 0xa5, 0x00, 0x02, 0x0e, 0x00, 0x0a, 0x36,
+            0x00, 0x32, 0x69, 0x66, 0x28, 0x58, 0x00, 0x31, 0x3e, 0x3d, 0x20, 0x1f, 0x00, 0x12, 0x32, 0xa1,
+            0x02, 0x00, 0x77, 0x00, 0x04, 0x04, 0x00, 0x73, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x68,
+            0x34, 0x04, 0x16, 0x00, 0x10, 0x4c, 0xa4, 0x05, 0x03, 0xcc, 0x1a, 0x42, 0x73, 0x71, 0x72, 0x74,
+            0x48, 0x00, 0x03, 0x36, 0x09, 0x04, 0x25, 0x00, 0x24, 0x2f, 0x2f, 0xb0, 0x23, 0x40, 0x20, 0x73,
+            0x71, 0x75, 0x5c, 0x2e, 0xb1, 0x66, 0x61, 0x6c, 0x6c, 0x6f, 0x66, 0x66, 0x20, 0x77, 0x69, 0x6e,
+            0x17, 0x11, 0x00, 0xb4, 0x13, 0x11, 0x72, 0x47, 0x35, 0x40, 0x7a, 0x65, 0x72, 0x6f, 0x79, 0x24,
+            0x00, 0x96, 0x15, 0x01, 0xbe, 0x00, 0x22, 0x27, 0x73, 0x93, 0x00, 0x05, 0xcc, 0x05, 0x00, 0x56,
+            0x00, 0x02, 0x0c, 0x01, 0x02, 0x3e, 0x00, 0x01, 0x2e, 0x02, 0x00, 0x41, 0x0e, 0x02, 0x97, 0x08,
+            0x02, 0x82, 0x00, 0x00, 0x2b, 0x20, 0x00, 0x2a, 0x01, 0x52, 0x29, 0x20, 0x2f, 0x20, 0x28, 0xd3,
+            0x00, 0x00, 0xaf, 0x0e, 0x00, 0x34, 0x19, 0x18, 0x32, 0x58, 0x0e, 0x0a, 0x08, 0x01, 0x02, 0x57,
+            0x00, 0x64, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x75, 0x1d, 0x2c, 0x03, 0x65, 0x00, 0x13, 0x2a, 0xac,
+            0x00, 0x00, 0x50, 0x00, 0x02, 0x2c, 0x01, 0x10, 0x2b, 0x4c, 0x04, 0x0b, 0xea, 0x00, 0x31, 0x69,
+            0x66, 0x28, 0xb5, 0x00, 0x15, 0x2e, 0x22, 0x35, 0x01, 0x72, 0x35, 0x50, 0x20, 0x3e, 0x3d, 0x20,
+            0x2d, 0x51, 0x0f, 0x09, 0xc5, 0x00, 0x00, 0xc9, 0x00, 0x08, 0x6c, 0x00, 0xdf, 0x2a, 0x3d, 0x20,
+            0x73, 0x6d, 0x6f, 0x6f, 0x74, 0x68, 0x73, 0x74, 0x65, 0x70, 0x48, 0x00, 0x02, 0x03, 0x98, 0x04,
+            0x06, 0x5e, 0x00, 0x01, 0x80, 0x35, 0x11, 0x2c, 0x0d, 0x02, 0x24, 0x2d, 0x4c, 0x1e, 0x00, 0x01,
+            0x4f, 0x02, 0x05, 0xb8, 0x35, 0x08, 0xd8, 0x03, 0x00, 0x72, 0x00, 0x05, 0xf8, 0x04, 0x05, 0x30,
+            0x00, 0x01, 0xea, 0x08, 0x20, 0x20, 0x2a, 0xd1, 0x3c, 0x04, 0xf8, 0x00, 0x0f, 0xec, 0x04, 0x22,
+            0x00, 0x5e, 0x00, 0x02, 0x20, 0x07, 0x02, 0x06, 0x00, 0x01, 0xe6, 0x02, 0x10, 0x61, 0xe7, 0x02,
+            0x03, 0x82, 0x06, 0x01, 0x37, 0x03, 0x00, 0x69, 0x00, 0x0c, 0xec, 0x08, 0x02, 0x86, 0x01, 0x05,
+            0x4c, 0x13, 0x02, 0x01, 0x05, 0x90, 0x34, 0x28, 0x73, 0x4c, 0x20, 0x2b, 0x20, 0x28, 0x64, 0x06,
+            0x00, 0x20, 0x61, 0x4c, 0xd1, 0x04, 0x00, 0x52, 0x00, 0x11, 0x28, 0xaf, 0x00, 0x00, 0x4f, 0x04,
+            0xb0, 0x6f, 0x6c, 0x6f, 0x72, 0x2e, 0x61, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_4[] = {
+            0xf5, 0x18, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x23,
+            0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x56, 0x49, 0x53, 0x49, 0x42, 0x49, 0x4c, 0x49, 0x54,
+            0x59, 0x5f, 0x52, 0x45, 0x53, 0x4f, 0x4c, 0x56, 0x45, 0x1b, 0x00, 0xf2, 0x0a, 0x42, 0x52, 0x44,
+            0x46, 0x5f, 0x54, 0x45, 0x58, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x41, 0x52, 0x52, 0x41, 0x59, 0x0a,
+            0x23, 0x69, 0x66, 0x64, 0x65, 0x66, 0x1a, 0x00, 0xf1, 0x00, 0x42, 0x49, 0x4e, 0x44, 0x4c, 0x45,
+            0x53, 0x53, 0x0a, 0x23, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x5a, 0x00, 0xf0, 0x2a, 0x47, 0x4c, 0x5f,
+            0x41, 0x52, 0x42, 0x5f, 0x62, 0x69, 0x6e, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x65, 0x78,
+            0x74, 0x75, 0x72, 0x65, 0x20, 0x3a, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x0a, 0x23,
+            0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74,
+            0x64, 0x31, 0x34, 0x30, 0x2c, 0x20, 0x32, 0x00, 0xf2, 0x0b, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20,
+            0x30, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e, 0x65,
+            0x72, 0x61, 0x6c, 0x55, 0x10, 0x00, 0xf0, 0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+            0x6d, 0x61, 0x74, 0x34, 0x20, 0x69, 0x6e, 0xce, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77,
+            0x3b, 0x17, 0x00, 0x0b, 0x0f, 0x00, 0xa2, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f,
+            0x6e, 0x24, 0x00, 0xc6, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+            0x16, 0x00, 0xf3, 0x39, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62, 0x69,
+            0x61, 0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e,
+            0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a,
+            0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x69,
+            0x6d, 0x65, 0x20, 0x62, 0x79, 0x20, 0x53, 0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xd2, 0x43,
+            0x61, 0x63, 0x68, 0x65, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x67, 0x01, 0x10, 0x73,
+            0x51, 0x00, 0xf1, 0x20, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20,
+            0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74,
+            0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64,
+            0x20, 0x6f, 0x66, 0x21, 0x00, 0x70, 0x6d, 0x65, 0x73, 0x68, 0x20, 0x62, 0x65, 0x1b, 0x01, 0x50,
+            0x64, 0x72, 0x61, 0x77, 0x6e, 0x82, 0x01, 0x10, 0x6e, 0x83, 0x01, 0x07, 0x4d, 0x00, 0x05, 0xb1,
+            0x01, 0x07, 0x14, 0x00, 0x34, 0x20, 0x30, 0x75, 0x6b, 0x01, 0x04, 0xea, 0x01, 0x03, 0x1e, 0x00,
+            0xf3, 0x01, 0x45, 0x4e, 0x41, 0x42, 0x4c, 0x45, 0x44, 0x28, 0x69, 0x64, 0x78, 0x29, 0x20, 0x28,
+            0x28, 0x28, 0x17, 0x00, 0x01, 0x96, 0x00, 0x31, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26, 0x20,
+            0x31, 0x75, 0x29, 0x20, 0x3d, 0x3d, 0x07, 0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73,
+            0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7, 0x01,
+            0x18, 0x3b, 0x18, 0x00, 0x53, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20, 0x2b,
+            0x28, 0x00, 0x09, 0x24, 0x00, 0x27, 0x55, 0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23, 0x00,
+            0x67, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00, 0x77,
+            0x54, 0x41, 0x4e, 0x47, 0x45, 0x4e, 0x54, 0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00, 0xf7,
+            0x03, 0x49, 0x4e, 0x53, 0x54, 0x41, 0x4e, 0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46,
+            0x4f, 0x52, 0x4d, 0x34, 0x00, 0x07, 0x46, 0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e, 0x56,
+            0x45, 0x52, 0x53, 0x3d, 0x00, 0x3f, 0x34, 0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00, 0x03,
+            0x65, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00, 0x02,
+            0x09, 0x47, 0x00, 0x38, 0x4e, 0x45, 0x58, 0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00, 0x30,
+            0x3b, 0x0a, 0x0a, 0x5e, 0x02, 0x90, 0x77, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x7d,
+            0x01, 0x25, 0x2c, 0x20, 0xf5, 0x00, 0x2d, 0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e, 0x64,
+            0x20, 0x43, 0x00, 0xf3, 0x00, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e, 0x61,
+            0x62, 0x6c, 0x65, 0x64, 0xd6, 0x01, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31, 0x02,
+            0x33, 0x20, 0x3d, 0x20, 0x2b, 0x02, 0x03, 0x11, 0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44,
+            0x58, 0x29, 0xb4, 0x00, 0x01, 0x36, 0x00, 0x24, 0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02,
+            0xd0, 0x01, 0x0a, 0x30, 0x00, 0x03, 0xbf, 0x01, 0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d,
+            0x68, 0x00, 0x04, 0xc3, 0x01, 0x0f, 0x39, 0x00, 0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x0f,
+            0x72, 0x04, 0x07, 0x17, 0x31, 0x72, 0x04, 0x5b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x70, 0x04, 0xd0,
+            0x76, 0x65, 0x63, 0x33, 0x20, 0x61, 0x6d, 0x62, 0x69, 0x65, 0x6e, 0x74, 0x4c, 0x20, 0x00, 0x03,
+            0x4c, 0x04, 0x00, 0x11, 0x03, 0x52, 0x5f, 0x70, 0x61, 0x64, 0x31, 0x10, 0x00, 0x01, 0x27, 0x00,
+            0x01, 0x40, 0x00, 0x52, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x15, 0x00, 0x02, 0x5b, 0x04, 0x00, 0x26,
+            0x00, 0x12, 0x32, 0x11, 0x00, 0x01, 0x26, 0x00, 0x00, 0xa6, 0x04, 0x11, 0x5f, 0x2b, 0x00, 0x38,
+            0x44, 0x69, 0x72, 0xa0, 0x04, 0x06, 0x2f, 0x00, 0x12, 0x33, 0x2f, 0x00, 0x00, 0xb1, 0x04, 0xf1,
+            0x0e, 0x33, 0x20, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x3b,
+            0x20, 0x2f, 0x2f, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x78, 0x2c, 0x20, 0x79, 0xcc, 0x01,
+            0xf4, 0x0a, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x73, 0x2c, 0x20,
+            0x7a, 0x20, 0x69, 0x73, 0x20, 0x30, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x3a, 0x00, 0x31, 0x65, 0x64,
+            0x20, 0x6f, 0x00, 0x02, 0xcd, 0x04, 0x31, 0x6f, 0x66, 0x66, 0x32, 0x05, 0x02, 0x6e, 0x00, 0x04,
+            0x5d, 0x00, 0x01, 0x3f, 0x00, 0x62, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x7c, 0x00, 0x0f, 0x1f,
+            0x00, 0x01, 0x02, 0x21, 0x05, 0x00, 0x86, 0x05, 0x01, 0x10, 0x04, 0xf1, 0x05, 0x73, 0x68, 0x61,
+            0x64, 0x6f, 0x77, 0x5f, 0x63, 0x61, 0x73, 0x63, 0x61, 0x64, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e,
+            0x74, 0xa1, 0x00, 0x03, 0x7f, 0x00, 0x02, 0x20, 0x00, 0x06, 0x76, 0x00, 0x21, 0x7d, 0x3b, 0xac,
+            0x02, 0x14, 0x64, 0xf6, 0x00, 0x22, 0x61, 0x6c, 0x98, 0x00, 0x04, 0x29, 0x00, 0x72, 0x2c, 0x20,
+            0x73, 0x65, 0x65, 0x20, 0x43, 0x4f, 0x00, 0x10, 0x64, 0x56, 0x05, 0x63, 0x6f, 0x77, 0x4d, 0x61,
+            0x70, 0x73, 0x96, 0x02, 0x01, 0x74, 0x00, 0xff, 0x09, 0x4d, 0x41, 0x58, 0x5f, 0x53, 0x48, 0x41,
+            0x44, 0x4f, 0x57, 0x5f, 0x43, 0x41, 0x53, 0x43, 0x41, 0x44, 0x45, 0x53, 0x20, 0x3d, 0x20, 0x34,
+            0x3b, 0xe1, 0x01, 0x07, 0x17, 0x32, 0xe1, 0x01, 0x02, 0x69, 0x00, 0x0b, 0xe2, 0x01, 0x01, 0x52,
+            0x06, 0x02, 0x1a, 0x00, 0x50, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x48, 0x01, 0x1f, 0x5b, 0x68, 0x00,
+            0x00, 0x11, 0x5d, 0xdc, 0x00, 0x00, 0xbe, 0x01, 0x93, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20,
+            0x74, 0x6f, 0xba, 0x00, 0x54, 0x20, 0x6d, 0x61, 0x70, 0x20, 0xee, 0x06, 0x01, 0x1c, 0x00, 0x01,
+            0x62, 0x01, 0x43, 0x76, 0x65, 0x63, 0x34, 0x22, 0x00, 0x05, 0x25, 0x01, 0x61, 0x73, 0x70, 0x6c,
+            0x69, 0x74, 0x73, 0x4a, 0x00, 0x32, 0x66, 0x61, 0x72, 0x4e, 0x00, 0x02, 0xc1, 0x01, 0x83, 0x6f,
+            0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x4f, 0x01, 0x00, 0x88, 0x06, 0x00, 0xda, 0x03, 0x03,
+            0xa1, 0x01, 0x50, 0x65, 0x64, 0x20, 0x70, 0x6f, 0x74, 0x02, 0x00, 0xbe, 0x03, 0x42, 0x73, 0x70,
+            0x6f, 0x74, 0x3b, 0x01, 0x04, 0x34, 0x01, 0x02, 0x23, 0x02, 0x21, 0x65, 0x64, 0xa2, 0x02, 0xb1,
+            0x69, 0x6e, 0x67, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x10, 0x00, 0x43, 0x44, 0x61,
+            0x74, 0x61, 0x3e, 0x07, 0x06, 0x81, 0x02, 0x4c, 0x70, 0x6f, 0x73, 0x69, 0x05, 0x07, 0x43, 0x72,
+            0x61, 0x6e, 0x67, 0xff, 0x01, 0x01, 0x29, 0x00, 0x1c, 0x63, 0xcb, 0x02, 0x00, 0x79, 0x00, 0xa1,
+            0x5f, 0x63, 0x6f, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x65, 0x72, 0xc6, 0x00, 0xc3, 0x62, 0x65, 0x6c,
+            0x6f, 0x77, 0x20, 0x2d, 0x31, 0x20, 0x66, 0x6f, 0x72, 0xa3, 0x00, 0x02, 0x6d, 0x02, 0x04, 0x03,
+            0x01, 0x11, 0x33, 0xe5, 0x00, 0x15, 0x5f, 0xf6, 0x01, 0x08, 0x5f, 0x02, 0x05, 0x50, 0x00, 0x51,
+            0x69, 0x6e, 0x6e, 0x65, 0x72, 0x7c, 0x07, 0x06, 0x1b, 0x08, 0x29, 0x34, 0x33, 0x1b, 0x08, 0xf3,
+            0x05, 0x31, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66,
+            0x66, 0x65, 0x72, 0x20, 0x5f, 0x1d, 0x01, 0x01, 0xe6, 0x00, 0x04, 0x21, 0x08, 0x01, 0x0d, 0x00,
+            0x00, 0xf3, 0x00, 0x03, 0x22, 0x01, 0x2f, 0x5b, 0x5d, 0x58, 0x00, 0x0b, 0x1f, 0x32, 0x58, 0x00,
+            0x07, 0x04, 0x53, 0x00, 0x00, 0x88, 0x03, 0x14, 0x32, 0x4e, 0x03, 0x22, 0x73, 0x5b, 0x09, 0x02,
+            0xb4, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x1b, 0x00, 0x02, 0xd6,
+            0x03, 0x40, 0x5f, 0x69, 0x6e, 0x64, 0x44, 0x02, 0x12, 0x2c, 0x81, 0x00, 0x11, 0x20, 0x18, 0x03,
+            0x00, 0xcf, 0x01, 0x0f, 0xdb, 0x00, 0x06, 0x1f, 0x33, 0x83, 0x00, 0x07, 0x01, 0xce, 0x00, 0x12,
+            0x49, 0x51, 0x00, 0x03, 0xc4, 0x01, 0x01, 0x08, 0x03, 0x03, 0xfa, 0x00, 0x0a, 0x72, 0x00, 0x03,
+            0xeb, 0x00, 0x08, 0x30, 0x03, 0xad, 0x41, 0x4c, 0x42, 0x45, 0x44, 0x4f, 0x5f, 0x4d, 0x41, 0x50,
+            0xb7, 0x07, 0x93, 0x52, 0x4f, 0x55, 0x47, 0x48, 0x4e, 0x45, 0x53, 0x53, 0x1e, 0x00, 0x07, 0x2b,
+            0x00, 0x34, 0x2b, 0x20, 0x31, 0xd6, 0x05, 0x01, 0x6e, 0x00, 0x83, 0x4d, 0x45, 0x54, 0x41, 0x4c,
+            0x4c, 0x49, 0x43, 0x2a, 0x00, 0x0a, 0x3a, 0x00, 0x0c, 0x2d, 0x00, 0x03, 0xb3, 0x05, 0x02, 0x73,
+            0x00, 0x09, 0x3a, 0x00, 0x0c, 0x2a, 0x00, 0x40, 0x41, 0x4d, 0x42, 0x49, 0xce, 0x07, 0x93, 0x4f,
+            0x43, 0x43, 0x4c, 0x55, 0x53, 0x49, 0x4f, 0x4e, 0x60, 0x00, 0x07, 0x42, 0x00, 0x0c, 0x33, 0x00,
+            0x00, 0xc9, 0x07, 0x02, 0x5a, 0x00, 0x0f, 0x3d, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x24, 0x05,
+            0x20, 0x4f, 0x63, 0x22, 0x01, 0xf8, 0x17, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x52, 0x6f, 0x75, 0x67,
+            0x68, 0x6e, 0x65, 0x73, 0x73, 0x2c, 0x20, 0x4d, 0x65, 0x74, 0x61, 0x6c, 0x6c, 0x69, 0x63, 0x20,
+            0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x52, 0x47, 0x42, 0x30, 0x01, 0x01,
+            0x74, 0x07, 0x02, 0x61, 0x00, 0x04, 0x6b, 0x00, 0x00, 0x53, 0x00, 0x04, 0x5f, 0x04, 0x06, 0xaa,
+            0x0a, 0x04, 0x29, 0x00, 0x06, 0x5e, 0x04, 0xe2, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32,
+            0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0xbf, 0x04, 0x04, 0xff, 0x03, 0x31, 0x6d, 0x61, 0x70, 0x2e,
+            0x03, 0x80, 0x46, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x1e, 0x00, 0x20, 0x65, 0x72, 0x4a,
+            0x0b, 0x23, 0x3a, 0x3a, 0xcf, 0x04, 0x94, 0x4d, 0x41, 0x50, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x0a,
+            0xbc, 0x03, 0x80, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0xcc, 0x02, 0x03, 0xfb, 0x01,
+            0x01, 0x52, 0x04, 0x01, 0x96, 0x03, 0x48, 0x5f, 0x6d, 0x6f, 0x64, 0x4a, 0x03, 0x14, 0x72, 0xe5,
+            0x00, 0x0c, 0x19, 0x00, 0x13, 0x6d, 0xf3, 0x00, 0x0c, 0x18, 0x00, 0x03, 0xd3, 0x06, 0x24, 0x5f,
+            0x6f, 0x29, 0x01, 0x0c, 0x21, 0x00, 0x66, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x16, 0x00, 0x01,
+            0x09, 0x02, 0x02, 0xb3, 0x0a, 0x04, 0xda, 0x0b, 0x14, 0x5f, 0xb1, 0x0a, 0x01, 0xdc, 0x00, 0x62,
+            0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0xdb, 0x0a, 0x12, 0x76, 0x3f, 0x0b, 0x31, 0x20, 0x6f, 0x6e,
+            0xc9, 0x0a, 0x81, 0x43, 0x50, 0x55, 0x20, 0x73, 0x69, 0x64, 0x65, 0x14, 0x04, 0x01, 0x49, 0x00,
+            0x00, 0x15, 0x07, 0x40, 0x5b, 0x33, 0x5d, 0x3b, 0x4d, 0x06, 0x20, 0x20, 0x20, 0xb2, 0x01, 0x0f,
+            0x1b, 0x01, 0x01, 0x04, 0x03, 0x01, 0x03, 0xb2, 0x05, 0x00, 0x0a, 0x01, 0x30, 0x3a, 0x3a, 0x5f,
+            0x3c, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x10, 0x05, 0xc0, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x61, 0x79,
+            0x65, 0x72, 0x73, 0x5b, 0x38, 0x4f, 0x00, 0x39, 0x2f, 0x2f, 0x20, 0xb6, 0x0c, 0x17, 0x53, 0x8c,
+            0x00, 0x21, 0x6c, 0x79, 0x37, 0x00, 0x02, 0xcf, 0x03, 0x00, 0x39, 0x00, 0x21, 0x68, 0x61, 0xab,
+            0x0c, 0x01, 0x3a, 0x00, 0x34, 0x2f, 0x2f, 0x20, 0xd5, 0x0c, 0x09, 0x33, 0x00, 0x42, 0x2c, 0x20,
+            0x30, 0x20, 0x28, 0x00, 0x01, 0xe3, 0x04, 0x60, 0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0xf2, 0x05,
+            0x10, 0x73, 0xd4, 0x03, 0xd0, 0x2f, 0x2f, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x65,
+            0x67, 0x69, 0xa7, 0x07, 0x01, 0x1c, 0x00, 0x02, 0xb9, 0x01, 0x90, 0x2c, 0x20, 0x69, 0x6e, 0x64,
+            0x65, 0x78, 0x65, 0x64, 0x25, 0x0c, 0x00, 0xf1, 0x0b, 0xc0, 0x70, 0x65, 0x72, 0x20, 0x69, 0x6e,
+            0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0xc9, 0x0c, 0x01, 0xdf, 0x01, 0x02, 0x25, 0x00, 0x04, 0x61,
+            0x02, 0x0e, 0xf8, 0x04, 0x1f, 0x30, 0x1d, 0x04, 0x00, 0x13, 0x6d, 0x1b, 0x02, 0x04, 0xa1, 0x04,
+            0x04, 0x28, 0x01, 0x00, 0x21, 0x01, 0x05, 0x59, 0x00, 0x00, 0xa9, 0x04, 0x03, 0xa3, 0x00, 0x0e,
+            0xe8, 0x0d, 0x62, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0xad, 0x01, 0x01, 0x12, 0x0d, 0x70, 0x76,
+            0x65, 0x20, 0x70, 0x61, 0x73, 0x73, 0x7b, 0x0c, 0xb1, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c,
+            0x69, 0x74, 0x79, 0x42, 0x68, 0x05, 0x04, 0xce, 0x0c, 0xf0, 0x04, 0x68, 0x61, 0x73, 0x20, 0x6e,
+            0x6f, 0x20, 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0xef, 0x01,
+            0x11, 0x6f, 0x98, 0x05, 0x10, 0x2c, 0xad, 0x06, 0x00, 0xe5, 0x00, 0x21, 0x69, 0x6e, 0x17, 0x00,
+            0x02, 0x18, 0x06, 0x00, 0x3e, 0x0d, 0x21, 0x72, 0x65, 0x44, 0x0c, 0x00, 0x90, 0x06, 0x71, 0x65,
+            0x64, 0x20, 0x66, 0x72, 0x6f, 0x6d, 0x14, 0x02, 0x15, 0x76, 0x66, 0x00, 0x04, 0xcf, 0x05, 0x00,
+            0xdb, 0x06, 0x00, 0x42, 0x00, 0x02, 0xf7, 0x0c, 0x01, 0x7b, 0x00, 0x11, 0x73, 0x30, 0x01, 0x30,
+            0x65, 0x61, 0x64, 0xfb, 0x0c, 0x00, 0xfa, 0x0c, 0x0e, 0xca, 0x00, 0x00, 0x78, 0x00, 0x16, 0x52,
+            0x63, 0x00, 0x02, 0xd3, 0x00, 0x13, 0x66, 0x68, 0x03, 0x01, 0x80, 0x03, 0x01, 0x76, 0x01, 0x01,
+            0x95, 0x00, 0x33, 0x6f, 0x66, 0x20, 0x56, 0x0e, 0x10, 0x2e, 0xc6, 0x00, 0x51, 0x2e, 0x67, 0x6c,
+            0x73, 0x6c, 0xd6, 0x01, 0x00, 0x77, 0x00, 0x0f, 0x07, 0x01, 0x0d, 0x10, 0x2e, 0x6a, 0x00, 0xf2,
+            0x04, 0x54, 0x68, 0x65, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x27, 0x73, 0x20, 0x49, 0x44, 0x20,
+            0x6e, 0x61, 0x6d, 0x65, 0x72, 0x00, 0x05, 0xd8, 0x01, 0x01, 0xc6, 0x00, 0x00, 0x3d, 0x0e, 0x21,
+            0x67, 0x6c, 0x08, 0x0e, 0x31, 0x6f, 0x73, 0x65, 0x33, 0x01, 0x00, 0x13, 0x06, 0x01, 0x4e, 0x0e,
+            0x58, 0x66, 0x65, 0x74, 0x63, 0x68, 0x0a, 0x01, 0x08, 0xf0, 0x00, 0x02, 0x47, 0x01, 0x40, 0x72,
+            0x61, 0x6e, 0x73, 0x05, 0x0f, 0x00, 0x70, 0x0e, 0x10, 0x6e, 0xa7, 0x04, 0xf0, 0x04, 0x74, 0x65,
+            0x72, 0x70, 0x6f, 0x6c, 0x61, 0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x65,
+            0x72, 0x95, 0x0e, 0x01, 0x40, 0x0e, 0x30, 0x63, 0x6f, 0x72, 0x47, 0x0a, 0x80, 0x20, 0x62, 0x61,
+            0x72, 0x79, 0x63, 0x65, 0x6e, 0xc1, 0x08, 0x90, 0x73, 0x2e, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76,
+            0x61, 0x21, 0x00, 0x02, 0x81, 0x09, 0x20, 0x64, 0x69, 0x33, 0x07, 0x32, 0x65, 0x6e, 0x63, 0x8f,
+            0x0e, 0x21, 0x74, 0x6f, 0x85, 0x01, 0x08, 0x34, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x08, 0x01, 0x00,
+            0xe6, 0x0a, 0x01, 0x5a, 0x0a, 0x20, 0x75, 0x70, 0xb2, 0x02, 0x94, 0x6e, 0x65, 0x69, 0x67, 0x68,
+            0x62, 0x6f, 0x75, 0x72, 0xce, 0x03, 0x47, 0x73, 0x61, 0x6d, 0x65, 0xe3, 0x00, 0x91, 0x6c, 0x69,
+            0x6b, 0x65, 0x20, 0x64, 0x46, 0x64, 0x78, 0x34, 0x00, 0x40, 0x64, 0x46, 0x64, 0x79, 0x4a, 0x00,
+            0x61, 0x61, 0x20, 0x71, 0x75, 0x61, 0x64, 0x34, 0x01, 0x10, 0x4f, 0xb3, 0x07, 0x01, 0x35, 0x01,
+            0x01, 0x5f, 0x02, 0x01, 0x64, 0x00, 0x00, 0x85, 0x0f, 0x82, 0x76, 0x65, 0x64, 0x20, 0x64, 0x72,
+            0x61, 0x77, 0x79, 0x02, 0x00, 0x17, 0x00, 0x83, 0x47, 0x4c, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c,
+            0x13, 0x09, 0x80, 0x74, 0x65, 0x73, 0x74, 0x20, 0x61, 0x67, 0x61, 0x5c, 0x01, 0x01, 0xaf, 0x00,
+            0x84, 0x63, 0x6c, 0x61, 0x73, 0x73, 0x69, 0x66, 0x69, 0x39, 0x00, 0x01, 0x27, 0x00, 0x14, 0x2e,
+            0x3c, 0x03, 0x64, 0x65, 0x61, 0x72, 0x6c, 0x79, 0x5f, 0xfb, 0x01, 0x10, 0x5f, 0x3e, 0x00, 0x74,
+            0x73, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x22, 0x00, 0x06, 0xbf, 0x05, 0x16, 0x38, 0xb8, 0x05,
+            0x15, 0x75, 0xb9, 0x05, 0x07, 0x94, 0x02, 0x32, 0x5f, 0x69, 0x64, 0xa6, 0x09, 0x0c, 0x0d, 0x03,
+            0x42, 0x3a, 0x3a, 0x49, 0x44, 0xa8, 0x05, 0x03, 0xcf, 0x07, 0x40, 0x6c, 0x6f, 0x63, 0x61, 0x49,
+            0x09, 0x0a, 0x4c, 0x0c, 0x01, 0xe5, 0x04, 0x00, 0xdd, 0x00, 0x55, 0x5f, 0x62, 0x61, 0x73, 0x65,
+            0x9f, 0x0a, 0x07, 0x2d, 0x00, 0x07, 0x98, 0x0a, 0x01, 0x2d, 0x00, 0x04, 0x51, 0x01, 0x03, 0x48,
+            0x0b, 0x04, 0xb3, 0x00, 0x07, 0x32, 0x00, 0x16, 0x33, 0xb4, 0x00, 0x01, 0x6c, 0x0d, 0x03, 0x5e,
+            0x04, 0x02, 0x56, 0x0b, 0x13, 0x49, 0x58, 0x04, 0x00, 0x03, 0x04, 0x11, 0x2c, 0x2d, 0x01, 0x02,
+            0x4b, 0x04, 0x13, 0x20, 0x0a, 0x0a, 0xe0, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x6e,
+            0x64, 0x73, 0x20, 0x75, 0x70, 0xbc, 0x0a, 0x00, 0x71, 0x01, 0xf4, 0x01, 0x70, 0x61, 0x64, 0x64,
+            0x65, 0x64, 0x20, 0x31, 0x34, 0x34, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x7c, 0x06, 0x06, 0xf6,
+            0x00, 0x04, 0x58, 0x00, 0x03, 0x82, 0x06, 0x01, 0x2d, 0x0b, 0x52, 0x6d, 0x6f, 0x64, 0x65, 0x6c,
+            0x7e, 0x06, 0x01, 0x10, 0x00, 0x04, 0x8f, 0x11, 0x07, 0x18, 0x00, 0x01, 0xd3, 0x00, 0x04, 0xa7,
+            0x04, 0x01, 0x81, 0x09, 0x23, 0x2f, 0x2f, 0xe8, 0x03, 0x0f, 0x05, 0x02, 0x03, 0x12, 0x2c, 0x73,
+            0x0a, 0x10, 0x61, 0x3c, 0x07, 0x02, 0xb2, 0x02, 0x10, 0x74, 0x88, 0x02, 0x24, 0x6c, 0x79, 0xac,
+            0x07, 0x01, 0x91, 0x0c, 0x14, 0x73, 0x17, 0x01, 0x02, 0xdd, 0x00, 0x08, 0x3b, 0x12, 0x1f, 0x38,
+            0x28, 0x05, 0x00, 0x06, 0xd0, 0x01, 0x04, 0xc7, 0x00, 0x04, 0x32, 0x05, 0x0e, 0xe1, 0x00, 0x09,
+            0xfd, 0x01, 0x03, 0x4d, 0x01, 0x04, 0x43, 0x05, 0x03, 0xeb, 0x01, 0x0e, 0x75, 0x00, 0x1f, 0x39,
+            0x75, 0x00, 0x0a, 0x13, 0x50, 0x64, 0x0b, 0x04, 0x75, 0x00, 0x01, 0xc3, 0x00, 0x08, 0x68, 0x00,
+            0x04, 0x85, 0x0b, 0x0f, 0x68, 0x00, 0x0e, 0x1f, 0x31, 0x06, 0x06, 0x01, 0x06, 0xde, 0x00, 0x30,
+            0x45, 0x6c, 0x65, 0x56, 0x08, 0x04, 0x68, 0x00, 0x01, 0x7d, 0x01, 0x06, 0x1e, 0x00, 0x23, 0x5f,
+            0x65, 0x1f, 0x00, 0x03, 0x20, 0x0a, 0x0f, 0xce, 0x00, 0x06, 0x1f, 0x31, 0x64, 0x0b, 0x01, 0x06,
+            0x48, 0x00, 0x01, 0xda, 0x0e, 0x04, 0x64, 0x00, 0x01, 0xdd, 0x0c, 0x06, 0x1c, 0x00, 0x11, 0x5f,
+            0x96, 0x08, 0x0f, 0xc8, 0x00, 0x0f, 0x0f, 0x6e, 0x0b, 0x01, 0x06, 0x46, 0x00, 0x27, 0x55, 0x56,
+            0x5f, 0x00, 0x18, 0x32, 0x2a, 0x01, 0x2f, 0x75, 0x76, 0x5c, 0x00, 0x0f, 0x0f, 0x47, 0x0b, 0x01,
+            0x06, 0x5c, 0x00, 0x11, 0x4e, 0xd0, 0x08, 0x04, 0x60, 0x00, 0x0d, 0x8b, 0x01, 0x02, 0xef, 0x08,
+            0x0f, 0x65, 0x00, 0x0f, 0x1f, 0x34, 0xf2, 0x01, 0x0a, 0x10, 0x54, 0x42, 0x0d, 0x2f, 0x6e, 0x74,
+            0x66, 0x00, 0x06, 0x13, 0x74, 0x20, 0x00, 0x03, 0x8a, 0x01, 0x11, 0x0a, 0xaa, 0x01, 0x00, 0xb2,
+            0x04, 0x00, 0x7a, 0x0e, 0x01, 0x0f, 0x08, 0x2f, 0x3b, 0x0a, 0xcd, 0x07, 0x02, 0x31, 0x3b, 0x0a,
+            0x0a, 0x72, 0x01, 0x01, 0x2c, 0x00, 0x00, 0x36, 0x0e, 0x57, 0x5f, 0x70, 0x6f, 0x73, 0x3b, 0x14,
+            0x00, 0x0b, 0x0f, 0x00, 0x01, 0x8f, 0x01, 0x01, 0x20, 0x00, 0x12, 0x32, 0x34, 0x00, 0x21, 0x75,
+            0x76, 0x0e, 0x00, 0x12, 0x33, 0x0e, 0x00, 0x01, 0x42, 0x00, 0x02, 0xf3, 0x00, 0x0d, 0x17, 0x00,
+            0x03, 0xa4, 0x00, 0x0d, 0x18, 0x00, 0x2f, 0x62, 0x69, 0x1a, 0x00, 0x05, 0x77, 0x70, 0x6f, 0x73,
+            0x5f, 0x64, 0x78, 0x2c, 0x5b, 0x00, 0x01, 0x12, 0x00, 0x11, 0x79, 0x43, 0x00, 0x05, 0x80, 0x00,
+            0x06, 0x23, 0x00, 0x52, 0x75, 0x76, 0x5f, 0x64, 0x79, 0xd2, 0x00, 0x30, 0x33, 0x20, 0x46, 0x0f,
+            0x07, 0x51, 0x56, 0x65, 0x63, 0x33, 0x28, 0x0d, 0x01, 0x00, 0x98, 0x07, 0x32, 0x65, 0x78, 0x2c,
+            0x72, 0x14, 0x02, 0x1b, 0x15, 0x13, 0x29, 0x7c, 0x04, 0x01, 0x20, 0x00, 0x31, 0x69, 0x20, 0x3d,
+            0x4f, 0x07, 0x72, 0x65, 0x78, 0x20, 0x2a, 0x20, 0x33, 0x75, 0x86, 0x04, 0x32, 0x69, 0x66, 0x28,
+            0x2b, 0x00, 0x00, 0xb7, 0x14, 0x03, 0x3e, 0x0c, 0x00, 0xf9, 0x11, 0x01, 0xef, 0x09, 0x00, 0x63,
+            0x0a, 0x61, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x63, 0x04, 0x16, 0x28, 0x13, 0x02, 0x03, 0x02,
+            0x01, 0x58, 0x73, 0x5b, 0x69, 0x5d, 0x2c, 0x6d, 0x02, 0x05, 0x17, 0x00, 0x5f, 0x20, 0x2b, 0x20,
+            0x31, 0x75, 0x1c, 0x00, 0x07, 0x4f, 0x32, 0x75, 0x5d, 0x29, 0x81, 0x00, 0x00, 0x08, 0x7b, 0x12,
+            0x0f, 0x82, 0x00, 0x0d, 0x03, 0x53, 0x01, 0x0d, 0x83, 0x00, 0x06, 0x18, 0x00, 0x0f, 0x84, 0x00,
+            0x00, 0x09, 0x1d, 0x00, 0x06, 0x85, 0x00, 0x0f, 0xe5, 0x00, 0x04, 0x06, 0x65, 0x04, 0x0b, 0xe7,
+            0x00, 0x07, 0x19, 0x00, 0x0f, 0x65, 0x00, 0x00, 0x0a, 0x1e, 0x00, 0x02, 0x66, 0x00, 0x11, 0x7d,
+            0xc1, 0x11, 0x0f, 0x7d, 0x08, 0x0d, 0x00, 0xff, 0x07, 0x00, 0x5d, 0x06, 0x04, 0xd2, 0x06, 0x00,
+            0x34, 0x17, 0x74, 0x61, 0x6e, 0x20, 0x4e, 0x44, 0x43, 0x20, 0x55, 0x00, 0x00, 0xb9, 0x02, 0x37,
+            0x33, 0x20, 0x42, 0xb2, 0x08, 0xc1, 0x28, 0x6d, 0x61, 0x74, 0x33, 0x78, 0x34, 0x20, 0x63, 0x6c,
+            0x69, 0x70, 0x0c, 0x06, 0x54, 0x32, 0x20, 0x6e, 0x64, 0x63, 0xfb, 0x01, 0x01, 0x1c, 0x06, 0x04,
+            0x67, 0x06, 0x10, 0x77, 0x6b, 0x07, 0x42, 0x2e, 0x66, 0x20, 0x2f, 0xd0, 0x01, 0x00, 0x32, 0x00,
+            0x61, 0x5b, 0x30, 0x5d, 0x2e, 0x77, 0x2c, 0x3d, 0x00, 0x26, 0x5b, 0x31, 0x0b, 0x00, 0x43, 0x32,
+            0x5d, 0x2e, 0x77, 0xa2, 0x01, 0x01, 0xfc, 0x17, 0x42, 0x70, 0x30, 0x20, 0x3d, 0x25, 0x00, 0x75,
+            0x30, 0x5d, 0x2e, 0x78, 0x79, 0x20, 0x2a, 0x4a, 0x18, 0x32, 0x77, 0x2e, 0x78, 0xca, 0x01, 0x01,
+            0x28, 0x00, 0x24, 0x65, 0x31, 0x28, 0x00, 0x1d, 0x31, 0x28, 0x00, 0x68, 0x79, 0x20, 0x2d, 0x20,
+            0x70, 0x30, 0x2d, 0x00, 0x14, 0x32, 0x2d, 0x00, 0x1d, 0x32, 0x2d, 0x00, 0x1c, 0x7a, 0x2d, 0x00,
+            0x30, 0x64, 0x20, 0x3d, 0xd8, 0x00, 0x07, 0x17, 0x00, 0x02, 0x8a, 0x04, 0x04, 0xdc, 0x00, 0x45,
+            0x61, 0x72, 0x65, 0x61, 0xdf, 0x00, 0x40, 0x28, 0x65, 0x31, 0x2e, 0xe7, 0x02, 0x21, 0x65, 0x32,
+            0x76, 0x00, 0x30, 0x65, 0x31, 0x2e, 0xb3, 0x00, 0x43, 0x65, 0x32, 0x2e, 0x78, 0xd5, 0x00, 0x02,
+            0x3c, 0x00, 0x10, 0x62, 0xae, 0x00, 0x28, 0x28, 0x64, 0x2b, 0x00, 0x16, 0x64, 0x2a, 0x00, 0x07,
+            0xe5, 0x00, 0x00, 0x5d, 0x00, 0x02, 0xb9, 0x00, 0x03, 0x39, 0x00, 0x00, 0xba, 0x00, 0x04, 0x65,
+            0x00, 0x00, 0x33, 0x00, 0x05, 0x64, 0x00, 0x1f, 0x64, 0x39, 0x00, 0x05, 0x01, 0x89, 0x01, 0x10,
+            0x77, 0x12, 0x0a, 0x21, 0x74, 0x73, 0x8a, 0x03, 0xb0, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x66, 0x20,
+            0x2d, 0x20, 0x62, 0x31, 0x05, 0x00, 0x98, 0x32, 0x2c, 0x20, 0x62, 0x31, 0x2c, 0x20, 0x62, 0x32,
+            0x3f, 0x00, 0x03, 0xa4, 0x19, 0x03, 0xa0, 0x02, 0x04, 0x3e, 0x00, 0x33, 0x2f, 0x20, 0x28, 0x0b,
+            0x00, 0x54, 0x2e, 0x78, 0x20, 0x2b, 0x20, 0x0c, 0x00, 0x17, 0x79, 0x0c, 0x00, 0xb8, 0x7a, 0x29,
+            0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0xe4, 0x0b, 0x04, 0x2b, 0x0e, 0x14, 0x28,
+            0x1f, 0x02, 0x01, 0x1a, 0x04, 0x00, 0x2a, 0x09, 0x30, 0x6c, 0x5f, 0x69, 0x62, 0x01, 0x51, 0x74,
+            0x65, 0x78, 0x65, 0x6c, 0x59, 0x04, 0x08, 0xee, 0x03, 0x60, 0x69, 0x64, 0x73, 0x2c, 0x20, 0x69,
+            0xe1, 0x01, 0x40, 0x28, 0x67, 0x6c, 0x5f, 0x45, 0x00, 0xf1, 0x02, 0x43, 0x6f, 0x6f, 0x72, 0x64,
+            0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x20, 0x2d, 0x90, 0x0a, 0x03, 0xb3,
+            0x09, 0x00, 0x38, 0x04, 0x01, 0x59, 0x00, 0x00, 0x7f, 0x0a, 0x01, 0xb3, 0x0d, 0x16, 0x3d, 0x64,
+            0x00, 0x15, 0x2f, 0x01, 0x0b, 0x04, 0xb0, 0x09, 0x05, 0x2f, 0x00, 0x05, 0xf7, 0x02, 0x07, 0x2f,
+            0x00, 0x11, 0x2d, 0xc8, 0x0c, 0x01, 0x45, 0x00, 0x1f, 0x2a, 0x3a, 0x00, 0x02, 0x0f, 0x90, 0x08,
+            0x00, 0x30, 0x64, 0x61, 0x74, 0x0b, 0x02, 0x08, 0xc1, 0x00, 0x05, 0x97, 0x08, 0x04, 0x93, 0x00,
+            0x13, 0x5d, 0xcf, 0x01, 0x08, 0x42, 0x06, 0x21, 0x20, 0x3d, 0x3b, 0x00, 0x16, 0x2e, 0x7e, 0x09,
+            0x00, 0x9b, 0x00, 0x04, 0x0e, 0x00, 0x27, 0x20, 0x3d, 0x21, 0x0e, 0x01, 0x1a, 0x06, 0x04, 0x1a,
+            0x00, 0x31, 0x5d, 0x3b, 0x0a, 0xae, 0x04, 0x00, 0x1f, 0x0f, 0x11, 0x33, 0x64, 0x05, 0x01, 0xb3,
+            0x0c, 0x12, 0x3d, 0x11, 0x00, 0x15, 0x28, 0xd7, 0x00, 0x00, 0x77, 0x05, 0x33, 0x29, 0x20, 0x2b,
+            0x17, 0x00, 0xa3, 0x30, 0x75, 0x2c, 0x20, 0x31, 0x75, 0x2c, 0x20, 0x32, 0x75, 0x94, 0x02, 0x33,
+            0x69, 0x66, 0x28, 0x99, 0x0a, 0x11, 0x29, 0x4f, 0x00, 0x00, 0x7d, 0x00, 0x00, 0xd5, 0x05, 0x09,
+            0x4d, 0x00, 0x07, 0xd5, 0x00, 0x05, 0x9d, 0x08, 0x04, 0x25, 0x00, 0x2a, 0x2e, 0x78, 0x72, 0x05,
+            0x0e, 0x21, 0x00, 0x1f, 0x79, 0x21, 0x00, 0x0d, 0x10, 0x7a, 0x98, 0x05, 0x01, 0x7e, 0x00, 0x01,
+            0xa0, 0x0a, 0x00, 0xee, 0x06, 0x10, 0x4d, 0xb4, 0x0a, 0x00, 0xb2, 0x02, 0x53, 0x69, 0x65, 0x77,
+            0x20, 0x2a, 0x22, 0x01, 0x00, 0x14, 0x00, 0x02, 0x42, 0x01, 0x03, 0x7e, 0x04, 0x00, 0x2a, 0x00,
+            0x00, 0x5a, 0x07, 0x01, 0x1b, 0x15, 0x12, 0x73, 0x51, 0x04, 0x02, 0x21, 0x00, 0x40, 0x66, 0x6f,
+            0x72, 0x28, 0x70, 0x10, 0x00, 0x80, 0x06, 0xd2, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x33,
+            0x3b, 0x20, 0x69, 0x2b, 0x2b, 0xe6, 0x00, 0x02, 0x9d, 0x1c, 0x01, 0xec, 0x00, 0x44, 0x69, 0x65,
+            0x77, 0x5f, 0xe8, 0x04, 0x00, 0xd8, 0x05, 0x03, 0x75, 0x00, 0x02, 0x81, 0x00, 0x10, 0x2a, 0xb4,
+            0x04, 0x21, 0x34, 0x28, 0x9c, 0x02, 0x01, 0xf5, 0x06, 0x04, 0xf6, 0x00, 0x01, 0x84, 0x06, 0x03,
+            0x62, 0x1b, 0x63, 0x29, 0x2c, 0x20, 0x31, 0x2e, 0x66, 0x50, 0x01, 0x00, 0x54, 0x00, 0x01, 0xe3,
+            0x04, 0x47, 0x69, 0x5d, 0x20, 0x3d, 0xd4, 0x1c, 0x22, 0x20, 0x2a, 0x59, 0x15, 0x08, 0x6b, 0x00,
+            0x02, 0xab, 0x00, 0x11, 0x7d, 0xfa, 0x00, 0x00, 0xe8, 0x02, 0x02, 0xab, 0x0e, 0x44, 0x20, 0x3d,
+            0x20, 0x32, 0x2f, 0x05, 0x21, 0x32, 0x28, 0xe7, 0x0e, 0x01, 0x00, 0x1d, 0x03, 0x61, 0x00, 0x01,
+            0x29, 0x00, 0x6b, 0x6e, 0x64, 0x63, 0x20, 0x3d, 0x20, 0x17, 0x03, 0x23, 0x20, 0x2a, 0x41, 0x00,
+            0x10, 0x2d, 0x90, 0x00, 0x02, 0x5d, 0x00, 0x01, 0x01, 0x04, 0x3a, 0x62, 0x20, 0x3d, 0xbd, 0x05,
+            0x00, 0xa1, 0x00, 0x10, 0x2c, 0xd9, 0x04, 0x06, 0x54, 0x00, 0x6f, 0x33, 0x20, 0x62, 0x5f, 0x64,
+            0x78, 0x29, 0x00, 0x06, 0x20, 0x20, 0x2b, 0x0a, 0x01, 0x21, 0x32, 0x28, 0x18, 0x0e, 0x90, 0x2e,
+            0x78, 0x2c, 0x20, 0x30, 0x2e, 0x66, 0x29, 0x29, 0x43, 0x04, 0x08, 0x68, 0x00, 0x3f, 0x5f, 0x64,
+            0x79, 0x42, 0x00, 0x0e, 0x42, 0x30, 0x2e, 0x66, 0x2c, 0xa8, 0x00, 0x24, 0x2e, 0x79, 0x42, 0x00,
+            0x01, 0x02, 0x01, 0x01, 0xde, 0x02, 0x04, 0xd2, 0x01, 0x03, 0x86, 0x01, 0x06, 0x9a, 0x01, 0x24,
+            0x20, 0x2a, 0x6b, 0x00, 0x01, 0x28, 0x00, 0x20, 0x70, 0x6f, 0xd0, 0x04, 0x09, 0x5f, 0x01, 0x01,
+            0x18, 0x00, 0x04, 0x40, 0x00, 0x07, 0x2b, 0x00, 0x04, 0x13, 0x00, 0x02, 0xdf, 0x00, 0x00, 0x11,
+            0x01, 0x14, 0x28, 0x13, 0x00, 0x02, 0x38, 0x02, 0x00, 0x5b, 0x00, 0x25, 0x5f, 0x64, 0xa5, 0x05,
+            0x00, 0x9d, 0x03, 0x04, 0x21, 0x00, 0x02, 0xd1, 0x00, 0x0f, 0x34, 0x00, 0x06, 0x23, 0x79, 0x29,
+            0x85, 0x03, 0x01, 0x7c, 0x00, 0x01, 0xc5, 0x09, 0x00, 0xb9, 0x00, 0x30, 0x65, 0x63, 0x34, 0x66,
+            0x05, 0x03, 0x5d, 0x01, 0x23, 0x69, 0x66, 0x7e, 0x1b, 0x03, 0xfd, 0x1a, 0x02, 0x82, 0x02, 0x00,
+            0x28, 0x02, 0x09, 0x36, 0x00, 0x02, 0xd3, 0x02, 0x08, 0x01, 0x05, 0x01, 0x50, 0x00, 0x24, 0x73,
+            0x5b, 0x73, 0x02, 0x0c, 0x69, 0x03, 0x0c, 0x1f, 0x00, 0x0b, 0x67, 0x03, 0x0c, 0x1f, 0x00, 0x20,
+            0x7a, 0x5d, 0xe4, 0x05, 0x08, 0x44, 0x01, 0x22, 0x75, 0x76, 0xad, 0x00, 0x20, 0x32, 0x28, 0xcd,
+            0x01, 0x07, 0x32, 0x01, 0x00, 0xf1, 0x09, 0x00, 0x0b, 0x02, 0x01, 0xa0, 0x00, 0x00, 0x0d, 0x00,
+            0x00, 0xd6, 0x01, 0x00, 0x78, 0x02, 0x07, 0x29, 0x00, 0x36, 0x69, 0x66, 0x28, 0x3d, 0x1c, 0x02,
+            0xd3, 0x00, 0x06, 0x55, 0x03, 0x01, 0xcc, 0x00, 0x40, 0x32, 0x20, 0x75, 0x76, 0xa5, 0x01, 0x02,
+            0x0d, 0x00, 0x08, 0xd9, 0x00, 0x00, 0x1e, 0x0c, 0x0f, 0xd6, 0x00, 0x05, 0x09, 0x1c, 0x00, 0x0b,
+            0xd3, 0x00, 0x09, 0x1c, 0x00, 0x01, 0x35, 0x04, 0x00, 0x46, 0x01, 0x00, 0x04, 0x00, 0x03, 0xaa,
+            0x00, 0x01, 0xfe, 0x04, 0x01, 0xd0, 0x01, 0x02, 0xce, 0x00, 0x07, 0x1b, 0x00, 0x02, 0xfe, 0x01,
+            0x00, 0x92, 0x00, 0x11, 0x2a, 0xea, 0x02, 0x0f, 0x21, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x05, 0x21,
+            0x00, 0x12, 0x79, 0x21, 0x00, 0x02, 0x9d, 0x03, 0x33, 0x69, 0x66, 0x28, 0xa7, 0x0a, 0x09, 0xc4,
+            0x01, 0x0a, 0xf1, 0x00, 0x12, 0x20, 0x88, 0x0a, 0x00, 0xd9, 0x05, 0x20, 0x72, 0x69, 0x3f, 0x01,
+            0x00, 0xf9, 0x00, 0x11, 0x28, 0x1d, 0x12, 0x51, 0x70, 0x6f, 0x73, 0x65, 0x28, 0xe6, 0x05, 0x04,
+            0x39, 0x08, 0x01, 0x7c, 0x0f, 0x07, 0xb3, 0x07, 0x00, 0x71, 0x02, 0x13, 0x29, 0x31, 0x02, 0x00,
+            0xb6, 0x00, 0x00, 0x3c, 0x00, 0x03, 0x51, 0x00, 0x34, 0x73, 0x2c, 0x20, 0x42, 0x0a, 0x00, 0x41,
+            0x0f, 0x04, 0x0c, 0x00, 0x02, 0xa0, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0xec, 0x04, 0x0c, 0x00, 0x23,
+            0x00, 0x06, 0xaa, 0x00, 0x00, 0x0e, 0x00, 0x02, 0xa9, 0x00, 0x03, 0xed, 0x04, 0x02, 0x0d, 0x00,
+            0x04, 0xb6, 0x00, 0x17, 0x2a, 0xe1, 0x0b, 0x04, 0xa3, 0x01, 0x01, 0xec, 0x04, 0x03, 0x00, 0x01,
+            0x00, 0xa7, 0x0b, 0x06, 0x7a, 0x00, 0x00, 0x4d, 0x00, 0x34, 0x69, 0x66, 0x28, 0x42, 0x0b, 0x09,
+            0x1d, 0x01, 0x00, 0x1c, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x7b, 0x00, 0x00, 0x12, 0x00, 0x04, 0xc2,
+            0x00, 0x02, 0x23, 0x05, 0x00, 0xea, 0x00, 0x01, 0x91, 0x03, 0x01, 0x72, 0x05, 0x00, 0xa4, 0x02,
+            0x0f, 0x6e, 0x05, 0x04, 0x04, 0x66, 0x00, 0x0e, 0x83, 0x00, 0x00, 0x55, 0x00, 0x05, 0xef, 0x0c,
+            0x03, 0xd7, 0x00, 0x62, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0xdd, 0x00, 0x00, 0x13, 0x00, 0x06,
+            0x45, 0x01, 0x20, 0x5b, 0x69, 0x6f, 0x06, 0x00, 0x34, 0x00, 0x04, 0x04, 0x00, 0x02, 0xe5, 0x01,
+            0x00, 0x0e, 0x00, 0x06, 0x0a, 0x00, 0x01, 0x52, 0x02, 0x00, 0x96, 0x01, 0x03, 0x76, 0x0c, 0x00,
+            0x09, 0x0a, 0x02, 0x93, 0x0e, 0x0a, 0x5f, 0x02, 0x0f, 0xff, 0x00, 0x09, 0x0a, 0xfb, 0x00, 0x06,
+            0x52, 0x00, 0x03, 0x01, 0x01, 0x25, 0x20, 0x3d, 0xd9, 0x01, 0x0a, 0x54, 0x00, 0x00, 0x8a, 0x00,
+            0x06, 0x2e, 0x00, 0x05, 0xda, 0x00, 0x20, 0x20, 0x3d, 0x73, 0x22, 0x03, 0x93, 0x0e, 0x0a, 0x32,
+            0x00, 0x02, 0xb8, 0x00, 0xd0, 0x7d, 0x0a, 0x7d, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x66,
+            0x6c, 0x61, 0xec, 0x1a, 0x02, 0x97, 0x0d, 0x01, 0x4b, 0x00, 0x04, 0x37, 0x08, 0x0f, 0xb1, 0x0e,
+            0x04, 0x0f, 0x68, 0x08, 0x0b, 0x20, 0x69, 0x6e, 0xfe, 0x05, 0x1a, 0x34, 0x32, 0x0e, 0x1a, 0x3b,
+            0x17, 0x00, 0x01, 0xd2, 0x0e, 0x09, 0x12, 0x00, 0x01, 0x82, 0x04, 0x04, 0x26, 0x00, 0x05, 0x58,
+            0x0e, 0x04, 0x11, 0x00, 0x0f, 0xdb, 0x0e, 0x01, 0x02, 0x3f, 0x00, 0x08, 0x1a, 0x00, 0x03, 0x2b,
+            0x01, 0x0f, 0x35, 0x00, 0x01, 0x05, 0x18, 0x01, 0x14, 0x3b, 0x3e, 0x23, 0x01, 0xf2, 0x15, 0x03,
+            0x04, 0x25, 0x01, 0x24, 0x23, 0x12, 0x69, 0xed, 0x15, 0x02, 0x07, 0x19, 0x05, 0xf3, 0x1d, 0x04,
+            0x07, 0x19, 0x04, 0xf9, 0x0c, 0x04, 0x1b, 0x01, 0x02, 0x2d, 0x00, 0x04, 0x80, 0x18, 0x31, 0x69,
+            0x73, 0x20, 0x3b, 0x18, 0x00, 0xc1, 0x15, 0x01, 0xe7, 0x15, 0x40, 0x6d, 0x61, 0x70, 0x73, 0x47,
+            0x17, 0x00, 0x1a, 0x19, 0x00, 0x3b, 0x00, 0x21, 0x69, 0x74, 0x20, 0x16, 0x10, 0x6e, 0x51, 0x18,
+            0x12, 0x20, 0x95, 0x14, 0x30, 0x64, 0x2e, 0x20, 0x02, 0x1f, 0x00, 0x3e, 0x0a, 0x34, 0x69, 0x64,
+            0x65, 0x22, 0x00, 0x91, 0x73, 0x74, 0x69, 0x6c, 0x6c, 0x20, 0x63, 0x68, 0x65, 0xc5, 0x1a, 0x08,
+            0x21, 0x15, 0x04, 0x7a, 0x00, 0x01, 0x60, 0x00, 0x02, 0x84, 0x24, 0x50, 0x69, 0x73, 0x20, 0x77,
+            0x68, 0xe2, 0x24, 0x10, 0x65, 0xce, 0x24, 0x00, 0x41, 0x08, 0x42, 0x67, 0x72, 0x61, 0x6d, 0x47,
+            0x16, 0x30, 0x61, 0x6c, 0x6c, 0x02, 0x02, 0x20, 0x73, 0x20, 0xca, 0x1c, 0x00, 0xae, 0x14, 0x45,
+            0x20, 0x61, 0x6e, 0x79, 0x20, 0x0a, 0x10, 0x2e, 0x75, 0x17, 0x01, 0x70, 0x24, 0x04, 0x52, 0x19,
+            0x00, 0x04, 0x01, 0x05, 0x71, 0x24, 0x08, 0x15, 0x00, 0x0f, 0x72, 0x24, 0x00, 0x00, 0xd0, 0x1a,
+            0x03, 0xc0, 0x03, 0x41, 0x28, 0x6d, 0x61, 0x70, 0x6f, 0x24, 0x19, 0x28, 0x34, 0x00, 0x16, 0x26,
+            0x6a, 0x00, 0x02, 0x51, 0x01, 0x0d, 0x58, 0x1a, 0x40, 0x29, 0x20, 0x3e, 0x3e, 0x6b, 0x19, 0x0c,
+            0x95, 0x24, 0x26, 0x2f, 0x2f, 0x96, 0x16, 0x00, 0x1e, 0x25, 0x01, 0x45, 0x08, 0x0c, 0x58, 0x14,
+            0x41, 0x20, 0x6d, 0x61, 0x79, 0x87, 0x18, 0x20, 0x6e, 0x67, 0xef, 0x14, 0x55, 0x6f, 0x74, 0x68,
+            0x65, 0x72, 0x7c, 0x0b, 0x00, 0x39, 0x1f, 0x10, 0x6f, 0x50, 0x01, 0x00, 0xf5, 0x18, 0xf0, 0x03,
+            0x65, 0x73, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x75, 0x76, 0x20, 0x67, 0x72,
+            0x61, 0x64, 0xee, 0x21, 0x11, 0x73, 0x45, 0x01, 0x01, 0x13, 0x21, 0x01, 0xc2, 0x19, 0x24, 0x32,
+            0x5e, 0x25, 0x26, 0x00, 0x4f, 0x00, 0x51, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x68, 0x15, 0x00, 0x16,
+            0x21, 0x00, 0xbf, 0x01, 0x00, 0xf3, 0x0e, 0xc0, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20,
+            0x70, 0x61, 0x74, 0x68, 0x3e, 0x01, 0x0f, 0xb3, 0x18, 0x04, 0x04, 0x96, 0x25, 0xa2, 0x53, 0x41,
+            0x4d, 0x50, 0x4c, 0x45, 0x5f, 0x32, 0x44, 0x28, 0xef, 0x01, 0x40, 0x72, 0x2c, 0x20, 0x63, 0x93,
+            0x0c, 0x14, 0x29, 0x5b, 0x02, 0x4b, 0x47, 0x72, 0x61, 0x64, 0x1c, 0x00, 0x03, 0x67, 0x11, 0x00,
+            0x46, 0x07, 0x01, 0x1c, 0x0e, 0x44, 0x78, 0x70, 0x32, 0x28, 0x99, 0x00, 0x17, 0x29, 0x1d, 0x00,
+            0x01, 0x2b, 0x0e, 0x09, 0x1d, 0x00, 0x13, 0x29, 0xcc, 0x03, 0x0f, 0x7e, 0x00, 0x16, 0x0d, 0x7a,
+            0x00, 0x05, 0x68, 0x00, 0x04, 0x21, 0x03, 0x0f, 0x13, 0x28, 0x03, 0x02, 0xf7, 0x26, 0x04, 0xde,
+            0x00, 0x30, 0x4d, 0x41, 0x50, 0x01, 0x02, 0x54, 0x2c, 0x20, 0x75, 0x76, 0x29, 0x14, 0x00, 0x06,
+            0xf2, 0x00, 0x20, 0x32, 0x44, 0xfa, 0x0f, 0x01, 0xfb, 0x12, 0x18, 0x2e, 0x93, 0x1b, 0x51, 0x6d,
+            0x61, 0x70, 0x5d, 0x29, 0x34, 0x00, 0x00, 0xb6, 0x00, 0x23, 0x69, 0x66, 0x4c, 0x27, 0x20, 0x64,
+            0x28, 0x35, 0x1d, 0x0a, 0x99, 0x28, 0x14, 0x29, 0x15, 0x16, 0x06, 0xdf, 0x17, 0x07, 0x48, 0x28,
+            0x03, 0x5a, 0x01, 0x03, 0x97, 0x1d, 0x00, 0x4e, 0x02, 0x13, 0x5f, 0x13, 0x00, 0x24, 0x73, 0x5b,
+            0xc5, 0x1d, 0x02, 0xd2, 0x1f, 0x04, 0xc2, 0x21, 0x20, 0x75, 0x6e, 0x0e, 0x02, 0x10, 0x30, 0xe6,
+            0x01, 0x04, 0x21, 0x00, 0x25, 0x2d, 0x31, 0xf7, 0x02, 0x0f, 0xd6, 0x00, 0x0b, 0x00, 0xc3, 0x00,
+            0x05, 0x5f, 0x00, 0x00, 0xc4, 0x00, 0x01, 0xcc, 0x10, 0x56, 0x33, 0x28, 0x75, 0x76, 0x2c, 0xee,
+            0x02, 0x00, 0x25, 0x00, 0x03, 0xb4, 0x1c, 0x00, 0x23, 0x00, 0x05, 0x99, 0x01, 0x03, 0x99, 0x15,
+            0x0f, 0xc7, 0x00, 0x0b, 0x0f, 0xc2, 0x00, 0x60, 0x20, 0x75, 0x76, 0xa2, 0x00, 0x02, 0xbb, 0x29,
+            0x04, 0x3d, 0x02, 0x06, 0x2e, 0x20, 0x05, 0xf1, 0x25, 0x08, 0xf2, 0x03, 0x06, 0x1f, 0x00, 0x15,
+            0x29, 0x3a, 0x01, 0x09, 0x37, 0x20, 0x0f, 0x36, 0x00, 0x02, 0x09, 0x22, 0x00, 0x06, 0x39, 0x00,
+            0x08, 0x45, 0x20, 0x0f, 0x38, 0x00, 0x02, 0x08, 0x21, 0x00, 0x06, 0x37, 0x00, 0x03, 0x62, 0x08,
+            0x07, 0x97, 0x00, 0x17, 0x20, 0x0c, 0x00, 0x04, 0x81, 0x09, 0x09, 0x33, 0x00, 0x0f, 0x55, 0x20,
+            0x02, 0x0f, 0x73, 0x00, 0x02, 0x0f, 0x2a, 0x00, 0x02, 0x06, 0x49, 0x00, 0x03, 0x3d, 0x20, 0x0f,
+            0x3b, 0x00, 0x02, 0x03, 0x1c, 0x00, 0x72, 0x29, 0x0a, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x09, 0x07,
+            0x32, 0x6f, 0x75, 0x74, 0x43, 0x17, 0x11, 0x3b, 0x63, 0x13, 0x12, 0x31, 0xc1, 0x25, 0x30, 0x6c,
+            0x69, 0x74, 0x7f, 0x1e, 0x01, 0xcd, 0x25, 0x51, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0xd0, 0x1c, 0x42,
+            0x6f, 0x77, 0x65, 0x64, 0xe9, 0x03, 0x01, 0xf5, 0x17, 0x00, 0x3f, 0x1b, 0x11, 0x74, 0x8a, 0x04,
+            0x44, 0x6c, 0x61, 0x73, 0x74, 0x40, 0x24, 0x01, 0x4b, 0x06, 0x42, 0x6c, 0x69, 0x74, 0x0a, 0xeb,
+            0x11, 0x05, 0x6b, 0x26, 0x20, 0x61, 0x6c, 0x7c, 0x20, 0x30, 0x6f, 0x77, 0x28, 0x84, 0x0c, 0x05,
+            0x42, 0x0e, 0x04, 0x49, 0x11, 0x02, 0x2d, 0x00, 0x01, 0x57, 0x1b, 0x41, 0x20, 0x3d, 0x20, 0x2d,
+            0xaf, 0x08, 0x52, 0x70, 0x6f, 0x73, 0x2e, 0x7a, 0xa3, 0x09, 0x01, 0x0f, 0x11, 0x03, 0xa1, 0x24,
+            0x00, 0x50, 0x22, 0x03, 0x7f, 0x15, 0x64, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x18, 0x00, 0x13,
+            0x3c, 0xa5, 0x00, 0x05, 0xf4, 0x24, 0x01, 0x01, 0x23, 0x33, 0x20, 0x26, 0x26, 0xd6, 0x1b, 0x1c,
+            0x3e, 0x20, 0x00, 0x02, 0x14, 0x25, 0x13, 0x5b, 0x40, 0x00, 0x12, 0x5d, 0xfc, 0x0b, 0x00, 0xb3,
+            0x08, 0x03, 0x12, 0x00, 0x22, 0x2b, 0x2b, 0x7e, 0x00, 0x25, 0x69, 0x66, 0x64, 0x00, 0x2c, 0x3e,
+            0x3d, 0x45, 0x00, 0x01, 0x65, 0x00, 0x06, 0x3b, 0x00, 0x03, 0x6c, 0x12, 0x32, 0x31, 0x2e, 0x66,
+            0x3c, 0x00, 0x01, 0xee, 0x00, 0x03, 0xe5, 0x25, 0x02, 0xeb, 0x0d, 0x13, 0x28, 0x0e, 0x00, 0x05,
+            0xf3, 0x25, 0x03, 0x6e, 0x00, 0x10, 0x5d, 0x59, 0x0f, 0x00, 0x71, 0x0d, 0x04, 0xfd, 0x00, 0x02,
+            0x8d, 0x0f, 0x43, 0x29, 0x2e, 0x78, 0x79, 0x06, 0x01, 0x03, 0x5c, 0x00, 0x03, 0x2f, 0x04, 0x06,
+            0x48, 0x00, 0x02, 0xb8, 0x14, 0x14, 0x34, 0x11, 0x00, 0x00, 0x38, 0x01, 0x34, 0x78, 0x79, 0x2c,
+            0x91, 0x01, 0x14, 0x2c, 0xb2, 0x00, 0x00, 0x18, 0x00, 0x10, 0x7a, 0x9b, 0x0b, 0x02, 0x4e, 0x15,
+            0xf1, 0x01, 0x74, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x20, 0x70, 0x68, 0x6f, 0x6e,
+            0x67, 0x2d, 0x4f, 0x1d, 0x01, 0x43, 0x25, 0x62, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x4c, 0x55, 0x25,
+            0x40, 0x73, 0x20, 0x74, 0x6f, 0x5a, 0x06, 0x02, 0x53, 0x08, 0x01, 0x1f, 0x00, 0x02, 0x17, 0x13,
+            0x22, 0x41, 0x64, 0xf5, 0x25, 0x02, 0xd0, 0x01, 0x12, 0x4c, 0x6f, 0x04, 0x10, 0x20, 0xc3, 0x06,
+            0x00, 0x6e, 0x12, 0x03, 0x0f, 0x00, 0x13, 0x4e, 0x08, 0x00, 0x23, 0x56, 0x2c, 0xe2, 0x01, 0x05,
+            0x2f, 0x22, 0x04, 0x11, 0x00, 0x04, 0x27, 0x22, 0x00, 0xb4, 0x20, 0x03, 0x95, 0x02, 0x11, 0x33,
+            0x34, 0x1e, 0x39, 0x75, 0x73, 0x65, 0x14, 0x00, 0x00, 0x77, 0x1e, 0x4b, 0x75, 0x6c, 0x61, 0x72,
+            0x32, 0x02, 0x11, 0x46, 0x04, 0x15, 0xc0, 0x61, 0x6d, 0x70, 0x28, 0x64, 0x6f, 0x74, 0x28, 0x4e,
+            0x2c, 0x20, 0x4c, 0x54, 0x13, 0x00, 0x9a, 0x0f, 0x06, 0xca, 0x10, 0x03, 0x4f, 0x00, 0x85, 0x20,
+            0x2b, 0x3d, 0x20, 0x64, 0x46, 0x20, 0x2a, 0xa5, 0x00, 0x00, 0x0b, 0x00, 0x04, 0xbf, 0x22, 0x07,
+            0xae, 0x01, 0xa5, 0x68, 0x61, 0x6c, 0x66, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2b, 0x0b, 0x93,
+            0x69, 0x7a, 0x65, 0x28, 0x56, 0x20, 0x2b, 0x20, 0x4c, 0xd9, 0x0c, 0x02, 0xcd, 0x00, 0x10, 0x73,
+            0x7d, 0x00, 0x49, 0x70, 0x6f, 0x77, 0x28, 0x81, 0x00, 0x06, 0x3f, 0x00, 0x08, 0x8a, 0x00, 0x95,
+            0x2c, 0x20, 0x32, 0x35, 0x36, 0x2e, 0x66, 0x20, 0x2a, 0xf2, 0x00, 0x03, 0x4b, 0x00, 0x04, 0xd8,
+            0x00, 0x00, 0x9e, 0x00, 0x1b, 0x73, 0x9e, 0x00, 0x40, 0x28, 0x31, 0x2e, 0x30, 0xe3, 0x14, 0x05,
+            0x36, 0x01, 0x07, 0x97, 0x14, 0x41, 0x6d, 0x61, 0x69, 0x6e, 0x88, 0x14, 0x03, 0x0b, 0x07, 0x0f,
+            0xa1, 0x20, 0x00, 0x00, 0xcb, 0x02, 0x0f, 0xbe, 0x14, 0x02, 0x07, 0xed, 0x00, 0x04, 0x6d, 0x02,
+            0x02, 0x56, 0x0e, 0x01, 0x61, 0x0b, 0x07, 0x13, 0x00, 0x0f, 0x29, 0x00, 0x02, 0x00, 0x5e, 0x0e,
+            0x0b, 0x29, 0x00, 0x03, 0x64, 0x0e, 0x00, 0x5a, 0x0f, 0x12, 0x20, 0x21, 0x08, 0x12, 0x3d, 0x63,
+            0x0b, 0x01, 0x0d, 0x00, 0x05, 0x46, 0x00, 0x00, 0x49, 0x0f, 0x02, 0x89, 0x10, 0x01, 0x40, 0x00,
+            0x00, 0x1d, 0x00, 0x10, 0x79, 0xf4, 0x0a, 0x00, 0xe9, 0x0b, 0x00, 0xad, 0x00, 0x01, 0x2d, 0x03,
+            0x07, 0x7f, 0x00, 0x00, 0x52, 0x14, 0x31, 0x46, 0x64, 0x78, 0x63, 0x02, 0x11, 0x28, 0x33, 0x00,
+            0x04, 0x1d, 0x00, 0x00, 0xc7, 0x02, 0x0f, 0x32, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x09, 0x20,
+            0x0f, 0x32, 0x00, 0x0b, 0x02, 0x87, 0x00, 0x00, 0xd9, 0x0e, 0x00, 0x3e, 0x20, 0x02, 0x59, 0x00,
+            0x23, 0x75, 0x76, 0x90, 0x01, 0x05, 0xc4, 0x00, 0x05, 0x4c, 0x00, 0x01, 0x79, 0x00, 0x01, 0x20,
+            0x00, 0x03, 0x47, 0x30, 0x03, 0x79, 0x00, 0x21, 0x34, 0x20, 0x18, 0x0c, 0x04, 0xeb, 0x00, 0x01,
+            0x0d, 0x00, 0x05, 0xeb, 0x00, 0x03, 0x7e, 0x28, 0x02, 0xb7, 0x0d, 0x00, 0xe5, 0x19, 0x06, 0x03,
+            0x0c, 0x03, 0x0e, 0x00, 0x05, 0xf6, 0x0b, 0x73, 0x2c, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x9f,
+            0x0d, 0x03, 0x88, 0x11, 0x0f, 0xa9, 0x0f, 0x0e, 0x01, 0x0a, 0x01, 0x02, 0x5f, 0x00, 0x09, 0xa7,
+            0x02, 0x01, 0xae, 0x00, 0x07, 0x1d, 0x00, 0x03, 0xd7, 0x00, 0x02, 0x58, 0x0d, 0x01, 0x53, 0x0d,
+            0x00, 0xbf, 0x00, 0x00, 0x04, 0x00, 0x07, 0x25, 0x00, 0x09, 0x42, 0x00, 0x02, 0x71, 0x0e, 0x01,
+            0x1e, 0x00, 0x01, 0x4f, 0x1b, 0x13, 0x78, 0xb1, 0x00, 0x01, 0x0d, 0x00, 0x10, 0x79, 0x7a, 0x01,
+            0x01, 0xe6, 0x12, 0x0e, 0x30, 0x0e, 0x00, 0x6b, 0x05, 0x03, 0xfc, 0x06, 0x03, 0x81, 0x0b, 0x02,
+            0x18, 0x05, 0x06, 0x3e, 0x0e, 0x01, 0x55, 0x00, 0x03, 0x07, 0x01, 0x09, 0x74, 0x00, 0x06, 0xb6,
+            0x00, 0x03, 0x1e, 0x00, 0x03, 0xb7, 0x00, 0x05, 0xa8, 0x00, 0x05, 0x2e, 0x01, 0x0f, 0x37, 0x00,
+            0x04, 0x05, 0x20, 0x00, 0x03, 0x39, 0x00, 0x0b, 0xf0, 0x00, 0x0f, 0x83, 0x00, 0x10, 0x0c, 0xf7,
+            0x00, 0x13, 0x79, 0xf7, 0x00, 0x02, 0x64, 0x01, 0x00, 0xcf, 0x0f, 0x00, 0xb0, 0x02, 0x11, 0x78,
+            0x34, 0x18, 0x07, 0x2c, 0x00, 0x02, 0x1f, 0x00, 0x03, 0x2c, 0x00, 0x01, 0x23, 0x01, 0x01, 0xc2,
+            0x18, 0x00, 0x2c, 0x00, 0x24, 0x79, 0x2e, 0x8b, 0x13, 0x0f, 0xc7, 0x00, 0x02, 0x0f, 0x45, 0x00,
+            0x05, 0x0a, 0x02, 0x01, 0x02, 0xc9, 0x00, 0x00, 0x5c, 0x10, 0x42, 0x20, 0x54, 0x42, 0x4e, 0xde,
+            0x0e, 0x02, 0x67, 0x10, 0x0f, 0x50, 0x02, 0x07, 0x01, 0x67, 0x01, 0x02, 0x99, 0x00, 0x03, 0x0f,
+            0x01, 0x06, 0x4f, 0x02, 0x07, 0x8a, 0x08, 0x0d, 0x9e, 0x01, 0x00, 0x73, 0x2e, 0x02, 0x37, 0x00,
+            0x10, 0x5f, 0x2b, 0x0a, 0x02, 0x50, 0x0a, 0x24, 0x20, 0x3d, 0x3d, 0x0b, 0x00, 0x51, 0x0b, 0x03,
+            0xe0, 0x01, 0x32, 0x4d, 0x41, 0x50, 0x0a, 0x08, 0x37, 0x5f, 0x75, 0x76, 0xa2, 0x06, 0x00, 0xe8,
+            0x00, 0x0f, 0x41, 0x00, 0x01, 0x0e, 0x14, 0x00, 0x11, 0x2a, 0x1b, 0x16, 0x07, 0xe0, 0x15, 0x00,
+            0x3b, 0x00, 0x08, 0x08, 0x03, 0x09, 0xe8, 0x01, 0x02, 0x40, 0x00, 0x00, 0x86, 0x05, 0x00, 0x04,
+            0x01, 0x13, 0x2a, 0x50, 0x12, 0x07, 0xa5, 0x00, 0x00, 0x9f, 0x01, 0x04, 0x84, 0x0e, 0x12, 0x2e,
+            0x2e, 0x00, 0x00, 0x42, 0x28, 0x00, 0xed, 0x15, 0x00, 0x17, 0x17, 0x02, 0x12, 0x00, 0x32, 0x20,
+            0x2a, 0x20, 0xaa, 0x05, 0x02, 0x39, 0x1a, 0x0f, 0x30, 0x00, 0x00, 0x01, 0x0e, 0x16, 0x03, 0x78,
+            0x07, 0x02, 0xcb, 0x03, 0x02, 0x7f, 0x01, 0x09, 0x38, 0x03, 0x0b, 0xa6, 0x00, 0x07, 0x6d, 0x01,
+            0x06, 0xbc, 0x03, 0x0f, 0x52, 0x14, 0x07, 0x27, 0x69, 0x66, 0xa4, 0x0a, 0x04, 0xa7, 0x09, 0x02,
+            0x8a, 0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x00, 0x01, 0x4a, 0x04, 0x29, 0x20, 0x2a, 0x78, 0x01,
+            0x06, 0x34, 0x00, 0x06, 0x78, 0x01, 0x08, 0xa2, 0x00, 0x05, 0x34, 0x00, 0x05, 0xd6, 0x00, 0x01,
+            0x12, 0x00, 0x00, 0x05, 0x01, 0x02, 0x27, 0x00, 0x02, 0xb3, 0x06, 0x05, 0x4a, 0x06, 0x02, 0x49,
+            0x02, 0x02, 0xff, 0x0c, 0x05, 0x15, 0x00, 0x0c, 0x2e, 0x00, 0x04, 0xab, 0x06, 0x08, 0x2d, 0x00,
+            0x04, 0x14, 0x00, 0x0c, 0x2c, 0x00, 0x03, 0xab, 0x30, 0x06, 0xd8, 0x29, 0x08, 0x35, 0x00, 0x0d,
+            0x1d, 0x00, 0x06, 0x3e, 0x00, 0x24, 0x69, 0x66, 0x98, 0x0a, 0x05, 0x0d, 0x01, 0x00, 0x96, 0x29,
+            0x03, 0x29, 0x2b, 0x00, 0xe1, 0x2e, 0x63, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0xef, 0x26, 0xd3,
+            0x73, 0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x4d, 0x10, 0x63,
+            0x20, 0x73, 0x69, 0x6e, 0x67, 0x6c, 0xe1, 0x26, 0x01, 0x9c, 0x04, 0x07, 0xef, 0x03, 0x00, 0xd4,
+            0x02, 0x00, 0xd7, 0x35, 0x09, 0x4e, 0x01, 0x03, 0x72, 0x00, 0x06, 0x4b, 0x01, 0x33, 0x2e, 0x72,
+            0x67, 0x51, 0x16, 0x00, 0x81, 0x01, 0x0d, 0xaf, 0x00, 0x00, 0x8d, 0x01, 0x43, 0x6f, 0x72, 0x6d,
+            0x2e, 0x60, 0x31, 0x00, 0x24, 0x00, 0x05, 0x35, 0x01, 0x04, 0x1c, 0x00, 0x12, 0x67, 0x68, 0x01,
+            0x00, 0x1c, 0x00, 0x04, 0x24, 0x01, 0x04, 0x1b, 0x00, 0x03, 0x5b, 0x00, 0x0b, 0x4c, 0x02, 0x06,
+            0xa5, 0x00, 0x2a, 0x69, 0x66, 0x82, 0x0c, 0x05, 0x0a, 0x01, 0x01, 0xcd, 0x00, 0x00, 0x52, 0x00,
+            0x06, 0x2c, 0x00, 0x00, 0x0e, 0x00, 0x09, 0x7c, 0x00, 0x07, 0x18, 0x0e, 0x09, 0x45, 0x00, 0x08,
+            0xdd, 0x00, 0x06, 0x9b, 0x00, 0x02, 0x84, 0x00, 0x00, 0x45, 0x00, 0x29, 0x69, 0x66, 0xbf, 0x0c,
+            0x0f, 0x74, 0x00, 0x0d, 0x08, 0xd4, 0x00, 0x07, 0x73, 0x00, 0x08, 0x43, 0x00, 0x0f, 0x72, 0x00,
+            0x10, 0x0f, 0xbe, 0x0c, 0x02, 0x0f, 0x7b, 0x00, 0x0d, 0x0f, 0x8f, 0x01, 0x02, 0x07, 0x84, 0x00,
+            0x0f, 0x55, 0x00, 0x02, 0x0f, 0x8d, 0x00, 0x09, 0x12, 0x7d, 0x71, 0x1c, 0x01, 0x6f, 0x08, 0x10,
+            0x56, 0x70, 0x0c, 0x02, 0x20, 0x04, 0x00, 0x60, 0x04, 0x00, 0x14, 0x00, 0x02, 0x12, 0x08, 0x01,
+            0xd8, 0x03, 0x30, 0x70, 0x6f, 0x73, 0xf1, 0x06, 0x00, 0x30, 0x01, 0x00, 0x1a, 0x00, 0x32, 0x20,
+            0x64, 0x4c, 0x6a, 0x18, 0x17, 0x33, 0x41, 0x18, 0x01, 0x19, 0x00, 0x1f, 0x73, 0x19, 0x00, 0x00,
+            0x02, 0x73, 0x03, 0x02, 0xef, 0x0b, 0x1f, 0x20, 0x39, 0x0c, 0x03, 0x8f, 0x20, 0x21, 0x3d, 0x20,
+            0x30, 0x75, 0x20, 0x3f, 0x28, 0x0d, 0x04, 0x0c, 0x8a, 0x00, 0x26, 0x20, 0x3a, 0x11, 0x1b, 0x06,
+            0x81, 0x0b, 0x00, 0xe2, 0x04, 0x01, 0x9a, 0x0b, 0x05, 0x45, 0x00, 0x03, 0x03, 0x30, 0x01, 0x39,
+            0x25, 0x23, 0x20, 0x2a, 0x01, 0x0c, 0x0a, 0x68, 0x08, 0x40, 0x2c, 0x20, 0x56, 0x2c, 0x98, 0x27,
+            0x04, 0xa3, 0x2e, 0x04, 0xe0, 0x01, 0x74, 0x2c, 0x20, 0x64, 0x4c, 0x2c, 0x20, 0x73, 0xea, 0x0a,
+            0x00, 0xfc, 0x0c, 0x02, 0xe5, 0x31, 0x01, 0x08, 0x34, 0x22, 0x2e, 0x7a, 0xb2, 0x00, 0x02, 0xb1,
+            0x04, 0x06, 0x96, 0x02, 0x01, 0x04, 0x01, 0x04, 0x32, 0x01, 0x04, 0x23, 0x01, 0x06, 0xd5, 0x07,
+            0x00, 0x47, 0x01, 0x06, 0x84, 0x02, 0x01, 0xce, 0x0d, 0x01, 0xf9, 0x33, 0x00, 0xe7, 0x18, 0xc7,
+            0x69, 0x6e, 0x74, 0x28, 0x6d, 0x61, 0x78, 0x28, 0x6c, 0x6f, 0x67, 0x28, 0xf9, 0x0d, 0x00, 0xd2,
+            0x05, 0x00, 0x4b, 0x2f, 0x00, 0x82, 0x34, 0x01, 0x2c, 0x00, 0x02, 0x25, 0x34, 0x25, 0x20, 0x2b,
+            0xf5, 0x30, 0x02, 0x16, 0x00, 0x00, 0x06, 0x13, 0x01, 0xb7, 0x05, 0x04, 0xa8, 0x01, 0x00, 0xac,
+            0x01, 0x01, 0x3a, 0x1e, 0x50, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x86, 0x04, 0x31, 0x69, 0x6e, 0x28,
+            0x11, 0x00, 0x01, 0x06, 0x00, 0x0e, 0x84, 0x1f, 0x01, 0x17, 0x06, 0x06, 0xeb, 0x34, 0x00, 0xa0,
+            0x21, 0x17, 0x2f, 0xae, 0x39, 0x12, 0x2c, 0xe3, 0x34, 0x10, 0x29, 0x95, 0x1d, 0x06, 0x26, 0x00,
+            0x20, 0x20, 0x2d, 0xa7, 0x38, 0x07, 0xd4, 0x00, 0x01, 0x38, 0x0a, 0x03, 0xb1, 0x00, 0x01, 0x94,
+            0x0c, 0x01, 0x2c, 0x00, 0x20, 0x73, 0x5b, 0x85, 0x00, 0x02, 0x34, 0x08, 0x08, 0x47, 0x01, 0x00,
+            0x42, 0x13, 0x11, 0x28, 0x1b, 0x00, 0x00, 0x77, 0x20, 0x03, 0x37, 0x00, 0x02, 0x62, 0x01, 0x00,
+            0x40, 0x13, 0x01, 0x1a, 0x00, 0x23, 0x7a, 0x29, 0x66, 0x1f, 0x00, 0xd2, 0x00, 0x00, 0x1b, 0x19,
+            0x01, 0x38, 0x01, 0x00, 0x08, 0x1e, 0x03, 0x30, 0x00, 0x22, 0x2e, 0x78, 0x10, 0x1e, 0x05, 0x0f,
+            0x00, 0x06, 0x1d, 0x01, 0x27, 0x2e, 0x79, 0x24, 0x1e, 0x00, 0x40, 0x00, 0x06, 0xab, 0x01, 0x00,
+            0x0e, 0x00, 0x01, 0xde, 0x31, 0x00, 0xb2, 0x29, 0x03, 0x2b, 0x32, 0x12, 0x3d, 0x08, 0x00, 0x23,
+            0x73, 0x5b, 0x4b, 0x00, 0x0b, 0xdf, 0x31, 0x27, 0x69, 0x5d, 0x8a, 0x00, 0x00, 0x40, 0x00, 0x01,
+            0xef, 0x01, 0x00, 0xf2, 0x02, 0x01, 0x77, 0x02, 0x14, 0x2e, 0xf9, 0x01, 0x01, 0x86, 0x1c, 0x25,
+            0x20, 0x2d, 0xde, 0x0f, 0x06, 0x1f, 0x01, 0x00, 0x35, 0x00, 0x02, 0x0f, 0x03, 0x40, 0x64, 0x69,
+            0x73, 0x74, 0xff, 0x21, 0x00, 0xaf, 0x0d, 0x10, 0x4c, 0xaf, 0x0d, 0x0f, 0x25, 0x00, 0x01, 0x01,
+            0x11, 0x34, 0x00, 0x26, 0x00, 0x02, 0x60, 0x00, 0x01, 0x0f, 0x00, 0x22, 0x20, 0x2a, 0xa5, 0x00,
+            0x02, 0x0e, 0x00, 0x0a, 0x36, 0x00, 0x32, 0x69, 0x66, 0x28, 0x58, 0x00, 0x31, 0x3e, 0x3d, 0x20,
+            0x1f, 0x00, 0x12, 0x32, 0xa1, 0x02, 0x00, 0x77, 0x00, 0x04, 0x04, 0x00, 0x73, 0x63, 0x6f, 0x6e,
+            0x74, 0x69, 0x6e, 0x75, 0x68, 0x34, 0x04, 0x16, 0x00, 0x10, 0x4c, 0xa4, 0x05, 0x03, 0xcc, 0x1a,
+            0x42, 0x73, 0x71, 0x72, 0x74, 0x48, 0x00, 0x03, 0x36, 0x09, 0x04, 0x25, 0x00, 0x24, 0x2f, 0x2f,
+            0xb0, 0x23, 0x40, 0x20, 0x73, 0x71, 0x75, 0x5c, 0x2e, 0xb1, 0x66, 0x61, 0x6c, 0x6c, 0x6f, 0x66,
+            0x66, 0x20, 0x77, 0x69, 0x6e, 0x17, 0x11, 0x00, 0xb4, 0x13, 0x11, 0x72, 0x47, 0x35, 0x40, 0x7a,
+            0x65, 0x72, 0x6f, 0x79, 0x24, 0x00, 0x96, 0x15, 0x01, 0xbe, 0x00, 0x22, 0x27, 0x73, 0x93, 0x00,
+            0x05, 0xcc, 0x05, 0x00, 0x56, 0x00, 0x02, 0x0c, 0x01, 0x02, 0x3e, 0x00, 0x01, 0x2e, 0x02, 0x00,
+            0x41, 0x0e, 0x02, 0x97, 0x08, 0x02, 0x82, 0x00, 0x00, 0x2b, 0x20, 0x00, 0x2a, 0x01, 0x52, 0x29,
+            0x20, 0x2f, 0x20, 0x28, 0xd3, 0x00, 0x00, 0xaf, 0x0e, 0x00, 0x34, 0x19, 0x18, 0x32, 0x58, 0x0e,
+            0x0a, 0x08, 0x01, 0x02, 0x57, 0x00, 0x64, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x75, 0x1d, 0x2c, 0x03,
+            0x65, 0x00, 0x13, 0x2a, 0xac, 0x00, 0x00, 0x50, 0x00, 0x02, 0x2c, 0x01, 0x10, 0x2b, 0x4c, 0x04,
+            0x0b, 0xea, 0x00, 0x31, 0x69, 0x66, 0x28, 0xb5, 0x00, 0x15, 0x2e, 0x22, 0x35, 0x01, 0x72, 0x35,
+            0x50, 0x20, 0x3e, 0x3d, 0x20, 0x2d, 0x51, 0x0f, 0x09, 0xc5, 0x00, 0x00, 0xc9, 0x00, 0x08, 0x6c,
+            0x00, 0xdf, 0x2a, 0x3d, 0x20, 0x73, 0x6d, 0x6f, 0x6f, 0x74, 0x68, 0x73, 0x74, 0x65, 0x70, 0x48,
+            0x00, 0x02, 0x03, 0x98, 0x04, 0x06, 0x5e, 0x00, 0x01, 0x80, 0x35, 0x11, 0x2c, 0x0d, 0x02, 0x24,
+            0x2d, 0x4c, 0x1e, 0x00, 0x01, 0x4f, 0x02, 0x05, 0xb8, 0x35, 0x08, 0xd8, 0x03, 0x00, 0x72, 0x00,
+            0x05, 0xf8, 0x04, 0x05, 0x30, 0x00, 0x01, 0xea, 0x08, 0x20, 0x20, 0x2a, 0xd1, 0x3c, 0x04, 0xf8,
+            0x00, 0x0f, 0xec, 0x04, 0x22, 0x00, 0x5e, 0x00, 0x02, 0x20, 0x07, 0x02, 0x06, 0x00, 0x01, 0xe6,
+            0x02, 0x10, 0x61, 0xe7, 0x02, 0x03, 0x82, 0x06, 0x01, 0x37, 0x03, 0x00, 0x69, 0x00, 0x0c, 0xec,
+            0x08, 0x02, 0x86, 0x01, 0x05, 0x4c, 0x13, 0x02, 0x01, 0x05, 0x90, 0x34, 0x28, 0x73, 0x4c, 0x20,
+            0x2b, 0x20, 0x28, 0x64, 0x06, 0x00, 0x20, 0x61, 0x4c, 0xd1, 0x04, 0x00, 0x52, 0x00, 0x11, 0x28,
+            0xaf, 0x00, 0x00, 0x4f, 0x04, 0xb0, 0x6f, 0x6c, 0x6f, 0x72, 0x2e, 0x61, 0x29, 0x3b, 0x0a, 0x7d,
+            0x0a,
+        };
+        constexpr uint8_t shader_5[] = {
+            0xf5, 0x18, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x23,
+            0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x56, 0x49, 0x53, 0x49, 0x42, 0x49, 0x4c, 0x49, 0x54,
+            0x59, 0x5f, 0x52, 0x45, 0x53, 0x4f, 0x4c, 0x56, 0x45, 0x1b, 0x00, 0xfc, 0x05, 0x42, 0x52, 0x44,
+            0x46, 0x5f, 0x42, 0x49, 0x4e, 0x44, 0x4c, 0x45, 0x53, 0x53, 0x0a, 0x23, 0x69, 0x66, 0x64, 0x65,
+            0x66, 0x15, 0x00, 0x51, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x55, 0x00, 0xf0, 0x2a, 0x47, 0x4c, 0x5f,
+            0x41, 0x52, 0x42, 0x5f, 0x62, 0x69, 0x6e, 0x64, 0x6c, 0x65, 0x73, 0x73, 0x5f, 0x74, 0x65, 0x78,
+            0x74, 0x75, 0x72, 0x65, 0x20, 0x3a, 0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x0a, 0x23,
+            0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74,
+            0x64, 0x31, 0x34, 0x30, 0x2c, 0x20, 0x32, 0x00, 0xf2, 0x0b, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20,
+            0x30, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e, 0x65,
+            0x72, 0x61, 0x6c, 0x55, 0x10, 0x00, 0xf0, 0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+            0x6d, 0x61, 0x74, 0x34, 0x20, 0x69, 0x6e, 0xc9, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77,
+            0x3b, 0x17, 0x00, 0x0b, 0x0f, 0x00, 0xa2, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f,
+            0x6e, 0x24, 0x00, 0xc6, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75,
+            0x16, 0x00, 0xf3, 0x39, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62, 0x69,
+            0x61, 0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e,
+            0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a,
+            0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x69,
+            0x6d, 0x65, 0x20, 0x62, 0x79, 0x20, 0x53, 0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xd2, 0x43,
+            0x61, 0x63, 0x68, 0x65, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x62, 0x01, 0x10, 0x73,
+            0x51, 0x00, 0xf1, 0x20, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20,
+            0x61, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74,
+            0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64,
+            0x20, 0x6f, 0x66, 0x21, 0x00, 0x70, 0x6d, 0x65, 0x73, 0x68, 0x20, 0x62, 0x65, 0x1b, 0x01, 0x50,
+            0x64, 0x72, 0x61, 0x77, 0x6e, 0x82, 0x01, 0x10, 0x6e, 0x83, 0x01, 0x07, 0x4d, 0x00, 0x05, 0xac,
+            0x01, 0x07, 0x14, 0x00, 0x34, 0x20, 0x30, 0x75, 0x6b, 0x01, 0x04, 0xe5, 0x01, 0x03, 0x1e, 0x00,
+            0xf3, 0x01, 0x45, 0x4e, 0x41, 0x42, 0x4c, 0x45, 0x44, 0x28, 0x69, 0x64, 0x78, 0x29, 0x20, 0x28,
+            0x28, 0x28, 0x17, 0x00, 0x01, 0x96, 0x00, 0x31, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26, 0x20,
+            0x31, 0x75, 0x29, 0x20, 0x3d, 0x3d, 0x07, 0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73,
+            0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7, 0x01,
+            0x18, 0x3b, 0x18, 0x00, 0x53, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20, 0x2b,
+            0x28, 0x00, 0x09, 0x24, 0x00, 0x27, 0x55, 0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23, 0x00,
+            0x67, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00, 0x77,
+            0x54, 0x41, 0x4e, 0x47, 0x45, 0x4e, 0x54, 0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00, 0xf7,
+            0x03, 0x49, 0x4e, 0x53, 0x54, 0x41, 0x4e, 0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46,
+            0x4f, 0x52, 0x4d, 0x34, 0x00, 0x07, 0x46, 0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e, 0x56,
+            0x45, 0x52, 0x53, 0x3d, 0x00, 0x3f, 0x34, 0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00, 0x03,
+            0x65, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00, 0x02,
+            0x09, 0x47, 0x00, 0x38, 0x4e, 0x45, 0x58, 0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00, 0x30,
+            0x3b, 0x0a, 0x0a, 0x5e, 0x02, 0x90, 0x77, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x7d,
+            0x01, 0x25, 0x2c, 0x20, 0xf5, 0x00, 0x2d, 0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e, 0x64,
+            0x20, 0x43, 0x00, 0xf3, 0x00, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e, 0x61,
+            0x62, 0x6c, 0x65, 0x64, 0xd6, 0x01, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31, 0x02,
+            0x33, 0x20, 0x3d, 0x20, 0x2b, 0x02, 0x03, 0x11, 0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44,
+            0x58, 0x29, 0xb4, 0x00, 0x01, 0x36, 0x00, 0x24, 0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02,
+            0xd0, 0x01, 0x0a, 0x30, 0x00, 0x03, 0xbf, 0x01, 0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d,
+            0x68, 0x00, 0x04, 0xc3, 0x01, 0x0f, 0x39, 0x00, 0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x0f,
+            0x72, 0x04, 0x07, 0x17, 0x31, 0x72, 0x04, 0x5b, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x70, 0x04, 0xd0,
+            0x76, 0x65, 0x63, 0x33, 0x20, 0x61, 0x6d, 0x62, 0x69, 0x65, 0x6e, 0x74, 0x4c, 0x20, 0x00, 0x03,
+            0x4c, 0x04, 0x00, 0x11, 0x03, 0x52, 0x5f, 0x70, 0x61, 0x64, 0x31, 0x10, 0x00, 0x01, 0x27, 0x00,
+            0x01, 0x40, 0x00, 0x52, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x15, 0x00, 0x02, 0x5b, 0x04, 0x00, 0x26,
+            0x00, 0x12, 0x32, 0x11, 0x00, 0x01, 0x26, 0x00, 0x00, 0xa6, 0x04, 0x11, 0x5f, 0x2b, 0x00, 0x38,
+            0x44, 0x69, 0x72, 0xa0, 0x04, 0x06, 0x2f, 0x00, 0x12, 0x33, 0x2f, 0x00, 0x00, 0xb1, 0x04, 0xf1,
+            0x0e, 0x33, 0x20, 0x63, 0x6c, 0x75, 0x73, 0x74, 0x65, 0x72, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x3b,
+            0x20, 0x2f, 0x2f, 0x20, 0x74, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x78, 0x2c, 0x20, 0x79, 0xcc, 0x01,
+            0xf4, 0x0a, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x73, 0x6c, 0x69, 0x63, 0x65, 0x73, 0x2c, 0x20,
+            0x7a, 0x20, 0x69, 0x73, 0x20, 0x30, 0x20, 0x77, 0x68, 0x65, 0x6e, 0x3a, 0x00, 0x31, 0x65, 0x64,
+            0x20, 0x6f, 0x00, 0x02, 0xcd, 0x04, 0x31, 0x6f, 0x66, 0x66, 0x32, 0x05, 0x02, 0x6e, 0x00, 0x04,
+            0x5d, 0x00, 0x01, 0x3f, 0x00, 0x62, 0x5f, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x7c, 0x00, 0x0f, 0x1f,
+            0x00, 0x01, 0x02, 0x21, 0x05, 0x00, 0x86, 0x05, 0x01, 0x10, 0x04, 0xf1, 0x05, 0x73, 0x68, 0x61,
+            0x64, 0x6f, 0x77, 0x5f, 0x63, 0x61, 0x73, 0x63, 0x61, 0x64, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e,
+            0x74, 0xa1, 0x00, 0x03, 0x7f, 0x00, 0x02, 0x20, 0x00, 0x06, 0x76, 0x00, 0x21, 0x7d, 0x3b, 0xac,
+            0x02, 0x14, 0x64, 0xf6, 0x00, 0x22, 0x61, 0x6c, 0x98, 0x00, 0x04, 0x29, 0x00, 0x72, 0x2c, 0x20,
+            0x73, 0x65, 0x65, 0x20, 0x43, 0x4f, 0x00, 0x10, 0x64, 0x56, 0x05, 0x63, 0x6f, 0x77, 0x4d, 0x61,
+            0x70, 0x73, 0x96, 0x02, 0x01, 0x74, 0x00, 0xff, 0x09, 0x4d, 0x41, 0x58, 0x5f, 0x53, 0x48, 0x41,
+            0x44, 0x4f, 0x57, 0x5f, 0x43, 0x41, 0x53, 0x43, 0x41, 0x44, 0x45, 0x53, 0x20, 0x3d, 0x20, 0x34,
+            0x3b, 0xe1, 0x01, 0x07, 0x17, 0x32, 0xe1, 0x01, 0x02, 0x69, 0x00, 0x0b, 0xe2, 0x01, 0x01, 0x52,
+            0x06, 0x02, 0x1a, 0x00, 0x50, 0x5f, 0x6d, 0x61, 0x74, 0x72, 0x48, 0x01, 0x1f, 0x5b, 0x68, 0x00,
+            0x00, 0x11, 0x5d, 0xdc, 0x00, 0x00, 0xbe, 0x01, 0x93, 0x20, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20,
+            0x74, 0x6f, 0xba, 0x00, 0x54, 0x20, 0x6d, 0x61, 0x70, 0x20, 0xee, 0x06, 0x01, 0x1c, 0x00, 0x01,
+            0x62, 0x01, 0x43, 0x76, 0x65, 0x63, 0x34, 0x22, 0x00, 0x05, 0x25, 0x01, 0x61, 0x73, 0x70, 0x6c,
+            0x69, 0x74, 0x73, 0x4a, 0x00, 0x32, 0x66, 0x61, 0x72, 0x4e, 0x00, 0x02, 0xc1, 0x01, 0x83, 0x6f,
+            0x66, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x4f, 0x01, 0x00, 0x88, 0x06, 0x00, 0xda, 0x03, 0x03,
+            0xa1, 0x01, 0x50, 0x65, 0x64, 0x20, 0x70, 0x6f, 0x74, 0x02, 0x00, 0xbe, 0x03, 0x42, 0x73, 0x70,
+            0x6f, 0x74, 0x3b, 0x01, 0x04, 0x34, 0x01, 0x02, 0x23, 0x02, 0x21, 0x65, 0x64, 0xa2, 0x02, 0xb1,
+            0x69, 0x6e, 0x67, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x10, 0x00, 0x43, 0x44, 0x61,
+            0x74, 0x61, 0x3e, 0x07, 0x06, 0x81, 0x02, 0x4c, 0x70, 0x6f, 0x73, 0x69, 0x05, 0x07, 0x43, 0x72,
+            0x61, 0x6e, 0x67, 0xff, 0x01, 0x01, 0x29, 0x00, 0x1c, 0x63, 0xcb, 0x02, 0x00, 0x79, 0x00, 0xa1,
+            0x5f, 0x63, 0x6f, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x65, 0x72, 0xc6, 0x00, 0xc3, 0x62, 0x65, 0x6c,
+            0x6f, 0x77, 0x20, 0x2d, 0x31, 0x20, 0x66, 0x6f, 0x72, 0xa3, 0x00, 0x02, 0x6d, 0x02, 0x04, 0x03,
+            0x01, 0x11, 0x33, 0xe5, 0x00, 0x15, 0x5f, 0xf6, 0x01, 0x08, 0x5f, 0x02, 0x05, 0x50, 0x00, 0x51,
+            0x69, 0x6e, 0x6e, 0x65, 0x72, 0x7c, 0x07, 0x06, 0x1b, 0x08, 0x29, 0x34, 0x33, 0x1b, 0x08, 0xf3,
+            0x05, 0x31, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x62, 0x75, 0x66,
+            0x66, 0x65, 0x72, 0x20, 0x5f, 0x1d, 0x01, 0x01, 0xe6, 0x00, 0x04, 0x21, 0x08, 0x01, 0x0d, 0x00,
+            0x00, 0xf3, 0x00, 0x03, 0x22, 0x01, 0x2f, 0x5b, 0x5d, 0x58, 0x00, 0x0b, 0x1f, 0x32, 0x58, 0x00,
+            0x07, 0x04, 0x53, 0x00, 0x00, 0x88, 0x03, 0x14, 0x32, 0x4e, 0x03, 0x22, 0x73, 0x5b, 0x09, 0x02,
+            0xb4, 0x6f, 0x66, 0x66, 0x73, 0x65, 0x74, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x1b, 0x00, 0x02, 0xd6,
+            0x03, 0x40, 0x5f, 0x69, 0x6e, 0x64, 0x44, 0x02, 0x12, 0x2c, 0x81, 0x00, 0x11, 0x20, 0x18, 0x03,
+            0x00, 0xcf, 0x01, 0x0f, 0xdb, 0x00, 0x06, 0x1f, 0x33, 0x83, 0x00, 0x07, 0x01, 0xce, 0x00, 0x12,
+            0x49, 0x51, 0x00, 0x03, 0xc4, 0x01, 0x01, 0x08, 0x03, 0x03, 0xfa, 0x00, 0x0a, 0x72, 0x00, 0x03,
+            0xeb, 0x00, 0x08, 0x30, 0x03, 0xad, 0x41, 0x4c, 0x42, 0x45, 0x44, 0x4f, 0x5f, 0x4d, 0x41, 0x50,
+            0xb7, 0x07, 0x93, 0x52, 0x4f, 0x55, 0x47, 0x48, 0x4e, 0x45, 0x53, 0x53, 0x1e, 0x00, 0x07, 0x2b,
+            0x00, 0x34, 0x2b, 0x20, 0x31, 0xd6, 0x05, 0x01, 0x6e, 0x00, 0x83, 0x4d, 0x45, 0x54, 0x41, 0x4c,
+            0x4c, 0x49, 0x43, 0x2a, 0x00, 0x0a, 0x3a, 0x00, 0x0c, 0x2d, 0x00, 0x03, 0xb3, 0x05, 0x02, 0x73,
+            0x00, 0x09, 0x3a, 0x00, 0x0c, 0x2a, 0x00, 0x40, 0x41, 0x4d, 0x42, 0x49, 0xce, 0x07, 0x93, 0x4f,
+            0x43, 0x43, 0x4c, 0x55, 0x53, 0x49, 0x4f, 0x4e, 0x60, 0x00, 0x07, 0x42, 0x00, 0x0c, 0x33, 0x00,
+            0x00, 0xc9, 0x07, 0x02, 0x5a, 0x00, 0x0f, 0x3d, 0x00, 0x03, 0x00, 0x30, 0x00, 0x00, 0x24, 0x05,
+            0x20, 0x4f, 0x63, 0x22, 0x01, 0xf8, 0x17, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x52, 0x6f, 0x75, 0x67,
+            0x68, 0x6e, 0x65, 0x73, 0x73, 0x2c, 0x20, 0x4d, 0x65, 0x74, 0x61, 0x6c, 0x6c, 0x69, 0x63, 0x20,
+            0x70, 0x61, 0x63, 0x6b, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x20, 0x52, 0x47, 0x42, 0x30, 0x01, 0x01,
+            0x74, 0x07, 0x02, 0x61, 0x00, 0x04, 0x6b, 0x00, 0x00, 0x53, 0x00, 0x04, 0x5f, 0x04, 0x06, 0xaa,
+            0x0a, 0x04, 0x29, 0x00, 0x06, 0x5e, 0x04, 0xe2, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32,
+            0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0xbf, 0x04, 0x04, 0xff, 0x03, 0x31, 0x6d, 0x61, 0x70, 0x2e,
+            0x03, 0x80, 0x46, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x1e, 0x00, 0x20, 0x65, 0x72, 0x4a,
+            0x0b, 0x23, 0x3a, 0x3a, 0xcf, 0x04, 0x94, 0x4d, 0x41, 0x50, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x0a,
+            0xbc, 0x03, 0x80, 0x4d, 0x61, 0x74, 0x65, 0x72, 0x69, 0x61, 0x6c, 0xcc, 0x02, 0x03, 0xfb, 0x01,
+            0x01, 0x52, 0x04, 0x01, 0x96, 0x03, 0x48, 0x5f, 0x6d, 0x6f, 0x64, 0x4a, 0x03, 0x14, 0x72, 0xe5,
+            0x00, 0x0c, 0x19, 0x00, 0x13, 0x6d, 0xf3, 0x00, 0x0c, 0x18, 0x00, 0x03, 0xd3, 0x06, 0x24, 0x5f,
+            0x6f, 0x29, 0x01, 0x0c, 0x21, 0x00, 0x66, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x16, 0x00, 0x01,
+            0x09, 0x02, 0x02, 0xb3, 0x0a, 0x04, 0xda, 0x0b, 0x14, 0x5f, 0xb1, 0x0a, 0x01, 0xdc, 0x00, 0x62,
+            0x73, 0x65, 0x6c, 0x65, 0x63, 0x74, 0xdb, 0x0a, 0x12, 0x76, 0x3f, 0x0b, 0x31, 0x20, 0x6f, 0x6e,
+            0xc9, 0x0a, 0x81, 0x43, 0x50, 0x55, 0x20, 0x73, 0x69, 0x64, 0x65, 0x14, 0x04, 0x01, 0x49, 0x00,
+            0x00, 0x15, 0x07, 0x40, 0x5b, 0x33, 0x5d, 0x3b, 0x4d, 0x06, 0x20, 0x20, 0x20, 0xb2, 0x01, 0x0f,
+            0x1b, 0x01, 0x01, 0x04, 0x03, 0x01, 0x03, 0xb2, 0x05, 0x00, 0x0a, 0x01, 0x30, 0x3a, 0x3a, 0x5f,
+            0x3c, 0x00, 0x01, 0x4a, 0x00, 0x00, 0x10, 0x05, 0xc0, 0x6d, 0x61, 0x70, 0x5f, 0x6c, 0x61, 0x79,
+            0x65, 0x72, 0x73, 0x5b, 0x38, 0x4f, 0x00, 0xf7, 0x02, 0x2f, 0x2f, 0x20, 0x54, 0x45, 0x58, 0x54,
+            0x55, 0x52, 0x45, 0x5f, 0x41, 0x52, 0x52, 0x41, 0x59, 0x53, 0x8c, 0x00, 0x21, 0x6c, 0x79, 0x37,
+            0x00, 0x02, 0xcf, 0x03, 0x00, 0x39, 0x00, 0x21, 0x68, 0x61, 0xab, 0x0c, 0x01, 0x3a, 0x00, 0x34,
+            0x2f, 0x2f, 0x20, 0xea, 0x0c, 0x09, 0x33, 0x00, 0x42, 0x2c, 0x20, 0x30, 0x20, 0x28, 0x00, 0x01,
+            0xe3, 0x04, 0x60, 0x75, 0x6e, 0x75, 0x73, 0x65, 0x64, 0xf2, 0x05, 0x10, 0x73, 0xd4, 0x03, 0xd0,
+            0x2f, 0x2f, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x72, 0x65, 0x67, 0x69, 0xa7, 0x07, 0x01,
+            0x1c, 0x00, 0x02, 0xb9, 0x01, 0x90, 0x2c, 0x20, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x65, 0x64, 0x25,
+            0x0c, 0x00, 0xf1, 0x0b, 0xc0, 0x70, 0x65, 0x72, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
+            0x65, 0xc9, 0x0c, 0x01, 0xdf, 0x01, 0x02, 0x25, 0x00, 0x04, 0x61, 0x02, 0x0e, 0xf8, 0x04, 0x1f,
+            0x30, 0x1d, 0x04, 0x00, 0x13, 0x6d, 0x1b, 0x02, 0x04, 0xa1, 0x04, 0x04, 0x28, 0x01, 0x00, 0x21,
+            0x01, 0x05, 0x59, 0x00, 0x00, 0xa9, 0x04, 0x03, 0xa3, 0x00, 0x0e, 0xe3, 0x0d, 0x62, 0x20, 0x62,
+            0x75, 0x69, 0x6c, 0x64, 0xad, 0x01, 0x01, 0x12, 0x0d, 0x70, 0x76, 0x65, 0x20, 0x70, 0x61, 0x73,
+            0x73, 0x7b, 0x0c, 0xb1, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x42, 0x68,
+            0x05, 0x04, 0xce, 0x0c, 0xf0, 0x04, 0x68, 0x61, 0x73, 0x20, 0x6e, 0x6f, 0x20, 0x76, 0x65, 0x72,
+            0x74, 0x65, 0x78, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0xef, 0x01, 0x11, 0x6f, 0x98, 0x05, 0x10,
+            0x2c, 0xad, 0x06, 0x00, 0xe5, 0x00, 0x21, 0x69, 0x6e, 0x17, 0x00, 0x02, 0x18, 0x06, 0x00, 0x3e,
+            0x0d, 0x21, 0x72, 0x65, 0x44, 0x0c, 0x00, 0x90, 0x06, 0x71, 0x65, 0x64, 0x20, 0x66, 0x72, 0x6f,
+            0x6d, 0x14, 0x02, 0x15, 0x76, 0x66, 0x00, 0x04, 0xcf, 0x05, 0x00, 0xdb, 0x06, 0x00, 0x42, 0x00,
+            0x02, 0xf7, 0x0c, 0x01, 0x7b, 0x00, 0x11, 0x73, 0x30, 0x01, 0x30, 0x65, 0x61, 0x64, 0xfb, 0x0c,
+            0x00, 0xfa, 0x0c, 0x0e, 0xca, 0x00, 0x00, 0x78, 0x00, 0x16, 0x52, 0x63, 0x00, 0x02, 0xd3, 0x00,
+            0x13, 0x66, 0x68, 0x03, 0x01, 0x80, 0x03, 0x01, 0x76, 0x01, 0x01, 0x95, 0x00, 0x33, 0x6f, 0x66,
+            0x20, 0x56, 0x0e, 0x10, 0x2e, 0xc6, 0x00, 0x51, 0x2e, 0x67, 0x6c, 0x73, 0x6c, 0xd6, 0x01, 0x00,
+            0x77, 0x00, 0x0f, 0x07, 0x01, 0x0d, 0x10, 0x2e, 0x6a, 0x00, 0xf2, 0x04, 0x54, 0x68, 0x65, 0x20,
+            0x70, 0x69, 0x78, 0x65, 0x6c, 0x27, 0x73, 0x20, 0x49, 0x44, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x72,
+            0x00, 0x05, 0xd8, 0x01, 0x01, 0xc6, 0x00, 0x00, 0x3d, 0x0e, 0x21, 0x67, 0x6c, 0x08, 0x0e, 0x31,
+            0x6f, 0x73, 0x65, 0x33, 0x01, 0x00, 0x13, 0x06, 0x01, 0x4e, 0x0e, 0x58, 0x66, 0x65, 0x74, 0x63,
+            0x68, 0x0a, 0x01, 0x08, 0xf0, 0x00, 0x02, 0x47, 0x01, 0x40, 0x72, 0x61, 0x6e, 0x73, 0x05, 0x0f,
+            0x00, 0x70, 0x0e, 0x10, 0x6e, 0xa7, 0x04, 0xf0, 0x04, 0x74, 0x65, 0x72, 0x70, 0x6f, 0x6c, 0x61,
+            0x74, 0x65, 0x64, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x70, 0x65, 0x72, 0x95, 0x0e, 0x01, 0x40,
+            0x0e, 0x30, 0x63, 0x6f, 0x72, 0x47, 0x0a, 0x80, 0x20, 0x62, 0x61, 0x72, 0x79, 0x63, 0x65, 0x6e,
+            0xc1, 0x08, 0x90, 0x73, 0x2e, 0x20, 0x44, 0x65, 0x72, 0x69, 0x76, 0x61, 0x21, 0x00, 0x02, 0x81,
+            0x09, 0x20, 0x64, 0x69, 0x33, 0x07, 0x32, 0x65, 0x6e, 0x63, 0x8f, 0x0e, 0x21, 0x74, 0x6f, 0x85,
+            0x01, 0x08, 0x34, 0x00, 0x00, 0xfb, 0x01, 0x01, 0x08, 0x01, 0x00, 0xe6, 0x0a, 0x01, 0x5a, 0x0a,
+            0x20, 0x75, 0x70, 0xb2, 0x02, 0x94, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0xce,
+            0x03, 0x47, 0x73, 0x61, 0x6d, 0x65, 0xe3, 0x00, 0x91, 0x6c, 0x69, 0x6b, 0x65, 0x20, 0x64, 0x46,
+            0x64, 0x78, 0x34, 0x00, 0x40, 0x64, 0x46, 0x64, 0x79, 0x4a, 0x00, 0x61, 0x61, 0x20, 0x71, 0x75,
+            0x61, 0x64, 0x34, 0x01, 0x10, 0x4f, 0xb3, 0x07, 0x01, 0x35, 0x01, 0x01, 0x5f, 0x02, 0x01, 0x64,
+            0x00, 0x00, 0x85, 0x0f, 0x82, 0x76, 0x65, 0x64, 0x20, 0x64, 0x72, 0x61, 0x77, 0x79, 0x02, 0x00,
+            0x17, 0x00, 0x83, 0x47, 0x4c, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x13, 0x09, 0x80, 0x74, 0x65,
+            0x73, 0x74, 0x20, 0x61, 0x67, 0x61, 0x5c, 0x01, 0x01, 0xaf, 0x00, 0x84, 0x63, 0x6c, 0x61, 0x73,
+            0x73, 0x69, 0x66, 0x69, 0x39, 0x00, 0x01, 0x27, 0x00, 0x14, 0x2e, 0x3c, 0x03, 0x64, 0x65, 0x61,
+            0x72, 0x6c, 0x79, 0x5f, 0xfb, 0x01, 0x10, 0x5f, 0x3e, 0x00, 0x74, 0x73, 0x29, 0x20, 0x69, 0x6e,
+            0x3b, 0x0a, 0x22, 0x00, 0x06, 0xbf, 0x05, 0x16, 0x38, 0xb8, 0x05, 0x15, 0x75, 0xb9, 0x05, 0x07,
+            0x94, 0x02, 0x32, 0x5f, 0x69, 0x64, 0xa6, 0x09, 0x0c, 0x0d, 0x03, 0x42, 0x3a, 0x3a, 0x49, 0x44,
+            0xa8, 0x05, 0x03, 0xcf, 0x07, 0x40, 0x6c, 0x6f, 0x63, 0x61, 0x49, 0x09, 0x0a, 0x4c, 0x0c, 0x01,
+            0xe5, 0x04, 0x00, 0xdd, 0x00, 0x55, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x9f, 0x0a, 0x07, 0x2d, 0x00,
+            0x07, 0x98, 0x0a, 0x01, 0x2d, 0x00, 0x04, 0x51, 0x01, 0x03, 0x48, 0x0b, 0x04, 0xb3, 0x00, 0x07,
+            0x32, 0x00, 0x16, 0x33, 0xb4, 0x00, 0x01, 0x6c, 0x0d, 0x03, 0x5e, 0x04, 0x02, 0x56, 0x0b, 0x13,
+            0x49, 0x58, 0x04, 0x00, 0x03, 0x04, 0x11, 0x2c, 0x2d, 0x01, 0x02, 0x4b, 0x04, 0x13, 0x20, 0x0a,
+            0x0a, 0xe0, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x72, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x75, 0x70,
+            0xbc, 0x0a, 0x00, 0x71, 0x01, 0xf4, 0x01, 0x70, 0x61, 0x64, 0x64, 0x65, 0x64, 0x20, 0x31, 0x34,
+            0x34, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x7c, 0x06, 0x06, 0xf6, 0x00, 0x04, 0x58, 0x00, 0x03,
+            0x82, 0x06, 0x01, 0x2d, 0x0b, 0x52, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x7e, 0x06, 0x01, 0x10, 0x00,
+            0x04, 0x8f, 0x11, 0x07, 0x18, 0x00, 0x01, 0xd3, 0x00, 0x04, 0xa7, 0x04, 0x01, 0x81, 0x09, 0x23,
+            0x2f, 0x2f, 0xe8, 0x03, 0x0f, 0x05, 0x02, 0x03, 0x12, 0x2c, 0x73, 0x0a, 0x10, 0x61, 0x3c, 0x07,
+            0x02, 0xb2, 0x02, 0x10, 0x74, 0x88, 0x02, 0x24, 0x6c, 0x79, 0xac, 0x07, 0x01, 0x91, 0x0c, 0x14,
+            0x73, 0x17, 0x01, 0x02, 0xdd, 0x00, 0x08, 0x3b, 0x12, 0x1f, 0x38, 0x28, 0x05, 0x00, 0x06, 0xd0,
+            0x01, 0x04, 0xc7, 0x00, 0x04, 0x32, 0x05, 0x0e, 0xe1, 0x00, 0x09, 0xfd, 0x01, 0x03, 0x4d, 0x01,
+            0x04, 0x43, 0x05, 0x03, 0xeb, 0x01, 0x0e, 0x75, 0x00, 0x1f, 0x39, 0x75, 0x00, 0x0a, 0x13, 0x50,
+            0x64, 0x0b, 0x04, 0x75, 0x00, 0x01, 0xc3, 0x00, 0x08, 0x68, 0x00, 0x04, 0x85, 0x0b, 0x0f, 0x68,
+            0x00, 0x0e, 0x1f, 0x31, 0x06, 0x06, 0x01, 0x06, 0xde, 0x00, 0x30, 0x45, 0x6c, 0x65, 0x56, 0x08,
+            0x04, 0x68, 0x00, 0x01, 0x7d, 0x01, 0x06, 0x1e, 0x00, 0x23, 0x5f, 0x65, 0x1f, 0x00, 0x03, 0x20,
+            0x0a, 0x0f, 0xce, 0x00, 0x06, 0x1f, 0x31, 0x64, 0x0b, 0x01, 0x06, 0x48, 0x00, 0x01, 0xda, 0x0e,
+            0x04, 0x64, 0x00, 0x01, 0xdd, 0x0c, 0x06, 0x1c, 0x00, 0x11, 0x5f, 0x96, 0x08, 0x0f, 0xc8, 0x00,
+            0x0f, 0x0f, 0x6e, 0x0b, 0x01, 0x06, 0x46, 0x00, 0x27, 0x55, 0x56, 0x5f, 0x00, 0x18, 0x32, 0x2a,
+            0x01, 0x2f, 0x75, 0x76, 0x5c, 0x00, 0x0f, 0x0f, 0x47, 0x0b, 0x01, 0x06, 0x5c, 0x00, 0x11, 0x4e,
+            0xd0, 0x08, 0x04, 0x60, 0x00, 0x0d, 0x8b, 0x01, 0x02, 0xef, 0x08, 0x0f, 0x65, 0x00, 0x0f, 0x1f,
+            0x34, 0xf2, 0x01, 0x0a, 0x10, 0x54, 0x42, 0x0d, 0x2f, 0x6e, 0x74, 0x66, 0x00, 0x06, 0x13, 0x74,
+            0x20, 0x00, 0x03, 0x8a, 0x01, 0x11, 0x0a, 0xaa, 0x01, 0x00, 0xb2, 0x04, 0x00, 0x7a, 0x0e, 0x01,
+            0x0f, 0x08, 0x2f, 0x3b, 0x0a, 0xcd, 0x07, 0x02, 0x31, 0x3b, 0x0a, 0x0a, 0x72, 0x01, 0x01, 0x2c,
+            0x00, 0x00, 0x36, 0x0e, 0x57, 0x5f, 0x70, 0x6f, 0x73, 0x3b, 0x14, 0x00, 0x0b, 0x0f, 0x00, 0x01,
+            0x8f, 0x01, 0x01, 0x20, 0x00, 0x12, 0x32, 0x34, 0x00, 0x21, 0x75, 0x76, 0x0e, 0x00, 0x12, 0x33,
+            0x0e, 0x00, 0x01, 0x42, 0x00, 0x02, 0xf3, 0x00, 0x0d, 0x17, 0x00, 0x03, 0xa4, 0x00, 0x0d, 0x18,
+            0x00, 0x2f, 0x62, 0x69, 0x1a, 0x00, 0x05, 0x77, 0x70, 0x6f, 0x73, 0x5f, 0x64, 0x78, 0x2c, 0x5b,
+            0x00, 0x01, 0x12, 0x00, 0x11, 0x79, 0x43, 0x00, 0x05, 0x80, 0x00, 0x06, 0x23, 0x00, 0x52, 0x75,
+            0x76, 0x5f, 0x64, 0x79, 0xd2, 0x00, 0x30, 0x33, 0x20, 0x46, 0x0f, 0x07, 0x51, 0x56, 0x65, 0x63,
+            0x33, 0x28, 0x0d, 0x01, 0x00, 0x98, 0x07, 0x32, 0x65, 0x78, 0x2c, 0x72, 0x14, 0x02, 0x1b, 0x15,
+            0x13, 0x29, 0x7c, 0x04, 0x01, 0x20, 0x00, 0x31, 0x69, 0x20, 0x3d, 0x4f, 0x07, 0x72, 0x65, 0x78,
+            0x20, 0x2a, 0x20, 0x33, 0x75, 0x86, 0x04, 0x32, 0x69, 0x66, 0x28, 0x2b, 0x00, 0x00, 0xb7, 0x14,
+            0x03, 0x3e, 0x0c, 0x00, 0xf9, 0x11, 0x01, 0xef, 0x09, 0x00, 0x63, 0x0a, 0x61, 0x72, 0x65, 0x74,
+            0x75, 0x72, 0x6e, 0x63, 0x04, 0x16, 0x28, 0x13, 0x02, 0x03, 0x02, 0x01, 0x58, 0x73, 0x5b, 0x69,
+            0x5d, 0x2c, 0x6d, 0x02, 0x05, 0x17, 0x00, 0x5f, 0x20, 0x2b, 0x20, 0x31, 0x75, 0x1c, 0x00, 0x07,
+            0x4f, 0x32, 0x75, 0x5d, 0x29, 0x81, 0x00, 0x00, 0x08, 0x7b, 0x12, 0x0f, 0x82, 0x00, 0x0d, 0x03,
+            0x53, 0x01, 0x0d, 0x83, 0x00, 0x06, 0x18, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x09, 0x1d, 0x00, 0x06,
+            0x85, 0x00, 0x0f, 0xe5, 0x00, 0x04, 0x06, 0x65, 0x04, 0x0b, 0xe7, 0x00, 0x07, 0x19, 0x00, 0x0f,
+            0x65, 0x00, 0x00, 0x0a, 0x1e, 0x00, 0x02, 0x66, 0x00, 0x11, 0x7d, 0xc1, 0x11, 0x0f, 0x7d, 0x08,
+            0x0d, 0x00, 0xff, 0x07, 0x00, 0x5d, 0x06, 0x04, 0xd2, 0x06, 0x00, 0x34, 0x17, 0x74, 0x61, 0x6e,
+            0x20, 0x4e, 0x44, 0x43, 0x20, 0x55, 0x00, 0x00, 0xb9, 0x02, 0x37, 0x33, 0x20, 0x42, 0xb2, 0x08,
+            0xc1, 0x28, 0x6d, 0x61, 0x74, 0x33, 0x78, 0x34, 0x20, 0x63, 0x6c, 0x69, 0x70, 0x0c, 0x06, 0x54,
+            0x32, 0x20, 0x6e, 0x64, 0x63, 0xfb, 0x01, 0x01, 0x1c, 0x06, 0x04, 0x67, 0x06, 0x10, 0x77, 0x6b,
+            0x07, 0x42, 0x2e, 0x66, 0x20, 0x2f, 0xd0, 0x01, 0x00, 0x32, 0x00, 0x61, 0x5b, 0x30, 0x5d, 0x2e,
+            0x77, 0x2c, 0x3d, 0x00, 0x26, 0x5b, 0x31, 0x0b, 0x00, 0x43, 0x32, 0x5d, 0x2e, 0x77, 0xa2, 0x01,
+            0x01, 0xfc, 0x17, 0x42, 0x70, 0x30, 0x20, 0x3d, 0x25, 0x00, 0x75, 0x30, 0x5d, 0x2e, 0x78, 0x79,
+            0x20, 0x2a, 0x4a, 0x18, 0x32, 0x77, 0x2e, 0x78, 0xca, 0x01, 0x01, 0x28, 0x00, 0x24, 0x65, 0x31,
+            0x28, 0x00, 0x1d, 0x31, 0x28, 0x00, 0x68, 0x79, 0x20, 0x2d, 0x20, 0x70, 0x30, 0x2d, 0x00, 0x14,
+            0x32, 0x2d, 0x00, 0x1d, 0x32, 0x2d, 0x00, 0x1c, 0x7a, 0x2d, 0x00, 0x30, 0x64, 0x20, 0x3d, 0xd8,
+            0x00, 0x07, 0x17, 0x00, 0x02, 0x8a, 0x04, 0x04, 0xdc, 0x00, 0x45, 0x61, 0x72, 0x65, 0x61, 0xdf,
+            0x00, 0x40, 0x28, 0x65, 0x31, 0x2e, 0xe7, 0x02, 0x21, 0x65, 0x32, 0x76, 0x00, 0x30, 0x65, 0x31,
+            0x2e, 0xb3, 0x00, 0x43, 0x65, 0x32, 0x2e, 0x78, 0xd5, 0x00, 0x02, 0x3c, 0x00, 0x10, 0x62, 0xae,
+            0x00, 0x28, 0x28, 0x64, 0x2b, 0x00, 0x16, 0x64, 0x2a, 0x00, 0x07, 0xe5, 0x00, 0x00, 0x5d, 0x00,
+            0x02, 0xb9, 0x00, 0x03, 0x39, 0x00, 0x00, 0xba, 0x00, 0x04, 0x65, 0x00, 0x00, 0x33, 0x00, 0x05,
+            0x64, 0x00, 0x1f, 0x64, 0x39, 0x00, 0x05, 0x01, 0x89, 0x01, 0x10, 0x77, 0x12, 0x0a, 0x21, 0x74,
+            0x73, 0x8a, 0x03, 0xb0, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x66, 0x20, 0x2d, 0x20, 0x62, 0x31, 0x05,
+            0x00, 0x98, 0x32, 0x2c, 0x20, 0x62, 0x31, 0x2c, 0x20, 0x62, 0x32, 0x3f, 0x00, 0x03, 0xa4, 0x19,
+            0x03, 0xa0, 0x02, 0x04, 0x3e, 0x00, 0x33, 0x2f, 0x20, 0x28, 0x0b, 0x00, 0x54, 0x2e, 0x78, 0x20,
+            0x2b, 0x20, 0x0c, 0x00, 0x17, 0x79, 0x0c, 0x00, 0xb8, 0x7a, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a,
+            0x76, 0x6f, 0x69, 0x64, 0xe4, 0x0b, 0x04, 0x2b, 0x0e, 0x14, 0x28, 0x1f, 0x02, 0x01, 0x1a, 0x04,
+            0x00, 0x2a, 0x09, 0x30, 0x6c, 0x5f, 0x69, 0x62, 0x01, 0x51, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x59,
+            0x04, 0x08, 0xee, 0x03, 0x60, 0x69, 0x64, 0x73, 0x2c, 0x20, 0x69, 0xe1, 0x01, 0x40, 0x28, 0x67,
+            0x6c, 0x5f, 0x45, 0x00, 0xf1, 0x02, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x78, 0x79, 0x29, 0x2c,
+            0x20, 0x30, 0x29, 0x2e, 0x72, 0x20, 0x2d, 0x90, 0x0a, 0x03, 0xb3, 0x09, 0x00, 0x38, 0x04, 0x01,
+            0x59, 0x00, 0x00, 0x7f, 0x0a, 0x01, 0xb3, 0x0d, 0x16, 0x3d, 0x64, 0x00, 0x15, 0x2f, 0x01, 0x0b,
+            0x04, 0xb0, 0x09, 0x05, 0x2f, 0x00, 0x05, 0xf7, 0x02, 0x07, 0x2f, 0x00, 0x11, 0x2d, 0xc8, 0x0c,
+            0x01, 0x45, 0x00, 0x1f, 0x2a, 0x3a, 0x00, 0x02, 0x0f, 0x90, 0x08, 0x00, 0x30, 0x64, 0x61, 0x74,
+            0x0b, 0x02, 0x08, 0xc1, 0x00, 0x05, 0x97, 0x08, 0x04, 0x93, 0x00, 0x13, 0x5d, 0xcf, 0x01, 0x08,
+            0x42, 0x06, 0x21, 0x20, 0x3d, 0x3b, 0x00, 0x16, 0x2e, 0x7e, 0x09, 0x00, 0x9b, 0x00, 0x04, 0x0e,
+            0x00, 0x27, 0x20, 0x3d, 0x21, 0x0e, 0x01, 0x1a, 0x06, 0x04, 0x1a, 0x00, 0x31, 0x5d, 0x3b, 0x0a,
+            0xae, 0x04, 0x00, 0x1f, 0x0f, 0x11, 0x33, 0x64, 0x05, 0x01, 0xb3, 0x0c, 0x12, 0x3d, 0x11, 0x00,
+            0x15, 0x28, 0xd7, 0x00, 0x00, 0x77, 0x05, 0x33, 0x29, 0x20, 0x2b, 0x17, 0x00, 0xa3, 0x30, 0x75,
+            0x2c, 0x20, 0x31, 0x75, 0x2c, 0x20, 0x32, 0x75, 0x94, 0x02, 0x33, 0x69, 0x66, 0x28, 0x99, 0x0a,
+            0x11, 0x29, 0x4f, 0x00, 0x00, 0x7d, 0x00, 0x00, 0xd5, 0x05, 0x09, 0x4d, 0x00, 0x07, 0xd5, 0x00,
+            0x05, 0x9d, 0x08, 0x04, 0x25, 0x00, 0x2a, 0x2e, 0x78, 0x72, 0x05, 0x0e, 0x21, 0x00, 0x1f, 0x79,
+            0x21, 0x00, 0x0d, 0x10, 0x7a, 0x98, 0x05, 0x01, 0x7e, 0x00, 0x01, 0xa0, 0x0a, 0x00, 0xee, 0x06,
+            0x10, 0x4d, 0xb4, 0x0a, 0x00, 0xb2, 0x02, 0x53, 0x69, 0x65, 0x77, 0x20, 0x2a, 0x22, 0x01, 0x00,
+            0x14, 0x00, 0x02, 0x42, 0x01, 0x03, 0x7e, 0x04, 0x00, 0x2a, 0x00, 0x00, 0x5a, 0x07, 0x01, 0x1b,
+            0x15, 0x12, 0x73, 0x51, 0x04, 0x02, 0x21, 0x00, 0x40, 0x66, 0x6f, 0x72, 0x28, 0x70, 0x10, 0x00,
+            0x80, 0x06, 0xd2, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x33, 0x3b, 0x20, 0x69, 0x2b, 0x2b,
+            0xe6, 0x00, 0x02, 0x9d, 0x1c, 0x01, 0xec, 0x00, 0x44, 0x69, 0x65, 0x77, 0x5f, 0xe8, 0x04, 0x00,
+            0xd8, 0x05, 0x03, 0x75, 0x00, 0x02, 0x81, 0x00, 0x10, 0x2a, 0xb4, 0x04, 0x21, 0x34, 0x28, 0x9c,
+            0x02, 0x01, 0xf5, 0x06, 0x04, 0xf6, 0x00, 0x01, 0x84, 0x06, 0x03, 0x62, 0x1b, 0x63, 0x29, 0x2c,
+            0x20, 0x31, 0x2e, 0x66, 0x50, 0x01, 0x00, 0x54, 0x00, 0x01, 0xe3, 0x04, 0x47, 0x69, 0x5d, 0x20,
+            0x3d, 0xd4, 0x1c, 0x22, 0x20, 0x2a, 0x59, 0x15, 0x08, 0x6b, 0x00, 0x02, 0xab, 0x00, 0x11, 0x7d,
+            0xfa, 0x00, 0x00, 0xe8, 0x02, 0x02, 0xab, 0x0e, 0x44, 0x20, 0x3d, 0x20, 0x32, 0x2f, 0x05, 0x21,
+            0x32, 0x28, 0xe7, 0x0e, 0x01, 0x00, 0x1d, 0x03, 0x61, 0x00, 0x01, 0x29, 0x00, 0x6b, 0x6e, 0x64,
+            0x63, 0x20, 0x3d, 0x20, 0x17, 0x03, 0x23, 0x20, 0x2a, 0x41, 0x00, 0x10, 0x2d, 0x90, 0x00, 0x02,
+            0x5d, 0x00, 0x01, 0x01, 0x04, 0x3a, 0x62, 0x20, 0x3d, 0xbd, 0x05, 0x00, 0xa1, 0x00, 0x10, 0x2c,
+            0xd9, 0x04, 0x06, 0x54, 0x00, 0x6f, 0x33, 0x20, 0x62, 0x5f, 0x64, 0x78, 0x29, 0x00, 0x06, 0x20,
+            0x20, 0x2b, 0x0a, 0x01, 0x21, 0x32, 0x28, 0x18, 0x0e, 0x90, 0x2e, 0x78, 0x2c, 0x20, 0x30, 0x2e,
+            0x66, 0x29, 0x29, 0x43, 0x04, 0x08, 0x68, 0x00, 0x3f, 0x5f, 0x64, 0x79, 0x42, 0x00, 0x0e, 0x42,
+            0x30, 0x2e, 0x66, 0x2c, 0xa8, 0x00, 0x24, 0x2e, 0x79, 0x42, 0x00, 0x01, 0x02, 0x01, 0x01, 0xde,
+            0x02, 0x04, 0xd2, 0x01, 0x03, 0x86, 0x01, 0x06, 0x9a, 0x01, 0x24, 0x20, 0x2a, 0x6b, 0x00, 0x01,
+            0x28, 0x00, 0x20, 0x70, 0x6f, 0xd0, 0x04, 0x09, 0x5f, 0x01, 0x01, 0x18, 0x00, 0x04, 0x40, 0x00,
+            0x07, 0x2b, 0x00, 0x04, 0x13, 0x00, 0x02, 0xdf, 0x00, 0x00, 0x11, 0x01, 0x14, 0x28, 0x13, 0x00,
+            0x02, 0x38, 0x02, 0x00, 0x5b, 0x00, 0x25, 0x5f, 0x64, 0xa5, 0x05, 0x00, 0x9d, 0x03, 0x04, 0x21,
+            0x00, 0x02, 0xd1, 0x00, 0x0f, 0x34, 0x00, 0x06, 0x23, 0x79, 0x29, 0x85, 0x03, 0x01, 0x7c, 0x00,
+            0x01, 0xc5, 0x09, 0x00, 0xb9, 0x00, 0x30, 0x65, 0x63, 0x34, 0x66, 0x05, 0x03, 0x5d, 0x01, 0x23,
+            0x69, 0x66, 0x7e, 0x1b, 0x03, 0xfd, 0x1a, 0x02, 0x82, 0x02, 0x00, 0x28, 0x02, 0x09, 0x36, 0x00,
+            0x02, 0xd3, 0x02, 0x08, 0x01, 0x05, 0x01, 0x50, 0x00, 0x24, 0x73, 0x5b, 0x73, 0x02, 0x0c, 0x69,
+            0x03, 0x0c, 0x1f, 0x00, 0x0b, 0x67, 0x03, 0x0c, 0x1f, 0x00, 0x20, 0x7a, 0x5d, 0xe4, 0x05, 0x08,
+            0x44, 0x01, 0x22, 0x75, 0x76, 0xad, 0x00, 0x20, 0x32, 0x28, 0xcd, 0x01, 0x07, 0x32, 0x01, 0x00,
+            0xf1, 0x09, 0x00, 0x0b, 0x02, 0x01, 0xa0, 0x00, 0x00, 0x0d, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x78,
+            0x02, 0x07, 0x29, 0x00, 0x36, 0x69, 0x66, 0x28, 0x3d, 0x1c, 0x02, 0xd3, 0x00, 0x06, 0x55, 0x03,
+            0x01, 0xcc, 0x00, 0x40, 0x32, 0x20, 0x75, 0x76, 0xa5, 0x01, 0x02, 0x0d, 0x00, 0x08, 0xd9, 0x00,
+            0x00, 0x1e, 0x0c, 0x0f, 0xd6, 0x00, 0x05, 0x09, 0x1c, 0x00, 0x0b, 0xd3, 0x00, 0x09, 0x1c, 0x00,
+            0x01, 0x35, 0x04, 0x00, 0x46, 0x01, 0x00, 0x04, 0x00, 0x03, 0xaa, 0x00, 0x01, 0xfe, 0x04, 0x01,
+            0xd0, 0x01, 0x02, 0xce, 0x00, 0x07, 0x1b, 0x00, 0x02, 0xfe, 0x01, 0x00, 0x92, 0x00, 0x11, 0x2a,
+            0xea, 0x02, 0x0f, 0x21, 0x00, 0x00, 0x00, 0xe6, 0x00, 0x05, 0x21, 0x00, 0x12, 0x79, 0x21, 0x00,
+            0x02, 0x9d, 0x03, 0x33, 0x69, 0x66, 0x28, 0xa7, 0x0a, 0x09, 0xc4, 0x01, 0x0a, 0xf1, 0x00, 0x12,
+            0x20, 0x88, 0x0a, 0x00, 0xd9, 0x05, 0x20, 0x72, 0x69, 0x3f, 0x01, 0x00, 0xf9, 0x00, 0x11, 0x28,
+            0x1d, 0x12, 0x51, 0x70, 0x6f, 0x73, 0x65, 0x28, 0xe6, 0x05, 0x04, 0x39, 0x08, 0x01, 0x7c, 0x0f,
+            0x07, 0xb3, 0x07, 0x00, 0x71, 0x02, 0x13, 0x29, 0x31, 0x02, 0x00, 0xb6, 0x00, 0x00, 0x3c, 0x00,
+            0x03, 0x51, 0x00, 0x34, 0x73, 0x2c, 0x20, 0x42, 0x0a, 0x00, 0x41, 0x0f, 0x04, 0x0c, 0x00, 0x02,
+            0xa0, 0x00, 0x00, 0x2c, 0x00, 0x0f, 0xec, 0x04, 0x0c, 0x00, 0x23, 0x00, 0x06, 0xaa, 0x00, 0x00,
+            0x0e, 0x00, 0x02, 0xa9, 0x00, 0x03, 0xed, 0x04, 0x02, 0x0d, 0x00, 0x04, 0xb6, 0x00, 0x17, 0x2a,
+            0xe1, 0x0b, 0x04, 0xa3, 0x01, 0x01, 0xec, 0x04, 0x03, 0x00, 0x01, 0x00, 0xa7, 0x0b, 0x06, 0x7a,
+            0x00, 0x00, 0x4d, 0x00, 0x34, 0x69, 0x66, 0x28, 0x42, 0x0b, 0x09, 0x1d, 0x01, 0x00, 0x1c, 0x00,
+            0x00, 0x04, 0x00, 0x0a, 0x7b, 0x00, 0x00, 0x12, 0x00, 0x04, 0xc2, 0x00, 0x02, 0x23, 0x05, 0x00,
+            0xea, 0x00, 0x01, 0x91, 0x03, 0x01, 0x72, 0x05, 0x00, 0xa4, 0x02, 0x0f, 0x6e, 0x05, 0x04, 0x04,
+            0x66, 0x00, 0x0e, 0x83, 0x00, 0x00, 0x55, 0x00, 0x05, 0xef, 0x0c, 0x03, 0xd7, 0x00, 0x62, 0x63,
+            0x72, 0x6f, 0x73, 0x73, 0x28, 0xdd, 0x00, 0x00, 0x13, 0x00, 0x06, 0x45, 0x01, 0x20, 0x5b, 0x69,
+            0x6f, 0x06, 0x00, 0x34, 0x00, 0x04, 0x04, 0x00, 0x02, 0xe5, 0x01, 0x00, 0x0e, 0x00, 0x06, 0x0a,
+            0x00, 0x01, 0x52, 0x02, 0x00, 0x96, 0x01, 0x03, 0x76, 0x0c, 0x00, 0x09, 0x0a, 0x02, 0x93, 0x0e,
+            0x0a, 0x5f, 0x02, 0x0f, 0xff, 0x00, 0x09, 0x0a, 0xfb, 0x00, 0x06, 0x52, 0x00, 0x03, 0x01, 0x01,
+            0x25, 0x20, 0x3d, 0xd9, 0x01, 0x0a, 0x54, 0x00, 0x00, 0x8a, 0x00, 0x06, 0x2e, 0x00, 0x05, 0xda,
+            0x00, 0x20, 0x20, 0x3d, 0x73, 0x22, 0x03, 0x93, 0x0e, 0x0a, 0x32, 0x00, 0x02, 0xb8, 0x00, 0xd0,
+            0x7d, 0x0a, 0x7d, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x66, 0x6c, 0x61, 0xec, 0x1a, 0x02,
+            0x97, 0x0d, 0x01, 0x4b, 0x00, 0x04, 0x37, 0x08, 0x0f, 0xb1, 0x0e, 0x04, 0x0f, 0x68, 0x08, 0x0b,
+            0x20, 0x69, 0x6e, 0xfe, 0x05, 0x1a, 0x34, 0x32, 0x0e, 0x1a, 0x3b, 0x17, 0x00, 0x01, 0xd2, 0x0e,
+            0x09, 0x12, 0x00, 0x01, 0x82, 0x04, 0x04, 0x26, 0x00, 0x05, 0x58, 0x0e, 0x04, 0x11, 0x00, 0x0f,
+            0xdb, 0x0e, 0x01, 0x02, 0x3f, 0x00, 0x08, 0x1a, 0x00, 0x03, 0x2b, 0x01, 0x0f, 0x35, 0x00, 0x01,
+            0x05, 0x18, 0x01, 0x14, 0x3b, 0x3e, 0x23, 0x01, 0xf2, 0x15, 0x03, 0x4e, 0x18, 0x01, 0x24, 0x23,
+            0x12, 0x69, 0xed, 0x15, 0x02, 0x07, 0x19, 0x05, 0xf3, 0x1d, 0x04, 0x07, 0x19, 0x04, 0xf9, 0x0c,
+            0x04, 0x1b, 0x01, 0x02, 0x2d, 0x00, 0x04, 0x80, 0x18, 0x31, 0x69, 0x73, 0x20, 0x3b, 0x18, 0x00,
+            0xc1, 0x15, 0x01, 0xe7, 0x15, 0x40, 0x6d, 0x61, 0x70, 0x73, 0x47, 0x17, 0x00, 0x1a, 0x19, 0x00,
+            0x3b, 0x00, 0x21, 0x69, 0x74, 0x20, 0x16, 0x10, 0x6e, 0x51, 0x18, 0x12, 0x20, 0x95, 0x14, 0x30,
+            0x64, 0x2e, 0x20, 0x02, 0x1f, 0x00, 0x3e, 0x0a, 0x34, 0x69, 0x64, 0x65, 0x22, 0x00, 0x91, 0x73,
+            0x74, 0x69, 0x6c, 0x6c, 0x20, 0x63, 0x68, 0x65, 0xc5, 0x1a, 0x08, 0x21, 0x15, 0x04, 0x7a, 0x00,
+            0x01, 0x60, 0x00, 0x02, 0x84, 0x24, 0x50, 0x69, 0x73, 0x20, 0x77, 0x68, 0xe2, 0x24, 0x10, 0x65,
+            0xce, 0x24, 0x00, 0x41, 0x08, 0x42, 0x67, 0x72, 0x61, 0x6d, 0x47, 0x16, 0x30, 0x61, 0x6c, 0x6c,
+            0x02, 0x02, 0x20, 0x73, 0x20, 0xca, 0x1c, 0x00, 0xae, 0x14, 0x45, 0x20, 0x61, 0x6e, 0x79, 0x20,
+            0x0a, 0x10, 0x2e, 0x75, 0x17, 0x01, 0x70, 0x24, 0x04, 0x52, 0x19, 0x00, 0x04, 0x01, 0x05, 0x71,
+            0x24, 0x08, 0x15, 0x00, 0x0f, 0x72, 0x24, 0x00, 0x00, 0xd0, 0x1a, 0x03, 0xc0, 0x03, 0x41, 0x28,
+            0x6d, 0x61, 0x70, 0x6f, 0x24, 0x19, 0x28, 0x34, 0x00, 0x16, 0x26, 0x6a, 0x00, 0x02, 0x51, 0x01,
+            0x0d, 0x58, 0x1a, 0x40, 0x29, 0x20, 0x3e, 0x3e, 0x6b, 0x19, 0x0c, 0x95, 0x24, 0x26, 0x2f, 0x2f,
+            0x96, 0x16, 0x00, 0x1e, 0x25, 0x01, 0x45, 0x08, 0x0c, 0x58, 0x14, 0x41, 0x20, 0x6d, 0x61, 0x79,
+            0x87, 0x18, 0x20, 0x6e, 0x67, 0xef, 0x14, 0x55, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x7c, 0x0b, 0x00,
+            0x39, 0x1f, 0x10, 0x6f, 0x50, 0x01, 0x00, 0xf5, 0x18, 0xf0, 0x03, 0x65, 0x73, 0x20, 0x69, 0x74,
+            0x73, 0x20, 0x6f, 0x77, 0x6e, 0x20, 0x75, 0x76, 0x20, 0x67, 0x72, 0x61, 0x64, 0xee, 0x21, 0x11,
+            0x73, 0x45, 0x01, 0x01, 0x13, 0x21, 0x01, 0xc2, 0x19, 0x24, 0x32, 0x5e, 0x25, 0x26, 0x00, 0x4f,
+            0x00, 0x51, 0x6d, 0x61, 0x74, 0x63, 0x68, 0x68, 0x15, 0x00, 0x16, 0x21, 0x00, 0xbf, 0x01, 0x00,
+            0xf3, 0x0e, 0xc0, 0x66, 0x6f, 0x72, 0x77, 0x61, 0x72, 0x64, 0x20, 0x70, 0x61, 0x74, 0x68, 0x3e,
+            0x01, 0x0f, 0xb3, 0x18, 0x04, 0x04, 0x96, 0x25, 0xa2, 0x53, 0x41, 0x4d, 0x50, 0x4c, 0x45, 0x5f,
+            0x32, 0x44, 0x28, 0xef, 0x01, 0x40, 0x72, 0x2c, 0x20, 0x63, 0x93, 0x0c, 0x14, 0x29, 0x5b, 0x02,
+            0x4b, 0x47, 0x72, 0x61, 0x64, 0x1c, 0x00, 0x03, 0x67, 0x11, 0x00, 0x46, 0x07, 0x01, 0x1c, 0x0e,
+            0x44, 0x78, 0x70, 0x32, 0x28, 0x99, 0x00, 0x17, 0x29, 0x1d, 0x00, 0x01, 0x2b, 0x0e, 0x09, 0x1d,
+            0x00, 0x13, 0x29, 0xcc, 0x03, 0x0f, 0x7e, 0x00, 0x16, 0x0d, 0x7a, 0x00, 0x05, 0x68, 0x00, 0x04,
+            0x21, 0x03, 0x0f, 0x13, 0x28, 0x03, 0x02, 0xf7, 0x26, 0x04, 0xde, 0x00, 0x30, 0x4d, 0x41, 0x50,
+            0x01, 0x02, 0x54, 0x2c, 0x20, 0x75, 0x76, 0x29, 0x14, 0x00, 0x06, 0xf2, 0x00, 0x20, 0x32, 0x44,
+            0xfa, 0x0f, 0x01, 0xfb, 0x12, 0x18, 0x2e, 0x93, 0x1b, 0x51, 0x6d, 0x61, 0x70, 0x5d, 0x29, 0x34,
+            0x00, 0x00, 0xb6, 0x00, 0x23, 0x69, 0x66, 0x4c, 0x27, 0x20, 0x64, 0x28, 0x35, 0x1d, 0x14, 0x5f,
+            0x48, 0x02, 0x01, 0xe3, 0x1b, 0x14, 0x29, 0x15, 0x16, 0x06, 0xdf, 0x17, 0x07, 0x48, 0x28, 0x03,
+            0x5a, 0x01, 0x03, 0x97, 0x1d, 0x00, 0x4e, 0x02, 0x13, 0x5f, 0x13, 0x00, 0x24, 0x73, 0x5b, 0xc5,
+            0x1d, 0x02, 0xd2, 0x1f, 0x04, 0xc2, 0x21, 0x20, 0x75, 0x6e, 0x0e, 0x02, 0x10, 0x30, 0xe6, 0x01,
+            0x04, 0x21, 0x00, 0x25, 0x2d, 0x31, 0xf7, 0x02, 0x0f, 0xd6, 0x00, 0x0b, 0x00, 0xc3, 0x00, 0x05,
+            0x5f, 0x00, 0x00, 0xc4, 0x00, 0x01, 0xcc, 0x10, 0x56, 0x33, 0x28, 0x75, 0x76, 0x2c, 0xee, 0x02,
+            0x00, 0x25, 0x00, 0x03, 0xb4, 0x1c, 0x00, 0x23, 0x00, 0x05, 0x99, 0x01, 0x03, 0x99, 0x15, 0x0f,
+            0xc7, 0x00, 0x0b, 0x0f, 0xc2, 0x00, 0x60, 0x20, 0x75, 0x76, 0xa2, 0x00, 0x02, 0xbb, 0x29, 0x04,
+            0x3d, 0x02, 0x06, 0x2e, 0x20, 0x05, 0xf1, 0x25, 0x08, 0xf2, 0x03, 0x06, 0x1f, 0x00, 0x15, 0x29,
+            0x3a, 0x01, 0x09, 0x37, 0x20, 0x0f, 0x36, 0x00, 0x02, 0x09, 0x22, 0x00, 0x06, 0x39, 0x00, 0x08,
+            0x45, 0x20, 0x0f, 0x38, 0x00, 0x02, 0x08, 0x21, 0x00, 0x06, 0x37, 0x00, 0x03, 0x62, 0x08, 0x07,
+            0x97, 0x00, 0x17, 0x20, 0x0c, 0x00, 0x04, 0x81, 0x09, 0x09, 0x33, 0x00, 0x0f, 0x55, 0x20, 0x02,
+            0x0f, 0x73, 0x00, 0x02, 0x0f, 0x2a, 0x00, 0x02, 0x06, 0x49, 0x00, 0x03, 0x3d, 0x20, 0x0f, 0x3b,
+            0x00, 0x02, 0x03, 0x1c, 0x00, 0x72, 0x29, 0x0a, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x09, 0x07, 0x32,
+            0x6f, 0x75, 0x74, 0x43, 0x17, 0x11, 0x3b, 0x63, 0x13, 0x12, 0x31, 0xc1, 0x25, 0x30, 0x6c, 0x69,
+            0x74, 0x7f, 0x1e, 0x01, 0xcd, 0x25, 0x51, 0x66, 0x75, 0x6c, 0x6c, 0x79, 0xd0, 0x1c, 0x42, 0x6f,
+            0x77, 0x65, 0x64, 0xe9, 0x03, 0x01, 0xf5, 0x17, 0x00, 0x3f, 0x1b, 0x11, 0x74, 0x8a, 0x04, 0x44,
+            0x6c, 0x61, 0x73, 0x74, 0x40, 0x24, 0x01, 0x4b, 0x06, 0x42, 0x6c, 0x69, 0x74, 0x0a, 0xeb, 0x11,
+            0x05, 0x6b, 0x26, 0x20, 0x61, 0x6c, 0x7c, 0x20, 0x30, 0x6f, 0x77, 0x28, 0x84, 0x0c, 0x05, 0x42,
+            0x0e, 0x04, 0x49, 0x11, 0x02, 0x2d, 0x00, 0x01, 0x57, 0x1b, 0x41, 0x20, 0x3d, 0x20, 0x2d, 0xaf,
+            0x08, 0x52, 0x70, 0x6f, 0x73, 0x2e, 0x7a, 0xa3, 0x09, 0x01, 0x0f, 0x11, 0x03, 0xa1, 0x24, 0x00,
+            0x50, 0x22, 0x03, 0x7f, 0x15, 0x64, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x28, 0x18, 0x00, 0x13, 0x3c,
+            0xa5, 0x00, 0x05, 0xf4, 0x24, 0x01, 0x01, 0x23, 0x33, 0x20, 0x26, 0x26, 0xd6, 0x1b, 0x1c, 0x3e,
+            0x20, 0x00, 0x02, 0x14, 0x25, 0x13, 0x5b, 0x40, 0x00, 0x12, 0x5d, 0xfc, 0x0b, 0x00, 0xb3, 0x08,
+            0x03, 0x12, 0x00, 0x22, 0x2b, 0x2b, 0x7e, 0x00, 0x25, 0x69, 0x66, 0x64, 0x00, 0x2c, 0x3e, 0x3d,
+            0x45, 0x00, 0x01, 0x65, 0x00, 0x06, 0x3b, 0x00, 0x03, 0x6c, 0x12, 0x32, 0x31, 0x2e, 0x66, 0x3c,
+            0x00, 0x01, 0xee, 0x00, 0x03, 0xe5, 0x25, 0x02, 0xeb, 0x0d, 0x13, 0x28, 0x0e, 0x00, 0x05, 0xf3,
+            0x25, 0x03, 0x6e, 0x00, 0x10, 0x5d, 0x59, 0x0f, 0x00, 0x71, 0x0d, 0x04, 0xfd, 0x00, 0x02, 0x8d,
+            0x0f, 0x43, 0x29, 0x2e, 0x78, 0x79, 0x06, 0x01, 0x03, 0x5c, 0x00, 0x03, 0x2f, 0x04, 0x06, 0x48,
+            0x00, 0x02, 0xb8, 0x14, 0x14, 0x34, 0x11, 0x00, 0x00, 0x38, 0x01, 0x34, 0x78, 0x79, 0x2c, 0x91,
+            0x01, 0x14, 0x2c, 0xb2, 0x00, 0x00, 0x18, 0x00, 0x10, 0x7a, 0x9b, 0x0b, 0x02, 0x4e, 0x15, 0xf1,
+            0x01, 0x74, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x72, 0x79, 0x20, 0x70, 0x68, 0x6f, 0x6e, 0x67,
+            0x2d, 0x4f, 0x1d, 0x01, 0x43, 0x25, 0x62, 0x69, 0x6e, 0x67, 0x2c, 0x20, 0x4c, 0x55, 0x25, 0x40,
+            0x73, 0x20, 0x74, 0x6f, 0x5a, 0x06, 0x02, 0x53, 0x08, 0x01, 0x1f, 0x00, 0x02, 0x17, 0x13, 0x22,
+            0x41, 0x64, 0xf5, 0x25, 0x02, 0xd0, 0x01, 0x12, 0x4c, 0x6f, 0x04, 0x10, 0x20, 0xc3, 0x06, 0x00,
+            0x6e, 0x12, 0x03, 0x0f, 0x00, 0x13, 0x4e, 0x08, 0x00, 0x23, 0x56, 0x2c, 0xe2, 0x01, 0x05, 0x2f,
+            0x22, 0x04, 0x11, 0x00, 0x04, 0x27, 0x22, 0x00, 0xb4, 0x20, 0x03, 0x95, 0x02, 0x11, 0x33, 0x34,
+            0x1e, 0x39, 0x75, 0x73, 0x65, 0x14, 0x00, 0x00, 0x77, 0x1e, 0x4b, 0x75, 0x6c, 0x61, 0x72, 0x32,
+            0x02, 0x11, 0x46, 0x04, 0x15, 0xc0, 0x61, 0x6d, 0x70, 0x28, 0x64, 0x6f, 0x74, 0x28, 0x4e, 0x2c,
+            0x20, 0x4c, 0x54, 0x13, 0x00, 0x9a, 0x0f, 0x06, 0xca, 0x10, 0x03, 0x4f, 0x00, 0x85, 0x20, 0x2b,
+            0x3d, 0x20, 0x64, 0x46, 0x20, 0x2a, 0xa5, 0x00, 0x00, 0x0b, 0x00, 0x04, 0xbf, 0x22, 0x07, 0xae,
+            0x01, 0xa5, 0x68, 0x61, 0x6c, 0x66, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x2b, 0x0b, 0x93, 0x69,
+            0x7a, 0x65, 0x28, 0x56, 0x20, 0x2b, 0x20, 0x4c, 0xd9, 0x0c, 0x02, 0xcd, 0x00, 0x10, 0x73, 0x7d,
+            0x00, 0x49, 0x70, 0x6f, 0x77, 0x28, 0x81, 0x00, 0x06, 0x3f, 0x00, 0x08, 0x8a, 0x00, 0x95, 0x2c,
+            0x20, 0x32, 0x35, 0x36, 0x2e, 0x66, 0x20, 0x2a, 0xf2, 0x00, 0x03, 0x4b, 0x00, 0x04, 0xd8, 0x00,
+            0x00, 0x9e, 0x00, 0x1b, 0x73, 0x9e, 0x00, 0x40, 0x28, 0x31, 0x2e, 0x30, 0xe3, 0x14, 0x05, 0x36,
+            0x01, 0x07, 0x97, 0x14, 0x41, 0x6d, 0x61, 0x69, 0x6e, 0x88, 0x14, 0x03, 0x0b, 0x07, 0x0f, 0xa1,
+            0x20, 0x00, 0x00, 0xcb, 0x02, 0x0f, 0xbe, 0x14, 0x02, 0x07, 0xed, 0x00, 0x04, 0x6d, 0x02, 0x02,
+            0x56, 0x0e, 0x01, 0x61, 0x0b, 0x07, 0x13, 0x00, 0x0f, 0x29, 0x00, 0x02, 0x00, 0x5e, 0x0e, 0x0b,
+            0x29, 0x00, 0x03, 0x64, 0x0e, 0x00, 0x5a, 0x0f, 0x12, 0x20, 0x21, 0x08, 0x12, 0x3d, 0x63, 0x0b,
+            0x01, 0x0d, 0x00, 0x05, 0x46, 0x00, 0x00, 0x49, 0x0f, 0x02, 0x89, 0x10, 0x01, 0x40, 0x00, 0x00,
+            0x1d, 0x00, 0x10, 0x79, 0xf4, 0x0a, 0x00, 0xe9, 0x0b, 0x00, 0xad, 0x00, 0x01, 0x2d, 0x03, 0x07,
+            0x7f, 0x00, 0x00, 0x52, 0x14, 0x31, 0x46, 0x64, 0x78, 0x63, 0x02, 0x11, 0x28, 0x33, 0x00, 0x04,
+            0x1d, 0x00, 0x00, 0xc7, 0x02, 0x0f, 0x32, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x09, 0x20, 0x0f,
+            0x32, 0x00, 0x0b, 0x02, 0x87, 0x00, 0x00, 0xd9, 0x0e, 0x00, 0x3e, 0x20, 0x02, 0x59, 0x00, 0x23,
+            0x75, 0x76, 0x90, 0x01, 0x05, 0xc4, 0x00, 0x05, 0x4c, 0x00, 0x01, 0x79, 0x00, 0x01, 0x20, 0x00,
+            0x03, 0x47, 0x30, 0x03, 0x79, 0x00, 0x21, 0x34, 0x20, 0x18, 0x0c, 0x04, 0xeb, 0x00, 0x01, 0x0d,
+            0x00, 0x05, 0xeb, 0x00, 0x03, 0x7e, 0x28, 0x02, 0xb7, 0x0d, 0x00, 0xe5, 0x19, 0x06, 0x03, 0x0c,
+            0x03, 0x0e, 0x00, 0x05, 0xf6, 0x0b, 0x73, 0x2c, 0x20, 0x66, 0x69, 0x6e, 0x61, 0x6c, 0x9f, 0x0d,
+            0x03, 0x88, 0x11, 0x0f, 0xa9, 0x0f, 0x0e, 0x01, 0x0a, 0x01, 0x02, 0x5f, 0x00, 0x09, 0xa7, 0x02,
+            0x01, 0xae, 0x00, 0x07, 0x1d, 0x00, 0x03, 0xd7, 0x00, 0x02, 0x58, 0x0d, 0x01, 0x53, 0x0d, 0x00,
+            0xbf, 0x00, 0x00, 0x04, 0x00, 0x07, 0x25, 0x00, 0x09, 0x42, 0x00, 0x02, 0x71, 0x0e, 0x01, 0x1e,
+            0x00, 0x01, 0x4f, 0x1b, 0x13, 0x78, 0xb1, 0x00, 0x01, 0x0d, 0x00, 0x10, 0x79, 0x7a, 0x01, 0x01,
+            0xe6, 0x12, 0x0e, 0x30, 0x0e, 0x00, 0x6b, 0x05, 0x03, 0xfc, 0x06, 0x03, 0x81, 0x0b, 0x02, 0x18,
+            0x05, 0x06, 0x3e, 0x0e, 0x01, 0x55, 0x00, 0x03, 0x07, 0x01, 0x09, 0x74, 0x00, 0x06, 0xb6, 0x00,
+            0x03, 0x1e, 0x00, 0x03, 0xb7, 0x00, 0x05, 0xa8, 0x00, 0x05, 0x2e, 0x01, 0x0f, 0x37, 0x00, 0x04,
+            0x05, 0x20, 0x00, 0x03, 0x39, 0x00, 0x0b, 0xf0, 0x00, 0x0f, 0x83, 0x00, 0x10, 0x0c, 0xf7, 0x00,
+            0x13, 0x79, 0xf7, 0x00, 0x02, 0x64, 0x01, 0x00, 0xcf, 0x0f, 0x00, 0xb0, 0x02, 0x11, 0x78, 0x34,
+            0x18, 0x07, 0x2c, 0x00, 0x02, 0x1f, 0x00, 0x03, 0x2c, 0x00, 0x01, 0x23, 0x01, 0x01, 0xc2, 0x18,
+            0x00, 0x2c, 0x00, 0x24, 0x79, 0x2e, 0x8b, 0x13, 0x0f, 0xc7, 0x00, 0x02, 0x0f, 0x45, 0x00, 0x05,
+            0x0a, 0x02, 0x01, 0x02, 0xc9, 0x00, 0x00, 0x5c, 0x10, 0x42, 0x20, 0x54, 0x42, 0x4e, 0xde, 0x0e,
+            0x02, 0x67, 0x10, 0x0f, 0x50, 0x02, 0x07, 0x01, 0x67, 0x01, 0x02, 0x99, 0x00, 0x03, 0x0f, 0x01,
+            0x06, 0x4f, 0x02, 0x07, 0x8a, 0x08, 0x0d, 0x9e, 0x01, 0x00, 0x73, 0x2e, 0x02, 0x37, 0x00, 0x10,
+            0x5f, 0x2b, 0x0a, 0x02, 0x50, 0x0a, 0x24, 0x20, 0x3d, 0x3d, 0x0b, 0x00, 0x51, 0x0b, 0x03, 0xe0,
+            0x01, 0x32, 0x4d, 0x41, 0x50, 0x0a, 0x08, 0x37, 0x5f, 0x75, 0x76, 0xa2, 0x06, 0x00, 0xe8, 0x00,
+            0x0f, 0x41, 0x00, 0x01, 0x0e, 0x14, 0x00, 0x11, 0x2a, 0x1b, 0x16, 0x07, 0xe0, 0x15, 0x00, 0x3b,
+            0x00, 0x08, 0x08, 0x03, 0x09, 0xe8, 0x01, 0x02, 0x40, 0x00, 0x00, 0x86, 0x05, 0x00, 0x04, 0x01,
+            0x13, 0x2a, 0x50, 0x12, 0x07, 0xa5, 0x00, 0x00, 0x9f, 0x01, 0x04, 0x84, 0x0e, 0x12, 0x2e, 0x2e,
+            0x00, 0x00, 0x42, 0x28, 0x00, 0xed, 0x15, 0x00, 0x17, 0x17, 0x02, 0x12, 0x00, 0x32, 0x20, 0x2a,
+            0x20, 0xaa, 0x05, 0x02, 0x39, 0x1a, 0x0f, 0x30, 0x00, 0x00, 0x01, 0x0e, 0x16, 0x03, 0x78, 0x07,
+            0x02, 0xcb, 0x03, 0x02, 0x7f, 0x01, 0x09, 0x38, 0x03, 0x0b, 0xa6, 0x00, 0x07, 0x6d, 0x01, 0x06,
+            0xbc, 0x03, 0x0f, 0x52, 0x14, 0x07, 0x27, 0x69, 0x66, 0xa4, 0x0a, 0x04, 0xa7, 0x09, 0x02, 0x8a,
+            0x01, 0x00, 0x03, 0x01, 0x00, 0x04, 0x00, 0x01, 0x4a, 0x04, 0x29, 0x20, 0x2a, 0x78, 0x01, 0x06,
+            0x34, 0x00, 0x06, 0x78, 0x01, 0x08, 0xa2, 0x00, 0x05, 0x34, 0x00, 0x05, 0xd6, 0x00, 0x01, 0x12,
+            0x00, 0x00, 0x05, 0x01, 0x02, 0x27, 0x00, 0x02, 0xb3, 0x06, 0x05, 0x4a, 0x06, 0x02, 0x49, 0x02,
+            0x02, 0xff, 0x0c, 0x05, 0x15, 0x00, 0x0c, 0x2e, 0x00, 0x04, 0xab, 0x06, 0x08, 0x2d, 0x00, 0x04,
+            0x14, 0x00, 0x0c, 0x2c, 0x00, 0x03, 0xab, 0x30, 0x06, 0xd8, 0x29, 0x08, 0x35, 0x00, 0x0d, 0x1d,
+            0x00, 0x06, 0x3e, 0x00, 0x24, 0x69, 0x66, 0x98, 0x0a, 0x05, 0x0d, 0x01, 0x00, 0x96, 0x29, 0x03,
+            0x29, 0x2b, 0x00, 0xe1, 0x2e, 0x63, 0x72, 0x65, 0x70, 0x6c, 0x61, 0x63, 0xef, 0x26, 0xd3, 0x73,
+            0x65, 0x70, 0x61, 0x72, 0x61, 0x74, 0x65, 0x20, 0x6f, 0x6e, 0x65, 0x73, 0x4d, 0x10, 0x63, 0x20,
+            0x73, 0x69, 0x6e, 0x67, 0x6c, 0xe1, 0x26, 0x01, 0x9c, 0x04, 0x07, 0xef, 0x03, 0x00, 0xd4, 0x02,
+            0x00, 0xd7, 0x35, 0x09, 0x4e, 0x01, 0x03, 0x72, 0x00, 0x06, 0x4b, 0x01, 0x33, 0x2e, 0x72, 0x67,
+            0x51, 0x16, 0x00, 0x81, 0x01, 0x0d, 0xaf, 0x00, 0x00, 0x8d, 0x01, 0x43, 0x6f, 0x72, 0x6d, 0x2e,
+            0x60, 0x31, 0x00, 0x24, 0x00, 0x05, 0x35, 0x01, 0x04, 0x1c, 0x00, 0x12, 0x67, 0x68, 0x01, 0x00,
+            0x1c, 0x00, 0x04, 0x24, 0x01, 0x04, 0x1b, 0x00, 0x03, 0x5b, 0x00, 0x0b, 0x4c, 0x02, 0x06, 0xa5,
+            0x00, 0x2a, 0x69, 0x66, 0x82, 0x0c, 0x05, 0x0a, 0x01, 0x01, 0xcd, 0x00, 0x00, 0x52, 0x00, 0x06,
+            0x2c, 0x00, 0x00, 0x0e, 0x00, 0x09, 0x7c, 0x00, 0x07, 0x18, 0x0e, 0x09, 0x45, 0x00, 0x08, 0xdd,
+            0x00, 0x06, 0x9b, 0x00, 0x02, 0x84, 0x00, 0x00, 0x45, 0x00, 0x29, 0x69, 0x66, 0xbf, 0x0c, 0x0f,
+            0x74, 0x00, 0x0d, 0x08, 0xd4, 0x00, 0x07, 0x73, 0x00, 0x08, 0x43, 0x00, 0x0f, 0x72, 0x00, 0x10,
+            0x0f, 0xbe, 0x0c, 0x02, 0x0f, 0x7b, 0x00, 0x0d, 0x0f, 0x8f, 0x01, 0x02, 0x07, 0x84, 0x00, 0x0f,
+            0x55, 0x00, 0x02, 0x0f, 0x8d, 0x00, 0x09, 0x12, 0x7d, 0x71, 0x1c, 0x01, 0x6f, 0x08, 0x10, 0x56,
+            0x70, 0x0c, 0x02, 0x20, 0x04, 0x00, 0x60, 0x04, 0x00, 0x14, 0x00, 0x02, 0x12, 0x08, 0x01, 0xd8,
+            0x03, 0x30, 0x70, 0x6f, 0x73, 0xf1, 0x06, 0x00, 0x30, 0x01, 0x00, 0x1a, 0x00, 0x32, 0x20, 0x64,
+            0x4c, 0x6a, 0x18, 0x17, 0x33, 0x41, 0x18, 0x01, 0x19, 0x00, 0x1f, 0x73, 0x19, 0x00, 0x00, 0x02,
+            0x73, 0x03, 0x02, 0xef, 0x0b, 0x1f, 0x20, 0x39, 0x0c, 0x03, 0x8f, 0x20, 0x21, 0x3d, 0x20, 0x30,
+            0x75, 0x20, 0x3f, 0x28, 0x0d, 0x04, 0x0c, 0x8a, 0x00, 0x26, 0x20, 0x3a, 0x11, 0x1b, 0x06, 0x81,
+            0x0b, 0x00, 0xe2, 0x04, 0x01, 0x9a, 0x0b, 0x05, 0x45, 0x00, 0x03, 0x03, 0x30, 0x01, 0x39, 0x25,
+            0x23, 0x20, 0x2a, 0x01, 0x0c, 0x0a, 0x68, 0x08, 0x40, 0x2c, 0x20, 0x56, 0x2c, 0x98, 0x27, 0x04,
+            0xa3, 0x2e, 0x04, 0xe0, 0x01, 0x74, 0x2c, 0x20, 0x64, 0x4c, 0x2c, 0x20, 0x73, 0xea, 0x0a, 0x00,
+            0xfc, 0x0c, 0x02, 0xe5, 0x31, 0x01, 0x08, 0x34, 0x22, 0x2e, 0x7a, 0xb2, 0x00, 0x02, 0xb1, 0x04,
+            0x06, 0x96, 0x02, 0x01, 0x04, 0x01, 0x04, 0x32, 0x01, 0x04, 0x23, 0x01, 0x06, 0xd5, 0x07, 0x00,
+            0x47, 0x01, 0x06, 0x84, 0x02, 0x01, 0xce, 0x0d, 0x01, 0xf9, 0x33, 0x00, 0xe7, 0x18, 0xc7, 0x69,
+            0x6e, 0x74, 0x28, 0x6d, 0x61, 0x78, 0x28, 0x6c, 0x6f, 0x67, 0x28, 0xf9, 0x0d, 0x00, 0xd2, 0x05,
+            0x00, 0x4b, 0x2f, 0x00, 0x82, 0x34, 0x01, 0x2c, 0x00, 0x02, 0x25, 0x34, 0x25, 0x20, 0x2b, 0xf5,
+            0x30, 0x02, 0x16, 0x00, 0x00, 0x06, 0x13, 0x01, 0xb7, 0x05, 0x04, 0xa8, 0x01, 0x00, 0xac, 0x01,
+            0x01, 0x3a, 0x1e, 0x50, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x86, 0x04, 0x31, 0x69, 0x6e, 0x28, 0x11,
+            0x00, 0x01, 0x06, 0x00, 0x0e, 0x84, 0x1f, 0x01, 0x17, 0x06, 0x06, 0xeb, 0x34, 0x00, 0xa0, 0x21,
+            0x17, 0x2f, 0xae, 0x39, 0x12, 0x2c, 0xe3, 0x34, 0x10, 0x29, 0x95, 0x1d, 0x06, 0x26, 0x00, 0x20,
+            0x20, 0x2d, 0xa7, 0x38, 0x07, 0xd4, 0x00, 0x01, 0x38, 0x0a, 0x03, 0xb1, 0x00, 0x01, 0x94, 0x0c,
+            0x01, 0x2c, 0x00, 0x20, 0x73, 0x5b, 0x85, 0x00, 0x02, 0x34, 0x08, 0x08, 0x47, 0x01, 0x00, 0x42,
+            0x13, 0x11, 0x28, 0x1b, 0x00, 0x00, 0x77, 0x20, 0x03, 0x37, 0x00, 0x02, 0x62, 0x01, 0x00, 0x40,
+            0x13, 0x01, 0x1a, 0x00, 0x23, 0x7a, 0x29, 0x66, 0x1f, 0x00, 0xd2, 0x00, 0x00, 0x1b, 0x19, 0x01,
+            0x38, 0x01, 0x00, 0x08, 0x1e, 0x03, 0x30, 0x00, 0x22, 0x2e, 0x78, 0x10, 0x1e, 0x05, 0x0f, 0x00,
+            0x06, 0x1d, 0x01, 0x27, 0x2e, 0x79, 0x24, 0x1e, 0x00, 0x40, 0x00, 0x06, 0xab, 0x01, 0x00, 0x0e,
+            0x00, 0x01, 0xde, 0x31, 0x00, 0xb2, 0x29, 0x03, 0x2b, 0x32, 0x12, 0x3d, 0x08, 0x00, 0x23, 0x73,
+            0x5b, 0x4b, 0x00, 0x0b, 0xdf, 0x31, 0x27, 0x69, 0x5d, 0x8a, 0x00, 0x00, 0x40, 0x00, 0x01, 0xef,
+            0x01, 0x00, 0xf2, 0x02, 0x01, 0x77, 0x02, 0x14, 0x2e, 0xf9, 0x01, 0x01, 0x86, 0x1c, 0x25, 0x20,
+            0x2d, 0xde, 0x0f, 0x06, 0x1f, 0x01, 0x00, 0x35, 0x00, 0x02, 0x0f, 0x03, 0x40, 0x64, 0x69, 0x73,
+            0x74, 0xff, 0x21, 0x00, 0xaf, 0x0d, 0x10, 0x4c, 0xaf, 0x0d, 0x0f, 0x25, 0x00, 0x01, 0x01, 0x11,
+            0x34, 0x00, 0x26, 0x00, 0x02, 0x60, 0x00, 0x01, 0x0f, 0x00, 0x22, 0x20, 0x2a, 0xa5, 0x00, 0x02,
+            0x0e, 0x00, 0x0a, 0x36, 0x00, 0x32, 0x69, 0x66, 0x28, 0x58, 0x00, 0x31, 0x3e, 0x3d, 0x20, 0x1f,
+            0x00, 0x12, 0x32, 0xa1, 0x02, 0x00, 0x77, 0x00, 0x04, 0x04, 0x00, 0x73, 0x63, 0x6f, 0x6e, 0x74,
+            0x69, 0x6e, 0x75, 0x68, 0x34, 0x04, 0x16, 0x00, 0x10, 0x4c, 0xa4, 0x05, 0x03, 0xcc, 0x1a, 0x42,
+            0x73, 0x71, 0x72, 0x74, 0x48, 0x00, 0x03, 0x36, 0x09, 0x04, 0x25, 0x00, 0x24, 0x2f, 0x2f, 0xb0,
+            0x23, 0x40, 0x20, 0x73, 0x71, 0x75, 0x5c, 0x2e, 0xb1, 0x66, 0x61, 0x6c, 0x6c, 0x6f, 0x66, 0x66,
+            0x20, 0x77, 0x69, 0x6e, 0x17, 0x11, 0x00, 0xb4, 0x13, 0x11, 0x72, 0x47, 0x35, 0x40, 0x7a, 0x65,
+            0x72, 0x6f, 0x79, 0x24, 0x00, 0x96, 0x15, 0x01, 0xbe, 0x00, 0x22, 0x27, 0x73, 0x93, 0x00, 0x05,
+            0xcc, 0x05, 0x00, 0x56, 0x00, 0x02, 0x0c, 0x01, 0x02, 0x3e, 0x00, 0x01, 0x2e, 0x02, 0x00, 0x41,
+            0x0e, 0x02, 0x97, 0x08, 0x02, 0x82, 0x00, 0x00, 0x2b, 0x20, 0x00, 0x2a, 0x01, 0x52, 0x29, 0x20,
+            0x2f, 0x20, 0x28, 0xd3, 0x00, 0x00, 0xaf, 0x0e, 0x00, 0x34, 0x19, 0x18, 0x32, 0x58, 0x0e, 0x0a,
+            0x08, 0x01, 0x02, 0x57, 0x00, 0x64, 0x61, 0x74, 0x74, 0x65, 0x6e, 0x75, 0x1d, 0x2c, 0x03, 0x65,
+            0x00, 0x13, 0x2a, 0xac, 0x00, 0x00, 0x50, 0x00, 0x02, 0x2c, 0x01, 0x10, 0x2b, 0x4c, 0x04, 0x0b,
+            0xea, 0x00, 0x31, 0x69, 0x66, 0x28, 0xb5, 0x00, 0x15, 0x2e, 0x22, 0x35, 0x01, 0x72, 0x35, 0x50,
+            0x20, 0x3e, 0x3d, 0x20, 0x2d, 0x51, 0x0f, 0x09, 0xc5, 0x00, 0x00, 0xc9, 0x00, 0x08, 0x6c, 0x00,
+            0xdf, 0x2a, 0x3d, 0x20, 0x73, 0x6d, 0x6f, 0x6f, 0x74, 0x68, 0x73, 0x74, 0x65, 0x70, 0x48, 0x00,
+            0x02, 0x03, 0x98, 0x04, 0x06, 0x5e, 0x00, 0x01, 0x80, 0x35, 0x11, 0x2c, 0x0d, 0x02, 0x24, 0x2d,
+            0x4c, 0x1e, 0x00, 0x01, 0x4f, 0x02, 0x05, 0xb8, 0x35, 0x08, 0xd8, 0x03, 0x00, 0x72, 0x00, 0x05,
+            0xf8, 0x04, 0x05, 0x30, 0x00, 0x01, 0xea, 0x08, 0x20, 0x20, 0x2a, 0xd1, 0x3c, 0x04, 0xf8, 0x00,
+            0x0f, 0xec, 0x04, 0x22, 0x00, 0x5e, 0x00, 0x02, 0x20, 0x07, 0x02, 0x06, 0x00, 0x01, 0xe6, 0x02,
+            0x10, 0x61, 0xe7, 0x02, 0x03, 0x82, 0x06, 0x01, 0x37, 0x03, 0x00, 0x69, 0x00, 0x0c, 0xec, 0x08,
+            0x02, 0x86, 0x01, 0x05, 0x4c, 0x13, 0x02, 0x01, 0x05, 0x90, 0x34, 0x28, 0x73, 0x4c, 0x20, 0x2b,
+            0x20, 0x28, 0x64, 0x06, 0x00, 0x20, 0x61, 0x4c, 0xd1, 0x04, 0x00, 0x52, 0x00, 0x11, 0x28, 0xaf,
+            0x00, 0x00, 0x4f, 0x04, 0xb0, 0x6f, 0x6c, 0x6f, 0x72, 0x2e, 0x61, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_6[] = {
+            0xf0, 0x70, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x0a,
+            0x2f, 0x2f, 0x20, 0x54, 0x72, 0x69, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x63, 0x6f, 0x76, 0x65,
+            0x72, 0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76, 0x69, 0x65, 0x77, 0x70, 0x6f, 0x72,
+            0x74, 0x2c, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x67, 0x6c,
+            0x44, 0x72, 0x61, 0x77, 0x41, 0x72, 0x72, 0x61, 0x79, 0x73, 0x28, 0x47, 0x4c, 0x5f, 0x54, 0x52,
+            0x49, 0x41, 0x4e, 0x47, 0x4c, 0x45, 0x53, 0x2c, 0x20, 0x30, 0x2c, 0x20, 0x33, 0x29, 0x20, 0x61,
+            0x6e, 0x64, 0x20, 0x6e, 0x6f, 0x20, 0x76, 0x65, 0x72, 0x74, 0x65, 0x78, 0x20, 0x62, 0x75, 0x66,
+            0x66, 0x65, 0x72, 0x73, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x6c, 0x6f, 0x63, 0x61,
+            0x74, 0x7a, 0x00, 0xf1, 0x16, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72,
+            0x6d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3b, 0x20, 0x2f,
+            0x2f, 0x20, 0x4e, 0x44, 0x43, 0x20, 0x7a, 0x20, 0x6f, 0x66, 0x86, 0x00, 0x13, 0x74, 0x9c, 0x00,
+            0xf1, 0x12, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a,
+            0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x63, 0x6f, 0x72, 0x6e, 0x65,
+            0x72, 0x20, 0x3d, 0x0e, 0x00, 0x61, 0x28, 0x28, 0x67, 0x6c, 0x5f, 0x56, 0x7c, 0x00, 0xe8, 0x49,
+            0x44, 0x20, 0x3c, 0x3c, 0x20, 0x31, 0x29, 0x20, 0x26, 0x20, 0x32, 0x2c, 0x20, 0x17, 0x00, 0x51,
+            0x26, 0x20, 0x32, 0x29, 0x3b, 0x41, 0x00, 0x73, 0x67, 0x6c, 0x5f, 0x50, 0x6f, 0x73, 0x69, 0x93,
+            0x00, 0x53, 0x76, 0x65, 0x63, 0x34, 0x28, 0x4f, 0x00, 0xc2, 0x2a, 0x20, 0x32, 0x2e, 0x66, 0x20,
+            0x2d, 0x20, 0x31, 0x2e, 0x66, 0x2c, 0x9b, 0x00, 0xa0, 0x2c, 0x20, 0x31, 0x2e, 0x66, 0x29, 0x3b,
+            0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_7[] = {
+            0xf2, 0x2c, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x0a,
+            0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x31, 0x34, 0x30, 0x2c, 0x20, 0x62,
+            0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66,
+            0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x55, 0x10, 0x00, 0xf0,
+            0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x69, 0x6e,
+            0x4f, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, 0x17, 0x00, 0x0b, 0x0f, 0x00, 0xa2,
+            0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x24, 0x00, 0xc6, 0x75, 0x76, 0x65,
+            0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x16, 0x00, 0xf3, 0x39, 0x66, 0x6c, 0x6f,
+            0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a,
+            0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20,
+            0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20, 0x63,
+            0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62, 0x79, 0x20, 0x53,
+            0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xf0, 0x05, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2c, 0x20,
+            0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x73, 0x51, 0x00, 0xf1,
+            0x20, 0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x61, 0x73, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69,
+            0x62, 0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6f, 0x66,
+            0x21, 0x00, 0x70, 0x6d, 0x65, 0x73, 0x68, 0x20, 0x62, 0x65, 0x1b, 0x01, 0xd8, 0x64, 0x72, 0x61,
+            0x77, 0x6e, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x4d, 0x00, 0x22, 0x0a, 0x23, 0x65,
+            0x00, 0x08, 0x14, 0x00, 0xac, 0x20, 0x30, 0x75, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x1e,
+            0x00, 0xf7, 0x01, 0x45, 0x4e, 0x41, 0x42, 0x4c, 0x45, 0x44, 0x28, 0x69, 0x64, 0x78, 0x29, 0x20,
+            0x28, 0x28, 0x28, 0x49, 0x00, 0x41, 0x20, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26, 0x20, 0x31,
+            0x75, 0x29, 0x20, 0x3d, 0x3d, 0x07, 0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74,
+            0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7, 0x01, 0x18,
+            0x3b, 0x18, 0x00, 0x53, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20, 0x2b, 0x28,
+            0x00, 0x09, 0x24, 0x00, 0x27, 0x55, 0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23, 0x00, 0x67,
+            0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c, 0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00, 0x77, 0x54,
+            0x41, 0x4e, 0x47, 0x45, 0x4e, 0x54, 0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00, 0xf7, 0x03,
+            0x49, 0x4e, 0x53, 0x54, 0x41, 0x4e, 0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46, 0x4f,
+            0x52, 0x4d, 0x34, 0x00, 0x07, 0x46, 0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e, 0x56, 0x45,
+            0x52, 0x53, 0x3d, 0x00, 0x3f, 0x34, 0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00, 0x03, 0x65,
+            0x4d, 0x41, 0x54, 0x45, 0x52, 0x49, 0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00, 0x02, 0x09,
+            0x47, 0x00, 0x38, 0x4e, 0x45, 0x58, 0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00, 0x30, 0x3b,
+            0x0a, 0x0a, 0x5e, 0x02, 0x90, 0x77, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x7d, 0x01,
+            0x25, 0x2c, 0x20, 0xf5, 0x00, 0x2d, 0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e, 0x64, 0x20,
+            0x43, 0x00, 0xf3, 0x00, 0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e, 0x61, 0x62,
+            0x6c, 0x65, 0x64, 0xd6, 0x01, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31, 0x02, 0x24,
+            0x20, 0x3d, 0x60, 0x02, 0x03, 0x11, 0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44, 0x58, 0x29,
+            0xb4, 0x00, 0x01, 0x36, 0x00, 0x24, 0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02, 0xd0, 0x01,
+            0x0a, 0x30, 0x00, 0x03, 0xbf, 0x01, 0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d, 0x68, 0x00,
+            0x04, 0xc3, 0x01, 0x0f, 0x39, 0x00, 0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x04, 0x72, 0x04,
+            0x40, 0x6c, 0x6f, 0x63, 0x61, 0xfb, 0x03, 0x20, 0x20, 0x3d, 0x29, 0x01, 0x00, 0x13, 0x02, 0xef,
+            0x29, 0x20, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x28, 0x00,
+            0x00, 0x05, 0x77, 0x01, 0x05, 0x55, 0x01, 0x05, 0x37, 0x00, 0x01, 0x8c, 0x04, 0x61, 0x6d, 0x6f,
+            0x64, 0x65, 0x6c, 0x3b, 0x86, 0x01, 0xf1, 0x09, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x70, 0x61,
+            0x73, 0x73, 0x65, 0x73, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63,
+            0xda, 0x03, 0xa0, 0x20, 0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6a, 0x00, 0x10,
+            0x69, 0x86, 0x00, 0x41, 0x73, 0x20, 0x74, 0x6f, 0xe9, 0x03, 0x10, 0x73, 0x42, 0x04, 0x11, 0x64,
+            0x3a, 0x00, 0x42, 0x0a, 0x69, 0x6e, 0x76, 0x7c, 0x04, 0x53, 0x20, 0x67, 0x6c, 0x5f, 0x50, 0x2a,
+            0x00, 0x02, 0x60, 0x00, 0xf2, 0x01, 0x44, 0x45, 0x50, 0x54, 0x48, 0x5f, 0x4f, 0x4e, 0x4c, 0x59,
+            0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x47, 0x04, 0x13, 0x70, 0x24, 0x00, 0x64, 0x20, 0x6f, 0x6e,
+            0x6c, 0x79, 0x20, 0x3d, 0x00, 0x40, 0x75, 0x73, 0x65, 0x64, 0x9d, 0x04, 0x08, 0x94, 0x00, 0x04,
+            0x97, 0x04, 0xf2, 0x01, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6e, 0x6f, 0x20, 0x66, 0x72, 0x61, 0x67,
+            0x6d, 0x65, 0x6e, 0x74, 0x80, 0x00, 0x11, 0x72, 0x49, 0x02, 0xf1, 0x07, 0x69, 0x74, 0x68, 0x20,
+            0x56, 0x49, 0x53, 0x49, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x20, 0x69, 0x74, 0x20, 0x61, 0x6c,
+            0x73, 0x6f, 0x9b, 0x00, 0x12, 0x65, 0x70, 0x00, 0xb0, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63,
+            0x65, 0x20, 0x6f, 0x6e, 0xc0, 0x00, 0xb0, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74,
+            0x79, 0x2e, 0x50, 0x00, 0x50, 0x2e, 0x67, 0x6c, 0x73, 0x6c, 0xa9, 0x04, 0x00, 0xa8, 0x04, 0x06,
+            0xb1, 0x00, 0x04, 0x12, 0x00, 0x06, 0x5b, 0x00, 0x83, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x6f,
+            0x75, 0x5d, 0x04, 0x00, 0x3c, 0x00, 0x14, 0x5f, 0x5b, 0x00, 0x14, 0x3b, 0xbf, 0x04, 0xb3, 0x76,
+            0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x00, 0x06, 0x07, 0x15, 0x01, 0x20,
+            0x20, 0x3d, 0x60, 0x01, 0x03, 0xe3, 0x05, 0x50, 0x20, 0x2a, 0x20, 0x28, 0x28, 0x01, 0x06, 0x22,
+            0x20, 0x2a, 0x93, 0x01, 0x30, 0x29, 0x20, 0x2a, 0xd8, 0x01, 0xdf, 0x34, 0x28, 0x70, 0x6f, 0x73,
+            0x2c, 0x20, 0x31, 0x2e, 0x66, 0x29, 0x29, 0x3b, 0x86, 0x00, 0x00, 0x00, 0x54, 0x06, 0x09, 0x7c,
+            0x00, 0x20, 0x20, 0x3d, 0x79, 0x01, 0x13, 0x49, 0xe5, 0x00, 0x80, 0x49, 0x44, 0x3b, 0x20, 0x2f,
+            0x2f, 0x20, 0x4d, 0x8a, 0x05, 0x00, 0x84, 0x05, 0x70, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+            0x07, 0x06, 0x04, 0xad, 0x00, 0x24, 0x20, 0x30, 0xae, 0x00, 0x7f, 0x7d, 0x0a, 0x23, 0x65, 0x6c,
+            0x73, 0x65, 0x45, 0x02, 0x00, 0x06, 0x2e, 0x03, 0x03, 0x6f, 0x02, 0x7f, 0x34, 0x20, 0x63, 0x6f,
+            0x6c, 0x6f, 0x72, 0x71, 0x02, 0x01, 0x03, 0x27, 0x03, 0x03, 0x29, 0x00, 0x4f, 0x32, 0x20, 0x75,
+            0x76, 0x26, 0x00, 0x01, 0x07, 0x19, 0x03, 0x03, 0x2a, 0x00, 0x8f, 0x33, 0x20, 0x6e, 0x6f, 0x72,
+            0x6d, 0x61, 0x6c, 0x2e, 0x00, 0x01, 0x08, 0x0e, 0x03, 0x05, 0x2f, 0x00, 0x7f, 0x74, 0x61, 0x6e,
+            0x67, 0x65, 0x6e, 0x74, 0x30, 0x00, 0x01, 0x05, 0xf5, 0x02, 0x0d, 0x3f, 0x04, 0x0a, 0xfd, 0x02,
+            0x04, 0x89, 0x07, 0x01, 0x72, 0x01, 0x0f, 0x49, 0x00, 0x0a, 0x04, 0x72, 0x04, 0x05, 0x40, 0x00,
+            0x01, 0x53, 0x06, 0x60, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0xb4, 0x00, 0x11, 0x0a, 0x4d, 0x03,
+            0x00, 0xc1, 0x01, 0x10, 0x4d, 0x51, 0x03, 0x21, 0x20, 0x3d, 0x0c, 0x00, 0x04, 0xcd, 0x01, 0x30,
+            0x3b, 0x0a, 0x0a, 0x2a, 0x02, 0x41, 0x76, 0x65, 0x63, 0x34, 0xb6, 0x02, 0x01, 0xfa, 0x07, 0x11,
+            0x5f, 0xb2, 0x03, 0x0a, 0x18, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x03, 0x69, 0x01, 0x03, 0x28, 0x00,
+            0x12, 0x32, 0x40, 0x00, 0x00, 0x55, 0x01, 0x03, 0x12, 0x00, 0x12, 0x33, 0x12, 0x00, 0x00, 0x6f,
+            0x00, 0x14, 0x5f, 0x42, 0x01, 0x0f, 0x1b, 0x00, 0x00, 0x05, 0x2e, 0x01, 0x0f, 0x1c, 0x00, 0x00,
+            0x25, 0x62, 0x69, 0x1e, 0x00, 0x0f, 0xd6, 0x02, 0x00, 0x07, 0xe5, 0x00, 0x0f, 0xd1, 0x02, 0x00,
+            0x01, 0x7d, 0x02, 0x01, 0x7d, 0x00, 0x33, 0x70, 0x6f, 0x73, 0xf7, 0x00, 0x02, 0x03, 0x01, 0x0c,
+            0xc0, 0x02, 0x02, 0xc6, 0x08, 0x0f, 0x01, 0x03, 0x08, 0x09, 0x4b, 0x00, 0x02, 0x2e, 0x00, 0x01,
+            0x13, 0x00, 0x02, 0x59, 0x00, 0x07, 0x39, 0x00, 0x07, 0x1c, 0x00, 0x01, 0x1e, 0x01, 0x2b, 0x20,
+            0x3d, 0xef, 0x05, 0x12, 0x3f, 0x9f, 0x02, 0x22, 0x20, 0x3a, 0x43, 0x03, 0x57, 0x31, 0x2e, 0x30,
+            0x66, 0x29, 0x35, 0x00, 0x41, 0x75, 0x76, 0x20, 0x3d, 0x98, 0x02, 0x05, 0x3e, 0x03, 0x04, 0xe4,
+            0x00, 0x20, 0x20, 0x3d, 0xa2, 0x09, 0x03, 0xd4, 0x01, 0x00, 0x1e, 0x00, 0x01, 0x9e, 0x09, 0x33,
+            0x69, 0x66, 0x28, 0xb0, 0x02, 0x03, 0xb0, 0x05, 0x11, 0x29, 0x17, 0x00, 0x00, 0x20, 0x00, 0x01,
+            0xa1, 0x00, 0x01, 0xff, 0x00, 0x02, 0x7c, 0x01, 0x02, 0x41, 0x00, 0xc9, 0x33, 0x28, 0x74, 0x72,
+            0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x64, 0x02, 0x29, 0x20, 0x2a, 0xfd, 0x09, 0x10,
+            0x29, 0xe6, 0x03, 0x02, 0x39, 0x00, 0x02, 0x9f, 0x00, 0x0d, 0x6a, 0x00, 0x35, 0x20, 0x26, 0x26,
+            0xfe, 0x02, 0x09, 0x7d, 0x00, 0x02, 0x4f, 0x0a, 0x0a, 0x83, 0x00, 0x03, 0xc6, 0x01, 0x04, 0x84,
+            0x00, 0x00, 0x97, 0x00, 0x01, 0x8b, 0x01, 0x00, 0x66, 0x00, 0x03, 0x1c, 0x00, 0x02, 0x67, 0x00,
+            0x0a, 0x37, 0x00, 0x05, 0xff, 0x01, 0x9c, 0x20, 0x3d, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28,
+            0xd6, 0x00, 0x17, 0x2c, 0x64, 0x02, 0x03, 0x49, 0x00, 0x03, 0x50, 0x01, 0xb0, 0x7d, 0x0a, 0x7d,
+            0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a,
+        };
+        constexpr uint8_t shader_8[] = {
+            0xf2, 0x3f, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x23,
+            0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x44, 0x45, 0x50, 0x54, 0x48, 0x5f, 0x4f, 0x4e, 0x4c,
+            0x59, 0x0a, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x31, 0x34, 0x30,
+            0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x75,
+            0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x55,
+            0x10, 0x00, 0xf0, 0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x74, 0x34,
+            0x20, 0x69, 0x6e, 0x62, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, 0x17, 0x00, 0x0b,
+            0x0f, 0x00, 0xa2, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x24, 0x00, 0xc6,
+            0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x16, 0x00, 0xf3, 0x39,
+            0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x3b, 0x0a,
+            0x7d, 0x3b, 0x0a, 0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x61,
+            0x72, 0x65, 0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x61,
+            0x74, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62,
+            0x79, 0x20, 0x53, 0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xd2, 0x43, 0x61, 0x63, 0x68, 0x65,
+            0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0xfb, 0x00, 0x10, 0x73, 0x51, 0x00, 0xf1, 0x20,
+            0x41, 0x54, 0x54, 0x52, 0x49, 0x42, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x61, 0x73, 0x20, 0x74,
+            0x68, 0x65, 0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62,
+            0x75, 0x74, 0x65, 0x20, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x21,
+            0x00, 0x70, 0x6d, 0x65, 0x73, 0x68, 0x20, 0x62, 0x65, 0x1b, 0x01, 0xd8, 0x64, 0x72, 0x61, 0x77,
+            0x6e, 0x0a, 0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x4d, 0x00, 0x05, 0x60, 0x01, 0x07, 0x14,
+            0x00, 0xac, 0x20, 0x30, 0x75, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x1e, 0x00, 0xf8, 0x01,
+            0x45, 0x4e, 0x41, 0x42, 0x4c, 0x45, 0x44, 0x28, 0x69, 0x64, 0x78, 0x29, 0x20, 0x28, 0x28, 0x28,
+            0x35, 0x00, 0x31, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x3d,
+            0x3d, 0x07, 0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e,
+            0x74, 0x20, 0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7, 0x01, 0x18, 0x3b, 0x18, 0x00, 0x53,
+            0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20, 0x2b, 0x28, 0x00, 0x09, 0x24, 0x00,
+            0x27, 0x55, 0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23, 0x00, 0x67, 0x4e, 0x4f, 0x52, 0x4d,
+            0x41, 0x4c, 0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00, 0x77, 0x54, 0x41, 0x4e, 0x47, 0x45,
+            0x4e, 0x54, 0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00, 0xf7, 0x03, 0x49, 0x4e, 0x53, 0x54,
+            0x41, 0x4e, 0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46, 0x4f, 0x52, 0x4d, 0x34, 0x00,
+            0x07, 0x46, 0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x3d, 0x00,
+            0x3f, 0x34, 0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00, 0x03, 0x65, 0x4d, 0x41, 0x54, 0x45,
+            0x52, 0x49, 0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00, 0x02, 0x09, 0x47, 0x00, 0x38, 0x4e,
+            0x45, 0x58, 0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00, 0x30, 0x3b, 0x0a, 0x0a, 0x5e, 0x02,
+            0x90, 0x77, 0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x7d, 0x01, 0x25, 0x2c, 0x20, 0xf5,
+            0x00, 0x2d, 0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x00, 0xf3, 0x00,
+            0x20, 0x61, 0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0xd6,
+            0x01, 0x43, 0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31, 0x02, 0x24, 0x20, 0x3d, 0x74, 0x02,
+            0x03, 0x11, 0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44, 0x58, 0x29, 0xb4, 0x00, 0x01, 0x36,
+            0x00, 0x24, 0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02, 0xd0, 0x01, 0x0a, 0x30, 0x00, 0x03,
+            0xbf, 0x01, 0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d, 0x68, 0x00, 0x04, 0xc3, 0x01, 0x0f,
+            0x39, 0x00, 0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x04, 0x72, 0x04, 0x40, 0x6c, 0x6f, 0x63,
+            0x61, 0xfb, 0x03, 0x20, 0x20, 0x3d, 0x29, 0x01, 0x00, 0x13, 0x02, 0xef, 0x29, 0x20, 0x69, 0x6e,
+            0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x28, 0x00, 0x00, 0x05, 0x77, 0x01,
+            0x05, 0x55, 0x01, 0x05, 0x37, 0x00, 0x01, 0x8c, 0x04, 0x61, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x3b,
+            0x86, 0x01, 0xf1, 0x09, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x73,
+            0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0xda, 0x03, 0xa0, 0x20,
+            0x69, 0x64, 0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6a, 0x00, 0x10, 0x69, 0x86, 0x00, 0x41,
+            0x73, 0x20, 0x74, 0x6f, 0xe9, 0x03, 0x10, 0x73, 0x42, 0x04, 0x11, 0x64, 0x3a, 0x00, 0x42, 0x0a,
+            0x69, 0x6e, 0x76, 0x7c, 0x04, 0x53, 0x20, 0x67, 0x6c, 0x5f, 0x50, 0x2a, 0x00, 0x02, 0x60, 0x00,
+            0x06, 0x43, 0x05, 0x62, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x47, 0x04, 0x13, 0x70, 0x24, 0x00,
+            0x64, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x3d, 0x00, 0x40, 0x75, 0x73, 0x65, 0x64, 0x9d, 0x04,
+            0x08, 0x94, 0x00, 0x04, 0x97, 0x04, 0xf2, 0x01, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6e, 0x6f, 0x20,
+            0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x80, 0x00, 0x11, 0x72, 0x49, 0x02, 0xf1, 0x07,
+            0x69, 0x74, 0x68, 0x20, 0x56, 0x49, 0x53, 0x49, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x20, 0x69,
+            0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x9b, 0x00, 0x12, 0x65, 0x70, 0x00, 0xb0, 0x69, 0x6e, 0x73,
+            0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x6e, 0xc0, 0x00, 0xb0, 0x76, 0x69, 0x73, 0x69, 0x62,
+            0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 0x50, 0x00, 0x50, 0x2e, 0x67, 0x6c, 0x73, 0x6c, 0xa9, 0x04,
+            0x00, 0xa8, 0x04, 0x06, 0xb1, 0x00, 0x04, 0x12, 0x00, 0x06, 0x5b, 0x00, 0x83, 0x0a, 0x66, 0x6c,
+            0x61, 0x74, 0x20, 0x6f, 0x75, 0x5d, 0x04, 0x00, 0x3c, 0x00, 0x14, 0x5f, 0x5b, 0x00, 0x14, 0x3b,
+            0xbf, 0x04, 0xb3, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x00, 0x06,
+            0x07, 0x15, 0x01, 0x20, 0x20, 0x3d, 0x60, 0x01, 0x03, 0xe3, 0x05, 0x50, 0x20, 0x2a, 0x20, 0x28,
+            0x28, 0x01, 0x06, 0x22, 0x20, 0x2a, 0x93, 0x01, 0x30, 0x29, 0x20, 0x2a, 0xd8, 0x01, 0xdf, 0x34,
+            0x28, 0x70, 0x6f, 0x73, 0x2c, 0x20, 0x31, 0x2e, 0x66, 0x29, 0x29, 0x3b, 0x86, 0x00, 0x00, 0x00,
+            0x54, 0x06, 0x09, 0x7c, 0x00, 0x20, 0x20, 0x3d, 0x79, 0x01, 0x13, 0x49, 0xe5, 0x00, 0x80, 0x49,
+            0x44, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x4d, 0x8a, 0x05, 0x00, 0x84, 0x05, 0x70, 0x73, 0x20, 0x73,
+            0x74, 0x61, 0x72, 0x74, 0x07, 0x06, 0x04, 0xad, 0x00, 0x24, 0x20, 0x30, 0xae, 0x00, 0x7f, 0x7d,
+            0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x45, 0x02, 0x00, 0x06, 0x2e, 0x03, 0x03, 0x6f, 0x02, 0x7f,
+            0x34, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x71, 0x02, 0x01, 0x03, 0x27, 0x03, 0x03, 0x29, 0x00,
+            0x4f, 0x32, 0x20, 0x75, 0x76, 0x26, 0x00, 0x01, 0x07, 0x19, 0x03, 0x03, 0x2a, 0x00, 0x8f, 0x33,
+            0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x2e, 0x00, 0x01, 0x08, 0x0e, 0x03, 0x05, 0x2f, 0x00,
+            0x7f, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x30, 0x00, 0x01, 0x05, 0xf5, 0x02, 0x0d, 0x3f,
+            0x04, 0x0a, 0xfd, 0x02, 0x04, 0x89, 0x07, 0x01, 0x72, 0x01, 0x0f, 0x49, 0x00, 0x0a, 0x04, 0x72,
+            0x04, 0x05, 0x40, 0x00, 0x01, 0x53, 0x06, 0x60, 0x6d, 0x61, 0x74, 0x65, 0x72, 0x69, 0xb4, 0x00,
+            0x11, 0x0a, 0x4d, 0x03, 0x00, 0xc1, 0x01, 0x10, 0x4d, 0x51, 0x03, 0x21, 0x20, 0x3d, 0x0c, 0x00,
+            0x04, 0xcd, 0x01, 0x30, 0x3b, 0x0a, 0x0a, 0x2a, 0x02, 0x41, 0x76, 0x65, 0x63, 0x34, 0xb6, 0x02,
+            0x01, 0xfa, 0x07, 0x11, 0x5f, 0xb2, 0x03, 0x0a, 0x18, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x03, 0x69,
+            0x01, 0x03, 0x28, 0x00, 0x12, 0x32, 0x40, 0x00, 0x00, 0x55, 0x01, 0x03, 0x12, 0x00, 0x12, 0x33,
+            0x12, 0x00, 0x00, 0x6f, 0x00, 0x14, 0x5f, 0x42, 0x01, 0x0f, 0x1b, 0x00, 0x00, 0x05, 0x2e, 0x01,
+            0x0f, 0x1c, 0x00, 0x00, 0x25, 0x62, 0x69, 0x1e, 0x00, 0x0f, 0xd6, 0x02, 0x00, 0x07, 0xe5, 0x00,
+            0x0f, 0xd1, 0x02, 0x00, 0x01, 0x7d, 0x02, 0x01, 0x7d, 0x00, 0x33, 0x70, 0x6f, 0x73, 0xf7, 0x00,
+            0x02, 0x03, 0x01, 0x0c, 0xc0, 0x02, 0x02, 0xc6, 0x08, 0x0f, 0x01, 0x03, 0x08, 0x09, 0x4b, 0x00,
+            0x02, 0x2e, 0x00, 0x01, 0x13, 0x00, 0x02, 0x59, 0x00, 0x07, 0x39, 0x00, 0x07, 0x1c, 0x00, 0x01,
+            0x1e, 0x01, 0x2b, 0x20, 0x3d, 0xef, 0x05, 0x12, 0x3f, 0x9f, 0x02, 0x22, 0x20, 0x3a, 0x43, 0x03,
+            0x57, 0x31, 0x2e, 0x30, 0x66, 0x29, 0x35, 0x00, 0x41, 0x75, 0x76, 0x20, 0x3d, 0x98, 0x02, 0x05,
+            0x3e, 0x03, 0x04, 0xe4, 0x00, 0x20, 0x20, 0x3d, 0xa2, 0x09, 0x03, 0xd4, 0x01, 0x00, 0x1e, 0x00,
+            0x01, 0x9e, 0x09, 0x33, 0x69, 0x66, 0x28, 0xb0, 0x02, 0x03, 0xb0, 0x05, 0x11, 0x29, 0x17, 0x00,
+            0x00, 0x20, 0x00, 0x01, 0xa1, 0x00, 0x01, 0xff, 0x00, 0x02, 0x7c, 0x01, 0x02, 0x41, 0x00, 0xc9,
+            0x33, 0x28, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x64, 0x02, 0x29, 0x20,
+            0x2a, 0xfd, 0x09, 0x10, 0x29, 0xe6, 0x03, 0x02, 0x39, 0x00, 0x02, 0x9f, 0x00, 0x0d, 0x6a, 0x00,
+            0x35, 0x20, 0x26, 0x26, 0xfe, 0x02, 0x09, 0x7d, 0x00, 0x02, 0x4f, 0x0a, 0x0a, 0x83, 0x00, 0x03,
+            0xc6, 0x01, 0x04, 0x84, 0x00, 0x00, 0x97, 0x00, 0x01, 0x8b, 0x01, 0x00, 0x66, 0x00, 0x03, 0x1c,
+            0x00, 0x02, 0x67, 0x00, 0x0a, 0x37, 0x00, 0x05, 0xff, 0x01, 0x9c, 0x20, 0x3d, 0x20, 0x63, 0x72,
+            0x6f, 0x73, 0x73, 0x28, 0xd6, 0x00, 0x17, 0x2c, 0x64, 0x02, 0x03, 0x49, 0x00, 0x03, 0x50, 0x01,
+            0xb0, 0x7d, 0x0a, 0x7d, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x0a,
+        };
+        constexpr uint8_t shader_9[] = {
+            0xf5, 0x10, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x23,
+            0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x20, 0x44, 0x45, 0x50, 0x54, 0x48, 0x5f, 0x4f, 0x4e, 0x4c,
+            0x59, 0x13, 0x00, 0xf2, 0x2a, 0x56, 0x49, 0x53, 0x49, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x0a,
+            0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x73, 0x74, 0x64, 0x31, 0x34, 0x30, 0x2c, 0x20,
+            0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x75, 0x6e, 0x69,
+            0x66, 0x6f, 0x72, 0x6d, 0x20, 0x5f, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x6c, 0x55, 0x10, 0x00,
+            0xf0, 0x00, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x69,
+            0x6e, 0x75, 0x00, 0x76, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x3b, 0x17, 0x00, 0x0b, 0x0f, 0x00,
+            0xa2, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x24, 0x00, 0xc6, 0x75, 0x76,
+            0x65, 0x63, 0x32, 0x20, 0x72, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x16, 0x00, 0xf3, 0x39, 0x66, 0x6c,
+            0x6f, 0x61, 0x74, 0x20, 0x6c, 0x6f, 0x64, 0x5f, 0x62, 0x69, 0x61, 0x73, 0x3b, 0x0a, 0x7d, 0x3b,
+            0x0a, 0x2f, 0x2f, 0x20, 0x56, 0x61, 0x72, 0x69, 0x61, 0x6e, 0x74, 0x73, 0x20, 0x61, 0x72, 0x65,
+            0x20, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x64, 0x20, 0x61, 0x74, 0x20,
+            0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x62, 0x79, 0x20,
+            0x53, 0x68, 0x61, 0x64, 0x65, 0x72, 0x32, 0x00, 0xd2, 0x43, 0x61, 0x63, 0x68, 0x65, 0x2c, 0x20,
+            0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x0e, 0x01, 0x10, 0x73, 0x51, 0x00, 0xf1, 0x20, 0x41, 0x54,
+            0x54, 0x52, 0x49, 0x42, 0x5f, 0x4d, 0x41, 0x53, 0x4b, 0x20, 0x61, 0x73, 0x20, 0x74, 0x68, 0x65,
+            0x20, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74,
+            0x65, 0x20, 0x62, 0x69, 0x74, 0x66, 0x69, 0x65, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x21, 0x00, 0x70,
+            0x6d, 0x65, 0x73, 0x68, 0x20, 0x62, 0x65, 0x1b, 0x01, 0xd8, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x0a,
+            0x23, 0x69, 0x66, 0x6e, 0x64, 0x65, 0x66, 0x4d, 0x00, 0x05, 0x60, 0x01, 0x07, 0x14, 0x00, 0xac,
+            0x20, 0x30, 0x75, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66, 0x1e, 0x00, 0xf8, 0x01, 0x45, 0x4e,
+            0x41, 0x42, 0x4c, 0x45, 0x44, 0x28, 0x69, 0x64, 0x78, 0x29, 0x20, 0x28, 0x28, 0x28, 0x35, 0x00,
+            0x31, 0x3e, 0x3e, 0x20, 0x17, 0x00, 0x80, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x3d, 0x3d, 0x07,
+            0x00, 0xf0, 0x05, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20,
+            0x50, 0x4f, 0x53, 0x5f, 0x49, 0x44, 0x58, 0xa7, 0x01, 0x18, 0x3b, 0x18, 0x00, 0x53, 0x43, 0x4f,
+            0x4c, 0x4f, 0x52, 0x1a, 0x00, 0x34, 0x31, 0x20, 0x2b, 0x28, 0x00, 0x09, 0x24, 0x00, 0x27, 0x55,
+            0x56, 0x21, 0x00, 0x05, 0x31, 0x00, 0x09, 0x23, 0x00, 0x67, 0x4e, 0x4f, 0x52, 0x4d, 0x41, 0x4c,
+            0x27, 0x00, 0x02, 0x34, 0x00, 0x09, 0x24, 0x00, 0x77, 0x54, 0x41, 0x4e, 0x47, 0x45, 0x4e, 0x54,
+            0x25, 0x00, 0x06, 0x36, 0x00, 0x09, 0x29, 0x00, 0xf7, 0x03, 0x49, 0x4e, 0x53, 0x54, 0x41, 0x4e,
+            0x43, 0x45, 0x5f, 0x54, 0x52, 0x41, 0x4e, 0x53, 0x46, 0x4f, 0x52, 0x4d, 0x34, 0x00, 0x07, 0x46,
+            0x00, 0x0f, 0x35, 0x00, 0x03, 0x6e, 0x49, 0x4e, 0x56, 0x45, 0x52, 0x53, 0x3d, 0x00, 0x3f, 0x34,
+            0x20, 0x2b, 0x5a, 0x00, 0x04, 0x0f, 0x48, 0x00, 0x03, 0x65, 0x4d, 0x41, 0x54, 0x45, 0x52, 0x49,
+            0xd5, 0x00, 0x09, 0x3f, 0x00, 0x0f, 0x64, 0x00, 0x02, 0x09, 0x47, 0x00, 0x38, 0x4e, 0x45, 0x58,
+            0xea, 0x00, 0x05, 0x79, 0x00, 0x08, 0x56, 0x00, 0x30, 0x3b, 0x0a, 0x0a, 0x5e, 0x02, 0x90, 0x77,
+            0x65, 0x20, 0x61, 0x73, 0x73, 0x75, 0x6d, 0x65, 0x7d, 0x01, 0x25, 0x2c, 0x20, 0xf5, 0x00, 0x2d,
+            0x2c, 0x20, 0x67, 0x00, 0x54, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x43, 0x00, 0xf3, 0x00, 0x20, 0x61,
+            0x6c, 0x77, 0x61, 0x79, 0x73, 0x20, 0x65, 0x6e, 0x61, 0x62, 0x6c, 0x65, 0x64, 0xd6, 0x01, 0x43,
+            0x62, 0x6f, 0x6f, 0x6c, 0xa5, 0x01, 0x03, 0x31, 0x02, 0x24, 0x20, 0x3d, 0x74, 0x02, 0x03, 0x11,
+            0x00, 0x12, 0x28, 0x1f, 0x00, 0x44, 0x49, 0x44, 0x58, 0x29, 0xb4, 0x00, 0x01, 0x36, 0x00, 0x24,
+            0x55, 0x56, 0x22, 0x00, 0x0e, 0x33, 0x00, 0x02, 0xd0, 0x01, 0x0a, 0x30, 0x00, 0x03, 0xbf, 0x01,
+            0x0f, 0x34, 0x00, 0x06, 0x03, 0x20, 0x00, 0x0d, 0x68, 0x00, 0x04, 0xc3, 0x01, 0x0f, 0x39, 0x00,
+            0x06, 0x04, 0x21, 0x00, 0x02, 0x3a, 0x00, 0x04, 0x72, 0x04, 0x40, 0x6c, 0x6f, 0x63, 0x61, 0xfb,
+            0x03, 0x20, 0x20, 0x3d, 0x29, 0x01, 0x00, 0x13, 0x02, 0xef, 0x29, 0x20, 0x69, 0x6e, 0x20, 0x76,
+            0x65, 0x63, 0x33, 0x20, 0x70, 0x6f, 0x73, 0x3b, 0x28, 0x00, 0x00, 0x05, 0x77, 0x01, 0x05, 0x55,
+            0x01, 0x05, 0x37, 0x00, 0x01, 0x8c, 0x04, 0x61, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x3b, 0x86, 0x01,
+            0xf1, 0x09, 0x64, 0x65, 0x70, 0x74, 0x68, 0x20, 0x70, 0x61, 0x73, 0x73, 0x65, 0x73, 0x20, 0x6d,
+            0x75, 0x73, 0x74, 0x20, 0x70, 0x72, 0x6f, 0x64, 0x75, 0x63, 0xda, 0x03, 0xa0, 0x20, 0x69, 0x64,
+            0x65, 0x6e, 0x74, 0x69, 0x63, 0x61, 0x6c, 0x6a, 0x00, 0x10, 0x69, 0x86, 0x00, 0x41, 0x73, 0x20,
+            0x74, 0x6f, 0xe9, 0x03, 0x10, 0x73, 0x42, 0x04, 0x11, 0x64, 0x3a, 0x00, 0x42, 0x0a, 0x69, 0x6e,
+            0x76, 0x7c, 0x04, 0x53, 0x20, 0x67, 0x6c, 0x5f, 0x50, 0x2a, 0x00, 0x02, 0x60, 0x00, 0x06, 0x56,
+            0x05, 0x62, 0x20, 0x62, 0x75, 0x69, 0x6c, 0x64, 0x47, 0x04, 0x13, 0x70, 0x24, 0x00, 0x64, 0x20,
+            0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x3d, 0x00, 0x40, 0x75, 0x73, 0x65, 0x64, 0x9d, 0x04, 0x08, 0x94,
+            0x00, 0x04, 0x97, 0x04, 0xf2, 0x01, 0x68, 0x61, 0x76, 0x65, 0x20, 0x6e, 0x6f, 0x20, 0x66, 0x72,
+            0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x80, 0x00, 0x11, 0x72, 0x49, 0x02, 0x37, 0x69, 0x74, 0x68,
+            0xab, 0x05, 0x81, 0x20, 0x69, 0x74, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x9b, 0x00, 0x12, 0x65, 0x70,
+            0x00, 0xb0, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x6f, 0x6e, 0xc0, 0x00, 0xb0,
+            0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 0x50, 0x00, 0x50, 0x2e, 0x67,
+            0x6c, 0x73, 0x6c, 0xa9, 0x04, 0x00, 0xa8, 0x04, 0x06, 0xb1, 0x00, 0x04, 0x12, 0x00, 0x06, 0x5b,
+            0x00, 0x83, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x6f, 0x75, 0x5d, 0x04, 0x00, 0x3c, 0x00, 0x14,
+            0x5f, 0x5b, 0x00, 0x14, 0x3b, 0xbf, 0x04, 0xb3, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69,
+            0x6e, 0x28, 0x29, 0x00, 0x06, 0x07, 0x15, 0x01, 0x20, 0x20, 0x3d, 0x60, 0x01, 0x03, 0xe3, 0x05,
+            0x50, 0x20, 0x2a, 0x20, 0x28, 0x28, 0x01, 0x06, 0x22, 0x20, 0x2a, 0x93, 0x01, 0x30, 0x29, 0x20,
+            0x2a, 0xd8, 0x01, 0xdf, 0x34, 0x28, 0x70, 0x6f, 0x73, 0x2c, 0x20, 0x31, 0x2e, 0x66, 0x29, 0x29,
+            0x3b, 0x86, 0x00, 0x00, 0x00, 0x54, 0x06, 0x09, 0x7c, 0x00, 0x20, 0x20, 0x3d, 0x79, 0x01, 0x13,
+            0x49, 0xe5, 0x00, 0x80, 0x49, 0x44, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x4d, 0x8a, 0x05, 0x00, 0x84,
+            0x05, 0x70, 0x73, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x07, 0x06, 0x04, 0xad, 0x00, 0x24, 0x20,
+            0x30, 0xae, 0x00, 0x7f, 0x7d, 0x0a, 0x23, 0x65, 0x6c, 0x73, 0x65, 0x45, 0x02, 0x00, 0x06, 0x2e,
+            0x03, 0x03, 0x6f, 0x02, 0x7f, 0x34, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x71, 0x02, 0x01, 0x03,
+            0x27, 0x03, 0x03, 0x29, 0x00, 0x4f, 0x32, 0x20, 0x75, 0x76, 0x26, 0x00, 0x01, 0x07, 0x19, 0x03,
+            0x03, 0x2a, 0x00, 0x8f, 0x33, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x2e, 0x00, 0x01, 0x08,
+            0x0e, 0x03, 0x05, 0x2f, 0x00, 0x7f, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x30, 0x00, 0x01,
+            0x05, 0xf5, 0x02, 0x0d, 0x3f, 0x04, 0x0a, 0xfd, 0x02, 0x04, 0x89, 0x07, 0x01, 0x72, 0x01, 0x0f,
+            0x49, 0x00, 0x0a, 0x04, 0x72, 0x04, 0x05, 0x40, 0x00, 0x01, 0x53, 0x06, 0x60, 0x6d, 0x61, 0x74,
+            0x65, 0x72, 0x69, 0xb4, 0x00, 0x11, 0x0a, 0x4d, 0x03, 0x00, 0xc1, 0x01, 0x10, 0x4d, 0x51, 0x03,
+            0x21, 0x20, 0x3d, 0x0c, 0x00, 0x04, 0xcd, 0x01, 0x30, 0x3b, 0x0a, 0x0a, 0x2a, 0x02, 0x41, 0x76,
+            0x65, 0x63, 0x34, 0xb6, 0x02, 0x01, 0xfa, 0x07, 0x11, 0x5f, 0xb2, 0x03, 0x0a, 0x18, 0x00, 0x0f,
+            0x13, 0x00, 0x00, 0x03, 0x69, 0x01, 0x03, 0x28, 0x00, 0x12, 0x32, 0x40, 0x00, 0x00, 0x55, 0x01,
+            0x03, 0x12, 0x00, 0x12, 0x33, 0x12, 0x00, 0x00, 0x6f, 0x00, 0x14, 0x5f, 0x42, 0x01, 0x0f, 0x1b,
+            0x00, 0x00, 0x05, 0x2e, 0x01, 0x0f, 0x1c, 0x00, 0x00, 0x25, 0x62, 0x69, 0x1e, 0x00, 0x0f, 0xd6,
+            0x02, 0x00, 0x07, 0xe5, 0x00, 0x0f, 0xd1, 0x02, 0x00, 0x01, 0x7d, 0x02, 0x01, 0x7d, 0x00, 0x33,
+            0x70, 0x6f, 0x73, 0xf7, 0x00, 0x02, 0x03, 0x01, 0x0c, 0xc0, 0x02, 0x02, 0xc6, 0x08, 0x0f, 0x01,
+            0x03, 0x08, 0x09, 0x4b, 0x00, 0x02, 0x2e, 0x00, 0x01, 0x13, 0x00, 0x02, 0x59, 0x00, 0x07, 0x39,
+            0x00, 0x07, 0x1c, 0x00, 0x01, 0x1e, 0x01, 0x2b, 0x20, 0x3d, 0xef, 0x05, 0x12, 0x3f, 0x9f, 0x02,
+            0x22, 0x20, 0x3a, 0x43, 0x03, 0x57, 0x31, 0x2e, 0x30, 0x66, 0x29, 0x35, 0x00, 0x41, 0x75, 0x76,
+            0x20, 0x3d, 0x98, 0x02, 0x05, 0x3e, 0x03, 0x04, 0xe4, 0x00, 0x20, 0x20, 0x3d, 0xa2, 0x09, 0x03,
+            0xd4, 0x01, 0x00, 0x1e, 0x00, 0x01, 0x9e, 0x09, 0x33, 0x69, 0x66, 0x28, 0xb0, 0x02, 0x03, 0xb0,
+            0x05, 0x11, 0x29, 0x17, 0x00, 0x00, 0x20, 0x00, 0x01, 0xa1, 0x00, 0x01, 0xff, 0x00, 0x02, 0x7c,
+            0x01, 0x02, 0x41, 0x00, 0xc9, 0x33, 0x28, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65,
+            0x28, 0x64, 0x02, 0x29, 0x20, 0x2a, 0xfd, 0x09, 0x10, 0x29, 0xe6, 0x03, 0x02, 0x39, 0x00, 0x02,
+            0x9f, 0x00, 0x0d, 0x6a, 0x00, 0x35, 0x20, 0x26, 0x26, 0xfe, 0x02, 0x09, 0x7d, 0x00, 0x02, 0x4f,
+            0x0a, 0x0a, 0x83, 0x00, 0x03, 0xc6, 0x01, 0x04, 0x84, 0x00, 0x00, 0x97, 0x00, 0x01, 0x8b, 0x01,
+            0x00, 0x66, 0x00, 0x03, 0x1c, 0x00, 0x02, 0x67, 0x00, 0x0a, 0x37, 0x00, 0x05, 0xff, 0x01, 0x9c,
+            0x20, 0x3d, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0xd6, 0x00, 0x17, 0x2c, 0x64, 0x02, 0x03,
+            0x49, 0x00, 0x03, 0x50, 0x01, 0xb0, 0x7d, 0x0a, 0x7d, 0x0a, 0x23, 0x65, 0x6e, 0x64, 0x69, 0x66,
+            0x0a,
+        };
+        constexpr uint8_t shader_10[] = {
+            0xf1, 0x39, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x0a,
+            0x2f, 0x2f, 0x20, 0x42, 0x75, 0x69, 0x6c, 0x64, 0x73, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6c, 0x65,
+            0x76, 0x65, 0x6c, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x48, 0x69, 0x2d, 0x5a, 0x20,
+            0x70, 0x79, 0x72, 0x61, 0x6d, 0x69, 0x64, 0x2c, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x20, 0x74,
+            0x65, 0x78, 0x65, 0x6c, 0x20, 0x6b, 0x65, 0x65, 0x70, 0x73, 0x24, 0x00, 0xe4, 0x66, 0x61, 0x72,
+            0x74, 0x68, 0x65, 0x73, 0x74, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x3a, 0x00, 0x01, 0x26, 0x00,
+            0x70, 0x73, 0x20, 0x69, 0x74, 0x20, 0x63, 0x6f, 0x6e, 0x00, 0x10, 0x2e, 0x67, 0x00, 0x11, 0x4c,
+            0x5c, 0x00, 0x72, 0x30, 0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x3e, 0x00, 0x02, 0x35, 0x00, 0xe2,
+            0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x6c, 0x61, 0x74, 0x65, 0x72, 0x84, 0x00,
+            0x81, 0x73, 0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x65, 0x00, 0x82, 0x70, 0x72, 0x65, 0x76,
+            0x69, 0x6f, 0x75, 0x73, 0x1b, 0x00, 0xf7, 0x0c, 0x2e, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74,
+            0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x78, 0x20, 0x3d, 0x20,
+            0x38, 0x2c, 0x20, 0x12, 0x00, 0x10, 0x79, 0x12, 0x00, 0x64, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a,
+            0x30, 0x00, 0xf2, 0x0f, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d, 0x20, 0x37, 0x29,
+            0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72,
+            0x32, 0x44, 0xc2, 0x00, 0x13, 0x5f, 0x8d, 0x00, 0xf2, 0x14, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x48,
+            0x69, 0x5a, 0x43, 0x75, 0x6c, 0x6c, 0x65, 0x72, 0x3a, 0x3a, 0x44, 0x45, 0x50, 0x54, 0x48, 0x5f,
+            0x54, 0x45, 0x58, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x2c, 0x8e, 0x00, 0x7e,
+            0x20, 0x30, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x64, 0x00, 0xd0, 0x30, 0x2c, 0x20, 0x72, 0x33, 0x32,
+            0x66, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x23, 0x00, 0x05, 0x73, 0x00, 0xf1, 0x00, 0x69, 0x6d,
+            0x61, 0x67, 0x65, 0x32, 0x44, 0x20, 0x73, 0x6f, 0x75, 0x72, 0x63, 0x65, 0x5f, 0x74, 0x01, 0x1e,
+            0x3b, 0x41, 0x00, 0x14, 0x31, 0x41, 0x00, 0x5f, 0x77, 0x72, 0x69, 0x74, 0x65, 0x42, 0x00, 0x02,
+            0x6b, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x42, 0x00, 0x00, 0x05, 0x01, 0x10, 0x74, 0xe0, 0x01,
+            0x36, 0x3d, 0x20, 0x30, 0xe8, 0x00, 0x40, 0x62, 0x6f, 0x6f, 0x6c, 0x7b, 0x01, 0x21, 0x79, 0x5f,
+            0x75, 0x01, 0xf2, 0x0c, 0x3b, 0x0a, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x4c, 0x6f, 0x61,
+            0x64, 0x28, 0x69, 0x76, 0x65, 0x63, 0x32, 0x20, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x2c, 0x20, 0x0d,
+            0x00, 0xf2, 0x03, 0x6c, 0x61, 0x73, 0x74, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72,
+            0x65, 0x74, 0x75, 0x72, 0x6e, 0xb8, 0x00, 0x01, 0x30, 0x00, 0x08, 0xba, 0x00, 0x63, 0x2c, 0x20,
+            0x6d, 0x69, 0x6e, 0x28, 0x3c, 0x00, 0x01, 0x36, 0x00, 0xf4, 0x03, 0x29, 0x2e, 0x72, 0x3b, 0x0a,
+            0x7d, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x49, 0x00, 0x02,
+            0x5b, 0x00, 0x01, 0x2c, 0x00, 0x22, 0x20, 0x3d, 0x69, 0x00, 0xd3, 0x28, 0x67, 0x6c, 0x5f, 0x47,
+            0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0xba, 0x00, 0x71, 0x49, 0x44, 0x2e, 0x78, 0x79,
+            0x29, 0x3b, 0x7c, 0x00, 0x02, 0x33, 0x00, 0x03, 0xe9, 0x00, 0x00, 0xec, 0x01, 0x00, 0x39, 0x00,
+            0x00, 0x41, 0x01, 0x53, 0x53, 0x69, 0x7a, 0x65, 0x28, 0x18, 0x00, 0x01, 0x43, 0x01, 0x04, 0x31,
+            0x00, 0x90, 0x66, 0x28, 0x61, 0x6e, 0x79, 0x28, 0x67, 0x72, 0x65, 0x4e, 0x02, 0x94, 0x54, 0x68,
+            0x61, 0x6e, 0x45, 0x71, 0x75, 0x61, 0x6c, 0xa2, 0x00, 0x03, 0x32, 0x00, 0x00, 0x4a, 0x00, 0x31,
+            0x29, 0x29, 0x29, 0x63, 0x00, 0x06, 0xe3, 0x00, 0x03, 0x73, 0x00, 0x26, 0x66, 0x28, 0x29, 0x01,
+            0x02, 0x23, 0x00, 0x02, 0x08, 0x01, 0x00, 0x29, 0x00, 0x01, 0x05, 0x01, 0x4a, 0x53, 0x74, 0x6f,
+            0x72, 0x7d, 0x00, 0x14, 0x2c, 0x3e, 0x01, 0x51, 0x76, 0x65, 0x63, 0x34, 0x28, 0x00, 0x03, 0x61,
+            0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x6e, 0x01, 0x04, 0x56, 0x02, 0x05, 0x26, 0x00, 0x53, 0x30,
+            0x29, 0x2e, 0x72, 0x29, 0xb1, 0x00, 0x00, 0x56, 0x00, 0x02, 0x62, 0x01, 0x02, 0x7f, 0x00, 0x21,
+            0x7d, 0x0a, 0x96, 0x00, 0x02, 0xf9, 0x00, 0x03, 0x6a, 0x01, 0x00, 0xaf, 0x00, 0x09, 0xf9, 0x00,
+            0x03, 0x18, 0x00, 0x09, 0xf9, 0x00, 0x01, 0xc5, 0x01, 0x00, 0x82, 0x01, 0x24, 0x20, 0x3d, 0x5c,
+            0x02, 0x01, 0x38, 0x00, 0x32, 0x2d, 0x20, 0x31, 0x5a, 0x00, 0x02, 0x53, 0x00, 0x62, 0x62, 0x61,
+            0x73, 0x65, 0x20, 0x3d, 0xb0, 0x00, 0x42, 0x20, 0x2a, 0x20, 0x32, 0x1c, 0x00, 0x02, 0x0e, 0x02,
+            0x01, 0xae, 0x00, 0x70, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x28, 0x04, 0x00, 0x01, 0xee, 0x01,
+            0x00, 0x31, 0x00, 0x00, 0x9d, 0x03, 0x42, 0x73, 0x74, 0x29, 0x2c, 0x30, 0x02, 0x00, 0x12, 0x00,
+            0x23, 0x20, 0x2b, 0xc1, 0x01, 0x53, 0x31, 0x2c, 0x20, 0x30, 0x29, 0x20, 0x00, 0x21, 0x29, 0x2c,
+            0xbc, 0x00, 0x00, 0xd3, 0x00, 0x0a, 0x04, 0x00, 0x09, 0x4d, 0x00, 0x05, 0x3b, 0x00, 0x44, 0x30,
+            0x2c, 0x20, 0x31, 0x3b, 0x00, 0x0f, 0x5b, 0x00, 0x04, 0x05, 0x20, 0x00, 0x04, 0x2f, 0x01, 0x70,
+            0x2f, 0x2f, 0x20, 0x6f, 0x64, 0x64, 0x20, 0xda, 0x00, 0x12, 0x64, 0x83, 0x03, 0x60, 0x73, 0x20,
+            0x66, 0x6f, 0x6c, 0x64, 0x2a, 0x04, 0x22, 0x69, 0x72, 0x00, 0x01, 0xf0, 0x04, 0x72, 0x6f, 0x77,
+            0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x75, 0x6d, 0x6e, 0x20, 0x69, 0x6e, 0x74, 0x6f,
+            0x1f, 0x00, 0x02, 0x1d, 0x00, 0x02, 0x02, 0x02, 0x02, 0xca, 0x04, 0x01, 0xae, 0x00, 0x01, 0x1b,
+            0x03, 0x51, 0x65, 0x78, 0x74, 0x72, 0x61, 0x48, 0x04, 0x04, 0x5c, 0x01, 0x00, 0x62, 0x00, 0xf2,
+            0x00, 0x2e, 0x78, 0x20, 0x26, 0x20, 0x31, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x20, 0x26, 0x26,
+            0x35, 0x01, 0x53, 0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x47, 0x00, 0x01, 0x7f, 0x04, 0x26, 0x2e, 0x78,
+            0x64, 0x01, 0x07, 0x4d, 0x00, 0x00, 0x83, 0x04, 0x09, 0x4d, 0x00, 0x1f, 0x79, 0x4d, 0x00, 0x01,
+            0x1c, 0x79, 0x4d, 0x00, 0x16, 0x79, 0x4d, 0x00, 0x33, 0x69, 0x66, 0x28, 0x98, 0x00, 0x02, 0x87,
+            0x02, 0x00, 0x54, 0x01, 0x08, 0xa3, 0x01, 0x01, 0x0c, 0x00, 0x11, 0x2c, 0xae, 0x01, 0x05, 0xaa,
+            0x01, 0x05, 0x5d, 0x01, 0x17, 0x32, 0x98, 0x01, 0x0f, 0x5d, 0x01, 0x01, 0x17, 0x32, 0x7d, 0x01,
+            0x04, 0x5d, 0x01, 0x05, 0x71, 0x00, 0x1f, 0x79, 0x71, 0x00, 0x20, 0x4f, 0x30, 0x2c, 0x20, 0x32,
+            0xce, 0x01, 0x0c, 0x05, 0x20, 0x00, 0x0d, 0x71, 0x00, 0x10, 0x78, 0x5f, 0x01, 0x02, 0xed, 0x00,
+            0x0f, 0x7c, 0x00, 0x0b, 0x0f, 0xe9, 0x00, 0x02, 0x06, 0x58, 0x00, 0x02, 0xce, 0x02, 0x0f, 0xa6,
+            0x03, 0x12, 0xb0, 0x64, 0x65, 0x70, 0x74, 0x68, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_11[] = {
+            0xf0, 0x25, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x0a,
+            0x2f, 0x2f, 0x20, 0x43, 0x75, 0x6c, 0x6c, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e, 0x73,
+            0x74, 0x61, 0x6e, 0x63, 0x65, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x6e, 0x65, 0x20, 0x6d, 0x65,
+            0x73, 0x68, 0x20, 0x61, 0x67, 0x61, 0x19, 0x00, 0x01, 0x22, 0x00, 0xf1, 0x01, 0x76, 0x69, 0x65,
+            0x77, 0x20, 0x66, 0x72, 0x75, 0x73, 0x74, 0x75, 0x6d, 0x20, 0x61, 0x6e, 0x64, 0x15, 0x00, 0xd0,
+            0x48, 0x69, 0x2d, 0x5a, 0x20, 0x70, 0x79, 0x72, 0x61, 0x6d, 0x69, 0x64, 0x2c, 0x52, 0x00, 0xf5,
+            0x0d, 0x73, 0x75, 0x72, 0x76, 0x69, 0x76, 0x6f, 0x72, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x61,
+            0x70, 0x70, 0x65, 0x6e, 0x64, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20, 0x61, 0x6e, 0x65, 0x00, 0xf2,
+            0x03, 0x20, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x64, 0x72, 0x61, 0x77, 0x6e, 0x20, 0x77,
+            0x69, 0x74, 0x68, 0x1e, 0x00, 0xf0, 0x00, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x20, 0x63, 0x6f,
+            0x6d, 0x6d, 0x61, 0x6e, 0x64, 0x2e, 0x50, 0x00, 0xb1, 0x45, 0x41, 0x52, 0x4c, 0x59, 0x5f, 0x50,
+            0x48, 0x41, 0x53, 0x45, 0x2f, 0x00, 0xf1, 0x0f, 0x73, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x77,
+            0x61, 0x73, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6c, 0x65, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20,
+            0x66, 0x72, 0x61, 0x6d, 0x65, 0x2c, 0x94, 0x00, 0x43, 0x4c, 0x41, 0x54, 0x45, 0x32, 0x00, 0xf0,
+            0x06, 0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x65, 0x76, 0x65, 0x72, 0x79, 0x74, 0x68, 0x69, 0x6e,
+            0x67, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x57, 0x00, 0x08, 0xd9, 0x00, 0x03, 0xbf, 0x00, 0x50, 0x20,
+            0x62, 0x75, 0x69, 0x6c, 0x49, 0x00, 0x21, 0x6f, 0x6d, 0x47, 0x00, 0x53, 0x65, 0x61, 0x72, 0x6c,
+            0x79, 0x74, 0x00, 0x00, 0xef, 0x00, 0x62, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x2e, 0x01, 0x01,
+            0x7b, 0x00, 0xf3, 0x1f, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x2e, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75,
+            0x74, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x78, 0x20, 0x3d,
+            0x20, 0x36, 0x34, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74,
+            0x20, 0x49, 0x60, 0x01, 0xf6, 0x07, 0x44, 0x61, 0x74, 0x61, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+            0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x3b, 0x10, 0x00, 0x20, 0x69,
+            0x6e, 0xa4, 0x01, 0x27, 0x65, 0x5f, 0x18, 0x00, 0x40, 0x75, 0x69, 0x6e, 0x74, 0x2d, 0x00, 0x43,
+            0x65, 0x72, 0x69, 0x61, 0x2b, 0x00, 0x01, 0x13, 0x00, 0xb4, 0x5f, 0x70, 0x61, 0x64, 0x5b, 0x33,
+            0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x85, 0x00, 0xc0, 0x73, 0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20,
+            0x62, 0x69, 0x6e, 0x64, 0xef, 0x00, 0xd4, 0x3d, 0x20, 0x34, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64,
+            0x6f, 0x6e, 0x6c, 0x79, 0x76, 0x01, 0x10, 0x5f, 0xd3, 0x01, 0x01, 0xec, 0x01, 0x03, 0x89, 0x00,
+            0x08, 0x9c, 0x00, 0x05, 0xa4, 0x01, 0x2f, 0x73, 0x5b, 0x5a, 0x00, 0x0c, 0x25, 0x35, 0x29, 0x51,
+            0x00, 0x06, 0x0f, 0x01, 0x03, 0x52, 0x00, 0x01, 0xa0, 0x00, 0x06, 0x16, 0x00, 0xd5, 0x5b, 0x5d,
+            0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x31, 0x20, 0x77, 0x68, 0x65, 0x6e, 0xb8, 0x01, 0x21, 0x69, 0x6e,
+            0x68, 0x01, 0x01, 0xbf, 0x01, 0xaf, 0x6c, 0x61, 0x74, 0x65, 0x20, 0x70, 0x68, 0x61, 0x73, 0x65,
+            0xce, 0x00, 0x0a, 0x89, 0x36, 0x29, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0xcf, 0x00, 0x05, 0x73,
+            0x02, 0x03, 0x7d, 0x00, 0x09, 0xcf, 0x00, 0x05, 0x1d, 0x00, 0x0f, 0xcf, 0x00, 0x0d, 0x16, 0x37,
+            0xcf, 0x00, 0x03, 0x80, 0x02, 0x00, 0xb3, 0x00, 0x53, 0x44, 0x72, 0x61, 0x77, 0x49, 0x98, 0x02,
+            0x12, 0x43, 0x97, 0x02, 0x03, 0x66, 0x00, 0x01, 0xe3, 0x00, 0x52, 0x63, 0x6f, 0x75, 0x6e, 0x74,
+            0xbe, 0x01, 0x01, 0x10, 0x00, 0x04, 0x5a, 0x01, 0x1c, 0x5f, 0x19, 0x00, 0x43, 0x66, 0x69, 0x72,
+            0x73, 0x29, 0x00, 0x00, 0xce, 0x01, 0xb7, 0x62, 0x61, 0x73, 0x65, 0x5f, 0x76, 0x65, 0x72, 0x74,
+            0x65, 0x78, 0x3e, 0x00, 0x01, 0x16, 0x00, 0x04, 0x43, 0x00, 0x08, 0xd7, 0x01, 0x06, 0xcf, 0x01,
+            0xf1, 0x09, 0x37, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d,
+            0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x68, 0x69, 0x7a, 0x60, 0x01, 0x30, 0x48, 0x69, 0x5a,
+            0xd1, 0x03, 0xf2, 0x0e, 0x65, 0x72, 0x3a, 0x3a, 0x44, 0x45, 0x50, 0x54, 0x48, 0x5f, 0x54, 0x45,
+            0x58, 0x54, 0x55, 0x52, 0x45, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x0a, 0x0a, 0x63, 0x6f, 0x6e, 0x73,
+            0x74, 0xa8, 0x00, 0x08, 0x56, 0x03, 0x48, 0x3d, 0x20, 0x30, 0x3b, 0x1c, 0x00, 0x07, 0x3f, 0x03,
+            0x35, 0x3d, 0x20, 0x31, 0x5b, 0x02, 0x00, 0xe0, 0x02, 0x10, 0x74, 0x3c, 0x04, 0x36, 0x3d, 0x20,
+            0x30, 0x85, 0x00, 0x01, 0xc4, 0x02, 0x00, 0x1a, 0x04, 0x70, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+            0x63, 0x22, 0x00, 0x0f, 0x33, 0x00, 0x01, 0x16, 0x31, 0x33, 0x00, 0xd0, 0x76, 0x65, 0x63, 0x33,
+            0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73, 0x5f, 0x6d, 0x23, 0x03, 0x07, 0x41, 0x03, 0x00, 0x3f,
+            0x00, 0x4f, 0x20, 0x3d, 0x20, 0x32, 0x2e, 0x00, 0x04, 0x2f, 0x61, 0x78, 0x5c, 0x00, 0x01, 0x16,
+            0x33, 0x2e, 0x00, 0x01, 0xdd, 0x00, 0x04, 0x42, 0x01, 0x40, 0x5f, 0x74, 0x6f, 0x74, 0x31, 0x03,
+            0x0e, 0x60, 0x00, 0x1b, 0x34, 0x32, 0x00, 0x01, 0x79, 0x02, 0x0f, 0x5b, 0x00, 0x01, 0x16, 0x35,
+            0x29, 0x00, 0x92, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x68, 0x61, 0x73, 0x5f, 0xbb, 0x00, 0x01, 0x71,
+            0x01, 0x00, 0xba, 0x04, 0x33, 0x6f, 0x75, 0x74, 0xce, 0x00, 0x08, 0x68, 0x04, 0x15, 0x69, 0x9f,
+            0x04, 0x01, 0x68, 0x05, 0x41, 0x6e, 0x64, 0x63, 0x20, 0xdb, 0x04, 0x00, 0x49, 0x04, 0x71, 0x6e,
+            0x65, 0x61, 0x72, 0x65, 0x73, 0x74, 0x15, 0x00, 0x50, 0x64, 0x65, 0x70, 0x74, 0x68, 0x73, 0x05,
+            0x00, 0x84, 0x05, 0x31, 0x62, 0x6f, 0x78, 0x36, 0x05, 0x00, 0xb6, 0x04, 0x29, 0x65, 0x64, 0x7d,
+            0x05, 0x50, 0x66, 0x61, 0x72, 0x74, 0x68, 0x35, 0x00, 0x02, 0x31, 0x00, 0x51, 0x75, 0x6e, 0x64,
+            0x65, 0x72, 0x3e, 0x03, 0x00, 0x56, 0x00, 0x11, 0x0a, 0x9c, 0x00, 0x42, 0x48, 0x69, 0x5a, 0x56,
+            0x12, 0x05, 0x50, 0x28, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x00, 0x00, 0x60, 0x01, 0x26, 0x2c, 0x20,
+            0x0e, 0x00, 0x81, 0x61, 0x78, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x7c, 0x00, 0x11, 0x5f, 0x4b,
+            0x00, 0x13, 0x29, 0xcf, 0x02, 0x01, 0x25, 0x00, 0x20, 0x75, 0x76, 0x32, 0x00, 0xc1, 0x20, 0x3d,
+            0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x6e, 0x64, 0x63, 0x10, 0x00, 0x81, 0x2a, 0x20, 0x30,
+            0x2e, 0x35, 0x66, 0x20, 0x2b, 0x07, 0x00, 0xb2, 0x2c, 0x20, 0x30, 0x2e, 0x66, 0x2c, 0x20, 0x31,
+            0x2e, 0x66, 0x29, 0xbb, 0x02, 0x05, 0x3a, 0x00, 0x10, 0x61, 0xf8, 0x04, 0x07, 0x3a, 0x00, 0x2f,
+            0x61, 0x78, 0x3a, 0x00, 0x11, 0xa0, 0x65, 0x78, 0x74, 0x65, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x28,
+            0x7e, 0x00, 0x50, 0x61, 0x78, 0x20, 0x2d, 0x20, 0x09, 0x00, 0x51, 0x69, 0x6e, 0x29, 0x20, 0x2a,
+            0xbb, 0x00, 0xf3, 0x05, 0x28, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x69, 0x7a, 0x65,
+            0x28, 0x68, 0x69, 0x7a, 0x2c, 0x20, 0x30, 0x29, 0x7b, 0x00, 0x80, 0x2f, 0x2f, 0x20, 0x6c, 0x65,
+            0x76, 0x65, 0x6c, 0x58, 0x04, 0x25, 0x72, 0x65, 0x10, 0x01, 0xf1, 0x0a, 0x20, 0x73, 0x70, 0x61,
+            0x6e, 0x73, 0x20, 0x61, 0x74, 0x20, 0x6d, 0x6f, 0x73, 0x74, 0x20, 0x32, 0x78, 0x32, 0x20, 0x74,
+            0x65, 0x78, 0x65, 0x6c, 0x73, 0x67, 0x05, 0x00, 0x80, 0x03, 0x02, 0x36, 0x00, 0xf1, 0x04, 0x3d,
+            0x20, 0x69, 0x6e, 0x74, 0x28, 0x63, 0x65, 0x69, 0x6c, 0x28, 0x6c, 0x6f, 0x67, 0x32, 0x28, 0x6d,
+            0x61, 0x78, 0x04, 0x00, 0x02, 0x93, 0x00, 0x43, 0x2e, 0x78, 0x2c, 0x20, 0x0a, 0x00, 0x22, 0x79,
+            0x29, 0xf1, 0x00, 0x14, 0x29, 0x79, 0x00, 0x04, 0x40, 0x00, 0x02, 0xee, 0x00, 0x01, 0x0e, 0x00,
+            0x40, 0x2c, 0x20, 0x30, 0x2c, 0x67, 0x00, 0x00, 0xab, 0x00, 0x60, 0x51, 0x75, 0x65, 0x72, 0x79,
+            0x4c, 0x9a, 0x00, 0x10, 0x73, 0xb2, 0x00, 0x53, 0x29, 0x20, 0x2d, 0x20, 0x31, 0xb3, 0x00, 0x11,
+            0x69, 0x2f, 0x01, 0x01, 0xf4, 0x04, 0x14, 0x3d, 0x2f, 0x00, 0x06, 0xda, 0x00, 0x01, 0x4a, 0x00,
+            0x01, 0x2f, 0x00, 0x02, 0x5c, 0x01, 0x02, 0x2e, 0x00, 0x25, 0x70, 0x30, 0x93, 0x01, 0x01, 0x11,
+            0x00, 0x01, 0x2a, 0x01, 0x24, 0x69, 0x6e, 0x20, 0x01, 0x01, 0x4d, 0x00, 0x72, 0x2b, 0x20, 0x31,
+            0x29, 0x29, 0x2c, 0x20, 0x20, 0x00, 0x31, 0x30, 0x29, 0x2c, 0x16, 0x07, 0x09, 0x74, 0x00, 0x2f,
+            0x70, 0x31, 0x46, 0x00, 0x00, 0x01, 0xa4, 0x01, 0x00, 0x93, 0x00, 0x0f, 0x46, 0x00, 0x0f, 0x02,
+            0x39, 0x02, 0x05, 0x89, 0x02, 0x24, 0x3d, 0x20, 0x2f, 0x01, 0x01, 0x5c, 0x01, 0x50, 0x46, 0x65,
+            0x74, 0x63, 0x68, 0xed, 0x00, 0x52, 0x2c, 0x20, 0x70, 0x30, 0x2c, 0x97, 0x01, 0x31, 0x29, 0x2e,
+            0x72, 0x13, 0x01, 0x09, 0x1e, 0x00, 0x02, 0xa2, 0x00, 0x20, 0x70, 0x31, 0x5f, 0x01, 0x21, 0x70,
+            0x30, 0x5b, 0x01, 0x02, 0xf6, 0x00, 0x41, 0x2e, 0x72, 0x29, 0x2c, 0xa1, 0x01, 0x00, 0x1c, 0x07,
+            0x0d, 0x04, 0x00, 0x00, 0x6d, 0x00, 0x0c, 0x69, 0x00, 0x03, 0x4b, 0x00, 0x11, 0x30, 0x4b, 0x00,
+            0x19, 0x31, 0x4b, 0x00, 0x0e, 0x78, 0x00, 0x26, 0x70, 0x31, 0x96, 0x00, 0x04, 0xc7, 0x01, 0x61,
+            0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x2a, 0x03, 0x01, 0x0d, 0x03, 0x0a, 0xb0, 0x02, 0x35, 0x20,
+            0x3c, 0x3d, 0xef, 0x00, 0xf4, 0x00, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+            0x6d, 0x61, 0x69, 0x6e, 0x28, 0x36, 0x03, 0x02, 0x70, 0x04, 0xf3, 0x0a, 0x20, 0x3d, 0x20, 0x67,
+            0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69,
+            0x6f, 0x6e, 0x49, 0x44, 0x2e, 0xdd, 0x05, 0x60, 0x69, 0x66, 0x28, 0x69, 0x20, 0x3e, 0x6e, 0x02,
+            0x02, 0x64, 0x09, 0x02, 0x99, 0x04, 0x15, 0x29, 0xed, 0x00, 0x02, 0x87, 0x00, 0x02, 0xf2, 0x01,
+            0x01, 0xcb, 0x03, 0x41, 0x77, 0x61, 0x73, 0x5f, 0x3e, 0x07, 0x42, 0x6c, 0x65, 0x20, 0x3d, 0x30,
+            0x07, 0x01, 0x6d, 0x08, 0x92, 0x5b, 0x69, 0x5d, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x2c, 0x00,
+            0x31, 0x69, 0x66, 0x28, 0xba, 0x04, 0x39, 0x20, 0x3d, 0x3d, 0xd2, 0x05, 0x47, 0x26, 0x26, 0x20,
+            0x21, 0x43, 0x00, 0x0e, 0x69, 0x00, 0x01, 0x7a, 0x00, 0x01, 0x6a, 0x00, 0x06, 0x66, 0x00, 0x45,
+            0x74, 0x72, 0x75, 0x65, 0x57, 0x00, 0x06, 0xe8, 0x04, 0x02, 0x3d, 0x00, 0x02, 0xb1, 0x08, 0x00,
+            0x95, 0x01, 0x01, 0xf1, 0x05, 0x31, 0x6d, 0x76, 0x70, 0x98, 0x00, 0x09, 0xf7, 0x05, 0x27, 0x20,
+            0x2a, 0x3c, 0x08, 0x37, 0x69, 0x5d, 0x2e, 0xc2, 0x08, 0x00, 0x39, 0x00, 0x12, 0x75, 0xf8, 0x05,
+            0x62, 0x65, 0x6c, 0x6f, 0x77, 0x20, 0x3d, 0x0e, 0x00, 0xa0, 0x28, 0x30, 0x75, 0x29, 0x2c, 0x20,
+            0x61, 0x62, 0x6f, 0x76, 0xe7, 0x00, 0x05, 0x13, 0x00, 0x01, 0x5b, 0x05, 0xf0, 0x0a, 0x63, 0x6f,
+            0x72, 0x6e, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x75, 0x74, 0x73, 0x69, 0x64, 0x65, 0x20, 0x65, 0x61,
+            0x63, 0x68, 0x20, 0x70, 0x61, 0x69, 0x72, 0x2d, 0x05, 0xa2, 0x63, 0x6c, 0x69, 0x70, 0x20, 0x70,
+            0x6c, 0x61, 0x6e, 0x65, 0xd3, 0x03, 0x00, 0x60, 0x00, 0x01, 0xcf, 0x00, 0x80, 0x63, 0x72, 0x6f,
+            0x73, 0x73, 0x65, 0x73, 0x5f, 0x63, 0x05, 0x10, 0x20, 0xbe, 0x01, 0x23, 0x6c, 0x73, 0xd5, 0x00,
+            0x00, 0x23, 0x00, 0x01, 0x82, 0x00, 0x04, 0xd5, 0x04, 0x10, 0x3d, 0x5d, 0x04, 0x20, 0x33, 0x28,
+            0xc8, 0x04, 0x11, 0x2c, 0x02, 0x02, 0x02, 0xc0, 0x04, 0x00, 0x24, 0x00, 0x20, 0x28, 0x2d, 0x16,
+            0x00, 0x02, 0x0d, 0x01, 0x00, 0x38, 0x00, 0x41, 0x66, 0x6f, 0x72, 0x28, 0xea, 0x01, 0x21, 0x63,
+            0x20, 0x7d, 0x01, 0xc2, 0x20, 0x63, 0x20, 0x3c, 0x20, 0x38, 0x75, 0x3b, 0x20, 0x63, 0x2b, 0x2b,
+            0x20, 0x01, 0x00, 0x26, 0x00, 0x06, 0x24, 0x01, 0x00, 0x0e, 0x00, 0x00, 0x48, 0x00, 0x03, 0xc5,
+            0x00, 0x72, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x38, 0x06, 0x00, 0x51, 0x05, 0x13, 0x2c,
+            0x31, 0x06, 0x02, 0x91, 0x05, 0x00, 0x2a, 0x00, 0xf9, 0x02, 0x28, 0x63, 0x20, 0x26, 0x20, 0x31,
+            0x75, 0x2c, 0x20, 0x28, 0x63, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x29, 0x0f, 0x00, 0x12, 0x32, 0x0f,
+            0x00, 0x04, 0xb6, 0x02, 0x00, 0x5f, 0x00, 0x00, 0x04, 0x00, 0x42, 0x76, 0x65, 0x63, 0x34, 0x0b,
+            0x01, 0x11, 0x3d, 0x92, 0x01, 0x01, 0x2f, 0x05, 0x22, 0x34, 0x28, 0x75, 0x00, 0x02, 0xb1, 0x04,
+            0x06, 0xc4, 0x00, 0x00, 0x31, 0x00, 0x02, 0x7d, 0x01, 0x14, 0x2b, 0x7e, 0x01, 0x90, 0x6c, 0x65,
+            0x73, 0x73, 0x54, 0x68, 0x61, 0x6e, 0x28, 0x44, 0x00, 0x41, 0x2e, 0x78, 0x79, 0x7a, 0x2b, 0x06,
+            0x31, 0x33, 0x28, 0x2d, 0x10, 0x00, 0x15, 0x77, 0xed, 0x04, 0x00, 0x3b, 0x00, 0x00, 0x04, 0x00,
+            0x02, 0xa9, 0x01, 0x05, 0x3f, 0x00, 0x7f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72, 0x42, 0x00,
+            0x01, 0x0f, 0x41, 0x00, 0x04, 0x22, 0x69, 0x66, 0x6b, 0x00, 0x10, 0x77, 0x5a, 0x03, 0x36, 0x30,
+            0x2e, 0x66, 0x3c, 0x01, 0x00, 0x5f, 0x00, 0x00, 0x04, 0x00, 0x0b, 0xc0, 0x01, 0x06, 0x94, 0x02,
+            0x00, 0x1d, 0x00, 0x00, 0x04, 0x00, 0x01, 0xc0, 0x0b, 0x00, 0x09, 0x00, 0x04, 0x04, 0x00, 0x0a,
+            0x76, 0x01, 0x00, 0x16, 0x00, 0x00, 0x50, 0x01, 0x00, 0xd1, 0x01, 0x01, 0xee, 0x04, 0x02, 0xd9,
+            0x00, 0x21, 0x20, 0x2f, 0x28, 0x01, 0x2a, 0x2e, 0x77, 0x10, 0x01, 0x00, 0x2e, 0x00, 0x06, 0x0f,
+            0x02, 0x34, 0x6d, 0x69, 0x6e, 0xf2, 0x06, 0x01, 0x11, 0x02, 0x03, 0x3d, 0x05, 0x00, 0x25, 0x00,
+            0x04, 0x04, 0x00, 0x01, 0x2d, 0x00, 0x01, 0x27, 0x02, 0x00, 0x8f, 0x04, 0x03, 0x0e, 0x00, 0x0f,
+            0x2d, 0x00, 0x01, 0x11, 0x7d, 0x62, 0x03, 0x00, 0x37, 0x00, 0x06, 0x0a, 0x00, 0x06, 0x6b, 0x03,
+            0x36, 0x61, 0x6c, 0x6c, 0x7d, 0x01, 0x01, 0x95, 0x01, 0x13, 0x2c, 0x11, 0x03, 0x8a, 0x38, 0x75,
+            0x29, 0x29, 0x29, 0x20, 0x26, 0x26, 0x23, 0x00, 0x01, 0x79, 0x01, 0x09, 0x23, 0x00, 0x06, 0xc8,
+            0x00, 0x82, 0x2f, 0x2f, 0x20, 0x62, 0x6f, 0x78, 0x65, 0x73, 0x3b, 0x01, 0x00, 0xf4, 0x0b, 0x00,
+            0x4a, 0x08, 0x62, 0x63, 0x61, 0x6d, 0x65, 0x72, 0x61, 0x23, 0x03, 0xc0, 0x20, 0x68, 0x61, 0x76,
+            0x65, 0x20, 0x6e, 0x6f, 0x20, 0x75, 0x73, 0x61, 0x2f, 0x0d, 0x66, 0x73, 0x63, 0x72, 0x65, 0x65,
+            0x6e, 0x8f, 0x08, 0x42, 0x73, 0x74, 0x61, 0x79, 0x64, 0x04, 0x25, 0x6c, 0x65, 0xb7, 0x00, 0x34,
+            0x69, 0x66, 0x28, 0xb0, 0x00, 0x22, 0x26, 0x26, 0x99, 0x0b, 0x00, 0x66, 0x04, 0x07, 0x1c, 0x0a,
+            0x00, 0x65, 0x04, 0x01, 0x74, 0x00, 0x03, 0x6f, 0x03, 0x0a, 0xcd, 0x01, 0x04, 0x3d, 0x00, 0x18,
+            0x3d, 0x97, 0x08, 0x01, 0x31, 0x01, 0x51, 0x69, 0x6e, 0x2e, 0x78, 0x79, 0x34, 0x01, 0x00, 0xff,
+            0x02, 0x06, 0x0c, 0x00, 0x43, 0x69, 0x6e, 0x2e, 0x7a, 0x73, 0x01, 0x21, 0x7d, 0x0a, 0x88, 0x00,
+            0x01, 0xd2, 0x03, 0x00, 0x23, 0x0e, 0x01, 0x6c, 0x04, 0x01, 0xec, 0x0d, 0x11, 0x3b, 0x19, 0x00,
+            0x08, 0xf8, 0x04, 0x06, 0x92, 0x00, 0x02, 0x81, 0x00, 0x06, 0x10, 0x02, 0x01, 0x83, 0x00, 0x05,
+            0x37, 0x05, 0x03, 0x47, 0x05, 0x95, 0x6c, 0x65, 0x20, 0x3f, 0x20, 0x31, 0x75, 0x20, 0x3a, 0x45,
+            0x05, 0x00, 0xa5, 0x01, 0x0a, 0x65, 0x00, 0x00, 0x80, 0x01, 0x08, 0x40, 0x05, 0x01, 0x90, 0x04,
+            0x00, 0x56, 0x01, 0x01, 0xb6, 0x09, 0x00, 0x7a, 0x0e, 0x00, 0x30, 0x00, 0x00, 0xce, 0x0e, 0x01,
+            0x72, 0x08, 0x02, 0x28, 0x0e, 0x01, 0x89, 0x05, 0x01, 0x9e, 0x00, 0x02, 0xf2, 0x01, 0x30, 0x69,
+            0x66, 0x28, 0x26, 0x00, 0x02, 0x95, 0x00, 0x00, 0x64, 0x00, 0x06, 0x89, 0x0c, 0xa5, 0x61, 0x74,
+            0x6f, 0x6d, 0x69, 0x63, 0x41, 0x64, 0x64, 0x28, 0xaa, 0x0a, 0x01, 0x2f, 0x0c, 0x76, 0x2c, 0x20,
+            0x31, 0x75, 0x29, 0x5d, 0x20, 0x28, 0x06, 0x80, 0x73, 0x5b, 0x69, 0x5d, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_12[] = {
+            0xf0, 0x16, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x0a,
+            0x2f, 0x2f, 0x20, 0x54, 0x65, 0x6d, 0x70, 0x6f, 0x72, 0x61, 0x6c, 0x20, 0x72, 0x65, 0x63, 0x6f,
+            0x6e, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x00, 0xf0, 0x01, 0x6f, 0x66, 0x20, 0x44, 0x79,
+            0x6e, 0x61, 0x6d, 0x69, 0x63, 0x52, 0x65, 0x73, 0x6f, 0x6c, 0x75, 0x15, 0x00, 0xf5, 0x15, 0x3a,
+            0x20, 0x62, 0x6c, 0x65, 0x6e, 0x64, 0x73, 0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x66, 0x72, 0x61,
+            0x6d, 0x65, 0x27, 0x73, 0x20, 0x6a, 0x69, 0x74, 0x74, 0x65, 0x72, 0x65, 0x64, 0x20, 0x6c, 0x6f,
+            0x77, 0x20, 0x72, 0x2d, 0x00, 0x60, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x63, 0x00, 0xf8, 0x0c,
+            0x69, 0x6e, 0x74, 0x6f, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+            0x63, 0x74, 0x65, 0x64, 0x20, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x30, 0x00, 0xf3, 0x0b, 0x68,
+            0x69, 0x73, 0x74, 0x6f, 0x72, 0x79, 0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x69, 0x73,
+            0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x65, 0x64, 0x20, 0x3f, 0x00, 0xf4, 0x3d, 0x63, 0x75, 0x72,
+            0x72, 0x65, 0x6e, 0x74, 0x20, 0x6e, 0x65, 0x69, 0x67, 0x68, 0x62, 0x6f, 0x75, 0x72, 0x68, 0x6f,
+            0x6f, 0x64, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x67, 0x68, 0x6f, 0x73, 0x74,
+            0x69, 0x6e, 0x67, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x62, 0x69, 0x6e, 0x64, 0x69,
+            0x6e, 0x67, 0x20, 0x3d, 0x20, 0x38, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20,
+            0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x4d, 0x00, 0x11, 0x5f, 0xa6, 0x00, 0x5f,
+            0x3b, 0x20, 0x20, 0x2f, 0x2f, 0xf0, 0x00, 0x00, 0xbe, 0x3a, 0x43, 0x4f, 0x4c, 0x4f, 0x52, 0x5f,
+            0x55, 0x4e, 0x49, 0x54, 0x57, 0x00, 0x1f, 0x39, 0x57, 0x00, 0x09, 0x5f, 0x64, 0x65, 0x70, 0x74,
+            0x68, 0x57, 0x00, 0x06, 0x5f, 0x44, 0x45, 0x50, 0x54, 0x48, 0x57, 0x00, 0x04, 0x2f, 0x31, 0x30,
+            0x58, 0x00, 0x01, 0x03, 0x1d, 0x01, 0x04, 0xaf, 0x00, 0x0f, 0xae, 0x00, 0x03, 0x79, 0x48, 0x49,
+            0x53, 0x54, 0x4f, 0x52, 0x59, 0x59, 0x00, 0x40, 0x6c, 0x6f, 0x63, 0x61, 0xbc, 0x01, 0x46, 0x20,
+            0x3d, 0x20, 0x31, 0x59, 0x00, 0x46, 0x6d, 0x61, 0x74, 0x34, 0x8f, 0x01, 0x52, 0x69, 0x6f, 0x6e,
+            0x3b, 0x20, 0x01, 0x00, 0x55, 0x2f, 0x2f, 0x20, 0x75, 0x6e, 0xd2, 0x01, 0x67, 0x4e, 0x44, 0x43,
+            0x20, 0x6f, 0x66, 0xef, 0x01, 0x00, 0x8b, 0x01, 0x44, 0x6c, 0x61, 0x73, 0x74, 0xfd, 0x01, 0x04,
+            0x16, 0x01, 0x07, 0x66, 0x00, 0x16, 0x32, 0x66, 0x00, 0x43, 0x76, 0x65, 0x63, 0x32, 0x1f, 0x02,
+            0x04, 0x60, 0x00, 0x05, 0x66, 0x00, 0x02, 0x5b, 0x00, 0x48, 0x66, 0x73, 0x65, 0x74, 0x5f, 0x00,
+            0x81, 0x77, 0x61, 0x73, 0x20, 0x72, 0x65, 0x6e, 0x64, 0x50, 0x02, 0x4f, 0x77, 0x69, 0x74, 0x68,
+            0x61, 0x00, 0x00, 0x16, 0x33, 0x61, 0x00, 0x55, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x1c, 0x01, 0x10,
+            0x77, 0x18, 0x02, 0x11, 0x74, 0x6a, 0x00, 0x90, 0x2f, 0x2f, 0x20, 0x30, 0x20, 0x64, 0x72, 0x6f,
+            0x70, 0xac, 0x02, 0x14, 0x65, 0x22, 0x00, 0xa0, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65,
+            0x63, 0x34, 0x7f, 0x02, 0x03, 0x4c, 0x01, 0xf0, 0x01, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20,
+            0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0xa2, 0x00, 0x01, 0xb9, 0x00, 0xf0, 0x07,
+            0x75, 0x76, 0x20, 0x3d, 0x20, 0x67, 0x6c, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6f, 0x6f, 0x72,
+            0x64, 0x2e, 0x78, 0x79, 0x20, 0x2f, 0x3f, 0x00, 0xe4, 0x32, 0x28, 0x74, 0x65, 0x78, 0x74, 0x75,
+            0x72, 0x65, 0x53, 0x69, 0x7a, 0x65, 0x28, 0x7f, 0x00, 0x01, 0x4a, 0x02, 0x61, 0x2c, 0x20, 0x30,
+            0x29, 0x29, 0x3b, 0x45, 0x00, 0x21, 0x2f, 0x2f, 0xf5, 0x02, 0x05, 0x4d, 0x01, 0x01, 0x30, 0x03,
+            0x52, 0x20, 0x73, 0x68, 0x6f, 0x77, 0x95, 0x00, 0xf0, 0x01, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20,
+            0x61, 0x74, 0x20, 0x75, 0x76, 0x20, 0x73, 0x68, 0x69, 0x66, 0x16, 0x03, 0x23, 0x62, 0x79, 0x30,
+            0x01, 0x70, 0x20, 0x2f, 0x20, 0x32, 0x20, 0x69, 0x6e, 0x1c, 0x00, 0x51, 0x75, 0x6e, 0x69, 0x74,
+            0x73, 0x52, 0x00, 0x01, 0x97, 0x00, 0x04, 0xb9, 0x02, 0x01, 0x9f, 0x00, 0x44, 0x75, 0x76, 0x20,
+            0x2b, 0x32, 0x00, 0x62, 0x2a, 0x20, 0x30, 0x2e, 0x35, 0x66, 0x7c, 0x00, 0x01, 0xe4, 0x00, 0x03,
+            0x2a, 0x00, 0x33, 0x20, 0x3d, 0x20, 0xaf, 0x00, 0x13, 0x28, 0x12, 0x00, 0x02, 0xfa, 0x00, 0x15,
+            0x2c, 0x04, 0x03, 0x51, 0x75, 0x76, 0x29, 0x3b, 0x0a, 0x62, 0x00, 0x11, 0x69, 0x63, 0x00, 0x46,
+            0x73, 0x69, 0x7a, 0x65, 0x36, 0x00, 0x01, 0xe5, 0x00, 0x0b, 0x3a, 0x00, 0x13, 0x30, 0xe4, 0x00,
+            0x02, 0x30, 0x00, 0x72, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0xb0, 0x03, 0x11, 0x28, 0x14,
+            0x00, 0x05, 0x6b, 0x00, 0x42, 0x75, 0x76, 0x20, 0x2a, 0x34, 0x01, 0x00, 0x56, 0x00, 0x42, 0x29,
+            0x29, 0x2c, 0x20, 0x20, 0x00, 0x40, 0x30, 0x29, 0x2c, 0x20, 0x12, 0x00, 0x43, 0x20, 0x2d, 0x20,
+            0x31, 0x4d, 0x00, 0x01, 0xb5, 0x00, 0x00, 0x45, 0x04, 0x14, 0x3d, 0x9a, 0x00, 0x60, 0x2c, 0x20,
+            0x68, 0x69, 0x67, 0x68, 0x5a, 0x00, 0x02, 0xfb, 0x03, 0x02, 0xdd, 0x00, 0x40, 0x66, 0x6f, 0x72,
+            0x28, 0x3b, 0x01, 0xd0, 0x79, 0x20, 0x3d, 0x20, 0x2d, 0x31, 0x3b, 0x20, 0x79, 0x20, 0x3c, 0x3d,
+            0x20, 0x08, 0x00, 0x31, 0x2b, 0x2b, 0x29, 0xc6, 0x00, 0x00, 0xc3, 0x01, 0x04, 0x25, 0x00, 0x13,
+            0x78, 0x25, 0x00, 0x13, 0x78, 0x25, 0x00, 0x18, 0x78, 0x25, 0x00, 0x02, 0xee, 0x01, 0x00, 0x2f,
+            0x00, 0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x05, 0x5d, 0x04, 0x02, 0x01, 0x01, 0x75, 0x65, 0x6c,
+            0x46, 0x65, 0x74, 0x63, 0x68, 0xcf, 0x00, 0x03, 0xe5, 0x01, 0x01, 0x9a, 0x04, 0x12, 0x28, 0xf8,
+            0x00, 0x13, 0x2b, 0xd2, 0x00, 0x4f, 0x78, 0x2c, 0x20, 0x79, 0xdf, 0x00, 0x03, 0x00, 0x15, 0x02,
+            0x02, 0xbb, 0x00, 0x00, 0x67, 0x00, 0x00, 0x04, 0x00, 0x02, 0xe6, 0x00, 0x86, 0x6d, 0x69, 0x6e,
+            0x28, 0x6c, 0x6f, 0x77, 0x2c, 0xd2, 0x04, 0x03, 0x0a, 0x01, 0x00, 0x23, 0x00, 0x00, 0x04, 0x00,
+            0x03, 0xfe, 0x00, 0x40, 0x6d, 0x61, 0x78, 0x28, 0x0b, 0x00, 0x0f, 0x29, 0x00, 0x03, 0x12, 0x7d,
+            0xbb, 0x01, 0x02, 0x0c, 0x03, 0x01, 0x78, 0x04, 0x0f, 0xbb, 0x00, 0x03, 0x01, 0x1b, 0x00, 0x21,
+            0x2c, 0x20, 0xb5, 0x00, 0x00, 0x92, 0x00, 0x22, 0x2e, 0x72, 0x94, 0x00, 0x01, 0xf7, 0x00, 0xa9,
+            0x70, 0x72, 0x65, 0x76, 0x69, 0x6f, 0x75, 0x73, 0x20, 0x3d, 0x17, 0x04, 0x02, 0xbc, 0x01, 0x21,
+            0x34, 0x28, 0xc6, 0x01, 0x30, 0x32, 0x2e, 0x66, 0xae, 0x01, 0x41, 0x2e, 0x66, 0x2c, 0x20, 0x4c,
+            0x00, 0x0a, 0x13, 0x00, 0x33, 0x31, 0x2e, 0x66, 0xbe, 0x00, 0x01, 0x44, 0x02, 0x04, 0x16, 0x03,
+            0x01, 0xa7, 0x02, 0x04, 0x5e, 0x00, 0x02, 0x42, 0x03, 0x05, 0x0e, 0x00, 0x13, 0x77, 0xb4, 0x02,
+            0x27, 0x20, 0x2b, 0xbb, 0x02, 0xf5, 0x0e, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x6f, 0x66, 0x66, 0x73,
+            0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x3d, 0x20, 0x61, 0x6e, 0x79, 0x28, 0x6c, 0x65, 0x73, 0x73,
+            0x54, 0x68, 0x61, 0x6e, 0x6d, 0x03, 0x32, 0x75, 0x76, 0x2c, 0x56, 0x02, 0x91, 0x30, 0x2e, 0x66,
+            0x29, 0x29, 0x29, 0x20, 0x7c, 0x7c, 0x28, 0x00, 0x7f, 0x67, 0x72, 0x65, 0x61, 0x74, 0x65, 0x72,
+            0x2b, 0x00, 0x03, 0x00, 0xa2, 0x00, 0x04, 0x9d, 0x03, 0x01, 0xf5, 0x00, 0x03, 0xa4, 0x00, 0x00,
+            0x60, 0x02, 0x00, 0x6a, 0x06, 0x04, 0xd6, 0x03, 0x05, 0x65, 0x00, 0x03, 0xed, 0x01, 0x03, 0x27,
+            0x00, 0x50, 0x5f, 0x75, 0x76, 0x29, 0x2c, 0xe5, 0x06, 0x02, 0x96, 0x02, 0x03, 0xed, 0x00, 0x23,
+            0x6f, 0x75, 0x4f, 0x03, 0x64, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x29, 0x02, 0x00, 0x24, 0x00,
+            0x03, 0xcf, 0x06, 0x06, 0xcc, 0x00, 0x74, 0x3f, 0x20, 0x30, 0x2e, 0x66, 0x20, 0x3a, 0x8f, 0x04,
+            0xc0, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_13[] = {
+            0xf0, 0x3a, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x0a,
+            0x2f, 0x2f, 0x20, 0x47, 0x65, 0x6f, 0x6d, 0x65, 0x74, 0x72, 0x79, 0x20, 0x70, 0x61, 0x73, 0x73,
+            0x20, 0x6f, 0x66, 0x20, 0x56, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74, 0x79, 0x42, 0x75,
+            0x66, 0x66, 0x65, 0x72, 0x2c, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x77, 0x68, 0x69,
+            0x63, 0x68, 0x20, 0x74, 0x72, 0x69, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x2b, 0x00, 0x02, 0x12, 0x00,
+            0xb0, 0x69, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x63, 0x6f, 0x5d, 0x00, 0xb0, 0x20,
+            0x74, 0x68, 0x65, 0x20, 0x70, 0x69, 0x78, 0x65, 0x6c, 0x2e, 0x60, 0x00, 0x21, 0x49, 0x44, 0x56,
+            0x00, 0xa1, 0x61, 0x20, 0x64, 0x72, 0x61, 0x77, 0x20, 0x61, 0x72, 0x65, 0x09, 0x00, 0x76, 0x5f,
+            0x62, 0x61, 0x73, 0x65, 0x20, 0x2b, 0x3c, 0x00, 0x15, 0x2a, 0x59, 0x00, 0x85, 0x5f, 0x63, 0x6f,
+            0x75, 0x6e, 0x74, 0x20, 0x2b, 0x11, 0x00, 0xf2, 0x06, 0x2c, 0x20, 0x30, 0x20, 0x69, 0x73, 0x20,
+            0x6c, 0x65, 0x66, 0x74, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x65, 0x6d, 0x70, 0x74, 0x79, 0x62, 0x00,
+            0xf4, 0x15, 0x73, 0x2e, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x65, 0x61, 0x72, 0x6c,
+            0x79, 0x5f, 0x66, 0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x5f, 0x74, 0x65, 0x73, 0x74, 0x73,
+            0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x22, 0x00, 0x50, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0xfa, 0x00,
+            0xf6, 0x02, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75,
+            0x69, 0x6e, 0x74, 0x92, 0x00, 0x1f, 0x3b, 0x2d, 0x00, 0x00, 0x1b, 0x32, 0x2d, 0x00, 0x04, 0x01,
+            0x01, 0x02, 0xa8, 0x00, 0xa2, 0x3b, 0x0a, 0x0a, 0x66, 0x6c, 0x61, 0x74, 0x20, 0x69, 0x6e, 0x4b,
+            0x00, 0x00, 0x82, 0x00, 0x14, 0x5f, 0xd6, 0x00, 0x62, 0x3b, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x19,
+            0x00, 0xf3, 0x0b, 0x6f, 0x75, 0x74, 0x5f, 0x69, 0x64, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64,
+            0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x1b, 0x00, 0x26,
+            0x20, 0x3d, 0x88, 0x00, 0x2a, 0x20, 0x2b, 0x49, 0x00, 0x0f, 0x1f, 0x01, 0x01, 0x00, 0xba, 0x00,
+            0xf0, 0x05, 0x28, 0x67, 0x6c, 0x5f, 0x50, 0x72, 0x69, 0x6d, 0x69, 0x74, 0x69, 0x76, 0x65, 0x49,
+            0x44, 0x29, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_14[] = {
+            0xf1, 0x15, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x0a,
+            0x2f, 0x2f, 0x20, 0x57, 0x72, 0x69, 0x74, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x69, 0x6e,
+            0x64, 0x65, 0x78, 0x20, 0x6f, 0x66, 0x0d, 0x00, 0xf0, 0x1a, 0x64, 0x72, 0x61, 0x77, 0x20, 0x63,
+            0x6f, 0x76, 0x65, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x65, 0x61, 0x63, 0x68, 0x20, 0x70, 0x69, 0x78,
+            0x65, 0x6c, 0x20, 0x61, 0x73, 0x20, 0x64, 0x65, 0x70, 0x74, 0x68, 0x2c, 0x20, 0x72, 0x65, 0x73,
+            0x6f, 0x6c, 0x76, 0x1f, 0x00, 0x12, 0x61, 0x2f, 0x00, 0xf0, 0x04, 0x74, 0x68, 0x65, 0x6e, 0x20,
+            0x74, 0x65, 0x73, 0x74, 0x73, 0x20, 0x47, 0x4c, 0x5f, 0x45, 0x51, 0x55, 0x41, 0x4c, 0x63, 0x00,
+            0xf4, 0x00, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x73, 0x74, 0x20, 0x69, 0x74, 0x73, 0x20, 0x6f, 0x77,
+            0x6e, 0x3f, 0x00, 0x71, 0x73, 0x6f, 0x20, 0x6f, 0x6e, 0x6c, 0x79, 0x17, 0x00, 0x01, 0x5b, 0x00,
+            0x51, 0x73, 0x20, 0x72, 0x75, 0x6e, 0x7d, 0x00, 0xf0, 0x04, 0x73, 0x68, 0x61, 0x64, 0x69, 0x6e,
+            0x67, 0x2e, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x62, 0x69, 0x6e, 0x10, 0x00, 0xf5,
+            0x1e, 0x20, 0x3d, 0x20, 0x38, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75,
+            0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69,
+            0x6c, 0x69, 0x74, 0x79, 0x5f, 0x69, 0x64, 0x73, 0x3b, 0x20, 0x2f, 0x2f, 0x20, 0x56, 0x13, 0x00,
+            0xf4, 0x00, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x3a, 0x3a, 0x49, 0x44, 0x5f, 0x55, 0x4e, 0x49,
+            0x54, 0x54, 0x00, 0x86, 0x73, 0x74, 0x64, 0x34, 0x33, 0x30, 0x2c, 0x20, 0x5c, 0x00, 0x81, 0x31,
+            0x35, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x96, 0x00, 0x11, 0x62, 0x36, 0x00, 0x26, 0x20, 0x5f,
+            0x5b, 0x00, 0xf1, 0x01, 0x44, 0x72, 0x61, 0x77, 0x73, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+            0x75, 0x69, 0x6e, 0x74, 0xf4, 0x00, 0x81, 0x5f, 0x62, 0x61, 0x73, 0x65, 0x73, 0x5b, 0x5d, 0x74,
+            0x00, 0x80, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x49, 0x44, 0x44, 0x01, 0x51, 0x65, 0x76, 0x65,
+            0x72, 0x79, 0x23, 0x00, 0x61, 0x2c, 0x20, 0x61, 0x73, 0x63, 0x65, 0xc1, 0x00, 0x34, 0x0a, 0x7d,
+            0x3b, 0x7f, 0x00, 0x50, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x89, 0x01, 0x37, 0x3d, 0x20, 0x31, 0xd4,
+            0x00, 0x05, 0x58, 0x00, 0xf8, 0x04, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x0a, 0x76, 0x6f,
+            0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x7c, 0x00, 0xf6, 0x01, 0x69, 0x64, 0x20,
+            0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0xa7, 0x00, 0x00,
+            0x02, 0x01, 0xf1, 0x10, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x67, 0x6c, 0x5f, 0x46,
+            0x72, 0x61, 0x67, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x29,
+            0x2e, 0x72, 0x3b, 0xc3, 0x00, 0x30, 0x69, 0x66, 0x28, 0x45, 0x00, 0x51, 0x3d, 0x20, 0x30, 0x75,
+            0x29, 0x11, 0x00, 0x00, 0xd8, 0x00, 0x72, 0x64, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64, 0x22, 0x00,
+            0x62, 0x2f, 0x2f, 0x20, 0x6c, 0x61, 0x73, 0xe8, 0x00, 0x61, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74,
+            0xec, 0x01, 0xe1, 0x74, 0x20, 0x6f, 0x72, 0x20, 0x62, 0x65, 0x66, 0x6f, 0x72, 0x65, 0x20, 0x69,
+            0x64, 0x3b, 0x00, 0x01, 0x0f, 0x01, 0x02, 0xfe, 0x00, 0x00, 0x50, 0x00, 0x21, 0x2c, 0x20, 0xbe,
+            0x00, 0x21, 0x20, 0x3d, 0x00, 0x01, 0x11, 0x5f, 0x0d, 0x00, 0x02, 0x53, 0x00, 0x61, 0x77, 0x68,
+            0x69, 0x6c, 0x65, 0x28, 0x11, 0x00, 0x43, 0x20, 0x3e, 0x20, 0x31, 0x7a, 0x00, 0x02, 0x54, 0x01,
+            0x00, 0x80, 0x00, 0x01, 0x49, 0x00, 0x42, 0x68, 0x61, 0x6c, 0x66, 0x35, 0x00, 0x23, 0x20, 0x3d,
+            0x4a, 0x00, 0x42, 0x2f, 0x20, 0x32, 0x75, 0x42, 0x00, 0x00, 0x26, 0x00, 0x30, 0x69, 0x66, 0x28,
+            0x70, 0x02, 0x03, 0x7c, 0x01, 0x02, 0x78, 0x00, 0x17, 0x2b, 0x37, 0x00, 0x76, 0x5d, 0x20, 0x3c,
+            0x3d, 0x20, 0x69, 0x64, 0xd7, 0x00, 0x06, 0x61, 0x00, 0x00, 0x3f, 0x00, 0x03, 0x31, 0x00, 0x17,
+            0x3d, 0x32, 0x00, 0x06, 0x5c, 0x00, 0x00, 0x21, 0x00, 0x02, 0xa0, 0x00, 0x1f, 0x2d, 0x21, 0x00,
+            0x03, 0x11, 0x7d, 0xf2, 0x00, 0x00, 0x27, 0x00, 0x45, 0x65, 0x6c, 0x73, 0x65, 0x0d, 0x00, 0x00,
+            0x11, 0x00, 0x02, 0x38, 0x00, 0x0e, 0x37, 0x00, 0x02, 0x33, 0x00, 0x03, 0x8d, 0x01, 0x10, 0x44,
+            0x3d, 0x03, 0x93, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x8c, 0x00, 0x00, 0x0b,
+            0x01, 0xa1, 0x20, 0x2f, 0x20, 0x36, 0x35, 0x35, 0x33, 0x36, 0x2e, 0x66, 0x4d, 0x02, 0x0e, 0xc1,
+            0x02, 0x00, 0x81, 0x02, 0x80, 0x44, 0x65, 0x70, 0x74, 0x68, 0x0a, 0x7d, 0x0a,
+        };
+        constexpr uint8_t shader_15[] = {
+            0xf1, 0x1f, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x36, 0x30, 0x0a, 0x0a,
+            0x2f, 0x2f, 0x20, 0x43, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65,
+            0x73, 0x6f, 0x6c, 0x76, 0x65, 0x64, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x61, 0x6e, 0x64,
+            0x17, 0x00, 0xf1, 0x16, 0x67, 0x65, 0x6f, 0x6d, 0x65, 0x74, 0x72, 0x79, 0x20, 0x64, 0x65, 0x70,
+            0x74, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x63, 0x6f, 0x76, 0x65, 0x72, 0x65, 0x64, 0x20, 0x70, 0x69,
+            0x78, 0x65, 0x6c, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x6f, 0x2a, 0x00, 0xf5, 0x40, 0x74, 0x61, 0x72,
+            0x67, 0x65, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6d, 0x65, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x0a,
+            0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x3d,
+            0x20, 0x38, 0x29, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d,
+            0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6c, 0x69, 0x74,
+            0x79, 0x5f, 0x69, 0x64, 0x73, 0x3b, 0x20, 0x20, 0x2f, 0x2f, 0x20, 0x56, 0x14, 0x00, 0x11, 0x42,
+            0x4c, 0x00, 0x9e, 0x3a, 0x3a, 0x49, 0x44, 0x5f, 0x55, 0x4e, 0x49, 0x54, 0x55, 0x00, 0x16, 0x39,
+            0x55, 0x00, 0x0f, 0x54, 0x00, 0x02, 0x01, 0xba, 0x00, 0x1f, 0x3b, 0x55, 0x00, 0x03, 0x5f, 0x44,
+            0x45, 0x50, 0x54, 0x48, 0x58, 0x00, 0x04, 0x2f, 0x31, 0x30, 0x59, 0x00, 0x01, 0x71, 0x73, 0x68,
+            0x61, 0x64, 0x65, 0x64, 0x5f, 0x26, 0x01, 0x3f, 0x3b, 0x20, 0x20, 0xad, 0x00, 0x04, 0x52, 0x43,
+            0x4f, 0x4c, 0x4f, 0x52, 0x58, 0x00, 0xd3, 0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x34,
+            0x20, 0x6f, 0x75, 0x74, 0x38, 0x00, 0xf0, 0x01, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d,
+            0x61, 0x69, 0x6e, 0x28, 0x29, 0x0a, 0x7b, 0x0a, 0x48, 0x00, 0x52, 0x69, 0x76, 0x65, 0x63, 0x32,
+            0x56, 0x01, 0x22, 0x20, 0x3d, 0x0e, 0x00, 0xf2, 0x03, 0x28, 0x67, 0x6c, 0x5f, 0x46, 0x72, 0x61,
+            0x67, 0x43, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x78, 0x79, 0x29, 0x3b, 0x2a, 0x00, 0xda, 0x66, 0x28,
+            0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x3e, 0x01, 0x12, 0x2c, 0x42,
+            0x00, 0xd1, 0x2c, 0x20, 0x30, 0x29, 0x2e, 0x72, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x35,
+            0x00, 0x00, 0x63, 0x00, 0x72, 0x64, 0x69, 0x73, 0x63, 0x61, 0x72, 0x64, 0x46, 0x00, 0x05, 0x8e,
+            0x00, 0x37, 0x20, 0x3d, 0x20, 0x4f, 0x00, 0x08, 0xe0, 0x00, 0x07, 0x4d, 0x00, 0x02, 0x34, 0x00,
+            0x03, 0x90, 0x00, 0x11, 0x44, 0x0c, 0x02, 0x09, 0x37, 0x00, 0x07, 0x86, 0x00, 0x01, 0x70, 0x01,
+            0x07, 0x3b, 0x00, 0x60, 0x2e, 0x72, 0x3b, 0x0a, 0x7d, 0x0a,
+        };
+    }
+    constexpr ShaderArchiveEntry builtin_shader_entries[] = {
+        { "brdf.frag.glsl", shader_0, 7619, 16112 },
+        { "brdf_array.frag.glsl", shader_1, 7627, 16139 },
+        { "brdf_bindless.frag.glsl", shader_2, 7626, 16134 },
+        { "brdf_resolve.frag.glsl", shader_3, 7628, 16139 },
+        { "brdf_resolve_array.frag.glsl", shader_4, 7633, 16166 },
+        { "brdf_resolve_bindless.frag.glsl", shader_5, 7632, 16161 },
+        { "fullscreen.vert.glsl", shader_6, 291, 320 },
+        { "general.vert.glsl", shader_7, 1512, 2852 },
+        { "general_depth.vert.glsl", shader_8, 1516, 2871 },
+        { "general_visibility.vert.glsl", shader_9, 1521, 2890 },
+        { "hiz_build.comp.glsl", shader_10, 1038, 1812 },
+        { "hiz_cull.comp.glsl", shader_11, 2352, 4023 },
+        { "temporal_upscale.frag.glsl", shader_12, 1181, 1944 },
+        { "visibility.frag.glsl", shader_13, 358, 482 },
+        { "visibility_classify.frag.glsl", shader_14, 701, 968 },
+        { "visibility_composite.frag.glsl", shader_15, 410, 636 },
+    };
+    extern const ShaderArchive builtin_shader_archive{builtin_shader_entries, 16};
+}
\ No newline at end of file
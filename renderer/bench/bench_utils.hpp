@@ -0,0 +1,252 @@
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench
+{
+    inline double NowMilliseconds()
+    {
+        using namespace std::chrono;
+        return duration<double, std::milli>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    struct SampleStats
+    {
+        size_t count = 0;
+        double min = 0.0, mean = 0.0, p50 = 0.0, p90 = 0.0, p99 = 0.0, max = 0.0;
+
+        // nearest rank percentiles
+        static SampleStats From(std::vector<double> samples)
+        {
+            SampleStats stats;
+            if(samples.empty())
+                return stats;
+            std::sort(samples.begin(), samples.end());
+            auto percentile = [&](double p)
+            {
+                size_t rank = (size_t)(p / 100.0 * samples.size() + 0.5);
+                return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+            };
+            stats.count = samples.size();
+            stats.min = samples.front();
+            stats.max = samples.back();
+            for(double sample : samples)
+                stats.mean += sample;
+            stats.mean /= samples.size();
+            stats.p50 = percentile(50.0);
+            stats.p90 = percentile(90.0);
+            stats.p99 = percentile(99.0);
+            return stats;
+        }
+    };
+
+    // Hardware counters of the calling thread through perf_event_open, read as one group.
+    // Unavailable without Linux, under perf_event_paranoid > 2 or in containers without the syscall,
+    // then available() is false and Stop() returns nothing.
+    // Values are scaled when the kernel multiplexed the group.
+    class PerfCounters
+    {
+    private:
+        struct Counter
+        {
+            const char* name;
+            uint32_t config;
+            int fd = -1;
+        };
+        std::vector<Counter> _counters;
+    public:
+        PerfCounters()
+        {
+#if defined(__linux__)
+            _counters = {
+                {"cycles", PERF_COUNT_HW_CPU_CYCLES},
+                {"instructions", PERF_COUNT_HW_INSTRUCTIONS},
+                {"cache_references", PERF_COUNT_HW_CACHE_REFERENCES},
+                {"cache_misses", PERF_COUNT_HW_CACHE_MISSES},
+                {"branch_misses", PERF_COUNT_HW_BRANCH_MISSES}
+            };
+            int leader = -1;
+            for(Counter& counter : _counters)
+            {
+                perf_event_attr attr;
+                std::memset(&attr, 0, sizeof(attr));
+                attr.size = sizeof(attr);
+                attr.type = PERF_TYPE_HARDWARE;
+                attr.config = counter.config;
+                attr.disabled = leader == -1;
+                attr.exclude_kernel = 1;
+                attr.exclude_hv = 1;
+                attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+                counter.fd = syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+                if(leader == -1)
+                {
+                    if(counter.fd == -1)
+                        break;
+                    leader = counter.fd;
+                }
+            }
+            // counters the CPU lacks are left out of the group
+            std::erase_if(_counters, [](const Counter& counter) { return counter.fd == -1; });
+#endif
+        }
+        ~PerfCounters()
+        {
+#if defined(__linux__)
+            for(Counter& counter : _counters)
+                close(counter.fd);
+#endif
+        }
+        PerfCounters(const PerfCounters&) = delete;
+        PerfCounters& operator=(const PerfCounters&) = delete;
+
+        inline bool available() const
+        {
+            return !_counters.empty();
+        }
+        void Start()
+        {
+#if defined(__linux__)
+            if(!available())
+                return;
+            ioctl(_counters[0].fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(_counters[0].fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+        }
+        std::vector<std::pair<std::string, double>> Stop()
+        {
+            std::vector<std::pair<std::string, double>> values;
+#if defined(__linux__)
+            if(!available())
+                return values;
+            ioctl(_counters[0].fd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+            // nr, time enabled, time running, then one value per counter
+            std::vector<uint64_t> data(3 + _counters.size());
+            if(read(_counters[0].fd, data.data(), data.size() * sizeof(uint64_t)) < (ssize_t)(3 * sizeof(uint64_t)))
+                return values;
+            double scale = data[2] ? (double)data[1] / data[2] : 0.0;
+            for(size_t i = 0; i < _counters.size() && i < data[0]; i++)
+                values.emplace_back(_counters[i].name, data[3 + i] * scale);
+#endif
+            return values;
+        }
+    };
+
+    // Streams JSON with commas and indentation handled, strings are escaped.
+    class JsonWriter
+    {
+    private:
+        FILE* _file;
+        std::vector<bool> _first; // per open scope, no element written yet
+        bool _afterKey = false;
+
+        void Separate()
+        {
+            if(_afterKey)
+            {
+                _afterKey = false;
+                return;
+            }
+            if(!_first.empty())
+            {
+                std::fputs(_first.back() ? "\n" : ",\n", _file);
+                _first.back() = false;
+                Indent(_first.size());
+            }
+        }
+        void Indent(size_t depth)
+        {
+            for(size_t i = 0; i < depth; i++)
+                std::fputs("    ", _file);
+        }
+        void String(const std::string& value)
+        {
+            std::fputc('"', _file);
+            for(char c : value)
+            {
+                if(c == '"' || c == '\\')
+                    std::fputc('\\', _file);
+                if((unsigned char)c < 0x20)
+                    std::fprintf(_file, "\\u%04x", c);
+                else
+                    std::fputc(c, _file);
+            }
+            std::fputc('"', _file);
+        }
+        void Close(char bracket)
+        {
+            bool empty = _first.back();
+            _first.pop_back();
+            if(!empty)
+            {
+                std::fputc('\n', _file);
+                Indent(_first.size());
+            }
+            std::fputc(bracket, _file);
+            if(_first.empty())
+                std::fputc('\n', _file);
+        }
+    public:
+        JsonWriter(FILE* file) : _file(file) {}
+
+        void BeginObject()
+        {
+            Separate();
+            std::fputc('{', _file);
+            _first.push_back(true);
+        }
+        void EndObject()
+        {
+            Close('}');
+        }
+        void BeginArray()
+        {
+            Separate();
+            std::fputc('[', _file);
+            _first.push_back(true);
+        }
+        void EndArray()
+        {
+            Close(']');
+        }
+        void Key(const std::string& key)
+        {
+            Separate();
+            String(key);
+            std::fputs(": ", _file);
+            _afterKey = true;
+        }
+        void Value(const std::string& value)
+        {
+            Separate();
+            String(value);
+        }
+        void Value(double value)
+        {
+            Separate();
+            std::fprintf(_file, "%.9g", value);
+        }
+        void Value(uint64_t value)
+        {
+            Separate();
+            std::fprintf(_file, "%llu", (unsigned long long)value);
+        }
+        template<typename T>
+        void Field(const std::string& key, const T& value)
+        {
+            Key(key);
+            Value(value);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,580 @@
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GL/glew.h>
+#include <glm/gtc/constants.hpp>
+
+#include "OpenGL_utils/headless_context.hpp"
+#include "renderer/renderer.hpp"
+
+#include "bench_utils.hpp"
+
+const char* usage = R"usage(Usage:
+    renderer_bench [flags]
+
+Renders a synthetic scene offscreen through a headless context and times its parts separately:
+buffer uploads, image decoding, transform updates, instance churn, BVH picking, software occlusion culling,
+draw submission and whole frames,
+forward shaded, through the visibility buffer and under dynamic resolution.
+Scenes only depend on the flags, the same seed always generates the same scene.
+
+Flags:
+    -meshes <count> -> Distinct meshes, UV spheres of varying tessellation. Default 16.
+    -instances <count> -> Instances per mesh, drawn with one instanced draw per mesh. Default 256.
+    -materials <count> -> Materials the instances pick from. Default 8.
+    -frames <count> -> Measured iterations of every section. Default 200.
+    -warmup <count> -> Frames rendered before measuring. Default 10.
+    -width <pixels>, -height <pixels> -> Render target size. Default 1280x720.
+    -upload <MiB> -> Size of one buffer upload. Default 64.
+    -image <file> -> Image decoded by the decode section. Default ./renderer/demo/assets/test.png.
+    -seed <value> -> Scene generation seed. Default 1.
+    -json <file> -> Also write the results as JSON.
+    -capture <path> -> Also time a capture section, frames are read back asynchronously and encoded
+                       on worker threads, into path if it ends in .y4m, else into path000000.png and on.
+
+Needs OpenGL 4.6. Mesa llvmpipe (22 and older) only exposes it with the overrides:
+    MESA_GL_VERSION_OVERRIDE=4.6 MESA_GLSL_VERSION_OVERRIDE=460 renderer_bench
+)usage";
+
+struct Options
+{
+    unsigned int meshes = 16;
+    unsigned int instances = 256;
+    unsigned int materials = 8;
+    unsigned int frames = 200;
+    unsigned int warmup = 10;
+    unsigned int width = 1280;
+    unsigned int height = 720;
+    unsigned int uploadMiB = 64;
+    unsigned int seed = 1;
+    std::string image = "./renderer/demo/assets/test.png";
+    std::string json;
+    std::string capture;
+};
+
+struct Section
+{
+    std::string name;
+    bench::SampleStats milliseconds;
+    std::vector<std::pair<std::string, double>> metrics;  // derived throughput numbers
+    std::vector<std::pair<std::string, double>> counters; // perf_event counters per iteration
+};
+
+// Times run() iterations times, perf counters cover all iterations and are reported per iteration
+Section Measure(const char* name, unsigned int iterations, bench::PerfCounters& perf, const std::function<void()>& run)
+{
+    std::vector<double> samples;
+    samples.reserve(iterations);
+    perf.Start();
+    for(unsigned int i = 0; i < iterations; i++)
+    {
+        double start = bench::NowMilliseconds();
+        run();
+        samples.push_back(bench::NowMilliseconds() - start);
+    }
+    Section section{name, bench::SampleStats::From(std::move(samples)), {}, perf.Stop()};
+    for(auto& [counter, value] : section.counters)
+        value /= iterations;
+    return section;
+}
+
+// UV sphere with rings * segments quads, positions double as normals
+render::Mesh SphereMesh(unsigned int rings, unsigned int segments)
+{
+    std::vector<glm::vec3> positions;
+    std::vector<GLuint> elements;
+    for(unsigned int ring = 0; ring <= rings; ring++)
+    {
+        float theta = glm::pi<float>() * ring / rings;
+        for(unsigned int segment = 0; segment <= segments; segment++)
+        {
+            float phi = 2.f * glm::pi<float>() * segment / segments;
+            positions.emplace_back(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi));
+        }
+    }
+    for(unsigned int ring = 0; ring < rings; ring++)
+        for(unsigned int segment = 0; segment < segments; segment++)
+        {
+            GLuint a = ring * (segments + 1) + segment, b = a + segments + 1;
+            elements.insert(elements.end(), {a, a + 1, b, b, a + 1, b + 1});
+        }
+    render::Mesh mesh(positions.size(), positions.data());
+    mesh.initNormals(positions.data());
+    mesh.initElements(elements.size(), elements.data());
+    return mesh;
+}
+
+void PrintSection(const Section& section)
+{
+    const bench::SampleStats& ms = section.milliseconds;
+    std::printf("%-18s p50 %9.4f ms  p90 %9.4f ms  p99 %9.4f ms  min %9.4f ms  max %9.4f ms\n",
+        section.name.c_str(), ms.p50, ms.p90, ms.p99, ms.min, ms.max);
+    for(const auto& [name, value] : section.metrics)
+        std::printf("%18s %s %.3f\n", "", name.c_str(), value);
+    for(const auto& [name, value] : section.counters)
+        std::printf("%18s %s %.0f\n", "", name.c_str(), value);
+}
+
+void WriteJson(const std::string& path, const Options& options, const std::vector<Section>& sections, const char* backend)
+{
+    FILE* file = std::fopen(path.c_str(), "w");
+    if(!file)
+    {
+        std::fprintf(stderr, "Error: Failed to open %s for writing!\n", path.c_str());
+        return;
+    }
+    bench::JsonWriter json(file);
+    json.BeginObject();
+    json.Field("timestamp", (uint64_t)std::time(nullptr));
+    json.Field("gl_renderer", std::string((const char*)glGetString(GL_RENDERER)));
+    json.Field("gl_version", std::string((const char*)glGetString(GL_VERSION)));
+    json.Field("context", std::string(backend));
+    json.Key("scene");
+    json.BeginObject();
+    json.Field("meshes", (uint64_t)options.meshes);
+    json.Field("instances", (uint64_t)options.instances);
+    json.Field("materials", (uint64_t)options.materials);
+    json.Field("width", (uint64_t)options.width);
+    json.Field("height", (uint64_t)options.height);
+    json.Field("seed", (uint64_t)options.seed);
+    json.Field("upload_mib", (uint64_t)options.uploadMiB);
+    json.Field("image", options.image);
+    json.EndObject();
+    json.Key("sections");
+    json.BeginObject();
+    for(const Section& section : sections)
+    {
+        json.Key(section.name);
+        json.BeginObject();
+        const bench::SampleStats& ms = section.milliseconds;
+        json.Field("samples", (uint64_t)ms.count);
+        json.Key("ms");
+        json.BeginObject();
+        json.Field("min", ms.min);
+        json.Field("mean", ms.mean);
+        json.Field("p50", ms.p50);
+        json.Field("p90", ms.p90);
+        json.Field("p99", ms.p99);
+        json.Field("max", ms.max);
+        json.EndObject();
+        for(const auto& [name, value] : section.metrics)
+            json.Field(name, value);
+        json.Key("perf");
+        json.BeginObject();
+        for(const auto& [name, value] : section.counters)
+            json.Field(name, value);
+        json.EndObject();
+        json.EndObject();
+    }
+    json.EndObject();
+    json.EndObject();
+    std::fclose(file);
+}
+
+int main(int argc, const char* argv[])
+{
+    Options options;
+    const std::unordered_map<std::string, unsigned int*> countFlags{
+        {"-meshes", &options.meshes}, {"-instances", &options.instances}, {"-materials", &options.materials},
+        {"-frames", &options.frames}, {"-warmup", &options.warmup}, {"-width", &options.width},
+        {"-height", &options.height}, {"-upload", &options.uploadMiB}, {"-seed", &options.seed}
+    };
+    const std::unordered_map<std::string, std::string*> stringFlags{
+        {"-image", &options.image}, {"-json", &options.json}, {"-capture", &options.capture}
+    };
+    for(int i = 1; i < argc; i++)
+    {
+        bool isCount = countFlags.contains(argv[i]), isString = stringFlags.contains(argv[i]);
+        if(!isCount && !isString)
+        {
+            std::fprintf(stderr, "Invalid argument provided: %s\n%s", argv[i], usage);
+            return EXIT_FAILURE;
+        }
+        if(i + 1 >= argc)
+        {
+            std::fprintf(stderr, "Value not provided for %s flag!\n%s", argv[i], usage);
+            return EXIT_FAILURE;
+        }
+        if(isCount)
+            *countFlags.at(argv[i]) = (unsigned int)std::strtoul(argv[i + 1], nullptr, 10);
+        else
+            *stringFlags.at(argv[i]) = argv[i + 1];
+        ++i;
+    }
+    if(!options.meshes || !options.instances || !options.materials || !options.frames || !options.width || !options.height)
+    {
+        std::fprintf(stderr, "Counts and sizes have to be positive!\n%s", usage);
+        return EXIT_FAILURE;
+    }
+
+    render::HeadlessContext context;
+    if(!context)
+        return EXIT_FAILURE;
+    std::printf("%s on %s, %s\n", glGetString(GL_VERSION), glGetString(GL_RENDERER), context.backend());
+
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LESS);
+    glEnable(GL_CULL_FACE);
+    glCullFace(GL_BACK);
+    glFrontFace(GL_CCW);
+    render::RenderTarget target(options.width, options.height);
+    target.Bind();
+
+    // scene, everything random comes from one seeded generator
+    std::mt19937 random(options.seed);
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+    render::Camera camera;
+    camera.perspective(60, options.width, options.height);
+    camera.projection();
+    camera.transform.matrix();
+    camera.transform.inverse();
+    camera.Use();
+
+    render::FragmentShaderBRDF::MaterialRegistry materials{options.materials, render::FragmentShaderBRDF::TEXTURE_UNITS};
+    std::vector<std::unique_ptr<render::FragmentShaderBRDF::Material>> sceneMaterials;
+    for(unsigned int i = 0; i < options.materials; i++)
+    {
+        sceneMaterials.push_back(std::make_unique<render::FragmentShaderBRDF::Material>(materials));
+        render::FragmentShaderBRDF::MaterialUniformData& data = sceneMaterials.back()->uniformData;
+        data.color_mod = glm::vec4(unit(random), unit(random), unit(random), 1.f);
+        data.roughness_mod = unit(random);
+        data.metallic_mod = unit(random);
+    }
+    materials.Use();
+
+    struct SceneMesh
+    {
+        render::Mesh mesh;
+        render::TypedSharedBuffer<render::InstanceData> instances;
+        std::vector<std::unique_ptr<render::Transform>> transforms;
+    };
+    std::vector<std::unique_ptr<SceneMesh>> meshes;
+    for(unsigned int m = 0; m < options.meshes; m++)
+    {
+        unsigned int rings = 4 + random() % 29;
+        auto sceneMesh = std::make_unique<SceneMesh>(SceneMesh{SphereMesh(rings, rings * 2), {options.instances}, {}});
+        for(unsigned int i = 0; i < options.instances; i++)
+        {
+            render::InstanceData* instance = sceneMesh->instances.data() + i;
+            instance->material = sceneMaterials[random() % options.materials]->index();
+            auto transform = std::make_unique<render::Transform>(sceneMesh->instances, &instance->model, &instance->inverse_model);
+            transform->position({unit(random) * 40.f - 20.f, unit(random) * 20.f - 10.f, -5.f - unit(random) * 60.f});
+            transform->scale(glm::vec3(0.2f + unit(random) * 0.8f));
+            transform->matrix();
+            transform->inverse();
+            sceneMesh->transforms.push_back(std::move(transform));
+        }
+        meshes.push_back(std::move(sceneMesh));
+    }
+
+    render::FragmentShaderBRDF::Lighting lighting;
+    lighting.uniformData.ambientLight = glm::vec3{0.1f, 0.1f, 0.1f};
+    lighting.uniformData.lightColor = glm::vec3{1.f, 1.f, 1.f};
+    lighting.uniformData.view_lightDirection = glm::normalize(glm::vec3{1.f, 1.f, 1.f});
+    lighting.Use();
+
+    render::ShaderVariantCache shaderVariants(materials.mode());
+    shaderVariants.Activate();
+
+    float time = 0.f;
+    auto updateTransforms = [&]
+    {
+        time += 1.f / 60.f;
+        glm::quat spin = glm::quat(glm::vec3(0.f, time, 0.f));
+        for(std::unique_ptr<SceneMesh>& sceneMesh : meshes)
+            for(std::unique_ptr<render::Transform>& transform : sceneMesh->transforms)
+            {
+                transform->orientation(spin);
+                transform->matrix();
+                transform->inverse();
+            }
+    };
+    auto submit = [&]
+    {
+        for(size_t m = 0; m < meshes.size(); m++)
+        {
+            sceneMaterials[m % sceneMaterials.size()]->Use();
+            meshes[m]->mesh.Draw(meshes[m]->instances);
+        }
+    };
+    render::GpuTimer frameTimer;
+    auto frame = [&]
+    {
+        updateTransforms();
+        frameTimer.Begin();
+        target.Clear();
+        submit();
+        frameTimer.End();
+        glFinish();
+        frameTimer.Poll();
+    };
+    for(unsigned int i = 0; i < options.warmup; i++)
+        frame();
+    frameTimer.Reset();
+
+    bench::PerfCounters perf;
+    if(!perf.available())
+        std::printf("perf_event counters unavailable, reporting times only\n");
+    std::vector<Section> sections;
+
+    // uploads into a persistently mapped buffer, as every per frame buffer in the renderer is
+    size_t uploadBytes = (size_t)options.uploadMiB << 20;
+    std::vector<glm::vec4> uploadData(uploadBytes / sizeof(glm::vec4));
+    for(glm::vec4& value : uploadData)
+        value = glm::vec4(unit(random));
+    {
+        render::TypedSharedBuffer<glm::vec4> uploadBuffer(uploadData.size());
+        Section upload = Measure("buffer_upload", options.frames, perf, [&]
+        {
+            std::memcpy(uploadBuffer.data(), uploadData.data(), uploadBytes);
+            glFinish();
+        });
+        upload.metrics.emplace_back("gib_per_s_p50", uploadBytes / (upload.milliseconds.p50 * 1e-3) / (1 << 30));
+        sections.push_back(std::move(upload));
+    }
+    Section create = Measure("buffer_create", std::max(options.frames / 10, 1u), perf, [&]
+    {
+        render::TypedSharedBuffer<glm::vec4> buffer(uploadData.size(), uploadData.data());
+        glFinish();
+    });
+    create.metrics.emplace_back("gib_per_s_p50", uploadBytes / (create.milliseconds.p50 * 1e-3) / (1 << 30));
+    sections.push_back(std::move(create));
+
+    render::Image probe = render::Image::FromFile(render::TexCompType::UNSIGNED_BYTE, options.image.c_str());
+    if(probe)
+    {
+        double megapixels = probe->width * probe->height * 1e-6;
+        Section decode = Measure("image_decode", std::max(options.frames / 10, 1u), perf, [&]
+        {
+            render::Image image = render::Image::FromFile(render::TexCompType::UNSIGNED_BYTE, options.image.c_str());
+            if(!image)
+                std::fprintf(stderr, "Error: Failed to decode %s!\n", options.image.c_str());
+        });
+        decode.metrics.emplace_back("megapixels_per_s_p50", megapixels / (decode.milliseconds.p50 * 1e-3));
+        sections.push_back(std::move(decode));
+    }
+    else
+        std::fprintf(stderr, "Error: Failed to decode %s, skipping the decode section!\n", options.image.c_str());
+
+    double instanceCount = (double)options.meshes * options.instances;
+    Section transforms = Measure("transform_update", options.frames, perf, updateTransforms);
+    transforms.metrics.emplace_back("ns_per_transform_p50", transforms.milliseconds.p50 * 1e6 / instanceCount);
+    sections.push_back(std::move(transforms));
+
+    // spawns and despawns an eighth of the instances per iteration, as an InstanceBuffer sees it
+    {
+        render::InstanceBuffer churnInstances(1, "Bench churn instances");
+        std::vector<render::InstanceBuffer::Handle> handles;
+        render::InstanceData identity{};
+        identity.model = identity.inverse_model = glm::mat4(1.f);
+        for(unsigned int i = 0; i < std::max(options.meshes * options.instances, 1u); i++)
+            handles.push_back(churnInstances.Add(identity));
+        churnInstances.Upload();
+        size_t changes = std::max<size_t>(handles.size() / 8, 1);
+        Section churn = Measure("instance_churn", options.frames, perf, [&]
+        {
+            for(size_t c = 0; c < changes; c++)
+            {
+                size_t i = random() % handles.size();
+                render::InstanceData data = churnInstances.Get(handles[i]);
+                churnInstances.Remove(handles[i]);
+                handles[i] = churnInstances.Add(data);
+            }
+            churnInstances.Upload();
+        });
+        churn.metrics.emplace_back("ns_per_change_p50", churn.milliseconds.p50 * 1e6 / changes);
+        churn.metrics.emplace_back("capacity", (double)churnInstances.capacity());
+        sections.push_back(std::move(churn));
+    }
+
+    // picking through the instance BVH, rays through random pixels cast in packets of four
+    {
+        render::SceneBvh bvh;
+        for(std::unique_ptr<SceneMesh>& sceneMesh : meshes)
+            for(std::unique_ptr<render::Transform>& transform : sceneMesh->transforms)
+                bvh.Add(render::Aabb{sceneMesh->mesh.boundsMin, sceneMesh->mesh.boundsMax}, transform->matrix());
+        double start = bench::NowMilliseconds();
+        bvh.Rebuild();
+        double buildMilliseconds = bench::NowMilliseconds() - start;
+        glm::mat4 viewProjection = camera.projection() * camera.view();
+        std::vector<render::Ray> rays(256);
+        std::vector<render::SceneBvh::Hit> hits(rays.size());
+        size_t hitCount = 0;
+        Section pick = Measure("bvh_pick", options.frames, perf, [&]
+        {
+            for(render::Ray& ray : rays)
+                ray = render::Ray::Through(viewProjection, glm::vec2(unit(random), unit(random)) * 2.f - 1.f);
+            bvh.Raycast(rays.data(), hits.data(), rays.size());
+            for(const render::SceneBvh::Hit& hit : hits)
+                hitCount += hit.instance != render::SceneBvh::NONE;
+        });
+        pick.metrics.emplace_back("us_per_ray_p50", pick.milliseconds.p50 * 1e3 / rays.size());
+        pick.metrics.emplace_back("build_ms", buildMilliseconds);
+        pick.metrics.emplace_back("hit_ratio", (double)hitCount / (rays.size() * options.frames));
+        sections.push_back(std::move(pick));
+    }
+
+    // CPU occlusion culling of all instances, behind cube proxies inscribed in the nearest instance of every mesh
+    {
+        const float half = 1.f / std::sqrt(3.f);
+        std::vector<glm::vec3> cube;
+        for(unsigned int c = 0; c < 8; c++)
+            cube.emplace_back(c & 1 ? half : -half, c & 2 ? half : -half, c & 4 ? half : -half);
+        const std::vector<GLuint> cubeElements{0, 2, 1, 1, 2, 3, 4, 5, 6, 5, 7, 6, 0, 1, 4, 1, 5, 4,
+                                               2, 6, 3, 3, 6, 7, 0, 4, 2, 2, 4, 6, 1, 3, 5, 3, 7, 5};
+        render::SoftwareOcclusionCuller culler;
+        std::vector<std::vector<render::InstanceData>> sceneInstances;
+        for(std::unique_ptr<SceneMesh>& sceneMesh : meshes)
+        {
+            std::vector<render::InstanceData>& instances = sceneInstances.emplace_back(options.instances);
+            unsigned int nearest = 0;
+            for(unsigned int i = 0; i < options.instances; i++)
+            {
+                instances[i].model = sceneMesh->transforms[i]->matrix();
+                if(instances[i].model[3].z > instances[nearest].model[3].z)
+                    nearest = i;
+            }
+            culler.AddOccluder(cube.data(), cube.size(), cubeElements.data(), cubeElements.size(), instances[nearest].model);
+        }
+        std::vector<render::InstanceData> visible(options.instances);
+        size_t visibleCount = 0;
+        Section occlusion = Measure("software_occlusion", options.frames, perf, [&]
+        {
+            culler.Rasterize(camera);
+            for(size_t m = 0; m < meshes.size(); m++)
+                visibleCount += culler.Cull(meshes[m]->mesh, sceneInstances[m].data(), options.instances, visible.data());
+        });
+        occlusion.metrics.emplace_back("ns_per_instance_p50", occlusion.milliseconds.p50 * 1e6 / instanceCount);
+        occlusion.metrics.emplace_back("visible_ratio", visibleCount / (instanceCount * options.frames));
+        occlusion.metrics.emplace_back("occluder_triangles", (double)culler.triangleCount());
+        occlusion.metrics.emplace_back("avx2", culler.avx2());
+        sections.push_back(std::move(occlusion));
+    }
+
+    // CPU cost of issuing the draws, the GPU work is finished outside the measured part
+    std::vector<double> submitSamples;
+    perf.Start();
+    for(unsigned int i = 0; i < options.frames; i++)
+    {
+        target.Clear();
+        double start = bench::NowMilliseconds();
+        submit();
+        submitSamples.push_back(bench::NowMilliseconds() - start);
+        glFinish();
+    }
+    Section submission{"draw_submission", bench::SampleStats::From(std::move(submitSamples)), {}, perf.Stop()};
+    for(auto& [counter, value] : submission.counters)
+        value /= options.frames;
+    submission.metrics.emplace_back("draws", (double)meshes.size());
+    sections.push_back(std::move(submission));
+
+    Section frames = Measure("frame", options.frames, perf, frame);
+    frames.metrics.emplace_back("gpu_ms_mean", frameTimer.averageMilliseconds());
+    frames.metrics.emplace_back("fps_p50", 1000.0 / frames.milliseconds.p50);
+    frames.metrics.emplace_back("instances", instanceCount);
+    sections.push_back(std::move(frames));
+
+    // the same frames shaded through the visibility buffer, compare gpu_ms_mean with the frame section
+    {
+        render::VisibilityBuffer visibility(materials.mode());
+        render::ForwardPass pass;
+        pass.visibilityBuffer = &visibility;
+        camera.shading = render::Camera::Shading::VISIBILITY_BUFFER;
+        render::GpuTimer visibilityTimer{true}; // nestable, VisibilityBuffer::Run runs its own stage timers inside
+        auto visibilityFrame = [&]
+        {
+            updateTransforms();
+            visibilityTimer.Begin();
+            target.Clear();
+            pass.Run(camera, submit);
+            visibilityTimer.End();
+            glFinish();
+            visibilityTimer.Poll();
+            visibility.geometryTimer.Poll();
+            visibility.shadingTimer.Poll();
+        };
+        for(unsigned int i = 0; i < options.warmup; i++)
+            visibilityFrame();
+        visibilityTimer.Reset();
+        visibility.geometryTimer.Reset();
+        visibility.shadingTimer.Reset();
+        Section shaded = Measure("frame_visibility", options.frames, perf, visibilityFrame);
+        shaded.metrics.emplace_back("gpu_ms_mean", visibilityTimer.averageMilliseconds());
+        shaded.metrics.emplace_back("geometry_gpu_ms_mean", visibility.geometryTimer.averageMilliseconds());
+        shaded.metrics.emplace_back("shading_gpu_ms_mean", visibility.shadingTimer.averageMilliseconds());
+        sections.push_back(std::move(shaded));
+        camera.shading = render::Camera::Shading::FORWARD;
+    }
+
+    // the same frames under dynamic resolution aiming at half the forward frame's GPU time,
+    // scale_mean shows where the controller settles on this GPU
+    {
+        render::DynamicResolution resolution;
+        resolution.targetMilliseconds = (float)frameTimer.averageMilliseconds() * 0.5f;
+        resolution.cooldownFrames = 2;
+        double scaleTotal = 0.0;
+        auto scaledFrame = [&]
+        {
+            updateTransforms();
+            resolution.Begin(camera);
+            submit();
+            resolution.End(camera, target.framebuffer());
+            glFinish();
+            scaleTotal += resolution.scale();
+        };
+        for(unsigned int i = 0; i < options.warmup; i++)
+            scaledFrame();
+        resolution.frameTimer.Reset();
+        scaleTotal = 0.0;
+        Section scaled = Measure("frame_dynamic_resolution", options.frames, perf, scaledFrame);
+        scaled.metrics.emplace_back("gpu_ms_mean", resolution.frameTimer.averageMilliseconds());
+        scaled.metrics.emplace_back("target_ms", resolution.targetMilliseconds);
+        scaled.metrics.emplace_back("scale_mean", scaleTotal / options.frames);
+        sections.push_back(std::move(scaled));
+    }
+
+    // offline rendering throughput, without glFinish the readback ring decides how far the GPU may lag
+    if(!options.capture.empty())
+    {
+        bool y4m = options.capture.ends_with(".y4m");
+        render::FrameCapture capture(options.capture, y4m ? render::FrameCapture::Y4M : render::FrameCapture::PNG);
+        render::AsyncReadback readback;
+        uint64_t captureFrame = 0, skipped = 0;
+        auto deliver = [&](const render::AsyncReadback::Result& result)
+        {
+            capture.Submit(result);
+        };
+        Section captured = Measure("capture", options.frames, perf, [&]
+        {
+            updateTransforms();
+            target.Clear();
+            submit();
+            if(!readback.Read(target.framebuffer(), GL_COLOR_ATTACHMENT0, 0, 0, options.width, options.height,
+                              render::TexFormat::RGBA, render::TexCompType::UNSIGNED_BYTE, captureFrame++))
+                ++skipped;
+            readback.Poll(deliver);
+        });
+        double start = bench::NowMilliseconds();
+        readback.Poll(deliver, true);
+        capture.Flush();
+        captured.metrics.emplace_back("drain_ms", bench::NowMilliseconds() - start);
+        captured.metrics.emplace_back("encoded", (double)capture.encoded());
+        captured.metrics.emplace_back("skipped", (double)(skipped + capture.dropped()));
+        sections.push_back(std::move(captured));
+    }
+
+    for(const Section& section : sections)
+        PrintSection(section);
+    if(!options.json.empty())
+        WriteJson(options.json, options, sections, context.backend());
+    return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -1,4 +1,7 @@
+#include <cmath>
 #include <cstdio>
+#include <filesystem>
+#include <string>
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
@@ -29,7 +32,7 @@ static void GLAPIENTRY gl_error_callback(
 			(type == GL_DEBUG_TYPE_ERROR ? "** GL ERROR **" : ""),
 			type, severity, message);
 }
-int main()
+int main(int argc, char** argv)
 {
     glfwSetErrorCallback(glfw_error_callback);
     if(!glfwInit())
@@ -82,6 +85,7 @@ int main()
 
     // mesh setup
     render::TypedSharedBuffer<render::InstanceData> cubeInstanceBuffer{1};
+    cubeInstanceBuffer.Label(render::GpuMemoryCategory::INSTANCE, "Cube instances");
     render::Transform cubeTransform{cubeInstanceBuffer, &cubeInstanceBuffer.data()->model, &cubeInstanceBuffer.data()->inverse_model};
     render::Mesh cubeMesh(cubeData::vertCount, cubeData::verts);
     cubeMesh.initElements(cubeData::elemCount, cubeData::indices);
@@ -92,54 +96,190 @@ int main()
     cubeTransform.inverse();
     cubeTransform.matrix();
 
+    // flattened cube as ground, receives the cube's shadow
+    render::TypedSharedBuffer<render::InstanceData> groundInstanceBuffer{1};
+    groundInstanceBuffer.Label(render::GpuMemoryCategory::INSTANCE, "Ground instances");
+    render::Transform groundTransform{groundInstanceBuffer, &groundInstanceBuffer.data()->model, &groundInstanceBuffer.data()->inverse_model};
+    groundTransform.position({0, -1.f, -2.5f});
+    groundTransform.scale({10.f, 0.1f, 10.f});
+    groundTransform.inverse();
+    groundTransform.matrix();
+
     // lighting setup
     render::FragmentShaderBRDF::Lighting lighting;
     lighting.uniformData.ambientLight = glm::vec3{0.1f, 0.1f, 0.1f};
     lighting.uniformData.lightColor = glm::vec3{1.f, 1.f, 1.f};
     lighting.uniformData.view_lightDirection = glm::normalize(glm::vec3{1.f, 1.f, 1.f});
 
+    // a ring of colored point lights around the cube, assigned to view clusters every frame
+    render::ClusteredLighting clusteredLights;
+    constexpr int RING_LIGHTS = 256;
+    for(int i = 0; i < RING_LIGHTS; i++)
+    {
+        float angle = glm::radians(360.f * i / RING_LIGHTS);
+        render::ClusteredLighting::Light light;
+        light.position = glm::vec3{std::cos(angle) * 1.5f, 0.f, -2.5f + std::sin(angle) * 1.5f};
+        light.range = 0.75f;
+        light.color = glm::vec3{0.5f + 0.5f * std::cos(angle), 0.5f + 0.5f * std::sin(angle), 0.5f};
+        clusteredLights.lights.push_back(light);
+    }
+
     // texture setup
-    render::Image bricksAlbedoImg = render::Image::FromFile(render::TexCompType::UNSIGNED_BYTE, "./renderer/demo/assets/bricks/Bricks101_1K-PNG_Color.png", 3);
-    render::Texture2D bricksAlbedo(bricksAlbedoImg, 1, GL_RGB8);
+    // the archive is cooked next to the executable unless another one is passed
+    std::filesystem::path executableDir = std::filesystem::path(argv[0]).parent_path();
+    std::string assetPath = argc > 1 ? argv[1] : (executableDir / "demo_assets.pak").string();
+    render::AssetArchive demoAssets(assetPath.c_str());
+    render::Texture2D bricksAlbedo = demoAssets.LoadTexture2D("bricks_albedo", 1, GL_RGB8);
     
     render::Image bricksNormalImg = render::Image::FromFile(render::TexCompType::UNSIGNED_BYTE, "./renderer/demo/assets/bricks/Bricks101_1K-PNG_NormalGL.png", 3);
     render::Texture2D bricksNormal(bricksNormalImg, 1, GL_RGB8);
 
-    render::Image bricksRoughnessImg = render::Image::FromFile(render::TexCompType::UNSIGNED_BYTE, "./renderer/demo/assets/bricks/Bricks101_1K-PNG_Roughness.png", 1);
-    render::Texture2D bricksRoughness(bricksRoughnessImg, 1, GL_R8);
+    render::Texture2D bricksORM = demoAssets.LoadTexture2D("bricks_orm", 1, GL_RGB8);
+    bricksAlbedo.Label(render::GpuMemoryCategory::TEXTURE, "Bricks albedo");
+    bricksNormal.Label(render::GpuMemoryCategory::TEXTURE, "Bricks normal");
+    bricksORM.Label(render::GpuMemoryCategory::TEXTURE, "Bricks ORM");
 
-    render::Image bricksAOImg = render::Image::FromFile(render::TexCompType::UNSIGNED_BYTE, "./renderer/demo/assets/bricks/Bricks101_1K-PNG_AmbientOcclusion.png", 1);
-    render::Texture2D bricksAO(bricksAOImg, 1, GL_R8);
+    // over the texture budget the least recently used textures lose mip levels, they are reloaded once drawn again
+    render::GpuMemory::SetBudget(render::GpuMemoryCategory::TEXTURE, 256ull << 20);
+    render::TextureResidency textureResidency;
+    textureResidency.Add(bricksAlbedo, [&] { return demoAssets.LoadTexture2D("bricks_albedo", 1, GL_RGB8); });
+    textureResidency.Add(bricksNormal, bricksNormalImg);
+    textureResidency.Add(bricksORM, [&] { return demoAssets.LoadTexture2D("bricks_orm", 1, GL_RGB8); });
 
-    // material setup
-    render::FragmentShaderBRDF::Material material;
+    // material setup, all materials share one SSBO and instances select theirs by index,
+    // bindless handles are used when supported, otherwise textures are packed into texture arrays
+    render::FragmentShaderBRDF::MaterialRegistry materials{16};
+    render::FragmentShaderBRDF::Material material(materials);
     material.uniformData.metallic_mod = 0.1f;
-    material.textures[render::FragmentShaderBRDF::ALBEDO_MAP_UNIT] = bricksAlbedo;
-    material.textures[render::FragmentShaderBRDF::NORMAL_MAP_UNIT] = bricksNormal;
-    material.textures[render::FragmentShaderBRDF::ROUGHNESS_MAP_UNIT] = bricksRoughness;
-    material.textures[render::FragmentShaderBRDF::AMBIENT_OCCLUSION_MAP_UNIT] = bricksAO;
+    material.SetTexture(render::FragmentShaderBRDF::ALBEDO_MAP_UNIT, bricksAlbedo);
+    material.SetTexture(render::FragmentShaderBRDF::NORMAL_MAP_UNIT, bricksNormal);
+    material.SetTexture(render::FragmentShaderBRDF::ORM_MAP_UNIT, bricksORM);
 
-    // shader creation
-    render::ShaderProgramBRDF shaderBRDF;
+    render::TextureArrayPacker textureArrays;
+    if(materials.mode() == render::FragmentShaderBRDF::TEXTURE_ARRAYS)
+    {
+        textureArrays.Add(bricksAlbedo);
+        textureArrays.Add(bricksNormal);
+        textureArrays.Add(bricksORM);
+        textureArrays.Build();
+        material.UseTextureArrays(textureArrays);
+    }
+    cubeInstanceBuffer[0].material = material.index();
+    groundInstanceBuffer[0].material = material.index();
+    materials.Use();
+
+    // shader variants, compiled on first draw with each mesh attribute and material texture set
+    // in the background and stored as program binaries next to the executable so later runs skip driver compilation
+    render::ProgramBinaryCache programBinaries((executableDir / "shader_cache").string().c_str());
+    render::AsyncProgramCompiler shaderCompiler;
+    render::ShaderVariantCache shaderVariants(materials.mode(), &programBinaries, &shaderCompiler);
+
+    // shadows, the ground never moves so its depth is cached, the rotating cube is redrawn every frame
+    render::CascadedShadowMaps shadowMaps;
+    shadowMaps.AddCaster(cubeMesh, groundInstanceBuffer, true);
+    shadowMaps.AddCaster(cubeMesh, cubeInstanceBuffer, false);
 
     // setting lighting to use 
     lighting.Use();
+    clusteredLights.Use();
+
+    // letting Material::Use and Mesh::Draw pick shader variants
+    shaderVariants.Activate();
+
+    // P toggles the depth pre-pass, V the visibility buffer, pass GPU times are printed every few seconds
+    render::ForwardPass forwardPass;
+    render::VisibilityBuffer visibilityBuffer(materials.mode());
+    forwardPass.visibilityBuffer = &visibilityBuffer;
+
+    // Hi-Z occlusion culling, instances visible last frame are drawn first,
+    // the rest is tested against their depth and drawn if disoccluded
+    render::HiZCuller occlusionCuller;
+    occlusionCuller.Add(cubeMesh, cubeInstanceBuffer);
+    occlusionCuller.Add(cubeMesh, groundInstanceBuffer);
+    // frames are rendered at the resolution keeping them near 60 fps and upscaled, U switches to temporal upscaling
+    render::DynamicResolution dynamicResolution;
+    render::GpuTimer shadowTimer;
+    bool prepassKeyDown = false, visibilityKeyDown = false, upscaleKeyDown = false;
+    unsigned int frame = 0;
 
-    // setting shader to use
-    shaderBRDF.Use();
+    // zones of the whole run are written to a Chrome trace on exit, open it in ui.perfetto.dev
+    render::Profiler::Enable(true);
 
     while(!glfwWindowShouldClose(window))
     {
         glfwPollEvents();
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        textureResidency.Update();
+        shaderCompiler.Poll();
+        shadowTimer.Begin();
+        shadowMaps.Render(camera, lighting);
+        shadowTimer.End();
 
-        material.Use();
-        cubeMesh.Draw(cubeInstanceBuffer);
+        bool keyDown = glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS;
+        if(keyDown && !prepassKeyDown)
+            forwardPass.depthPrepass = !forwardPass.depthPrepass;
+        prepassKeyDown = keyDown;
+        keyDown = glfwGetKey(window, GLFW_KEY_V) == GLFW_PRESS;
+        if(keyDown && !visibilityKeyDown)
+            camera.shading = camera.shading == render::Camera::Shading::FORWARD ?
+                render::Camera::Shading::VISIBILITY_BUFFER : render::Camera::Shading::FORWARD;
+        visibilityKeyDown = keyDown;
+        keyDown = glfwGetKey(window, GLFW_KEY_U) == GLFW_PRESS;
+        if(keyDown && !upscaleKeyDown)
+            dynamicResolution.upscale = dynamicResolution.upscale == render::DynamicResolution::BILINEAR ?
+                render::DynamicResolution::TEMPORAL : render::DynamicResolution::BILINEAR;
+        upscaleKeyDown = keyDown;
+        // the scaled render has its own camera, the clusters have to match its resolution and projection
+        render::Camera& renderCamera = dynamicResolution.Begin(camera);
+        clusteredLights.Update(renderCamera, lighting);
+        occlusionCuller.CullEarly(renderCamera);
+        forwardPass.Run(renderCamera, [&]
+        {
+            material.Use();
+            occlusionCuller.DrawEarly();
+        });
+        occlusionCuller.BuildPyramid(renderCamera.resolution.x, renderCamera.resolution.y);
+        occlusionCuller.CullLate();
+        forwardPass.Run(renderCamera, [&]
+        {
+            material.Use();
+            occlusionCuller.DrawLate();
+        });
+        dynamicResolution.End(camera);
+        if(++frame % 300 == 0 && camera.shading == render::Camera::Shading::VISIBILITY_BUFFER)
+        {
+            std::printf("shadows %.3f ms, visibility buffer geometry %.3f ms, shading %.3f ms\n",
+                shadowTimer.averageMilliseconds(), visibilityBuffer.geometryTimer.averageMilliseconds(),
+                visibilityBuffer.shadingTimer.averageMilliseconds());
+            shadowTimer.Reset();
+            visibilityBuffer.geometryTimer.Reset();
+            visibilityBuffer.shadingTimer.Reset();
+            render::Profiler::PrintSummary();
+        }
+        else if(frame % 300 == 0)
+        {
+            std::printf("shadows %.3f ms, depth pre-pass %s %.3f ms, shading %.3f ms\n",
+                shadowTimer.averageMilliseconds(), forwardPass.depthPrepass ? "on" : "off",
+                forwardPass.depthPrepass ? forwardPass.prepassTimer.averageMilliseconds() : 0.0,
+                forwardPass.shadingTimer.averageMilliseconds());
+            shadowTimer.Reset();
+            forwardPass.prepassTimer.Reset();
+            forwardPass.shadingTimer.Reset();
+            render::Profiler::PrintSummary();
+        }
+        if(frame % 300 == 0)
+            std::printf("frame %.3f ms at %.0f%% resolution, %s upscale\n", dynamicResolution.frameTimer.milliseconds(),
+                dynamicResolution.scale() * 100.f, dynamicResolution.upscale == render::DynamicResolution::TEMPORAL ? "temporal" : "bilinear");
         cubeTransform.orientation(glm::quat({0.f, glm::radians(0.2f), 0.f}) * cubeTransform.orientation());
         cubeTransform.inverse();
         cubeTransform.matrix();
 
         glfwSwapBuffers(window);
+        PROFILE_FRAME();
+        render::GpuMemory::EndFrame();
     }
+    render::GpuMemory::PrintReport();
+    render::Profiler::ExportChromeTrace("./out/renderer/demo/profile.json");
+    programBinaries.PrintStats();
     return 0;
 }
\ No newline at end of file
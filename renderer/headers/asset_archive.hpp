@@ -0,0 +1,254 @@
+#pragma once
+#include <cstdio>
+#include <cstring>
+#include <optional>
+#include <string_view>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include "OpenGL_utils/buffer.hpp"
+#include "OpenGL_utils/texture.hpp"
+#include "asset_archive_format.hpp"
+#include "lz4.hpp"
+#include "mesh.hpp"
+
+namespace render
+{
+    static_assert((GLenum)AssetCompType::UNSIGNED_BYTE == (GLenum)TexCompType::UNSIGNED_BYTE);
+    static_assert((GLenum)AssetCompType::UNSIGNED_SHORT == (GLenum)TexCompType::UNSIGNED_SHORT);
+    static_assert((GLenum)AssetCompType::HALF_FLOAT == (GLenum)TexCompType::HALF_FLOAT);
+    static_assert((GLenum)AssetCompType::FLOAT == (GLenum)TexCompType::FLOAT);
+
+    // Read-only view of an archive cooked by asset_cook.
+    // The whole file is mmapped once, stored streams are copied straight from the mapping
+    // into persistently mapped GL buffers, RGB textures into an Image padded to RGBA. LZ4 matches read back what was already decompressed,
+    // which must not come from the write-only mapping, so compressed streams go through a scratch buffer.
+    class AssetArchive
+    {
+    private:
+        const uint8_t* _data = nullptr;
+        size_t _size = 0;
+        const AssetArchiveHeader* _header = nullptr;
+        const AssetArchiveEntry* _entries = nullptr;
+        mutable std::vector<uint8_t> _scratch; // decompressed stream, reused between reads
+
+        // dst may be a write-only mapping, it is only written with one memcpy.
+        // Returns a readable copy of the stream, valid until the next read, or nullptr if it is corrupted.
+        const uint8_t* ReadStream(const AssetArchiveStream& stream, void* dst) const
+        {
+            if(stream.offset > _size || stream.storedSize > _size - stream.offset)
+                return nullptr;
+            const uint8_t* src = _data + stream.offset;
+            if(!stream.compressed())
+            {
+                std::memcpy(dst, src, stream.rawSize);
+                return src;
+            }
+            _scratch.resize(stream.rawSize);
+            if(!lz4::DecompressBlock(src, stream.storedSize, _scratch.data(), stream.rawSize))
+                return nullptr;
+            std::memcpy(dst, _scratch.data(), stream.rawSize);
+            return _scratch.data();
+        }
+        // the stream has to hold exactly count elements, out is only sized once that is checked
+        template<typename T>
+        const T* ReadStream(const AssetArchiveEntry& entry, uint32_t stream, uint32_t count, TypedSharedBuffer<T>& out) const
+        {
+            const AssetArchiveStream& s = entry.streams[stream];
+            if(!count || s.rawSize % sizeof(T) || s.rawSize / sizeof(T) != count)
+            {
+                std::fprintf(stderr, "Error: Stream %u of asset \"%s\" does not hold %u elements!\n", stream, entry.name, count);
+                return nullptr;
+            }
+            out = TypedSharedBuffer<T>(count);
+            const uint8_t* readable = ReadStream(s, out.data());
+            if(!readable)
+                std::fprintf(stderr, "Error: Corrupted stream %u of asset \"%s\"!\n", stream, entry.name);
+            return (const T*)readable;
+        }
+    public:
+        AssetArchive() = default;
+        AssetArchive(const char* path)
+        {
+            Open(path);
+        }
+        AssetArchive(const AssetArchive&) = delete;
+        AssetArchive& operator=(const AssetArchive&) = delete;
+        AssetArchive(AssetArchive&& other) noexcept :
+            _data(other._data), _size(other._size), _header(other._header), _entries(other._entries),
+            _scratch(std::move(other._scratch))
+        {
+            other._data = nullptr;
+            other._size = 0;
+            other._header = nullptr;
+            other._entries = nullptr;
+        }
+        ~AssetArchive()
+        {
+            Close();
+        }
+
+        bool Open(const char* path)
+        {
+            Close();
+            int fd = open(path, O_RDONLY | O_CLOEXEC);
+            if(fd < 0)
+            {
+                std::fprintf(stderr, "Error: Opening asset archive: %s failed!\n", path);
+                return false;
+            }
+            struct stat st;
+            if(fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(AssetArchiveHeader))
+            {
+                std::fprintf(stderr, "Error: Asset archive: %s is too small!\n", path);
+                close(fd);
+                return false;
+            }
+            void* mapping = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd); // mapping keeps the file alive
+            if(mapping == MAP_FAILED)
+            {
+                std::fprintf(stderr, "Error: Mapping asset archive: %s failed!\n", path);
+                return false;
+            }
+            madvise(mapping, st.st_size, MADV_WILLNEED);
+            _data = (const uint8_t*)mapping;
+            _size = st.st_size;
+            _header = (const AssetArchiveHeader*)_data;
+            if(_header->magic != ASSET_ARCHIVE_MAGIC || _header->version != ASSET_ARCHIVE_VERSION ||
+               _header->tocOffset + (uint64_t)_header->entryCount * sizeof(AssetArchiveEntry) > _size)
+            {
+                std::fprintf(stderr, "Error: %s is not a valid asset archive!\n", path);
+                Close();
+                return false;
+            }
+            _entries = (const AssetArchiveEntry*)(_data + _header->tocOffset);
+            return true;
+        }
+        void Close()
+        {
+            if(_data)
+                munmap((void*)_data, _size);
+            _data = nullptr;
+            _size = 0;
+            _header = nullptr;
+            _entries = nullptr;
+        }
+        inline operator bool() const
+        {
+            return _data;
+        }
+        inline uint32_t count() const
+        {
+            return _header ? _header->entryCount : 0;
+        }
+        inline const AssetArchiveEntry& operator[](uint32_t i) const
+        {
+            return _entries[i];
+        }
+        const AssetArchiveEntry* Find(std::string_view name, AssetType type) const
+        {
+            for(uint32_t i = 0; i < count(); i++)
+            {
+                const AssetArchiveEntry& entry = _entries[i];
+                if(entry.type == type && name == std::string_view(entry.name, strnlen(entry.name, ASSET_NAME_MAX)))
+                    return &entry;
+            }
+            std::fprintf(stderr, "Error: Asset \"%.*s\" not found in archive!\n", (int)name.size(), name.data());
+            return nullptr;
+        }
+
+        std::optional<Mesh> LoadMesh(std::string_view name) const
+        {
+            const AssetArchiveEntry* entry = Find(name, AssetType::MESH);
+            if(!entry)
+                return std::nullopt;
+
+            TypedSharedBuffer<glm::vec3> vertices;
+            const glm::vec3* positions = ReadStream(*entry, POSITION_STREAM, entry->mesh.vertCount, vertices);
+            if(!positions)
+                return std::nullopt;
+            std::optional<Mesh> mesh{std::in_place, vertices};
+            // the buffer is write only, bounds for culling come from the archive or decompressed copy
+            mesh->ComputeBounds(positions, vertices.count());
+
+            if(entry->streams[COLOR_STREAM].present())
+            {
+                TypedSharedBuffer<glm::vec4> colors;
+                if(!ReadStream(*entry, COLOR_STREAM, entry->mesh.vertCount, colors)) return std::nullopt;
+                mesh->initColors(colors);
+            }
+            if(entry->streams[UV_STREAM].present())
+            {
+                TypedSharedBuffer<glm::vec2> UVs;
+                if(!ReadStream(*entry, UV_STREAM, entry->mesh.vertCount, UVs)) return std::nullopt;
+                mesh->initUVs(UVs);
+            }
+            if(entry->streams[NORMAL_STREAM].present())
+            {
+                TypedSharedBuffer<glm::vec3> normals;
+                if(!ReadStream(*entry, NORMAL_STREAM, entry->mesh.vertCount, normals)) return std::nullopt;
+                mesh->initNormals(normals);
+            }
+            if(entry->streams[TANGENT_STREAM].present())
+            {
+                TypedSharedBuffer<glm::vec3> tangents;
+                if(!ReadStream(*entry, TANGENT_STREAM, entry->mesh.vertCount, tangents)) return std::nullopt;
+                mesh->initTangents(tangents);
+            }
+            if(entry->streams[ELEMENT_STREAM].present())
+            {
+                TypedSharedBuffer<GLuint> elements;
+                if(!ReadStream(*entry, ELEMENT_STREAM, entry->mesh.elemCount, elements)) return std::nullopt;
+                mesh->initElements(elements);
+            }
+            return mesh;
+        }
+
+        // pixels go through a persistently mapped pixel unpack buffer,
+        // which is released as soon as the upload is queued
+        Texture2D LoadTexture2D(std::string_view name, GLsizei lvls, GLenum gl_in_format) const
+        {
+            const AssetArchiveEntry* entry = Find(name, AssetType::TEXTURE_2D);
+            if(!entry)
+                return Texture2D();
+            const AssetArchiveStream& pixels = entry->streams[PIXEL_STREAM];
+            const auto& format = entry->texture;
+            if(!pixels.present() || format.compNum == 0 || format.compNum > 4 ||
+               pixels.rawSize != (uint64_t)format.width * format.height * format.compNum * TexCompTypeSize((TexCompType)format.compType))
+            {
+                std::fprintf(stderr, "Error: Invalid texture entry \"%s\"!\n", entry->name);
+                return Texture2D();
+            }
+            // RGB goes through an Image, which pads it to RGBA before the upload
+            Image image;
+            SharedBuffer pixelBuffer;
+            if(format.compNum == 3)
+                image = Image((TexCompType)format.compType, format.width, format.height, 1, 3);
+            else
+                pixelBuffer = SharedBuffer(pixels.rawSize);
+            if(!ReadStream(pixels, image ? image->pixels : pixelBuffer.data()))
+            {
+                std::fprintf(stderr, "Error: Corrupted pixel data of texture \"%s\"!\n", entry->name);
+                return Texture2D();
+            }
+            Texture2D texture(lvls, gl_in_format, entry->texture.compNum, entry->texture.width, entry->texture.height);
+            if(image)
+                texture.Load(image, 0);
+            else
+            {
+                glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+                texture.Load(pixelBuffer, 0, compNumToFormat[entry->texture.compNum], (TexCompType)entry->texture.compType, 0);
+                glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+            }
+            if(lvls > 1)
+                glGenerateTextureMipmap(texture);
+            return texture;
+        }
+    };
+}
\ No newline at end of file
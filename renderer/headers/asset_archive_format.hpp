@@ -0,0 +1,98 @@
+#pragma once
+#include <cstdint>
+#include <type_traits>
+
+namespace render
+{
+    // On-disk layout of archives produced by asset_cook:
+    // [AssetArchiveHeader][AssetArchiveEntry x entryCount][blobs...]
+    // Every asset blob starts at an ASSET_ARCHIVE_ALIGNMENT boundary and consists of
+    // streams, each of which is either stored raw or as a single LZ4 block.
+    // This header is shared by the cooker and the runtime reader, so it must not depend on GL.
+    constexpr uint32_t ASSET_ARCHIVE_MAGIC = 0x4B415052; // "RPAK"
+    constexpr uint32_t ASSET_ARCHIVE_VERSION = 1;
+    constexpr uint64_t ASSET_ARCHIVE_ALIGNMENT = 64 * 1024;
+    constexpr uint64_t ASSET_ARCHIVE_STREAM_ALIGNMENT = 256;
+    constexpr uint32_t ASSET_NAME_MAX = 64; // including null terminator
+
+    enum class AssetType : uint32_t
+    {
+        MESH = 1,
+        TEXTURE_2D = 2
+    };
+    // same values as GL_UNSIGNED_BYTE, GL_UNSIGNED_SHORT, GL_HALF_FLOAT and GL_FLOAT
+    enum class AssetCompType : uint32_t
+    {
+        UNSIGNED_BYTE = 0x1401,
+        UNSIGNED_SHORT = 0x1403,
+        HALF_FLOAT = 0x140B,
+        FLOAT = 0x1406
+    };
+    enum AssetMeshStream : uint32_t
+    {
+        POSITION_STREAM,    // glm::vec3[vertCount]
+        COLOR_STREAM,       // glm::vec4[vertCount]
+        UV_STREAM,          // glm::vec2[vertCount]
+        NORMAL_STREAM,      // glm::vec3[vertCount]
+        TANGENT_STREAM,     // glm::vec3[vertCount]
+        ELEMENT_STREAM,     // uint32_t[elemCount]
+        MESH_STREAM_COUNT
+    };
+    enum AssetTextureStream : uint32_t
+    {
+        PIXEL_STREAM,       // level 0, tightly packed rows
+        TEXTURE_STREAM_COUNT
+    };
+    constexpr uint32_t ASSET_MAX_STREAMS = MESH_STREAM_COUNT;
+
+    struct AssetArchiveStream
+    {
+        uint64_t offset = 0;     // from the beginning of the archive
+        uint64_t storedSize = 0; // bytes in the archive
+        uint64_t rawSize = 0;    // bytes after decompression, 0 if stream is absent
+        inline bool present() const
+        {
+            return rawSize != 0;
+        }
+        inline bool compressed() const
+        {
+            return storedSize != rawSize;
+        }
+    };
+    struct AssetArchiveHeader
+    {
+        uint32_t magic = ASSET_ARCHIVE_MAGIC;
+        uint32_t version = ASSET_ARCHIVE_VERSION;
+        uint32_t entryCount = 0;
+        uint32_t __pad = 0;
+        uint64_t tocOffset = sizeof(AssetArchiveHeader);
+    };
+    struct AssetArchiveEntry
+    {
+        char name[ASSET_NAME_MAX] = {};
+        AssetType type = AssetType::MESH;
+        uint32_t __pad = 0;
+        union
+        {
+            struct
+            {
+                uint32_t vertCount, elemCount;
+            } mesh;
+            struct
+            {
+                uint32_t width, height, compNum;
+                AssetCompType compType;
+            } texture = {};
+        };
+        AssetArchiveStream streams[ASSET_MAX_STREAMS];
+    };
+    static_assert(std::is_trivially_copyable_v<AssetArchiveHeader>);
+    static_assert(std::is_trivially_copyable_v<AssetArchiveEntry>);
+    static_assert(sizeof(AssetArchiveHeader) == 24);
+    static_assert(sizeof(AssetArchiveEntry) == 232);
+
+    constexpr uint64_t AlignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+}
\ No newline at end of file
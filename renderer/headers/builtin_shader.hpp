@@ -1,27 +1,89 @@
 #pragma once
 #include "OpenGL_utils/shader.hpp"
+#include "OpenGL_utils/program_binary_cache.hpp"
+#include "OpenGL_utils/async_program_compiler.hpp"
 #include "OpenGL_utils/buffer.hpp"
 #include "OpenGL_utils/texture.hpp"
+#include "OpenGL_utils/profiler.hpp"
+#include "texture_array_packer.hpp"
+#include "shader_archive.hpp"
 #include <glm/glm.hpp>
+#include <vector>
+#include <unordered_map>
+#include <cstdlib>
+#include <cstdint>
+#include <string>
 
 namespace render
 {
-    const char* shader_location = "./renderer/shader/processed";
+    // Directory with processed shaders that take precedence over builtin_shader_archive,
+    // so shaders can be edited without relinking. Taken from RENDERER_SHADER_DIR environment variable
+    // (e.g. ./renderer/shader/processed), nullptr = use the embedded archive only.
+    inline const char* shader_location = std::getenv("RENDERER_SHADER_DIR");
     enum UniformBufferBindingPoint : GLuint
     {
         CAMERA_BINDING_POINT = 0,
         BRDF_LIGHTING_BINDING_POINT = 1,
-        BRDF_MATERIAL_BINDING_POINT = 2
+        SHADOW_BINDING_POINT = 2
     };
-    struct VertexShaderGeneral : Shader
+    enum ShaderStorageBindingPoint : GLuint
     {
-        enum UniformLocation
+        BRDF_MATERIALS_BINDING_POINT = 0,
+        CLUSTER_LIGHTS_BINDING_POINT = 1,
+        CLUSTERS_BINDING_POINT = 2,
+        CLUSTER_LIGHT_INDICES_BINDING_POINT = 3,
+        HIZ_INSTANCES_BINDING_POINT = 4,
+        HIZ_VISIBILITY_BINDING_POINT = 5,
+        HIZ_SURVIVORS_BINDING_POINT = 6,
+        HIZ_COMMAND_BINDING_POINT = 7,
+        VISIBILITY_INSTANCES_BINDING_POINT = 8,
+        VISIBILITY_POSITIONS_BINDING_POINT = 9,
+        VISIBILITY_ELEMENTS_BINDING_POINT = 10,
+        VISIBILITY_COLORS_BINDING_POINT = 11,
+        VISIBILITY_UVS_BINDING_POINT = 12,
+        VISIBILITY_NORMALS_BINDING_POINT = 13,
+        VISIBILITY_TANGENTS_BINDING_POINT = 14,
+        VISIBILITY_DRAWS_BINDING_POINT = 15
+    };
+    class ShaderVariantCache;
+
+    // reads a processed builtin shader by file name, empty on failure
+    inline std::string ReadBuiltinShader(const char* name)
+    {
+        std::string source;
+        if(shader_location && ReadTxtFile((std::string{shader_location} + '/' + name).c_str(), source))
+            return source;
+        if(!builtin_shader_archive.Read(name, source))
         {
-            ACTIVE_ATRRIB_BIT_LOCATION = 0
-        };
-        VertexShaderGeneral() : Shader()
+            std::fprintf(stderr, "Error: Builtin shader %s not found!\n", name);
+            source.clear();
+        }
+        return source;
+    }
+    // Inserts ATTRIB_MASK and TEXTURE_MASK defines after the #version directive,
+    // which has to stay the first line of a shader
+    inline std::string SpecializeShaderSource(const std::string& source, GLuint attribMask, GLuint textureMask)
+    {
+        std::string defines = "#define ATTRIB_MASK " + std::to_string(attribMask) + "u\n"
+                              "#define TEXTURE_MASK " + std::to_string(textureMask) + "u\n";
+        size_t version = source.find("#version");
+        size_t insertAt = version == std::string::npos ? 0 : source.find('\n', version);
+        if(insertAt == std::string::npos)
+            return source + "\n" + defines;
+        return std::string(source).insert(insertAt ? insertAt + 1 : 0, defines);
+    }
+    struct VertexShaderGeneral : Shader
+    {
+        static constexpr const char* file = "general.vert.glsl";
+        static constexpr const char* depthFile = "general_depth.vert.glsl"; // position only, for depth passes
+        // attributes shaders are specialized for, position and instance attributes are always enabled
+        static constexpr GLuint VARIANT_ATTRIB_MASK = 0b11110u; // color, uv, normal, tangent
+        // the default compiles every attribute in, for meshes that have all of them
+        VertexShaderGeneral(GLuint attribMask = ~0u) : Shader()
         {
-            Shader::operator=(Shader::FromFile(GL_VERTEX_SHADER, (std::string{shader_location} + "/general.vert.glsl").c_str()));
+            std::string source = ReadBuiltinShader(file);
+            if(!source.empty())
+                Shader::operator=(Shader(GL_VERTEX_SHADER, SpecializeShaderSource(source, attribMask & VARIANT_ATTRIB_MASK, 0).c_str()));
         }
     };
     struct FragmentShaderBRDF : Shader
@@ -33,8 +95,20 @@ namespace render
             METALLIC_MAP_UNIT,
             NORMAL_MAP_UNIT,
             AMBIENT_OCCLUSION_MAP_UNIT,
-            NEXT_MAP_UNIT
+            ORM_MAP_UNIT, // when set, roughness, metallic and ambient occlusion maps are ignored
+            NEXT_MAP_UNIT,
+            SHADOW_MAP_UNIT = NEXT_MAP_UNIT // cascade depth array of CascadedShadowMaps
         };
+        enum TextureMode
+        {
+            TEXTURE_UNITS,  // brdf.frag.glsl, a 2D texture bound per map unit
+            BINDLESS,       // brdf_bindless.frag.glsl, resident handles in the material SSBO
+            TEXTURE_ARRAYS  // brdf_array.frag.glsl, a 2D array texture per map unit and a layer per material
+        };
+        static bool BindlessSupported()
+        {
+            return GLEW_ARB_bindless_texture;
+        }
         struct Lighting
         {
         private:
@@ -45,74 +119,518 @@ namespace render
                 glm::vec3 lightColor;
                 float __pad2;
                 glm::vec3 view_lightDirection;
+                float __pad3;
+                glm::uvec3 clusterGrid;  // tiles x, y and depth slices, zero unless ClusteredLighting::Update ran
+                float clusterSliceScale; // depth slice = log(view depth) * scale + bias
+                float clusterSliceBias;
+                GLuint shadowCascadeCount; // zero unless CascadedShadowMaps::Render ran
             };
             TypedSharedBuffer<LightUniformData> _lightBuffer{1};
         public:
             LightUniformData &uniformData = _lightBuffer[0];
+            Lighting()
+            {
+                _lightBuffer.Label(GpuMemoryCategory::UNIFORM, "Lighting");
+                uniformData.clusterGrid = glm::uvec3(0);
+                uniformData.shadowCascadeCount = 0;
+            }
             void Use() const
             {
                 glBindBufferBase(GL_UNIFORM_BUFFER, 1, _lightBuffer);
             }
 
         };
-        FragmentShaderBRDF() : Shader()
+        static constexpr const char* File(TextureMode mode)
         {
-            Shader::operator=(Shader::FromFile(GL_FRAGMENT_SHADER, (std::string{shader_location} + "/brdf.frag.glsl").c_str()));
+            return mode == BINDLESS ? "brdf_bindless.frag.glsl" :
+                   mode == TEXTURE_ARRAYS ? "brdf_array.frag.glsl" : "brdf.frag.glsl";
         }
-        struct Material
+        // ORM map replaces roughness, metallic and ambient occlusion maps,
+        // so materials differing only in those share a variant
+        static constexpr GLuint VariantTextureMask(GLuint textureBitfield)
         {
-        private:
-            struct MaterialUniformData
-            {
-                friend class Material;
-                glm::vec4 color_mod = { 1.f, 1.f, 1.f, 1.f };
-                float roughness_mod = 1.f;
-                float metallic_mod = 1.f;
-                float ambient_occlusion_mod = 1.f;
-                float normal_mod = 1.f; // how much normal map affects the final normal <0,1> range
-            protected:
-                union
+            if(textureBitfield & (1u << ORM_MAP_UNIT))
+                textureBitfield &= ~((1u << ROUGHNESS_MAP_UNIT) | (1u << METALLIC_MAP_UNIT) | (1u << AMBIENT_OCCLUSION_MAP_UNIT));
+            return textureBitfield;
+        }
+        // The default texture mask compiles every map in, the material's own bitfield then picks the sampled maps,
+        // so it is not reduced to the ORM map like the masks of specialized variants
+        FragmentShaderBRDF(TextureMode mode = TEXTURE_UNITS, GLuint attribMask = ~0u, GLuint textureMask = ~0u) : Shader()
+        {
+            std::string source = ReadBuiltinShader(File(mode));
+            if(!source.empty())
+                Shader::operator=(Shader(GL_FRAGMENT_SHADER, SpecializeShaderSource(source,
+                    attribMask & VertexShaderGeneral::VARIANT_ATTRIB_MASK,
+                    textureMask == ~0u ? textureMask : VariantTextureMask(textureMask)).c_str()));
+        }
+        struct Material;
+        struct MaterialRegistry;
+        struct MaterialUniformData // std430 element of the material SSBO
+        {
+            friend struct Material;
+            glm::vec4 color_mod = { 1.f, 1.f, 1.f, 1.f };
+            float roughness_mod = 1.f;
+            float metallic_mod = 1.f;
+            float ambient_occlusion_mod = 1.f;
+            float normal_mod = 1.f; // how much normal map affects the final normal <0,1> range
+        protected:
+            union
+            {
+                struct
                 {
-                    struct
-                    {
-                        mutable uint32_t albedo_active : 1,
-                                roughness_active : 1,
-                                metallic_active : 1,
-                                normal_active : 1,
-                                ambient_occlusion_active : 1;
-                        uint32_t unused : 27;
-                    };
-                    mutable uint32_t active_texture_bitfield = 0u;
+                    uint32_t albedo_active : 1,
+                            roughness_active : 1,
+                            metallic_active : 1,
+                            normal_active : 1,
+                            ambient_occlusion_active : 1,
+                            orm_active : 1;
+                    uint32_t unused : 26;
                 };
+                uint32_t active_texture_bitfield = 0u;
             };
-            render::TypedSharedBuffer<MaterialUniformData> materialBuffer{1};
+            uint32_t __pad[3]; // matches _pad in brdf.glsl, keeping map_layers at 48 and map_handles at 80
+            int32_t map_layers[8] = {}; // used with TEXTURE_ARRAYS
+            GLuint64 map_handles[8] = {}; // used with BINDLESS
+        };
+        static_assert(NEXT_MAP_UNIT <= 8);
+        static_assert(sizeof(MaterialUniformData) == 144);
+
+        // Parameters of every material live contiguously in one SSBO, indexed in shaders
+        // by the per instance InstanceData::material, so drawing with a different material
+        // needs no buffer rebinds. The texture mode decides how materials reach their textures
+        // and has to match the program variant, see FragmentShaderBRDF::TextureMode.
+        // Index DEFAULT_INDEX holds default parameters without textures, for instances without a material
+        // and materials created while the registry was full.
+        struct MaterialRegistry
+        {
+            friend struct Material;
+        private:
+            TypedSharedBuffer<MaterialUniformData> _materialBuffer;
+            TextureMode _mode;
+            GLuint _count = DEFAULT_INDEX + 1;
+            std::vector<GLuint> _freeIndices;
+            struct ResidentHandle
+            {
+                Texture texture; // keeps texture alive while its handle is resident
+                GLuint refCount = 0;
+            };
+            std::unordered_map<GLuint64, ResidentHandle> _residentHandles;
+
+            GLuint Allocate()
+            {
+                GLuint index;
+                if(!_freeIndices.empty())
+                {
+                    index = _freeIndices.back();
+                    _freeIndices.pop_back();
+                }
+                else if(_count < _materialBuffer.count())
+                    index = _count++;
+                else
+                {
+                    std::fputs("Error: Material registry is full, falling back to the default material!\n", stderr);
+                    return DEFAULT_INDEX;
+                }
+                _materialBuffer[index] = MaterialUniformData{};
+                return index;
+            }
+            void Release(GLuint index)
+            {
+                _freeIndices.push_back(index);
+            }
+            GLuint64 AcquireHandle(const Texture& texture)
+            {
+                if(!texture)
+                    return 0;
+                GLuint64 handle = glGetTextureHandleARB(texture);
+                ResidentHandle &resident = _residentHandles[handle];
+                if(!resident.refCount++)
+                {
+                    resident.texture = texture;
+                    resident.texture.Pin();
+                    glMakeTextureHandleResidentARB(handle);
+                }
+                return handle;
+            }
+            void ReleaseHandle(GLuint64 handle)
+            {
+                if(!handle)
+                    return;
+                auto it = _residentHandles.find(handle);
+                if(it == _residentHandles.end() || --it->second.refCount)
+                    return;
+                it->second.texture.Unpin();
+                glMakeTextureHandleNonResidentARB(handle);
+                _residentHandles.erase(it);
+            }
         public:
-            Material()
+            static constexpr GLuint DEFAULT_INDEX = 0;
+
+            // capacity counts the materials besides the default one
+            MaterialRegistry(GLuint capacity, TextureMode mode = BestTextureMode()) :
+                _materialBuffer(capacity + 1),
+                _mode(mode == BINDLESS && !BindlessSupported() ? TEXTURE_UNITS : mode)
+            {
+                _materialBuffer[DEFAULT_INDEX] = MaterialUniformData{};
+                if(_mode != mode)
+                    std::fputs("ARB_bindless_texture not supported, material registry falls back to texture units\n", stderr);
+                _materialBuffer.Label(GpuMemoryCategory::UNIFORM, "Materials");
+            }
+            MaterialRegistry(const MaterialRegistry&) = delete;
+            MaterialRegistry& operator=(const MaterialRegistry&) = delete;
+            ~MaterialRegistry()
+            {
+                for(auto &[handle, resident] : _residentHandles)
+                {
+                    resident.texture.Unpin();
+                    glMakeTextureHandleNonResidentARB(handle);
+                }
+            }
+            // bindless when available, otherwise the portable texture array path
+            static TextureMode BestTextureMode()
+            {
+                return BindlessSupported() ? BINDLESS : TEXTURE_ARRAYS;
+            }
+            inline TextureMode mode() const
             {
-                materialBuffer[0] = MaterialUniformData{};
+                return _mode;
+            }
+            inline GLuint count() const
+            {
+                return _count - (DEFAULT_INDEX + 1) - _freeIndices.size();
             }
-            MaterialUniformData &uniformData = materialBuffer[0];
-            Texture textures[NEXT_MAP_UNIT];
             void Use() const
-            {   
-                uniformData.active_texture_bitfield = 0u;
+            {
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BRDF_MATERIALS_BINDING_POINT, _materialBuffer);
+            }
+        };
+        struct Material
+        {
+        private:
+            MaterialRegistry &_registry;
+            const GLuint _index;
+            Texture _textures[NEXT_MAP_UNIT];
+            // Texture names last bound to map units by any material, so materials sharing
+            // textures (e.g. texture arrays) switch without rebinds. Call InvalidateTextureBindings()
+            // after binding other textures to these units.
+            static inline GLuint boundTextures[NEXT_MAP_UNIT] = {};
+            static inline const Material* used = nullptr;
+            MaterialUniformData _unregistered; // parameters of a material the full registry had no room for
+        public:
+            Material(MaterialRegistry &registry) :
+                _registry(registry),
+                _index(registry.Allocate()),
+                uniformData(valid() ? registry._materialBuffer[_index] : _unregistered)
+            {}
+            Material(const Material&) = delete;
+            Material& operator=(const Material&) = delete;
+            ~Material()
+            {
+                if(_registry._mode == BINDLESS)
+                    for(GLuint64 handle : uniformData.map_handles)
+                        _registry.ReleaseHandle(handle);
+                if(valid())
+                    _registry.Release(_index);
+                if(used == this)
+                    used = nullptr;
+            }
+            MaterialUniformData &uniformData;
+            // value for InstanceData::material, MaterialRegistry::DEFAULT_INDEX if the registry was full
+            inline GLuint index() const
+            {
+                return _index;
+            }
+            inline bool valid() const
+            {
+                return _index != MaterialRegistry::DEFAULT_INDEX;
+            }
+            // maps the material samples, selects its shader variants
+            inline GLuint textureMask() const
+            {
+                return uniformData.active_texture_bitfield;
+            }
+            inline const Texture& texture(TextureUnit unit) const
+            {
+                return _textures[unit];
+            }
+            // texture bitfield and bindless handle are only updated here, not on every Use()
+            void SetTexture(TextureUnit unit, const Texture& texture, GLint layer = 0)
+            {
+                _textures[unit] = texture;
+                uniformData.active_texture_bitfield = texture ?
+                    uniformData.active_texture_bitfield | (1u << unit) :
+                    uniformData.active_texture_bitfield & ~(1u << unit);
+                uniformData.map_layers[unit] = layer;
+                if(_registry._mode == BINDLESS)
+                {
+                    _registry.ReleaseHandle(uniformData.map_handles[unit]);
+                    uniformData.map_handles[unit] = _registry.AcquireHandle(texture);
+                }
+            }
+            // Selects the texture variant in the active ShaderVariantCache and binds the textures it samples
+            // to map units, skipped for units that already hold them. No bindings in BINDLESS mode.
+            void Use() const;
+            // material of the last Use(), which draws recorded by VisibilityBuffer are resolved with
+            static inline const Material* lastUsed()
+            {
+                return used;
+            }
+            static void InvalidateTextureBindings()
+            {
+                for(GLuint &name : boundTextures)
+                    name = 0;
+                for(unsigned int i = 0; i < NEXT_MAP_UNIT; i++)
+                    glBindTextureUnit(i, 0);
+            }
+            // Replaces textures with the arrays they were packed into and records their layers,
+            // to be used in TEXTURE_ARRAYS mode.
+            // Returns false if some texture was not packed by packer.
+            bool UseTextureArrays(const TextureArrayPacker& packer)
+            {
                 for(unsigned int i = 0; i < NEXT_MAP_UNIT; i++)
                 {
-                    uniformData.active_texture_bitfield = uniformData.active_texture_bitfield | ((textures[i]->name != 0) ? (1u << i): 0u);
-                    glBindTextureUnit(i, textures[i]);
+                    if(!_textures[i])
+                        continue;
+                    const TextureArrayPacker::Location* location = packer.Find(_textures[i]);
+                    if(!location)
+                        return false;
+                    SetTexture((TextureUnit)i, location->array, location->layer);
                 }
-                glBindBufferBase(GL_UNIFORM_BUFFER, 2, materialBuffer);
+                return true;
             }
         };
     };
     struct ShaderProgramBRDF : ShaderProgram
     {
-        ShaderProgramBRDF() : 
+        ShaderProgramBRDF(FragmentShaderBRDF::TextureMode mode = FragmentShaderBRDF::TEXTURE_UNITS, GLuint attribMask = ~0u, GLuint textureMask = ~0u) : 
             ShaderProgram({
-                VertexShaderGeneral(),
-                FragmentShaderBRDF()})
+                VertexShaderGeneral(attribMask),
+                FragmentShaderBRDF(mode, attribMask, textureMask)})
         {
 
         }
     };
+
+    // BRDF programs specialized per (attribute mask, texture mask) pair and compiled on first use.
+    // While activated, Material::Use() selects the texture mask and Mesh::Draw() the attribute mask,
+    // binding the matching variant, so shaders contain no branches on attributes or maps that are absent.
+    // Instances drawn together have to use materials with the same set of maps.
+    // With a ProgramBinaryCache, variants linked in earlier runs are loaded instead of compiled.
+    // With an AsyncProgramCompiler, variants compile in the background and draws fall back to the
+    // untextured variant of the mesh, or are skipped, until they are ready.
+    class ShaderVariantCache
+    {
+    private:
+        struct Variant
+        {
+            AsyncShaderProgram program;
+            GLuint attribMask, textureMask;
+            bool depthOnly = false; // general_depth.vert.glsl without a fragment shader
+            bool stored = false; // binary written to the ProgramBinaryCache, or nothing to write
+        };
+        FragmentShaderBRDF::TextureMode _mode;
+        ProgramBinaryCache* _binaryCache;
+        AsyncProgramCompiler* _compiler;
+        std::string _vertexSource, _fragmentSource, _depthVertexSource;
+        std::unordered_map<GLuint, Shader> _vertexShaders; // by attribute mask, synchronous path only
+        std::unordered_map<uint64_t, Variant> _variants;
+        std::vector<Variant*> _unstored; // compiled asynchronously, binary not yet stored
+        GLuint _textureMask = 0;
+        GLuint _boundProgram = 0;
+        bool _depthOnly = false;
+
+        static constexpr uint64_t DEPTH_ONLY_KEY = ~0ull;
+        static uint64_t Key(GLuint attribMask, GLuint textureMask)
+        {
+            return (uint64_t)textureMask << 32 | attribMask;
+        }
+        void Sources(const Variant &variant, std::string &vertexSource, std::string &fragmentSource) const
+        {
+            vertexSource = SpecializeShaderSource(variant.depthOnly ? _depthVertexSource : _vertexSource, variant.attribMask, 0);
+            fragmentSource = variant.depthOnly ? "" : SpecializeShaderSource(_fragmentSource, variant.attribMask, variant.textureMask);
+        }
+        void StoreBinary(Variant &variant)
+        {
+            if(variant.stored || variant.program.pending())
+                return;
+            variant.stored = true;
+            if(!_binaryCache || !variant.program.ready())
+                return;
+            std::string vertexSource, fragmentSource;
+            Sources(variant, vertexSource, fragmentSource);
+            if(variant.depthOnly)
+                _binaryCache->Store({{GL_VERTEX_SHADER, vertexSource}}, variant.program.get());
+            else
+                _binaryCache->Store({{GL_VERTEX_SHADER, vertexSource}, {GL_FRAGMENT_SHADER, fragmentSource}}, variant.program.get());
+        }
+        void StoreFinishedBinaries()
+        {
+            std::erase_if(_unstored, [this](Variant* variant)
+            {
+                StoreBinary(*variant);
+                return variant->stored;
+            });
+        }
+        Variant& Request(GLuint attribMask, GLuint textureMask, bool depthOnly = false)
+        {
+            // depth only variants read positions and instance transforms, which are always enabled
+            attribMask = depthOnly ? 0 : attribMask & VertexShaderGeneral::VARIANT_ATTRIB_MASK;
+            textureMask = depthOnly ? 0 : FragmentShaderBRDF::VariantTextureMask(textureMask);
+            uint64_t key = depthOnly ? DEPTH_ONLY_KEY : Key(attribMask, textureMask);
+            auto it = _variants.find(key);
+            if(it != _variants.end())
+                return it->second;
+
+            Variant variant{{}, attribMask, textureMask, depthOnly};
+            std::string vertexSource, fragmentSource;
+            Sources(variant, vertexSource, fragmentSource);
+            bool retrievable = _binaryCache && _binaryCache->enabled();
+            ShaderProgram cached;
+            if(_binaryCache)
+                cached = depthOnly ? _binaryCache->Find({{GL_VERTEX_SHADER, vertexSource}}) :
+                                     _binaryCache->Find({{GL_VERTEX_SHADER, vertexSource}, {GL_FRAGMENT_SHADER, fragmentSource}});
+            if(cached)
+            {
+                variant.program = cached;
+                variant.stored = true;
+            }
+            else if(_compiler)
+                variant.program = depthOnly ? _compiler->Compile({{GL_VERTEX_SHADER, vertexSource}}, retrievable) :
+                                              _compiler->Compile({{GL_VERTEX_SHADER, vertexSource}, {GL_FRAGMENT_SHADER, fragmentSource}}, retrievable);
+            else if(depthOnly)
+                variant.program = ShaderProgram({Shader(GL_VERTEX_SHADER, vertexSource.c_str())}, retrievable);
+            else
+            {
+                auto vertex = _vertexShaders.find(attribMask);
+                if(vertex == _vertexShaders.end())
+                    vertex = _vertexShaders.emplace(attribMask, Shader(GL_VERTEX_SHADER, vertexSource.c_str())).first;
+                Shader fragment(GL_FRAGMENT_SHADER, fragmentSource.c_str());
+                variant.program = ShaderProgram({vertex->second, fragment}, retrievable);
+            }
+            Variant &inserted = _variants.emplace(key, variant).first->second;
+            if(!inserted.stored)
+                _unstored.push_back(&inserted);
+            return inserted;
+        }
+    public:
+        static inline ShaderVariantCache* active = nullptr;
+
+        ShaderVariantCache(FragmentShaderBRDF::TextureMode mode = FragmentShaderBRDF::TEXTURE_UNITS,
+                           ProgramBinaryCache* binaryCache = nullptr, AsyncProgramCompiler* compiler = nullptr) :
+            _mode(mode),
+            _binaryCache(binaryCache),
+            _compiler(compiler),
+            _vertexSource(ReadBuiltinShader(VertexShaderGeneral::file)),
+            _fragmentSource(ReadBuiltinShader(FragmentShaderBRDF::File(mode))),
+            _depthVertexSource(ReadBuiltinShader(VertexShaderGeneral::depthFile))
+        {}
+        ShaderVariantCache(const ShaderVariantCache&) = delete;
+        ShaderVariantCache& operator=(const ShaderVariantCache&) = delete;
+        ~ShaderVariantCache()
+        {
+            if(active == this)
+                active = nullptr;
+        }
+        inline FragmentShaderBRDF::TextureMode mode() const
+        {
+            return _mode;
+        }
+        inline size_t count() const
+        {
+            return _variants.size();
+        }
+        // makes Material::Use() and Mesh::Draw() select variants from this cache
+        void Activate()
+        {
+            active = this;
+            _boundProgram = 0;
+        }
+        static void Deactivate()
+        {
+            active = nullptr;
+        }
+        // starts compiling a variant ahead of its first draw
+        AsyncShaderProgram Prewarm(GLuint attribMask, GLuint textureMask)
+        {
+            return Request(attribMask, textureMask).program;
+        }
+        AsyncShaderProgram PrewarmDepthOnly()
+        {
+            return Request(0, 0, true).program;
+        }
+        // blocks until the variant is compiled, empty program if compilation failed
+        const ShaderProgram& Get(GLuint attribMask, GLuint textureMask)
+        {
+            Variant &variant = Request(attribMask, textureMask);
+            if(variant.program.pending() && _compiler)
+                _compiler->Finish(variant.program);
+            StoreFinishedBinaries();
+            return variant.program.get();
+        }
+        inline void SetTextureMask(GLuint textureMask)
+        {
+            _textureMask = textureMask;
+        }
+        // While set, Use() binds the depth only variant regardless of attributes and textures,
+        // depth passes (shadow maps, depth pre-pass) toggle it around their draws.
+        inline void SetDepthOnly(bool depthOnly)
+        {
+            _depthOnly = depthOnly;
+        }
+        inline bool depthOnly() const
+        {
+            return _depthOnly;
+        }
+        // call after binding a program outside the cache (e.g. a compute dispatch),
+        // so the next Use() does not skip glUseProgram
+        inline void ResetBoundProgram()
+        {
+            _boundProgram = 0;
+        }
+        // Binds variant for attribMask and the last texture mask, glUseProgram is skipped if already bound.
+        // Returns false when neither the variant nor its untextured fallback is ready yet.
+        bool Use(GLuint attribMask)
+        {
+            Variant *variant = &Request(attribMask, _textureMask, _depthOnly);
+            if(!variant->program.ready())
+            {
+                if(_depthOnly)
+                    return false;
+                variant = &Request(attribMask, 0);
+                if(!variant->program.ready())
+                    return false;
+            }
+            if(!_unstored.empty())
+                StoreFinishedBinaries();
+            GLuint program = variant->program.get();
+            if(program != _boundProgram)
+            {
+                glUseProgram(program);
+                _boundProgram = program;
+            }
+            return true;
+        }
+    };
+
+    inline void FragmentShaderBRDF::Material::Use() const
+    {
+        PROFILE_SCOPE("Material::Use");
+        used = this;
+        if(ShaderVariantCache::active)
+            ShaderVariantCache::active->SetTextureMask(uniformData.active_texture_bitfield);
+        for(const Texture& texture : _textures)
+            texture.Touch();
+        if(_registry._mode == BINDLESS)
+            return;
+        // variants never sample maps outside their mask, e.g. the separate maps an ORM map replaces,
+        // so those units keep whatever they hold
+        GLuint sampled = VariantTextureMask(uniformData.active_texture_bitfield);
+        for(unsigned int i = 0; i < NEXT_MAP_UNIT; i++)
+        {
+            if(!(sampled & (1u << i)) || boundTextures[i] == (GLuint)_textures[i])
+                continue;
+            boundTextures[i] = _textures[i];
+            glBindTextureUnit(i, _textures[i]);
+        }
+    }
 }
\ No newline at end of file
@@ -0,0 +1,994 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "OpenGL_utils/profiler.hpp"
+
+namespace render
+{
+    struct Aabb
+    {
+        glm::vec3 min = glm::vec3(INFINITY);
+        glm::vec3 max = glm::vec3(-INFINITY);
+
+        inline void Grow(const glm::vec3& point)
+        {
+            min = glm::min(min, point);
+            max = glm::max(max, point);
+        }
+        inline void Grow(const Aabb& box)
+        {
+            min = glm::min(min, box.min);
+            max = glm::max(max, box.max);
+        }
+        inline bool empty() const
+        {
+            return min.x > max.x;
+        }
+        inline glm::vec3 center() const
+        {
+            return (min + max) * 0.5f;
+        }
+        // half the surface area, the factor cancels out of SAH costs
+        inline float area() const
+        {
+            if(empty())
+                return 0.f;
+            glm::vec3 extent = max - min;
+            return extent.x * extent.y + extent.y * extent.z + extent.z * extent.x;
+        }
+        inline bool operator==(const Aabb& other) const
+        {
+            return min == other.min && max == other.max;
+        }
+        // box around this box transformed by an affine matrix, by Arvo's method
+        Aabb Transformed(const glm::mat4& matrix) const
+        {
+            if(empty())
+                return *this;
+            Aabb box;
+            box.min = box.max = glm::vec3(matrix[3]);
+            for(int column = 0; column < 3; column++)
+                for(int row = 0; row < 3; row++)
+                {
+                    float a = matrix[column][row] * min[column], b = matrix[column][row] * max[column];
+                    box.min[row] += std::min(a, b);
+                    box.max[row] += std::max(a, b);
+                }
+            return box;
+        }
+    };
+
+    struct Ray
+    {
+        glm::vec3 origin = glm::vec3(0.f);
+        glm::vec3 direction = glm::vec3(0.f, 0.f, -1.f);
+        float tMax = INFINITY; // hits are searched for at origin + t * direction with t in [0, tMax]
+
+        // ray from the near to the far plane through a point in normalized device coordinates, e.g. the mouse for picking
+        static Ray Through(const glm::mat4& viewProjection, const glm::vec2& ndc)
+        {
+            glm::mat4 inverse = glm::inverse(viewProjection);
+            glm::vec4 near = inverse * glm::vec4(ndc, -1.f, 1.f), far = inverse * glm::vec4(ndc, 1.f, 1.f);
+            glm::vec3 origin = glm::vec3(near) / near.w;
+            glm::vec3 toFar = glm::vec3(far) / far.w - origin;
+            float length = glm::length(toFar);
+            return Ray{origin, toFar / length, length};
+        }
+    };
+    // entry distance along the ray, INFINITY on a miss
+    inline float IntersectBox(const Aabb& box, const glm::vec3& origin, const glm::vec3& inverseDirection, float tMax)
+    {
+        glm::vec3 t0 = (box.min - origin) * inverseDirection, t1 = (box.max - origin) * inverseDirection;
+        glm::vec3 tLow = glm::min(t0, t1), tHigh = glm::max(t0, t1);
+        float tNear = std::max(std::max(tLow.x, tLow.y), std::max(tLow.z, 0.f));
+        float tFar = std::min(std::min(tHigh.x, tHigh.y), std::min(tHigh.z, tMax));
+        return tNear <= tFar ? tNear : INFINITY;
+    }
+
+    enum class Overlap
+    {
+        OUTSIDE,
+        PARTIAL,
+        INSIDE
+    };
+    // planes of a view projection matrix facing inwards, unnormalized as only signs are tested
+    struct Frustum
+    {
+        glm::vec4 planes[6];
+
+        Frustum(const glm::mat4& viewProjection)
+        {
+            glm::mat4 rows = glm::transpose(viewProjection);
+            for(int axis = 0; axis < 3; axis++)
+            {
+                planes[axis * 2] = rows[3] + rows[axis];
+                planes[axis * 2 + 1] = rows[3] - rows[axis];
+            }
+        }
+        Overlap Test(const Aabb& box) const
+        {
+            Overlap overlap = Overlap::INSIDE;
+            for(const glm::vec4& plane : planes)
+            {
+                // the corners furthest along and against the plane normal
+                glm::vec3 along, against;
+                for(int axis = 0; axis < 3; axis++)
+                {
+                    along[axis] = plane[axis] >= 0.f ? box.max[axis] : box.min[axis];
+                    against[axis] = plane[axis] >= 0.f ? box.min[axis] : box.max[axis];
+                }
+                if(glm::dot(glm::vec3(plane), along) + plane.w < 0.f)
+                    return Overlap::OUTSIDE;
+                if(glm::dot(glm::vec3(plane), against) + plane.w < 0.f)
+                    overlap = Overlap::PARTIAL;
+            }
+            return overlap;
+        }
+    };
+
+    // Binned SAH bounding volume hierarchy over boxes, shared by MeshBvh and SceneBvh.
+    // Children are stored next to each other, so inner nodes only keep the index of the first one.
+    class BvhTree
+    {
+    public:
+        struct Node
+        {
+            Aabb bounds;
+            uint32_t first; // first child of inner nodes, first entry in primitives of leaves
+            uint32_t count; // primitives of a leaf, 0 for inner nodes
+        };
+        static constexpr uint32_t BINS = 16;
+        static constexpr uint32_t NONE = ~0u;
+        // deeper nodes stay leaves, so depth first traversal never holds more than STACK_SIZE nodes
+        static constexpr uint32_t MAX_DEPTH = 62;
+        static constexpr uint32_t STACK_SIZE = MAX_DEPTH + 2;
+
+        std::vector<Node> nodes;          // root first
+        std::vector<uint32_t> primitives; // box indices grouped by leaf
+        std::vector<uint32_t> parents;    // by node, NONE for the root
+    private:
+        // boxes are partitioned along with their centers instead of through indices, so building reads memory in order
+        struct Reference
+        {
+            Aabb box;
+            glm::vec3 center;
+            uint32_t index;
+        };
+        static Aabb Bounds(const Reference* begin, const Reference* end)
+        {
+            Aabb bounds;
+            for(const Reference* reference = begin; reference != end; reference++)
+                bounds.Grow(reference->box);
+            return bounds;
+        }
+        // partitions the node's references at the cheapest of BINS - 1 planes per axis and
+        // returns the size of the first part, 0 keeps the node a leaf
+        static uint32_t Split(Reference* begin, const Node& node, uint32_t maxLeafSize)
+        {
+            if(node.count <= 1)
+                return 0;
+            Reference* end = begin + node.count;
+            Aabb centerBounds;
+            for(Reference* reference = begin; reference != end; reference++)
+                centerBounds.Grow(reference->center);
+            glm::vec3 scale;
+            for(int axis = 0; axis < 3; axis++)
+            {
+                float extent = centerBounds.max[axis] - centerBounds.min[axis];
+                scale[axis] = extent > 0.f ? BINS / extent : 0.f;
+            }
+            auto bin = [&](const Reference& reference, int axis)
+            {
+                return std::min((uint32_t)((reference.center[axis] - centerBounds.min[axis]) * scale[axis]), BINS - 1);
+            };
+
+            // all three axes are binned in one pass
+            Aabb bins[3][BINS];
+            uint32_t counts[3][BINS] = {};
+            for(Reference* reference = begin; reference != end; reference++)
+                for(int axis = 0; axis < 3; axis++)
+                {
+                    uint32_t b = bin(*reference, axis);
+                    counts[axis][b]++;
+                    bins[axis][b].Grow(reference->box);
+                }
+            float bestCost = INFINITY;
+            int bestAxis = -1;
+            uint32_t bestBin = 0;
+            for(int axis = 0; axis < 3; axis++)
+            {
+                if(scale[axis] == 0.f)
+                    continue;
+                float leftArea[BINS - 1];
+                uint32_t leftCount[BINS - 1];
+                Aabb sweep;
+                uint32_t sum = 0;
+                for(uint32_t i = 0; i < BINS - 1; i++)
+                {
+                    sweep.Grow(bins[axis][i]);
+                    sum += counts[axis][i];
+                    leftArea[i] = sweep.area();
+                    leftCount[i] = sum;
+                }
+                sweep = Aabb();
+                sum = 0;
+                for(uint32_t i = BINS - 1; i > 0; i--)
+                {
+                    sweep.Grow(bins[axis][i]);
+                    sum += counts[axis][i];
+                    float cost = leftArea[i - 1] * leftCount[i - 1] + sweep.area() * sum;
+                    if(leftCount[i - 1] && sum && cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin = i;
+                    }
+                }
+            }
+            if(bestAxis < 0) // all centers coincide
+                return node.count > maxLeafSize ? node.count / 2 : 0;
+            // an inner node costs one traversal step on top of its children
+            if(node.count <= maxLeafSize && bestCost + node.bounds.area() >= node.bounds.area() * node.count)
+                return 0;
+            Reference* middle = std::partition(begin, end, [&](const Reference& reference)
+            {
+                return bin(reference, bestAxis) < bestBin;
+            });
+            return middle - begin;
+        }
+    public:
+        void Build(const std::vector<Aabb>& boxes, uint32_t maxLeafSize)
+        {
+            nodes.clear();
+            parents.clear();
+            primitives.resize(boxes.size());
+            if(boxes.empty())
+                return;
+            std::vector<Reference> references(boxes.size());
+            for(uint32_t i = 0; i < boxes.size(); i++)
+                references[i] = Reference{boxes[i], boxes[i].empty() ? glm::vec3(0.f) : boxes[i].center(), i};
+
+            nodes.reserve(boxes.size() * 2);
+            parents.reserve(boxes.size() * 2);
+            nodes.push_back(Node{Bounds(references.data(), references.data() + references.size()), 0, (uint32_t)boxes.size()});
+            parents.push_back(NONE);
+            std::vector<std::pair<uint32_t, uint32_t>> stack{{0, 0}}; // node and depth
+            while(!stack.empty())
+            {
+                auto [index, depth] = stack.back();
+                stack.pop_back();
+                Node node = nodes[index];
+                Reference* begin = references.data() + node.first;
+                uint32_t split = depth < MAX_DEPTH ? Split(begin, node, maxLeafSize) : 0;
+                if(!split)
+                    continue;
+                uint32_t left = nodes.size();
+                nodes.push_back(Node{Bounds(begin, begin + split), node.first, split});
+                nodes.push_back(Node{Bounds(begin + split, begin + node.count), node.first + split, node.count - split});
+                parents.push_back(index);
+                parents.push_back(index);
+                nodes[index].first = left;
+                nodes[index].count = 0;
+                stack.emplace_back(left, depth + 1);
+                stack.emplace_back(left + 1, depth + 1);
+            }
+            for(size_t i = 0; i < references.size(); i++)
+                primitives[i] = references[i].index;
+        }
+        inline bool empty() const
+        {
+            return nodes.empty();
+        }
+        // SAH weight, traversal steps and primitive tests are assumed to cost the same
+        static inline float Weight(const Node& node)
+        {
+            return node.count ? (float)node.count : 1.f;
+        }
+        // SAH cost of the tree times the root area
+        double WeightedArea() const
+        {
+            double sum = 0.0;
+            for(const Node& node : nodes)
+                sum += (double)node.bounds.area() * Weight(node);
+            return sum;
+        }
+    };
+
+    // Bounding volume hierarchy over the triangles of a mesh, in object space.
+    // Mesh buffers are write only, so it is built from a CPU copy of the positions like occluders are.
+    class MeshBvh
+    {
+    public:
+        struct Source
+        {
+            const glm::vec3* positions;
+            GLuint vertexCount;
+            const GLuint* elements = nullptr; // null for unindexed positions
+            GLuint elementCount = 0;
+        };
+        struct Hit
+        {
+            uint32_t triangle = BvhTree::NONE; // index in the element or position list divided by 3
+            float t = INFINITY;
+            glm::vec2 barycentrics = glm::vec2(0.f); // weights of the second and third vertex
+        };
+        static constexpr uint32_t MAX_LEAF_SIZE = 4;
+    private:
+        struct Triangle
+        {
+            glm::vec3 v0, edge1, edge2;
+            uint32_t index;
+        };
+        BvhTree _tree;
+        std::vector<Triangle> _triangles; // in leaf order
+    public:
+        MeshBvh() = default;
+        MeshBvh(const Source& source)
+        {
+            PROFILE_SCOPE("MeshBvh::Build");
+            GLuint triangleCount = (source.elements ? source.elementCount : source.vertexCount) / 3;
+            auto vertex = [&](uint32_t triangle, uint32_t corner)
+            {
+                uint32_t i = triangle * 3 + corner;
+                return source.positions[source.elements ? source.elements[i] : i];
+            };
+            std::vector<Aabb> boxes(triangleCount);
+            for(uint32_t t = 0; t < triangleCount; t++)
+                for(uint32_t corner = 0; corner < 3; corner++)
+                    boxes[t].Grow(vertex(t, corner));
+            _tree.Build(boxes, MAX_LEAF_SIZE);
+            _triangles.reserve(triangleCount);
+            for(uint32_t t : _tree.primitives)
+            {
+                glm::vec3 v0 = vertex(t, 0);
+                _triangles.push_back(Triangle{v0, vertex(t, 1) - v0, vertex(t, 2) - v0, t});
+            }
+        }
+        MeshBvh(const glm::vec3* positions, GLuint vertexCount, const GLuint* elements = nullptr, GLuint elementCount = 0) :
+            MeshBvh(Source{positions, vertexCount, elements, elementCount})
+        {}
+        // builds one tree per source on up to threadCount threads, largest meshes first, e.g. while loading a scene
+        static std::vector<MeshBvh> BuildParallel(const std::vector<Source>& sources, uint32_t threadCount = std::thread::hardware_concurrency())
+        {
+            std::vector<MeshBvh> bvhs(sources.size());
+            std::vector<size_t> order(sources.size());
+            std::iota(order.begin(), order.end(), (size_t)0);
+            auto triangles = [&](size_t i)
+            {
+                return sources[i].elements ? sources[i].elementCount : sources[i].vertexCount;
+            };
+            std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return triangles(a) > triangles(b); });
+            std::atomic<size_t> next{0};
+            auto build = [&]
+            {
+                for(size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < order.size();)
+                    bvhs[order[i]] = MeshBvh(sources[order[i]]);
+            };
+            std::vector<std::thread> workers;
+            for(size_t i = 1; i < std::min<size_t>(threadCount, sources.size()); i++)
+                workers.emplace_back(build);
+            build();
+            for(std::thread& worker : workers)
+                worker.join();
+            return bvhs;
+        }
+
+        // closest hit nearer than both ray.tMax and hit.t, which it updates, two sided
+        bool Intersect(const Ray& ray, Hit& hit) const
+        {
+            if(_tree.empty())
+                return false;
+            glm::vec3 inverseDirection = 1.f / ray.direction;
+            float tMax = std::min(ray.tMax, hit.t);
+            bool found = false;
+            uint32_t stack[BvhTree::STACK_SIZE];
+            uint32_t depth = 0;
+            if(IntersectBox(_tree.nodes[0].bounds, ray.origin, inverseDirection, tMax) != INFINITY)
+                stack[depth++] = 0;
+            while(depth)
+            {
+                const BvhTree::Node& node = _tree.nodes[stack[--depth]];
+                if(node.count)
+                {
+                    for(uint32_t i = node.first; i < node.first + node.count; i++)
+                    {
+                        // Moeller-Trumbore
+                        const Triangle& triangle = _triangles[i];
+                        glm::vec3 p = glm::cross(ray.direction, triangle.edge2);
+                        float determinant = glm::dot(triangle.edge1, p);
+                        if(determinant == 0.f)
+                            continue;
+                        float inverse = 1.f / determinant;
+                        glm::vec3 s = ray.origin - triangle.v0;
+                        float u = glm::dot(s, p) * inverse;
+                        if(u < 0.f || u > 1.f)
+                            continue;
+                        glm::vec3 q = glm::cross(s, triangle.edge1);
+                        float v = glm::dot(ray.direction, q) * inverse;
+                        if(v < 0.f || u + v > 1.f)
+                            continue;
+                        float t = glm::dot(triangle.edge2, q) * inverse;
+                        if(t < 0.f || t >= tMax)
+                            continue;
+                        tMax = t;
+                        hit = Hit{triangle.index, t, glm::vec2(u, v)};
+                        found = true;
+                    }
+                    continue;
+                }
+                // nearer child is popped first
+                float tLeft = IntersectBox(_tree.nodes[node.first].bounds, ray.origin, inverseDirection, tMax);
+                float tRight = IntersectBox(_tree.nodes[node.first + 1].bounds, ray.origin, inverseDirection, tMax);
+                uint32_t nearChild = tLeft <= tRight ? node.first : node.first + 1;
+                uint32_t farChild = tLeft <= tRight ? node.first + 1 : node.first;
+                if(std::max(tLeft, tRight) != INFINITY)
+                    stack[depth++] = farChild;
+                if(std::min(tLeft, tRight) != INFINITY)
+                    stack[depth++] = nearChild;
+            }
+            return found;
+        }
+
+        inline Aabb bounds() const
+        {
+            return _tree.empty() ? Aabb() : _tree.nodes[0].bounds;
+        }
+        inline size_t triangleCount() const
+        {
+            return _triangles.size();
+        }
+        inline size_t nodeCount() const
+        {
+            return _tree.nodes.size();
+        }
+    };
+
+    // Instance level hierarchy over world space boxes for culling, picking and spatial queries,
+    // the upper level of a two level structure whose instances may point to a MeshBvh each.
+    // Moved instances are refitted by Update(), only the boxes on the way to the root that change are touched.
+    // Refitting lets the tree degrade, once its SAH cost grew by rebuildThreshold or many instances were added
+    // or removed since the last build, Update() rebuilds it on a background thread from a snapshot
+    // and swaps it in at a later Update(), refitting what moved in between.
+    // New instances wait in a pending list that queries test one by one until the next rebuild,
+    // ids of removed instances are only reused once a rebuild no longer references them.
+    // Queries may run concurrently with each other, but not with changes or Update().
+    class SceneBvh
+    {
+    public:
+        using InstanceId = uint32_t;
+        static constexpr InstanceId NONE = BvhTree::NONE;
+        static constexpr uint32_t MAX_LEAF_SIZE = 4;
+        struct Hit
+        {
+            InstanceId instance = NONE;
+            uint32_t triangle = BvhTree::NONE; // NONE for instances without a MeshBvh, which are hit on their box
+            float t = INFINITY;
+            glm::vec2 barycentrics = glm::vec2(0.f);
+        };
+
+        float rebuildThreshold = 1.5f; // SAH cost growth through refits that triggers a rebuild
+        uint32_t maxPending = 1024;    // added or removed instances that trigger a rebuild
+    private:
+        struct Instance
+        {
+            Aabb local;
+            glm::mat4 inverse; // world to object space, only kept with a mesh
+            const MeshBvh* mesh;
+            bool alive;
+        };
+        std::vector<Aabb> _world; // by instance, traversal reads nothing else
+        std::vector<Instance> _instances;
+        std::vector<uint32_t> _leafOf; // leaf node of every instance in _tree, NONE while pending
+        std::vector<InstanceId> _pending, _moved;
+        std::vector<InstanceId> _free, _retired, _retiring; // retired ids are still in the tree
+        uint32_t _aliveCount = 0;
+        BvhTree _tree;
+        double _weightedArea = 0.0;
+        double _builtCost = 0.0;
+        uint32_t _rebuilds = 0;
+
+        // background rebuild, the build members belong to the worker while _building and not _buildDone
+        std::thread _worker;
+        std::mutex _mutex;
+        std::condition_variable _startCondition, _doneCondition;
+        bool _buildRequested = false, _quit = false, _building = false;
+        std::atomic<bool> _buildDone{false};
+        std::vector<Aabb> _buildBoxes;
+        std::vector<InstanceId> _buildIds, _movedDuringBuild;
+        BvhTree _builtTree;
+
+        static void BuildTree(BvhTree& tree, const std::vector<Aabb>& boxes, const std::vector<InstanceId>& ids)
+        {
+            PROFILE_SCOPE("SceneBvh::Build");
+            tree.Build(boxes, MAX_LEAF_SIZE);
+            for(uint32_t& primitive : tree.primitives)
+                primitive = ids[primitive];
+        }
+        void WorkerLoop()
+        {
+            std::unique_lock lock(_mutex);
+            while(true)
+            {
+                _startCondition.wait(lock, [&]{ return _buildRequested || _quit; });
+                if(_quit)
+                    return;
+                _buildRequested = false;
+                lock.unlock();
+                BuildTree(_builtTree, _buildBoxes, _buildIds);
+                lock.lock();
+                _buildDone.store(true, std::memory_order_release);
+                _doneCondition.notify_one();
+            }
+        }
+        void Snapshot(std::vector<Aabb>& boxes, std::vector<InstanceId>& ids)
+        {
+            boxes.clear();
+            ids.clear();
+            for(InstanceId id = 0; id < _instances.size(); id++)
+                if(_instances[id].alive)
+                {
+                    boxes.push_back(_world[id]);
+                    ids.push_back(id);
+                }
+            _retiring = std::move(_retired);
+            _retired.clear();
+            _movedDuringBuild.clear();
+        }
+        void Install(BvhTree&& tree)
+        {
+            _tree = std::move(tree);
+            _leafOf.assign(_instances.size(), NONE);
+            for(uint32_t index = 0; index < _tree.nodes.size(); index++)
+            {
+                const BvhTree::Node& node = _tree.nodes[index];
+                for(uint32_t i = node.first; i < node.first + node.count; i++)
+                    _leafOf[_tree.primitives[i]] = index;
+            }
+            std::erase_if(_pending, [&](InstanceId id) { return _leafOf[id] != NONE; });
+            _free.insert(_free.end(), _retiring.begin(), _retiring.end());
+            _retiring.clear();
+            _weightedArea = _tree.WeightedArea();
+            _builtCost = cost();
+            for(InstanceId id : _movedDuringBuild)
+                if(_leafOf[id] != NONE)
+                    Refit(_leafOf[id]);
+            _movedDuringBuild.clear();
+            _rebuilds++;
+        }
+        void WaitForBuild()
+        {
+            if(!_building)
+                return;
+            {
+                std::unique_lock lock(_mutex);
+                _doneCondition.wait(lock, [&]{ return _buildDone.load(std::memory_order_acquire); });
+            }
+            _building = false;
+            _buildDone.store(false, std::memory_order_relaxed);
+            Install(std::move(_builtTree));
+        }
+        void StartRebuild()
+        {
+            if(!_worker.joinable())
+                _worker = std::thread(&SceneBvh::WorkerLoop, this);
+            std::lock_guard lock(_mutex);
+            Snapshot(_buildBoxes, _buildIds);
+            _building = true;
+            _buildRequested = true;
+            _startCondition.notify_one();
+        }
+        // recomputes a leaf from its instances, then its ancestors until a box stays the same
+        void Refit(uint32_t index)
+        {
+            while(index != NONE)
+            {
+                BvhTree::Node& node = _tree.nodes[index];
+                Aabb bounds;
+                if(node.count)
+                    for(uint32_t i = node.first; i < node.first + node.count; i++)
+                        bounds.Grow(_world[_tree.primitives[i]]);
+                else
+                {
+                    bounds = _tree.nodes[node.first].bounds;
+                    bounds.Grow(_tree.nodes[node.first + 1].bounds);
+                }
+                if(bounds == node.bounds)
+                    return;
+                _weightedArea += ((double)bounds.area() - node.bounds.area()) * BvhTree::Weight(node);
+                node.bounds = bounds;
+                index = _tree.parents[index];
+            }
+        }
+        void Moved(InstanceId id)
+        {
+            if(_leafOf[id] != NONE)
+                _moved.push_back(id);
+            if(_building)
+                _movedDuringBuild.push_back(id);
+        }
+        bool Valid(InstanceId id) const
+        {
+            if(id < _instances.size() && _instances[id].alive)
+                return true;
+            std::fprintf(stderr, "Error: Invalid BVH instance %u!\n", id);
+            return false;
+        }
+
+        // the hit is kept if it is nearer than ray.tMax and hit.t
+        bool IntersectInstance(const Ray& ray, const glm::vec3& inverseDirection, Hit& hit, InstanceId id) const
+        {
+            const Instance& instance = _instances[id];
+            if(!instance.alive)
+                return false;
+            float tMax = std::min(ray.tMax, hit.t);
+            float tBox = IntersectBox(_world[id], ray.origin, inverseDirection, tMax);
+            if(tBox == INFINITY)
+                return false;
+            if(!instance.mesh)
+            {
+                hit = Hit{id, BvhTree::NONE, tBox, glm::vec2(0.f)};
+                return true;
+            }
+            // t is the same in object space as the direction is transformed along, not normalized
+            Ray local{glm::vec3(instance.inverse * glm::vec4(ray.origin, 1.f)), glm::vec3(instance.inverse * glm::vec4(ray.direction, 0.f)), tMax};
+            MeshBvh::Hit meshHit;
+            if(!instance.mesh->Intersect(local, meshHit))
+                return false;
+            hit = Hit{id, meshHit.triangle, meshHit.t, meshHit.barycentrics};
+            return true;
+        }
+        template<typename Test>
+        void Collect(const Test& test, std::vector<InstanceId>& out) const
+        {
+            std::vector<uint32_t> stack;
+            if(!_tree.empty())
+                stack.push_back(0);
+            while(!stack.empty())
+            {
+                uint32_t index = stack.back();
+                stack.pop_back();
+                const BvhTree::Node& node = _tree.nodes[index];
+                Overlap overlap = test(node.bounds);
+                if(overlap == Overlap::OUTSIDE)
+                    continue;
+                if(node.count)
+                {
+                    for(uint32_t i = node.first; i < node.first + node.count; i++)
+                    {
+                        InstanceId id = _tree.primitives[i];
+                        if(_instances[id].alive && (overlap == Overlap::INSIDE || test(_world[id]) != Overlap::OUTSIDE))
+                            out.push_back(id);
+                    }
+                }
+                else if(overlap == Overlap::INSIDE)
+                {
+                    // everything below is inside, collected without further tests
+                    std::vector<uint32_t> subtree{node.first, node.first + 1};
+                    while(!subtree.empty())
+                    {
+                        const BvhTree::Node& child = _tree.nodes[subtree.back()];
+                        subtree.pop_back();
+                        if(child.count)
+                        {
+                            for(uint32_t i = child.first; i < child.first + child.count; i++)
+                                if(_instances[_tree.primitives[i]].alive)
+                                    out.push_back(_tree.primitives[i]);
+                        }
+                        else
+                        {
+                            subtree.push_back(child.first);
+                            subtree.push_back(child.first + 1);
+                        }
+                    }
+                }
+                else
+                {
+                    stack.push_back(node.first);
+                    stack.push_back(node.first + 1);
+                }
+            }
+            for(InstanceId id : _pending)
+                if(_instances[id].alive && test(_world[id]) != Overlap::OUTSIDE)
+                    out.push_back(id);
+        }
+#if defined(__SSE2__)
+        // four rays traverse the tree together, a node is entered if any of them hits its box
+        void RaycastPacket(const Ray* rays, Hit* hits, uint32_t count) const
+        {
+            alignas(16) float originX[4], originY[4], originZ[4], inverseX[4], inverseY[4], inverseZ[4], tMax[4];
+            glm::vec3 inverseDirections[4];
+            for(uint32_t lane = 0; lane < 4; lane++)
+            {
+                const Ray& ray = rays[std::min(lane, count - 1)];
+                inverseDirections[lane] = 1.f / ray.direction;
+                originX[lane] = ray.origin.x;
+                originY[lane] = ray.origin.y;
+                originZ[lane] = ray.origin.z;
+                inverseX[lane] = inverseDirections[lane].x;
+                inverseY[lane] = inverseDirections[lane].y;
+                inverseZ[lane] = inverseDirections[lane].z;
+                tMax[lane] = lane < count ? ray.tMax : -1.f; // unused lanes never hit
+            }
+            const __m128 ox = _mm_load_ps(originX), oy = _mm_load_ps(originY), oz = _mm_load_ps(originZ);
+            const __m128 ix = _mm_load_ps(inverseX), iy = _mm_load_ps(inverseY), iz = _mm_load_ps(inverseZ);
+            const __m128 zero = _mm_setzero_ps();
+            __m128 far = _mm_load_ps(tMax);
+
+            uint32_t stack[BvhTree::STACK_SIZE];
+            uint32_t depth = 0;
+            stack[depth++] = 0;
+            while(depth)
+            {
+                const BvhTree::Node& node = _tree.nodes[stack[--depth]];
+                __m128 t0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bounds.min.x), ox), ix);
+                __m128 t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bounds.max.x), ox), ix);
+                __m128 tNear = _mm_max_ps(_mm_min_ps(t0, t1), zero);
+                __m128 tFar = _mm_min_ps(_mm_max_ps(t0, t1), far);
+                t0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bounds.min.y), oy), iy);
+                t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bounds.max.y), oy), iy);
+                tNear = _mm_max_ps(tNear, _mm_min_ps(t0, t1));
+                tFar = _mm_min_ps(tFar, _mm_max_ps(t0, t1));
+                t0 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bounds.min.z), oz), iz);
+                t1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.bounds.max.z), oz), iz);
+                tNear = _mm_max_ps(tNear, _mm_min_ps(t0, t1));
+                tFar = _mm_min_ps(tFar, _mm_max_ps(t0, t1));
+                int mask = _mm_movemask_ps(_mm_cmple_ps(tNear, tFar));
+                if(!mask)
+                    continue;
+                if(node.count)
+                {
+                    for(uint32_t i = node.first; i < node.first + node.count; i++)
+                        for(uint32_t lane = 0; lane < count; lane++)
+                            if(mask & (1 << lane))
+                                IntersectInstance(rays[lane], inverseDirections[lane], hits[lane], _tree.primitives[i]);
+                    for(uint32_t lane = 0; lane < count; lane++)
+                        tMax[lane] = std::min(rays[lane].tMax, hits[lane].t);
+                    far = _mm_load_ps(tMax);
+                }
+                else
+                {
+                    stack[depth++] = node.first + 1;
+                    stack[depth++] = node.first;
+                }
+            }
+        }
+#endif
+    public:
+        SceneBvh() = default;
+        SceneBvh(const SceneBvh&) = delete;
+        SceneBvh& operator=(const SceneBvh&) = delete;
+        ~SceneBvh()
+        {
+            if(!_worker.joinable())
+                return;
+            {
+                std::lock_guard lock(_mutex);
+                _quit = true;
+            }
+            _startCondition.notify_all();
+            _worker.join();
+        }
+
+        // local is the object space box, e.g. Mesh::boundsMin and boundsMax
+        InstanceId Add(const Aabb& local, const glm::mat4& model, const MeshBvh* mesh = nullptr)
+        {
+            InstanceId id;
+            if(_free.empty())
+            {
+                id = _instances.size();
+                _instances.emplace_back();
+                _world.emplace_back();
+                _leafOf.push_back(NONE);
+            }
+            else
+            {
+                id = _free.back();
+                _free.pop_back();
+            }
+            _instances[id] = Instance{local, glm::mat4(1.f), mesh, true};
+            _world[id] = local.Transformed(model);
+            if(mesh)
+                _instances[id].inverse = glm::inverse(model);
+            _leafOf[id] = NONE;
+            _pending.push_back(id);
+            _aliveCount++;
+            return id;
+        }
+        // the mesh is referenced, not copied, and has to outlive the instance
+        InstanceId Add(const MeshBvh& mesh, const glm::mat4& model)
+        {
+            return Add(mesh.bounds(), model, &mesh);
+        }
+        void Remove(InstanceId id)
+        {
+            if(!Valid(id))
+                return;
+            _instances[id].alive = false;
+            _world[id] = Aabb();
+            Moved(id);
+            if(_leafOf[id] == NONE)
+                std::erase(_pending, id);
+            _retired.push_back(id);
+            _aliveCount--;
+        }
+        // takes effect in queries after the next Update()
+        void SetTransform(InstanceId id, const glm::mat4& model)
+        {
+            if(!Valid(id))
+                return;
+            Instance& instance = _instances[id];
+            _world[id] = instance.local.Transformed(model);
+            if(instance.mesh)
+                instance.inverse = glm::inverse(model);
+            Moved(id);
+        }
+
+        // call once per frame after moving instances and before querying
+        void Update()
+        {
+            PROFILE_SCOPE("SceneBvh::Update");
+            if(_building && _buildDone.load(std::memory_order_acquire))
+                WaitForBuild();
+            for(InstanceId id : _moved)
+                if(_leafOf[id] != NONE)
+                    Refit(_leafOf[id]);
+            _moved.clear();
+            if(_building)
+                return;
+            if(_pending.size() > maxPending || _retired.size() > maxPending ||
+               (!_tree.empty() && cost() > _builtCost * rebuildThreshold))
+                StartRebuild();
+        }
+        // builds the tree on the calling thread, e.g. after adding a whole scene
+        void Rebuild()
+        {
+            PROFILE_SCOPE("SceneBvh::Rebuild");
+            WaitForBuild();
+            std::vector<Aabb> boxes;
+            std::vector<InstanceId> ids;
+            Snapshot(boxes, ids);
+            _moved.clear();
+            BvhTree tree;
+            BuildTree(tree, boxes, ids);
+            Install(std::move(tree));
+        }
+
+        // instances whose box is at least partially inside, appended to out
+        void Query(const Frustum& frustum, std::vector<InstanceId>& out) const
+        {
+            Collect([&](const Aabb& box) { return frustum.Test(box); }, out);
+        }
+        void Query(const Aabb& region, std::vector<InstanceId>& out) const
+        {
+            Collect([&](const Aabb& box)
+            {
+                bool inside = true;
+                for(int axis = 0; axis < 3; axis++)
+                {
+                    if(box.min[axis] > region.max[axis] || box.max[axis] < region.min[axis])
+                        return Overlap::OUTSIDE;
+                    inside = inside && box.min[axis] >= region.min[axis] && box.max[axis] <= region.max[axis];
+                }
+                return inside ? Overlap::INSIDE : Overlap::PARTIAL;
+            }, out);
+        }
+        void Query(const glm::vec3& center, float radius, std::vector<InstanceId>& out) const
+        {
+            Collect([&](const Aabb& box)
+            {
+                if(box.empty())
+                    return Overlap::OUTSIDE;
+                glm::vec3 nearest = glm::clamp(center, box.min, box.max) - center;
+                if(glm::dot(nearest, nearest) > radius * radius)
+                    return Overlap::OUTSIDE;
+                glm::vec3 farthest = glm::max(glm::abs(box.min - center), glm::abs(box.max - center));
+                return glm::dot(farthest, farthest) <= radius * radius ? Overlap::INSIDE : Overlap::PARTIAL;
+            }, out);
+        }
+        // closest instance along the ray, into the triangles of instances with a MeshBvh
+        bool Raycast(const Ray& ray, Hit& hit) const
+        {
+            hit = Hit();
+            glm::vec3 inverseDirection = 1.f / ray.direction;
+            uint32_t stack[BvhTree::STACK_SIZE];
+            uint32_t depth = 0;
+            if(!_tree.empty() && IntersectBox(_tree.nodes[0].bounds, ray.origin, inverseDirection, ray.tMax) != INFINITY)
+                stack[depth++] = 0;
+            while(depth)
+            {
+                const BvhTree::Node& node = _tree.nodes[stack[--depth]];
+                if(node.count)
+                {
+                    for(uint32_t i = node.first; i < node.first + node.count; i++)
+                        IntersectInstance(ray, inverseDirection, hit, _tree.primitives[i]);
+                    continue;
+                }
+                float tMax = std::min(ray.tMax, hit.t);
+                float tLeft = IntersectBox(_tree.nodes[node.first].bounds, ray.origin, inverseDirection, tMax);
+                float tRight = IntersectBox(_tree.nodes[node.first + 1].bounds, ray.origin, inverseDirection, tMax);
+                uint32_t nearChild = tLeft <= tRight ? node.first : node.first + 1;
+                uint32_t farChild = tLeft <= tRight ? node.first + 1 : node.first;
+                if(std::max(tLeft, tRight) != INFINITY)
+                    stack[depth++] = farChild;
+                if(std::min(tLeft, tRight) != INFINITY)
+                    stack[depth++] = nearChild;
+            }
+            for(InstanceId id : _pending)
+                IntersectInstance(ray, inverseDirection, hit, id);
+            return hit.instance != NONE;
+        }
+        // Casts count rays, in packets of four with SSE2. Packets pay off for coherent rays,
+        // e.g. neighbouring pixels or a selection rectangle, as the packet enters a node if any of its rays does.
+        void Raycast(const Ray* rays, Hit* hits, size_t count) const
+        {
+#if defined(__SSE2__)
+            if(_tree.empty())
+            {
+                for(size_t i = 0; i < count; i++)
+                    Raycast(rays[i], hits[i]);
+                return;
+            }
+            for(size_t i = 0; i < count; i += 4)
+            {
+                uint32_t packet = std::min<size_t>(count - i, 4);
+                for(uint32_t lane = 0; lane < packet; lane++)
+                    hits[i + lane] = Hit();
+                RaycastPacket(rays + i, hits + i, packet);
+                for(uint32_t lane = 0; lane < packet; lane++)
+                {
+                    glm::vec3 inverseDirection = 1.f / rays[i + lane].direction;
+                    for(InstanceId id : _pending)
+                        IntersectInstance(rays[i + lane], inverseDirection, hits[i + lane], id);
+                }
+            }
+#else
+            for(size_t i = 0; i < count; i++)
+                Raycast(rays[i], hits[i]);
+#endif
+        }
+
+        inline size_t count() const
+        {
+            return _aliveCount;
+        }
+        inline size_t pendingCount() const
+        {
+            return _pending.size();
+        }
+        inline bool building() const
+        {
+            return _building;
+        }
+        inline uint32_t rebuilds() const
+        {
+            return _rebuilds;
+        }
+        // SAH cost relative to the root box, grows as refits loosen the tree
+        inline double cost() const
+        {
+            if(_tree.empty())
+                return 0.0;
+            float rootArea = _tree.nodes[0].bounds.area();
+            return rootArea > 0.f ? _weightedArea / rootArea : 0.0;
+        }
+        inline const Aabb& bounds(InstanceId id) const
+        {
+            return _world[id];
+        }
+    };
+}
\ No newline at end of file
@@ -16,6 +16,7 @@ namespace render
             glm::mat4 view;
             glm::mat4 projection;
             glm::uvec2 resolution;
+            float lod_bias; // added to material texture LODs, e.g. by DynamicResolution
         };
         TypedSharedBuffer<CameraUniformData> _cameraBuffer{1};
     public:
@@ -37,8 +38,16 @@ namespace render
             };
         };
         glm::uvec2 &resolution; // ref to resolution in CameraUniformData
+        float &lodBias;         // ref to lod_bias in CameraUniformData
+        // how ForwardPass::Run(camera, draw) shades what the camera sees
+        enum class Shading : uint8_t
+        {
+            FORWARD,
+            VISIBILITY_BUFFER // needs ForwardPass::visibilityBuffer, see VisibilityBuffer
+        } shading = Shading::FORWARD;
     private:
         glm::mat4 &_projection;
+        glm::vec2 _jitter = glm::vec2(0.f);
         bool _projectionDirty = true;
         enum CameraType : uint8_t
         {
@@ -51,8 +60,12 @@ namespace render
             transform(_cameraBuffer, &_cameraBuffer[0].inverse_view, &_cameraBuffer[0].view),
             fov(60.f), 
             resolution(_cameraBuffer[0].resolution),
+            lodBias(_cameraBuffer[0].lod_bias),
             _projection(_cameraBuffer[0].projection)
-        {}
+        {
+            _cameraBuffer.Label(GpuMemoryCategory::UNIFORM, "Camera");
+            lodBias = 0.f;
+        }
         Camera(const Camera&) = delete;
         Camera(Camera&&) = delete;
         Camera& operator=(const Camera&) = delete;
@@ -108,6 +121,19 @@ namespace render
             _projectionDirty = false;
         }
 
+        // subpixel offset in NDC units applied to perspective and orthographic projections, for temporal filters
+        void setJitter(glm::vec2 jitter)
+        {
+            if (jitter == _jitter)
+                return;
+            _jitter = jitter;
+            _projectionDirty = cameraType != Custom;
+        }
+        glm::vec2 jitter() const
+        {
+            return _jitter;
+        }
+
         void setFarNear(float nearP, float farP)
         {
             if (nearP == nearPlane && farP == farPlane)
@@ -136,6 +162,12 @@ namespace render
                 }
                 // else Custom: do nothing, user sets projection manually
 
+                if(cameraType != Custom) // shifts clip space x and y by jitter * w
+                    for(int column = 0; column < 4; column++)
+                    {
+                        _projection[column][0] += _jitter.x * _projection[column][3];
+                        _projection[column][1] += _jitter.y * _projection[column][3];
+                    }
                 _projectionDirty = false;
             }
             return _projection;
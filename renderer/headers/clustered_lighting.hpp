@@ -0,0 +1,479 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "OpenGL_utils/buffer.hpp"
+#include "OpenGL_utils/profiler.hpp"
+#include "builtin_shader.hpp"
+#include "camera.hpp"
+
+namespace render
+{
+    // Clustered forward lighting for many point and spot lights.
+    // The camera frustum is split into a grid of screen tiles times exponential depth slices,
+    // every Update lights are assigned to the clusters their bounding sphere touches on the CPU
+    // and brdf.frag.glsl only loops over the lights of the fragment's cluster,
+    // so shading cost follows the lights per cluster instead of the total light count.
+    // Depth slices are distributed over worker threads, each thread owns whole slices
+    // and writes them straight into the mapped index buffer.
+    // The mapped buffers are kept FRAME_SLOTS times, each Update writes the next set once a fence shows
+    // the GPU is done with the frame that last read it, so shading never sees a half written frame.
+    class ClusteredLighting
+    {
+    public:
+        static constexpr uint32_t FRAME_SLOTS = 3;
+        struct Light
+        {
+            glm::vec3 position = glm::vec3(0.f);
+            float range = 1.f;           // no influence beyond this distance
+            glm::vec3 color = glm::vec3(1.f);
+            float spotOuterAngle = 0.f;  // cone half angle in degrees, 0 makes a point light
+            glm::vec3 direction = glm::vec3(0.f, 0.f, -1.f);
+            float spotInnerAngle = 0.f;  // full intensity inside, fades out towards the outer angle
+        };
+    private:
+        struct LightData // std430, view space
+        {
+            glm::vec3 view_position;
+            float range;
+            glm::vec3 color;
+            float spotCosOuter; // below -1 for point lights
+            glm::vec3 view_direction;
+            float spotCosInner;
+        };
+        struct ClusterData // std430
+        {
+            GLuint offset; // first entry in the light index buffer
+            GLuint count;
+        };
+        // conservative view space bounds used for assignment, split by component for the SIMD loops
+        struct LightBounds
+        {
+            std::vector<float> x, y, z, radius;
+            std::vector<int32_t> firstSlice, lastSlice;
+            std::vector<uint32_t> firstTile; // x | y << 16
+            std::vector<uint32_t> lastTile;
+        };
+        struct Scratch
+        {
+            std::vector<uint32_t> candidates;
+            std::vector<std::vector<uint32_t>> tileLights; // one list per tile of the slice
+        };
+
+        struct FrameStorage
+        {
+            TypedSharedBuffer<LightData> lights;
+            TypedSharedBuffer<ClusterData> clusters;
+            TypedSharedBuffer<GLuint> indices;
+            GLsync fence = nullptr; // after the draws of the last frame using this storage
+        };
+
+        glm::uvec3 _grid;
+        FrameStorage _frames[FRAME_SLOTS];
+        uint32_t _frame = 0; // storage written by the last Update and bound by Use
+
+        // view space cluster bounds, padded by 4 so SIMD loads past a row end stay in bounds
+        std::vector<float> _minX, _minY, _minZ, _maxX, _maxY, _maxZ;
+        glm::mat4 _boundsProjection{0.f};
+        float _near = 0.f, _far = 0.f;
+        float _sliceScale = 0.f, _sliceBias = 0.f;
+
+        LightBounds _bounds;
+        uint32_t _activeLights = 0;
+        std::vector<Scratch> _scratch; // one per worker, the last one is used by the calling thread
+
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _startCondition, _doneCondition;
+        uint64_t _generation = 0;
+        uint32_t _busyWorkers = 0;
+        bool _quit = false;
+        std::atomic<uint32_t> _nextSlice{0};
+        std::atomic<uint32_t> _indexCount{0};
+        std::atomic<bool> _overflow{false};
+
+        inline uint32_t ClusterIndex(uint32_t x, uint32_t y, uint32_t z) const
+        {
+            return x + _grid.x * (y + _grid.y * z);
+        }
+        int32_t Slice(float depth) const
+        {
+            if(depth <= _near)
+                return 0;
+            int32_t slice = (int32_t)(std::log(depth) * _sliceScale + _sliceBias);
+            return slice < (int32_t)_grid.z ? slice : (int32_t)_grid.z - 1;
+        }
+        // cluster AABBs only change with the projection
+        void UpdateClusterBounds(const glm::mat4& projection, float nearPlane, float farPlane)
+        {
+            if(projection == _boundsProjection && nearPlane == _near && farPlane == _far)
+                return;
+            _boundsProjection = projection;
+            _near = nearPlane;
+            _far = farPlane;
+            float logRatio = std::log(farPlane / nearPlane);
+            _sliceScale = _grid.z / logRatio;
+            _sliceBias = -(_grid.z * std::log(nearPlane)) / logRatio;
+
+            glm::mat4 inverseProjection = glm::inverse(projection);
+            auto unproject = [&](float x, float y, float z)
+            {
+                glm::vec4 p = inverseProjection * glm::vec4(x, y, z, 1.f);
+                return glm::vec3(p) / p.w;
+            };
+            for(uint32_t z = 0; z < _grid.z; z++)
+            {
+                float sliceNear = nearPlane * std::pow(farPlane / nearPlane, (float)z / _grid.z);
+                float sliceFar = nearPlane * std::pow(farPlane / nearPlane, (float)(z + 1) / _grid.z);
+                for(uint32_t y = 0; y < _grid.y; y++)
+                    for(uint32_t x = 0; x < _grid.x; x++)
+                    {
+                        glm::vec3 lo(INFINITY), hi(-INFINITY);
+                        for(uint32_t corner = 0; corner < 4; corner++)
+                        {
+                            float ndcX = (float)(x + (corner & 1)) / _grid.x * 2.f - 1.f;
+                            float ndcY = (float)(y + (corner >> 1)) / _grid.y * 2.f - 1.f;
+                            // corner ray between the near and far planes, cut at the slice depths
+                            glm::vec3 a = unproject(ndcX, ndcY, -1.f);
+                            glm::vec3 b = unproject(ndcX, ndcY, 1.f);
+                            for(float depth : {sliceNear, sliceFar})
+                            {
+                                glm::vec3 p = a + (b - a) * ((-depth - a.z) / (b.z - a.z));
+                                lo = glm::min(lo, p);
+                                hi = glm::max(hi, p);
+                            }
+                        }
+                        uint32_t i = ClusterIndex(x, y, z);
+                        _minX[i] = lo.x; _minY[i] = lo.y; _minZ[i] = lo.z;
+                        _maxX[i] = hi.x; _maxY[i] = hi.y; _maxZ[i] = hi.z;
+                    }
+            }
+        }
+        // fills _bounds and the GPU light buffer, returns the number of lights written
+        uint32_t PrepareLights(const std::vector<Light>& lights, const glm::mat4& view, const glm::mat4& projection)
+        {
+            TypedSharedBuffer<LightData>& lightBuffer = _frames[_frame].lights;
+            uint32_t count = (uint32_t)std::min<size_t>(lights.size(), lightBuffer.count());
+            if(count < lights.size())
+                std::fprintf(stderr, "Error: %zu lights exceed the clustered light capacity of %u, extra lights are ignored!\n",
+                    lights.size(), lightBuffer.count());
+            for(std::vector<float>* v : {&_bounds.x, &_bounds.y, &_bounds.z, &_bounds.radius})
+                v->resize(count + 4);
+            for(std::vector<int32_t>* v : {&_bounds.firstSlice, &_bounds.lastSlice})
+                v->assign(count + 4, -1); // padding never matches a slice
+            _bounds.firstTile.resize(count);
+            _bounds.lastTile.resize(count);
+
+            for(uint32_t i = 0; i < count; i++)
+            {
+                const Light& light = lights[i];
+                LightData& data = lightBuffer[i];
+                glm::vec3 viewPos = glm::vec3(view * glm::vec4(light.position, 1.f));
+                data.view_position = viewPos;
+                data.range = light.range;
+                data.color = light.color;
+                if(light.spotOuterAngle > 0.f)
+                {
+                    data.view_direction = glm::normalize(glm::vec3(view * glm::vec4(light.direction, 0.f)));
+                    data.spotCosOuter = std::cos(glm::radians(light.spotOuterAngle));
+                    // kept above the outer cosine, smoothstep is undefined for equal edges
+                    data.spotCosInner = std::max(std::cos(glm::radians(light.spotInnerAngle)), data.spotCosOuter + 1e-4f);
+                }
+                else
+                {
+                    data.view_direction = glm::vec3(0.f, 0.f, -1.f);
+                    data.spotCosOuter = -2.f;
+                    data.spotCosInner = -1.f;
+                }
+
+                // spot lights use the sphere of their range, which is conservative for narrow cones
+                _bounds.x[i] = viewPos.x;
+                _bounds.y[i] = viewPos.y;
+                _bounds.z[i] = viewPos.z;
+                _bounds.radius[i] = light.range;
+                float minDepth = -viewPos.z - light.range;
+                float maxDepth = -viewPos.z + light.range;
+                if(maxDepth < _near || minDepth > _far)
+                    continue;
+                _bounds.firstSlice[i] = Slice(minDepth);
+                _bounds.lastSlice[i] = Slice(maxDepth);
+
+                // screen rect of the light's box, depth clamped in front of the near plane
+                minDepth = std::max(minDepth, _near);
+                maxDepth = std::min(maxDepth, _far);
+                glm::vec2 lo(INFINITY), hi(-INFINITY);
+                for(uint32_t corner = 0; corner < 8; corner++)
+                {
+                    glm::vec4 p(viewPos.x + (corner & 1 ? light.range : -light.range),
+                                viewPos.y + (corner & 2 ? light.range : -light.range),
+                                corner & 4 ? -maxDepth : -minDepth, 1.f);
+                    glm::vec4 clip = projection * p;
+                    glm::vec2 ndc = glm::vec2(clip) / clip.w;
+                    lo = glm::min(lo, ndc);
+                    hi = glm::max(hi, ndc);
+                }
+                auto tile = [](float ndc, uint32_t tiles)
+                {
+                    float t = std::floor((ndc * 0.5f + 0.5f) * tiles);
+                    return (uint32_t)std::clamp(t, 0.f, (float)tiles - 1.f);
+                };
+                if(hi.x < -1.f || lo.x > 1.f || hi.y < -1.f || lo.y > 1.f)
+                {
+                    _bounds.firstSlice[i] = _bounds.lastSlice[i] = -1;
+                    continue;
+                }
+                _bounds.firstTile[i] = tile(lo.x, _grid.x) | tile(lo.y, _grid.y) << 16;
+                _bounds.lastTile[i] = tile(hi.x, _grid.x) | tile(hi.y, _grid.y) << 16;
+            }
+            return count;
+        }
+        void CollectCandidates(int32_t slice, std::vector<uint32_t>& candidates) const
+        {
+            candidates.clear();
+            const int32_t* first = _bounds.firstSlice.data();
+            const int32_t* last = _bounds.lastSlice.data();
+            uint32_t i = 0;
+#if defined(__SSE2__)
+            __m128i s = _mm_set1_epi32(slice);
+            for(; i + 4 <= _activeLights; i += 4)
+            {
+                __m128i f = _mm_loadu_si128((const __m128i*)(first + i));
+                __m128i l = _mm_loadu_si128((const __m128i*)(last + i));
+                // first <= slice && slice <= last, skipped lights have last = -1
+                __m128i outside = _mm_or_si128(_mm_cmpgt_epi32(f, s), _mm_cmpgt_epi32(s, l));
+                int mask = ~_mm_movemask_ps(_mm_castsi128_ps(outside)) & 0xF;
+                while(mask)
+                {
+                    int bit = __builtin_ctz(mask);
+                    candidates.push_back(i + bit);
+                    mask &= mask - 1;
+                }
+            }
+#endif
+            for(; i < _activeLights; i++)
+                if(first[i] <= slice && slice <= last[i])
+                    candidates.push_back(i);
+        }
+        // bit n set when the light sphere touches cluster first + n, for n < 4
+        int SphereTestClusters(uint32_t first, float x, float y, float z, float radius) const
+        {
+#if defined(__SSE2__)
+            const __m128 zero = _mm_setzero_ps();
+            auto axis = [&](const float* lo, const float* hi, float c)
+            {
+                __m128 center = _mm_set1_ps(c);
+                __m128 below = _mm_max_ps(_mm_sub_ps(_mm_loadu_ps(lo + first), center), zero);
+                __m128 above = _mm_max_ps(_mm_sub_ps(center, _mm_loadu_ps(hi + first)), zero);
+                __m128 d = _mm_add_ps(below, above);
+                return _mm_mul_ps(d, d);
+            };
+            __m128 dist2 = _mm_add_ps(_mm_add_ps(axis(_minX.data(), _maxX.data(), x), axis(_minY.data(), _maxY.data(), y)),
+                                      axis(_minZ.data(), _maxZ.data(), z));
+            return _mm_movemask_ps(_mm_cmple_ps(dist2, _mm_set1_ps(radius * radius)));
+#else
+            int mask = 0;
+            for(uint32_t n = 0; n < 4; n++)
+            {
+                uint32_t c = first + n;
+                float dx = std::max(_minX[c] - x, 0.f) + std::max(x - _maxX[c], 0.f);
+                float dy = std::max(_minY[c] - y, 0.f) + std::max(y - _maxY[c], 0.f);
+                float dz = std::max(_minZ[c] - z, 0.f) + std::max(z - _maxZ[c], 0.f);
+                if(dx * dx + dy * dy + dz * dz <= radius * radius)
+                    mask |= 1 << n;
+            }
+            return mask;
+#endif
+        }
+        void AssignSlice(int32_t slice, Scratch& scratch)
+        {
+            CollectCandidates(slice, scratch.candidates);
+            for(uint32_t light : scratch.candidates)
+            {
+                uint32_t x0 = _bounds.firstTile[light] & 0xFFFF, y0 = _bounds.firstTile[light] >> 16;
+                uint32_t x1 = _bounds.lastTile[light] & 0xFFFF, y1 = _bounds.lastTile[light] >> 16;
+                for(uint32_t y = y0; y <= y1; y++)
+                {
+                    uint32_t row = ClusterIndex(0, y, slice);
+                    for(uint32_t x = x0; x <= x1; x += 4)
+                    {
+                        int mask = SphereTestClusters(row + x, _bounds.x[light], _bounds.y[light], _bounds.z[light], _bounds.radius[light]);
+                        if(x1 - x < 3)
+                            mask &= (1 << (x1 - x + 1)) - 1;
+                        while(mask)
+                        {
+                            int bit = __builtin_ctz(mask);
+                            scratch.tileLights[y * _grid.x + x + bit].push_back(light);
+                            mask &= mask - 1;
+                        }
+                    }
+                }
+            }
+
+            uint32_t total = 0;
+            for(const std::vector<uint32_t>& tile : scratch.tileLights)
+                total += tile.size();
+            uint32_t offset = total ? _indexCount.fetch_add(total, std::memory_order_relaxed) : 0;
+            FrameStorage& frame = _frames[_frame];
+            uint32_t capacity = frame.indices.count();
+            ClusterData* clusters = frame.clusters.data() + ClusterIndex(0, 0, slice);
+            for(uint32_t tile = 0; tile < _grid.x * _grid.y; tile++)
+            {
+                std::vector<uint32_t>& lights = scratch.tileLights[tile];
+                uint32_t count = lights.size();
+                if(offset + count > capacity)
+                {
+                    count = offset < capacity ? capacity - offset : 0;
+                    _overflow.store(true, std::memory_order_relaxed);
+                }
+                clusters[tile] = ClusterData{count ? offset : 0, count};
+                if(count)
+                    std::memcpy(frame.indices.data() + offset, lights.data(), count * sizeof(GLuint));
+                offset += lights.size();
+                lights.clear();
+            }
+        }
+        void AssignSlices(Scratch& scratch)
+        {
+            PROFILE_SCOPE("ClusteredLighting::AssignSlices");
+            for(uint32_t slice; (slice = _nextSlice.fetch_add(1, std::memory_order_relaxed)) < _grid.z;)
+                AssignSlice(slice, scratch);
+        }
+        void WorkerLoop(uint32_t worker)
+        {
+            uint64_t seen = 0;
+            while(true)
+            {
+                {
+                    std::unique_lock lock(_mutex);
+                    _startCondition.wait(lock, [&]{ return _quit || _generation != seen; });
+                    if(_quit)
+                        return;
+                    seen = _generation;
+                }
+                AssignSlices(_scratch[worker]);
+                std::lock_guard lock(_mutex);
+                if(--_busyWorkers == 0)
+                    _doneCondition.notify_one();
+            }
+        }
+    public:
+        std::vector<Light> lights;
+
+        // grid is tiles along x and y times depth slices,
+        // indexCapacity bounds the total light references over all clusters
+        ClusteredLighting(uint32_t lightCapacity = 4096, glm::uvec3 grid = glm::uvec3(16, 9, 24),
+                          uint32_t indexCapacity = 1u << 20, uint32_t threadCount = std::thread::hardware_concurrency()) :
+            _grid(grid)
+        {
+            uint32_t clusterCount = grid.x * grid.y * grid.z;
+            for(std::vector<float>* v : {&_minX, &_minY, &_minZ, &_maxX, &_maxY, &_maxZ})
+                v->assign(clusterCount + 4, 0.f);
+            for(FrameStorage& frame : _frames)
+            {
+                frame.lights = TypedSharedBuffer<LightData>(lightCapacity);
+                frame.clusters = TypedSharedBuffer<ClusterData>(clusterCount);
+                frame.indices = TypedSharedBuffer<GLuint>(indexCapacity);
+                std::memset(frame.clusters.data(), 0, clusterCount * sizeof(ClusterData));
+                frame.lights.Label(GpuMemoryCategory::STORAGE, "Cluster lights");
+                frame.clusters.Label(GpuMemoryCategory::STORAGE, "Clusters");
+                frame.indices.Label(GpuMemoryCategory::STORAGE, "Cluster light indices");
+            }
+
+            uint32_t workerCount = std::min(threadCount, grid.z) > 1 ? std::min(threadCount, grid.z) - 1 : 0;
+            _scratch.resize(workerCount + 1);
+            for(Scratch& scratch : _scratch)
+                scratch.tileLights.resize(grid.x * grid.y);
+            for(uint32_t i = 0; i < workerCount; i++)
+                _workers.emplace_back(&ClusteredLighting::WorkerLoop, this, i);
+        }
+        ClusteredLighting(const ClusteredLighting&) = delete;
+        ClusteredLighting& operator=(const ClusteredLighting&) = delete;
+        ~ClusteredLighting()
+        {
+            {
+                std::lock_guard lock(_mutex);
+                _quit = true;
+            }
+            _startCondition.notify_all();
+            for(std::thread& worker : _workers)
+                worker.join();
+            for(FrameStorage& frame : _frames)
+                if(frame.fence)
+                    glDeleteSync(frame.fence);
+        }
+
+        // Reassigns all lights for the camera's current view and projection, binds the storage they were
+        // written to and enables the clustered loop in the lighting UBO.
+        // Call it once per frame before issuing the frame's draws, it fences the draws issued since the last call.
+        void Update(Camera& camera, FragmentShaderBRDF::Lighting& lighting)
+        {
+            _frames[_frame].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            _frame = (_frame + 1) % FRAME_SLOTS;
+            if(FrameStorage& frame = _frames[_frame]; frame.fence)
+            {
+                // the flush bit makes sure the fence gets submitted and can signal at all
+                glClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, ~GLuint64(0));
+                glDeleteSync(frame.fence);
+                frame.fence = nullptr;
+            }
+
+            const glm::mat4& projection = camera.projection();
+            UpdateClusterBounds(projection, camera.nearPlane, camera.farPlane);
+            _activeLights = PrepareLights(lights, camera.view(), projection);
+
+            _nextSlice.store(0, std::memory_order_relaxed);
+            _indexCount.store(0, std::memory_order_relaxed);
+            _overflow.store(false, std::memory_order_relaxed);
+            if(!_workers.empty())
+            {
+                std::lock_guard lock(_mutex);
+                _busyWorkers = _workers.size();
+                _generation++;
+            }
+            _startCondition.notify_all();
+            AssignSlices(_scratch.back());
+            if(!_workers.empty())
+            {
+                std::unique_lock lock(_mutex);
+                _doneCondition.wait(lock, [&]{ return _busyWorkers == 0; });
+            }
+            if(_overflow.load(std::memory_order_relaxed))
+                std::fprintf(stderr, "Error: Clustered light indices exceed the capacity of %u, some lights are dropped!\n",
+                    _frames[_frame].indices.count());
+
+            lighting.uniformData.clusterGrid = _grid;
+            lighting.uniformData.clusterSliceScale = _sliceScale;
+            lighting.uniformData.clusterSliceBias = _sliceBias;
+            Use();
+        }
+        // light references written by the last Update, including dropped ones
+        inline uint32_t indexCount() const
+        {
+            return _indexCount.load(std::memory_order_relaxed);
+        }
+        inline const glm::uvec3& grid() const
+        {
+            return _grid;
+        }
+        void Use() const
+        {
+            const FrameStorage& frame = _frames[_frame];
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLUSTER_LIGHTS_BINDING_POINT, frame.lights);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLUSTERS_BINDING_POINT, frame.clusters);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLUSTER_LIGHT_INDICES_BINDING_POINT, frame.indices);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,276 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include "OpenGL_utils/gpu_timer.hpp"
+#include "OpenGL_utils/profiler.hpp"
+#include "OpenGL_utils/render_target.hpp"
+#include "OpenGL_utils/shader.hpp"
+#include "OpenGL_utils/vao.hpp"
+#include "builtin_shader.hpp"
+#include "camera.hpp"
+
+namespace render
+{
+    // Keeps the GPU time of a frame near targetMilliseconds by scaling the resolution it is rendered at.
+    // Begin() redirects rendering into an offscreen target of camera.resolution * scale() and End() upscales it
+    // to the output, bilinearly or with a temporal filter accumulating jittered frames.
+    // The work between Begin() and End() is timed with timestamps, so the passes inside keep their own GpuTimers.
+    // The scale only moves when the time leaves the band between scaleUpBelow and scaleDownAbove of the target,
+    // by the square root of the missing time ratio as the cost grows with the pixel count, and rests for
+    // cooldownFrames after each change, which also lets the measurements in flight at the old scale drain.
+    // Scales are quantized to scaleStep, since every change reallocates the offscreen target.
+    // The passes between Begin() and End() render with the camera Begin() returns, which has its own uniform buffer
+    // with the render resolution, the jittered projection and a lodBias of log2(scale()), so material textures
+    // stay as sharp as at the output resolution. The caller's camera is never modified, its buffer may be in use.
+    // Passes rendering at their own resolution, like ShadowMaps::Render, have to run before Begin().
+    class DynamicResolution
+    {
+    public:
+        enum Upscale : uint8_t
+        {
+            BILINEAR,
+            TEMPORAL // jitters the camera projection, needs a depth attachment to reproject the history
+        };
+        enum TextureUnit : GLuint
+        {
+            COLOR_UNIT = 8,
+            DEPTH_UNIT,
+            HISTORY_UNIT
+        };
+        float targetMilliseconds = 1000.f / 60.f;
+        float minScale = 0.5f, maxScale = 1.f;
+        float scaleDownAbove = 1.f, scaleUpBelow = 0.85f; // fractions of targetMilliseconds
+        float scaleStep = 1.f / 16.f;
+        uint32_t cooldownFrames = 8;
+        Upscale upscale = BILINEAR;
+        float historyWeight = 0.9f; // share of the history in each temporally upscaled pixel
+        GpuTimer frameTimer{true};
+    private:
+        // locations of fullscreen.vert.glsl and temporal_upscale.frag.glsl uniforms
+        enum UniformLocation : GLint
+        {
+            DEPTH_LOCATION,
+            REPROJECTION_LOCATION,
+            JITTER_LOCATION,
+            HISTORY_WEIGHT_LOCATION
+        };
+        static constexpr uint32_t JITTER_PHASES = 8;
+        float _scale = 1.f;
+        float _smoothedMs = 0.f; // 0 until the first measurement at the current scale
+        uint64_t _samples = 0;
+        uint32_t _cooldown = 0, _frame = 0;
+        glm::uvec2 _output = glm::uvec2(0), _render = glm::uvec2(0);
+        glm::vec2 _jitter = glm::vec2(0.f);
+        glm::mat4 _viewProjection = glm::mat4(1.f), _previousViewProjection = glm::mat4(1.f); // unjittered
+        bool _historyValid = false;
+        GLuint _history = 0; // index of the history written next
+        Camera _camera; // of the scaled render
+        RenderTarget _target;
+        RenderTarget _histories[2];
+        ShaderProgram _temporalProgram;
+        VAO _emptyVAO;
+
+        static ShaderProgram TemporalProgram()
+        {
+            std::string vertex = ReadBuiltinShader("fullscreen.vert.glsl");
+            std::string fragment = ReadBuiltinShader("temporal_upscale.frag.glsl");
+            if(vertex.empty() || fragment.empty())
+                return ShaderProgram();
+            return ShaderProgram({Shader(GL_VERTEX_SHADER, vertex.c_str()), Shader(GL_FRAGMENT_SHADER, fragment.c_str())});
+        }
+        // radical inverse of index in base, the Halton sequence spreads the jitter evenly over a pixel
+        static float Halton(uint32_t index, uint32_t base)
+        {
+            float result = 0.f, fraction = 1.f;
+            for(; index; index /= base)
+            {
+                fraction /= base;
+                result += fraction * (index % base);
+            }
+            return result;
+        }
+        void Adjust()
+        {
+            _scale = std::clamp(_scale, minScale, maxScale);
+            frameTimer.Poll();
+            uint64_t samples = frameTimer.samples();
+            bool measured = samples != _samples;
+            _samples = samples;
+            if(_cooldown)
+            {
+                _cooldown--;
+                return;
+            }
+            if(!measured)
+                return;
+            float ms = frameTimer.milliseconds();
+            _smoothedMs = _smoothedMs > 0.f ? _smoothedMs * 0.75f + ms * 0.25f : ms;
+            float ratio = _smoothedMs / targetMilliseconds;
+            if(ratio <= scaleDownAbove && ratio >= scaleUpBelow)
+                return;
+            float center = (scaleDownAbove + scaleUpBelow) * 0.5f;
+            float scale = std::round(_scale * std::sqrt(center / ratio) / scaleStep) * scaleStep;
+            // moves at least one step out of the band
+            if(ratio > scaleDownAbove)
+                scale = std::min(scale, _scale - scaleStep);
+            else
+                scale = std::max(scale, _scale + scaleStep);
+            scale = std::clamp(scale, minScale, maxScale);
+            if(scale == _scale)
+                return;
+            _scale = scale;
+            _smoothedMs = 0.f;
+            _cooldown = cooldownFrames;
+        }
+        void TemporalUpscale(GLuint framebuffer)
+        {
+            const RenderTarget& target = _histories[_history];
+            const RenderTarget& history = _histories[_history ^ 1];
+            glm::mat4 reprojection = _previousViewProjection * glm::inverse(_viewProjection);
+            GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST), blend = glIsEnabled(GL_BLEND);
+            glDisable(GL_DEPTH_TEST);
+            glDisable(GL_BLEND);
+            target.Bind();
+            glBindTextureUnit(COLOR_UNIT, _target.color());
+            glBindTextureUnit(DEPTH_UNIT, _target.depth());
+            glBindTextureUnit(HISTORY_UNIT, history.color());
+            glUseProgram(_temporalProgram);
+            glProgramUniform1f(_temporalProgram, DEPTH_LOCATION, 0.f);
+            glProgramUniformMatrix4fv(_temporalProgram, REPROJECTION_LOCATION, 1, GL_FALSE, &reprojection[0][0]);
+            glProgramUniform2f(_temporalProgram, JITTER_LOCATION, _jitter.x, _jitter.y);
+            glProgramUniform1f(_temporalProgram, HISTORY_WEIGHT_LOCATION, _historyValid ? historyWeight : 0.f);
+            glBindVertexArray(_emptyVAO);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+            if(depthTest)
+                glEnable(GL_DEPTH_TEST);
+            if(blend)
+                glEnable(GL_BLEND);
+            if(ShaderVariantCache::active)
+                ShaderVariantCache::active->ResetBoundProgram();
+            target.BlitTo(_output.x, _output.y, framebuffer, GL_NEAREST);
+            _history ^= 1;
+            _historyValid = true;
+        }
+    public:
+        DynamicResolution() :
+            _target(1, 1),
+            _histories{RenderTarget(1, 1, {{GL_RGBA16F, 4}}, {GL_NONE, 0}), RenderTarget(1, 1, {{GL_RGBA16F, 4}}, {GL_NONE, 0})},
+            _temporalProgram(TemporalProgram())
+        {
+        }
+        DynamicResolution(const DynamicResolution&) = delete;
+        DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+        // Adjusts the scale to the latest measured frame, binds the offscreen target to GL_FRAMEBUFFER,
+        // so HiZCuller::BuildPyramid reads its depth, and clears it with the current clear values.
+        // camera.resolution is the output size. Returns the camera of the scaled render, with its uniforms
+        // bound, which the passes until End() have to use, e.g. for ClusteredLighting::Update.
+        Camera& Begin(Camera& camera)
+        {
+            PROFILE_SCOPE("DynamicResolution::Begin");
+            Adjust();
+            _output = camera.resolution;
+            _render = glm::max(glm::uvec2(glm::round(glm::vec2(_output) * _scale)), glm::uvec2(1));
+            _target.Resize(_render.x, _render.y);
+            glTextureParameteri(_target.color(), GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTextureParameteri(_target.color(), GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(_target.color(), GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(_target.depth(), GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTextureParameteri(_target.depth(), GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+            _jitter = glm::vec2(0.f);
+            if(upscale == TEMPORAL && _temporalProgram)
+            {
+                uint32_t phase = _frame++ % JITTER_PHASES + 1;
+                _jitter = (glm::vec2(Halton(phase, 2), Halton(phase, 3)) - 0.5f) * 2.f / glm::vec2(_render);
+            }
+            // the output camera's projection keeps the output's aspect ratio, jittered like Camera::setJitter
+            glm::mat4 projection = camera.projection();
+            _previousViewProjection = _viewProjection;
+            _viewProjection = projection * camera.view();
+            for(int column = 0; column < 4; column++)
+            {
+                projection[column][0] += _jitter.x * projection[column][3];
+                projection[column][1] += _jitter.y * projection[column][3];
+            }
+            _camera.transform.position(camera.transform.position());
+            _camera.transform.orientation(camera.transform.orientation());
+            _camera.transform.scale(camera.transform.scale());
+            _camera.view();
+            _camera.inverse_view();
+            _camera.setFarNear(camera.nearPlane, camera.farPlane);
+            _camera.customProjection(projection);
+            _camera.resolution = _render;
+            _camera.lodBias = std::log2(_scale);
+            _camera.shading = camera.shading;
+            _camera.Use();
+
+            frameTimer.Begin();
+            _target.framebuffer().Bind();
+            glViewport(0, 0, _render.x, _render.y);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            return _camera;
+        }
+        // upscales the frame into framebuffer, 0 is the window's default framebuffer, which is left bound
+        // with the output viewport, and binds the uniforms of camera again
+        void End(const Camera& camera, GLuint framebuffer = 0)
+        {
+            PROFILE_SCOPE_CPU_GPU("DynamicResolution::End");
+            if(upscale == TEMPORAL && _temporalProgram)
+            {
+                if(_histories[0].width() != (GLsizei)_output.x || _histories[0].height() != (GLsizei)_output.y)
+                {
+                    for(RenderTarget& history : _histories)
+                    {
+                        history.Resize(_output.x, _output.y);
+                        glTextureParameteri(history.color(), GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+                        glTextureParameteri(history.color(), GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+                        glTextureParameteri(history.color(), GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+                    }
+                    _historyValid = false;
+                }
+                TemporalUpscale(framebuffer);
+            }
+            else
+            {
+                _target.BlitTo(_output.x, _output.y, framebuffer, GL_LINEAR);
+                _historyValid = false;
+            }
+            frameTimer.End();
+
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glViewport(0, 0, _output.x, _output.y);
+            camera.Use();
+        }
+
+        // drops the scale back to maxScale and the measurements taken so far, e.g. after a scene change
+        void Reset()
+        {
+            _scale = maxScale;
+            _smoothedMs = 0.f;
+            _cooldown = cooldownFrames;
+            _historyValid = false;
+        }
+
+        // fraction of the output resolution rendered per axis
+        inline float scale() const
+        {
+            return _scale;
+        }
+        // size of the offscreen target of the last Begin()
+        inline glm::uvec2 renderResolution() const
+        {
+            return _render;
+        }
+        // color and depth of the last frame at renderResolution()
+        inline const RenderTarget& target() const
+        {
+            return _target;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+#include <GL/glew.h>
+
+#include "OpenGL_utils/gpu_timer.hpp"
+#include "OpenGL_utils/profiler.hpp"
+#include "builtin_shader.hpp"
+#include "camera.hpp"
+#include "visibility_buffer.hpp"
+
+namespace render
+{
+    // Runs the draws of a forward shaded pass, optionally after a depth only pre-pass of the same draws.
+    // With the pre-pass, shading tests GL_EQUAL without depth writes, so the BRDF shader runs
+    // at most once per pixel instead of once per overdrawn fragment, at the cost of drawing the geometry twice.
+    // Both parts are timed, compare prepassTimer + shadingTimer with and without the pre-pass per scene.
+    // Expects the default GL_LESS depth test with depth writes on, which is restored afterwards.
+    // Cameras with Shading::VISIBILITY_BUFFER are drawn through visibilityBuffer instead, with the same draws,
+    // so both paths can be compared on a scene by switching Camera::shading.
+    class ForwardPass
+    {
+    public:
+        bool depthPrepass = false;
+        GpuTimer prepassTimer, shadingTimer;
+        VisibilityBuffer* visibilityBuffer = nullptr;
+
+        // draw issues the pass's Material::Use and Mesh::Draw calls, it runs twice with the pre-pass.
+        // The pre-pass needs an active ShaderVariantCache and is skipped while its depth variant compiles.
+        template<typename DrawFunction>
+        void Run(DrawFunction&& draw)
+        {
+            PROFILE_SCOPE_CPU_GPU("ForwardPass");
+            ShaderVariantCache* variants = ShaderVariantCache::active;
+            bool prepass = depthPrepass && variants && variants->PrewarmDepthOnly().ready();
+            if(prepass)
+            {
+                prepassTimer.Begin();
+                bool wasDepthOnly = variants->depthOnly();
+                variants->SetDepthOnly(true);
+                glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+                draw();
+                glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+                variants->SetDepthOnly(wasDepthOnly);
+                prepassTimer.End();
+
+                glDepthFunc(GL_EQUAL);
+                glDepthMask(GL_FALSE);
+            }
+            shadingTimer.Begin();
+            draw();
+            shadingTimer.End();
+            if(prepass)
+            {
+                glDepthFunc(GL_LESS);
+                glDepthMask(GL_TRUE);
+            }
+        }
+        // shades with the path selected by camera.shading, forward when no visibilityBuffer is set
+        template<typename DrawFunction>
+        void Run(Camera& camera, DrawFunction&& draw)
+        {
+            if(camera.shading == Camera::Shading::VISIBILITY_BUFFER && visibilityBuffer)
+                visibilityBuffer->Run(camera, draw);
+            else
+                Run(draw);
+        }
+    };
+}
\ No newline at end of file
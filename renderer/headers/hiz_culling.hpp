@@ -0,0 +1,200 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include "OpenGL_utils/buffer.hpp"
+#include "OpenGL_utils/shader.hpp"
+#include "OpenGL_utils/texture.hpp"
+#include "builtin_shader.hpp"
+#include "camera.hpp"
+#include "mesh.hpp"
+
+namespace render
+{
+    // GPU occlusion culling against a hierarchical depth (Hi-Z) pyramid, in two phases per frame:
+    //  - CullEarly + DrawEarly draw the instances that were visible last frame and are inside the frustum,
+    //  - BuildPyramid reduces the resulting depth into a max depth mip chain with a compute shader,
+    //  - CullLate tests every instance's screen rect against the pyramid, updates the visibility
+    //    and DrawLate draws the disoccluded instances missing from the early phase.
+    // Survivors are compacted into per mesh instance buffers and drawn with indirect commands,
+    // so the CPU never reads back visibility. Meshes without bounds are never culled.
+    class HiZCuller
+    {
+    public:
+        static constexpr GLuint DEPTH_TEXTURE_UNIT = 7;
+        using GroupId = size_t;
+    private:
+        enum Phase : GLuint
+        {
+            EARLY_PHASE,
+            LATE_PHASE
+        };
+        // locations of hiz_cull.comp.glsl and hiz_build.comp.glsl uniforms
+        enum CullUniform : GLint
+        {
+            VIEW_PROJECTION_LOCATION,
+            BOUNDS_MIN_LOCATION,
+            BOUNDS_MAX_LOCATION,
+            INSTANCE_TOTAL_LOCATION,
+            PHASE_LOCATION,
+            HAS_BOUNDS_LOCATION
+        };
+        static constexpr GLint COPY_DEPTH_LOCATION = 0;
+        struct Group
+        {
+            Mesh* mesh;
+            TypedSharedBuffer<InstanceData> instances;
+            TypedSharedBuffer<GLuint> visibility;
+            TypedSharedBuffer<InstanceData> survivors[2];          // by Phase
+            TypedSharedBuffer<DrawIndirectCommand> commands[2];    // by Phase, instance counts written by the GPU
+        };
+        ShaderProgram _buildProgram, _cullProgram;
+        Texture2D _depthCopy, _pyramid;
+        std::vector<Group> _groups;
+        glm::mat4 _viewProjection{1.f};
+
+        static ShaderProgram ComputeProgram(const char* file)
+        {
+            std::string source = ReadBuiltinShader(file);
+            if(source.empty())
+                return ShaderProgram();
+            return ShaderProgram({Shader(GL_COMPUTE_SHADER, source.c_str())});
+        }
+        void Cull(Phase phase)
+        {
+            glUseProgram(_cullProgram);
+            glProgramUniformMatrix4fv(_cullProgram, VIEW_PROJECTION_LOCATION, 1, GL_FALSE, &_viewProjection[0][0]);
+            glProgramUniform1ui(_cullProgram, PHASE_LOCATION, phase);
+            if(phase == LATE_PHASE)
+                glBindTextureUnit(DEPTH_TEXTURE_UNIT, _pyramid);
+            const GLuint zero = 0;
+            for(Group& group : _groups)
+            {
+                GLuint count = group.instances.count();
+                glClearNamedBufferSubData(group.commands[phase], GL_R32UI, offsetof(DrawIndirectCommand, instanceCount), sizeof(GLuint),
+                                          GL_RED_INTEGER, GL_UNSIGNED_INT, &zero);
+                glProgramUniform3fv(_cullProgram, BOUNDS_MIN_LOCATION, 1, &group.mesh->boundsMin[0]);
+                glProgramUniform3fv(_cullProgram, BOUNDS_MAX_LOCATION, 1, &group.mesh->boundsMax[0]);
+                glProgramUniform1ui(_cullProgram, INSTANCE_TOTAL_LOCATION, count);
+                glProgramUniform1i(_cullProgram, HAS_BOUNDS_LOCATION, group.mesh->hasBounds());
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, HIZ_INSTANCES_BINDING_POINT, group.instances);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, HIZ_VISIBILITY_BINDING_POINT, group.visibility);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, HIZ_SURVIVORS_BINDING_POINT, group.survivors[phase]);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, HIZ_COMMAND_BINDING_POINT, group.commands[phase]);
+                glDispatchCompute((count + 63) / 64, 1, 1);
+            }
+            glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+            if(ShaderVariantCache::active)
+                ShaderVariantCache::active->ResetBoundProgram();
+        }
+        void Draw(Phase phase)
+        {
+            for(Group& group : _groups)
+                group.mesh->DrawIndirect(group.survivors[phase], group.commands[phase]);
+        }
+    public:
+        HiZCuller() :
+            _buildProgram(ComputeProgram("hiz_build.comp.glsl")),
+            _cullProgram(ComputeProgram("hiz_cull.comp.glsl"))
+        {}
+        HiZCuller(const HiZCuller&) = delete;
+        HiZCuller& operator=(const HiZCuller&) = delete;
+
+        // instances are culled as a whole buffer, re-add the group after replacing the buffer
+        GroupId Add(Mesh& mesh, TypedSharedBuffer<InstanceData> instances)
+        {
+            GLuint count = instances.count();
+            std::vector<GLuint> hidden(count, 0);
+            DrawIndirectCommand command{mesh.drawCount(), 0, 0, 0, 0};
+            Group group{&mesh, instances, TypedSharedBuffer<GLuint>(count, hidden.data()),
+                        {TypedSharedBuffer<InstanceData>(count), TypedSharedBuffer<InstanceData>(count)},
+                        {TypedSharedBuffer<DrawIndirectCommand>(1, &command), TypedSharedBuffer<DrawIndirectCommand>(1, &command)}};
+            group.visibility.Label(GpuMemoryCategory::INSTANCE, "Hi-Z visibility");
+            for(int i = 0; i < 2; i++)
+            {
+                group.survivors[i].Label(GpuMemoryCategory::INSTANCE, "Hi-Z survivors");
+                group.commands[i].Label(GpuMemoryCategory::INSTANCE, "Hi-Z draw commands");
+            }
+            _groups.push_back(std::move(group));
+            return _groups.size() - 1;
+        }
+        void Clear()
+        {
+            _groups.clear();
+        }
+
+        // frustum culls the instances visible last frame with the camera's current matrices
+        void CullEarly(Camera& camera)
+        {
+            _viewProjection = camera.projection() * camera.view();
+            Cull(EARLY_PHASE);
+        }
+        void DrawEarly()
+        {
+            Draw(EARLY_PHASE);
+        }
+        // builds the pyramid from a depth texture holding the early phase depth
+        void BuildPyramid(const Texture& depth)
+        {
+            GLsizei width = depth->width, height = depth->height;
+            if(_pyramid->width != width || _pyramid->height != height)
+            {
+                GLsizei levels = (GLsizei)std::floor(std::log2((float)std::max(width, height))) + 1;
+                _pyramid = Texture2D(levels, GL_R32F, 1, width, height);
+                _pyramid.Label(GpuMemoryCategory::RENDER_TARGET, "Hi-Z pyramid");
+            }
+            glUseProgram(_buildProgram);
+            glBindTextureUnit(DEPTH_TEXTURE_UNIT, depth);
+            for(GLint level = 0; level < _pyramid->levels; level++)
+            {
+                glProgramUniform1i(_buildProgram, COPY_DEPTH_LOCATION, level == 0);
+                if(level > 0)
+                    glBindImageTexture(0, _pyramid, level - 1, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+                glBindImageTexture(1, _pyramid, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+                GLuint levelWidth = std::max(width >> level, 1), levelHeight = std::max(height >> level, 1);
+                glDispatchCompute((levelWidth + 7) / 8, (levelHeight + 7) / 8, 1);
+                glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+            }
+            if(ShaderVariantCache::active)
+                ShaderVariantCache::active->ResetBoundProgram();
+        }
+        // copies depth from the bound read framebuffer first, which works for the default framebuffer too
+        void BuildPyramid(GLsizei width, GLsizei height)
+        {
+            if(_depthCopy->width != width || _depthCopy->height != height)
+            {
+                _depthCopy = Texture2D(1, GL_DEPTH_COMPONENT32F, 1, width, height);
+                _depthCopy.Label(GpuMemoryCategory::RENDER_TARGET, "Hi-Z depth copy");
+            }
+            glCopyTextureSubImage2D(_depthCopy, 0, 0, 0, 0, 0, width, height);
+            BuildPyramid(_depthCopy);
+        }
+        // tests all instances against the pyramid, with the matrices used by CullEarly
+        void CullLate()
+        {
+            Cull(LATE_PHASE);
+        }
+        void DrawLate()
+        {
+            Draw(LATE_PHASE);
+        }
+
+        // instances drawn by a phase of the last frame, reads back from the GPU, for debugging only
+        GLuint DrawnInstances(GroupId group, bool late)
+        {
+            DrawIndirectCommand command{};
+            glGetNamedBufferSubData(_groups[group].commands[late ? LATE_PHASE : EARLY_PHASE], 0, sizeof(command), &command);
+            return command.instanceCount;
+        }
+        inline const Texture2D& pyramid() const
+        {
+            return _pyramid;
+        }
+    };
+}
\ No newline at end of file
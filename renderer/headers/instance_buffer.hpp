@@ -0,0 +1,296 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+
+#include "OpenGL_utils/buffer.hpp"
+#include "OpenGL_utils/profiler.hpp"
+#include "transform.hpp"
+
+namespace render
+{
+    struct InstanceData
+    {
+        glm::mat4 model, inverse_model;
+        GLuint material = 0; // FragmentShaderBRDF::Material::index(), 0 is the registry's default material
+        GLuint __pad[3];
+    };
+
+    // Growable set of instances for Mesh::Draw, addressed through handles that stay valid until removed.
+    // Instances are kept densely packed, Remove() moves the last instance into the hole and
+    // a slot table maps handles to their current index, so adding and removing are O(1).
+    // Changes go to a CPU side copy and Upload() writes only the blocks touched since the written buffer was
+    // last uploaded into its persistent mapping, nothing is ever read back from the write combined mapping.
+    // The buffer is kept FRAME_SLOTS times, an Upload with changes writes the next one once a fence shows
+    // the GPU is done with the draws that last read it, so earlier frames' draws never see a half written buffer.
+    // When the instances outgrow a buffer it is replaced by one twice as large, the uploaded
+    // unchanged instances are copied over on the GPU, so buffer() has to be fetched again after Upload().
+    class InstanceBuffer
+    {
+    public:
+        static constexpr uint32_t FRAME_SLOTS = 3;
+        struct Handle
+        {
+            uint32_t slot = ~0u;
+            uint32_t generation = 0; // tells handles of removed instances from those reusing their slot
+        };
+        static constexpr GLuint DIRTY_BLOCK = 16; // instances per dirty bit
+    private:
+        static constexpr uint32_t FREE = ~0u;
+        struct Slot
+        {
+            uint32_t index;
+            uint32_t generation;
+        };
+        std::vector<InstanceData> _instances;
+        std::vector<uint32_t> _indexSlots; // slot of every instance
+        std::vector<Slot> _slots;
+        std::vector<uint32_t> _freeSlots;
+        struct FrameStorage
+        {
+            TypedSharedBuffer<InstanceData> buffer;
+            std::vector<uint64_t> dirty; // one bit per DIRTY_BLOCK instances changed since buffer was written
+            GLuint uploadedCount = 0;    // instances valid in buffer, the rest is dirty
+            GLsync fence = nullptr;      // after the draws that read buffer since it was written
+        };
+        FrameStorage _frames[FRAME_SLOTS];
+        uint32_t _frame = 0; // storage written by the last Upload and returned by buffer()
+        const char* _label;
+
+        void MarkDirty(GLuint index)
+        {
+            GLuint block = index / DIRTY_BLOCK;
+            for(FrameStorage& frame : _frames)
+            {
+                if(block / 64 >= frame.dirty.size())
+                    frame.dirty.resize(block / 64 + 1, 0);
+                frame.dirty[block / 64] |= 1ull << (block % 64);
+            }
+        }
+        static inline bool IsDirty(const FrameStorage& frame, GLuint block)
+        {
+            return block / 64 < frame.dirty.size() && (frame.dirty[block / 64] >> (block % 64) & 1);
+        }
+        static inline bool AnyDirty(const FrameStorage& frame)
+        {
+            return std::any_of(frame.dirty.begin(), frame.dirty.end(), [](uint64_t bits) { return bits != 0; });
+        }
+        // Only clean blocks are copied on the GPU. The copy runs after the dirty blocks were written
+        // into the new mapping by Upload(), so copying them as well would bring back their old data.
+        void Grow(FrameStorage& frame, GLuint capacity)
+        {
+            TypedSharedBuffer<InstanceData> grown(capacity);
+            grown.Label(GpuMemoryCategory::INSTANCE, _label);
+            GLuint blocks = frame.buffer ? (frame.uploadedCount + DIRTY_BLOCK - 1) / DIRTY_BLOCK : 0;
+            for(GLuint block = 0; block < blocks;)
+            {
+                if(IsDirty(frame, block))
+                {
+                    block++;
+                    continue;
+                }
+                GLuint begin = block * DIRTY_BLOCK;
+                while(block < blocks && !IsDirty(frame, block))
+                    block++;
+                GLuint end = std::min(block * DIRTY_BLOCK, frame.uploadedCount);
+                glCopyNamedBufferSubData(frame.buffer, grown, (GLintptr)begin * sizeof(InstanceData), (GLintptr)begin * sizeof(InstanceData),
+                                         (GLsizeiptr)(end - begin) * sizeof(InstanceData));
+            }
+            frame.buffer = std::move(grown);
+        }
+        uint32_t IndexOf(Handle handle) const
+        {
+            if(!valid(handle))
+            {
+                std::fprintf(stderr, "Error: Invalid instance handle %u!\n", handle.slot);
+                return FREE;
+            }
+            return _slots[handle.slot].index;
+        }
+    public:
+        // label names the buffer in GpuMemory and GL debug output, it has to outlive the InstanceBuffer
+        InstanceBuffer(GLuint initialCapacity = 64, const char* label = "Instances") :
+            _label(label)
+        {
+            for(FrameStorage& frame : _frames)
+                Grow(frame, initialCapacity ? initialCapacity : 1);
+        }
+        ~InstanceBuffer()
+        {
+            for(FrameStorage& frame : _frames)
+                if(frame.fence)
+                    glDeleteSync(frame.fence);
+        }
+        InstanceBuffer(const InstanceBuffer&) = delete;
+        InstanceBuffer& operator=(const InstanceBuffer&) = delete;
+
+        Handle Add(const InstanceData& data)
+        {
+            uint32_t slot;
+            if(_freeSlots.empty())
+            {
+                slot = _slots.size();
+                _slots.push_back(Slot{0, 0});
+            }
+            else
+            {
+                slot = _freeSlots.back();
+                _freeSlots.pop_back();
+            }
+            _slots[slot].index = _instances.size();
+            MarkDirty(_instances.size());
+            _instances.push_back(data);
+            _indexSlots.push_back(slot);
+            return Handle{slot, _slots[slot].generation};
+        }
+        void Remove(Handle handle)
+        {
+            uint32_t index = IndexOf(handle);
+            if(index == FREE)
+                return;
+            uint32_t last = _instances.size() - 1;
+            if(index != last)
+            {
+                _instances[index] = _instances[last];
+                _indexSlots[index] = _indexSlots[last];
+                _slots[_indexSlots[index]].index = index;
+                MarkDirty(index);
+            }
+            _instances.pop_back();
+            _indexSlots.pop_back();
+            _slots[handle.slot] = Slot{FREE, _slots[handle.slot].generation + 1};
+            _freeSlots.push_back(handle.slot);
+            for(FrameStorage& frame : _frames)
+                frame.uploadedCount = std::min<GLuint>(frame.uploadedCount, _instances.size());
+        }
+        void Clear()
+        {
+            for(uint32_t slot : _indexSlots)
+            {
+                _slots[slot] = Slot{FREE, _slots[slot].generation + 1};
+                _freeSlots.push_back(slot);
+            }
+            _instances.clear();
+            _indexSlots.clear();
+            for(FrameStorage& frame : _frames)
+            {
+                frame.dirty.clear();
+                frame.uploadedCount = 0;
+            }
+        }
+        inline bool valid(Handle handle) const
+        {
+            return handle.slot < _slots.size() && _slots[handle.slot].generation == handle.generation &&
+                   _slots[handle.slot].index != FREE;
+        }
+
+        const InstanceData& Get(Handle handle) const
+        {
+            static const InstanceData none{};
+            uint32_t index = IndexOf(handle);
+            return index == FREE ? none : _instances[index];
+        }
+        void Set(Handle handle, const InstanceData& data)
+        {
+            uint32_t index = IndexOf(handle);
+            if(index == FREE)
+                return;
+            _instances[index] = data;
+            MarkDirty(index);
+        }
+        void SetTransform(Handle handle, const Transform& transform)
+        {
+            uint32_t index = IndexOf(handle);
+            if(index == FREE)
+                return;
+            _instances[index].model = transform.matrix();
+            _instances[index].inverse_model = transform.inverse();
+            MarkDirty(index);
+        }
+        void SetMaterial(Handle handle, GLuint material)
+        {
+            uint32_t index = IndexOf(handle);
+            if(index == FREE)
+                return;
+            _instances[index].material = material;
+            MarkDirty(index);
+        }
+        // handle of the instance at index, e.g. of an instance that survived culling
+        inline Handle handle(GLuint index) const
+        {
+            uint32_t slot = _indexSlots[index];
+            return Handle{slot, _slots[slot].generation};
+        }
+
+        // grows the GPU buffer ahead of time, to skip the copies of geometric growth
+        void Reserve(GLuint capacity)
+        {
+            for(FrameStorage& frame : _frames)
+                if(capacity > frame.buffer.count())
+                    Grow(frame, capacity);
+        }
+        // Writes the changed blocks into the next buffer, Mesh::Draw(InstanceBuffer&) calls it.
+        // Without changes the current buffer is kept, so draws of the same frame do not cycle through the buffers.
+        void Upload()
+        {
+            PROFILE_SCOPE("InstanceBuffer::Upload");
+            GLuint count = _instances.size();
+            if(count <= _frames[_frame].uploadedCount && !AnyDirty(_frames[_frame]))
+                return;
+            _frames[_frame].fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            _frame = (_frame + 1) % FRAME_SLOTS;
+            FrameStorage& frame = _frames[_frame];
+            if(frame.fence)
+            {
+                // the flush bit makes sure the fence gets submitted and can signal at all
+                glClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, ~GLuint64(0));
+                glDeleteSync(frame.fence);
+                frame.fence = nullptr;
+            }
+            if(count > frame.buffer.count())
+                Grow(frame, std::max(count, frame.buffer.count() * 2));
+            InstanceData* mapped = frame.buffer.data();
+            for(size_t word = 0; word < frame.dirty.size(); word++)
+            {
+                uint64_t bits = frame.dirty[word];
+                while(bits)
+                {
+                    // coalesces a run of dirty blocks into one copy
+                    GLuint first = std::countr_zero(bits);
+                    GLuint run = std::countr_one(bits >> first);
+                    bits &= run == 64 ? 0 : ~(((1ull << run) - 1) << first);
+                    GLuint begin = (word * 64 + first) * DIRTY_BLOCK;
+                    GLuint end = std::min<GLuint>(begin + run * DIRTY_BLOCK, count);
+                    if(begin < end)
+                        std::memcpy(mapped + begin, _instances.data() + begin, (end - begin) * sizeof(InstanceData));
+                }
+            }
+            frame.dirty.clear();
+            frame.uploadedCount = count;
+        }
+
+        inline GLuint count() const
+        {
+            return _instances.size();
+        }
+        inline GLuint capacity() const
+        {
+            return _frames[_frame].buffer.count();
+        }
+        // written by the last Upload(), a different one after the next Upload() with changes
+        inline TypedSharedBuffer<InstanceData>& buffer()
+        {
+            return _frames[_frame].buffer;
+        }
+        // CPU side copy in draw order
+        inline const InstanceData* data() const
+        {
+            return _instances.data();
+        }
+    };
+}
\ No newline at end of file
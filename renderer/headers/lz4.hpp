@@ -0,0 +1,169 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace render
+{
+    // Minimal LZ4 block format codec (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md)
+    // Compression is a greedy single hash probe, decompression is bounds checked
+    // and writes straight into caller provided memory (e.g. a mapped buffer)
+    namespace lz4
+    {
+        constexpr size_t MIN_MATCH = 4;
+        constexpr size_t LAST_LITERALS = 5;
+        constexpr size_t MF_LIMIT = 12;
+        constexpr size_t MAX_OFFSET = 65535;
+        constexpr uint32_t HASH_LOG = 16;
+
+        constexpr size_t CompressBound(size_t srcSize)
+        {
+            return srcSize + srcSize / 255 + 16;
+        }
+
+        inline uint32_t Read32(const uint8_t* p)
+        {
+            uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        inline uint32_t Hash(uint32_t seq)
+        {
+            return (seq * 2654435761u) >> (32 - HASH_LOG);
+        }
+        inline bool WriteLength(size_t len, uint8_t* dst, size_t dstCapacity, size_t &op)
+        {
+            for(; len >= 255; len -= 255)
+            {
+                if(op >= dstCapacity) return false;
+                dst[op++] = 255;
+            }
+            if(op >= dstCapacity) return false;
+            dst[op++] = (uint8_t)len;
+            return true;
+        }
+        inline bool WriteSequence(const uint8_t* literals, size_t litLen, size_t offset, size_t matchLen,
+                                  uint8_t* dst, size_t dstCapacity, size_t &op)
+        {
+            if(op >= dstCapacity) return false;
+            size_t tokenPos = op++;
+            uint8_t token = (uint8_t)((litLen >= 15 ? 15 : litLen) << 4);
+            if(litLen >= 15 && !WriteLength(litLen - 15, dst, dstCapacity, op))
+                return false;
+            if(op + litLen > dstCapacity) return false;
+            std::memcpy(dst + op, literals, litLen);
+            op += litLen;
+            if(matchLen) // matchLen == 0 marks the closing literals-only sequence
+            {
+                size_t ml = matchLen - MIN_MATCH;
+                token |= (uint8_t)(ml >= 15 ? 15 : ml);
+                if(op + 2 > dstCapacity) return false;
+                dst[op++] = (uint8_t)(offset & 0xFF);
+                dst[op++] = (uint8_t)(offset >> 8);
+                if(ml >= 15 && !WriteLength(ml - 15, dst, dstCapacity, op))
+                    return false;
+            }
+            dst[tokenPos] = token;
+            return true;
+        }
+
+        // returns compressed size or 0 if dstCapacity is too small
+        inline size_t CompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity)
+        {
+            size_t ip = 0, anchor = 0, op = 0;
+            if(srcSize > MF_LIMIT)
+            {
+                std::vector<uint32_t> table(1u << HASH_LOG, 0u); // stores position + 1, 0 = empty
+                const size_t matchStartLimit = srcSize - MF_LIMIT;
+                const size_t matchEndLimit = srcSize - LAST_LITERALS;
+                while(ip <= matchStartLimit)
+                {
+                    uint32_t seq = Read32(src + ip);
+                    uint32_t &slot = table[Hash(seq)];
+                    size_t ref = slot;
+                    slot = (uint32_t)(ip + 1);
+                    if(!ref || ip - (ref - 1) > MAX_OFFSET || Read32(src + ref - 1) != seq)
+                    {
+                        ++ip;
+                        continue;
+                    }
+                    --ref;
+                    while(ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1])
+                    {
+                        --ip;
+                        --ref;
+                    }
+                    size_t matchEnd = ip + MIN_MATCH, refEnd = ref + MIN_MATCH;
+                    while(matchEnd < matchEndLimit && src[matchEnd] == src[refEnd])
+                    {
+                        ++matchEnd;
+                        ++refEnd;
+                    }
+                    if(!WriteSequence(src + anchor, ip - anchor, ip - ref, matchEnd - ip, dst, dstCapacity, op))
+                        return 0;
+                    ip = anchor = matchEnd;
+                }
+            }
+            if(!WriteSequence(src + anchor, srcSize - anchor, 0, 0, dst, dstCapacity, op))
+                return 0;
+            return op;
+        }
+
+        // decompressed data must fill dst exactly, otherwise the block is treated as corrupted
+        inline bool DecompressBlock(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+        {
+            size_t ip = 0, op = 0;
+            while(ip < srcSize)
+            {
+                uint8_t token = src[ip++];
+                size_t litLen = token >> 4;
+                if(litLen == 15)
+                {
+                    uint8_t b;
+                    do
+                    {
+                        if(ip >= srcSize) return false;
+                        b = src[ip++];
+                        litLen += b;
+                    } while(b == 255);
+                }
+                if(ip + litLen > srcSize || op + litLen > dstSize)
+                    return false;
+                std::memcpy(dst + op, src + ip, litLen);
+                ip += litLen;
+                op += litLen;
+                if(ip == srcSize) // last sequence has no match part
+                    break;
+
+                if(ip + 2 > srcSize) return false;
+                size_t offset = src[ip] | (src[ip + 1] << 8);
+                ip += 2;
+                if(offset == 0 || offset > op) return false;
+
+                size_t matchLen = token & 15;
+                if(matchLen == 15)
+                {
+                    uint8_t b;
+                    do
+                    {
+                        if(ip >= srcSize) return false;
+                        b = src[ip++];
+                        matchLen += b;
+                    } while(b == 255);
+                }
+                matchLen += MIN_MATCH;
+                if(op + matchLen > dstSize) return false;
+
+                const uint8_t* match = dst + op - offset;
+                if(offset >= matchLen)
+                    std::memcpy(dst + op, match, matchLen);
+                else
+                    for(size_t i = 0; i < matchLen; i++) // overlapping copy repeats the pattern
+                        dst[op + i] = match[i];
+                op += matchLen;
+            }
+            return op == dstSize;
+        }
+    }
+}
\ No newline at end of file
@@ -1,16 +1,38 @@
 #pragma once
 #include <vector>
+#include <cmath>
+#include <cstddef>
 #include <GL/glew.h>
 #include <glm/glm.hpp>
 
 #include "OpenGL_utils/vao.hpp"
 #include "OpenGL_utils/buffer.hpp"
+#include "OpenGL_utils/profiler.hpp"
+#include "builtin_shader.hpp"
+#include "instance_buffer.hpp"
 
 namespace render
 {
-    struct InstanceData
+    // layout shared by glDrawElementsIndirect and glDrawArraysIndirect (which ignores the last field
+    // and reads baseVertex as baseInstance), so commands with zero first, baseVertex and baseInstance work for both
+    struct DrawIndirectCommand
     {
-        glm::mat4 model, inverse_model;
+        GLuint count;
+        GLuint instanceCount;
+        GLuint first;
+        GLint baseVertex;
+        GLuint baseInstance;
+    };
+    struct Mesh;
+    // While active, Mesh draws ask it for their program instead of the ShaderVariantCache,
+    // VisibilityBuffer records its geometry pass this way from unchanged draw code
+    class DrawInterceptor
+    {
+    public:
+        static inline DrawInterceptor* active = nullptr;
+        virtual ~DrawInterceptor() = default;
+        // binds the program for the draw, false skips it, instanceCount is an upper bound for indirect draws
+        virtual bool Intercept(Mesh& mesh, TypedSharedBuffer<InstanceData>& instanceBuffer, GLuint instanceCount, GLenum mode) = 0;
     };
     class MeshVAO : public render::VAO
     {
@@ -23,7 +45,8 @@ namespace render
             NORMAL_BIND,
             TANGENT_BIND,
             INSTANCE_MODEL_BIND,
-            INSTANCE_INVERSE_MODEL_BIND
+            INSTANCE_INVERSE_MODEL_BIND,
+            INSTANCE_MATERIAL_BIND
         };
         enum AttribIndex : GLuint
         {
@@ -39,7 +62,8 @@ namespace render
             INSTANCE_INVERSE_MODEL_COL0_IDX,
             INSTANCE_INVERSE_MODEL_COL1_IDX,
             INSTANCE_INVERSE_MODEL_COL2_IDX,
-            INSTANCE_INVERSE_MODEL_COL3_IDX
+            INSTANCE_INVERSE_MODEL_COL3_IDX,
+            INSTANCE_MATERIAL_IDX
         };
         
         MeshVAO() : render::VAO()
@@ -87,6 +111,11 @@ namespace render
             EnableAttrib(INSTANCE_INVERSE_MODEL_COL1_IDX);
             EnableAttrib(INSTANCE_INVERSE_MODEL_COL2_IDX);
             EnableAttrib(INSTANCE_INVERSE_MODEL_COL3_IDX);
+
+            glVertexArrayAttribIFormat(name(), INSTANCE_MATERIAL_IDX, 1, GL_UNSIGNED_INT, 0); // instance material index
+            glVertexArrayAttribBinding(name(), INSTANCE_MATERIAL_IDX, INSTANCE_MATERIAL_BIND);
+            glVertexArrayBindingDivisor(name(), INSTANCE_MATERIAL_BIND, 1);
+            EnableAttrib(INSTANCE_MATERIAL_IDX);
         }
     };
 
@@ -102,15 +131,56 @@ namespace render
         TypedSharedBuffer<glm::vec3> tangents;
         TypedSharedBuffer<glm::vec2> UVs;
         TypedSharedBuffer<GLuint> elements;
+        // object space bounding box used for culling, empty (min > max) when unknown
+        glm::vec3 boundsMin = glm::vec3(INFINITY);
+        glm::vec3 boundsMax = glm::vec3(-INFINITY);
         Mesh(GLuint vertCount, const glm::vec3 *initialVertsData) :
             activeVertices(vertCount)
         {
             vertices = TypedSharedBuffer<glm::vec3>(activeVertices, initialVertsData);
+            vertices.Label(GpuMemoryCategory::MESH, "Mesh positions");
+            VAO.BindVertexBuffer(MeshVAO::POS_BIND, vertices, 0, sizeof(glm::vec3));
+            if(initialVertsData)
+                ComputeBounds(initialVertsData, vertCount);
+        }
+        Mesh(TypedSharedBuffer<glm::vec3> vertBuffer) : // adopts already filled buffer, no copy, bounds stay unknown
+            activeVertices(vertBuffer.count()),
+            vertices(vertBuffer)
+        {
+            vertices.Label(GpuMemoryCategory::MESH, "Mesh positions");
             VAO.BindVertexBuffer(MeshVAO::POS_BIND, vertices, 0, sizeof(glm::vec3));
         }
+        // buffers are mapped write only, so bounds are computed from a CPU side copy of the positions
+        void ComputeBounds(const glm::vec3 *positions, GLuint count)
+        {
+            boundsMin = glm::vec3(INFINITY);
+            boundsMax = glm::vec3(-INFINITY);
+            for(GLuint i = 0; i < count; i++)
+            {
+                boundsMin = glm::min(boundsMin, positions[i]);
+                boundsMax = glm::max(boundsMax, positions[i]);
+            }
+        }
+        inline bool hasBounds() const
+        {
+            return boundsMin.x <= boundsMax.x;
+        }
+        // MeshVAO attributes with a buffer, the attribute mask of shader variants
+        inline GLuint attribMask()
+        {
+            return VAO.activeAttribBitfield();
+        }
         void initColors(const glm::vec4 *initialData)
         {
             colors = TypedSharedBuffer<glm::vec4>(vertices.count(), initialData);
+            colors.Label(GpuMemoryCategory::MESH, "Mesh colors");
+            VAO.EnableAttrib(MeshVAO::COLOR_IDX);
+            VAO.BindVertexBuffer(MeshVAO::COLOR_BIND, colors, 0, sizeof(glm::vec4));
+        }
+        void initColors(TypedSharedBuffer<glm::vec4> buffer)
+        {
+            colors = buffer;
+            colors.Label(GpuMemoryCategory::MESH, "Mesh colors");
             VAO.EnableAttrib(MeshVAO::COLOR_IDX);
             VAO.BindVertexBuffer(MeshVAO::COLOR_BIND, colors, 0, sizeof(glm::vec4));
         }
@@ -122,6 +192,14 @@ namespace render
         void initNormals(const glm::vec3 *initialData)
         {
             normals = TypedSharedBuffer<glm::vec3>(vertices.count(), initialData);
+            normals.Label(GpuMemoryCategory::MESH, "Mesh normals");
+            VAO.EnableAttrib(MeshVAO::NORMAL_IDX);
+            VAO.BindVertexBuffer(MeshVAO::NORMAL_BIND, normals, 0, sizeof(glm::vec3));
+        }
+        void initNormals(TypedSharedBuffer<glm::vec3> buffer)
+        {
+            normals = buffer;
+            normals.Label(GpuMemoryCategory::MESH, "Mesh normals");
             VAO.EnableAttrib(MeshVAO::NORMAL_IDX);
             VAO.BindVertexBuffer(MeshVAO::NORMAL_BIND, normals, 0, sizeof(glm::vec3));
         }
@@ -133,6 +211,14 @@ namespace render
         void initTangents(const glm::vec3 *initialData)
         {
             tangents = TypedSharedBuffer<glm::vec3>(vertices.count(), initialData);
+            tangents.Label(GpuMemoryCategory::MESH, "Mesh tangents");
+            VAO.EnableAttrib(MeshVAO::TANGENT_IDX);
+            VAO.BindVertexBuffer(MeshVAO::TANGENT_BIND, tangents, 0, sizeof(glm::vec3));
+        }
+        void initTangents(TypedSharedBuffer<glm::vec3> buffer)
+        {
+            tangents = buffer;
+            tangents.Label(GpuMemoryCategory::MESH, "Mesh tangents");
             VAO.EnableAttrib(MeshVAO::TANGENT_IDX);
             VAO.BindVertexBuffer(MeshVAO::TANGENT_BIND, tangents, 0, sizeof(glm::vec3));
         }
@@ -144,6 +230,14 @@ namespace render
         void initUVs(const glm::vec2 *initialData)
         {
             UVs = TypedSharedBuffer<glm::vec2>(vertices.count(), initialData);
+            UVs.Label(GpuMemoryCategory::MESH, "Mesh UVs");
+            VAO.EnableAttrib(MeshVAO::UV_IDX);
+            VAO.BindVertexBuffer(MeshVAO::UV_BIND, UVs, 0, sizeof(glm::vec2));
+        }
+        void initUVs(TypedSharedBuffer<glm::vec2> buffer)
+        {
+            UVs = buffer;
+            UVs.Label(GpuMemoryCategory::MESH, "Mesh UVs");
             VAO.EnableAttrib(MeshVAO::UV_IDX);
             VAO.BindVertexBuffer(MeshVAO::UV_BIND, UVs, 0, sizeof(glm::vec2));
         }
@@ -155,6 +249,13 @@ namespace render
         void initElements(GLuint indexCount, const GLuint *initialData)
         {
             elements = TypedSharedBuffer<GLuint>(indexCount, initialData);
+            elements.Label(GpuMemoryCategory::MESH, "Mesh elements");
+            VAO.BindElementBuffer(elements);
+        }
+        void initElements(TypedSharedBuffer<GLuint> buffer)
+        {
+            elements = buffer;
+            elements.Label(GpuMemoryCategory::MESH, "Mesh elements");
             VAO.BindElementBuffer(elements);
         }
         void deinitElements()
@@ -162,17 +263,63 @@ namespace render
             elements = TypedSharedBuffer<GLuint>();
             VAO.BindElementBuffer(0);
         }
-        void Draw(TypedSharedBuffer<InstanceData> instanceBuffer, GLenum mode = GL_TRIANGLES)
+    private:
+        // selects the shader variant and binds the instance streams, false while the variant compiles
+        bool Prepare(TypedSharedBuffer<InstanceData>& instanceBuffer, GLuint instanceCount, GLenum mode)
         {
-            glUniform1ui(render::VertexShaderGeneral::ACTIVE_ATRRIB_BIT_LOCATION, VAO.activeAttribBitfield());
+            if(DrawInterceptor::active)
+            {
+                if(!DrawInterceptor::active->Intercept(*this, instanceBuffer, instanceCount, mode))
+                    return false;
+            }
+            else if(ShaderVariantCache::active && !ShaderVariantCache::active->Use(VAO.activeAttribBitfield()))
+                return false; // variant still compiling
 
-            VAO.BindVertexBuffer(MeshVAO::INSTANCE_MODEL_BIND, instanceBuffer, 0, sizeof(glm::mat4)*2);
-            VAO.BindVertexBuffer(MeshVAO::INSTANCE_INVERSE_MODEL_BIND, instanceBuffer, sizeof(glm::mat4), sizeof(glm::mat4));
+            VAO.BindVertexBuffer(MeshVAO::INSTANCE_MODEL_BIND, instanceBuffer, offsetof(InstanceData, model), sizeof(InstanceData));
+            VAO.BindVertexBuffer(MeshVAO::INSTANCE_INVERSE_MODEL_BIND, instanceBuffer, offsetof(InstanceData, inverse_model), sizeof(InstanceData));
+            VAO.BindVertexBuffer(MeshVAO::INSTANCE_MATERIAL_BIND, instanceBuffer, offsetof(InstanceData, material), sizeof(InstanceData));
             glBindVertexArray(VAO);
+            return true;
+        }
+    public:
+        void Draw(TypedSharedBuffer<InstanceData> instanceBuffer, GLenum mode = GL_TRIANGLES)
+        {
+            DrawInstances(instanceBuffer, instanceBuffer.count(), mode);
+        }
+        // uploads the pending changes of instances and draws all of them
+        void Draw(InstanceBuffer& instances, GLenum mode = GL_TRIANGLES)
+        {
+            instances.Upload();
+            DrawInstances(instances.buffer(), instances.count(), mode);
+        }
+        // draws only the first instanceCount instances, e.g. the survivors of CPU culling
+        void DrawInstances(TypedSharedBuffer<InstanceData> instanceBuffer, GLuint instanceCount, GLenum mode = GL_TRIANGLES)
+        {
+            PROFILE_SCOPE("Mesh::Draw");
+            if(!instanceCount || !Prepare(instanceBuffer, instanceCount, mode))
+                return;
             if(elements)
-                glDrawElementsInstanced(mode, elements.count(), GL_UNSIGNED_INT, nullptr, instanceBuffer.count());
+                glDrawElementsInstanced(mode, elements.count(), GL_UNSIGNED_INT, nullptr, instanceCount);
             else
-                glDrawArraysInstanced(mode, 0, vertices.count(), instanceBuffer.count());
+                glDrawArraysInstanced(mode, 0, vertices.count(), instanceCount);
+        }
+        // instance count comes from the DrawIndirectCommand at offset in indirectBuffer, usually written by the GPU
+        void DrawIndirect(TypedSharedBuffer<InstanceData> instanceBuffer, const ConstSharedBuffer& indirectBuffer, GLintptr offset = 0, GLenum mode = GL_TRIANGLES)
+        {
+            PROFILE_SCOPE("Mesh::DrawIndirect");
+            if(!Prepare(instanceBuffer, instanceBuffer.count(), mode))
+                return;
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, indirectBuffer);
+            if(elements)
+                glDrawElementsIndirect(mode, GL_UNSIGNED_INT, (const void*)offset);
+            else
+                glDrawArraysIndirect(mode, (const void*)offset);
+            glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+        }
+        // vertex or element count for DrawIndirectCommand::count
+        inline GLuint drawCount() const
+        {
+            return elements ? elements.count() : vertices.count();
         }
     };
 }
\ No newline at end of file
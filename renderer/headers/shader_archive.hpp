@@ -0,0 +1,78 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include "lz4.hpp"
+
+namespace render
+{
+    // Processed shaders compiled into the binary, generated by `glsl_preprocess -batch -archive`.
+    // Sources are stored raw or as a single LZ4 block each, entries are sorted by name.
+    // This header is shared with glsl_preprocess, so it must not depend on GL.
+    struct ShaderArchiveEntry
+    {
+        const char* name;   // file name of the processed shader, e.g. "brdf.frag.glsl"
+        const uint8_t* data;
+        uint32_t storedSize;
+        uint32_t rawSize;   // storedSize == rawSize means uncompressed
+    };
+    class ShaderArchive
+    {
+    private:
+        const ShaderArchiveEntry* _entries;
+        size_t _count;
+    public:
+        constexpr ShaderArchive(const ShaderArchiveEntry* entries, size_t count) :
+            _entries(entries),
+            _count(count)
+        {}
+        inline size_t count() const
+        {
+            return _count;
+        }
+        inline const ShaderArchiveEntry* begin() const
+        {
+            return _entries;
+        }
+        inline const ShaderArchiveEntry* end() const
+        {
+            return _entries + _count;
+        }
+        const ShaderArchiveEntry* Find(std::string_view name) const
+        {
+            size_t first = 0, last = _count;
+            while(first < last)
+            {
+                size_t middle = (first + last) / 2;
+                int cmp = name.compare(_entries[middle].name);
+                if(cmp == 0)
+                    return _entries + middle;
+                if(cmp < 0)
+                    last = middle;
+                else
+                    first = middle + 1;
+            }
+            return nullptr;
+        }
+        // returns false if shader is not in the archive or its data is corrupted
+        bool Read(std::string_view name, std::string& out) const
+        {
+            const ShaderArchiveEntry* entry = Find(name);
+            if(!entry)
+                return false;
+            out.resize(entry->rawSize);
+            if(entry->storedSize == entry->rawSize)
+            {
+                std::memcpy(out.data(), entry->data, entry->rawSize);
+                return true;
+            }
+            return lz4::DecompressBlock(entry->data, entry->storedSize, reinterpret_cast<uint8_t*>(out.data()), out.size());
+        }
+    };
+
+    // archive of processed builtin shaders, defined in the generated shader_archive.cpp linked into librenderer
+    extern const ShaderArchive builtin_shader_archive;
+}
\ No newline at end of file
@@ -0,0 +1,270 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "OpenGL_utils/buffer.hpp"
+#include "OpenGL_utils/framebuffer.hpp"
+#include "OpenGL_utils/profiler.hpp"
+#include "OpenGL_utils/texture.hpp"
+#include "builtin_shader.hpp"
+#include "camera.hpp"
+#include "mesh.hpp"
+
+namespace render
+{
+    // Cascaded shadow maps for the directional light of FragmentShaderBRDF::Lighting.
+    // Each cascade covers a depth slice of the camera frustum with a light space box fitted
+    // around the slice's bounding sphere, which does not change size when the camera rotates.
+    // A cascade only moves once the sphere leaves its box, and then snaps to whole texels,
+    // so shadow edges stay stable while the camera moves.
+    // Static casters are rendered into their own depth array, which is reused for as long as
+    // the light and the cascade boxes stay put. Dynamic casters are drawn every frame on top
+    // of a copy of the static depth.
+    // Only perspective cameras are supported.
+    class CascadedShadowMaps
+    {
+    public:
+        static constexpr GLuint MAX_CASCADES = 4;
+    private:
+        struct ShadowUniformData // std140
+        {
+            glm::mat4 shadowMatrices[MAX_CASCADES]; // view space to shadow map texture space
+            glm::vec4 cascadeSplits; // far view depth of each cascade
+        };
+        struct Caster
+        {
+            Mesh* mesh;
+            TypedSharedBuffer<InstanceData> instances;
+        };
+        struct Cascade
+        {
+            glm::vec3 center = glm::vec3(0.f);
+            float extent = 0.f;          // half size of the light space box, zero until first fitted
+            glm::mat4 viewProjection{1.f};
+            bool staticValid = false;    // static depth layer matches viewProjection
+        };
+
+        GLsizei _size;
+        GLuint _cascadeCount;
+        Texture2DArray _staticDepth, _depth;
+        Framebuffer _framebuffer;
+        std::array<Camera, MAX_CASCADES> _cascadeCameras; // light view projection as custom projection
+        std::array<Cascade, MAX_CASCADES> _cascades;
+        TypedSharedBuffer<ShadowUniformData> _shadowBuffer{1};
+        std::vector<Caster> _staticCasters, _dynamicCasters;
+        glm::vec3 _lightDirection = glm::vec3(0.f);
+        GLuint _staticRenders = 0;
+
+        static Texture2DArray DepthArray(GLsizei size, GLuint layers)
+        {
+            Texture2DArray depth(1, GL_DEPTH_COMPONENT32F, 1, size, size, layers);
+            glTextureParameteri(depth, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+            glTextureParameteri(depth, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+            glTextureParameteri(depth, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+            glTextureParameteri(depth, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+            // hardware 2x2 PCF through sampler2DArrayShadow
+            glTextureParameteri(depth, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+            glTextureParameteri(depth, GL_TEXTURE_COMPARE_FUNC, GL_LEQUAL);
+            depth.Label(GpuMemoryCategory::RENDER_TARGET, "Shadow cascades");
+            return depth;
+        }
+        // Fits cascade around the sphere, returns true if it had to move.
+        bool Fit(Cascade& cascade, glm::vec3 center, float radius)
+        {
+            float extent = radius * (1.f + recenterMargin);
+            if(cascade.extent == extent && glm::distance(center, cascade.center) + radius <= extent)
+                return false;
+
+            // snap the center to whole texels in light space
+            glm::vec3 up = std::abs(_lightDirection.y) > 0.99f ? glm::vec3(1.f, 0.f, 0.f) : glm::vec3(0.f, 1.f, 0.f);
+            glm::mat4 lightRotation = glm::lookAt(glm::vec3(0.f), -_lightDirection, up);
+            glm::vec3 lightCenter = glm::vec3(lightRotation * glm::vec4(center, 1.f));
+            float texel = 2.f * extent / _size;
+            lightCenter.x = std::floor(lightCenter.x / texel) * texel;
+            lightCenter.y = std::floor(lightCenter.y / texel) * texel;
+            cascade.center = glm::vec3(glm::inverse(lightRotation) * glm::vec4(lightCenter, 1.f));
+            cascade.extent = extent;
+
+            glm::vec3 eye = cascade.center + _lightDirection * (extent + casterDistance);
+            glm::mat4 view = glm::lookAt(eye, cascade.center, up);
+            glm::mat4 projection = glm::ortho(-extent, extent, -extent, extent, 0.f, 2.f * extent + casterDistance);
+            cascade.viewProjection = projection * view;
+            return true;
+        }
+        void DrawCasters(std::vector<Caster>& casters)
+        {
+            for(Caster& caster : casters)
+                caster.mesh->Draw(caster.instances);
+        }
+    public:
+        float shadowDistance = 100.f; // view depth covered by the last cascade, capped by the camera far plane
+        float splitLambda = 0.75f;    // 0 = uniform splits, 1 = logarithmic splits
+        float casterDistance = 50.f;  // how far behind a cascade towards the light casters are still captured
+        float recenterMargin = 0.15f; // extra cascade size, lets the camera move before cascades (and the static cache) move
+        float slopeBias = 2.f;        // glPolygonOffset factor
+        float constantBias = 4.f;     // glPolygonOffset units
+        float lightTolerance = 1e-5f; // 1 - cosine of the light rotation that invalidates the cascades, absorbs
+                                      // the rounding of the world direction derived from the view space one
+
+        CascadedShadowMaps(GLsizei size = 2048, GLuint cascadeCount = MAX_CASCADES) :
+            _size(size),
+            _cascadeCount(std::min(cascadeCount, MAX_CASCADES)),
+            _staticDepth(DepthArray(size, _cascadeCount)),
+            _depth(DepthArray(size, _cascadeCount))
+        {
+            _framebuffer.DrawBuffer(GL_NONE);
+            _shadowBuffer.Label(GpuMemoryCategory::UNIFORM, "Shadows");
+            for(Camera& camera : _cascadeCameras)
+            {
+                camera.resolution = glm::uvec2(size);
+                camera.view();
+                camera.inverse_view();
+            }
+        }
+        CascadedShadowMaps(const CascadedShadowMaps&) = delete;
+        CascadedShadowMaps& operator=(const CascadedShadowMaps&) = delete;
+
+        // static casters are cached, adding one re-renders the static depth of every cascade
+        void AddCaster(Mesh& mesh, TypedSharedBuffer<InstanceData> instances, bool isStatic)
+        {
+            (isStatic ? _staticCasters : _dynamicCasters).push_back(Caster{&mesh, instances});
+            if(isStatic)
+                InvalidateStatic();
+        }
+        void ClearCasters()
+        {
+            _staticCasters.clear();
+            _dynamicCasters.clear();
+            InvalidateStatic();
+        }
+        // call after moving or changing static casters
+        void InvalidateStatic()
+        {
+            for(Cascade& cascade : _cascades)
+                cascade.staticValid = false;
+        }
+        // cascade static depth renders since construction, for checking the cache is effective
+        inline GLuint staticRenders() const
+        {
+            return _staticRenders;
+        }
+        inline GLuint cascadeCount() const
+        {
+            return _cascadeCount;
+        }
+
+        // Fits cascades to the camera, renders invalid static layers and the dynamic casters,
+        // and enables shadows in the lighting UBO.
+        // Needs an active ShaderVariantCache for the depth only variant.
+        // Restores the framebuffers and viewport bound before, leaves the camera UBO,
+        // the shadow UBO and the depth array bound as with Use().
+        void Render(Camera& camera, FragmentShaderBRDF::Lighting& lighting)
+        {
+            PROFILE_SCOPE_CPU_GPU("CascadedShadowMaps");
+            ShaderVariantCache* variants = ShaderVariantCache::active;
+            if(!variants)
+            {
+                std::fputs("Error: Cascaded shadow maps need an active ShaderVariantCache!\n", stderr);
+                return;
+            }
+            if(!variants->PrewarmDepthOnly().ready())
+            {
+                lighting.uniformData.shadowCascadeCount = 0; // depth variant still compiling
+                return;
+            }
+            const glm::mat4& inverseView = camera.inverse_view();
+            const glm::mat4& projection = camera.projection();
+
+            // the lighting UBO holds the direction towards the light in view space
+            glm::vec3 lightDirection = glm::normalize(glm::vec3(inverseView * glm::vec4(lighting.uniformData.view_lightDirection, 0.f)));
+            if(glm::dot(lightDirection, _lightDirection) < 1.f - lightTolerance)
+            {
+                _lightDirection = lightDirection;
+                for(Cascade& cascade : _cascades)
+                    cascade = Cascade{};
+            }
+
+            float nearPlane = camera.nearPlane;
+            float farPlane = std::min(camera.farPlane, shadowDistance);
+            float tanX = 1.f / projection[0][0], tanY = 1.f / projection[1][1];
+            float diagonal2 = tanX * tanX + tanY * tanY; // squared half diagonal per unit of depth
+            float sliceNear = nearPlane;
+            ShadowUniformData& shadowData = _shadowBuffer[0];
+            for(GLuint c = 0; c < _cascadeCount; c++)
+            {
+                float t = (float)(c + 1) / _cascadeCount;
+                float sliceFar = glm::mix(nearPlane + (farPlane - nearPlane) * t, nearPlane * std::pow(farPlane / nearPlane, t), splitLambda);
+                // sphere center on the view axis with equal distance to the near and far corners,
+                // so the radius does not depend on the camera orientation
+                float centerDepth = std::clamp((sliceFar * sliceFar - sliceNear * sliceNear) * (1.f + diagonal2) / (2.f * (sliceFar - sliceNear)),
+                                               sliceNear, sliceFar);
+                float radius = std::max(std::sqrt(sliceNear * sliceNear * diagonal2 + (centerDepth - sliceNear) * (centerDepth - sliceNear)),
+                                        std::sqrt(sliceFar * sliceFar * diagonal2 + (sliceFar - centerDepth) * (sliceFar - centerDepth)));
+                glm::vec3 center = glm::vec3(inverseView * glm::vec4(0.f, 0.f, -centerDepth, 1.f));
+
+                Cascade& cascade = _cascades[c];
+                if(Fit(cascade, center, radius))
+                    cascade.staticValid = false;
+                _cascadeCameras[c].customProjection(cascade.viewProjection);
+
+                glm::mat4 bias(0.5f);
+                bias[3] = glm::vec4(0.5f, 0.5f, 0.5f, 1.f);
+                shadowData.shadowMatrices[c] = bias * cascade.viewProjection * inverseView;
+                shadowData.cascadeSplits[c] = sliceFar;
+                sliceNear = sliceFar;
+            }
+
+            GLint drawFramebuffer = 0, readFramebuffer = 0, viewport[4];
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &drawFramebuffer);
+            glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &readFramebuffer);
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            bool wasDepthOnly = variants->depthOnly();
+            variants->SetDepthOnly(true);
+            _framebuffer.Bind();
+            glViewport(0, 0, _size, _size);
+            glEnable(GL_POLYGON_OFFSET_FILL);
+            glPolygonOffset(slopeBias, constantBias);
+            const float clearDepth = 1.f;
+            for(GLuint c = 0; c < _cascadeCount; c++)
+            {
+                Cascade& cascade = _cascades[c];
+                _cascadeCameras[c].Use();
+                if(!cascade.staticValid)
+                {
+                    _framebuffer.AttachTextureLayer(GL_DEPTH_ATTACHMENT, _staticDepth, c);
+                    glClearNamedFramebufferfv(_framebuffer, GL_DEPTH, 0, &clearDepth);
+                    DrawCasters(_staticCasters);
+                    cascade.staticValid = true;
+                    _staticRenders++;
+                }
+                if(_dynamicCasters.empty())
+                    continue;
+                glCopyImageSubData(_staticDepth, GL_TEXTURE_2D_ARRAY, 0, 0, 0, c,
+                                   _depth, GL_TEXTURE_2D_ARRAY, 0, 0, 0, c, _size, _size, 1);
+                _framebuffer.AttachTextureLayer(GL_DEPTH_ATTACHMENT, _depth, c);
+                DrawCasters(_dynamicCasters);
+            }
+            glDisable(GL_POLYGON_OFFSET_FILL);
+            variants->SetDepthOnly(wasDepthOnly);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, drawFramebuffer);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, readFramebuffer);
+            glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+            camera.Use();
+            Use();
+
+            lighting.uniformData.shadowCascadeCount = _cascadeCount;
+        }
+        // without dynamic casters the static depth is sampled directly and no copy is made
+        void Use() const
+        {
+            glBindBufferBase(GL_UNIFORM_BUFFER, SHADOW_BINDING_POINT, _shadowBuffer);
+            glBindTextureUnit(FragmentShaderBRDF::SHADOW_MAP_UNIT, _dynamicCasters.empty() ? _staticDepth : _depth);
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,407 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#if defined(__x86_64__) || defined(__i386__)
+#define RENDER_SOFTWARE_OCCLUSION_X86
+#include <immintrin.h>
+#endif
+
+#include "OpenGL_utils/profiler.hpp"
+#include "camera.hpp"
+#include "mesh.hpp"
+
+namespace render
+{
+    // CPU occlusion culling for setups without GPU culling or readback.
+    // A few low poly occluder proxies are rasterized into a small depth buffer split into 8x8 pixel tiles,
+    // every tile also keeps its farthest depth, so most instance tests only look at tile depths.
+    // Tile rows are distributed over worker threads and rasterized 8 pixels at a time
+    // (AVX2 where the CPU has it, picked at runtime, SSE2 or scalar otherwise), each thread owns whole tile rows.
+    // Instances are tested with their mesh bounds before submission, hidden ones cost no draw work at all.
+    // Occluders are sampled at pixel centers, so proxies should stay inside the mesh they stand in for.
+    class SoftwareOcclusionCuller
+    {
+    public:
+        static constexpr uint32_t TILE_SIZE = 8;
+    private:
+        struct Occluder
+        {
+            std::vector<glm::vec3> positions;
+            std::vector<GLuint> elements; // triangle list, empty for unindexed positions
+            glm::mat4 model;
+        };
+        // screen space triangle, inside where all edge functions a * x + b * y + c are >= 0
+        struct Triangle
+        {
+            float edgeA[3], edgeB[3], edgeC[3];
+            float depthA, depthB, depthC; // depth plane
+            int32_t minX, maxX, minY, maxY; // pixel bounds, inclusive
+        };
+
+        glm::uvec2 _resolution;
+        glm::uvec2 _tiles;
+        std::vector<float> _depth;    // window depth per pixel, 1 where no occluder
+        std::vector<float> _tileMax;  // farthest depth per tile
+        std::vector<Occluder> _occluders;
+        std::vector<Triangle> _triangles;
+        std::vector<std::vector<uint32_t>> _rowTriangles; // triangles touching each tile row
+        glm::mat4 _viewProjection{1.f};
+        bool _avx2 = false;
+
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _startCondition, _doneCondition;
+        uint64_t _generation = 0;
+        uint32_t _busyWorkers = 0;
+        bool _quit = false;
+        std::atomic<uint32_t> _nextRow{0};
+
+        // transforms the occluders and bins their triangles into tile rows
+        void SetupTriangles()
+        {
+            _triangles.clear();
+            for(std::vector<uint32_t>& row : _rowTriangles)
+                row.clear();
+            glm::vec2 scale = glm::vec2(_resolution) * 0.5f;
+            for(const Occluder& occluder : _occluders)
+            {
+                glm::mat4 mvp = _viewProjection * occluder.model;
+                GLuint count = occluder.elements.empty() ? occluder.positions.size() : occluder.elements.size();
+                for(GLuint i = 0; i + 2 < count; i += 3)
+                {
+                    glm::vec3 v[3];
+                    bool clipped = false;
+                    for(int k = 0; k < 3; k++)
+                    {
+                        GLuint index = occluder.elements.empty() ? i + k : occluder.elements[i + k];
+                        glm::vec4 clip = mvp * glm::vec4(occluder.positions[index], 1.f);
+                        // triangles crossing the near plane are dropped, which only loses occlusion
+                        if(clip.z < -clip.w || clip.w <= 0.f)
+                        {
+                            clipped = true;
+                            break;
+                        }
+                        glm::vec3 ndc = glm::vec3(clip) / clip.w;
+                        v[k] = glm::vec3((ndc.x + 1.f) * scale.x, (ndc.y + 1.f) * scale.y, ndc.z * 0.5f + 0.5f);
+                    }
+                    if(clipped)
+                        continue;
+                    float area = (v[1].x - v[0].x) * (v[2].y - v[0].y) - (v[1].y - v[0].y) * (v[2].x - v[0].x);
+                    if(std::abs(area) < 1e-6f)
+                        continue;
+                    if(area < 0.f) // occluders are rasterized with both windings
+                    {
+                        std::swap(v[1], v[2]);
+                        area = -area;
+                    }
+
+                    Triangle triangle;
+                    triangle.minX = std::max((int32_t)std::floor(std::min({v[0].x, v[1].x, v[2].x})), 0);
+                    triangle.maxX = std::min((int32_t)std::ceil(std::max({v[0].x, v[1].x, v[2].x})), (int32_t)_resolution.x - 1);
+                    triangle.minY = std::max((int32_t)std::floor(std::min({v[0].y, v[1].y, v[2].y})), 0);
+                    triangle.maxY = std::min((int32_t)std::ceil(std::max({v[0].y, v[1].y, v[2].y})), (int32_t)_resolution.y - 1);
+                    if(triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+                        continue;
+                    for(int k = 0; k < 3; k++)
+                    {
+                        const glm::vec3& a = v[(k + 1) % 3];
+                        const glm::vec3& b = v[(k + 2) % 3];
+                        triangle.edgeA[k] = a.y - b.y;
+                        triangle.edgeB[k] = b.x - a.x;
+                        triangle.edgeC[k] = a.x * b.y - a.y * b.x;
+                    }
+                    // barycentric interpolation of depth, edge k is opposite to vertex k
+                    float inverseArea = 1.f / area;
+                    triangle.depthA = triangle.depthB = triangle.depthC = 0.f;
+                    for(int k = 0; k < 3; k++)
+                    {
+                        triangle.depthA += triangle.edgeA[k] * inverseArea * v[k].z;
+                        triangle.depthB += triangle.edgeB[k] * inverseArea * v[k].z;
+                        triangle.depthC += triangle.edgeC[k] * inverseArea * v[k].z;
+                    }
+
+                    uint32_t index = _triangles.size();
+                    _triangles.push_back(triangle);
+                    for(int32_t row = triangle.minY / TILE_SIZE; row <= triangle.maxY / (int32_t)TILE_SIZE; row++)
+                        _rowTriangles[row].push_back(index);
+                }
+            }
+        }
+#if defined(RENDER_SOFTWARE_OCCLUSION_X86)
+        // depth test and write of the 8 pixel spans from firstX to maxX of one pixel row
+        __attribute__((target("avx2"))) static void RasterizeSpansAVX2(const Triangle& t, float* depth, int32_t firstX, int32_t maxX, float pixelY)
+        {
+            __m256 py = _mm256_set1_ps(pixelY);
+            for(int32_t x = firstX; x <= maxX; x += TILE_SIZE)
+            {
+                __m256 px = _mm256_add_ps(_mm256_set1_ps(x + 0.5f), _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f));
+                __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+                for(int k = 0; k < 3; k++)
+                {
+                    __m256 e = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(t.edgeA[k]), px),
+                                                           _mm256_mul_ps(_mm256_set1_ps(t.edgeB[k]), py)), _mm256_set1_ps(t.edgeC[k]));
+                    inside = _mm256_and_ps(inside, _mm256_cmp_ps(e, _mm256_setzero_ps(), _CMP_GE_OQ));
+                }
+                if(_mm256_movemask_ps(inside) == 0)
+                    continue;
+                __m256 z = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(t.depthA), px),
+                                                       _mm256_mul_ps(_mm256_set1_ps(t.depthB), py)), _mm256_set1_ps(t.depthC));
+                __m256 old = _mm256_loadu_ps(depth + x);
+                _mm256_storeu_ps(depth + x, _mm256_blendv_ps(old, _mm256_min_ps(old, z), inside));
+            }
+        }
+#endif
+        static void RasterizeSpans(const Triangle& t, float* depth, int32_t firstX, int32_t maxX, float pixelY)
+        {
+            for(int32_t x = firstX; x <= maxX; x += TILE_SIZE)
+            {
+#if defined(__SSE2__)
+                __m128 py = _mm_set1_ps(pixelY);
+                for(int32_t half = 0; half < 8; half += 4)
+                {
+                    __m128 px = _mm_add_ps(_mm_set1_ps(x + half + 0.5f), _mm_setr_ps(0.f, 1.f, 2.f, 3.f));
+                    __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+                    for(int k = 0; k < 3; k++)
+                    {
+                        __m128 e = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.edgeA[k]), px),
+                                                         _mm_mul_ps(_mm_set1_ps(t.edgeB[k]), py)), _mm_set1_ps(t.edgeC[k]));
+                        inside = _mm_and_ps(inside, _mm_cmpge_ps(e, _mm_setzero_ps()));
+                    }
+                    if(_mm_movemask_ps(inside) == 0)
+                        continue;
+                    __m128 z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_set1_ps(t.depthA), px),
+                                                     _mm_mul_ps(_mm_set1_ps(t.depthB), py)), _mm_set1_ps(t.depthC));
+                    __m128 old = _mm_loadu_ps(depth + x + half);
+                    __m128 nearest = _mm_min_ps(old, z);
+                    _mm_storeu_ps(depth + x + half, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, old)));
+                }
+#else
+                for(int32_t i = x; i < x + (int32_t)TILE_SIZE; i++)
+                {
+                    float pixelX = i + 0.5f;
+                    bool inside = true;
+                    for(int k = 0; k < 3; k++)
+                        inside &= t.edgeA[k] * pixelX + t.edgeB[k] * pixelY + t.edgeC[k] >= 0.f;
+                    if(inside)
+                        depth[i] = std::min(depth[i], t.depthA * pixelX + t.depthB * pixelY + t.depthC);
+                }
+#endif
+            }
+        }
+        void RasterizeRow(uint32_t row)
+        {
+            int32_t rowMinY = row * TILE_SIZE, rowMaxY = rowMinY + TILE_SIZE - 1;
+            std::fill(_depth.begin() + rowMinY * _resolution.x, _depth.begin() + (rowMaxY + 1) * _resolution.x, 1.f);
+            for(uint32_t index : _rowTriangles[row])
+            {
+                const Triangle& t = _triangles[index];
+                int32_t firstX = t.minX & ~(int32_t)(TILE_SIZE - 1);
+                for(int32_t y = std::max(t.minY, rowMinY); y <= std::min(t.maxY, rowMaxY); y++)
+                {
+                    float* depth = _depth.data() + y * _resolution.x;
+#if defined(RENDER_SOFTWARE_OCCLUSION_X86)
+                    if(_avx2)
+                    {
+                        RasterizeSpansAVX2(t, depth, firstX, t.maxX, y + 0.5f);
+                        continue;
+                    }
+#endif
+                    RasterizeSpans(t, depth, firstX, t.maxX, y + 0.5f);
+                }
+            }
+            for(uint32_t tile = 0; tile < _tiles.x; tile++)
+            {
+                float farthest = 0.f;
+                for(int32_t y = rowMinY; y <= rowMaxY; y++)
+                {
+                    const float* depth = _depth.data() + y * _resolution.x + tile * TILE_SIZE;
+                    for(uint32_t x = 0; x < TILE_SIZE; x++)
+                        farthest = std::max(farthest, depth[x]);
+                }
+                _tileMax[row * _tiles.x + tile] = farthest;
+            }
+        }
+        void RasterizeRows()
+        {
+            PROFILE_SCOPE("SoftwareOcclusionCuller::RasterizeRows");
+            for(uint32_t row; (row = _nextRow.fetch_add(1, std::memory_order_relaxed)) < _tiles.y;)
+                RasterizeRow(row);
+        }
+        void WorkerLoop()
+        {
+            uint64_t seen = 0;
+            while(true)
+            {
+                {
+                    std::unique_lock lock(_mutex);
+                    _startCondition.wait(lock, [&]{ return _quit || _generation != seen; });
+                    if(_quit)
+                        return;
+                    seen = _generation;
+                }
+                RasterizeRows();
+                std::lock_guard lock(_mutex);
+                if(--_busyWorkers == 0)
+                    _doneCondition.notify_one();
+            }
+        }
+    public:
+        // resolution is rounded up to whole tiles, low resolutions are usually enough for culling
+        SoftwareOcclusionCuller(glm::uvec2 resolution = glm::uvec2(320, 192), uint32_t threadCount = std::thread::hardware_concurrency()) :
+            _resolution((resolution + TILE_SIZE - 1u) / TILE_SIZE * TILE_SIZE),
+            _tiles(_resolution / TILE_SIZE),
+            _depth(_resolution.x * _resolution.y, 1.f),
+            _tileMax(_tiles.x * _tiles.y, 1.f),
+            _rowTriangles(_tiles.y)
+        {
+#if defined(RENDER_SOFTWARE_OCCLUSION_X86)
+            _avx2 = __builtin_cpu_supports("avx2");
+#endif
+            uint32_t workerCount = std::min(threadCount, _tiles.y) > 1 ? std::min(threadCount, _tiles.y) - 1 : 0;
+            for(uint32_t i = 0; i < workerCount; i++)
+                _workers.emplace_back(&SoftwareOcclusionCuller::WorkerLoop, this);
+        }
+        SoftwareOcclusionCuller(const SoftwareOcclusionCuller&) = delete;
+        SoftwareOcclusionCuller& operator=(const SoftwareOcclusionCuller&) = delete;
+        ~SoftwareOcclusionCuller()
+        {
+            {
+                std::lock_guard lock(_mutex);
+                _quit = true;
+            }
+            _startCondition.notify_all();
+            for(std::thread& worker : _workers)
+                worker.join();
+        }
+
+        // Mesh buffers are write only, so occluders keep a CPU copy of their triangle list.
+        // elements may be null for unindexed positions, model places the proxy in world space.
+        size_t AddOccluder(const glm::vec3* positions, GLuint vertexCount, const GLuint* elements = nullptr, GLuint elementCount = 0,
+                           const glm::mat4& model = glm::mat4(1.f))
+        {
+            Occluder occluder;
+            occluder.positions.assign(positions, positions + vertexCount);
+            if(elements)
+                occluder.elements.assign(elements, elements + elementCount);
+            occluder.model = model;
+            _occluders.push_back(std::move(occluder));
+            return _occluders.size() - 1;
+        }
+        void SetOccluderModel(size_t occluder, const glm::mat4& model)
+        {
+            _occluders[occluder].model = model;
+        }
+        void ClearOccluders()
+        {
+            _occluders.clear();
+        }
+
+        // rasterizes all occluders with the camera's current matrices
+        void Rasterize(Camera& camera)
+        {
+            _viewProjection = camera.projection() * camera.view();
+            SetupTriangles();
+
+            _nextRow.store(0, std::memory_order_relaxed);
+            if(!_workers.empty())
+            {
+                std::lock_guard lock(_mutex);
+                _busyWorkers = _workers.size();
+                _generation++;
+            }
+            _startCondition.notify_all();
+            RasterizeRows();
+            if(!_workers.empty())
+            {
+                std::unique_lock lock(_mutex);
+                _doneCondition.wait(lock, [&]{ return _busyWorkers == 0; });
+            }
+        }
+
+        // true unless the box is outside the frustum or behind the rasterized occluders
+        bool Visible(const glm::vec3& boundsMin, const glm::vec3& boundsMax, const glm::mat4& model) const
+        {
+            glm::mat4 mvp = _viewProjection * model;
+            glm::vec3 lo(INFINITY), hi(-INFINITY);
+            uint32_t behind = 0;
+            for(uint32_t c = 0; c < 8; c++)
+            {
+                glm::vec4 clip = mvp * glm::vec4(c & 1 ? boundsMax.x : boundsMin.x, c & 2 ? boundsMax.y : boundsMin.y,
+                                                 c & 4 ? boundsMax.z : boundsMin.z, 1.f);
+                if(clip.w <= 0.f)
+                {
+                    behind++;
+                    continue;
+                }
+                glm::vec3 ndc = glm::vec3(clip) / clip.w;
+                lo = glm::min(lo, ndc);
+                hi = glm::max(hi, ndc);
+            }
+            if(behind)
+                return behind < 8; // crossing the camera plane leaves no usable screen rect
+            if(hi.x < -1.f || lo.x > 1.f || hi.y < -1.f || lo.y > 1.f || lo.z > 1.f)
+                return false;
+
+            float nearest = lo.z * 0.5f + 0.5f;
+            glm::vec2 scale = glm::vec2(_resolution) * 0.5f;
+            int32_t x0 = std::max((int32_t)std::floor((lo.x + 1.f) * scale.x), 0);
+            int32_t x1 = std::min((int32_t)std::ceil((hi.x + 1.f) * scale.x), (int32_t)_resolution.x) - 1;
+            int32_t y0 = std::max((int32_t)std::floor((lo.y + 1.f) * scale.y), 0);
+            int32_t y1 = std::min((int32_t)std::ceil((hi.y + 1.f) * scale.y), (int32_t)_resolution.y) - 1;
+            for(int32_t tileY = y0 / TILE_SIZE; tileY <= y1 / (int32_t)TILE_SIZE; tileY++)
+                for(int32_t tileX = x0 / TILE_SIZE; tileX <= x1 / (int32_t)TILE_SIZE; tileX++)
+                {
+                    if(nearest > _tileMax[tileY * _tiles.x + tileX])
+                        continue; // whole tile is in front of the box
+                    // the box is in front of some pixel of the tile, check the ones it covers
+                    for(int32_t y = std::max(y0, tileY * (int32_t)TILE_SIZE); y <= std::min(y1, (tileY + 1) * (int32_t)TILE_SIZE - 1); y++)
+                    {
+                        const float* depth = _depth.data() + y * _resolution.x;
+                        for(int32_t x = std::max(x0, tileX * (int32_t)TILE_SIZE); x <= std::min(x1, (tileX + 1) * (int32_t)TILE_SIZE - 1); x++)
+                            if(nearest <= depth[x])
+                                return true;
+                    }
+                }
+            return false;
+        }
+        // Copies the visible instances of mesh into visible and returns their count, for Mesh::DrawInstances.
+        // Instances are read from a CPU copy, as instance buffers are mapped write only.
+        // Meshes without bounds are never culled.
+        GLuint Cull(const Mesh& mesh, const InstanceData* instances, GLuint count, InstanceData* visible) const
+        {
+            GLuint visibleCount = 0;
+            for(GLuint i = 0; i < count; i++)
+                if(!mesh.hasBounds() || Visible(mesh.boundsMin, mesh.boundsMax, instances[i].model))
+                    visible[visibleCount++] = instances[i];
+            return visibleCount;
+        }
+
+        inline const glm::uvec2& resolution() const
+        {
+            return _resolution;
+        }
+        // window depth per pixel of the last Rasterize, rows bottom to top, for debugging
+        inline const std::vector<float>& depth() const
+        {
+            return _depth;
+        }
+        // rows are rasterized with AVX2, else with SSE2 or scalar code
+        inline bool avx2() const
+        {
+            return _avx2;
+        }
+        // occluder triangles that passed setup in the last Rasterize
+        inline size_t triangleCount() const
+        {
+            return _triangles.size();
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+#include <cstdio>
+#include <unordered_map>
+#include <vector>
+#include <GL/glew.h>
+
+#include "OpenGL_utils/texture.hpp"
+
+namespace render
+{
+    // Groups 2D textures with the same size, internal format and level count
+    // into 2D array textures, copying them on the GPU.
+    // Every added texture ends up in some array, groups of one become single layer arrays,
+    // so shaders can always sample through sampler2DArray.
+    class TextureArrayPacker
+    {
+    public:
+        struct Location
+        {
+            Texture2DArray array;
+            GLint layer = -1;
+        };
+    private:
+        std::vector<Texture> _pending;
+        std::vector<Texture2DArray> _arrays;
+        // source Texture::id() -> array layer, GL names are recycled once sources are released
+        std::unordered_map<uint64_t, Location> _locations;
+
+        static bool Compatible(const Texture& a, const Texture& b)
+        {
+            return a->width == b->width && a->height == b->height &&
+                   a->internal_format == b->internal_format && a->levels == b->levels;
+        }
+    public:
+        // duplicates and already packed textures are ignored
+        bool Add(const Texture& texture)
+        {
+            if(!texture || texture->target != GL_TEXTURE_2D)
+            {
+                std::fputs("Error: Only 2D textures can be packed into texture arrays!\n", stderr);
+                return false;
+            }
+            if(_locations.contains(texture.id()))
+                return true;
+            for(const Texture& pending : _pending)
+                if(pending.id() == texture.id())
+                    return true;
+            _pending.push_back(texture);
+            return true;
+        }
+        // creates arrays for all pending textures,
+        // the source textures are no longer referenced afterwards and can be released
+        void Build()
+        {
+            GLint maxLayers = 0;
+            glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+            std::vector<bool> packed(_pending.size(), false);
+            for(size_t first = 0; first < _pending.size(); first++)
+            {
+                if(packed[first])
+                    continue;
+                std::vector<size_t> group;
+                for(size_t i = first; i < _pending.size() && (GLint)group.size() < maxLayers; i++)
+                    if(!packed[i] && Compatible(_pending[first], _pending[i]))
+                    {
+                        group.push_back(i);
+                        packed[i] = true;
+                    }
+
+                const Texture& ref = _pending[first];
+                Texture2DArray array(ref->levels, ref->internal_format, ref->comp_num, ref->width, ref->height, group.size());
+                for(GLint layer = 0; layer < (GLint)group.size(); layer++)
+                {
+                    const Texture& src = _pending[group[layer]];
+                    array.CopyLayer(src, layer);
+                    _locations[src.id()] = Location{array, layer};
+                }
+                _arrays.push_back(array);
+            }
+            _pending.clear();
+        }
+        // returns nullptr for textures that were not packed
+        const Location* Find(const Texture& texture) const
+        {
+            auto it = _locations.find(texture.id());
+            return it == _locations.end() ? nullptr : &it->second;
+        }
+        inline const std::vector<Texture2DArray>& arrays() const
+        {
+            return _arrays;
+        }
+    };
+}
\ No newline at end of file
@@ -0,0 +1,151 @@
+#pragma once
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <vector>
+#include <GL/glew.h>
+
+#include "OpenGL_utils/gpu_memory.hpp"
+#include "OpenGL_utils/texture.hpp"
+#include "builtin_shader.hpp"
+
+namespace render
+{
+    // Keeps textures within the TEXTURE budget of GpuMemory by evicting mip levels.
+    // Material::Use() stamps textures with the current frame, Update() once per frame then
+    // - reloads evicted textures used in the last frame at full resolution, as far as the budget allows
+    // - drops the largest level of the least recently used texture not used in the last frame until within budget
+    // Dropped levels are really freed, the texture is reallocated smaller and its copies sample the remaining
+    // levels until the reload. Pinned textures, e.g. with resident bindless handles, and textures
+    // without mipmaps are never evicted.
+    class TextureResidency
+    {
+    public:
+        // loads the full resolution texture again, e.g. from the Image or asset archive it came from
+        using Source = std::function<Texture2D()>;
+    private:
+        struct Entry
+        {
+            Texture2D texture;
+            Source source;
+            GLsizei levels, width, height; // of the full resolution
+        };
+        std::vector<Entry> _entries;
+        uint64_t _evictions = 0, _reloads = 0;
+
+        static inline bool Evicted(const Entry& entry)
+        {
+            return entry.texture->levels < entry.levels;
+        }
+        uint32_t Reload(uint64_t frame)
+        {
+            uint32_t reloaded = 0;
+            uint64_t budget = GpuMemory::budget(GpuMemoryCategory::TEXTURE);
+            for(Entry& entry : _entries)
+            {
+                if(reloaded >= maxReloadsPerFrame)
+                    break;
+                if(!Evicted(entry) || entry.texture.lastUsedFrame() + 1 < frame)
+                    continue;
+                uint64_t missing = TextureStorageSize(entry.texture->internal_format, entry.width, entry.height, 1, entry.levels) -
+                                   TextureStorageSize(entry.texture->internal_format, entry.texture->width, entry.texture->height, 1, entry.texture->levels);
+                if(budget && GpuMemory::used(GpuMemoryCategory::TEXTURE) + missing > budget)
+                    continue;
+                Texture2D full = entry.source();
+                if(full->levels != entry.levels || full->width != entry.width || full->height != entry.height ||
+                   full->internal_format != entry.texture->internal_format)
+                {
+                    std::fputs("Error: Texture reload does not match the evicted texture!\n", stderr);
+                    continue;
+                }
+                entry.texture.ReplaceStorage(std::move(full));
+                ++reloaded;
+            }
+            return reloaded;
+        }
+        uint32_t Evict(uint64_t frame)
+        {
+            uint32_t evicted = 0;
+            while(GpuMemory::overBudget(GpuMemoryCategory::TEXTURE))
+            {
+                Entry* lru = nullptr;
+                for(Entry& entry : _entries)
+                {
+                    const Texture2D& texture = entry.texture;
+                    if(texture.lastUsedFrame() + 1 >= frame || texture.pinned() || texture->levels < 2 ||
+                       std::max(texture->width, texture->height) / 2 < minResidentSize)
+                        continue;
+                    if(!lru || texture.lastUsedFrame() < lru->texture.lastUsedFrame())
+                        lru = &entry;
+                }
+                if(!lru || !lru->texture.DropLevels(1))
+                    break;
+                ++evicted;
+            }
+            return evicted;
+        }
+    public:
+        // evicted textures are not reduced below this width or height in pixels
+        GLsizei minResidentSize = 32;
+        // bounds the hitches from reloads, each is a full upload and mipmap generation
+        uint32_t maxReloadsPerFrame = 2;
+
+        TextureResidency() = default;
+        TextureResidency(const TextureResidency&) = delete;
+        TextureResidency& operator=(const TextureResidency&) = delete;
+
+        // texture has to be at full resolution, source has to reproduce it with equal size, levels and format
+        void Add(const Texture2D& texture, Source source)
+        {
+            if(!texture)
+                return;
+            _entries.push_back(Entry{texture, std::move(source), texture->levels, texture->width, texture->height});
+        }
+        // reloads from image, levels below the first are generated
+        void Add(const Texture2D& texture, Image image)
+        {
+            if(!texture)
+                return;
+            GLsizei levels = texture->levels;
+            GLenum format = texture->internal_format;
+            Add(texture, [image, levels, format]() mutable
+            {
+                Texture2D full(image, levels, format);
+                if(levels > 1)
+                    glGenerateTextureMipmap(full);
+                return full;
+            });
+        }
+        void Remove(const Texture& texture)
+        {
+            std::erase_if(_entries, [&](const Entry& entry) { return (GLuint)entry.texture == (GLuint)texture; });
+        }
+        // call once per frame before drawing, false when no texture changed
+        bool Update()
+        {
+            uint64_t frame = GpuMemory::frame();
+            uint32_t reloaded = Reload(frame);
+            uint32_t evicted = Evict(frame);
+            _reloads += reloaded;
+            _evictions += evicted;
+            // replaced storage has new names, cached texture unit bindings may refer to deleted ones
+            if(reloaded || evicted)
+                FragmentShaderBRDF::Material::InvalidateTextureBindings();
+            return reloaded || evicted;
+        }
+
+        inline size_t evictedCount() const
+        {
+            return std::count_if(_entries.begin(), _entries.end(), Evicted);
+        }
+        // dropped levels and full reloads since creation
+        inline uint64_t evictions() const
+        {
+            return _evictions;
+        }
+        inline uint64_t reloads() const
+        {
+            return _reloads;
+        }
+    };
+}
\ No newline at end of file
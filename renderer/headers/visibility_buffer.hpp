@@ -0,0 +1,282 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <GL/glew.h>
+
+#include "OpenGL_utils/buffer.hpp"
+#include "OpenGL_utils/gpu_timer.hpp"
+#include "OpenGL_utils/profiler.hpp"
+#include "OpenGL_utils/render_target.hpp"
+#include "OpenGL_utils/shader.hpp"
+#include "OpenGL_utils/vao.hpp"
+#include "builtin_shader.hpp"
+#include "camera.hpp"
+#include "mesh.hpp"
+
+namespace render
+{
+    // Deferred alternative to forward shading, selected per camera with Camera::shading.
+    // The geometry pass writes only a 32 bit ID per pixel, the instance and triangle of the nearest surface,
+    // so overdraw and small triangles no longer multiply the BRDF work, which then runs once per pixel:
+    //  - classification writes the index of the draw covering each pixel as depth,
+    //  - each draw is resolved by a full screen triangle at its own depth tested GL_EQUAL, so the other
+    //    draws' pixels are rejected before shading, and brdf.glsl reconstructs its inputs from the mesh buffers,
+    //  - color and geometry depth of the covered pixels are composited into the framebuffer bound before Run().
+    // Draws are recorded from the same Material::Use and Mesh::Draw calls as the forward path,
+    // only GL_TRIANGLES are supported. Every draw costs a full screen depth test in the resolve,
+    // so the pass pays off for few draws of dense meshes rather than many small ones.
+    class VisibilityBuffer : public DrawInterceptor
+    {
+    public:
+        enum TextureUnit : GLuint
+        {
+            ID_UNIT = 8,
+            DEPTH_UNIT,
+            COLOR_UNIT
+        };
+        static constexpr GLuint MAX_DRAWS = 65535; // classified draw depths are (index + 1) / 65536
+        GpuTimer geometryTimer, shadingTimer;
+    private:
+        // locations of fullscreen.vert.glsl, visibility.frag.glsl and brdf.glsl resolve uniforms
+        enum UniformLocation : GLint
+        {
+            DEPTH_LOCATION,
+            DRAW_BASE_LOCATION,
+            TRIANGLE_COUNT_LOCATION,
+            INDEXED_LOCATION
+        };
+        static constexpr GLint DRAW_COUNT_LOCATION = 1; // visibility_classify.frag.glsl
+        struct Draw
+        {
+            Mesh* mesh;
+            TypedSharedBuffer<InstanceData> instances;
+            const FragmentShaderBRDF::Material* material;
+            GLuint base, triangles;
+        };
+        FragmentShaderBRDF::TextureMode _mode;
+        Shader _fullscreenShader;
+        ShaderProgram _geometryProgram, _classifyProgram, _compositeProgram;
+        std::string _resolveSource;
+        std::unordered_map<uint64_t, ShaderProgram> _resolvePrograms; // by texture and attribute mask
+        RenderTarget _geometry, _shading;
+        TypedSharedBuffer<GLuint> _drawBases;
+        std::vector<Draw> _draws;
+        uint64_t _nextBase = 1;
+        VAO _emptyVAO; // full screen triangles have no vertex buffers
+
+        static Shader BuiltinShader(GLenum type, const char* file)
+        {
+            std::string source = ReadBuiltinShader(file);
+            if(source.empty())
+                return Shader();
+            return Shader(type, source.c_str());
+        }
+        static ShaderProgram BuiltinProgram(const char* vertexFile, const char* fragmentFile)
+        {
+            Shader vertex = BuiltinShader(GL_VERTEX_SHADER, vertexFile);
+            Shader fragment = BuiltinShader(GL_FRAGMENT_SHADER, fragmentFile);
+            if(!vertex || !fragment)
+                return ShaderProgram();
+            return ShaderProgram({vertex, fragment});
+        }
+        static constexpr const char* ResolveFile(FragmentShaderBRDF::TextureMode mode)
+        {
+            return mode == FragmentShaderBRDF::BINDLESS ? "brdf_resolve_bindless.frag.glsl" :
+                   mode == FragmentShaderBRDF::TEXTURE_ARRAYS ? "brdf_resolve_array.frag.glsl" : "brdf_resolve.frag.glsl";
+        }
+        // NDC z of the full screen triangle resolving draw, exact in floats so GL_EQUAL matches the classification
+        static float DrawDepth(size_t draw)
+        {
+            return (float)(draw + 1) / 32768.f - 1.f;
+        }
+        const ShaderProgram& ResolveProgram(GLuint attribMask, GLuint textureMask)
+        {
+            attribMask &= VertexShaderGeneral::VARIANT_ATTRIB_MASK;
+            textureMask = FragmentShaderBRDF::VariantTextureMask(textureMask);
+            uint64_t key = (uint64_t)textureMask << 32 | attribMask;
+            auto it = _resolvePrograms.find(key);
+            if(it != _resolvePrograms.end())
+                return it->second;
+            ShaderProgram program;
+            if(_fullscreenShader && !_resolveSource.empty())
+                program = ShaderProgram({_fullscreenShader,
+                    Shader(GL_FRAGMENT_SHADER, SpecializeShaderSource(_resolveSource, attribMask, textureMask).c_str())});
+            return _resolvePrograms.emplace(key, program).first->second;
+        }
+        void Classify()
+        {
+            GLuint count = _draws.size();
+            if(count > _drawBases.count())
+            {
+                _drawBases = TypedSharedBuffer<GLuint>(std::max(count, _drawBases.count() * 2));
+                _drawBases.Label(GpuMemoryCategory::STORAGE, "Visibility draws");
+            }
+            for(GLuint i = 0; i < count; i++)
+                _drawBases[i] = _draws[i].base;
+
+            _shading.Bind();
+            const float noDraw = 0.f;
+            glClearNamedFramebufferfv(_shading.framebuffer(), GL_DEPTH, 0, &noDraw);
+            glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+            glDepthFunc(GL_ALWAYS);
+            glUseProgram(_classifyProgram);
+            glProgramUniform1ui(_classifyProgram, DRAW_COUNT_LOCATION, count);
+            glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBILITY_DRAWS_BINDING_POINT, _drawBases);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+            glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        }
+        void Resolve()
+        {
+            glDepthFunc(GL_EQUAL);
+            glDepthMask(GL_FALSE);
+            for(size_t i = 0; i < _draws.size(); i++)
+            {
+                Draw& draw = _draws[i];
+                GLuint textureMask = 0;
+                if(draw.material)
+                {
+                    draw.material->Use();
+                    textureMask = draw.material->textureMask();
+                }
+                const ShaderProgram& program = ResolveProgram(draw.mesh->attribMask(), textureMask);
+                if(!program)
+                    continue;
+                glUseProgram(program);
+                glProgramUniform1f(program, DEPTH_LOCATION, DrawDepth(i));
+                glProgramUniform1ui(program, DRAW_BASE_LOCATION, draw.base);
+                glProgramUniform1ui(program, TRIANGLE_COUNT_LOCATION, draw.triangles);
+                glProgramUniform1i(program, INDEXED_LOCATION, (bool)draw.mesh->elements);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBILITY_INSTANCES_BINDING_POINT, draw.instances);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBILITY_POSITIONS_BINDING_POINT, draw.mesh->vertices);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBILITY_ELEMENTS_BINDING_POINT, draw.mesh->elements);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBILITY_COLORS_BINDING_POINT, draw.mesh->colors);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBILITY_UVS_BINDING_POINT, draw.mesh->UVs);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBILITY_NORMALS_BINDING_POINT, draw.mesh->normals);
+                glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBILITY_TANGENTS_BINDING_POINT, draw.mesh->tangents);
+                glDrawArrays(GL_TRIANGLES, 0, 3);
+            }
+            glDepthFunc(GL_LESS);
+            glDepthMask(GL_TRUE);
+        }
+    public:
+        // mode has to match the MaterialRegistry, as for ShaderVariantCache
+        VisibilityBuffer(FragmentShaderBRDF::TextureMode mode = FragmentShaderBRDF::TEXTURE_UNITS) :
+            _mode(mode),
+            _fullscreenShader(BuiltinShader(GL_VERTEX_SHADER, "fullscreen.vert.glsl")),
+            _geometryProgram(BuiltinProgram("general_visibility.vert.glsl", "visibility.frag.glsl")),
+            _classifyProgram(BuiltinProgram("fullscreen.vert.glsl", "visibility_classify.frag.glsl")),
+            _compositeProgram(BuiltinProgram("fullscreen.vert.glsl", "visibility_composite.frag.glsl")),
+            _resolveSource(ReadBuiltinShader(ResolveFile(mode))),
+            _geometry(1, 1, {{GL_R32UI, 1}}),
+            _shading(1, 1, {{GL_RGBA16F, 4}}),
+            _drawBases(64)
+        {
+            _drawBases.Label(GpuMemoryCategory::STORAGE, "Visibility draws");
+        }
+        VisibilityBuffer(const VisibilityBuffer&) = delete;
+        VisibilityBuffer& operator=(const VisibilityBuffer&) = delete;
+        ~VisibilityBuffer()
+        {
+            if(active == this)
+                active = nullptr;
+        }
+
+        // Records the draws issued by draw at camera.resolution and shades them into the bound framebuffer,
+        // whose viewport has to match the resolution, like for the forward path.
+        // Lighting, shadows and materials are used as bound, ShaderVariantCache variants are not needed.
+        template<typename DrawFunction>
+        void Run(Camera& camera, DrawFunction&& draw)
+        {
+            PROFILE_SCOPE_CPU_GPU("VisibilityBuffer");
+            GLint target = 0;
+            glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &target);
+            GLsizei width = camera.resolution.x, height = camera.resolution.y;
+            _geometry.Resize(width, height);
+            _shading.Resize(width, height);
+
+            geometryTimer.Begin();
+            _geometry.Bind();
+            const GLuint noId = 0;
+            const float farDepth = 1.f;
+            glClearNamedFramebufferuiv(_geometry.framebuffer(), GL_COLOR, 0, &noId);
+            glClearNamedFramebufferfv(_geometry.framebuffer(), GL_DEPTH, 0, &farDepth);
+            _draws.clear();
+            _nextBase = 1;
+            DrawInterceptor* previous = active;
+            active = this;
+            draw();
+            active = previous;
+            geometryTimer.End();
+
+            shadingTimer.Begin();
+            GLboolean blend = glIsEnabled(GL_BLEND);
+            glDisable(GL_BLEND);
+            // integer textures are incomplete with linear filtering
+            glTextureParameteri(_geometry.color(), GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTextureParameteri(_geometry.color(), GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glBindTextureUnit(ID_UNIT, _geometry.color());
+            glBindTextureUnit(DEPTH_UNIT, _geometry.depth());
+            glBindTextureUnit(COLOR_UNIT, _shading.color());
+            glBindVertexArray(_emptyVAO);
+            if(!_draws.empty())
+            {
+                Classify();
+                Resolve();
+            }
+            if(blend)
+                glEnable(GL_BLEND);
+
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, target);
+            glViewport(0, 0, width, height);
+            glUseProgram(_compositeProgram);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+            shadingTimer.End();
+            if(ShaderVariantCache::active)
+                ShaderVariantCache::active->ResetBoundProgram();
+        }
+
+        // records the draw into the geometry pass, Mesh::Draw calls it while Run() is drawing
+        bool Intercept(Mesh& mesh, TypedSharedBuffer<InstanceData>& instanceBuffer, GLuint instanceCount, GLenum mode) override
+        {
+            if(mode != GL_TRIANGLES)
+            {
+                std::fprintf(stderr, "Error: Visibility buffer draws only GL_TRIANGLES!\n");
+                return false;
+            }
+            GLuint triangles = mesh.drawCount() / 3;
+            uint64_t span = (uint64_t)instanceCount * triangles;
+            if(!span)
+                return false;
+            if(_draws.size() >= MAX_DRAWS || _nextBase + span > 1ull << 32)
+            {
+                std::fprintf(stderr, "Error: Visibility buffer is out of draw IDs, draw skipped!\n");
+                return false;
+            }
+            glUseProgram(_geometryProgram);
+            glProgramUniform1ui(_geometryProgram, DRAW_BASE_LOCATION, _nextBase);
+            glProgramUniform1ui(_geometryProgram, TRIANGLE_COUNT_LOCATION, triangles);
+            _draws.push_back(Draw{&mesh, instanceBuffer, FragmentShaderBRDF::Material::lastUsed(), (GLuint)_nextBase, triangles});
+            _nextBase += span;
+            return true;
+        }
+
+        inline FragmentShaderBRDF::TextureMode mode() const
+        {
+            return _mode;
+        }
+        // draws recorded by the last Run()
+        inline size_t drawCount() const
+        {
+            return _draws.size();
+        }
+        // per pixel IDs and depth of the last geometry pass
+        inline const RenderTarget& geometry() const
+        {
+            return _geometry;
+        }
+    };
+}
\ No newline at end of file
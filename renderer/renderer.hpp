@@ -1,8 +1,19 @@
 #ifndef GLM_ENABLE_EXPERIMENTAL
 #define GLM_ENABLE_EXPERIMENTAL
 #endif
+#include "headers/asset_archive.hpp"
 #include "headers/builtin_shader.hpp"
+#include "headers/bvh.hpp"
 #include "headers/camera.hpp"
+#include "headers/clustered_lighting.hpp"
+#include "headers/dynamic_resolution.hpp"
+#include "headers/forward_pass.hpp"
+#include "headers/hiz_culling.hpp"
+#include "headers/instance_buffer.hpp"
 #include "headers/mesh.hpp"
+#include "headers/shadow_maps.hpp"
+#include "headers/software_occlusion.hpp"
+#include "headers/texture_residency.hpp"
 #include "headers/transform.hpp"
+#include "headers/visibility_buffer.hpp"
 #include "OpenGL_utils/OpenGL_utils.hpp"
\ No newline at end of file
@@ -1,15 +1,34 @@
-.PHONY: renderer shaders renderer_demo run_renderer_demo all
+.PHONY: renderer shaders renderer_demo renderer_demo_assets run_renderer_demo renderer_bench run_renderer_bench all
 
-RENDERER_SHADERS:=./renderer/shader/processed/general.vert.glsl ./renderer/shader/processed/brdf.frag.glsl
+RENDERER_SHADER_BATCH:=./renderer/shader/shaders.batch
+RENDERER_SHADERS:=$(shell awk 'NF >= 2 && substr($$1, 1, 1) != "\043" { print $$2 }' $(RENDERER_SHADER_BATCH))
+RENDERER_SHADER_SOURCES:=$(wildcard ./renderer/shader/*.glsl)
+RENDERER_SHADERS_STAMP:=$(INTERMEDIATE)renderer/shaders.stamp
+RENDERER_SHADER_ARCHIVE_SRC:=$(INTERMEDIATE)renderer/shader_archive.cpp
+RENDERER_SHADER_ARCHIVE_OBJ:=$(INTERMEDIATE)renderer/shader_archive.o
 
 shaders: $(RENDERER_SHADERS)
 
-./renderer/shader/processed/%.glsl: $(GLSL_PREPROCESS_EXEC) ./renderer/shader/%.glsl ./renderer/renderer.mk
+# all shaders are preprocessed by one glsl_preprocess run, which leaves unchanged outputs untouched,
+# so the stamp tracks when the batch last ran
+# the same run packs them into a translation unit embedded in librenderer (see shader_archive.hpp)
+RENDERER_SHADER_BATCH_CMD:=$(GLSL_PREPROCESS_EXEC) -lz4 -batch $(RENDERER_SHADER_BATCH) -archive $(RENDERER_SHADER_ARCHIVE_SRC)
+
+$(RENDERER_SHADERS_STAMP): $(GLSL_PREPROCESS_EXEC) $(RENDERER_SHADER_BATCH) $(RENDERER_SHADER_SOURCES) ./renderer/renderer.mk
 	@mkdir -p $(dir $@)
-	@echo "Preprocessing $@..."
-	./out/glsl_preprocess/glsl_preprocess ./renderer/shader/$*.glsl ./renderer/shader/processed/$*.glsl
+	@echo "Preprocessing shaders..."
+	$(RENDERER_SHADER_BATCH_CMD)
+	@touch $@
+
+# regenerates outputs deleted after the stamp was written
+$(RENDERER_SHADERS) $(RENDERER_SHADER_ARCHIVE_SRC): $(RENDERER_SHADERS_STAMP)
+	@test -f $@ || $(RENDERER_SHADER_BATCH_CMD)
+
+$(RENDERER_SHADER_ARCHIVE_OBJ): $(RENDERER_SHADER_ARCHIVE_SRC) ./renderer/headers/shader_archive.hpp ./renderer/headers/lz4.hpp
+	@echo "Compiling $<..."
+	$(C++) $(COMPILE_FLAGS) -c $< -o $@
 
-RENDERER_OBJ:=$(patsubst %.cpp,$(OBJ)%.o,$(wildcard renderer/*.cpp))
+RENDERER_OBJ:=$(patsubst %.cpp,$(OBJ)%.o,$(wildcard renderer/*.cpp)) $(RENDERER_SHADER_ARCHIVE_OBJ)
 RENDERER_LIBRARIAN:=$(INTERMEDIATE)renderer/librarian.mri
 RENDERER_NO_UTILS_LIB:=$(INTERMEDIATE)renderer/librenderer_no_utils.a
 RENDERER_LIBS_TO_MERGE:=$(OPENGL_UTILS_LIB) $(RENDERER_NO_UTILS_LIB)
@@ -38,16 +57,41 @@ $(RENDERER_LIB) : $(RENDERER_LIBRARIAN) $(RENDERER_LIBS_TO_MERGE) $(RENDERER_SHA
 
 RENDERER_DEMO_OBJ:=$(patsubst %.cpp,$(OBJ)%.o,$(wildcard renderer/demo/*.cpp))
 RENDERER_DEMO_EXEC:=$(OUT)renderer/demo/renderer_demo
+RENDERER_DEMO_MANIFEST:=./renderer/demo/assets/demo_assets.manifest
+RENDERER_DEMO_ASSETS:=$(OUT)renderer/demo/demo_assets.pak
 
-renderer_demo: $(RENDERER_DEMO_EXEC)
+renderer_demo: $(RENDERER_DEMO_EXEC) $(RENDERER_DEMO_ASSETS)
+
+renderer_demo_assets: $(RENDERER_DEMO_ASSETS)
+
+$(RENDERER_DEMO_ASSETS): $(ASSET_COOK_EXEC) $(RENDERER_DEMO_MANIFEST) $(wildcard renderer/demo/assets/*/*) ./renderer/renderer.mk
+	@mkdir -p $(dir $@)
+	@echo "Cooking $@..."
+	$(ASSET_COOK_EXEC) -lz4 $(RENDERER_DEMO_MANIFEST) $@
 
-run_renderer_demo: $(RENDERER_DEMO_EXEC)
-	$(RENDERER_DEMO_EXEC)
+run_renderer_demo: $(RENDERER_DEMO_EXEC) $(RENDERER_DEMO_ASSETS)
+	$(RENDERER_DEMO_EXEC) $(RENDERER_DEMO_ASSETS)
 
 $(RENDERER_DEMO_EXEC): $(RENDERER_LIB) $(RENDERER_DEMO_OBJ) ./renderer/renderer.mk
 	mkdir -p $(dir $@)
 	@echo "Linking renderer_demo..."
 	g++ -o $@ $(RENDERER_DEMO_OBJ) -L./out/renderer -lGL -lGLEW -lglfw -lrenderer
 
+RENDERER_BENCH_OBJ:=$(patsubst %.cpp,$(OBJ)%.o,$(wildcard renderer/bench/*.cpp))
+RENDERER_BENCH_EXEC:=$(OUT)renderer/bench/renderer_bench
+RENDERER_BENCH_JSON:=$(OUT)renderer/bench/results.json
+
+# headless, renders through EGL so it also runs on machines without a display or GPU
+renderer_bench: $(RENDERER_BENCH_EXEC)
+
+run_renderer_bench: $(RENDERER_BENCH_EXEC)
+	$(RENDERER_BENCH_EXEC) -json $(RENDERER_BENCH_JSON)
+
+$(RENDERER_BENCH_EXEC): $(RENDERER_LIB) $(RENDERER_BENCH_OBJ) $(OPENGL_UTILS_HEADLESS_OBJ) ./renderer/renderer.mk
+	mkdir -p $(dir $@)
+	@echo "Linking renderer_bench..."
+	g++ -o $@ $(RENDERER_BENCH_OBJ) $(OPENGL_UTILS_HEADLESS_OBJ) -L./out/renderer -lrenderer -lGL -lGLEW -lEGL
+
 -include $(wildcard $(DEP)renderer/demo/*.d)
+-include $(wildcard $(DEP)renderer/bench/*.d)
 -include $(wildcard $(DEP)renderer/*.d)
\ No newline at end of file
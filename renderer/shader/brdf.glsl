@@ -0,0 +1,255 @@
+#include "general_shared.glsl"
+
+layout(std140, binding = 1) uniform _lightUniforms
+{
+    vec3 ambientLight;
+    uint _pad1;
+    vec3 lightColor;
+    float _pad2;
+    vec3 view_lightDirection;
+    float _pad3;
+    uvec3 cluster_grid; // tiles x, y and depth slices, z is 0 when clustered lights are off
+    float cluster_slice_scale;
+    float cluster_slice_bias;
+    uint shadow_cascade_count; // 0 when shadows are off
+};
+
+// directional light shadows, see CascadedShadowMaps
+const uint MAX_SHADOW_CASCADES = 4;
+layout(std140, binding = 2) uniform _shadowUniforms
+{
+    mat4 shadow_matrices[MAX_SHADOW_CASCADES]; // view space to shadow map texture space
+    vec4 shadow_cascade_splits; // far view depth of each cascade
+};
+
+// clustered point and spot lights, see ClusteredLighting
+struct LightData
+{
+    vec3 view_position;
+    float range;
+    vec3 color;
+    float spot_cos_outer; // below -1 for point lights
+    vec3 view_direction;
+    float spot_cos_inner;
+};
+layout(std430, binding = 1) readonly buffer _clusterLights
+{
+    LightData lights[];
+};
+layout(std430, binding = 2) readonly buffer _clusters
+{
+    uvec2 clusters[]; // offset into cluster_light_indices, light count
+};
+layout(std430, binding = 3) readonly buffer _clusterLightIndices
+{
+    uint cluster_light_indices[];
+};
+
+const uint ALBEDO_MAP = 0;
+const uint ROUGHNESS_MAP = ALBEDO_MAP + 1;
+const uint METALLIC_MAP = ROUGHNESS_MAP + 1;
+const uint NORMAL_MAP = METALLIC_MAP + 1;
+const uint AMBIENT_OCCLUSION_MAP = NORMAL_MAP + 1;
+const uint ORM_MAP = AMBIENT_OCCLUSION_MAP + 1; // Occlusion, Roughness, Metallic packed in RGB
+const uint NEXT_MAP = ORM_MAP + 1;
+layout(binding = NEXT_MAP) uniform sampler2DArrayShadow shadow_map; // FragmentShaderBRDF::SHADOW_MAP_UNIT
+
+struct MaterialData
+{
+    vec4 color_mod;
+    float roughness_mod;
+    float metallic_mod;
+    float ambient_occlusion_mod;
+    float normal_mod;
+    uint active_texture_bitfield; // selects the variant on the CPU side
+    uint _pad[3];       // FragmentShaderBRDF::MaterialUniformData::__pad
+    int map_layers[8];  // TEXTURE_ARRAYS variant only
+    uvec2 map_handles[8]; // BINDLESS variant only, 0 handle for unused maps
+};
+// every registered material, indexed by the per instance material index
+layout(std430, binding = 0) readonly buffer _materials
+{
+    MaterialData materials[];
+};
+// VISIBILITY_RESOLVE builds the resolve pass of VisibilityBuffer, which has no vertex outputs to read,
+// the inputs below are reconstructed from the visibility buffer and the mesh buffers instead
+#ifdef VISIBILITY_RESOLVE
+#include "visibility_resolve.glsl"
+#else
+flat in uint frag_material;
+MaterialData material = materials[frag_material];
+
+in vec4 frag_view_pos;
+in vec4 frag_pos;
+in vec4 frag_color;
+in vec2 frag_uv;
+in vec3 frag_view_normal;
+in vec3 frag_view_tangent;
+in vec3 frag_view_bitangent;
+#endif
+
+// TEXTURE_MASK is the active texture bitfield of the materials the variant is used with,
+// maps outside of it are never sampled. Maps inside it are still checked against the material,
+// which is what lets a program with all bits set draw any material.
+#ifndef TEXTURE_MASK
+#define TEXTURE_MASK 0u
+#endif
+#define MAP_ENABLED(map) ((((TEXTURE_MASK & material.active_texture_bitfield) >> map) & 1u) == 1u)
+
+// neighbouring pixels of the resolve may belong to other triangles, so it passes its own uv gradients,
+// scaled by 2^lod_bias to match the bias of the forward path
+#ifdef VISIBILITY_RESOLVE
+#define SAMPLE_2D(sampler, coord) textureGrad(sampler, coord, frag_uv_dx * exp2(lod_bias), frag_uv_dy * exp2(lod_bias))
+#else
+#define SAMPLE_2D(sampler, coord) texture(sampler, coord, lod_bias)
+#endif
+#ifdef BRDF_BINDLESS
+#define SAMPLE_MAP(map, uv) SAMPLE_2D(sampler2D(material.map_handles[map]), uv)
+#elif defined(BRDF_TEXTURE_ARRAY)
+layout(binding = 0) uniform sampler2DArray map_samplers[NEXT_MAP]; // texture units 0 to NEXT_MAP-1
+#define SAMPLE_MAP(map, uv) SAMPLE_2D(map_samplers[map], vec3(uv, material.map_layers[map]))
+#else
+layout(binding = 0) uniform sampler2D map_samplers[NEXT_MAP]; // texture units 0 to NEXT_MAP-1
+#define SAMPLE_MAP(map, uv) SAMPLE_2D(map_samplers[map], uv)
+#endif
+
+#define ALBEDO_MAP_ENABLED MAP_ENABLED(ALBEDO_MAP)
+#define ROUGHNESS_MAP_ENABLED MAP_ENABLED(ROUGHNESS_MAP)
+#define METALLIC_MAP_ENABLED MAP_ENABLED(METALLIC_MAP)
+#define NORMAL_MAP_ENABLED MAP_ENABLED(NORMAL_MAP)
+#define AMBIENT_OCCLUSION_MAP_ENABLED MAP_ENABLED(AMBIENT_OCCLUSION_MAP)
+#define ORM_MAP_ENABLED MAP_ENABLED(ORM_MAP)
+
+
+out vec4 out_color;
+
+// 1 when lit, 0 when fully shadowed, fragments past the last cascade are lit
+float DirectionalShadow(vec3 view_pos)
+{
+    float depth = -view_pos.z;
+    uint cascade = 0u;
+    while(cascade < shadow_cascade_count && depth > shadow_cascade_splits[cascade])
+        cascade++;
+    if(cascade >= shadow_cascade_count)
+        return 1.f;
+    vec3 shadow_pos = (shadow_matrices[cascade] * vec4(view_pos, 1.f)).xyz;
+    return texture(shadow_map, vec4(shadow_pos.xy, cascade, shadow_pos.z));
+}
+
+// temporary phong-like lighting, L points towards the light
+void AddLight(vec3 L, vec3 radiance, vec3 N, vec3 V, float roughness, float metallic, inout vec3 diffuse, inout vec3 specular)
+{
+    float dF = clamp(dot(N, L), 0.f, 1.f);
+    diffuse += dF * radiance * roughness;
+    vec3 halfVector = normalize(V + L);
+    float sF = pow(clamp(dot(N, halfVector), 0.f, 1.f), 256.f * metallic);
+    specular += sF * radiance * (1.0f - roughness);
+}
+
+void main()
+{
+#ifdef VISIBILITY_RESOLVE
+    ReconstructFragment();
+    vec3 view_pos_dx = frag_view_pos_dx;
+    vec3 view_pos_dy = frag_view_pos_dy;
+    vec2 uv_dx = frag_uv_dx;
+    vec2 uv_dy = frag_uv_dy;
+#else
+    vec3 view_pos_dx = dFdx(vec3(frag_view_pos));
+    vec3 view_pos_dy = dFdy(vec3(frag_view_pos));
+    vec2 uv_dx = dFdx(frag_uv);
+    vec2 uv_dy = dFdy(frag_uv);
+#endif
+    vec4 color = frag_color;
+    vec3 view_normal, view_tangent, view_bitangent, final_normal;
+
+    if(NORMAL_ENABLED)
+    {
+        view_normal = normalize(frag_view_normal);
+    }
+    else
+        view_normal = normalize(cross(view_pos_dx, view_pos_dy));
+
+    if(TANGENT_ENABLED && NORMAL_ENABLED)
+    {
+        view_tangent = normalize(frag_view_tangent);
+        view_bitangent = normalize(frag_view_bitangent);
+    }
+    else
+    {
+        view_tangent = normalize(cross(view_pos_dy, view_normal) * uv_dx.x + cross(view_normal, view_pos_dx) * uv_dy.x);
+        view_bitangent = cross(view_normal, view_tangent);
+    }
+    mat3 TBN = mat3(view_tangent, view_bitangent, view_normal);
+    if(NORMAL_MAP_ENABLED)
+    {
+        vec3 normal_map_sample = SAMPLE_MAP(NORMAL_MAP, frag_uv).xyz;
+        normal_map_sample = normal_map_sample * 2.f - 1.f;
+        final_normal = normalize(normalize(TBN * normal_map_sample) * material.normal_mod + view_normal * clamp(1.f - material.normal_mod, 0.f, 1.f));
+    }
+    else
+        final_normal = view_normal;
+
+    if(UV_ENABLED)
+    {
+        if(ALBEDO_MAP_ENABLED)
+            color *= SAMPLE_MAP(ALBEDO_MAP, frag_uv);
+    }
+    color *= material.color_mod;
+    float roughness = material.roughness_mod;
+    float metallic = material.metallic_mod;
+    float ambient_occlusion = material.ambient_occlusion_mod;
+    if(ORM_MAP_ENABLED) // packed map replaces the separate ones with a single fetch
+    {
+        vec3 orm = SAMPLE_MAP(ORM_MAP, frag_uv).rgb;
+        ambient_occlusion *= orm.r;
+        roughness *= orm.g;
+        metallic *= orm.b;
+    }
+    else
+    {
+        if(ROUGHNESS_MAP_ENABLED)
+        {
+            roughness *= SAMPLE_MAP(ROUGHNESS_MAP, frag_uv).r;
+        }
+        if(METALLIC_MAP_ENABLED)
+        {
+            metallic *= SAMPLE_MAP(METALLIC_MAP, frag_uv).r;
+        }
+        if(AMBIENT_OCCLUSION_MAP_ENABLED)
+        {
+            ambient_occlusion *= SAMPLE_MAP(AMBIENT_OCCLUSION_MAP, frag_uv).r;
+        }
+    }
+
+    vec3 V = -normalize(vec3(frag_view_pos));
+    vec3 dL = vec3(0.f);
+    vec3 sL = vec3(0.f);
+    float shadow = shadow_cascade_count != 0u ? DirectionalShadow(vec3(frag_view_pos)) : 1.f;
+    AddLight(view_lightDirection, lightColor * shadow, final_normal, V, roughness, metallic, dL, sL);
+    if(cluster_grid.z != 0u)
+    {
+        vec3 view_pos = vec3(frag_view_pos);
+        uint slice = uint(max(log(-view_pos.z) * cluster_slice_scale + cluster_slice_bias, 0.f));
+        uvec3 cell = min(uvec3(uvec2(gl_FragCoord.xy) * cluster_grid.xy / resolution, slice), cluster_grid - 1u);
+        uvec2 cluster = clusters[cell.x + cluster_grid.x * (cell.y + cluster_grid.y * cell.z)];
+        for(uint i = cluster.x; i < cluster.x + cluster.y; i++)
+        {
+            LightData light = lights[cluster_light_indices[i]];
+            vec3 L = light.view_position - view_pos;
+            float dist2 = dot(L, L);
+            float range2 = light.range * light.range;
+            if(dist2 >= range2)
+                continue;
+            L *= inversesqrt(dist2);
+            // inverse square falloff windowed to reach zero at the light's range
+            float window = clamp(1.f - (dist2 * dist2) / (range2 * range2), 0.f, 1.f);
+            float attenuation = window * window / (dist2 + 1.f);
+            if(light.spot_cos_outer >= -1.f)
+                attenuation *= smoothstep(light.spot_cos_outer, light.spot_cos_inner, dot(-L, light.view_direction));
+            AddLight(L, light.color * attenuation, final_normal, V, roughness, metallic, dL, sL);
+        }
+    }
+    vec3 aL = ambientLight * ambient_occlusion;
+    out_color = vec4(sL + (dL + aL) * vec3(color), color.a);
+}
\ No newline at end of file
@@ -0,0 +1,10 @@
+#version 460
+
+// Triangle covering the viewport, drawn with glDrawArrays(GL_TRIANGLES, 0, 3) and no vertex buffers
+layout(location = 0) uniform float depth; // NDC z of the triangle
+
+void main()
+{
+    vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+    gl_Position = vec4(corner * 2.f - 1.f, depth, 1.f);
+}
\ No newline at end of file
@@ -3,12 +3,31 @@
 #include "general_shared.glsl"
 
 layout(location = POS_IDX) in vec3 pos;
+layout(location = INSTANCE_TRANSFORM_IDX) in mat4 model;
+
+// depth passes must produce bit identical positions to the shaded pass
+invariant gl_Position;
+
+// DEPTH_ONLY builds the position only variant used by depth passes, which have no fragment shader
+// with VISIBILITY it also passes the instance on to visibility.frag.glsl
+#ifdef DEPTH_ONLY
+#ifdef VISIBILITY
+flat out uint frag_instance;
+#endif
+void main()
+{
+    gl_Position = projection * ((view * model) * vec4(pos, 1.f));
+#ifdef VISIBILITY
+    frag_instance = gl_InstanceID; // Mesh draws start at instance 0
+#endif
+}
+#else
 layout(location = COLOR_IDX) in vec4 color;
 layout(location = UV_IDX) in vec2 uv;
 layout(location = NORMAL_IDX) in vec3 normal;
 layout(location = TANGENT_IDX) in vec3 tangent;
-layout(location = INSTANCE_TRANSFORM_IDX) in mat4 model;
 layout(location = INSTANCE_INVERSE_TRANSFORM_IDX) in mat4 inverse_model;
+layout(location = INSTANCE_MATERIAL_IDX) in uint material;
 
 mat4 viewModel = view * model;
 
@@ -19,13 +38,9 @@ out vec2 frag_uv;
 out vec3 frag_view_normal;
 out vec3 frag_view_tangent;
 out vec3 frag_view_bitangent;
+flat out uint frag_material;
 
 
-
-layout(binding = 1) uniform sampler2D AlbedoMap;
-layout(binding = 2) uniform sampler2D NormalMap;
-layout(binding = 3) uniform sampler2D ORMMap; // Occlusion, Roughness, Metallic
-
 void main()
 {
     frag_view_pos = viewModel * vec4(pos, 1.f);
@@ -33,6 +48,7 @@ void main()
     frag_pos = gl_Position;
     frag_color = COLOR_ENABLED ? color : vec4(1.0f);
     frag_uv = uv;
+    frag_material = material;
     
     if(NORMAL_ENABLED)
         frag_view_normal = mat3(transpose(inverse_model * inverse_view)) * normal;
@@ -42,4 +58,4 @@ void main()
         frag_view_bitangent = cross(frag_view_normal, frag_view_tangent);
     }
 }
-
+#endif
\ No newline at end of file
@@ -4,13 +4,14 @@ layout(std140, binding = 0) uniform _generalUniforms
     mat4 view;
     mat4 projection;
     uvec2 resolution;
+    float lod_bias;
 };
-layout(location = 0) uniform uint activeAttribBitfield;
-
-bool isAttribEnabled(uint idx)
-{
-    return ((activeAttribBitfield >> idx) & 1u) == 1u;
-}
+// Variants are specialized at compile time by ShaderVariantCache, which defines
+// ATTRIB_MASK as the active attribute bitfield of the mesh being drawn
+#ifndef ATTRIB_MASK
+#define ATTRIB_MASK 0u
+#endif
+#define ATTRIB_ENABLED(idx) (((ATTRIB_MASK >> idx) & 1u) == 1u)
 
 const uint POS_IDX = 0;
 const uint COLOR_IDX = 1 + POS_IDX;
@@ -19,11 +20,12 @@ const uint NORMAL_IDX = 1 + UV_IDX;
 const uint TANGENT_IDX = 1 + NORMAL_IDX;
 const uint INSTANCE_TRANSFORM_IDX = 1 + TANGENT_IDX;
 const uint INSTANCE_INVERSE_TRANSFORM_IDX = 4 + INSTANCE_TRANSFORM_IDX;
-const uint NEXT_IDX = 4 + INSTANCE_INVERSE_TRANSFORM_IDX;
+const uint INSTANCE_MATERIAL_IDX = 4 + INSTANCE_INVERSE_TRANSFORM_IDX;
+const uint NEXT_IDX = 1 + INSTANCE_MATERIAL_IDX;
 
 
-// we assume POS, TRANSFORM and INVERSE_TRANSFORM always enabled
-bool COLOR_ENABLED = isAttribEnabled(COLOR_IDX);
-bool UV_ENABLED = isAttribEnabled(UV_IDX);
-bool NORMAL_ENABLED = isAttribEnabled(NORMAL_IDX);
-bool TANGENT_ENABLED = isAttribEnabled(TANGENT_IDX);
\ No newline at end of file
+// we assume POS, TRANSFORM, INVERSE_TRANSFORM and MATERIAL always enabled
+const bool COLOR_ENABLED = ATTRIB_ENABLED(COLOR_IDX);
+const bool UV_ENABLED = ATTRIB_ENABLED(UV_IDX);
+const bool NORMAL_ENABLED = ATTRIB_ENABLED(NORMAL_IDX);
+const bool TANGENT_ENABLED = ATTRIB_ENABLED(TANGENT_IDX);
\ No newline at end of file
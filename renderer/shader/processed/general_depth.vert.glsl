@@ -0,0 +1,92 @@
+#version 460
+#define DEPTH_ONLY
+
+layout(std140, binding = 0) uniform _generalUniforms
+{
+    mat4 inverse_view;
+    mat4 view;
+    mat4 projection;
+    uvec2 resolution;
+    float lod_bias;
+};
+// Variants are specialized at compile time by ShaderVariantCache, which defines
+// ATTRIB_MASK as the active attribute bitfield of the mesh being drawn
+#ifndef ATTRIB_MASK
+#define ATTRIB_MASK 0u
+#endif
+#define ATTRIB_ENABLED(idx) (((ATTRIB_MASK >> idx) & 1u) == 1u)
+
+const uint POS_IDX = 0;
+const uint COLOR_IDX = 1 + POS_IDX;
+const uint UV_IDX = 1 + COLOR_IDX;
+const uint NORMAL_IDX = 1 + UV_IDX;
+const uint TANGENT_IDX = 1 + NORMAL_IDX;
+const uint INSTANCE_TRANSFORM_IDX = 1 + TANGENT_IDX;
+const uint INSTANCE_INVERSE_TRANSFORM_IDX = 4 + INSTANCE_TRANSFORM_IDX;
+const uint INSTANCE_MATERIAL_IDX = 4 + INSTANCE_INVERSE_TRANSFORM_IDX;
+const uint NEXT_IDX = 1 + INSTANCE_MATERIAL_IDX;
+
+
+// we assume POS, TRANSFORM, INVERSE_TRANSFORM and MATERIAL always enabled
+const bool COLOR_ENABLED = ATTRIB_ENABLED(COLOR_IDX);
+const bool UV_ENABLED = ATTRIB_ENABLED(UV_IDX);
+const bool NORMAL_ENABLED = ATTRIB_ENABLED(NORMAL_IDX);
+const bool TANGENT_ENABLED = ATTRIB_ENABLED(TANGENT_IDX);
+
+layout(location = POS_IDX) in vec3 pos;
+layout(location = INSTANCE_TRANSFORM_IDX) in mat4 model;
+
+// depth passes must produce bit identical positions to the shaded pass
+invariant gl_Position;
+
+// DEPTH_ONLY builds the position only variant used by depth passes, which have no fragment shader
+// with VISIBILITY it also passes the instance on to visibility.frag.glsl
+#ifdef DEPTH_ONLY
+#ifdef VISIBILITY
+flat out uint frag_instance;
+#endif
+void main()
+{
+    gl_Position = projection * ((view * model) * vec4(pos, 1.f));
+#ifdef VISIBILITY
+    frag_instance = gl_InstanceID; // Mesh draws start at instance 0
+#endif
+}
+#else
+layout(location = COLOR_IDX) in vec4 color;
+layout(location = UV_IDX) in vec2 uv;
+layout(location = NORMAL_IDX) in vec3 normal;
+layout(location = TANGENT_IDX) in vec3 tangent;
+layout(location = INSTANCE_INVERSE_TRANSFORM_IDX) in mat4 inverse_model;
+layout(location = INSTANCE_MATERIAL_IDX) in uint material;
+
+mat4 viewModel = view * model;
+
+out vec4 frag_view_pos;
+out vec4 frag_pos;
+out vec4 frag_color;
+out vec2 frag_uv;
+out vec3 frag_view_normal;
+out vec3 frag_view_tangent;
+out vec3 frag_view_bitangent;
+flat out uint frag_material;
+
+
+void main()
+{
+    frag_view_pos = viewModel * vec4(pos, 1.f);
+    gl_Position = projection * frag_view_pos;
+    frag_pos = gl_Position;
+    frag_color = COLOR_ENABLED ? color : vec4(1.0f);
+    frag_uv = uv;
+    frag_material = material;
+    
+    if(NORMAL_ENABLED)
+        frag_view_normal = mat3(transpose(inverse_model * inverse_view)) * normal;
+    if(NORMAL_ENABLED && TANGENT_ENABLED)
+    {
+        frag_view_tangent = mat3(viewModel) * tangent;
+        frag_view_bitangent = cross(frag_view_normal, frag_view_tangent);
+    }
+}
+#endif
@@ -0,0 +1,44 @@
+#version 460
+
+// Builds one level of the Hi-Z pyramid, every texel keeps the farthest depth of the texels it covers.
+// Level 0 copies the depth texture, later levels reduce the previous level.
+layout(local_size_x = 8, local_size_y = 8) in;
+
+layout(binding = 7) uniform sampler2D depth_texture; // HiZCuller::DEPTH_TEXTURE_UNIT, level 0 only
+layout(binding = 0, r32f) readonly uniform image2D source_level;
+layout(binding = 1, r32f) writeonly uniform image2D target_level;
+layout(location = 0) uniform bool copy_depth;
+
+float Load(ivec2 coord, ivec2 last)
+{
+    return imageLoad(source_level, min(coord, last)).r;
+}
+
+void main()
+{
+    ivec2 coord = ivec2(gl_GlobalInvocationID.xy);
+    ivec2 target_size = imageSize(target_level);
+    if(any(greaterThanEqual(coord, target_size)))
+        return;
+    if(copy_depth)
+    {
+        imageStore(target_level, coord, vec4(texelFetch(depth_texture, coord, 0).r));
+        return;
+    }
+
+    ivec2 source_size = imageSize(source_level);
+    ivec2 last = source_size - 1;
+    ivec2 base = coord * 2;
+    float depth = max(max(Load(base, last), Load(base + ivec2(1, 0), last)),
+                      max(Load(base + ivec2(0, 1), last), Load(base + ivec2(1, 1), last)));
+    // odd sized levels fold their last row and column into the last target texel
+    bool extra_x = (source_size.x & 1) != 0 && coord.x == target_size.x - 1;
+    bool extra_y = (source_size.y & 1) != 0 && coord.y == target_size.y - 1;
+    if(extra_x)
+        depth = max(depth, max(Load(base + ivec2(2, 0), last), Load(base + ivec2(2, 1), last)));
+    if(extra_y)
+        depth = max(depth, max(Load(base + ivec2(0, 2), last), Load(base + ivec2(1, 2), last)));
+    if(extra_x && extra_y)
+        depth = max(depth, Load(base + ivec2(2, 2), last));
+    imageStore(target_level, coord, vec4(depth));
+}
@@ -0,0 +1,109 @@
+#version 460
+
+// Culls the instances of one mesh against the view frustum and the Hi-Z pyramid,
+// survivors are appended to an instance buffer drawn with an indirect command.
+// EARLY_PHASE draws what was visible last frame, the LATE_PHASE tests everything else
+// against the pyramid built from the early draws and updates the visibility.
+layout(local_size_x = 64) in;
+
+struct InstanceData
+{
+    mat4 model;
+    mat4 inverse_model;
+    uint material;
+    uint _pad[3];
+};
+layout(std430, binding = 4) readonly buffer _instances
+{
+    InstanceData instances[];
+};
+layout(std430, binding = 5) buffer _visibility
+{
+    uint visibility[]; // 1 when visible in the last late phase
+};
+layout(std430, binding = 6) writeonly buffer _survivors
+{
+    InstanceData survivors[];
+};
+layout(std430, binding = 7) buffer _command // DrawIndirectCommand
+{
+    uint count;
+    uint instance_count;
+    uint first;
+    int base_vertex;
+    uint base_instance;
+};
+layout(binding = 7) uniform sampler2D hiz; // HiZCuller::DEPTH_TEXTURE_UNIT
+
+const uint EARLY_PHASE = 0;
+const uint LATE_PHASE = 1;
+layout(location = 0) uniform mat4 view_projection;
+layout(location = 1) uniform vec3 bounds_min;
+layout(location = 2) uniform vec3 bounds_max;
+layout(location = 3) uniform uint instance_total;
+layout(location = 4) uniform uint phase;
+layout(location = 5) uniform bool has_bounds; // without bounds everything is visible
+
+// ndc rect and nearest ndc depth of the box are tested against the farthest depth under the rect
+bool HiZVisible(vec2 ndc_min, vec2 ndc_max, float ndc_depth)
+{
+    vec2 uv_min = clamp(ndc_min * 0.5f + 0.5f, 0.f, 1.f);
+    vec2 uv_max = clamp(ndc_max * 0.5f + 0.5f, 0.f, 1.f);
+    vec2 extent = (uv_max - uv_min) * vec2(textureSize(hiz, 0));
+    // level where the rect spans at most 2x2 texels
+    int level = int(ceil(log2(max(max(extent.x, extent.y), 1.f))));
+    level = clamp(level, 0, textureQueryLevels(hiz) - 1);
+    ivec2 last = textureSize(hiz, level) - 1;
+    ivec2 p0 = clamp(ivec2(uv_min * vec2(last + 1)), ivec2(0), last);
+    ivec2 p1 = clamp(ivec2(uv_max * vec2(last + 1)), ivec2(0), last);
+    float farthest = max(max(texelFetch(hiz, p0, level).r, texelFetch(hiz, ivec2(p1.x, p0.y), level).r),
+                         max(texelFetch(hiz, ivec2(p0.x, p1.y), level).r, texelFetch(hiz, p1, level).r));
+    return ndc_depth * 0.5f + 0.5f <= farthest;
+}
+
+void main()
+{
+    uint i = gl_GlobalInvocationID.x;
+    if(i >= instance_total)
+        return;
+    bool was_visible = visibility[i] != 0u;
+    if(phase == EARLY_PHASE && !was_visible)
+        return;
+
+    bool visible = true;
+    if(has_bounds)
+    {
+        mat4 mvp = view_projection * instances[i].model;
+        uvec3 below = uvec3(0u), above = uvec3(0u); // corners outside each pair of clip planes
+        bool crosses_near = false;
+        vec3 ndc_min = vec3(1.f), ndc_max = vec3(-1.f);
+        for(uint c = 0u; c < 8u; c++)
+        {
+            vec3 corner = mix(bounds_min, bounds_max, vec3(c & 1u, (c >> 1) & 1u, (c >> 2) & 1u));
+            vec4 clip = mvp * vec4(corner, 1.f);
+            below += uvec3(lessThan(clip.xyz, vec3(-clip.w)));
+            above += uvec3(greaterThan(clip.xyz, vec3(clip.w)));
+            if(clip.w <= 0.f)
+                crosses_near = true;
+            else
+            {
+                vec3 ndc = clip.xyz / clip.w;
+                ndc_min = min(ndc_min, ndc);
+                ndc_max = max(ndc_max, ndc);
+            }
+        }
+        visible = all(lessThan(below, uvec3(8u))) && all(lessThan(above, uvec3(8u)));
+        // boxes crossing the camera plane have no usable screen rect and stay visible
+        if(visible && phase == LATE_PHASE && !crosses_near)
+            visible = HiZVisible(ndc_min.xy, ndc_max.xy, ndc_min.z);
+    }
+
+    bool draw = visible;
+    if(phase == LATE_PHASE)
+    {
+        visibility[i] = visible ? 1u : 0u;
+        draw = visible && !was_visible; // the rest was drawn in the early phase
+    }
+    if(draw)
+        survivors[atomicAdd(instance_count, 1u)] = instances[i];
+}
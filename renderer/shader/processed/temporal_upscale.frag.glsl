@@ -0,0 +1,38 @@
+#version 460
+
+// Temporal reconstruction of DynamicResolution: blends this frame's jittered low resolution color
+// into the reprojected output resolution history, which is clamped to the current neighbourhood against ghosting
+layout(binding = 8) uniform sampler2D current_color;  // DynamicResolution::COLOR_UNIT
+layout(binding = 9) uniform sampler2D current_depth;  // DynamicResolution::DEPTH_UNIT
+layout(binding = 10) uniform sampler2D history_color; // DynamicResolution::HISTORY_UNIT
+layout(location = 1) uniform mat4 reprojection;       // unjittered NDC of this frame to last frame's
+layout(location = 2) uniform vec2 jitter;             // NDC offset this frame was rendered with
+layout(location = 3) uniform float history_weight;    // 0 drops the history
+
+out vec4 out_color;
+
+void main()
+{
+    vec2 uv = gl_FragCoord.xy / vec2(textureSize(history_color, 0));
+    // the jittered frame shows the point at uv shifted by jitter / 2 in uv units
+    vec2 current_uv = uv + jitter * 0.5f;
+    vec4 current = texture(current_color, current_uv);
+
+    ivec2 size = textureSize(current_color, 0);
+    ivec2 pixel = clamp(ivec2(current_uv * vec2(size)), ivec2(0), size - 1);
+    vec4 low = current, high = current;
+    for(int y = -1; y <= 1; y++)
+        for(int x = -1; x <= 1; x++)
+        {
+            vec4 neighbour = texelFetch(current_color, clamp(pixel + ivec2(x, y), ivec2(0), size - 1), 0);
+            low = min(low, neighbour);
+            high = max(high, neighbour);
+        }
+
+    float depth = texelFetch(current_depth, pixel, 0).r;
+    vec4 previous = reprojection * vec4(uv * 2.f - 1.f, depth * 2.f - 1.f, 1.f);
+    vec2 history_uv = previous.xy / previous.w * 0.5f + 0.5f;
+    bool offscreen = any(lessThan(history_uv, vec2(0.f))) || any(greaterThan(history_uv, vec2(1.f)));
+    vec4 history = clamp(texture(history_color, history_uv), low, high);
+    out_color = mix(current, history, offscreen ? 0.f : history_weight);
+}
@@ -0,0 +1,31 @@
+#version 460
+
+// Writes the index of the draw covering each pixel as depth, resolving a draw then tests GL_EQUAL
+// against its own depth, so only its pixels run the shading.
+layout(binding = 8) uniform usampler2D visibility_ids; // VisibilityBuffer::ID_UNIT
+layout(std430, binding = 15) readonly buffer _visibilityDraws
+{
+    uint draw_bases[]; // first ID of every draw, ascending
+};
+layout(location = 1) uniform uint draw_count;
+
+void main()
+{
+    uint id = texelFetch(visibility_ids, ivec2(gl_FragCoord.xy), 0).r;
+    if(id == 0u)
+        discard;
+    // last draw starting at or before id
+    uint first = 0u, count = draw_count;
+    while(count > 1u)
+    {
+        uint half_count = count / 2u;
+        if(draw_bases[first + half_count] <= id)
+        {
+            first += half_count;
+            count -= half_count;
+        }
+        else
+            count = half_count;
+    }
+    gl_FragDepth = float(first + 1u) / 65536.f; // VisibilityBuffer::DrawDepth
+}
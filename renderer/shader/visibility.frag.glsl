@@ -0,0 +1,17 @@
+#version 460
+
+// Geometry pass of VisibilityBuffer, stores which triangle of which instance covers the pixel.
+// IDs of a draw are draw_base + instance * triangle_count + triangle, 0 is left for empty pixels.
+layout(early_fragment_tests) in;
+
+layout(location = 1) uniform uint draw_base;
+layout(location = 2) uniform uint triangle_count;
+
+flat in uint frag_instance;
+
+out uint out_id;
+
+void main()
+{
+    out_id = draw_base + frag_instance * triangle_count + uint(gl_PrimitiveID);
+}
\ No newline at end of file
@@ -0,0 +1,17 @@
+#version 460
+
+// Copies the resolved color and the geometry depth of covered pixels into the target framebuffer
+layout(binding = 8) uniform usampler2D visibility_ids;  // VisibilityBuffer::ID_UNIT
+layout(binding = 9) uniform sampler2D visibility_depth; // VisibilityBuffer::DEPTH_UNIT
+layout(binding = 10) uniform sampler2D shaded_color;    // VisibilityBuffer::COLOR_UNIT
+
+out vec4 out_color;
+
+void main()
+{
+    ivec2 pixel = ivec2(gl_FragCoord.xy);
+    if(texelFetch(visibility_ids, pixel, 0).r == 0u)
+        discard;
+    out_color = texelFetch(shaded_color, pixel, 0);
+    gl_FragDepth = texelFetch(visibility_depth, pixel, 0).r;
+}
\ No newline at end of file